@@ -15,7 +15,7 @@ from rc_gpu_runner_config import RCGPURunnerConfig
 
 def rc_gpu_runner(rc_mlir_input_path, mlir_runner_utils_path=None, vulkan_runtime_wrapper_path=None,
               verbose=False, printRCIR=False, printVulkanIR=False, warmupCount=0,
-              runCount=10, stdout=None, stderr=None):
+              runCount=10, timingFile=None, stdout=None, stderr=None):
     rc_gpu_runner_path = os.path.abspath(RCGPURunnerConfig.rc_gpu_runner)
     rc_gpu_runner_args = [rc_mlir_input_path]
     if mlir_runner_utils_path:
@@ -39,6 +39,9 @@ def rc_gpu_runner(rc_mlir_input_path, mlir_runner_utils_path=None, vulkan_runtim
     if runCount:
         rc_gpu_runner_args += ["--runCount={}".format(str(int(runCount)))]
 
+    if timingFile:
+        rc_gpu_runner_args += ["--timingFile={}".format(timingFile)]
+
     command = " ".join([rc_gpu_runner_path] + rc_gpu_runner_args)
     run_command(command, stdout=stdout, stderr=stderr)
 
@@ -51,6 +54,7 @@ def add_rc_gpu_runner_args(parser):
     parser.add_argument("--printVulkanIR", action="store_true", help="Print module after running GPU and Vulkan passes on it to console")
     parser.add_argument("--warmupCount", type=int, default=0, help="Number of warmup runs to perform")
     parser.add_argument("--runCount", type=int, default=10, help="Number of timed runs to perform")
+    parser.add_argument("--timingFile", type=str, help="Path of a JSON file to fill with per-iteration timing samples and summary statistics")
 
 if __name__ == "__main__":
     parser = argparse.ArgumentParser()
@@ -73,4 +77,5 @@ if __name__ == "__main__":
                   printRCIR=args.printRCIR,
                   printVulkanIR=args.printVulkanIR,
                   warmupCount=args.warmupCount,
-                  runCount=args.runCount)
+                  runCount=args.runCount,
+                  timingFile=args.timingFile)
@@ -103,6 +103,18 @@ llvm::cl::opt<int> runCount{ "runCount",
                              llvm::cl::desc("Number of timed runs to perform"),
                              llvm::cl::init(1),
                              llvm::cl::cat(RCGPURunnerOptions) };
+llvm::cl::opt<int> concurrentDispatchCount{ "concurrentDispatchCount",
+                                            llvm::cl::desc("Number of concurrent dispatches to submit across compute queues each run"),
+                                            llvm::cl::init(1),
+                                            llvm::cl::cat(RCGPURunnerOptions) };
+llvm::cl::opt<int> launchBatchSize{ "launchBatchSize",
+                                    llvm::cl::desc("Number of back-to-back dispatches recorded per command buffer submission"),
+                                    llvm::cl::init(1),
+                                    llvm::cl::cat(RCGPURunnerOptions) };
+llvm::cl::opt<std::string> timingFile{ "timingFile",
+                                       llvm::cl::desc("Path of a JSON file to fill with per-iteration timing samples and summary statistics"),
+                                       llvm::cl::init(""),
+                                       llvm::cl::cat(RCGPURunnerOptions) };
 
 // This function needs to be kept updated with runMLIRPasses(ModuleOp module) in
 // mlir\tools\mlir-vulkan-runner\mlir-vulkan-runner.cpp in llvm-project
@@ -130,7 +142,10 @@ void AddMLIRVulkanRunnerPasses(PassManager& passManager)
     accera::transforms::vulkan::VulkanTimingOptions vulkanTimingOptions = {
         printTiming,
         warmupCount,
-        runCount
+        runCount,
+        concurrentDispatchCount,
+        launchBatchSize,
+        timingFile
     };
     passManager.addPass(accera::transforms::vulkan::createConvertVulkanLaunchFuncToVulkanCallsWithTimingPass(vulkanTimingOptions));
 }
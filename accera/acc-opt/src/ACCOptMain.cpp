@@ -8,6 +8,7 @@
 #include <llvm/Support/FileUtilities.h>
 #include <llvm/Support/InitLLVM.h>
 #include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/StringSaver.h>
 #include <llvm/Support/ToolOutputFile.h>
 #include <mlir/IR/AsmState.h>
 #include <mlir/IR/MLIRContext.h>
@@ -16,6 +17,7 @@
 #include <mlir/Pass/PassManager.h>
 #include <mlir/Support/FileUtilities.h>
 #include <mlir/Support/MlirOptMain.h>
+#include <mlir/Support/Timing.h>
 
 #include <ir/include/DialectRegistry.h>
 #include <transforms/include/AcceraPasses.h>
@@ -54,6 +56,12 @@ static llvm::cl::opt<bool>
                  llvm::cl::desc("Print the list of registered dialects"),
                  llvm::cl::init(false));
 
+static llvm::cl::opt<bool> runReproducer(
+    "run-reproducer",
+    llvm::cl::desc("Run the pipeline stored in the reproducer's "
+                   "'// configuration:' line"),
+    llvm::cl::init(false));
+
 int main(int argc, char** argv)
 {
     llvm::InitLLVM y(argc, argv);
@@ -63,6 +71,9 @@ int main(int argc, char** argv)
     mlir::registerAsmPrinterCLOptions();
     mlir::registerMLIRContextCLOptions();
     mlir::registerPassManagerCLOptions();
+    // Wires -mlir-timing/-mlir-timing-display to the timing manager the pass
+    // manager runs under, for per-pass compile-time reports.
+    mlir::registerDefaultTimingManagerCLOptions();
     mlir::PassPipelineCLParser passPipeline("", "Compiler passes to run");
     llvm::cl::ParseCommandLineOptions(argc, argv, "Accera MLIR compiler\n");
 
@@ -94,6 +105,27 @@ int main(int argc, char** argv)
         return 1;
     }
 
+    if (runReproducer)
+    {
+        // Crash reproducers saved by the pass manager record their pipeline and
+        // flags in a leading "// configuration:" line. Splice those options into
+        // the command line so a reproducer re-runs without retyping them.
+        llvm::StringRef configLine = file->getBuffer().split('\n').first;
+        if (configLine.consume_front("// configuration:"))
+        {
+            llvm::BumpPtrAllocator allocator;
+            llvm::StringSaver saver(allocator);
+            llvm::SmallVector<const char*, 8> configArgs = { argv[0] };
+            llvm::cl::TokenizeGNUCommandLine(configLine, saver, configArgs);
+            llvm::cl::ParseCommandLineOptions(static_cast<int>(configArgs.size()), configArgs.data(), "Accera MLIR compiler\n");
+        }
+        else
+        {
+            llvm::errs() << input_filename << " does not contain a '// configuration:' line\n";
+            return 1;
+        }
+    }
+
     auto output = mlir::openOutputFile(output_filename, &error_message);
     assert(output);
     if (!output)
@@ -110,5 +142,8 @@ int main(int argc, char** argv)
         split_input_file,
         verify_diagnostics,
         verify_passes,
-        allowUnregisteredDialects));
+        allowUnregisteredDialects,
+        // Preload the registered dialects so parsing and the multithreaded pass
+        // manager don't serialize on lazy dialect loading.
+        /*preloadDialectsInContext=*/true));
 }
@@ -3739,6 +3739,59 @@ TEST_CASE("vectorized_exp_test")
     SUCCEED();
 }
 
+// CHECK-LABEL: module @vectorized_transcendental_test {
+TEST_CASE("vectorized_transcendental_test")
+{
+    const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+    const int vectorBytes = vectorSize * 4; // 4 bytes per float
+    const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+    const int M = 32;
+    const int N = 500;
+
+    DeclareFunction("main")
+        .Public(true)
+        .Decorated(false)
+        .Define([=]() {
+            auto A = MakeArray<float>({ M, N });
+            auto B = MakeArray<float>({ M, N });
+
+            Nest fillNest(A.Shape());
+            Scalar i, j;
+            std::tie(i, j) = fillNest.GetIndices<2>();
+            fillNest.Set([&]() {
+                auto iVal = Scalar(Cast(i, ValueType::Int32));
+                auto jVal = Scalar(Cast(j, ValueType::Int32));
+
+                A(i, j) = Scalar(Cast((iVal * 10) + jVal, ValueType::Float));
+                B(i, j) = 0.0f;
+            });
+            fillNest.CreateSchedule();
+
+            Print("X\n"s);
+
+            Nest computeNest(A.Shape());
+            Scalar ii, jj;
+            std::tie(ii, jj) = computeNest.GetIndices<2>();
+            computeNest.Set([&]() {
+                auto x = A(ii, jj);
+                auto y = FastLog(x + 1.0f);
+                y = y + FastTanh(x, FastMathAccuracy::Low);
+                y = y + FastSigmoid(x);
+                y = y + FastErf(x);
+                B(ii, jj) = y;
+            });
+            auto schedule = computeNest.CreateSchedule();
+
+            schedule.SetOrder({ ii, jj });
+            auto plan = schedule.CreatePlan();
+            plan.Vectorize(jj, { vectorBytes, vectorUnits });
+
+            Print(B);
+        });
+
+    SUCCEED();
+}
+
 // CHECK-LABEL: module @softmax_test {
 TEST_CASE("softmax_test")
 {
@@ -133,7 +133,12 @@ namespace cpp_printer
         }
 
         const auto rowcolIndices = std::make_pair(storeMatrixOp.indices()[0], storeMatrixOp.indices()[1]);
-        return printStoreMatrixOp(state, printer, storeMatrixOp.src(), storeMatrixOp.memref(), rowcolIndices);
+        auto epilogueOp = vir::MMAFragmentOpType::None;
+        if (auto epilogueAttr = storeMatrixOp->getAttrOfType<IntegerAttr>(vir::MMAEpilogueOpAttrName))
+        {
+            epilogueOp = static_cast<vir::MMAFragmentOpType>(epilogueAttr.getInt());
+        }
+        return printStoreMatrixOp(state, printer, storeMatrixOp.src(), storeMatrixOp.memref(), rowcolIndices, epilogueOp);
     }
 
     LogicalResult AcceraDialectCppPrinter::printVectorType(mlir::Type elementType, const uint32_t stride) const
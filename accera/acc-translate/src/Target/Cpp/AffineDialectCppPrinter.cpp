@@ -538,6 +538,87 @@ namespace cpp_printer
         return success();
     }
 
+    LogicalResult
+    AffineDialectCppPrinter::printAffineParallelOp(AffineParallelOp affineParallelOp)
+    {
+        if (!affineParallelOp.getResults().empty())
+        {
+            return affineParallelOp.emitError("affine.parallel with reductions is not supported yet");
+        }
+
+        auto lbMap = affineParallelOp.getLowerBoundsValueMap().getAffineMap();
+        auto ubMap = affineParallelOp.getUpperBoundsValueMap().getAffineMap();
+        auto numDims = affineParallelOp.getNumDims();
+        if (lbMap.getNumResults() != numDims || ubMap.getNumResults() != numDims)
+        {
+            return affineParallelOp.emitError("affine.parallel with min/max bounds is not supported yet");
+        }
+        for (unsigned dim = 0; dim < numDims; ++dim)
+        {
+            if (!lbMap.getResult(dim).isa<AffineConstantExpr>() || !ubMap.getResult(dim).isa<AffineConstantExpr>())
+            {
+                return affineParallelOp.emitError("non-const affine.parallel bounds are not supported yet");
+            }
+        }
+
+        auto steps = affineParallelOp.getSteps();
+
+        // Reconstruct the OpenMP clauses from the attributes unpacked by the parallelization
+        // lowering (cf. ParallelizeAffineForOpConversion); the attribute names are the OpenMP
+        // dialect's, but they're read as plain strings here to keep the printer free of a
+        // dialect dependency
+        os << "#pragma omp parallel for";
+        if (auto numThreads = affineParallelOp->getAttrOfType<IntegerAttr>("omp.num_threads"))
+        {
+            os << " num_threads(" << numThreads.getInt() << ")";
+        }
+        if (auto schedule = affineParallelOp->getAttrOfType<StringAttr>("omp.schedule_val"))
+        {
+            os << " schedule(" << schedule.getValue().lower();
+            if (auto chunkSize = affineParallelOp->getAttrOfType<IntegerAttr>("omp.schedule_chunk"))
+            {
+                os << ", " << chunkSize.getInt();
+            }
+            os << ")";
+        }
+        if (auto procBind = affineParallelOp->getAttrOfType<StringAttr>("omp.proc_bind"))
+        {
+            os << " proc_bind(" << procBind.getValue() << ")";
+        }
+        if (numDims > 1)
+        {
+            // Collapsed (perfectly nested) parallel loops print as a nest with a collapse clause
+            os << " collapse(" << numDims << ")";
+        }
+        os << "\n";
+
+        for (unsigned dim = 0; dim < numDims; ++dim)
+        {
+            auto lowerBound = lbMap.getResult(dim).cast<AffineConstantExpr>().getValue();
+            auto upperBound = ubMap.getResult(dim).cast<AffineConstantExpr>().getValue();
+
+            Value idxVal = affineParallelOp.getIVs()[dim];
+            StringRef idxName = state.nameState.getOrCreateName(
+                idxVal, SSANameState::SSANameKind::LoopIdx);
+
+            os << "for (";
+            RETURN_IF_FAILED(printer->printType(idxVal.getType()));
+            os << " " << idxName << " = " << lowerBound << "; ";
+            os << idxName << " < " << upperBound << "; ";
+            os << idxName << " += " << steps[dim] << ") {\n";
+        }
+
+        auto& loopRegion = affineParallelOp.region();
+        RETURN_IF_FAILED(printer->printRegion(loopRegion, /*printParens*/ false,
+                                              /*printBlockTerminator*/ true));
+        for (unsigned dim = 0; dim < numDims; ++dim)
+        {
+            os << "}\n";
+        }
+
+        return success();
+    }
+
     LogicalResult AffineDialectCppPrinter::printAffineYieldOp(AffineYieldOp affineYieldOp)
     {
         if (affineYieldOp.getNumOperands() == 0)
@@ -586,6 +667,12 @@ namespace cpp_printer
             return printAffineForOp(affineForOp);
         }
 
+        if (auto affineParallelOp = dyn_cast<AffineParallelOp>(op))
+        {
+            *skipped = true;
+            return printAffineParallelOp(affineParallelOp);
+        }
+
         *consumed = false;
         return success();
     }
@@ -42,6 +42,8 @@ namespace cpp_printer
 
         LogicalResult printAffineForOp(AffineForOp affineForOp);
 
+        LogicalResult printAffineParallelOp(AffineParallelOp affineParallelOp);
+
         LogicalResult printAffineYieldOp(AffineYieldOp affineYieldOp);
 
         LogicalResult printAffineMapFunc(AffineMap map, StringRef funcName);
@@ -416,8 +416,17 @@ namespace cpp_printer
         }
         else
         {
-            os << "<<non-cuda VectorType is not supported yet>>";
-            return failure();
+            // The CPU path declares vectors with the v<elem>x<count>_t aliases that
+            // StdDialectCppPrinter::printHeaderFiles defines via the compiler vector
+            // extensions.
+            if (vecType.getRank() != 1)
+            {
+                os << "<<only rank-1 VectorType is supported on the CPU path>>";
+                return failure();
+            }
+            RETURN_IF_FAILED(printVectorType(vecType));
+            os << " " << vecVar;
+            return success();
         }
     }
 
@@ -177,7 +177,7 @@ namespace cpp_printer
         return success();
     }
 
-    LogicalResult printStoreMatrixOp(PrinterState& state, CppPrinter* printer, Value src, Value dest, std::pair<Value, Value> rowcol)
+    LogicalResult printStoreMatrixOp(PrinterState& state, CppPrinter* printer, Value src, Value dest, std::pair<Value, Value> rowcol, vir::MMAFragmentOpType epilogueOp)
     {
         auto rowIdx = state.nameState.getOrCreateName(rowcol.first, SSANameState::SSANameKind::Variable, "row_");
         auto colIdx = state.nameState.getOrCreateName(rowcol.second, SSANameState::SSANameKind::Variable, "col_");
@@ -195,6 +195,14 @@ namespace cpp_printer
 
         const auto ns = getWmmaNamespace(state);
         auto&& os = printer->getOStream();
+        if (epilogueOp == vir::MMAFragmentOpType::ReLU)
+        {
+            // The epilogue runs per element while the fragment is still in registers,
+            // saving the separate epilogue kernel and its global memory round trip
+            const auto elem = fragName.str() + ".x[i]";
+            const auto zero = "decltype(" + elem + " + " + elem + "){}"; // value-initialized zero of the (non-reference) element type
+            os << "for (int i = 0; i < " << fragName << ".num_elements; ++i) " << elem << " = " << elem << " > " << zero << " ? " << elem << " : " << zero << ";\n";
+        }
         os << ns << "::store_matrix_sync(";
         os << getMemrefAccessStr(sharedMem, state.nameState.getName(dest).str(), rowIdx.str(), colIdx.str(), ld, rowMajor);
         os << ", " << fragName << ", " << ld << ", " << getMmaLayout(ns, rowMajor) << ")";
@@ -26,7 +26,7 @@ namespace cpp_printer
     LogicalResult printConstantMatrixOp(PrinterState& state, CppPrinter* printer, Type elementType, const std::tuple<int, int, int>& matrixShape, Value dest, Value value);
     LogicalResult printLoadMatrixOp(PrinterState& state, CppPrinter* printer, Type elementType, const std::tuple<int, int, int>& matrixShape, Value src, Value dest, vir::MMAOperandType operandType, std::pair<Value, Value> rowcol, bool rowMajor);
     LogicalResult printComputeMatrixOp(PrinterState& state, CppPrinter* printer, Type elementType, const std::tuple<int, int, int>& matrixShape, Value A, Value B, Value C, Value D);
-    LogicalResult printStoreMatrixOp(PrinterState& state, CppPrinter* printer, Value src, Value dest, std::pair<Value, Value> rowcol);
+    LogicalResult printStoreMatrixOp(PrinterState& state, CppPrinter* printer, Value src, Value dest, std::pair<Value, Value> rowcol, vir::MMAFragmentOpType epilogueOp = vir::MMAFragmentOpType::None);
 } // namespace cpp_printer
 } // namespace mlir
 
@@ -50,6 +50,7 @@ namespace cpp_printer
         LogicalResult printOp(gpu::LaunchFuncOp);
         LogicalResult printOp(gpu::ModuleEndOp);
         LogicalResult printOp(gpu::ReturnOp);
+        LogicalResult printOp(gpu::ShuffleOp);
         LogicalResult printOp(gpu::ThreadIdOp);
         LogicalResult printOp(gpu::SubgroupMmaConstantMatrixOp);
         LogicalResult printOp(gpu::SubgroupMmaLoadMatrixOp);
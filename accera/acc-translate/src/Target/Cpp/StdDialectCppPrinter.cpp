@@ -694,6 +694,48 @@ namespace cpp_printer
 
     LogicalResult StdDialectCppPrinter::printHeaderFiles()
     {
+        if (!state.hasRuntime(Runtime::CUDA))
+        {
+            // The CPU path prints vector values with the same v<elem>x<count>_t aliases
+            // the GPU path uses. Declaring them via the compiler vector extensions
+            // (clang's ext_vector_type, gcc's vector_size) maps each alias onto a SIMD
+            // register, so vector loads, stores, and arithmetic in the printed source
+            // keep the shapes the scheduler chose instead of relying on the host
+            // compiler to re-vectorize scalar element loops.
+            os << R"STD(
+#include <cstdint>
+
+#if defined(__clang__)
+#define ACCERA_VEC_TYPE(elemType, count) elemType __attribute__((ext_vector_type(count)))
+#else
+#define ACCERA_VEC_TYPE(elemType, count) elemType __attribute__((vector_size(count * sizeof(elemType))))
+#endif // __clang__
+
+using vfloatx2_t = ACCERA_VEC_TYPE(float, 2);
+using vfloatx4_t = ACCERA_VEC_TYPE(float, 4);
+using vfloatx8_t = ACCERA_VEC_TYPE(float, 8);
+using vfloatx16_t = ACCERA_VEC_TYPE(float, 16);
+using vfloatx32_t = ACCERA_VEC_TYPE(float, 32);
+using vfloatx64_t = ACCERA_VEC_TYPE(float, 64);
+using vint8x8_t = ACCERA_VEC_TYPE(int8_t, 8);
+using vint8x16_t = ACCERA_VEC_TYPE(int8_t, 16);
+using vint8x32_t = ACCERA_VEC_TYPE(int8_t, 32);
+using vint8x64_t = ACCERA_VEC_TYPE(int8_t, 64);
+using vint16x4_t = ACCERA_VEC_TYPE(int16_t, 4);
+using vint16x8_t = ACCERA_VEC_TYPE(int16_t, 8);
+using vint16x16_t = ACCERA_VEC_TYPE(int16_t, 16);
+using vint16x32_t = ACCERA_VEC_TYPE(int16_t, 32);
+using vint32x2_t = ACCERA_VEC_TYPE(int32_t, 2);
+using vint32x4_t = ACCERA_VEC_TYPE(int32_t, 4);
+using vint32x8_t = ACCERA_VEC_TYPE(int32_t, 8);
+using vint32x16_t = ACCERA_VEC_TYPE(int32_t, 16);
+using vint64x2_t = ACCERA_VEC_TYPE(int64_t, 2);
+using vint64x4_t = ACCERA_VEC_TYPE(int64_t, 4);
+using vint64x8_t = ACCERA_VEC_TYPE(int64_t, 8);
+
+)STD";
+        }
+
         return success();
     }
 
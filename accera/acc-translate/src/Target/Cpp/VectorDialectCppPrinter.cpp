@@ -89,6 +89,114 @@ namespace cpp_printer
         return success();
     }
 
+    LogicalResult VectorDialectCppPrinter::printFMAOp(vector::FMAOp op)
+    {
+        auto result = op.getResult();
+        auto idx = state.nameState.getOrCreateName(
+            result, SSANameState::SSANameKind::Variable);
+
+        // The vector extensions contract a whole-vector multiply-add into the
+        // target's fma instruction when one is available, so the expression form
+        // stays a single SIMD operation.
+        RETURN_IF_FAILED(printer->printType(result.getType()));
+        os << " " << idx;
+        os << " = ";
+        os << state.nameState.getName(op.lhs()) << " * ";
+        os << state.nameState.getName(op.rhs()) << " + ";
+        os << state.nameState.getName(op.acc());
+        return success();
+    }
+
+    LogicalResult VectorDialectCppPrinter::printShuffleOp(vector::ShuffleOp op)
+    {
+        auto vecTy = op.getVectorType();
+        if (vecTy.getRank() != 1) {
+            os << "[[ only rank 1 vector is supported ]]";
+            return failure();
+        }
+
+        auto result = op.getResult();
+        auto idx = state.nameState.getOrCreateName(
+            result, SSANameState::SSANameKind::Variable);
+
+        // __builtin_shufflevector is understood by both clang and gcc and keeps
+        // the permutation a single vector op instead of an element-wise copy loop
+        RETURN_IF_FAILED(printer->printType(vecTy));
+        os << " " << idx;
+        os << " = __builtin_shufflevector(";
+        os << state.nameState.getName(op.v1()) << ", ";
+        os << state.nameState.getName(op.v2());
+        for (auto maskElem : op.mask())
+        {
+            os << ", " << maskElem.cast<IntegerAttr>().getInt();
+        }
+        os << ")";
+        return success();
+    }
+
+    LogicalResult VectorDialectCppPrinter::printReductionOp(vector::ReductionOp op)
+    {
+        auto vecTy = op.vector().getType().cast<VectorType>();
+        if (vecTy.getRank() != 1) {
+            os << "[[ only rank 1 vector is supported ]]";
+            return failure();
+        }
+
+        auto numElems = vecTy.getNumElements();
+        auto vecName = state.nameState.getName(op.vector());
+
+        auto result = op.getResult();
+        auto idx = state.nameState.getOrCreateName(
+            result, SSANameState::SSANameKind::Variable);
+
+        RETURN_IF_FAILED(printer->printType(result.getType()));
+        os << " " << idx;
+        os << " = ";
+
+        auto kind = op.kind();
+        if (kind == "add" || kind == "mul")
+        {
+            auto opStr = (kind == "add") ? " + " : " * ";
+            os << "(";
+            for (int64_t i = 0; i < numElems; i++)
+            {
+                if (i > 0)
+                {
+                    os << opStr;
+                }
+                os << vecName << "[" << i << "]";
+            }
+            os << ")";
+            if (!op.acc().empty())
+            {
+                os << opStr << state.nameState.getName(op.acc().front());
+            }
+            return success();
+        }
+
+        if (kind == "min" || kind == "max")
+        {
+            if (!op.acc().empty())
+            {
+                os << "[[ min/max reduction with an accumulator is not supported ]]";
+                return failure();
+            }
+
+            auto cmpStr = (kind == "min") ? " < " : " > ";
+            os << vecName << "[0]";
+            for (int64_t i = 1; i < numElems; i++)
+            {
+                os << ";\n";
+                os << idx << " = (" << vecName << "[" << i << "]" << cmpStr << idx
+                   << ") ? " << vecName << "[" << i << "] : " << idx;
+            }
+            return success();
+        }
+
+        os << "[[ unsupported reduction kind '" << kind << "' ]]";
+        return failure();
+    }
+
     LogicalResult VectorDialectCppPrinter::printDialectOperation(Operation* op,
                                                                  bool* /*skipped*/,
                                                                  bool* consumed)
@@ -105,6 +213,12 @@ namespace cpp_printer
             return printStoreOp(storeOp);
         if (auto broadcastOp = dyn_cast<mlir::vector::BroadcastOp>(op))
             return printBroadcastOp(broadcastOp);
+        if (auto fmaOp = dyn_cast<mlir::vector::FMAOp>(op))
+            return printFMAOp(fmaOp);
+        if (auto shuffleOp = dyn_cast<mlir::vector::ShuffleOp>(op))
+            return printShuffleOp(shuffleOp);
+        if (auto reductionOp = dyn_cast<mlir::vector::ReductionOp>(op))
+            return printReductionOp(reductionOp);
 
 
         *consumed = false;
@@ -30,6 +30,9 @@ namespace cpp_printer
         LogicalResult printLoadOp(vector::LoadOp op);
         LogicalResult printStoreOp(vector::StoreOp op);
         LogicalResult printBroadcastOp(vector::BroadcastOp op);
+        LogicalResult printFMAOp(vector::FMAOp op);
+        LogicalResult printShuffleOp(vector::ShuffleOp op);
+        LogicalResult printReductionOp(vector::ReductionOp op);
     };
 
 } // namespace cpp_printer
@@ -5,8 +5,13 @@
 # Requires: Python 3.7+
 ####################################################################################################
 
+import glob
+import hashlib
+import json
 import os
+import platform
 import shutil
+from concurrent.futures import ThreadPoolExecutor
 from enum import Enum, auto
 
 from .utilities import *
@@ -125,6 +130,38 @@ DEFAULT_OPT_ARGS = []
 DEFAULT_LLC_ARGS = ["-relocation-model=pic"]
 
 
+def llvm_tooling_opts(system_target=SystemTarget.HOST.value, llvm_options=None):
+    # Starting from the per-target defaults, apply any structured overrides from the
+    # llvm_options dict (keys: opt_level, fast_math, unroll_threshold, loop_vectorize,
+    # target_cpu, target_features)
+    opts = list(LLVM_TOOLING_OPTS[system_target])
+    if not llvm_options:
+        return opts
+
+    if "opt_level" in llvm_options and llvm_options["opt_level"] is not None:
+        opts = [opt for opt in opts if not opt.startswith("-O")]
+        opts.insert(0, f"-O{llvm_options['opt_level']}")
+
+    if llvm_options.get("fast_math") is False:
+        opts = [opt for opt in opts if opt != "-fp-contract=fast"]
+
+    if llvm_options.get("target_cpu") is not None:
+        opts = [opt for opt in opts if not opt.lstrip("-").startswith("mcpu=")]
+        opts.append(f"-mcpu={llvm_options['target_cpu']}")
+
+    if llvm_options.get("target_features") is not None:
+        opts = [opt for opt in opts if not opt.lstrip("-").startswith("mattr=")]
+        opts.append(f"-mattr={llvm_options['target_features']}")
+
+    if llvm_options.get("unroll_threshold") is not None:
+        opts.append(f"--unroll-threshold={llvm_options['unroll_threshold']}")
+
+    if llvm_options.get("loop_vectorize") is not None:
+        opts.append(f"--vectorize-loops={str(bool(llvm_options['loop_vectorize'])).lower()}")
+
+    return opts
+
+
 def get_default_deploy_shared_libraries(target=CPU_TARGET):
     if target == GPU_TARGET:
         if os.path.isfile(BuildConfig.vulkan_runtime_wrapper_shared_library):
@@ -501,6 +538,78 @@ class ModuleFileSet:
         return s
 
 
+class BuildCheckpoint:
+    # Durable record of per-module build completion, paired with a content-addressed artifact
+    # cache so completed object files survive the intermediate working directory being cleared.
+    # Each successfully lowered+compiled module is recorded as (module name, hash of its
+    # generated MLIR, cached object file); a restarted build replays the cached object for any
+    # module whose generated MLIR hashes identically and only rebuilds the rest, so long
+    # package builds are no longer all-or-nothing.
+
+    checkpoint_filename = "build_checkpoint.json"
+    artifact_dir_name = "artifacts"
+
+    def __init__(self, checkpoint_dir, pretend=False, quiet=True):
+        self.checkpoint_dir = os.path.abspath(checkpoint_dir)
+        self.checkpoint_filepath = os.path.join(self.checkpoint_dir, self.checkpoint_filename)
+        self.artifact_dir = os.path.join(self.checkpoint_dir, self.artifact_dir_name)
+        self.pretend = pretend
+        self.quiet = quiet
+        self._entries = {}
+        if os.path.isfile(self.checkpoint_filepath):
+            try:
+                with open(self.checkpoint_filepath, "r") as checkpoint_file:
+                    self._entries = json.load(checkpoint_file)
+            except (OSError, ValueError):
+                # A checkpoint this build can't read (e.g. truncated by an earlier crash)
+                # is treated as absent rather than failing the build
+                self._entries = {}
+
+    @staticmethod
+    def _hash_file(filepath):
+        hasher = hashlib.sha256()
+        with open(filepath, "rb") as f:
+            for block in iter(lambda: f.read(1 << 20), b""):
+                hasher.update(block)
+        return hasher.hexdigest()
+
+    def try_restore(self, module_file_set):
+        # Returns True if a previous build completed this module with identical generated MLIR
+        # and its object file was replayed from the artifact cache
+        entry = self._entries.get(module_file_set.module_name)
+        if not entry or not os.path.isfile(module_file_set.generated_mlir_filepath):
+            return False
+        if entry.get("mlir_hash") != self._hash_file(module_file_set.generated_mlir_filepath):
+            return False
+        cached_object_filepath = os.path.join(self.artifact_dir, entry.get("artifact", ""))
+        if not os.path.isfile(cached_object_filepath):
+            return False
+        if not self.pretend:
+            makedir(module_file_set.module_dir, pretend=self.pretend, quiet=self.quiet)
+            shutil.copyfile(cached_object_filepath, module_file_set.object_filepath)
+        if not self.quiet:
+            print(f"Restored {module_file_set.module_name} from checkpoint")
+        return True
+
+    def record(self, module_file_set):
+        if self.pretend:
+            return
+        mlir_hash = self._hash_file(module_file_set.generated_mlir_filepath)
+        artifact_name = mlir_hash + BuildConfig.obj_extension
+        os.makedirs(self.artifact_dir, exist_ok=True)
+        shutil.copyfile(module_file_set.object_filepath, os.path.join(self.artifact_dir, artifact_name))
+        self._entries[module_file_set.module_name] = {
+            "mlir_hash": mlir_hash,
+            "artifact": artifact_name
+        }
+
+        # Write-then-rename so a crash mid-record never corrupts the checkpoint
+        temp_filepath = self.checkpoint_filepath + ".tmp"
+        with open(temp_filepath, "w") as checkpoint_file:
+            json.dump(self._entries, checkpoint_file, indent=2)
+        os.replace(temp_filepath, self.checkpoint_filepath)
+
+
 class AcceraProject:
     stdout_key = "stdout"
     stderr_key = "stderr"
@@ -718,10 +827,12 @@ class AcceraProject:
         runtime=Runtime.DEFAULT.value,
         profile=False,
         quiet=None,
-        gpu_only=False
+        gpu_only=False,
+        module_file_sets=None
     ):
 
         quiet = quiet if quiet is not None else self.quiet
+        module_file_sets = module_file_sets if module_file_sets is not None else self.module_file_sets
 
         default_passes = DEFAULT_RC_MLIR_LOWERING_PASSES(
             dump=dump_all_passes,
@@ -738,7 +849,7 @@ class AcceraProject:
         rc_opt_exe = os.path.abspath(ACCCConfig.rc_opt)
         rc_opt_base_args = rc_opt_args or DEFAULT_RC_OPT_ARGS
 
-        for module_file_set in self.module_file_sets:
+        for module_file_set in module_file_sets:
             current_output_path = module_file_set.module_dir
 
             makedir(current_output_path, pretend=pretend, quiet=quiet)
@@ -809,15 +920,17 @@ class AcceraProject:
         stderr=None,
         pretend=False,
         system_target=SystemTarget.HOST.value,
-        quiet=None
+        quiet=None,
+        module_file_sets=None
     ):
 
         quiet = quiet if quiet is not None else self.quiet
+        module_file_sets = module_file_sets if module_file_sets is not None else self.module_file_sets
 
         if self.print_subprocess_output:
             stdout = None
             stderr = None
-        for module_file_set in self.module_file_sets:
+        for module_file_set in module_file_sets:
             mlir_translate_exe = os.path.abspath(ACCCConfig.mlir_translate)
             full_mlir_translate_args = []    # empty list every iteration
             full_mlir_translate_args += mlir_translate_args or DEFAULT_MLIR_TRANSLATE_ARGS
@@ -840,18 +953,21 @@ class AcceraProject:
         stderr=None,
         pretend=False,
         system_target=SystemTarget.HOST.value,
-        quiet=None
+        llvm_options=None,
+        quiet=None,
+        module_file_sets=None
     ):
 
         quiet = quiet if quiet is not None else self.quiet
+        module_file_sets = module_file_sets if module_file_sets is not None else self.module_file_sets
 
         if self.print_subprocess_output:
             stdout = None
             stderr = None
-        for module_file_set in self.module_file_sets:
+        for module_file_set in module_file_sets:
             llvm_opt_exe = os.path.abspath(ACCCConfig.llvm_opt)
             full_llvm_opt_args = []    # empty list every iteration
-            full_llvm_opt_args += llvm_opt_args or (LLVM_TOOLING_OPTS[system_target] + DEFAULT_OPT_ARGS)
+            full_llvm_opt_args += llvm_opt_args or (llvm_tooling_opts(system_target, llvm_options) + DEFAULT_OPT_ARGS)
             full_llvm_opt_args += [f'-o="{module_file_set.optimized_ll_filepath}"']
             full_llvm_opt_args += [f'"{module_file_set.translated_ll_filepath}"']
             llvm_opt_command = " ".join([f'"{llvm_opt_exe}"'] + full_llvm_opt_args)
@@ -864,6 +980,81 @@ class AcceraProject:
                 quiet=quiet
             )
 
+    def _codegen_split_count(self, num_codegen_threads):
+        # Parallel object emission requires llvm-split and a relocatable link step (ld -r),
+        # so it is only available on non-Windows hosts with a full LLVM tool deployment
+        if num_codegen_threads == 1 or platform.system() == "Windows" or not shutil.which("ld"):
+            return 1
+        llvm_split_exe = getattr(ACCCConfig, "llvm_split", None)
+        if not llvm_split_exe or not os.path.exists(llvm_split_exe):
+            return 1
+        return max(1, num_codegen_threads or os.cpu_count() or 1)
+
+    def _generate_object_parallel(
+        self,
+        module_file_set,
+        full_llc_args,
+        split_count,
+        stdout=None,
+        stderr=None,
+        pretend=False,
+        quiet=None
+    ):
+        # Split the optimized module into balanced partitions, run MC emission for each
+        # partition in parallel, then relocatable-link the partial objects into the single
+        # object file the rest of the packaging flow expects
+        llvm_split_exe = os.path.abspath(ACCCConfig.llvm_split)
+        llc_exe = os.path.abspath(ACCCConfig.llc)
+        split_prefix = module_file_set.optimized_ll_filepath + ".split."
+
+        split_command = " ".join([
+            f'"{llvm_split_exe}"', f"-j={split_count}", "-preserve-locals", f'-o="{split_prefix}"',
+            f'"{module_file_set.optimized_ll_filepath}"'
+        ])
+        run_command(
+            split_command,
+            working_directory=self.intermediate_working_dir,
+            stdout=stdout,
+            stderr=stderr,
+            pretend=pretend,
+            quiet=quiet
+        )
+
+        partition_filepaths = sorted(glob.glob(glob.escape(split_prefix) + "*")) if not pretend else []
+        partition_obj_filepaths = [p + BuildConfig.obj_extension for p in partition_filepaths]
+
+        def emit_partition(partition_filepath, partition_obj_filepath):
+            llc_command = " ".join([f'"{llc_exe}"'] + full_llc_args + [
+                "-filetype=obj", f'-o="{partition_obj_filepath}"', f'"{partition_filepath}"'
+            ])
+            run_command(
+                llc_command,
+                working_directory=self.intermediate_working_dir,
+                stdout=stdout,
+                stderr=stderr,
+                pretend=pretend,
+                quiet=quiet
+            )
+
+        with ThreadPoolExecutor(max_workers=split_count) as executor:
+            futures = [
+                executor.submit(emit_partition, partition_filepath, partition_obj_filepath)
+                for partition_filepath, partition_obj_filepath in zip(partition_filepaths, partition_obj_filepaths)
+            ]
+            for future in futures:
+                future.result()
+
+        link_command = " ".join(['ld', "-r", f'-o "{module_file_set.object_filepath}"'] +
+                                [f'"{p}"' for p in partition_obj_filepaths])
+        run_command(
+            link_command,
+            working_directory=self.intermediate_working_dir,
+            stdout=stdout,
+            stderr=stderr,
+            pretend=pretend,
+            quiet=quiet
+        )
+
     def generate_object(
         self,
         llc_args=None,
@@ -871,18 +1062,34 @@ class AcceraProject:
         stderr=None,
         pretend=False,
         system_target=SystemTarget.HOST.value,
-        quiet=None
+        llvm_options=None,
+        num_codegen_threads=None,
+        quiet=None,
+        module_file_sets=None
     ):
 
         quiet = quiet if quiet is not None else self.quiet
+        module_file_sets = module_file_sets if module_file_sets is not None else self.module_file_sets
 
         if self.print_subprocess_output:
             stdout = None
             stderr = None
-        for module_file_set in self.module_file_sets:
+        split_count = self._codegen_split_count(num_codegen_threads)
+        for module_file_set in module_file_sets:
             llc_exe = os.path.abspath(ACCCConfig.llc)
             full_llc_args = []    # empty list every iteration
-            full_llc_args += llc_args or (LLVM_TOOLING_OPTS[system_target] + DEFAULT_LLC_ARGS)
+            full_llc_args += llc_args or (llvm_tooling_opts(system_target, llvm_options) + DEFAULT_LLC_ARGS)
+            if split_count > 1:
+                self._generate_object_parallel(
+                    module_file_set,
+                    full_llc_args,
+                    split_count,
+                    stdout=stdout,
+                    stderr=stderr,
+                    pretend=pretend,
+                    quiet=quiet
+                )
+                continue
             full_llc_args += ["-filetype=obj"]
             full_llc_args += [f'-o="{module_file_set.object_filepath}"']
             full_llc_args += [f'"{module_file_set.optimized_ll_filepath}"']
@@ -903,18 +1110,21 @@ class AcceraProject:
         stderr=None,
         pretend=False,
         system_target=SystemTarget.HOST.value,
-        quiet=None
+        llvm_options=None,
+        quiet=None,
+        module_file_sets=None
     ):
 
         quiet = quiet if quiet is not None else self.quiet
+        module_file_sets = module_file_sets if module_file_sets is not None else self.module_file_sets
 
         if self.print_subprocess_output:
             stdout = None
             stderr = None
-        for module_file_set in self.module_file_sets:
+        for module_file_set in module_file_sets:
             llc_exe = os.path.abspath(ACCCConfig.llc)
             full_llc_args = []    # empty list every iteration
-            full_llc_args += llc_args or (LLVM_TOOLING_OPTS[system_target] + DEFAULT_LLC_ARGS)
+            full_llc_args += llc_args or (llvm_tooling_opts(system_target, llvm_options) + DEFAULT_LLC_ARGS)
             full_llc_args += ["--filetype=asm"]
             full_llc_args += [f'-o="{module_file_set.asm_filepath}"']
             full_llc_args += [f'"{module_file_set.optimized_ll_filepath}"']
@@ -967,8 +1177,11 @@ class AcceraProject:
         pretend=False,
         system_target=SystemTarget.HOST.value,
         runtime=Runtime.DEFAULT.value,
+        llvm_options=None,
+        num_codegen_threads=None,
         quiet=None,
-        gpu_only=False
+        gpu_only=False,
+        checkpoint=False
     ):
         # By default, save stdout and stderr for each phase to separate files
 
@@ -994,6 +1207,94 @@ class AcceraProject:
                         quiet=quiet
                     )
 
+        checkpoint_state = None
+        if checkpoint and self.output_type == ModuleOutputType.OBJECT:
+            checkpoint_state = BuildCheckpoint(
+                os.path.join(self.output_dir, "checkpoint"), pretend=pretend, quiet=quiet
+            )
+            pending_module_file_sets = [
+                module_file_set for module_file_set in self.module_file_sets
+                if not checkpoint_state.try_restore(module_file_set)
+            ]
+            if not quiet:
+                restored_count = len(self.module_file_sets) - len(pending_module_file_sets)
+                print(f"\n### Restored {restored_count} of {len(self.module_file_sets)} modules from checkpoint\n")
+
+            # Stream each remaining module through the whole lowering+compilation pipeline and
+            # checkpoint it before starting the next, so a crash loses at most the module in
+            # flight and the in-flight working set stays bounded regardless of package size
+            for log_files in [mlir_lowering_files, translate_files, opt_files, llc_files, llc_asm_files]:
+                for log_filepath in log_files.values():
+                    with OpenFile(log_filepath, "w", pretend=pretend):
+                        pass
+
+            for module_file_set in pending_module_file_sets:
+                current_module = [module_file_set]
+                with OpenFile(mlir_lowering_files[self.stderr_key], "a", pretend=pretend) as stderr_file:
+                    self.lower_mlir(
+                        dump_all_passes=dump_all_passes,
+                        dump_intrapass_ir=dump_intrapass_ir,
+                        stderr=stderr_file,
+                        pretend=pretend,
+                        system_target=system_target,
+                        runtime=runtime,
+                        profile=profile,
+                        quiet=quiet,
+                        gpu_only=gpu_only,
+                        module_file_sets=current_module
+                    )
+
+                with OpenFile(translate_files[self.stdout_key], "a", pretend=pretend) as stdout_file:
+                    with OpenFile(translate_files[self.stderr_key], "a", pretend=pretend) as stderr_file:
+                        self.translate_mlir_with_mlir_translate(
+                            stdout=stdout_file,
+                            stderr=stderr_file,
+                            pretend=pretend,
+                            system_target=system_target,
+                            quiet=quiet,
+                            module_file_sets=current_module
+                        )
+
+                with OpenFile(opt_files[self.stdout_key], "a", pretend=pretend) as stdout_file:
+                    with OpenFile(opt_files[self.stderr_key], "a", pretend=pretend) as stderr_file:
+                        self.optimize_llvm(
+                            stdout=stdout_file,
+                            stderr=stderr_file,
+                            pretend=pretend,
+                            system_target=system_target,
+                            llvm_options=llvm_options,
+                            quiet=quiet,
+                            module_file_sets=current_module
+                        )
+
+                with OpenFile(llc_files[self.stdout_key], "a", pretend=pretend) as stdout_file:
+                    with OpenFile(llc_files[self.stderr_key], "a", pretend=pretend) as stderr_file:
+                        self.generate_object(
+                            stdout=stdout_file,
+                            stderr=stderr_file,
+                            pretend=pretend,
+                            system_target=system_target,
+                            llvm_options=llvm_options,
+                            num_codegen_threads=num_codegen_threads,
+                            quiet=quiet,
+                            module_file_sets=current_module
+                        )
+
+                with OpenFile(llc_asm_files[self.stdout_key], "a", pretend=pretend) as stdout_file:
+                    with OpenFile(llc_asm_files[self.stderr_key], "a", pretend=pretend) as stderr_file:
+                        self.generate_asm(
+                            stdout=stdout_file,
+                            stderr=stderr_file,
+                            pretend=pretend,
+                            system_target=system_target,
+                            llvm_options=llvm_options,
+                            quiet=quiet,
+                            module_file_sets=current_module
+                        )
+
+                checkpoint_state.record(module_file_set)
+            return
+
         # Note: mlir-opt doesn't appear to support the -o option correctly, so all output goes to stdout
         #       therefore we can't capture and log stdout separately as we need it for the lowering pipeling
         with OpenFile(mlir_lowering_files[self.stderr_key], "w", pretend=pretend) as stderr_file:
@@ -1028,6 +1329,7 @@ class AcceraProject:
                         stderr=stderr_file,
                         pretend=pretend,
                         system_target=system_target,
+                        llvm_options=llvm_options,
                         quiet=quiet
                     )
 
@@ -1038,6 +1340,8 @@ class AcceraProject:
                         stderr=stderr_file,
                         pretend=pretend,
                         system_target=system_target,
+                        llvm_options=llvm_options,
+                        num_codegen_threads=num_codegen_threads,
                         quiet=quiet
                     )
 
@@ -1048,6 +1352,7 @@ class AcceraProject:
                         stderr=stderr_file,
                         pretend=pretend,
                         system_target=system_target,
+                        llvm_options=llvm_options,
                         quiet=quiet
                     )
 
@@ -1082,7 +1387,8 @@ def accc(
     print_subprocess_output=False,
     pretend=False,
     system_target=SystemTarget.HOST.value,
-    runtime=Runtime.DEFAULT.value
+    runtime=Runtime.DEFAULT.value,
+    checkpoint=False
 ):
     if pretend:
         print()
@@ -1118,7 +1424,8 @@ def accc(
         dump_all_passes=dump_all_passes,
         dump_intrapass_ir=dump_intrapass_ir,
         profile=profile,
-        pretend=pretend
+        pretend=pretend,
+        checkpoint=checkpoint
     )
 
     # If main c++ file is provided, create main program
@@ -1233,13 +1233,20 @@ public:
     std::string DebugCode() const { return _debugCode; }
 
     std::string Serialize() const
+    {
+        std::ostringstream serializationOs;
+        Serialize(serializationOs);
+        return serializationOs.str();
+    }
+
+    // Streams the package section-by-section so large packages (whose code section embeds
+    // every function declaration) don't have to be materialized as one string first.
+    template <typename StreamType>
+    void Serialize(StreamType& serializationOs) const
     {
         // By default, the toml utility library will serialize a table in lexical order,
         // so to have a particular user-friendly order, serialize different subtables into
         // an output stream individually
-
-        // The toml utility library only supports outputing to std::ostringstream
-        std::ostringstream serializationOs;
         {
             HeaderIncludeGuard includeGuard(serializationOs, _name);
             {
@@ -1276,6 +1283,13 @@ public:
                 compiledWithTableWrapper.insert_or_assign("compiled_with", compiledWithTable);
                 serializationOs << compiledWithTableWrapper << "\n\n";
 
+                toml::table auxiliaryTableWrapper;
+                SerializeAuxiliary(auxiliaryTableWrapper);
+                if (!auxiliaryTableWrapper.empty())
+                {
+                    serializationOs << auxiliaryTableWrapper << "\n\n";
+                }
+
                 toml::table declarationTable;
 
                 std::ostringstream codeOs;
@@ -1298,8 +1312,6 @@ public:
                 serializationOs << declarationTableWrapper;
             }
         }
-
-        return serializationOs.str();
     }
 
 private:
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <mlir/IR/MLIRContext.h>
+
+namespace accera::ir
+{
+
+/// A reusable compilation context: runs the process-global LLVM target and dialect registration
+/// once and owns an MLIRContext with every dialect Accera uses already loaded, so drivers that
+/// compile many modules (e.g. a tuning loop) pay the fixed startup cost a single time instead of
+/// per invocation.
+///
+/// Thread-safety contract:
+///  - Construction is safe from any thread; the global registration runs exactly once per
+///    process regardless of how many contexts are created, so contexts after the first are
+///    cheap to construct.
+///  - One CompilationContext may be shared by threads compiling distinct modules: MLIR's
+///    type and attribute uniquing is internally synchronized. The IR objects themselves are
+///    not — never build or mutate the same module from two threads at once.
+///  - For full isolation (or different context settings), create one CompilationContext per
+///    worker thread instead of sharing.
+class CompilationContext
+{
+public:
+    CompilationContext();
+
+    /// The MLIR context, with all Accera and standard dialects loaded.
+    mlir::MLIRContext& GetMLIRContext() { return _context; }
+
+private:
+    mlir::MLIRContext _context;
+};
+
+} // namespace accera::ir
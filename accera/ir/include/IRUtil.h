@@ -18,6 +18,8 @@
 #include "value/ValueDialect.h"
 #include "value/ValueEnums.h"
 
+#include <utilities/include/ContentHash.h>
+
 #include <mlir/Dialect/GPU/GPUDialect.h>
 #include <mlir/Dialect/StandardOps/IR/Ops.h>
 #include <mlir/IR/Attributes.h>
@@ -269,6 +271,8 @@ namespace util
 
     mlir::Operation* CreateGPUControlBarrier(mlir::OpBuilder& builder, const std::string scope, std::optional<mlir::Location> loc = std::nullopt);
 
+    mlir::Value CreateGPUWarpReduce(mlir::OpBuilder& builder, mlir::Value input, const std::string kind, std::optional<mlir::Location> loc = std::nullopt);
+
     std::optional<int64_t> GetDimSizeAt(const loopnest::Index& dimensionIndex, mlir::Operation* where);
 
     std::vector<mlir::Value> GetCurrentIndexIVs(const std::vector<loopnest::Index>& loopIndices, mlir::Operation* where);
@@ -415,5 +419,12 @@ namespace util
     bool ShapesMatch(mlir::ShapedType lhs, mlir::ShapedType rhs);
     bool IsImplicitlyCastable(mlir::Type source, mlir::Type target);
 
+    // Computes a canonical 128-bit content hash of an operation and its regions, for keying
+    // compilation caches (per-function IR hashing, object caches, incremental builds). Locations
+    // and name-like attributes (symbol names, accv.base_name) are ignored, so IR that differs
+    // only by renaming or by where it was parsed from hashes the same; operand structure is
+    // captured by value numbering rather than value identity.
+    accera::utilities::ContentHash128 HashOperationContent(mlir::Operation* op);
+
 } // namespace util
 } // namespace accera::ir
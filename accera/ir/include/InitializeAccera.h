@@ -8,5 +8,7 @@
 
 namespace accera::ir
 {
+/// Registers the LLVM targets and global passes Accera emits against. Idempotent and safe to
+/// call from multiple threads; the registration work runs exactly once per process.
 void InitializeAccera();
 }
@@ -29,5 +29,11 @@ namespace ir
     mlir::LogicalResult TranslateToHeader(mlir::ModuleOp, std::ostream& os);
     mlir::LogicalResult TranslateToHeader(mlir::ModuleOp, llvm::raw_ostream& os);
     mlir::LogicalResult TranslateToHeader(std::vector<mlir::ModuleOp>& modules, const std::string& libraryName, llvm::raw_ostream& os);
+
+    // Emits the compact binary ("HATB") encoding of the function metadata in the text header,
+    // readable with a single mmap and offset fixup. The text header remains the human-readable
+    // source of truth; the binary sidecar exists to make loader startup parsing cheap.
+    mlir::LogicalResult TranslateToBinaryMetadata(mlir::ModuleOp, llvm::raw_ostream& os);
+    mlir::LogicalResult TranslateToBinaryMetadata(std::vector<mlir::ModuleOp>& modules, llvm::raw_ostream& os);
 } // namespace ir
 } // namespace accera
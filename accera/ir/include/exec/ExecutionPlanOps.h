@@ -106,6 +106,14 @@ namespace accera::ir::executionPlan
 // Unit attr name for controlling whether bounds checking is done for ops within a marked op
 const mlir::StringRef AccessBoundsCheckAttrName = "accxp.access_bounds_check";
 
+// Unit attr name marking the loops of a cache fill copy nest so compatible adjacent fills
+// can be fused after they're lowered to affine loops
+const mlir::StringRef CacheFillNestAttrName = "accxp.cache_fill_nest";
+
+// Unit attr name marking cache buffer allocations (and their deallocations) that should be
+// drawn from the runtime's recycling arena instead of calling malloc/free per invocation
+const mlir::StringRef CacheArenaAllocationAttrName = "accxp.cache_arena";
+
 //
 // Utility functions and EDSC-type intrinsics
 //
@@ -13,14 +13,42 @@ namespace executionPlan
 {
     struct ParallelizationInfo
     {
+        // Schedule policy values, kept in sync with accera::value::ParallelizationPolicy
+        static constexpr int64_t StaticPolicy = 0;
+        static constexpr int64_t DynamicPolicy = 1;
+        static constexpr int64_t WorkStealingPolicy = 2;
+        static constexpr int64_t HeterogeneousPolicy = 3;
+
+        // Reduction operator values, kept in sync with accera::value::ParallelReduction
+        static constexpr int64_t NoReduction = 0;
+        static constexpr int64_t SumReduction = 1;
+        static constexpr int64_t MaxReduction = 2;
+        static constexpr int64_t MinReduction = 3;
+
+        // Thread affinity values, kept in sync with accera::value::ParallelAffinity
+        static constexpr int64_t CompactAffinity = 0;
+        static constexpr int64_t ScatterAffinity = 1;
+
         int64_t numThreads = 4;
-        bool isDynamicPolicy = false;
-        // TODO: pinning
+        int64_t policy = StaticPolicy;
+        // Parallel regions with the same nesting level are collapsed together during lowering;
+        // differing levels produce nested parallel regions with separate thread counts
+        int64_t nestingLevel = 0;
+        // When set, the parallelized index carries a reduction and lowering privatizes the
+        // accumulators (one copy per thread) and combines them after the parallel region
+        int64_t reduction = NoReduction;
+        // Compact affinity keeps the threads on neighboring cores (OpenMP proc_bind(close));
+        // scatter spreads them across the available places, e.g. one per NUMA node or socket
+        // (proc_bind(spread)), so each thread stays near the memory it first-touched
+        int64_t affinity = CompactAffinity;
+        // Iterations handed to a thread at a time under the dynamic and work-stealing policies;
+        // 0 lets the policy pick its own chunking
+        int64_t chunkSize = 0;
 
     private:
         friend inline bool operator==(const ParallelizationInfo& p1, const ParallelizationInfo& p2)
         {
-            return (p1.numThreads == p2.numThreads) && (p1.isDynamicPolicy == p2.isDynamicPolicy);
+            return (p1.numThreads == p2.numThreads) && (p1.policy == p2.policy) && (p1.nestingLevel == p2.nestingLevel) && (p1.reduction == p2.reduction) && (p1.affinity == p2.affinity) && (p1.chunkSize == p2.chunkSize);
         }
         friend inline bool operator!=(const ParallelizationInfo& p1, const ParallelizationInfo& p2)
         {
@@ -20,11 +20,13 @@ namespace executionPlan
         int numFusedPasses{ -1 };
         accera::ir::value::MMASchedulingPolicy schedulingPolicy{};
         bool _useRocWMMA{};
+        bool pipelinePasses{};
+        accera::ir::value::MMAFragmentOpType epilogueOp{};
 
     private:
         friend inline bool operator==(const TensorizationInfo& p1, const TensorizationInfo& p2)
         {
-            return p1.dim == p2.dim && p1.useStaticOffsets == p2.useStaticOffsets && p1.numTotalPasses == p2.numTotalPasses && p1.numFusedPasses == p2.numFusedPasses && p1.schedulingPolicy == p2.schedulingPolicy && p1._useRocWMMA == p2._useRocWMMA;
+            return p1.dim == p2.dim && p1.useStaticOffsets == p2.useStaticOffsets && p1.numTotalPasses == p2.numTotalPasses && p1.numFusedPasses == p2.numFusedPasses && p1.schedulingPolicy == p2.schedulingPolicy && p1._useRocWMMA == p2._useRocWMMA && p1.pipelinePasses == p2.pipelinePasses && p1.epilogueOp == p2.epilogueOp;
         }
         friend inline bool operator!=(const TensorizationInfo& p1, const TensorizationInfo& p2)
         {
@@ -10,6 +10,7 @@
 
 #include <mlir/Dialect/Affine/Analysis/AffineStructures.h>
 
+#include <optional>
 #include <vector>
 #include <utility>
 
@@ -31,9 +32,16 @@ namespace loopnest
 
     private:
         uint64_t GetIndexPosition(Index index) const;
+        void InvalidateBounds(std::vector<uint64_t> positions);
 
         mlir::FlatAffineConstraints _constraints;
         std::vector<Index> _indices;
+
+        // Indices coupled through equality constraints: adding a constraint on one index can only
+        // tighten the bounds of the indices (transitively) linked to it, so solved bounds for
+        // everything else stay valid
+        std::vector<std::vector<uint64_t>> _linkedPositions;
+        mutable std::vector<std::optional<std::pair<int64_t, int64_t>>> _solvedBounds;
     };
 
 } // namespace loopnest
@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 
+#include <utilities/include/StringInterner.h>
+
 namespace accera::ir
 {
 namespace loopnest
@@ -39,11 +41,13 @@ namespace loopnest
     private:
         static int GetNextId();
 
-        friend inline bool operator==(const Index& i1, const Index& i2) { return i1.GetId() == i2.GetId() && i1.GetName() == i2.GetName(); }
+        friend inline bool operator==(const Index& i1, const Index& i2) { return i1._id == i2._id && i1._name == i2._name; }
         friend inline bool operator!=(const Index& i1, const Index& i2) { return !(i1 == i2); }
         friend inline bool operator<(const Index& i1, const Index& i2) { return i1.GetId() < i2.GetId(); }
 
-        std::string _name;
+        // Interned: indices are compared constantly during lowering, and a handle compare beats
+        // a string compare; the characters are only materialized for diagnostics and emission
+        utilities::InternedString _name;
         Id _id = Index::DefaultID;
     };
 
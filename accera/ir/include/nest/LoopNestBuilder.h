@@ -93,7 +93,7 @@ namespace loopnest
 
         void InvokeKernel(OpBuilder& builder, ScheduledKernelOp kernel, Position position, const LoopIndexSymbolTable& runtimeIndexVariables, const LoopVisitSchedule& schedule);
 
-        TransformedDomain GetDomain() const;
+        const TransformedDomain& GetDomain() const;
         LoopVisitSchedule GetLoopSchedule() const;
 
         ScheduledLoopOp EmitLoopOp(const LoopRange& range, const RecursionState& state, const LoopVisitSchedule& schedule);
@@ -159,6 +159,8 @@ namespace loopnest
         void EnsureTerminators();
 
         ScheduleOp _schedule;
+        TransformedDomain _domain; // deserialized once from the schedule's domain attribute and shared by all kernels
+        mutable std::optional<LoopVisitSchedule> _loopSchedule;
         std::map<std::string, std::vector<ScheduledKernelOp>> _kernelGroups;
         std::map<Index, std::vector<ScheduledLoopOp>> _loops;
         std::map<int64_t, mlir::arith::ConstantIndexOp> _constantIndices;
@@ -145,6 +145,13 @@ std::tuple<ScheduleOp, Index> Fuse(
     const std::vector<ScheduleOp>& schedules,
     const std::vector<std::vector<Index>>& indexCorrespondences);
 
+/// Infer index correspondences for fusing `schedules` from the array accesses their kernels perform:
+/// indices that address the same dimension of the same array are fused together. An index whose
+/// accesses don't appear in a given schedule maps to the null index (`Index::none`) there. Throws
+/// (with a diagnostic describing the conflicting accesses) when the accesses don't determine a
+/// unique pairing; in that case, build the correspondences by hand instead.
+std::vector<std::vector<Index>> InferIndexCorrespondences(const std::vector<ScheduleOp>& schedules);
+
 // Kernels
 std::string GetUniqueKernelId(std::string id, mlir::Region* region);
 
@@ -11,6 +11,7 @@
 #include "LoopIndexInfo.h"
 #include "TransformedDomain.h"
 
+#include <memory>
 #include <ostream>
 #include <unordered_map>
 #include <vector>
@@ -50,8 +51,12 @@ namespace loopnest
         LoopVisitSchedule(std::vector<IndexRange> ranges, int level = 0);
 
     private:
+        // The loop range list is immutable once built, so visit positions produced by
+        // Next()/Prev() share it instead of copying it
+        LoopVisitSchedule(std::shared_ptr<const std::vector<IndexRange>> ranges, int level);
+
         int _level; // == current position in loop range list
-        std::vector<IndexRange> _loopRanges;
+        std::shared_ptr<const std::vector<IndexRange>> _loopRanges;
     };
 
 } // namespace loopnest
@@ -59,6 +59,7 @@ namespace loopnest
         Index Pad(const Index& index, int64_t size, bool padFront, mlir::MLIRContext* context);
         SplitIndex Split(const Index& index, int64_t splitSize, mlir::MLIRContext* context);
         Index Skew(const Index& index, const Index& referenceIndex, mlir::MLIRContext* context);
+        Index Flatten(const Index& outer, const Index& inner, mlir::MLIRContext* context);
 
         bool HasConstantDimensionSize(const Index& dimensionIndex) const;
         int64_t GetDimensionSize(const Index& dimensionIndex) const;
@@ -95,7 +96,7 @@ namespace loopnest
 
         void Print(std::ostream& os) const;
 
-        AffineConstraints GetConstraints() const;
+        const AffineConstraints& GetConstraints() const;
 
         // Vector of (index, isDimension, expr, range, padding) tuples
         struct AttributeKey
@@ -137,12 +138,16 @@ namespace loopnest
             friend bool operator!=(const TransformedDomain::IndexInfo& a, const TransformedDomain::IndexInfo& b);
         };
 
-        void CollectLoopIndicesForIndex(const Index& index, std::unordered_set<Index>& loopIndices) const;
-        void CollectComputedIndicesForIndex(const Index& index, std::unordered_set<Index>& computedIndices) const;
+        // Returns the transitive closure of the indices that `index`'s expression depends on,
+        // memoizing the result so repeated derivation queries don't re-walk the index tree
+        const std::unordered_set<Index>& GetDependentClosure(const Index& index) const;
+        void InvalidateDerivations(const Index& index);
 
         std::vector<Index> _dimensions;
         std::unordered_set<Index> _loopIndices; // == leaf nodes
         std::unordered_map<Index, IndexInfo> _indices;
+        mutable std::unordered_map<Index, std::unordered_set<Index>> _derivedClosures; // memoized GetDependentClosure results
+        mutable std::optional<AffineConstraints> _cachedConstraints; // memoized GetConstraints result
     };
 
     bool operator==(const TransformedDomain& a, const TransformedDomain& b);
@@ -97,9 +97,31 @@ const mlir::StringRef CInterfaceAttrName = "llvm.emit_c_interface";
 // TODO : move these to ValueFuncOp and set them as part of ValueFuncOp creation
 const mlir::StringRef RawPointerAPIAttrName = "accv.emit_raw_pointer_api";
 const mlir::StringRef HeaderDeclAttrName = "accv.emit_header_decl";
+const mlir::StringRef AsyncAPIAttrName = "accv.emit_async_api";
+const mlir::StringRef BenchmarkAPIAttrName = "accv.emit_benchmark_api";
 const mlir::StringRef FunctionTagsAttrName = "accv.function_tags";
 const mlir::StringRef NoInlineAttrName = "accv.no_inline";
 const mlir::StringRef BaseNameAttrName = "accv.base_name";
+const mlir::StringRef KernelResourceUsageAttrName = "accv.kernel_resource_usage";
+
+// Marks an allocation whose buffer should be backed by huge pages; carried from the alloc op
+// through lowering so the LLVM conversion routes it to the huge-page runtime allocator
+const mlir::StringRef HugePageAllocationAttrName = "accv.huge_pages";
+
+// Per-schedule relaxed floating-point semantics set by Plan::SetFastMathPolicy: an IntegerAttr
+// bitmask carried on the nest function through lowering, where the LLVM conversion turns it into
+// fastmath flags on that function's floating-point ops
+const mlir::StringRef FastMathFlagsAttrName = "accv.fast_math_flags";
+constexpr int64_t FastMathContractFlag = 1 << 0; // allow fusing multiply/add pairs into fma
+constexpr int64_t FastMathReassocFlag = 1 << 1; // allow reassociating reduction chains
+constexpr int64_t FastMathNoNaNsFlag = 1 << 2; // assume no NaN inputs or results
+
+// Marks a function whose trailing argument is a caller-provided workspace buffer; the
+// caller-workspace pass rewrites the function's local allocations into views of that buffer
+// and records the aggregate requirement in the size/alignment attributes below
+const mlir::StringRef CallerWorkspaceAttrName = "accv.caller_workspace";
+const mlir::StringRef WorkspaceSizeAttrName = "accv.workspace_size";
+const mlir::StringRef WorkspaceAlignmentAttrName = "accv.workspace_alignment";
 
 } // namespace accera::ir
 
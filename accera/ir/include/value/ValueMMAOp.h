@@ -22,6 +22,7 @@ using mlir::LogicalResult;
 using mlir::Type;
 
 constexpr auto MFMAThreadBufferMapName = "threadOffsetsMFMA";
+constexpr auto MMAEpilogueOpAttrName = "mmaEpilogueOp";
 
 enum class MMAShape
 {
@@ -45,7 +46,14 @@ enum class MMAShape
     M16xN16xK16_B1,
 
     M32xN8xK16_B1,
-    M8xN32xK16_B1
+    M8xN32xK16_B1,
+
+    // Double-precision WMMA shape (NVIDIA GA100-class). The CDNA double-precision mfma
+    // instruction reuses M16xN16xK4_B1 with f64 operands
+    M8xN8xK4_B1,
+
+    // CPU AMX tile shape: one tdpbssd computes a 16x16 i32 tile from 16x64 i8 tiles
+    M16xN16xK64_B1
 };
 
 enum class MMAOperandType
@@ -61,6 +69,14 @@ enum class MMASchedulingPolicy
     PassOrder
 };
 
+// Elementwise op applied to the accumulator fragment while it is still in registers,
+// just before the fragment store writes it back to memory
+enum class MMAFragmentOpType
+{
+    None,
+    ReLU
+};
+
 class MMAOp
 {
 public:
@@ -0,0 +1,24 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompilationContext.h"
+#include "DialectRegistry.h"
+#include "InitializeAccera.h"
+
+namespace accera::ir
+{
+
+CompilationContext::CompilationContext()
+{
+    InitializeAccera();
+
+    // Eagerly load all of our registered dialects so modules can be built against the context
+    // immediately; lazy loading would re-serialize the first compilation on each dialect load
+    _context.appendDialectRegistry(GetDialectRegistry());
+    _context.loadAllAvailableDialects();
+}
+
+} // namespace accera::ir
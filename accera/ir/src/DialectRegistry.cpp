@@ -10,6 +10,7 @@
 #include "accera/AcceraOps.h"
 #include "value/ValueDialect.h"
 
+#include <mlir/Dialect/AMX/AMXDialect.h>
 #include <mlir/Dialect/Affine/IR/AffineOps.h>
 #include <mlir/Dialect/GPU/GPUDialect.h>
 #include <mlir/Dialect/LLVMIR/LLVMDialect.h>
@@ -53,8 +54,10 @@ mlir::DialectRegistry& GetDialectRegistry()
                         ROCDL::ROCDLDialect,
                         spirv::SPIRVDialect,
                         scf::SCFDialect,
-                        vector::VectorDialect>();
+                        vector::VectorDialect,
+                        amx::AMXDialect>();
         mlir::registerLLVMDialectTranslation(registry);
+        mlir::registerAMXDialectTranslation(registry);
         //mlir::registerNVVMDialectTranslation(registry);
         return true;
     }();
@@ -25,12 +25,15 @@
 #include <mlir/Dialect/StandardOps/IR/Ops.h>
 #include <mlir/IR/BlockAndValueMapping.h>
 #include <mlir/IR/BuiltinOps.h>
+#include <mlir/IR/SymbolTable.h>
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
 
 #include <llvm/ADT/StringRef.h>
 #include <llvm/ADT/TypeSwitch.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <optional>
 #include <set>
@@ -446,6 +449,18 @@ namespace util
             vir::BarrierScopeAttr::get(builder.getContext(), *barrierScope));
     }
 
+    mlir::Value CreateGPUWarpReduce(mlir::OpBuilder& builder, mlir::Value input, const std::string kind, std::optional<mlir::Location> loc /*= std::nullopt*/)
+    {
+        auto reduceKind = vir::symbolizeEnum<value::WarpReduceKind>(kind);
+        assert(reduceKind && "Invalid warp reduce kind");
+        auto op = builder.create<vir::WarpReduceOp>(
+            loc.value_or(builder.getUnknownLoc()),
+            input.getType(),
+            input,
+            vir::WarpReduceKindAttr::get(builder.getContext(), *reduceKind));
+        return op.result();
+    }
+
     std::optional<int64_t> GetDimSizeAt(const loopnest::Index& dimensionIndex, mlir::Operation* where)
     {
         assert(where != nullptr);
@@ -1269,5 +1284,82 @@ namespace util
         return false;
     }
 
+    namespace
+    {
+        // Attributes that name things rather than describe them; two functions differing only in
+        // these compile to interchangeable artifacts
+        bool IsNameLikeAttr(llvm::StringRef attrName)
+        {
+            return attrName == mlir::SymbolTable::getSymbolAttrName() ||
+                   attrName == vir::BaseNameAttrName;
+        }
+
+        void HashPrintedContent(utilities::ContentHasher& hasher, const std::function<void(llvm::raw_ostream&)>& print)
+        {
+            std::string printed;
+            llvm::raw_string_ostream stream(printed);
+            print(stream);
+            stream.flush();
+            hasher.Update(printed);
+            hasher.Update(printed.size()); // length-delimit so adjacent fields can't alias
+        }
+
+        void HashOperationContentImpl(utilities::ContentHasher& hasher, mlir::Operation* op, llvm::DenseMap<mlir::Value, uint64_t>& valueNumbers)
+        {
+            auto numberOf = [&](mlir::Value value) -> uint64_t {
+                return valueNumbers.try_emplace(value, valueNumbers.size()).first->second;
+            };
+
+            hasher.Update(op->getName().getStringRef().str());
+            for (auto operand : op->getOperands())
+            {
+                hasher.Update(numberOf(operand));
+                HashPrintedContent(hasher, [&](llvm::raw_ostream& stream) { operand.getType().print(stream); });
+            }
+            for (auto result : op->getResults())
+            {
+                hasher.Update(numberOf(result));
+                HashPrintedContent(hasher, [&](llvm::raw_ostream& stream) { result.getType().print(stream); });
+            }
+
+            // The attribute dictionary is already sorted by name, so iteration order is canonical
+            for (auto namedAttr : op->getAttrs())
+            {
+                if (IsNameLikeAttr(namedAttr.getName().strref()))
+                {
+                    continue;
+                }
+                hasher.Update(namedAttr.getName().strref().str());
+                HashPrintedContent(hasher, [&](llvm::raw_ostream& stream) { namedAttr.getValue().print(stream); });
+            }
+
+            hasher.Update(op->getNumRegions());
+            for (auto& region : op->getRegions())
+            {
+                hasher.Update(std::distance(region.begin(), region.end()));
+                for (auto& block : region)
+                {
+                    for (auto blockArg : block.getArguments())
+                    {
+                        hasher.Update(numberOf(blockArg));
+                        HashPrintedContent(hasher, [&](llvm::raw_ostream& stream) { blockArg.getType().print(stream); });
+                    }
+                    for (auto& nestedOp : block)
+                    {
+                        HashOperationContentImpl(hasher, &nestedOp, valueNumbers);
+                    }
+                }
+            }
+        }
+    } // namespace
+
+    utilities::ContentHash128 HashOperationContent(mlir::Operation* op)
+    {
+        utilities::ContentHasher hasher;
+        llvm::DenseMap<mlir::Value, uint64_t> valueNumbers;
+        HashOperationContentImpl(hasher, op, valueNumbers);
+        return hasher.Finish();
+    }
+
 } // namespace util
 } // namespace accera::ir
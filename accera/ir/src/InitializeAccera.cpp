@@ -26,6 +26,8 @@
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Target/TargetMachine.h>
 
+#include <mutex>
+
 using namespace mlir;
 
 namespace accera::ir
@@ -104,7 +106,11 @@ namespace
 
 void InitializeAccera()
 {
-    InitializeLLVM();
+    // LLVM target and pass registration is process-global state; run it exactly once no matter
+    // how many times (or from how many threads) a driver calls in, so per-compilation callers
+    // don't pay the registration cost repeatedly
+    static std::once_flag initFlag;
+    std::call_once(initFlag, [] { InitializeLLVM(); });
 }
 
 } // namespace accera::ir
@@ -33,6 +33,7 @@
 #include <llvm/ADT/TypeSwitch.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <optional>
 #include <sstream>
@@ -50,6 +51,36 @@ namespace ir
 {
     namespace
     {
+        // A std::streambuf that forwards writes straight through to an llvm::raw_ostream,
+        // so the TOML emitter (which only understands std::ostream) can stream to the same
+        // destination as the rest of the translation instead of materializing the whole
+        // file in memory first.
+        class RawOStreamBuf : public std::streambuf
+        {
+        public:
+            explicit RawOStreamBuf(llvm::raw_ostream& os) :
+                _os(os) {}
+
+        protected:
+            std::streamsize xsputn(const char* s, std::streamsize count) override
+            {
+                _os.write(s, static_cast<size_t>(count));
+                return count;
+            }
+
+            int_type overflow(int_type ch) override
+            {
+                if (ch != traits_type::eof())
+                {
+                    _os << static_cast<char>(ch);
+                }
+                return ch;
+            }
+
+        private:
+            llvm::raw_ostream& _os;
+        };
+
         value::ValueModuleOp GetValueModule(mlir::ModuleOp& module)
         {
             value::ValueModuleOp valueModuleOp;
@@ -132,6 +163,93 @@ namespace ir
             return os.str();
         }
 
+        std::string GetAsyncPrologue()
+        {
+            std::ostringstream os;
+
+            os << "#include <stdlib.h>\n\n";
+
+            // Entry points into the Accera runtime's shared worker pool, resolved at link time
+            os << "#ifndef __ACCERA_ASYNC_RUNTIME_DECLARED__\n";
+            os << "#define __ACCERA_ASYNC_RUNTIME_DECLARED__\n";
+            os << "void* AcceraAsyncInvoke(void (*fn)(void*), void* context);\n";
+            os << "void AcceraAsyncWait(void* handle);\n";
+            os << "#endif // __ACCERA_ASYNC_RUNTIME_DECLARED__\n\n";
+
+            return os.str();
+        }
+
+        std::string GetBenchmarkPrologue()
+        {
+            std::ostringstream os;
+
+            // Shared pieces of the self-benchmark entry points: the stats struct the wrappers
+            // fill, a steady millisecond clock, and a 64-byte-aligned allocator for inputs
+            os << "#include <stdint.h>\n";
+            os << "#include <stdlib.h>\n\n";
+
+            os << "#ifndef __ACCERA_BENCHMARK_DECLARED__\n";
+            os << "#define __ACCERA_BENCHMARK_DECLARED__\n";
+            os << "#ifdef _WIN32\n";
+            os << "#include <windows.h>\n";
+            os << "#include <malloc.h>\n";
+            os << "#else\n";
+            os << "#include <time.h>\n";
+            os << "#endif // _WIN32\n\n";
+
+            os << "typedef struct accera_benchmark_results_s\n";
+            os << "{\n";
+            os << "    int64_t iterations;\n";
+            os << "    double min_ms;\n";
+            os << "    double mean_ms;\n";
+            os << "    double median_ms;\n";
+            os << "    double p99_ms;\n";
+            os << "} accera_benchmark_results_t;\n\n";
+
+            os << "static inline double accera_benchmark_now_ms(void)\n";
+            os << "{\n";
+            os << "#ifdef _WIN32\n";
+            os << "    LARGE_INTEGER freq, count;\n";
+            os << "    QueryPerformanceFrequency(&freq);\n";
+            os << "    QueryPerformanceCounter(&count);\n";
+            os << "    return 1.0e3 * (double)count.QuadPart / (double)freq.QuadPart;\n";
+            os << "#else\n";
+            os << "    struct timespec ts;\n";
+            os << "    clock_gettime(CLOCK_MONOTONIC, &ts);\n";
+            os << "    return 1.0e3 * (double)ts.tv_sec + 1.0e-6 * (double)ts.tv_nsec;\n";
+            os << "#endif // _WIN32\n";
+            os << "}\n\n";
+
+            os << "static inline void* accera_benchmark_alloc(size_t bytes)\n";
+            os << "{\n";
+            os << "#ifdef _WIN32\n";
+            os << "    return _aligned_malloc(bytes, 64);\n";
+            os << "#else\n";
+            os << "    void* ptr = 0;\n";
+            os << "    return posix_memalign(&ptr, 64, bytes) == 0 ? ptr : (void*)0;\n";
+            os << "#endif // _WIN32\n";
+            os << "}\n\n";
+
+            os << "static inline void accera_benchmark_free(void* ptr)\n";
+            os << "{\n";
+            os << "#ifdef _WIN32\n";
+            os << "    _aligned_free(ptr);\n";
+            os << "#else\n";
+            os << "    free(ptr);\n";
+            os << "#endif // _WIN32\n";
+            os << "}\n\n";
+
+            os << "static int accera_benchmark_compare(const void* a, const void* b)\n";
+            os << "{\n";
+            os << "    double lhs = *(const double*)a;\n";
+            os << "    double rhs = *(const double*)b;\n";
+            os << "    return (lhs > rhs) - (lhs < rhs);\n";
+            os << "}\n";
+            os << "#endif // __ACCERA_BENCHMARK_DECLARED__\n\n";
+
+            return os.str();
+        }
+
         std::string GetDebugCode()
         {
             std::ostringstream os;
@@ -160,6 +278,34 @@ namespace ir
             });
         }
 
+        bool AsyncMode(std::vector<value::ValueModuleOp> valueModuleOps)
+        {
+            return std::any_of(valueModuleOps.begin(), valueModuleOps.end(), [](auto m) {
+                bool found = false;
+                m.walk([&found](value::ValueFuncOp fn) {
+                    if (fn->hasAttr(ir::AsyncAPIAttrName))
+                    {
+                        found = true;
+                    }
+                });
+                return found;
+            });
+        }
+
+        bool BenchmarkMode(std::vector<value::ValueModuleOp> valueModuleOps)
+        {
+            return std::any_of(valueModuleOps.begin(), valueModuleOps.end(), [](auto m) {
+                bool found = false;
+                m.walk([&found](value::ValueFuncOp fn) {
+                    if (fn->hasAttr(ir::BenchmarkAPIAttrName))
+                    {
+                        found = true;
+                    }
+                });
+                return found;
+            });
+        }
+
         struct LLVMType
         {
             mlir::Type type;
@@ -491,6 +637,217 @@ namespace ir
                 });
         }
 
+        template <typename StreamType>
+        void WriteAsyncFunctionWrapper(StreamType& os, LLVMType t, const std::string& name)
+        {
+            // Emits, for a void-returning function:
+            //   typedef struct { paramType arg0; ... } name_args_t;
+            //   static void name_thunk(void* context);              // unpacks args, calls name, frees
+            //   static inline void* name_async(paramType arg0, ...) // enqueues, returns completion handle
+            // The handle is released by passing it to AcceraAsyncWait
+
+            auto fnTy = t.type.dyn_cast<mlir::LLVM::LLVMFunctionType>();
+            assert(fnTy);
+
+            if (!fnTy.getReturnType().isa<mlir::LLVM::LLVMVoidType>())
+            {
+                // The async variant's return slot carries the completion handle, so only
+                // void-returning functions get one
+                return;
+            }
+
+            auto numParams = fnTy.getNumParams();
+            auto paramTypeString = [&](unsigned i) {
+                std::optional<mlir::Type> sourceType;
+                if (t.source) // use additional MLIR type information, if available
+                {
+                    auto sourceFnTy = t.source->dyn_cast<mlir::FunctionType>();
+                    sourceType = sourceFnTy.getInput(i);
+                }
+                return GetLLVMTypeString({ fnTy.getParamType(i), sourceType });
+            };
+
+            os << "#ifndef __" << name << "_async_DEFINED__\n";
+            os << "#define __" << name << "_async_DEFINED__\n";
+
+            if (numParams > 0)
+            {
+                os << "typedef struct " << name << "_args_s\n";
+                os << "{\n";
+                for (unsigned i = 0; i < numParams; ++i)
+                {
+                    os << "    " << paramTypeString(i) << " arg" << i << ";\n";
+                }
+                os << "} " << name << "_args_t;\n\n";
+
+                os << "static void " << name << "_thunk(void* context)\n";
+                os << "{\n";
+                os << "    " << name << "_args_t* args = (" << name << "_args_t*)context;\n";
+                os << "    " << name << "(";
+                for (unsigned i = 0; i < numParams; ++i)
+                {
+                    if (i != 0)
+                    {
+                        os << ", ";
+                    }
+                    os << "args->arg" << i;
+                }
+                os << ");\n";
+                os << "    free(args);\n";
+                os << "}\n\n";
+
+                os << "static inline void* " << name << "_async(";
+                for (unsigned i = 0; i < numParams; ++i)
+                {
+                    if (i != 0)
+                    {
+                        os << ", ";
+                    }
+                    os << paramTypeString(i) << " arg" << i;
+                }
+                os << ")\n";
+                os << "{\n";
+                os << "    " << name << "_args_t* args = (" << name << "_args_t*)malloc(sizeof(" << name << "_args_t));\n";
+                for (unsigned i = 0; i < numParams; ++i)
+                {
+                    os << "    args->arg" << i << " = arg" << i << ";\n";
+                }
+                os << "    return AcceraAsyncInvoke(" << name << "_thunk, args);\n";
+                os << "}\n";
+            }
+            else
+            {
+                os << "static void " << name << "_thunk(void* context)\n";
+                os << "{\n";
+                os << "    (void)context;\n";
+                os << "    " << name << "();\n";
+                os << "}\n\n";
+
+                os << "static inline void* " << name << "_async(void)\n";
+                os << "{\n";
+                os << "    return AcceraAsyncInvoke(" << name << "_thunk, (void*)0);\n";
+                os << "}\n";
+            }
+
+            os << "#endif // __" << name << "_async_DEFINED__\n";
+        }
+
+        template <typename StreamType>
+        void WriteBenchmarkFunctionWrapper(StreamType& os, LLVMType t, const std::string& name)
+        {
+            // Emits:
+            //   static inline int name_benchmark(int64_t iterations, accera_benchmark_results_t* results)
+            // which allocates representative inputs from the declared argument shapes, runs one
+            // warmup call plus `iterations` timed calls in-process, and fills the stats struct.
+            // Returns 0 on success, nonzero on bad arguments or allocation failure.
+
+            auto fnTy = t.type.dyn_cast<mlir::LLVM::LLVMFunctionType>();
+            assert(fnTy);
+
+            auto sourceFnTy = t.source ? t.source->dyn_cast<mlir::FunctionType>() : mlir::FunctionType();
+            if (!sourceFnTy)
+            {
+                return;
+            }
+
+            auto numParams = fnTy.getNumParams();
+
+            // Only signatures where every array argument has a static shape can be self-measured;
+            // runtime-sized arguments would need caller-provided extents
+            for (unsigned i = 0; i < numParams; ++i)
+            {
+                if (auto shapedTy = sourceFnTy.getInput(i).dyn_cast<mlir::ShapedType>(); shapedTy && !shapedTy.hasStaticShape())
+                {
+                    return;
+                }
+            }
+
+            auto callArgs = [&]() {
+                std::ostringstream callOs;
+                for (unsigned i = 0; i < numParams; ++i)
+                {
+                    if (i != 0)
+                    {
+                        callOs << ", ";
+                    }
+                    callOs << "arg" << i;
+                }
+                return callOs.str();
+            }();
+
+            os << "#ifndef __" << name << "_benchmark_DEFINED__\n";
+            os << "#define __" << name << "_benchmark_DEFINED__\n";
+            os << "static inline int " << name << "_benchmark(int64_t iterations, accera_benchmark_results_t* results)\n";
+            os << "{\n";
+            os << "    int64_t i;\n";
+            os << "    double total_ms = 0.0;\n";
+            os << "    double* times_ms;\n";
+            os << "    if (iterations <= 0 || !results)\n";
+            os << "    {\n";
+            os << "        return -1;\n";
+            os << "    }\n";
+            os << "    times_ms = (double*)malloc((size_t)iterations * sizeof(double));\n";
+            os << "    if (!times_ms)\n";
+            os << "    {\n";
+            os << "        return -1;\n";
+            os << "    }\n";
+
+            for (unsigned i = 0; i < numParams; ++i)
+            {
+                auto sourceType = sourceFnTy.getInput(i);
+                if (auto shapedTy = sourceType.dyn_cast<mlir::ShapedType>())
+                {
+                    auto elementTypeStr = GetLLVMElementTypeString({ fnTy.getParamType(i), sourceType });
+                    auto numElements = shapedTy.getNumElements();
+                    os << "    " << elementTypeStr << "* arg" << i << " = (" << elementTypeStr << "*)accera_benchmark_alloc("
+                       << numElements << " * sizeof(" << elementTypeStr << "));\n";
+                    // Small nonuniform values: deterministic, and no denormals or overflow
+                    // distorting the timing
+                    os << "    for (i = 0; i < " << numElements << "; ++i)\n";
+                    os << "    {\n";
+                    os << "        arg" << i << "[i] = (" << elementTypeStr << ")((i % 7)";
+                    if (shapedTy.getElementType().isa<mlir::FloatType>())
+                    {
+                        os << " * 0.125";
+                    }
+                    os << ");\n";
+                    os << "    }\n";
+                }
+                else
+                {
+                    auto paramTypeStr = GetLLVMTypeString({ fnTy.getParamType(i), sourceType });
+                    os << "    " << paramTypeStr << " arg" << i << " = 0;\n";
+                }
+            }
+
+            os << "    " << name << "(" << callArgs << "); /* warmup */\n";
+            os << "    for (i = 0; i < iterations; ++i)\n";
+            os << "    {\n";
+            os << "        double start_ms = accera_benchmark_now_ms();\n";
+            os << "        " << name << "(" << callArgs << ");\n";
+            os << "        times_ms[i] = accera_benchmark_now_ms() - start_ms;\n";
+            os << "        total_ms += times_ms[i];\n";
+            os << "    }\n";
+            os << "    qsort(times_ms, (size_t)iterations, sizeof(double), accera_benchmark_compare);\n";
+            os << "    results->iterations = iterations;\n";
+            os << "    results->min_ms = times_ms[0];\n";
+            os << "    results->mean_ms = total_ms / (double)iterations;\n";
+            os << "    results->median_ms = times_ms[iterations / 2];\n";
+            os << "    results->p99_ms = times_ms[(iterations * 99) / 100 < iterations ? (iterations * 99) / 100 : iterations - 1];\n";
+
+            for (unsigned i = 0; i < numParams; ++i)
+            {
+                if (sourceFnTy.getInput(i).isa<mlir::ShapedType>())
+                {
+                    os << "    accera_benchmark_free(arg" << i << ");\n";
+                }
+            }
+            os << "    free(times_ms);\n";
+            os << "    return 0;\n";
+            os << "}\n";
+            os << "#endif // __" << name << "_benchmark_DEFINED__\n";
+        }
+
         template <typename StreamType>
         mlir::LogicalResult WriteFunctionDeclaration(StreamType& os, value::ValueFuncOp fn, bool useBarePtrCallConv)
         {
@@ -529,6 +886,20 @@ namespace ir
                 os << "\n\n";
             }
 
+            // if the function is marked for an async API, emit the enqueueing wrapper alongside it
+            if (fn->hasAttr(ir::AsyncAPIAttrName))
+            {
+                WriteAsyncFunctionWrapper(os, { llvmType, fnType }, name);
+                os << "\n\n";
+            }
+
+            // if the function is marked for a self-benchmark API, emit the timing wrapper alongside it
+            if (fn->hasAttr(ir::BenchmarkAPIAttrName))
+            {
+                WriteBenchmarkFunctionWrapper(os, { llvmType, fnType }, name);
+                os << "\n\n";
+            }
+
             return mlir::success();
         }
 
@@ -567,6 +938,16 @@ namespace ir
                 os << GetDebugPrologue();
             }
 
+            if (AsyncMode(valueModuleOps))
+            {
+                os << GetAsyncPrologue();
+            }
+
+            if (BenchmarkMode(valueModuleOps))
+            {
+                os << GetBenchmarkPrologue();
+            }
+
             for (auto& module : valueModuleOps)
             {
                 WriteModuleHeader(os, module, useBarePtrCallConv);
@@ -732,6 +1113,44 @@ namespace ir
                 });
             }
 
+            // Record per-kernel resource usage gathered by the GPU passes so deployment tooling
+            // can reject spilling kernels and autotuners can prune candidates without execution
+            toml::table kernelResourceTable;
+            for (auto& module : modules)
+            {
+                module.walk([&kernelResourceTable](mlir::Operation* op) {
+                    auto usageAttr = op->getAttrOfType<mlir::DictionaryAttr>(ir::KernelResourceUsageAttrName);
+                    if (!usageAttr)
+                    {
+                        return;
+                    }
+                    auto nameAttr = op->getAttrOfType<mlir::StringAttr>(mlir::SymbolTable::getSymbolAttrName());
+                    if (!nameAttr)
+                    {
+                        return;
+                    }
+                    toml::table usageTable;
+                    for (auto& namedAttr : usageAttr)
+                    {
+                        if (auto intAttr = namedAttr.getValue().dyn_cast<mlir::IntegerAttr>())
+                        {
+                            usageTable.insert_or_assign(namedAttr.getName().str(), intAttr.getInt());
+                        }
+                        else if (auto strAttr = namedAttr.getValue().dyn_cast<mlir::StringAttr>())
+                        {
+                            usageTable.insert_or_assign(namedAttr.getName().str(), strAttr.getValue().str());
+                        }
+                    }
+                    kernelResourceTable.insert_or_assign(nameAttr.getValue().str(), usageTable);
+                });
+            }
+            if (!kernelResourceTable.empty())
+            {
+                toml::table auxiliaryTable;
+                auxiliaryTable.insert_or_assign("kernel_resource_usage", kernelResourceTable);
+                package.Auxiliary(auxiliaryTable);
+            }
+
             // TODO : plumb through target information or provide via accc
             package.Target.Required.OperatingSystem(hat::OperatingSystemType::Windows);
             package.Target.Required.CPU.Architecture("");
@@ -772,7 +1191,193 @@ namespace ir
                 package.DebugCode(GetDebugCode());
             }
 
-            os << package.Serialize();
+            if (AsyncMode(valueModuleOps))
+            {
+                package.CodePrologue(package.CodePrologue() + GetAsyncPrologue()); // append to the prologue
+            }
+
+            // Stream the package section-by-section rather than serializing it into one
+            // string; large packages embed every function declaration in the code section
+            // and the single-string path held several copies of the file in memory.
+            RawOStreamBuf streamBuf(os);
+            std::ostream packageOs(&streamBuf);
+            package.Serialize(packageOs);
+
+            return mlir::success();
+        }
+
+        // Binary HAT metadata sidecar ("HATB"): a compact, versioned, offset-table encoding of the
+        // function signatures in the text header, designed to be read with a single mmap and offset
+        // fixup instead of re-parsing the TOML header at every process start.
+        //
+        // Layout:
+        //   FileHeader | FunctionRecord[functionCount] | ArgumentRecord[...] | int64 pool | string table
+        //
+        // Strings are nul-terminated and referenced by byte offset into the string table; shapes and
+        // strides are rank-sized runs referenced by element offset into the int64 pool. All offsets
+        // are relative to the start of the file so a reader can resolve them against the mmap base.
+        namespace binmeta
+        {
+            constexpr char kMagic[4] = { 'H', 'A', 'T', 'B' };
+            constexpr uint32_t kVersion = 1;
+            constexpr uint64_t kNoOffset = ~0ull;
+
+            struct FileHeader
+            {
+                char magic[4];
+                uint32_t version;
+                uint32_t headerSize;
+                uint32_t functionCount;
+                uint64_t functionTableOffset;
+                uint64_t argumentTableOffset;
+                uint64_t int64PoolOffset;
+                uint64_t stringTableOffset;
+                uint64_t totalSize;
+            };
+
+            struct FunctionRecord
+            {
+                uint64_t nameOffset;
+                uint64_t baseNameOffset; // kNoOffset when the function has no base name alias
+                uint32_t firstArgument; // index into the argument table
+                uint32_t argumentCount;
+                uint32_t returnTypeCode; // 0 for void
+                uint32_t flags; // bit 0: raw-pointer API, bit 1: async API
+            };
+
+            struct ArgumentRecord
+            {
+                uint32_t typeCode; // element type for shaped arguments
+                uint32_t rank; // 0 for scalars
+                uint64_t shapeOffset; // element offset of rank sizes followed by rank strides; kNoOffset for scalars
+            };
+
+            static_assert(sizeof(FileHeader) == 56, "unexpected padding in binary metadata file header");
+            static_assert(sizeof(FunctionRecord) == 32, "unexpected padding in binary metadata function record");
+            static_assert(sizeof(ArgumentRecord) == 16, "unexpected padding in binary metadata argument record");
+
+            uint32_t GetTypeCode(mlir::Type type)
+            {
+                if (auto shapedType = type.dyn_cast<mlir::ShapedType>())
+                {
+                    type = shapedType.getElementType();
+                }
+                if (type.isF16()) return 1;
+                if (type.isBF16()) return 2;
+                if (type.isF32()) return 3;
+                if (type.isF64()) return 4;
+                if (type.isInteger(1)) return 5;
+                if (type.isInteger(8)) return 6;
+                if (type.isInteger(16)) return 7;
+                if (type.isInteger(32)) return 8;
+                if (type.isInteger(64)) return 9;
+                if (type.isIndex()) return 10;
+                return 0;
+            }
+        } // namespace binmeta
+
+        mlir::LogicalResult WriteMultiModuleBinaryMetadata(llvm::raw_ostream& os, std::vector<mlir::ModuleOp>& modules)
+        {
+            std::vector<binmeta::FunctionRecord> functionRecords;
+            std::vector<binmeta::ArgumentRecord> argumentRecords;
+            std::vector<int64_t> int64Pool;
+            std::string stringTable;
+
+            auto internString = [&stringTable](const std::string& s) -> uint64_t {
+                auto offset = static_cast<uint64_t>(stringTable.size());
+                stringTable.append(s);
+                stringTable.push_back('\0');
+                return offset;
+            };
+
+            auto valueModuleOps = GetValueModules(modules);
+            for (auto& module : valueModuleOps)
+            {
+                module.walk([&](value::ValueFuncOp fn) {
+                    // Match the function filter used for the text HAT file
+                    if (!fn->hasAttr(ir::HeaderDeclAttrName))
+                    {
+                        return;
+                    }
+                    auto fnType = fn.getType().dyn_cast<mlir::FunctionType>();
+                    assert(fnType.getNumResults() <= 1);
+
+                    binmeta::FunctionRecord record;
+                    record.nameOffset = internString(fn.getName().str());
+                    record.baseNameOffset = binmeta::kNoOffset;
+                    if (auto baseName = fn->getAttrOfType<mlir::StringAttr>(ir::BaseNameAttrName))
+                    {
+                        record.baseNameOffset = internString(baseName.getValue().str());
+                    }
+                    record.firstArgument = static_cast<uint32_t>(argumentRecords.size());
+                    record.argumentCount = fnType.getNumInputs();
+                    record.returnTypeCode = fnType.getNumResults() == 0 ? 0 : binmeta::GetTypeCode(fnType.getResult(0));
+                    record.flags = 0;
+                    if (fn->hasAttr(ir::RawPointerAPIAttrName))
+                    {
+                        record.flags |= 1;
+                    }
+                    if (fn->hasAttr(ir::AsyncAPIAttrName))
+                    {
+                        record.flags |= 2;
+                    }
+
+                    for (auto argType : fnType.getInputs())
+                    {
+                        binmeta::ArgumentRecord argRecord;
+                        argRecord.typeCode = binmeta::GetTypeCode(argType);
+                        argRecord.rank = 0;
+                        argRecord.shapeOffset = binmeta::kNoOffset;
+                        if (auto shapedType = argType.dyn_cast<mlir::ShapedType>(); shapedType && shapedType.hasStaticShape())
+                        {
+                            auto shape = shapedType.getShape();
+                            argRecord.rank = static_cast<uint32_t>(shape.size());
+                            argRecord.shapeOffset = static_cast<uint64_t>(int64Pool.size());
+                            int64Pool.insert(int64Pool.end(), shape.begin(), shape.end());
+
+                            llvm::SmallVector<int64_t, 4> strides;
+                            int64_t offset = 0;
+                            if (auto memRefType = argType.dyn_cast<mlir::MemRefType>();
+                                memRefType && mlir::succeeded(mlir::getStridesAndOffset(memRefType, strides, offset)))
+                            {
+                                int64Pool.insert(int64Pool.end(), strides.begin(), strides.end());
+                            }
+                            else
+                            {
+                                // Assume dense canonical ordering, matching the text header
+                                std::vector<int64_t> canonicalStrides(shape.size());
+                                int64_t currentShardSize = 1;
+                                for (size_t i = 0; i < shape.size(); ++i)
+                                {
+                                    size_t idx = shape.size() - i - 1;
+                                    canonicalStrides[idx] = currentShardSize;
+                                    currentShardSize *= shape[idx];
+                                }
+                                int64Pool.insert(int64Pool.end(), canonicalStrides.begin(), canonicalStrides.end());
+                            }
+                        }
+                        argumentRecords.push_back(argRecord);
+                    }
+                    functionRecords.push_back(record);
+                });
+            }
+
+            binmeta::FileHeader header;
+            std::memcpy(header.magic, binmeta::kMagic, sizeof(header.magic));
+            header.version = binmeta::kVersion;
+            header.headerSize = sizeof(binmeta::FileHeader);
+            header.functionCount = static_cast<uint32_t>(functionRecords.size());
+            header.functionTableOffset = sizeof(binmeta::FileHeader);
+            header.argumentTableOffset = header.functionTableOffset + functionRecords.size() * sizeof(binmeta::FunctionRecord);
+            header.int64PoolOffset = header.argumentTableOffset + argumentRecords.size() * sizeof(binmeta::ArgumentRecord);
+            header.stringTableOffset = header.int64PoolOffset + int64Pool.size() * sizeof(int64_t);
+            header.totalSize = header.stringTableOffset + stringTable.size();
+
+            os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            os.write(reinterpret_cast<const char*>(functionRecords.data()), functionRecords.size() * sizeof(binmeta::FunctionRecord));
+            os.write(reinterpret_cast<const char*>(argumentRecords.data()), argumentRecords.size() * sizeof(binmeta::ArgumentRecord));
+            os.write(reinterpret_cast<const char*>(int64Pool.data()), int64Pool.size() * sizeof(int64_t));
+            os.write(stringTable.data(), stringTable.size());
 
             return mlir::success();
         }
@@ -797,6 +1402,17 @@ namespace ir
         return TranslateToHeader(module, out);
     }
 
+    mlir::LogicalResult TranslateToBinaryMetadata(std::vector<mlir::ModuleOp>& modules, llvm::raw_ostream& os)
+    {
+        return WriteMultiModuleBinaryMetadata(os, modules);
+    }
+
+    mlir::LogicalResult TranslateToBinaryMetadata(mlir::ModuleOp module, llvm::raw_ostream& os)
+    {
+        std::vector<mlir::ModuleOp> moduleVec{ module };
+        return TranslateToBinaryMetadata(moduleVec, os);
+    }
+
 } // namespace ir
 } // namespace accera
 
@@ -29,13 +29,13 @@ namespace executionPlan
 
     mlir::DialectAsmPrinter& operator<<(mlir::DialectAsmPrinter& printer, ParallelizationInfo parallelizationInfo)
     {
-        printer << "{" << (parallelizationInfo.isDynamicPolicy ? 1 : 0) << "," << parallelizationInfo.numThreads << '}';
+        printer << "{" << parallelizationInfo.policy << "," << parallelizationInfo.numThreads << "," << parallelizationInfo.nestingLevel << "," << parallelizationInfo.reduction << "," << parallelizationInfo.affinity << "," << parallelizationInfo.chunkSize << '}';
         return printer;
     }
 
     mlir::DialectAsmPrinter& operator<<(mlir::DialectAsmPrinter& printer, TensorizationInfo tensorizationInfo)
     {
-        printer << "{{" << (int)tensorizationInfo.dim << "}," << tensorizationInfo.numTotalPasses << "," << (tensorizationInfo.useStaticOffsets ? 1 : 0) << "," << tensorizationInfo.numFusedPasses << "," << (int)tensorizationInfo.schedulingPolicy << "," << (tensorizationInfo._useRocWMMA ? 1 : 0) << "}";
+        printer << "{{" << (int)tensorizationInfo.dim << "}," << tensorizationInfo.numTotalPasses << "," << (tensorizationInfo.useStaticOffsets ? 1 : 0) << "," << tensorizationInfo.numFusedPasses << "," << (int)tensorizationInfo.schedulingPolicy << "," << (tensorizationInfo._useRocWMMA ? 1 : 0) << "," << (tensorizationInfo.pipelinePasses ? 1 : 0) << "," << (int)tensorizationInfo.epilogueOp << "}";
         return printer;
     }
 
@@ -117,13 +117,13 @@ namespace executionPlan
     ParallelizationInfoAttr parseParallelizationInfo(mlir::DialectAsmParser& parser)
     {
         // Parse a parallelization info attribute in the following form:
-        //   parallelization-info-attr ::= `{` isDynamicPolicy `,` numThreads `}`
+        //   parallelization-info-attr ::= `{` policy `,` numThreads `,` nestingLevel `,` reduction `,` affinity (`,` chunkSize)? `}`
 
         if (failed(parser.parseLBrace()))
             return {};
 
-        int isDynamicPolicy = 0;
-        if (failed(parser.parseInteger(isDynamicPolicy)))
+        int policy = 0;
+        if (failed(parser.parseInteger(policy)))
             return {};
 
         if (failed(parser.parseComma()))
@@ -133,10 +133,38 @@ namespace executionPlan
         if (failed(parser.parseInteger(numThreads)))
             return {};
 
+        if (failed(parser.parseComma()))
+            return {};
+
+        int nestingLevel = 0;
+        if (failed(parser.parseInteger(nestingLevel)))
+            return {};
+
+        if (failed(parser.parseComma()))
+            return {};
+
+        int reduction = 0;
+        if (failed(parser.parseInteger(reduction)))
+            return {};
+
+        if (failed(parser.parseComma()))
+            return {};
+
+        int affinity = 0;
+        if (failed(parser.parseInteger(affinity)))
+            return {};
+
+        int chunkSize = 0;
+        if (succeeded(parser.parseOptionalComma()))
+        {
+            if (failed(parser.parseInteger(chunkSize)))
+                return {};
+        }
+
         if (failed(parser.parseRBrace()))
             return {};
 
-        return ParallelizationInfoAttr::get(ParallelizationInfo{ static_cast<int64_t>(numThreads), static_cast<bool>(isDynamicPolicy) }, parser.getBuilder().getContext());
+        return ParallelizationInfoAttr::get(ParallelizationInfo{ static_cast<int64_t>(numThreads), static_cast<int64_t>(policy), static_cast<int64_t>(nestingLevel), static_cast<int64_t>(reduction), static_cast<int64_t>(affinity), static_cast<int64_t>(chunkSize) }, parser.getBuilder().getContext());
     }
 
     void print(ParallelizationInfoAttr attr, mlir::DialectAsmPrinter& printer)
@@ -167,6 +195,8 @@ namespace executionPlan
         int numTotalPasses;
         int schedulingPolicy;
         bool _useRocWMMA;
+        bool pipelinePasses;
+        int epilogueOp;
         if (failed(parser.parseLBrace()))
             return {};
         if (failed(parser.parseLBrace()))
@@ -195,11 +225,19 @@ namespace executionPlan
             return {};
         if (failed(parser.parseInteger(_useRocWMMA)))
             return {};
+        if (failed(parser.parseComma()))
+            return {};
+        if (failed(parser.parseInteger(pipelinePasses)))
+            return {};
+        if (failed(parser.parseComma()))
+            return {};
+        if (failed(parser.parseInteger(epilogueOp)))
+            return {};
         if (failed(parser.parseRBrace()))
             return {};
         if (useStaticOffsets != 0 && useStaticOffsets != 1)
             return {};
-        return TensorizationInfoAttr::get(TensorizationInfo{ accera::ir::value::MMAShape{ dim }, numTotalPasses, useStaticOffsets, numFusedPasses, accera::ir::value::MMASchedulingPolicy{ schedulingPolicy }, _useRocWMMA }, parser.getBuilder().getContext());
+        return TensorizationInfoAttr::get(TensorizationInfo{ accera::ir::value::MMAShape{ dim }, numTotalPasses, useStaticOffsets, numFusedPasses, accera::ir::value::MMASchedulingPolicy{ schedulingPolicy }, _useRocWMMA, pipelinePasses, accera::ir::value::MMAFragmentOpType{ epilogueOp } }, parser.getBuilder().getContext());
     }
 
     void print(TensorizationInfoAttr attr, mlir::DialectAsmPrinter& printer)
@@ -257,12 +295,12 @@ namespace executionPlan
 
     llvm::hash_code hash_value(const ParallelizationInfo& parallelizationInfo)
     {
-        return llvm::hash_combine(parallelizationInfo.numThreads, parallelizationInfo.isDynamicPolicy);
+        return llvm::hash_combine(parallelizationInfo.numThreads, parallelizationInfo.policy, parallelizationInfo.nestingLevel, parallelizationInfo.reduction, parallelizationInfo.affinity, parallelizationInfo.chunkSize);
     }
 
     llvm::hash_code hash_value(const TensorizationInfo& tensorizationInfo)
     {
-        return llvm::hash_combine(tensorizationInfo.dim, tensorizationInfo.numTotalPasses, tensorizationInfo.useStaticOffsets, tensorizationInfo.numFusedPasses, tensorizationInfo.schedulingPolicy, tensorizationInfo._useRocWMMA);
+        return llvm::hash_combine(tensorizationInfo.dim, tensorizationInfo.numTotalPasses, tensorizationInfo.useStaticOffsets, tensorizationInfo.numFusedPasses, tensorizationInfo.schedulingPolicy, tensorizationInfo._useRocWMMA, tensorizationInfo.pipelinePasses, tensorizationInfo.epilogueOp);
     }
 
     llvm::hash_code hash_value(const InPlaceUnrollInfo& inPlaceUnrollInfo)
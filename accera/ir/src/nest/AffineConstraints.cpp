@@ -13,7 +13,10 @@ namespace accera::ir
 {
 namespace loopnest
 {
-    AffineConstraints::AffineConstraints(std::vector<Index> indices) : _indices(indices)
+    AffineConstraints::AffineConstraints(std::vector<Index> indices) :
+        _indices(indices),
+        _linkedPositions(indices.size()),
+        _solvedBounds(indices.size())
     {
         // Initial guesstimate for # rows, more inequalities/equalities can be added later
         auto numInequalities = indices.size() * 2; // lower bound, upper bound
@@ -42,6 +45,8 @@ namespace loopnest
             assert(range.End() == range.Begin() && "Bad range (end < begin)");
             _constraints.addBound(mlir::FlatAffineConstraints::UB, pos, range.Begin()); // single-value closed bound
         }
+
+        InvalidateBounds({ pos });
     }
 
     void AffineConstraints::AddConstraint(Index index, AffineExpression expr, std::function<std::vector<int64_t>(AffineExpression)> getCoeffsFn)
@@ -84,19 +89,53 @@ namespace loopnest
 
             equality[pos] = 1; // the coefficient of the current index is always 1 in its equality expression
             _constraints.addEquality(equality);
+
+            // the equality couples this index to its arguments, so bound changes propagate between them
+            for (auto argPos : argPositions)
+            {
+                _linkedPositions[pos].push_back(argPos);
+                _linkedPositions[argPos].push_back(pos);
+            }
+
+            std::vector<uint64_t> positions(argPositions.begin(), argPositions.end());
+            positions.push_back(pos);
+            InvalidateBounds(std::move(positions));
         }
     }
 
     std::pair<int64_t, int64_t> AffineConstraints::GetEffectiveRangeBounds(Index index) const
     {
         auto pos = GetIndexPosition(index);
+        if (auto& solved = _solvedBounds[pos])
+        {
+            return *solved;
+        }
+
         auto lowerBound = _constraints.getConstantBound(mlir::FlatAffineConstraints::LB, pos);
         auto upperBound = _constraints.getConstantBound(mlir::FlatAffineConstraints::UB, pos);
 
         assert(lowerBound && upperBound && "Index has no upper or lower bound"); // coding error
 
         // Note: not a full-fledged Range because increment is not represented by constraints
-        return { *lowerBound, *upperBound + 1 }; // closed bound -> half-open bound
+        _solvedBounds[pos] = { *lowerBound, *upperBound + 1 }; // closed bound -> half-open bound
+        return *_solvedBounds[pos];
+    }
+
+    void AffineConstraints::InvalidateBounds(std::vector<uint64_t> positions)
+    {
+        // Drop the solved bounds of the given positions and everything reachable from them
+        // through equality links; bounds of unrelated indices are unaffected by the new constraint
+        std::vector<bool> visited(_indices.size(), false);
+        while (!positions.empty())
+        {
+            auto pos = positions.back();
+            positions.pop_back();
+            if (visited[pos]) continue;
+
+            visited[pos] = true;
+            _solvedBounds[pos].reset();
+            positions.insert(positions.end(), _linkedPositions[pos].begin(), _linkedPositions[pos].end());
+        }
     }
 
     uint64_t AffineConstraints::GetIndexPosition(Index index) const
@@ -25,7 +25,7 @@ namespace loopnest
 
     const std::string& Index::GetName() const
     {
-        return _name;
+        return _name.str();
     }
 
     Index::Id Index::GetId() const
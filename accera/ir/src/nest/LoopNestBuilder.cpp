@@ -224,7 +224,7 @@ namespace loopnest
         }
 
         // Compute the full domain shape
-        auto splitDomain = builder.GetDomain();
+        const auto& splitDomain = builder.GetDomain();
         auto dimensionIndices = splitDomain.GetDimensions();
         subdomainSize.reserve(dimensionIndices.size());
         for (const auto& dimensionIndex : dimensionIndices)
@@ -279,6 +279,7 @@ namespace loopnest
     //
     LoopNestBuilder::LoopNestBuilder(ScheduleOp op, mlir::PatternRewriter& builder, bool printLoops) :
         _schedule(op),
+        _domain(op.getDomain().getValue()),
         _builder(builder),
         _constantOpBuilder(mlir::OpBuilder::atBlockBegin(builder.getBlock())),
         _printLoops(printLoops)
@@ -314,17 +315,22 @@ namespace loopnest
 
     LoopVisitSchedule LoopNestBuilder::GetLoopSchedule() const
     {
-        std::vector<IndexRange> indexRanges;
-        auto domain = GetDomain();
-
-        auto loopSequence = const_cast<ScheduleOp&>(_schedule).getOrder();
-        for (auto loopIndex : loopSequence)
+        if (!_loopSchedule)
         {
-            auto range = domain.GetIndexRange(loopIndex);
-            indexRanges.push_back(IndexRange{ loopIndex, range });
+            std::vector<IndexRange> indexRanges;
+            const auto& domain = GetDomain();
+
+            auto loopSequence = const_cast<ScheduleOp&>(_schedule).getOrder();
+            for (auto loopIndex : loopSequence)
+            {
+                auto range = domain.GetIndexRange(loopIndex);
+                indexRanges.push_back(IndexRange{ loopIndex, range });
+            }
+
+            _loopSchedule = LoopVisitSchedule{ indexRanges };
         }
 
-        return { indexRanges };
+        return *_loopSchedule; // copies are cheap: they share the underlying loop range list
     }
 
     LoopNestBuilder::RecursionState LoopNestBuilder::GenerateInitialLoopStructure(const RecursionState& state, const LoopVisitSchedule& schedule)
@@ -487,7 +493,7 @@ namespace loopnest
         {
             auto loopIndex = loop.getIndex();
             assert(loopIndex == schedule.CurrentLoopIndex());
-            auto domain = GetDomain();
+            const auto& domain = GetDomain();
             auto fullRange = schedule.GetActiveLoopRange(domain, loopIndex, state.loopIndices);
             //  auto fullRange = loop.getRange();
             std::vector<Partition> partitions;
@@ -718,7 +724,7 @@ namespace loopnest
         auto loc = GetLocation();
         auto symbolicIndex = GetSymbolicIndex(loopIndex);
         assert(symbolicIndex && "Error: bad symbolic index");
-        auto domain = GetDomain();
+        const auto& domain = GetDomain();
         auto domainIndexOrder = domain.GetDimensions();
 
         auto loop = range.HasVariableEnd() ? builder.create<ScheduledLoopOp>(loc, begin, range.VariableEnd(), step, symbolicIndex, state.subdomainSize, domainIndexOrder) : builder.create<ScheduledLoopOp>(loc, begin, range.End(), step, symbolicIndex, state.subdomainSize, domainIndexOrder);
@@ -734,6 +740,13 @@ namespace loopnest
                 {
                     loop->setAttr("accv_unrolled", builder.getUnitAttr());
                 }
+                else if ((int64_t)*val > 1 && range.NumIterations() % (int64_t)*val == 0)
+                {
+                    // Main partition of a partial unroll: GetPartitions split the residue into its
+                    // own (fully-unrolled) partition, so unrolling this loop by the requested size
+                    // produces no remainder loop
+                    loop->setAttr("accv_unroll_by_factor", builder.getI64IntegerAttr((int64_t)*val));
+                }
             }
 
             if (auto val = GetUnrollAndJamFactor(loopIndex))
@@ -1009,7 +1022,16 @@ namespace loopnest
                 {
                     auto result = kernelPredicate.evaluate(GetDomain(), runtimeIndexVariables, schedule);
                     if (result.has_value())
+                    {
                         predicateResult = *result;
+                    }
+                    else
+                    {
+                        // The partitioning done in GetPartitions is meant to leave every kernel predicate
+                        // statically resolvable within each partition; report any kernel whose predicate
+                        // still can't be resolved so the schedule author knows it won't be invoked here
+                        kernel.emitWarning("Predicate for kernel '" + std::string(kernel.getId()) + "' could not be resolved statically for loop index '" + loopIndex.GetName() + "'; kernel will not be invoked in this partition");
+                    }
                 }
                 else if (evaluatablePredicate)
                 {
@@ -1061,6 +1083,20 @@ namespace loopnest
         int begin = loopRange.Begin();
         int end = loopRange.End();
         int increment = loopRange.Increment();
+
+        // Split off the residue of a partial unroll so the main partition's trip count becomes an
+        // exact multiple of the unroll size and the residue becomes a small constant-trip loop
+        // that unrolls fully, instead of leaving a generic remainder loop behind
+        if (auto unrollSize = GetUnrollIfRangeSmallerThan(loopIndex))
+        {
+            auto size = static_cast<int64_t>(*unrollSize);
+            auto numIterations = loopRange.NumIterations();
+            if (size > 1 && numIterations >= size && numIterations % size != 0)
+            {
+                splits.insert(begin + (numIterations - numIterations % size) * increment);
+            }
+        }
+
         std::vector<Partition> result;
         for (auto partitionEnd : splits)
         {
@@ -1087,6 +1123,23 @@ namespace loopnest
 
         auto addTransformationSplits = [&domain, &loopIndex, &loopRange, &schedule](std::set<int64_t>& splits) -> void {
             // Apply splits resulting from schedule transformations on indices
+            if (domain.IsPaddedIndex(loopIndex) && domain.IsFusedPaddedIndex(loopIndex))
+            {
+                // Fused padded indices keep their full (padded) range so that in-range predicates can be
+                // applied (cf. LoopVisitSchedule::GetActiveLoopRange). Split at the padding boundaries so
+                // the predicate resolves to a definite value within each partition instead of remaining a
+                // per-iteration conditional in the emitted loop body.
+                const auto& constraints = domain.GetConstraints();
+                auto [unpaddedBegin, unpaddedEnd] = constraints.GetEffectiveRangeBounds(loopIndex);
+                if (unpaddedBegin > loopRange.Begin() && unpaddedBegin < loopRange.End())
+                {
+                    splits.insert(unpaddedBegin);
+                }
+                if (unpaddedEnd > loopRange.Begin() && unpaddedEnd < loopRange.End())
+                {
+                    splits.insert(unpaddedEnd);
+                }
+            }
             if (auto skewedOrReference = domain.IsSkewedOrReferenceIndex(loopIndex))
             {
                 auto [isSkewedIndex, dependentIndex] = *skewedOrReference;
@@ -1175,7 +1228,7 @@ namespace loopnest
                 // Reconcile the domain constraints with the active loop range by taking their overlap:
                 // - The domain constraints represent the active iteration space (with padding excluded)
                 // - The active loop range represents the loop variable's current state, such as whether we are within a boundary block
-                const auto constraints = domain.GetConstraints();
+                const auto& constraints = domain.GetConstraints();
                 auto [begin, end] = constraints.GetEffectiveRangeBounds(loopIndex);
                 begin = std::max(loopRange.Begin(), begin);
                 end = std::min(loopRange.End(), end);
@@ -1377,7 +1430,12 @@ namespace loopnest
                     {
                         entry.loopRange = candidateRange;
                         symbolTable.insert_or_assign(loopIndex, entry);
-                        splitVal = splitVal.value_or(false) || pred.evaluate(domain, symbolTable, schedule);
+
+                        // Keep the split if the predicate holds for the candidate range, or if it can't be
+                        // resolved statically -- splitting more often than necessary is harmless, but leaving
+                        // an unresolved predicate inside a partition forces a per-iteration conditional later
+                        auto evalResult = pred.evaluate(domain, symbolTable, schedule);
+                        splitVal = splitVal.value_or(false) || !evalResult.has_value() || *evalResult;
                     }
 
                     if (splitVal.value_or(false))
@@ -1633,7 +1691,7 @@ namespace loopnest
 
     LoopIndexSymbolTable LoopNestBuilder::GetRuntimeIndexVariables(const LoopIndexSymbolTable& runtimeLoopIndices, const LoopVisitSchedule& schedule) const
     {
-        auto domain = GetDomain();
+        const auto& domain = GetDomain();
 
         // Start with the concrete loop indices
         LoopIndexSymbolTable indexVariables = runtimeLoopIndices;
@@ -1837,10 +1895,9 @@ namespace loopnest
         return const_cast<ScheduleOp&>(_schedule).getKernelIds();
     }
 
-    TransformedDomain LoopNestBuilder::GetDomain() const
+    const TransformedDomain& LoopNestBuilder::GetDomain() const
     {
-        auto domain = const_cast<ScheduleOp&>(_schedule).getDomain().getValue();
-        return domain;
+        return _domain;
     }
 
     const std::vector<ScheduledKernelOp>& LoopNestBuilder::GetKernelGroup(std::string id) const
@@ -1899,7 +1956,7 @@ namespace loopnest
 
     std::vector<size_t> LoopNestBuilder::GetLogicalDimensionPositions(const Index& index) const
     {
-        auto domain = GetDomain();
+        const auto& domain = GetDomain();
         auto orderedDomainDims = domain.GetDimensions();
         std::vector<size_t> result;
         for (auto dimensionIndex : domain.GetBaseIndices(index))
@@ -1923,7 +1980,7 @@ namespace loopnest
 
     void LoopNestBuilder::EmitKernelBody(OpBuilder& builder, InvokeKernelOp invokeOp, const LoopIndexSymbolTable& runtimeIndexVariables)
     {
-        auto domain = GetDomain();
+        const auto& domain = GetDomain();
         auto op = FindKernelOp(invokeOp.getKernel(), GetScheduleOp());
         assert(isa<ScheduledKernelOp>(op) && "Didn't find scheduled kernel");
 
@@ -700,6 +700,95 @@ namespace loopnest
         return skewedIndexOp;
     }
 
+    Index ScheduleOp::flatten(Index outer, Index inner)
+    {
+        OpBuilder builder(getContext());
+
+        auto domainAttr = getDomain(); // A TransformedDomainAttr
+        auto domain = domainAttr.getValue(); // A TransformedDomain
+
+        // Validate against the arrays' strides that the two indices traverse contiguous memory
+        // before collapsing them: wherever either index appears in a kernel access, both must
+        // address adjacent dimensions of the same array, and the outer dimension's stride must
+        // equal the inner index's extent times the inner dimension's stride, so the pair forms a
+        // single contiguous stream
+        auto innerExtent = domain.GetIndexRange(inner).Size();
+        auto nest = (*this)->getParentOfType<NestOp>();
+        for (auto scheduledKernel : getKernels())
+        {
+            auto kernel = nest.getKernel(scheduledKernel.getKernel());
+            kernel->walk([&](ir::value::SliceOp slice) {
+                auto dimensions = ir::util::ConvertArrayAttrToIntVector(slice.sliceDimensions());
+                int64_t outerDim = -1;
+                int64_t innerDim = -1;
+                for (auto en : llvm::enumerate(slice.offsets()))
+                {
+                    if (auto indexOp = en.value().getDefiningOp<SymbolicIndexOp>())
+                    {
+                        if (indexOp.getValue() == outer)
+                        {
+                            outerDim = dimensions[en.index()];
+                        }
+                        else if (indexOp.getValue() == inner)
+                        {
+                            innerDim = dimensions[en.index()];
+                        }
+                    }
+                }
+                if (outerDim == -1 && innerDim == -1)
+                {
+                    return; // access doesn't involve the flattened indices
+                }
+                if (outerDim == -1 || innerDim == -1 || innerDim != outerDim + 1)
+                {
+                    throw std::logic_error("Cannot flatten indices '" + outer.GetName() + "' and '" + inner.GetName() + "': a kernel access doesn't address them as adjacent dimensions of the same array");
+                }
+
+                auto memRefType = slice.getSourceMemRefType();
+                llvm::SmallVector<int64_t, 4> strides;
+                int64_t memRefOffset;
+                if (failed(mlir::getStridesAndOffset(memRefType, strides, memRefOffset)) ||
+                    llvm::any_of(strides, [](int64_t stride) { return mlir::ShapedType::isDynamicStrideOrOffset(stride); }))
+                {
+                    throw std::logic_error("Cannot flatten indices '" + outer.GetName() + "' and '" + inner.GetName() + "': an accessed array doesn't have static strides");
+                }
+                if (strides[outerDim] != strides[innerDim] * innerExtent)
+                {
+                    throw std::logic_error("Cannot flatten indices '" + outer.GetName() + "' and '" + inner.GetName() + "': dimension " + std::to_string(outerDim) + " of an accessed array has stride " + std::to_string(strides[outerDim]) + ", but a contiguous stream requires " + std::to_string(strides[innerDim] * innerExtent));
+                }
+            });
+        }
+
+        auto flattenedIndex = domain.Flatten(outer, inner, getContext());
+
+        // Replace the outer index with the flattened index in the loop sequence order, and drop the inner one
+        auto loopSequence = getOrder();
+        auto it = std::find(loopSequence.begin(), loopSequence.end(), outer);
+        assert(it != loopSequence.end());
+        *it = flattenedIndex;
+        loopSequence.erase(std::remove(loopSequence.begin(), loopSequence.end(), inner), loopSequence.end());
+
+        // Update attributes
+        setDomain(domain);
+        setOrder(loopSequence);
+
+        // Create a SymbolicIndexOp for the flattened index
+        builder.setInsertionPoint(*this);
+        [[maybe_unused]] auto flattenedIndexOp = getOrCreateSymbolicIndex(builder, flattenedIndex);
+        return flattenedIndex;
+    }
+
+    SymbolicIndexOp ScheduleOp::flatten(SymbolicIndexOp outer, SymbolicIndexOp inner)
+    {
+        auto flattenedIndex = flatten(outer.getValue(), inner.getValue());
+        OpBuilder builder(getContext());
+        builder.setInsertionPoint(*this);
+
+        auto flattenedIndexOp = getOrCreateSymbolicIndex(builder, flattenedIndex);
+        flattenedIndexOp->setAttr("reference", outer->getAttr("name"));
+        return flattenedIndexOp;
+    }
+
     SymbolicIndexOp ScheduleOp::getOrCreateSymbolicIndex(OpBuilder& builder, Index index)
     {
         return getSymbolicIndexForOperation(getOperation(), index);
@@ -1022,6 +1111,58 @@ namespace loopnest
         return mlir::success();
     }
 
+    // Compact custom syntax: the generic form of a schedule repeats the kernels attribute inside a
+    // fully-quoted dictionary and prints the implicit terminator of every region, which dominates
+    // the size of snapshot dumps. The custom form is:
+    //   accln.schedule [@kernel_1, ...] (ranges %a, %b : index, index) attributes {...} { ... }
+    static void print(OpAsmPrinter& p, ScheduleOp op)
+    {
+        p << op.getOperationName() << " ";
+        p.printAttribute(op.kernels());
+        if (!op.rangeOperands().empty())
+        {
+            p << " (ranges ";
+            p.printOperands(op.rangeOperands());
+            p << " : " << op.rangeOperands().getTypes() << ")";
+        }
+        p.printOptionalAttrDictWithKeyword(op->getAttrs(), /*elidedAttrs=*/{ ScheduleOp::getKernelsAttrName() });
+        p.printRegion(op.body(),
+                      /*printEntryBlockArgs=*/false,
+                      /*printBlockTerminators=*/false);
+    }
+
+    static ParseResult parseScheduleOp(OpAsmParser& parser, OperationState& result)
+    {
+        auto& builder = parser.getBuilder();
+
+        ArrayAttr kernels;
+        if (failed(parser.parseAttribute(kernels, ScheduleOp::getKernelsAttrName(), result.attributes)))
+            return failure();
+
+        if (succeeded(parser.parseOptionalLParen()))
+        {
+            SmallVector<OpAsmParser::OperandType, 4> rangeOperands;
+            SmallVector<Type, 4> rangeTypes;
+            auto operandsLoc = parser.getCurrentLocation();
+            if (failed(parser.parseKeyword("ranges")) ||
+                failed(parser.parseOperandList(rangeOperands)) ||
+                failed(parser.parseColonTypeList(rangeTypes)) ||
+                failed(parser.parseRParen()) ||
+                failed(parser.resolveOperands(rangeOperands, rangeTypes, operandsLoc, result.operands)))
+                return failure();
+        }
+
+        if (failed(parser.parseOptionalAttrDictWithKeyword(result.attributes)))
+            return failure();
+
+        Region* body = result.addRegion();
+        if (failed(parser.parseRegion(*body)))
+            return failure();
+        ScheduleOp::ensureTerminator(*body, builder, result.location);
+
+        return success();
+    }
+
     // [kerha] Currently, padded indices are skipped over. I'm not sure if this is the right logic, but there aren't any cases yet that fail.
     std::vector<Index> GetDomainUnfusedIndices(const TransformedDomain& domain, const std::vector<Index>& fusedIndices)
     {
@@ -1070,6 +1211,172 @@ namespace loopnest
         return allUnfusedIndices;
     }
 
+    namespace
+    {
+        // An index's access signature: the set of (array, dimension) slots the index addresses
+        // in the schedule's kernels. Arrays are identified by the accessed mlir::Value, so the
+        // schedules being fused must read/write the same function arguments or allocations for
+        // their indices to correspond.
+        using AccessSlot = std::pair<void*, int64_t>;
+        using AccessSignature = std::set<AccessSlot>;
+
+        std::string DescribeAccessedArray(void* opaqueValue)
+        {
+            auto value = mlir::Value::getFromOpaquePointer(opaqueValue);
+            if (auto arg = value.dyn_cast<mlir::BlockArgument>())
+            {
+                return "function argument " + std::to_string(arg.getArgNumber());
+            }
+            if (auto* op = value.getDefiningOp())
+            {
+                return "the result of '" + op->getName().getStringRef().str() + "'";
+            }
+            return "<unknown array>";
+        }
+
+        std::string DescribeAccessSlot(const AccessSlot& slot)
+        {
+            return "dimension " + std::to_string(slot.second) + " of " + DescribeAccessedArray(slot.first);
+        }
+
+        // Walks a slice chain back to the array it views, translating a dimension of the view
+        // into the corresponding dimension of the base array
+        AccessSlot ResolveToBaseArray(mlir::Value source, int64_t dimension)
+        {
+            while (auto parent = source.getDefiningOp<ir::value::SliceOp>())
+            {
+                auto removedDims = ir::util::ConvertArrayAttrToIntVector(parent.sliceDimensions());
+                std::sort(removedDims.begin(), removedDims.end());
+
+                // dimension d of the view is the d'th dimension of the parent source not removed by the slice
+                int64_t baseDim = 0;
+                for (auto remaining = dimension;; ++baseDim)
+                {
+                    if (std::binary_search(removedDims.begin(), removedDims.end(), baseDim))
+                    {
+                        continue;
+                    }
+                    if (remaining == 0)
+                    {
+                        break;
+                    }
+                    --remaining;
+                }
+                dimension = baseDim;
+                source = parent.source();
+            }
+            return { source.getAsOpaquePointer(), dimension };
+        }
+
+        std::map<Index, AccessSignature> GetIndexAccessSignatures(ScheduleOp schedule)
+        {
+            std::map<Index, AccessSignature> signatures;
+            auto nest = schedule->getParentOfType<NestOp>();
+            for (auto scheduledKernel : schedule.getKernels())
+            {
+                auto kernel = nest.getKernel(scheduledKernel.getKernel());
+                kernel->walk([&](ir::value::SliceOp slice) {
+                    auto dimensions = ir::util::ConvertArrayAttrToIntVector(slice.sliceDimensions());
+                    for (auto en : llvm::enumerate(slice.offsets()))
+                    {
+                        if (auto indexOp = en.value().getDefiningOp<SymbolicIndexOp>())
+                        {
+                            signatures[indexOp.getValue()].insert(ResolveToBaseArray(slice.source(), dimensions[en.index()]));
+                        }
+                    }
+                });
+            }
+            return signatures;
+        }
+    } // namespace
+
+    std::vector<std::vector<Index>> InferIndexCorrespondences(const std::vector<ScheduleOp>& schedules)
+    {
+        assert(!schedules.empty());
+
+        std::vector<std::map<Index, AccessSignature>> signatures;
+        signatures.reserve(schedules.size());
+        for (auto schedule : schedules)
+        {
+            signatures.push_back(GetIndexAccessSignatures(schedule));
+        }
+
+        std::vector<std::vector<Index>> correspondences;
+        auto baseIndices = ScheduleOp{ schedules[0] }.getDomain().getValue().GetDimensions();
+        std::map<Index, Index> claimedBy; // index of a later schedule -> the schedule-0 index that matched it
+        for (const auto& baseIndex : baseIndices)
+        {
+            auto sigIt = signatures[0].find(baseIndex);
+            if (sigIt == signatures[0].end() || sigIt->second.empty())
+            {
+                continue; // the index addresses no arrays, so there's nothing to match it by
+            }
+            const auto& baseSignature = sigIt->second;
+
+            std::vector<Index> row{ baseIndex };
+            bool matchedAny = false;
+            for (size_t scheduleIdx = 1; scheduleIdx < schedules.size(); ++scheduleIdx)
+            {
+                std::vector<std::pair<Index, AccessSlot>> candidates;
+                for (const auto& [otherIndex, otherSignature] : signatures[scheduleIdx])
+                {
+                    std::vector<AccessSlot> shared;
+                    std::set_intersection(baseSignature.begin(), baseSignature.end(), otherSignature.begin(), otherSignature.end(), std::back_inserter(shared));
+                    if (!shared.empty())
+                    {
+                        candidates.emplace_back(otherIndex, shared.front());
+                    }
+                }
+
+                if (candidates.size() > 1)
+                {
+                    std::ostringstream diagnostic;
+                    diagnostic << "Cannot infer a fusion index correspondence for index '" << baseIndex.GetName()
+                               << "': in schedule " << scheduleIdx << ", ";
+                    for (size_t i = 0; i < candidates.size(); ++i)
+                    {
+                        diagnostic << (i == 0 ? "" : (i == candidates.size() - 1 ? " and " : ", "))
+                                   << "index '" << candidates[i].first.GetName() << "' addresses " << DescribeAccessSlot(candidates[i].second);
+                    }
+                    diagnostic << "; pass explicit indexCorrespondences for these indices";
+                    throw std::logic_error(diagnostic.str());
+                }
+
+                if (candidates.size() == 1)
+                {
+                    const auto& [otherIndex, slot] = candidates.front();
+                    if (auto claimIt = claimedBy.find(otherIndex); claimIt != claimedBy.end())
+                    {
+                        std::ostringstream diagnostic;
+                        diagnostic << "Cannot infer fusion index correspondences: indices '" << claimIt->second.GetName()
+                                   << "' and '" << baseIndex.GetName() << "' of schedule 0 both address " << DescribeAccessSlot(slot)
+                                   << " matched by index '" << otherIndex.GetName() << "' of schedule " << scheduleIdx
+                                   << "; pass explicit indexCorrespondences for these indices";
+                        throw std::logic_error(diagnostic.str());
+                    }
+                    claimedBy.emplace(otherIndex, baseIndex);
+                    row.push_back(otherIndex);
+                    matchedAny = true;
+                }
+                else
+                {
+                    row.push_back(Index::none);
+                }
+            }
+
+            if (matchedAny)
+            {
+                correspondences.push_back(std::move(row));
+            }
+        }
+
+        if (correspondences.empty())
+        {
+            throw std::logic_error("Cannot infer fusion index correspondences: the schedules' kernels share no array accesses; pass explicit indexCorrespondences");
+        }
+        return correspondences;
+    }
+
     std::tuple<ScheduleOp, Index> Fuse(mlir::OpBuilder& builder, ScheduleOp schedule1, ScheduleOp schedule2)
     {
         auto domain1 = schedule1.getDomain().getValue();
@@ -2025,6 +2332,35 @@ namespace loopnest
         return mlir::success();
     }
 
+    // Compact custom syntax, mirroring the schedule op:
+    //   accln.kernel @kernel_name attributes {...} { ... }
+    static void print(OpAsmPrinter& p, KernelOp op)
+    {
+        p << op.getOperationName() << ' ';
+        p.printSymbolName(op.getId());
+        p.printOptionalAttrDictWithKeyword(op->getAttrs(), /*elidedAttrs=*/{ KernelOp::getIdAttrName() });
+        p.printRegion(op.region(),
+                      /*printEntryBlockArgs=*/false,
+                      /*printBlockTerminators=*/false);
+    }
+
+    static ParseResult parseKernelOp(OpAsmParser& parser, OperationState& result)
+    {
+        StringAttr idAttr;
+        if (failed(parser.parseSymbolName(idAttr, KernelOp::getIdAttrName(), result.attributes)))
+            return failure();
+
+        if (failed(parser.parseOptionalAttrDictWithKeyword(result.attributes)))
+            return failure();
+
+        Region* body = result.addRegion();
+        if (failed(parser.parseRegion(*body)))
+            return failure();
+        KernelOp::ensureTerminator(*body, parser.getBuilder(), result.location);
+
+        return success();
+    }
+
     // TODO: uniquify id globally
     std::string GetUniqueKernelId(std::string id, mlir::Region* region)
     {
@@ -18,6 +18,11 @@ namespace loopnest
     //
 
     LoopVisitSchedule::LoopVisitSchedule(std::vector<IndexRange> loopRanges, int level) :
+        _level(level),
+        _loopRanges(std::make_shared<const std::vector<IndexRange>>(std::move(loopRanges)))
+    {}
+
+    LoopVisitSchedule::LoopVisitSchedule(std::shared_ptr<const std::vector<IndexRange>> loopRanges, int level) :
         _level(level),
         _loopRanges(std::move(loopRanges))
     {}
@@ -66,7 +71,7 @@ namespace loopnest
 
         if (domain.IsPaddedIndex(loopIndex))
         {
-            const auto constraints = domain.GetConstraints();
+            const auto& constraints = domain.GetConstraints();
             auto [unpaddedBegin, unused] = constraints.GetEffectiveRangeBounds(loopIndex);
 
             // clamp the front-padded ranges for non-fused indices only
@@ -113,12 +118,12 @@ namespace loopnest
 
     bool LoopVisitSchedule::IsDone() const
     {
-        return _level == static_cast<int>(_loopRanges.size());
+        return _level == static_cast<int>(_loopRanges->size());
     }
 
     bool LoopVisitSchedule::IsInnermostLoop() const
     {
-        return _level == static_cast<int>(_loopRanges.size()) - 1;
+        return _level == static_cast<int>(_loopRanges->size()) - 1;
     }
 
     bool LoopVisitSchedule::IsOutermostLoop() const
@@ -128,7 +133,7 @@ namespace loopnest
 
     Index LoopVisitSchedule::CurrentLoopIndex() const
     {
-        return _loopRanges[_level].GetIndex();
+        return (*_loopRanges)[_level].GetIndex();
     }
 
     int64_t LoopVisitSchedule::CurrentLoopLevel() const
@@ -156,7 +161,7 @@ namespace loopnest
 
     bool LoopVisitSchedule::WasIterationVariableDefined(const Index& index) const
     {
-        for (auto it = _loopRanges.begin(); it != _loopRanges.begin() + _level + 1; ++it)
+        for (auto it = _loopRanges->begin(); it != _loopRanges->begin() + _level + 1; ++it)
         {
             auto iterVar = it->GetIndex();
             if (iterVar == index)
@@ -194,6 +194,7 @@ namespace loopnest
 
         _loopIndices.erase(index);
         _loopIndices.insert(paddedIndex);
+        InvalidateDerivations(index);
         return paddedIndex;
     }
 
@@ -246,6 +247,7 @@ namespace loopnest
         _loopIndices.erase(index);
         _loopIndices.insert(outer);
         _loopIndices.insert(inner);
+        InvalidateDerivations(index);
         return { outer, inner };
     }
 
@@ -286,9 +288,45 @@ namespace loopnest
 
         _loopIndices.erase(index);
         _loopIndices.insert(skewedIndex);
+        InvalidateDerivations(index);
         return skewedIndex;
     }
 
+    Index TransformedDomain::Flatten(const Index& outer, const Index& inner, mlir::MLIRContext* context)
+    {
+        Index flattenedIndex = { outer.GetName() + "_" + inner.GetName() + "_f" };
+        if (_indices.count(outer) == 0 || _indices.count(inner) == 0)
+            throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "Flattening an unknown index");
+        if (!IsLoopIndex(outer) || !IsLoopIndex(inner))
+            throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "Can't flatten an already-transformed index");
+
+        auto outerRange = _indices[outer].range;
+        auto innerRange = _indices[inner].range;
+        if (!outerRange.HasConstantEnd() || !innerRange.HasConstantEnd())
+            throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "Can't flatten non-constant index ranges");
+        if (outerRange.Begin() != 0 || innerRange.Begin() != 0 || outerRange.Increment() != 1 || innerRange.Increment() != 1)
+            throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "Can only flatten index ranges that begin at 0 with increments == 1");
+        if (!_indices[outer].padding.empty() || !_indices[inner].padding.empty())
+            throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "Can't flatten padded indices");
+
+        // create the flattened index: outer(dim=M), inner(dim=N), flattenedIndex(dim=M*N)
+        auto innerSize = innerRange.Size();
+        _indices[flattenedIndex] = { {}, { 0, outerRange.Size() * innerSize }, /*padding=*/{}, { outer, inner } };
+
+        // flattening results in: (i, j) => f = i*N + j
+        // therefore, the collapsed indices are i = f floordiv N and j = f mod N
+        auto flattenedExpr = mlir::getAffineDimExpr(0, context);
+        _indices[outer].expr = AffineExpression(flattenedExpr.floorDiv(innerSize), { flattenedIndex });
+        _indices[inner].expr = AffineExpression(flattenedExpr % innerSize, { flattenedIndex });
+
+        _loopIndices.erase(outer);
+        _loopIndices.erase(inner);
+        _loopIndices.insert(flattenedIndex);
+        InvalidateDerivations(outer);
+        InvalidateDerivations(inner);
+        return flattenedIndex;
+    }
+
     bool TransformedDomain::HasConstantDimensionSize(const Index& dimensionIndex) const
     {
         if (!IsDimension(dimensionIndex))
@@ -410,25 +448,15 @@ namespace loopnest
         if (!IsDimension(dimensionIndex))
             throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "index isn't a dimension");
 
-        std::unordered_set<Index> loopIndices;
-        CollectLoopIndicesForIndex(dimensionIndex, loopIndices);
-        return { loopIndices.begin(), loopIndices.end() };
-    }
-
-    void TransformedDomain::CollectLoopIndicesForIndex(const Index& index, std::unordered_set<Index>& loopIndices) const
-    {
-        auto expr = GetIndexExpr(index);
-        for (auto i : expr.GetIndices())
+        std::vector<Index> result;
+        for (const auto& i : GetDependentClosure(dimensionIndex))
         {
             if (IsLoopIndex(i))
             {
-                loopIndices.insert(i);
-            }
-            else
-            {
-                CollectLoopIndicesForIndex(i, loopIndices);
+                result.push_back(i);
             }
         }
+        return result;
     }
 
     std::vector<Index> TransformedDomain::GetComputedIndicesForDimension(const Index& dimensionIndex) const
@@ -436,34 +464,30 @@ namespace loopnest
         if (!IsDimension(dimensionIndex))
             throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "index isn't a dimension");
 
-        std::unordered_set<Index> computedIndices;
-        CollectComputedIndicesForIndex(dimensionIndex, computedIndices);
-        return { computedIndices.begin(), computedIndices.end() };
-    }
-
-    void TransformedDomain::CollectComputedIndicesForIndex(const Index& index, std::unordered_set<Index>& computedIndices) const
-    {
-        auto expr = GetIndexExpr(index);
-        for (auto i : expr.GetIndices())
+        std::vector<Index> result;
+        for (const auto& i : GetDependentClosure(dimensionIndex))
         {
             if (IsComputedIndex(i))
             {
-                computedIndices.insert(i);
-            }
-            else
-            {
-                CollectComputedIndicesForIndex(i, computedIndices);
+                result.push_back(i);
             }
         }
+        return result;
     }
 
-    std::vector<Index> TransformedDomain::GetDependentIndices(const Index& index) const
+    const std::unordered_set<Index>& TransformedDomain::GetDependentClosure(const Index& index) const
     {
-        std::unordered_set<Index> result;
+        if (auto cacheIt = _derivedClosures.find(index); cacheIt != _derivedClosures.end())
+        {
+            return cacheIt->second;
+        }
+
+        std::unordered_set<Index> closure;
         std::queue<Index> indicesToVisit;
         indicesToVisit.push(index);
 
-        // get all children, children of children, etc.
+        // get all children, children of children, etc., reusing already-memoized closures of the
+        // indices we reach along the way
         while (!indicesToVisit.empty())
         {
             auto i = indicesToVisit.front();
@@ -474,18 +498,47 @@ namespace loopnest
                 auto dependentIndices = expr.GetIndices();
                 for (auto d : dependentIndices)
                 {
-                    if (result.count(d) == 0)
+                    if (closure.insert(d).second && !IsLoopIndex(d))
                     {
-                        if (!IsLoopIndex(d))
+                        if (auto memoized = _derivedClosures.find(d); memoized != _derivedClosures.end())
+                        {
+                            closure.insert(memoized->second.begin(), memoized->second.end());
+                        }
+                        else
                         {
                             indicesToVisit.push(d);
                         }
-                        result.insert(d);
                     }
                 }
             }
         }
-        return { result.begin(), result.end() };
+        return _derivedClosures.emplace(index, std::move(closure)).first->second;
+    }
+
+    void TransformedDomain::InvalidateDerivations(const Index& index)
+    {
+        // Drop the memoized closure for the transformed index, plus any closure it appears in
+        // (its ancestors' closures are the only other ones that can change); everything else
+        // stays memoized
+        _cachedConstraints.reset();
+        _derivedClosures.erase(index);
+        for (auto it = _derivedClosures.begin(); it != _derivedClosures.end();)
+        {
+            if (it->second.count(index) != 0)
+            {
+                it = _derivedClosures.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    std::vector<Index> TransformedDomain::GetDependentIndices(const Index& index) const
+    {
+        const auto& closure = GetDependentClosure(index);
+        return { closure.begin(), closure.end() };
     }
 
     std::vector<Index> TransformedDomain::GetDependentLoopIndices(const Index& index, bool includeSelf) const
@@ -496,38 +549,23 @@ namespace loopnest
         }
         else
         {
-            std::unordered_set<Index> result;
-            auto dependentIndices = GetDependentIndices(index);
-            for (auto i : dependentIndices)
+            std::vector<Index> result;
+            for (const auto& i : GetDependentClosure(index))
             {
                 if (IsLoopIndex(i))
                 {
-                    result.insert(i);
+                    result.push_back(i);
                 }
             }
-            return { result.begin(), result.end() };
+            return result;
         }
     }
 
     bool TransformedDomain::DependsOn(const Index& index1, const Index& index2) const
     {
         // does 'index1' depend on 'index2'? (after a split, the parent depends on the new loop indices)
-        // look at expr for index1 and see if it contains index2. Do so recursively
-        auto index1Expr = GetIndexExpr(index1);
-        auto index1Vars = index1Expr.GetIndices();
-        if (std::find(index1Vars.begin(), index1Vars.end(), index2) != index1Vars.end())
-        {
-            return true;
-        }
-
-        for (auto i : index1Vars)
-        {
-            if (DependsOn(i, index2))
-            {
-                return true;
-            }
-        }
-        return false;
+        // 'index2' depends transitively on everything in its closure
+        return GetDependentClosure(index1).count(index2) != 0;
     }
 
     bool TransformedDomain::HasParentIndex(const Index& index) const
@@ -671,6 +709,7 @@ namespace loopnest
         {
             resolveFn(indexInfo.second.range);
         }
+        _cachedConstraints.reset(); // ranges feed the constraint system
     }
 
     TransformedDomain TransformedDomain::Fuse(const std::vector<TransformedDomain>& domains, const std::vector<std::vector<Index>>& indexCorrespondences)
@@ -813,6 +852,11 @@ namespace loopnest
             result._indices.erase(unusedIndex);
         }
 
+        // Fusing rewires expressions and removes indices wholesale, so any closures memoized
+        // while building the result (e.g. by the GetDependentIndices calls above) are stale
+        result._derivedClosures.clear();
+        result._cachedConstraints.reset();
+
         return result;
     }
 
@@ -823,6 +867,7 @@ namespace loopnest
 
         assert(range.Begin() == 0 && "Dimension should begin at 0");
         _indices[dimension] = { {}, range, /*padding=*/{}, /*parents=*/{} };
+        _cachedConstraints.reset(); // the constraint system is sized by the index set
     }
 
     void TransformedDomain::Print(std::ostream& os) const
@@ -833,8 +878,13 @@ namespace loopnest
         }
     }
 
-    AffineConstraints TransformedDomain::GetConstraints() const
+    const AffineConstraints& TransformedDomain::GetConstraints() const
     {
+        if (_cachedConstraints)
+        {
+            return *_cachedConstraints;
+        }
+
         auto indices = GetIndices();
 
         AffineConstraints constraints(indices);
@@ -894,7 +944,8 @@ namespace loopnest
                 });
             }
         }
-        return constraints;
+        _cachedConstraints = std::move(constraints);
+        return *_cachedConstraints;
     }
 
     bool operator==(const TransformedDomain& a, const TransformedDomain& b)
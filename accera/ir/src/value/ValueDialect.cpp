@@ -543,6 +543,18 @@ MMAOp::MMAOp(MMAShape shape_) :
         k = 16;
         blocks = 1;
         break;
+    case MMAShape::M8xN8xK4_B1:
+        m = 8;
+        n = 8;
+        k = 4;
+        blocks = 1;
+        break;
+    case MMAShape::M16xN16xK64_B1:
+        m = 16;
+        n = 16;
+        k = 64;
+        blocks = 1;
+        break;
     default:
         assert(false && "Invalid MMA shape.");
         break;
@@ -132,6 +132,243 @@ def load_model(model_file):
     return onnx.load_model(model_file)
 
 
+def _build_graph_maps(model):
+    producers = {}
+    consumer_counts = {}
+    for node in model.graph.node:
+        for output_name in node.output:
+            producers[output_name] = node
+        for input_name in node.input:
+            consumer_counts[input_name] = consumer_counts.get(input_name, 0) + 1
+    graph_outputs = set(output.name for output in model.graph.output)
+    return producers, consumer_counts, graph_outputs
+
+
+def _get_single_consumer(model, name, consumer_counts, graph_outputs):
+    # A value can only be absorbed into a fused function if nothing else observes it
+    if name in graph_outputs or consumer_counts.get(name, 0) != 1:
+        return None
+    for node in model.graph.node:
+        if name in node.input:
+            return node
+    return None
+
+
+def _bias_shape_is_fusable(bias_shape, output_shape):
+    # Mirror the C shape checks in MLAS_with_bias so the matcher never hands it
+    # a subgraph it would reject
+    if bias_shape is None or output_shape is None:
+        return False
+    bias_shape, output_shape = list(bias_shape), list(output_shape)
+    if len(bias_shape) == len(output_shape):
+        return bias_shape == output_shape
+    if len(bias_shape) == len(output_shape) - 1:
+        return bias_shape == output_shape[:-3] + output_shape[-1:]
+    return False
+
+
+def _match_matmul_add_activation(model, node, consumer_counts, graph_outputs):
+    if node.op_type != 'MatMul':
+        return None
+
+    add_node = _get_single_consumer(model, node.output[0], consumer_counts, graph_outputs)
+    if add_node is None or add_node.op_type != 'Add':
+        return None
+
+    bias_name = add_node.input[1] if add_node.input[0] == node.output[0] else add_node.input[0]
+    if not _bias_shape_is_fusable(get_shape(model, bias_name), get_shape(model, node.output[0])):
+        return None
+
+    matched_nodes = [node, add_node]
+    activation = None
+    activation_node = _get_single_consumer(model, add_node.output[0], consumer_counts, graph_outputs)
+    if activation_node is not None and activation_node.op_type in ('Relu', 'Gelu'):
+        activation = activation_node.op_type
+        matched_nodes.append(activation_node)
+
+    return {
+        'pattern': 'MatMul+Add' + (f'+{activation}' if activation else ''),
+        'nodes': matched_nodes,
+        'consumed_nodes': [node, add_node],    # the activation stays a separate node for now
+        'bias_name': bias_name,
+        'output_name': add_node.output[0],
+        'activation': activation,
+        'primitive': 'MLAS bias fusion (FusedFeedforward epilogue pending python bindings)',
+        'fused': True,
+    }
+
+
+def _match_layernorm(model, node, producers, consumer_counts, graph_outputs):
+    # Match the canonical LayerNormalization decomposition:
+    # ReduceMean -> Sub -> Pow/Mul -> ReduceMean -> Add(eps) -> Sqrt -> Div [-> Mul(gamma) -> Add(beta)]
+    if node.op_type != 'ReduceMean':
+        return None
+
+    sub_node = _get_single_consumer(model, node.output[0], consumer_counts, graph_outputs)
+    if sub_node is None or sub_node.op_type != 'Sub' or node.input[0] not in sub_node.input:
+        return None
+
+    matched_nodes = [node, sub_node]
+    current = sub_node
+    for expected in (('Pow', 'Mul'), ('ReduceMean', ), ('Add', ), ('Sqrt', ), ('Div', )):
+        # The Sub output fans out to the variance computation and the final Div,
+        # so only require a single consumer past that point
+        consumers = [n for n in model.graph.node if current.output[0] in n.input and n.op_type in expected]
+        if not consumers:
+            return None
+        current = consumers[0]
+        matched_nodes.append(current)
+
+    for expected in ('Mul', 'Add'):
+        next_node = _get_single_consumer(model, current.output[0], consumer_counts, graph_outputs)
+        if next_node is None or next_node.op_type != expected:
+            break
+        current = next_node
+        matched_nodes.append(current)
+
+    return {
+        'pattern': 'LayerNormalization',
+        'nodes': matched_nodes,
+        'consumed_nodes': [],
+        'output_name': current.output[0],
+        'primitive': 'LayerNormalizeVectorizedFused (MLOperations.cpp, not yet python-bound)',
+        'fused': False,
+    }
+
+
+def _match_attention(model, node, consumer_counts, graph_outputs):
+    # Match the scaled dot-product attention core:
+    # MatMul(Q, K) [-> Div/Mul(scale)] [-> Add(mask)] -> Softmax -> MatMul(., V)
+    if node.op_type != 'MatMul':
+        return None
+
+    matched_nodes = [node]
+    current = node
+    for optional in ('Div', 'Mul'):
+        next_node = _get_single_consumer(model, current.output[0], consumer_counts, graph_outputs)
+        if next_node is not None and next_node.op_type == optional:
+            current = next_node
+            matched_nodes.append(current)
+            break
+
+    next_node = _get_single_consumer(model, current.output[0], consumer_counts, graph_outputs)
+    if next_node is not None and next_node.op_type == 'Add':
+        current = next_node
+        matched_nodes.append(current)
+        next_node = _get_single_consumer(model, current.output[0], consumer_counts, graph_outputs)
+
+    if next_node is None or next_node.op_type != 'Softmax':
+        return None
+    current = next_node
+    matched_nodes.append(current)
+
+    next_node = _get_single_consumer(model, current.output[0], consumer_counts, graph_outputs)
+    if next_node is None or next_node.op_type != 'MatMul':
+        return None
+    matched_nodes.append(next_node)
+
+    return {
+        'pattern': 'ScaledDotProductAttention',
+        'nodes': matched_nodes,
+        'consumed_nodes': [],
+        'output_name': next_node.output[0],
+        'primitive': 'FusedScaledDotProductAttention (MLOperations.cpp, not yet python-bound)',
+        'fused': False,
+    }
+
+
+def find_fusable_subgraphs(model):
+    """Walks the graph looking for standard subgraphs that map onto fused primitives.
+
+    MatMul+Add(+activation) chains are emitted as a single function through the MLAS
+    bias-fusion path. LayerNorm clusters and attention blocks are recognized and
+    reported so the model's fusion headroom is visible, but stay node-per-function
+    until the fused MLOperations primitives are exposed through the python DSL.
+    """
+    producers, consumer_counts, graph_outputs = _build_graph_maps(model)
+    matches = []
+    claimed = set()
+
+    for node in model.graph.node:
+        for matcher in (lambda n: _match_attention(model, n, consumer_counts, graph_outputs),
+                        lambda n: _match_matmul_add_activation(model, n, consumer_counts, graph_outputs),
+                        lambda n: _match_layernorm(model, n, producers, consumer_counts, graph_outputs)):
+            match = matcher(node)
+            if match and not any(id(n) in claimed for n in match['nodes']):
+                claimed.update(id(n) for n in match['nodes'])
+                matches.append(match)
+                break
+
+    return matches
+
+
+def write_fusion_report(matches, output_path):
+    report_lines = ["Accera ONNX emitter fusion report", ""]
+    if not matches:
+        report_lines.append("No fusable subgraphs found")
+    for match in matches:
+        status = "fused" if match['fused'] else "recognized (not fused)"
+        report_lines.append(f"{match['pattern']}: {status}")
+        report_lines.append(f"  nodes: {', '.join(node.name or '<unnamed>' for node in match['nodes'])}")
+        report_lines.append(f"  primitive: {match['primitive']}")
+        if match.get('activation') and len(match['consumed_nodes']) < len(match['nodes']):
+            report_lines.append(f"  note: {match['activation']} epilogue left as a separate node")
+        report_lines.append("")
+
+    report = "\n".join(report_lines)
+    print(f"[accera] {report}")
+    (output_path / "fusion_report.txt").write_text(report)
+
+
+def handle_fused_matmul_add(match, model, package, target=Target.HOST):
+    matmul_node, add_node = match['consumed_nodes']
+    A_input_name = matmul_node.input[0]
+    B_input_name = matmul_node.input[1]
+    C_input_name = match['bias_name']
+    Y_output_name = match['output_name']
+
+    A_shape = get_shape(model, A_input_name)
+    B_shape = get_shape(model, B_input_name)
+    C_shape = get_shape(model, C_input_name)
+    Y_shape = get_shape(model, Y_output_name)
+
+    print(f"[accera] handle_fused_matmul_add called for \nA = [{', '.join(map(str, A_shape))}]"
+          f"\nB = [{', '.join(map(str, B_shape))}]"
+          f"\nC = [{', '.join(map(str, C_shape))}]"
+          f"\nY = [{', '.join(map(str, Y_shape))}]")
+
+    A = Array(role=Array.Role.INPUT, element_type=float, shape=A_shape)
+    B = Array(role=Array.Role.INPUT, element_type=float, shape=B_shape)
+    C = Array(role=Array.Role.INPUT, element_type=float, shape=C_shape)
+    Y = Array(role=Array.Role.INPUT_OUTPUT, element_type=float, shape=Y_shape)
+
+    emitted_info = {}
+    opts = get_target_options(target)
+    B_init_data = get_initializer(model, B_input_name)
+    if B_init_data:
+        print(f"B Initializer detected for {matmul_node.name} for input {B_input_name}")
+        opts = opts._replace(PackBFuncName=f"{matmul_node.name}_reshape_B",
+                             PackBBufferSizeFuncName=f"{matmul_node.name}_reshape_B_size")
+        emitted_info['node_packing_functions'] = {B_input_name: [opts.PackBFuncName, opts.PackBBufferSizeFuncName]}
+
+    plan, args = MLAS(A, B, Y, bias=C, zero_C=True, opts=opts, target=target)
+    assert (args == (A, B, C, Y))
+
+    emitted_info.update({
+        ONNXHATPackage.NodeNameKey: matmul_node.name,
+        ONNXHATPackage.NodeTypeKey: 'FusedMatMulAdd',
+        ONNXHATPackage.NodeDomainKey: matmul_node.domain,
+        ONNXHATPackage.NodeArgsKey: [A_input_name, B_input_name, C_input_name, Y_output_name],
+        ONNXHATPackage.NodeArgShapesKey: [list(arg.shape) for arg in [A, B, C, Y]],
+        'fused_node_names': [node.name for node in match['consumed_nodes']],
+    })
+
+    return package.add(plan,
+                       args=[A, B, C, Y],
+                       base_name=matmul_node.name,
+                       auxiliary={ONNXHATPackage.AuxTableName: emitted_info})
+
+
 def get_target(target_name):
     if target_name == 'pi4':
         return Target(Target.Model.RASPBERRY_PI_4B, category=Target.Category.CPU)
@@ -298,8 +535,18 @@ def emit_package_for_model(model,
     # Create a package and add our function definition to it
     package = Package()
 
+    matches = find_fusable_subgraphs(model)
+    write_fusion_report(matches, output_path)
+
+    fused_node_ids = set()
+    for match in matches:
+        if match['fused']:
+            fused_node_ids.update(id(node) for node in match['consumed_nodes'])
+            handle_fused_matmul_add(match, model, package, target)
+
     for node in filter(lambda node: node.op_type in ONNX_NODE_HANDLERS, model.graph.node):
-        ONNX_NODE_HANDLERS[node.op_type](node, model, package, target)
+        if id(node) not in fused_node_ids:
+            ONNX_NODE_HANDLERS[node.op_type](node, model, package, target)
 
     # Build the HAT package
     return inferred_model, package.build(model.graph.name, format=format, mode=mode, output_dir=output_path)
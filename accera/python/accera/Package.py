@@ -264,6 +264,96 @@ class Package:
                 source, args, base_name, parameters, function_opts, auxiliary
             )
 
+    def add_graph(
+        self,
+        functions: List["accera.Function"],
+        base_name: str = "",
+        auxiliary: dict = {},
+    ) -> "accera.Function":
+        """Adds a run-graph entry point that executes previously-added functions in dependency
+        order. Dependences are derived from the Array arguments the functions share: a function is
+        ordered after every earlier function that writes an array it touches (or reads an array it
+        writes). The derived graph is recorded in the entry point's auxiliary metadata — function
+        names, per-function argument indices, edges, and a wave schedule of mutually independent
+        functions — so hosts can hand it to the runtime task-graph executor and run each wave
+        concurrently instead of scheduling the pipeline by hand. The emitted entry point itself
+        runs the same schedule sequentially, as the single-threaded fallback.
+
+        Args:
+            functions: The functions to execute, in program order, as returned by `add`.
+            base_name: A base name for the entry point.
+            auxiliary: A dictionary of additional auxiliary metadata to include in the HAT package.
+        """
+
+        if not functions:
+            raise ValueError("add_graph requires at least one function")
+        for fn in functions:
+            if not isinstance(fn, lang.Function) or fn.name not in self._fns:
+                raise ValueError(
+                    "add_graph can only schedule functions previously added to this package"
+                )
+
+        def accesses(fn):
+            reads, writes = [], []
+            for arg in fn.requested_args:
+                if isinstance(arg, lang.Array):
+                    if arg.role == lang.Array.Role.INPUT_OUTPUT:
+                        writes.append(arg)
+                    else:
+                        reads.append(arg)
+                else:
+                    reads.append(arg)    # runtime dimensions are read-only
+            return reads, writes
+
+        # The union of the functions' arguments, in first-use order, becomes the entry point's
+        # signature; each function indexes into it
+        entry_args = []
+        argument_indices = []
+        for fn in functions:
+            indices = []
+            for arg in fn.requested_args:
+                if not any(arg is existing for existing in entry_args):
+                    entry_args.append(arg)
+                indices.append(next(i for i, existing in enumerate(entry_args) if arg is existing))
+            argument_indices.append(indices)
+
+        # Program order is already topological, so dependences only point forward: RAW and WAW
+        # order a function after an earlier writer, WAR after an earlier reader
+        fn_accesses = [accesses(fn) for fn in functions]
+        edges = []
+        for j in range(len(functions)):
+            reads_j, writes_j = fn_accesses[j]
+            for i in range(j):
+                reads_i, writes_i = fn_accesses[i]
+                raw_waw = any(w is a for w in writes_i for a in reads_j + writes_j)
+                war = any(r is w for r in reads_i for w in writes_j)
+                if raw_waw or war:
+                    edges.append((i, j))
+
+        # Wave schedule: a function's wave is one past its latest predecessor's
+        wave_of = [0] * len(functions)
+        for i, j in edges:
+            wave_of[j] = max(wave_of[j], wave_of[i] + 1)
+        waves = [[] for _ in range(max(wave_of) + 1)]
+        for index, wave in enumerate(wave_of):
+            waves[wave].append(index)
+
+        def graph_fn(*args):
+            for wave in waves:
+                for index in wave:
+                    functions[index](*(args[i] for i in argument_indices[index]))
+
+        graph_metadata = dict(auxiliary)
+        graph_metadata["run_graph"] = {
+            "functions": [fn.name for fn in functions],
+            "argument_indices": argument_indices,
+            "edges": [list(edge) for edge in edges],
+            "waves": waves,
+        }
+        return self._add_function(
+            graph_fn, entry_args, base_name, {}, {"no_inline": True}, graph_metadata
+        )
+
     def _add_function(
         self,
         source: Union[
@@ -413,10 +503,15 @@ class Package:
         else:
             raise ValueError("Invalid type for source")
 
-    def _add_functions_to_module(self, module, fail_on_error=False):
+    def _add_functions_to_module(self, module, fail_on_error=False, function_names=None):
+        fns_to_emit = (
+            self._fns
+            if function_names is None
+            else {name: self._fns[name] for name in function_names}
+        )
         with SetActiveModule(module):
             to_pop = []
-            for name, wrapped_func in self._fns.items():
+            for name, wrapped_func in fns_to_emit.items():
                 try:
                     wrapped_func._emit()
                 except Exception as e:
@@ -532,8 +627,11 @@ class Package:
         mode: Mode = Mode.RELEASE,
         platform: Platform = Platform.HOST,
         tolerance: float = 1e-5,
+        debug_sample_interval: int = 1,
         output_dir: str = None,
         fail_on_error: bool = False,
+        functions: List[str] = None,
+        max_functions_per_module: int = None,
         _quiet=True,
     ):
         """Builds a HAT package.
@@ -544,7 +642,17 @@ class Package:
             mode: The package mode, such as whether it is optimized or used for debugging.
             platform: The platform where the package runs.
             tolerance: The tolerance for correctness checking when `mode = Package.Mode.DEBUG`.
+            debug_sample_interval: In `Package.Mode.DEBUG`, verify every Nth call to each function
+                (1 verifies every call). Sampled invocations run both the optimized and the reference
+                implementations; the rest call the optimized implementation directly, keeping the
+                overhead of a debug package low enough for continuous correctness monitoring.
             output_dir: The path to an output directory. Defaults to the current directory if unspecified.
+            functions: Names (or base names) of added functions to emit. Defaults to every function in
+                the package. Adding a function only records its declaration and definition closure; IR is
+                materialized here at build time, so declaring a large variant family and emitting a small
+                selection avoids paying emission cost for the rest.
+            max_functions_per_module: Lower and codegen functions in batches of at most this many per
+                module, bounding peak memory for very large packages. Unset emits everything in one module.
         """
 
         from . import accc
@@ -595,10 +703,7 @@ class Package:
             debug_utilities = self._add_debug_utilities(tolerance)
             for fn_name, utilities in debug_utilities.items():
                 self._fns[fn_name].output_verifiers = utilities
-
-        # Create the package module
-        package_module = _lang_python._Module(name=name, options=compiler_options)
-        self._add_functions_to_module(package_module, fail_on_error)
+                self._fns[fn_name].debug_sample_interval = debug_sample_interval
 
         # Emit the package module
         if format & Package.Format.SOURCE:
@@ -610,6 +715,42 @@ class Package:
         else:
             output_type = accc.ModuleOutputType.OBJECT
 
+        # Streaming mode: functions beyond the first batch are emitted into separate modules
+        # that are lowered and codegenned one batch at a time, bounding peak memory. All
+        # batches share this process's dialect/context setup, and the per-batch HAT files are
+        # merged back into the main package below like the other supporting modules
+        if functions is not None:
+            selected = set(functions)
+            fn_names = [
+                fname
+                for fname, fn in self._fns.items()
+                if fname in selected or fn.base_name in selected
+            ]
+            matched = set(fn_names) | {self._fns[fname].base_name for fname in fn_names}
+            missing = selected - matched
+            if missing:
+                raise ValueError(
+                    f"Requested functions not found in package: {sorted(missing)}"
+                )
+        else:
+            fn_names = list(self._fns.keys())
+        main_fn_names = fn_names
+        streaming_batches = []
+        if (
+            max_functions_per_module
+            and output_type == accc.ModuleOutputType.OBJECT
+            and len(fn_names) > max_functions_per_module
+        ):
+            main_fn_names = fn_names[:max_functions_per_module]
+            streaming_batches = [
+                fn_names[i:i + max_functions_per_module]
+                for i in range(max_functions_per_module, len(fn_names), max_functions_per_module)
+            ]
+
+        # Create the package module
+        package_module = _lang_python._Module(name=name, options=compiler_options)
+        self._add_functions_to_module(package_module, fail_on_error, function_names=main_fn_names)
+
         # Emit the supporting modules
         supporting_hats = []
         if (
@@ -632,6 +773,18 @@ class Package:
                     )
                 )
 
+        for batch_idx, batch_fn_names in enumerate(streaming_batches):
+            batch_module_name = f"{name}_part{batch_idx + 1}"
+            batch_module = _lang_python._Module(
+                name=batch_module_name, options=compiler_options
+            )
+            self._add_functions_to_module(
+                batch_module, fail_on_error, function_names=batch_fn_names
+            )
+            supporting_hats.append(
+                _emit_module(batch_module, target, mode, output_dir, batch_module_name)
+            )
+
         proj = accc.AcceraProject(
             output_dir=working_dir, library_name=name, output_type=output_type
         )
@@ -645,6 +798,17 @@ class Package:
         # Enable dumping of IR passes based on build format
         dump_ir = bool(format & (Package.Format.MLIR | Package.Format.MLIR_VERBOSE))
         dump_ir_verbose = bool(format & Package.Format.MLIR_VERBOSE)
+
+        # Thread the structured LLVM pipeline options through to the opt/llc invocations
+        llvm_options = {
+            "opt_level": compiler_options.llvm_optimization_level,
+            "fast_math": compiler_options.use_fast_math,
+            "unroll_threshold": compiler_options.llvm_unroll_threshold,
+            "loop_vectorize": compiler_options.llvm_loop_vectorize,
+            "target_cpu": compiler_options.llvm_target_cpu,
+            "target_features": compiler_options.llvm_target_features,
+        }
+
         proj.generate_and_emit(
             build_config=mode.value,
             system_target=target._device_name,
@@ -652,6 +816,7 @@ class Package:
             dump_all_passes=dump_ir,
             dump_intrapass_ir=dump_ir_verbose,
             gpu_only=compiler_options.gpu_only,
+            llvm_options=llvm_options,
             quiet=_quiet,
         )
 
@@ -707,7 +872,7 @@ class Package:
                 "\n".join(map(str, ["", decl_code] + supporting_decls))
             )
 
-            for fn_name in self._fns:
+            for fn_name in fn_names:
                 fn: lang.Function = self._fns[fn_name]
 
                 if fn.public:
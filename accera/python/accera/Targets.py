@@ -748,6 +748,25 @@ class TensorCoreInformationEntry:
 class TensorCoreInformation:
     entries: List[TensorCoreInformationEntry] = field(default_factory=list)
 
+    # CUDA caps a single thread at 255 32-bit registers and CDNA at 256 VGPRs, so use the
+    # common ceiling as the budget for the per-thread register estimates below.
+    PER_THREAD_REGISTER_BUDGET = 256
+
+    _ELEMENT_BYTES = {
+        ScalarType.int8: 1,
+        ScalarType.uint8: 1,
+        ScalarType.int16: 2,
+        ScalarType.uint16: 2,
+        ScalarType.float16: 2,
+        ScalarType.bfloat16: 2,
+        ScalarType.int32: 4,
+        ScalarType.uint32: 4,
+        ScalarType.float32: 4,
+        ScalarType.int64: 8,
+        ScalarType.uint64: 8,
+        ScalarType.float64: 8,
+    }
+
     def supports(
         self, input_type: ScalarType, output_type: ScalarType, shape: _MMAShape, num_total_passes: int,
         num_fused_passes: int
@@ -775,7 +794,8 @@ class TensorCoreInformation:
             _MMAShape.M32xN32xK4_B1: (32, 32, 4),
             _MMAShape.M16xN16xK8_B1: (16, 16, 8),
             _MMAShape.M32xN8xK16_B1: (32, 8, 16),
-            _MMAShape.M8xN32xK16_B1: (8, 32, 16)
+            _MMAShape.M8xN32xK16_B1: (8, 32, 16),
+            _MMAShape.M8xN8xK4_B1: (8, 8, 4)
         }[mma_shape]
 
     def compute_tensor_splits(self, mma_shape: _MMAShape, num_total_passes: int = 1):
@@ -784,6 +804,52 @@ class TensorCoreInformation:
         mutable_tensor_splits[2] *= num_total_passes
         return tuple(mutable_tensor_splits)
 
+    def compute_pass_group_registers(self, mma_shape: _MMAShape, num_fused_passes: int, warp_size: int):
+        """Estimate the 32-bit registers each thread holds live for one fused pass group:
+        one A and one B fragment per fused pass, plus the accumulator fragment shared by
+        all passes. The estimate uses the widest input/output types this target supports
+        for the shape, so it is conservative for narrower kernels."""
+        M, N, K = self.mma_shape_to_tuple(mma_shape)
+
+        in_bytes = max(
+            (self._ELEMENT_BYTES[entry.inType]
+             for entry in self.entries if entry.shape == mma_shape), default=4
+        )
+        out_bytes = max(
+            (self._ELEMENT_BYTES[entry.outType]
+             for entry in self.entries if entry.shape == mma_shape), default=4
+        )
+
+        def fragment_registers(elements, element_bytes):
+            elements_per_thread = -(-elements // warp_size)
+            return -(-elements_per_thread * element_bytes // 4)
+
+        input_registers = fragment_registers(M * K, in_bytes) + fragment_registers(K * N, in_bytes)
+        acc_registers = fragment_registers(M * N, out_bytes)
+        return input_registers * num_fused_passes + acc_registers
+
+    def validate_num_fused_passes(
+        self, mma_shape: _MMAShape, num_total_passes: int, num_fused_passes: int, warp_size: int
+    ):
+        """Validate num_fused_passes against the per-thread register budget, clamping it to
+        the largest divisor of num_total_passes whose pass group fits. Raises ValueError when
+        even a single pass exceeds the budget."""
+        requested = num_total_passes if num_fused_passes == -1 else num_fused_passes
+
+        fused = requested
+        while fused > 1 and self.compute_pass_group_registers(mma_shape, fused, warp_size) > self.PER_THREAD_REGISTER_BUDGET:
+            fused -= 1
+            while num_total_passes % fused != 0:
+                fused -= 1
+
+        registers = self.compute_pass_group_registers(mma_shape, fused, warp_size)
+        if registers > self.PER_THREAD_REGISTER_BUDGET:
+            raise ValueError(
+                f"Tensorizing with shape {mma_shape} requires an estimated {registers} registers per thread "
+                f"for a single pass, exceeding the target's budget of {self.PER_THREAD_REGISTER_BUDGET}."
+            )
+        return fused
+
 
 MI100_TENSORCORE_INFO = TensorCoreInformation([
     TensorCoreInformationEntry(shape=_MMAShape.M16xN16xK4_B1, inType=ScalarType.float32, outType=ScalarType.float32),    # maps to the 16x16x4 mfma instruction
@@ -820,6 +886,10 @@ MI100_TENSORCORE_INFO = TensorCoreInformation([
     TensorCoreInformationEntry(shape=_MMAShape.M64xN64xK2_B4, inType=ScalarType.bfloat16, outType=ScalarType.bfloat16),    # maps to the 16x16x2 mfma instruction
 ])
 
+MI200_TENSORCORE_INFO = TensorCoreInformation(MI100_TENSORCORE_INFO.entries + [
+    TensorCoreInformationEntry(shape=_MMAShape.M16xN16xK4_B1, inType=ScalarType.float64, outType=ScalarType.float64),    # maps to the 16x16x4 f64 mfma instruction
+])
+
 NV_A6000_TENSORCORE_INFO = TensorCoreInformation([
     TensorCoreInformationEntry(shape=_MMAShape.M16xN16xK16_B1, inType=ScalarType.float16, outType=ScalarType.float16),
     TensorCoreInformationEntry(shape=_MMAShape.M16xN16xK16_B1, inType=ScalarType.float16, outType=ScalarType.float32),
@@ -839,6 +909,10 @@ NV_A6000_TENSORCORE_INFO = TensorCoreInformation([
     TensorCoreInformationEntry(shape=_MMAShape.M16xN16xK8_B1, inType=ScalarType.float32, outType=ScalarType.float32),
 ])
 
+NV_A100_TENSORCORE_INFO = TensorCoreInformation(NV_A6000_TENSORCORE_INFO.entries + [
+    TensorCoreInformationEntry(shape=_MMAShape.M8xN8xK4_B1, inType=ScalarType.float64, outType=ScalarType.float64),    # maps to the 8x8x4 double wmma shape
+])
+
 # Tensor Cores is current unused
 KNOWN_GPUS_HEADER = [
     "Runtime", "Model", "Branding", "Family", "Cores", "MaxThreadsPerBlock", "MaxBlockSize", "MaxSharedMemoryPerBlock",
@@ -850,7 +924,10 @@ KNOWN_GPUS = [
      None],    # TODO : get the real values for the vector register sizes in bytes
     ["CUDA", "NVidia V100", "Volta", "sm70", 80, 1024, [1024, 1024, 64], 49152, 32, 1.380000, 65536, 0, None],
     # https://developer.nvidia.com/blog/nvidia-ampere-architecture-in-depth/
-    ["CUDA", "NVidia A100", "Ampere", "sm80", 108, 1024, [1024, 1024, 64], 49152, 32, 1.410000, 65536, 0, None],
+    [
+        "CUDA", "NVidia A100", "Ampere", "sm80", 108, 1024, [1024, 1024, 64], 49152, 32, 1.410000, 65536, 0,
+        NV_A100_TENSORCORE_INFO
+    ],
     [
         "CUDA", "NVidia RTX A6000", "Ampere", "sm86", 108, 1024, [1024, 1024, 64], 49152, 32, 1.410000, 65536, 0,
         NV_A6000_TENSORCORE_INFO
@@ -864,7 +941,10 @@ KNOWN_GPUS = [
         "ROCM", "AMD MI100", "Arcturus", "gfx908", 120, 1024, [1024, 1024, 1024], 65536, 64, 1.502000, 65536, 16,
         MI100_TENSORCORE_INFO
     ],
-    ["ROCM", "AMD MI200", "Aldebaran", "gfx90a", 220, 1024, [1024, 1024, 1024], 65536, 64, 1.700000, 65536, 0, None]
+    [
+        "ROCM", "AMD MI200", "Aldebaran", "gfx90a", 220, 1024, [1024, 1024, 1024], 65536, 64, 1.700000, 65536, 0,
+        MI200_TENSORCORE_INFO
+    ]
 ]
 # yapf: enable
 
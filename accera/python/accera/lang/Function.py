@@ -69,6 +69,7 @@ class Function:
     auxiliary: dict = field(default_factory=dict)
     target: Target = Target.HOST
     output_verifiers: list = field(default_factory=list)
+    debug_sample_interval: int = 1    # verify every Nth call in Package.Mode.DEBUG
 
     def __post_init__(self):
         # automatically fill if not specified
@@ -92,6 +93,9 @@ class Function:
             if self.output_verifiers:
                 self._native_fn.outputVerifiers(self.output_verifiers)
 
+            if self.debug_sample_interval > 1:
+                self._native_fn.debugSampleInterval(self.debug_sample_interval)
+
         self._native_fn.inlinable(not self.no_inline)
 
         sig = signature(self.definition)
@@ -24,6 +24,7 @@ from .Dimension import Dimension
 from .._lang_python._lang import (
     CacheIndexing,
     _MemorySpace,
+    _MMAFragmentOp,
     _MMASchedulingPolicy,
     _MMAShape,
     _CacheStrategy,
@@ -133,7 +134,10 @@ class Plan:
         indices: Union[LoopIndex, Tuple[LoopIndex], DelayedParameter],
         pin: Union[Tuple[Any], DelayedParameter] = None,
         policy: Union[str, DelayedParameter] = "static",
-        max_threads: Union[int, DelayedParameter] = None
+        max_threads: Union[int, DelayedParameter] = None,
+        reduction: Union[str, DelayedParameter] = None,
+        affinity: Union[str, DelayedParameter] = "compact",
+        chunk_size: Union[int, DelayedParameter] = 0
     ):
         """Executes one or more loops in parallel on multiple cores or processors.
         Only available for targets with multiple cores or processors.
@@ -147,23 +151,58 @@ class Plan:
                 will be assigned threads based on the number of split blocks.
                 This is limited by the number of threads supported by the target.
             pin: Pin the computation to a subset of cores or processors.
-            policy: The scheduling policy to apply ("dynamic" or "static").
+            policy: The scheduling policy to apply ("static", "dynamic", "work_stealing", or
+                "heterogeneous").
+                "work_stealing" hands out progressively smaller chunks as the space drains, so
+                threads that finish early pick up the remainder instead of idling at the tail of
+                a static partition.
+                "heterogeneous" targets hosts mixing performance and efficiency cores: work is
+                handed out in granules sized so each core class ends up with a share proportional
+                to its throughput, instead of an equal split that leaves P-cores waiting on
+                E-cores.
             max_threads: The maximum number of threads to use when distributing the workload.
+            reduction: The reduction operator ("sum", "max", or "min") applied along the
+                parallelized dimension, for parallelizing a dimension whose iterations
+                accumulate into the same locations (e.g. the K dimension of a GEMM).
+                Requires a single index. Each thread accumulates into a private copy of the
+                accumulators, which are combined when the parallel region joins.
+            affinity: How the threads are bound to cores ("compact" or "scatter").
+                "compact" keeps the threads on neighboring cores so they share caches;
+                "scatter" spreads them across the available places (e.g. one per NUMA node),
+                keeping each thread near the memory it first-touched.
+            chunk_size: The number of iterations handed to a thread at a time under the
+                "dynamic" policy. 0 lets the policy pick its own chunking. Pass a Parameter
+                to let the autotuning flow sweep this value per shape.
         """
         if self._target.category == Target.Category.CPU:
             self._dynamic_dependencies.add(LibraryDependency.OPENMP)
 
-        if any([isinstance(arg, DelayedParameter) for arg in [indices, pin, policy, max_threads]]):
+        if any([isinstance(arg, DelayedParameter) for arg in [indices, pin, policy, max_threads, reduction, affinity, chunk_size]]):
             self._delayed_calls[partial(self.parallelize)] = {
                 "indices": indices,
                 "pin": pin,
                 "policy": policy,
-                "max_threads": max_threads
+                "max_threads": max_threads,
+                "reduction": reduction,
+                "affinity": affinity,
+                "chunk_size": chunk_size
             }
             return None
 
         indices = [indices] if isinstance(indices, LoopIndex) else list(indices)
 
+        if reduction is not None:
+            if reduction not in ["sum", "max", "min"]:
+                raise ValueError('reduction must be one of "sum", "max", or "min"')
+            if len(indices) != 1:
+                raise ValueError("parallelizing a reduction requires a single index")
+
+        if affinity not in ["compact", "scatter"]:
+            raise ValueError('affinity must be one of "compact" or "scatter"')
+
+        if chunk_size < 0:
+            raise ValueError("chunk_size must be a non-negative integer")
+
         # ensure the indices are contiguous and follow the Schedule ordering
         start = self._sched._indices.index(indices[0])
         end = start + len(indices)
@@ -178,10 +217,10 @@ class Plan:
         for index in indices:
             self._add_index_attr(index, "parallelized")
 
-        self._commands.append(partial(self._parallelize, indices, policy, max_threads))
+        self._commands.append(partial(self._parallelize, indices, policy, max_threads, reduction, affinity, chunk_size))
 
-    def _parallelize(self, indices, policy, max_threads, context: NativeLoopNestContext):
-        from .._lang_python._lang import _ParallelizationPolicy
+    def _parallelize(self, indices, policy, max_threads, reduction, affinity, chunk_size, context: NativeLoopNestContext):
+        from .._lang_python._lang import _ParallelizationPolicy, _ParallelReduction, _ParallelAffinity
 
         if max_threads is None:
             max_threads = self._target.num_threads
@@ -194,14 +233,28 @@ class Plan:
 
         idxs = [context.mapping[id(index)] for index in indices]
 
-        context.plan.parallelize(
-            idxs,
-            num_threads,
-            _ParallelizationPolicy.DYNAMIC
-            if policy == "dynamic"
-            else _ParallelizationPolicy.STATIC,
+        native_policy = {
+            "static": _ParallelizationPolicy.STATIC,
+            "dynamic": _ParallelizationPolicy.DYNAMIC,
+            "work_stealing": _ParallelizationPolicy.WORK_STEALING,
+            "heterogeneous": _ParallelizationPolicy.HETEROGENEOUS,
+        }.get(policy, _ParallelizationPolicy.STATIC)
+        native_affinity = (
+            _ParallelAffinity.SCATTER
+            if affinity == "scatter"
+            else _ParallelAffinity.COMPACT
         )
 
+        if reduction is not None:
+            native_reduction = {
+                "sum": _ParallelReduction.SUM,
+                "max": _ParallelReduction.MAX,
+                "min": _ParallelReduction.MIN
+            }[reduction]
+            context.plan.parallelize_reduction(idxs[0], num_threads, native_policy, native_reduction, native_affinity, chunk_size)
+        else:
+            context.plan.parallelize(idxs, num_threads, native_policy, native_affinity, chunk_size)
+
     def tensorize(
         self,
         indices: Union[LoopIndex, Tuple[LoopIndex]],
@@ -211,6 +264,8 @@ class Plan:
         num_fused_passes: int = None,
         scheduling_policy: _MMASchedulingPolicy = _MMASchedulingPolicy.PASS_ORDER,
         _use_rocWMMA: bool = False,
+        pipeline_passes: bool = False,
+        epilogue_op: _MMAFragmentOp = _MMAFragmentOp.NONE,
     ):
         """Only available for targets with native matrix multiplication instruction (tensor core) support.
         Marks the dimensions of the iteration-space for tensorization.
@@ -228,6 +283,8 @@ class Plan:
             use_static_offsets: This is an optimization flag, which when enabled will use precomputed offset maps stored in device constant memory.
             num_fused_passes: This controls the number of passes for which register allocation is done, higher the value more the number of registers that are allocated.
             scheduling_policy: For multi-block MMA operations, this controls whether matrix multiplication is done block-by-block or pass-by-pass (affects register usage).
+            pipeline_passes: This is an optimization flag, which when enabled will issue fragment loads for the next pass group before the matrix ops of the current one (increases register usage).
+            epilogue_op: Elementwise op fused into the fragment store and applied to each output element while it is still in registers, avoiding a separate epilogue kernel and its global memory round trip.
         """
         if self._target.category != Target.Category.GPU:
             raise ValueError("tensorization currently only supported on GPU targets")
@@ -250,6 +307,8 @@ class Plan:
                 num_fused_passes,
                 scheduling_policy,
                 _use_rocWMMA,
+                pipeline_passes,
+                epilogue_op,
             )
         )
 
@@ -262,6 +321,8 @@ class Plan:
         num_fused_passes,
         scheduling_policy,
         _use_rocWMMA,
+        pipeline_passes,
+        epilogue_op,
         context: NativeLoopNestContext,
     ):
         if num_fused_passes is None:
@@ -345,6 +406,20 @@ class Plan:
                 mma_shape,
             )
 
+        # Clamp the pass group size so the fragment working set fits the per-thread
+        # register budget instead of silently spilling at runtime.
+        clamped_fused_passes = self._target.tensor_core_info.validate_num_fused_passes(
+            mma_shape, num_total_passes, num_fused_passes, self._target.warp_size
+        )
+        requested_fused_passes = num_total_passes if num_fused_passes == -1 else num_fused_passes
+        if clamped_fused_passes != requested_fused_passes:
+            logging.warning(
+                f"Fusing {requested_fused_passes} tensorization passes with shape {mma_shape} exceeds the "
+                f"target's per-thread register budget of {self._target.tensor_core_info.PER_THREAD_REGISTER_BUDGET}; "
+                f"clamping num_fused_passes to {clamped_fused_passes}"
+            )
+            num_fused_passes = clamped_fused_passes
+
         idxs = [context.mapping[id(index)] for index in indices]
 
         context.plan.tensorize(
@@ -355,6 +430,8 @@ class Plan:
             numFusedPasses=num_fused_passes,
             schedulingPolicy=scheduling_policy,
             _useRocWMMA=_use_rocWMMA,
+            pipelinePasses=pipeline_passes,
+            epilogueOp=epilogue_op,
         )
 
     def cache(
@@ -677,6 +754,7 @@ class Plan:
         wrapper_fn_name,
         packed_buffer_name="",
         indexing=CacheIndexing.GLOBAL_TO_PHYSICAL,
+        compress=False,
     ):
         """Emits a packing function for the given target and rewrites the loopnest to assume the given input is packed
 
@@ -686,6 +764,9 @@ class Plan:
             wrapper_fn_name: The name to give the wrapping function
             packed_buffer_name: The name to give the packed constant buffer
             indexing: The cache indexing
+            compress: Whether to store the embedded buffer zero-run-length compressed and emit a
+                "<packed_buffer_name>_initialize" function that must be called once to decompress
+                it before the wrapper function is used
         """
         # TODO: Make this work with multiple kernels, fused schedules
 
@@ -699,6 +780,7 @@ class Plan:
                 wrapper_fn_name,
                 packed_buffer_name,
                 indexing,
+                compress,
             )
         )
 
@@ -708,6 +790,8 @@ class Plan:
         packing_func_name,
         packed_buf_size_func_name,
         indexing=CacheIndexing.GLOBAL_TO_PHYSICAL,
+        num_threads=1,
+        vectorize=False,
     ):
         """Emits a packing function for the given target and rewrites the loopnest to assume the given input is packed
 
@@ -716,8 +800,15 @@ class Plan:
             packing_func_name: The name of the packing function to emit
             packed_buf_size_func_name: The name of the function giving the packed buffer size to emit
             indexing: The cache indexing
+            num_threads: The number of threads to parallelize the emitted packing function with (1 leaves it serial)
+            vectorize: Whether to vectorize the emitted packing function's copy loop for the plan's target
         """
         # TODO: Make this work with multiple kernels, fused schedules
+        if vectorize and not self._target.vectorization_info:
+            raise RuntimeError("The target does not support vectorization")
+
+        vectorization_info = self._target.vectorization_info if vectorize else None
+
         self._commands.append(
             partial(
                 self._emit_runtime_init_packing,
@@ -725,6 +816,8 @@ class Plan:
                 packing_func_name,
                 packed_buf_size_func_name,
                 indexing,
+                num_threads,
+                vectorization_info,
             )
         )
 
@@ -734,6 +827,7 @@ class Plan:
         wrapper_fn_name,
         packed_buffer_name,
         indexing,
+        compress,
         context: NativeLoopNestContext,
     ):
         constant_data_buffer = target
@@ -744,6 +838,7 @@ class Plan:
             wrapper_fn_name,
             packed_buffer_name,
             indexing,
+            compress,
         )
 
     def _emit_runtime_init_packing(
@@ -752,11 +847,13 @@ class Plan:
         packing_func_name,
         packed_buf_size_func_name,
         indexing,
+        num_threads,
+        vectorization_info,
         context: NativeLoopNestContext,
     ):
         target = context.mapping[id(target)]
         context.plan.emit_runtime_init_packing(
-            target, packing_func_name, packed_buf_size_func_name, indexing
+            target, packing_func_name, packed_buf_size_func_name, indexing, num_threads, vectorization_info
         )
 
     def bind(self, mapping: Mapping[Union[LoopIndex, Tuple[LoopIndex], DelayedParameter], Union[GridUnits, DelayedParameter]]):
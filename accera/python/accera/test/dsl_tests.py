@@ -2840,6 +2840,145 @@ class DSLTest_07PlansVectorizationParallelization(unittest.TestCase):
             # fully collapsed will result in correctness issues because parallelizing k can stomp on the C matrix
             # where multiple threads try to update C[i, j] for different values of k
 
+    def _make_gemm_plan(self, target):
+        A = Array(role=Array.Role.INPUT, shape=(256, 1024))
+        B = Array(role=Array.Role.INPUT, shape=(1024, 512))
+        C = Array(role=Array.Role.INPUT_OUTPUT, shape=(256, 512))
+
+        nest = Nest(shape=(256, 512, 1024))
+        i, j, k = nest.get_indices()
+
+        @nest.iteration_logic
+        def _():
+            C[i, j] += A[i, k] * B[k, j]
+
+        return nest.create_schedule(), (i, j, k), [A, B, C]
+
+    def test_parallelize_policies(self) -> None:
+        # work_stealing drains the tail of the space with progressively smaller chunks;
+        # heterogeneous partitions work proportionally to each core class's throughput
+        for policy in ["work_stealing", "heterogeneous"]:
+            target = Target("HOST", num_threads=16)
+            schedule, (i, j, k), args = self._make_gemm_plan(target)
+            plan = schedule.create_plan(target)
+            plan.parallelize(indices=i, policy=policy)
+            self._verify_plan(plan, args, f"test_parallelize_policy_{policy}")
+
+    def test_parallelize_affinity(self) -> None:
+        for affinity in ["compact", "scatter"]:
+            target = Target("HOST", num_threads=16)
+            schedule, (i, j, k), args = self._make_gemm_plan(target)
+            plan = schedule.create_plan(target)
+            plan.parallelize(indices=i, affinity=affinity)
+            self._verify_plan(plan, args, f"test_parallelize_affinity_{affinity}")
+
+        target = Target("HOST", num_threads=16)
+        schedule, (i, j, k), args = self._make_gemm_plan(target)
+        plan = schedule.create_plan(target)
+        with self.assertRaises(ValueError):
+            plan.parallelize(indices=i, affinity="spread")
+
+    def test_parallelize_chunk_size(self) -> None:
+        target = Target("HOST", num_threads=16)
+        schedule, (i, j, k), args = self._make_gemm_plan(target)
+        plan = schedule.create_plan(target)
+        plan.parallelize(indices=i, policy="dynamic", chunk_size=4)
+        self._verify_plan(plan, args, "test_parallelize_chunk_size")
+
+        plan_invalid = schedule.create_plan(target)
+        with self.assertRaises(ValueError):
+            plan_invalid.parallelize(indices=i, policy="dynamic", chunk_size=-1)
+
+    def test_parallelize_reduction(self) -> None:
+        # k accumulates into the same C[i, j] locations, so parallelizing it requires
+        # privatized accumulators combined at the join
+        for reduction in ["sum", "max", "min"]:
+            target = Target("HOST", num_threads=16)
+            schedule, (i, j, k), args = self._make_gemm_plan(target)
+            schedule.reorder(k, i, j)
+            plan = schedule.create_plan(target)
+            plan.parallelize(indices=k, reduction=reduction)
+            self._verify_plan(plan, args, f"test_parallelize_reduction_{reduction}")
+
+        target = Target("HOST", num_threads=16)
+        schedule, (i, j, k), args = self._make_gemm_plan(target)
+        plan = schedule.create_plan(target)
+        with self.assertRaises(ValueError):
+            plan.parallelize(indices=i, reduction="product")
+        with self.assertRaises(ValueError):
+            plan.parallelize(indices=(i, j), reduction="sum")
+
+    def test_nested_parallelize(self) -> None:
+        # separate parallelize calls compose into nested parallel regions with their own
+        # thread counts (e.g. sockets x cores) instead of collapsing into one flat region
+        target = Target("HOST", num_threads=16)
+        schedule, (i, j, k), args = self._make_gemm_plan(target)
+        plan = schedule.create_plan(target)
+        plan.parallelize(indices=i, max_threads=2)
+        plan.parallelize(indices=j, max_threads=4)
+        self._verify_plan(plan, args, "test_nested_parallelize")
+
+    def test_tensorize_pipeline_passes_and_epilogue(self) -> None:
+        from accera._lang_python._lang import _MMAShape, _MMAFragmentOp
+
+        M = N = K = 16
+
+        A = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(M, K))
+        B = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(K, N))
+        C = Array(role=Array.Role.INPUT_OUTPUT, element_type=ScalarType.float32, shape=(M, N))
+
+        nest = Nest(shape=(M, N, K))
+        i, j, k = nest.get_indices()
+
+        @nest.iteration_logic
+        def _():
+            C[i, j] += A[i, k] * B[k, j]
+
+        schedule = nest.create_schedule()
+        ii, jj = schedule.tile({
+            i: 16,
+            j: 16
+        })
+
+        mma_shape = _MMAShape.M16xN16xK4_B1
+        num_total_passes = 4
+        target = Target(Target.Model.AMD_MI100)
+        tensor_splits = target.tensor_core_info.compute_tensor_splits(mma_shape, num_total_passes)
+        iii, jjj, kk = schedule.tile({
+            ii: tensor_splits[0],
+            jj: tensor_splits[1],
+            k: tensor_splits[2]
+        })
+
+        plan, tensorization_indices = schedule._create_tensorizable_plan(
+            target,
+            block_indices=(i, j),
+            warp_indices=(ii, jj),
+            tensor_indices=(iii, jjj, kk),
+            outer_nest_order=(i, j, k, ii, jj),
+            mma_shape=mma_shape
+        )
+        plan.tensorize(
+            indices=tensorization_indices,
+            mma_shape=mma_shape,
+            num_total_passes=num_total_passes,
+            pipeline_passes=True,
+            epilogue_op=_MMAFragmentOp.RELU
+        )
+
+        package = Package()
+        package.add(plan, args=(A, B, C), base_name="tensorize_pipeline_epilogue_test")
+
+        package_name = "test_tensorize_pipeline_passes_and_epilogue"
+        output_dir = pathlib.Path(TEST_PACKAGE_DIR) / package_name
+        with verifiers.VerifyPackage(self, package_name, output_dir, file_list=[f"{package_name}.cu", f"{package_name}.hat"]):
+            package.build(
+                name=package_name,
+                format=Package.Format.MLIR | Package.Format.DEFAULT,
+                mode=Package.Mode.RELEASE,    # Package.Mode.DEBUG not supported on GPU targets
+                output_dir=output_dir
+            )
+
 
 class DSLTest_08DeferredLayout(unittest.TestCase):
     def _verify_package(self, plan, args, package_name, correctness_check_values) -> None:
@@ -133,6 +133,14 @@ Args:
         module.def("exp", &value::Exp);
         module.def("fast_exp", &value::FastExp);
         module.def("fast_exp_mlas", &value::FastExpMlas);
+        module.def("fast_log", [](value::Scalar s) { return value::FastLog(s); });
+        module.def("fast_log_relaxed", [](value::Scalar s) { return value::FastLog(s, value::FastMathAccuracy::Low); });
+        module.def("fast_tanh", [](value::Scalar s) { return value::FastTanh(s); });
+        module.def("fast_tanh_relaxed", [](value::Scalar s) { return value::FastTanh(s, value::FastMathAccuracy::Low); });
+        module.def("fast_sigmoid", [](value::Scalar s) { return value::FastSigmoid(s); });
+        module.def("fast_sigmoid_relaxed", [](value::Scalar s) { return value::FastSigmoid(s, value::FastMathAccuracy::Low); });
+        module.def("fast_erf", [](value::Scalar s) { return value::FastErf(s); });
+        module.def("fast_erf_relaxed", [](value::Scalar s) { return value::FastErf(s, value::FastMathAccuracy::Low); });
         module.def("log", &value::Log);
         module.def("log10", &value::Log10);
         module.def("log2", &value::Log2);
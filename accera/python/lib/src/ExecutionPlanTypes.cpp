@@ -58,7 +58,19 @@ namespace
 
         py::enum_<value::ParallelizationPolicy>(module, "_ParallelizationPolicy", "Used for configuring the thread scheduling policy")
             .value("STATIC", value::ParallelizationPolicy::Static)
-            .value("DYNAMIC", value::ParallelizationPolicy::Dynamic);
+            .value("DYNAMIC", value::ParallelizationPolicy::Dynamic)
+            .value("WORK_STEALING", value::ParallelizationPolicy::WorkStealing)
+            .value("HETEROGENEOUS", value::ParallelizationPolicy::Heterogeneous);
+
+        py::enum_<value::ParallelReduction>(module, "_ParallelReduction", "The reduction operator applied along a parallelized reduction dimension")
+            .value("NONE", value::ParallelReduction::None)
+            .value("SUM", value::ParallelReduction::Sum)
+            .value("MAX", value::ParallelReduction::Max)
+            .value("MIN", value::ParallelReduction::Min);
+
+        py::enum_<value::ParallelAffinity>(module, "_ParallelAffinity", "How the threads of a parallel region are bound to cores")
+            .value("COMPACT", value::ParallelAffinity::Compact)
+            .value("SCATTER", value::ParallelAffinity::Scatter);
 
         py::enum_<value::ExecutionRuntime>(module, "_ExecutionRuntime", "Used for specifying the execution runtime of the module")
             .value("DEFAULT", value::ExecutionRuntime::DEFAULT)
@@ -87,11 +99,17 @@ namespace
             .value("M32xN32xK8_B1", ir::value::MMAShape::M32xN32xK8_B1)
             .value("M16xN16xK16_B1", ir::value::MMAShape::M16xN16xK16_B1)
             .value("M32xN8xK16_B1", ir::value::MMAShape::M32xN8xK16_B1)
-            .value("M8xN32xK16_B1", ir::value::MMAShape::M8xN32xK16_B1);
+            .value("M8xN32xK16_B1", ir::value::MMAShape::M8xN32xK16_B1)
+            .value("M8xN8xK4_B1", ir::value::MMAShape::M8xN8xK4_B1)
+            .value("M16xN16xK64_B1", ir::value::MMAShape::M16xN16xK64_B1);
 
         py::enum_<ir::value::MMASchedulingPolicy>(module, "_MMASchedulingPolicy", "Used for configuring scheduling policy of MMA ops")
             .value("PASS_ORDER", ir::value::MMASchedulingPolicy::PassOrder)
             .value("BLOCK_ORDER", ir::value::MMASchedulingPolicy::BlockOrder);
+
+        py::enum_<ir::value::MMAFragmentOpType>(module, "_MMAFragmentOp", "Elementwise op applied to the accumulator fragment before the fragment store")
+            .value("NONE", ir::value::MMAFragmentOpType::None)
+            .value("RELU", ir::value::MMAFragmentOpType::ReLU);
     }
 
     void DefineExecutionPlanStructs(py::module& module)
@@ -194,10 +212,11 @@ namespace
                 "vectorization_info"_a,
                 "element_type"_a,
                 "strategy"_a)
-            .def("emit_runtime_init_packing", py::overload_cast<value::ViewAdapter, const std::string&, const std::string&, value::CacheIndexing>(&value::Plan::EmitRuntimeInitPacking), "target"_a, "packing_func_name"_a, "packed_buf_size_func_name"_a, "indexing"_a = value::CacheIndexing::GlobalToPhysical)
-            .def("pack_and_embed_buffer", py::overload_cast<value::ViewAdapter, value::ViewAdapter, const std::string&, const std::string&, value::CacheIndexing>(&value::Plan::PackAndEmbedBuffer), "target"_a, "constant_data_buffer"_a, "wrapper_fn_name"_a, "packed_buffer_name"_a, "indexing"_a = value::CacheIndexing::GlobalToPhysical)
+            .def("emit_runtime_init_packing", py::overload_cast<value::ViewAdapter, const std::string&, const std::string&, value::CacheIndexing, int64_t, const std::optional<value::VectorizationInformation>&>(&value::Plan::EmitRuntimeInitPacking), "target"_a, "packing_func_name"_a, "packed_buf_size_func_name"_a, "indexing"_a = value::CacheIndexing::GlobalToPhysical, "num_threads"_a = 1, "vectorization_info"_a = std::nullopt)
+            .def("pack_and_embed_buffer", py::overload_cast<value::ViewAdapter, value::ViewAdapter, const std::string&, const std::string&, value::CacheIndexing, bool>(&value::Plan::PackAndEmbedBuffer), "target"_a, "constant_data_buffer"_a, "wrapper_fn_name"_a, "packed_buffer_name"_a, "indexing"_a = value::CacheIndexing::GlobalToPhysical, "compress"_a = false)
             .def("vectorize", &value::Plan::Vectorize, "i"_a, "vectorization_info"_a)
-            .def("parallelize", &value::Plan::Parallelize, "indices"_a, "num_threads"_a, "policy"_a);
+            .def("parallelize", py::overload_cast<std::vector<value::ScalarIndex>, int64_t, value::ParallelizationPolicy, value::ParallelAffinity, int64_t>(&value::Plan::Parallelize), "indices"_a, "num_threads"_a, "policy"_a, "affinity"_a = value::ParallelAffinity::Compact, "chunk_size"_a = 0)
+            .def("parallelize_reduction", py::overload_cast<value::ScalarIndex, int64_t, value::ParallelizationPolicy, value::ParallelReduction, value::ParallelAffinity, int64_t>(&value::Plan::Parallelize), "index"_a, "num_threads"_a, "policy"_a, "reduction"_a, "affinity"_a = value::ParallelAffinity::Compact, "chunk_size"_a = 0);
 
         py::class_<value::GPUPlan>(module, "_GPUExecutionPlan")
             .def(py::init([](value::GPUPlan& plan) {
@@ -253,7 +272,7 @@ namespace
                 "vectorization_info"_a,
                 "element_type"_a,
                 "strategy"_a)
-            .def("tensorize", &value::GPUPlan::Tensorize, "indices"_a, "dims"_a, "numTotalPasses"_a, "useStaticOffsets"_a, "numFusedPasses"_a, "schedulingPolicy"_a, "_useRocWMMA"_a)
+            .def("tensorize", &value::GPUPlan::Tensorize, "indices"_a, "dims"_a, "numTotalPasses"_a, "useStaticOffsets"_a, "numFusedPasses"_a, "schedulingPolicy"_a, "_useRocWMMA"_a, "pipelinePasses"_a, "epilogueOp"_a = ir::value::MMAFragmentOpType::None)
             .def("_map_index_to_processor", &value::GPUPlan::MapIndicesToProcessor, "indices"_a, "proc"_a);
     }
 
@@ -61,6 +61,11 @@ ARM: fp16, neon, vfp3, d16, vfp4, hwdiv-arm, hwdiv
             .def_readwrite("position_independent_code", &value::CompilerOptions::positionIndependentCode, "Generate position independent code (equivalent to -fPIC).")
             .def_readwrite("profile", &value::CompilerOptions::profile, "Emit profiling code.")
             .def_readwrite("use_fast_math", &value::CompilerOptions::useFastMath, "Allow emitting more efficient code that isn't necessarily IEEE-754 compatible. Defaults to True")
+            .def_readwrite("llvm_optimization_level", &value::CompilerOptions::llvmOptimizationLevel, "Optimization level to run the LLVM opt and llc invocations at (0-3). Defaults to 3.")
+            .def_readwrite("llvm_unroll_threshold", &value::CompilerOptions::llvmUnrollThreshold, "Override LLVM's loop unrolling threshold. Unset uses the optimization level's default.")
+            .def_readwrite("llvm_loop_vectorize", &value::CompilerOptions::llvmLoopVectorize, "Force LLVM's loop vectorizer on or off. Unset uses the optimization level's default.")
+            .def_readwrite("llvm_target_cpu", &value::CompilerOptions::llvmTargetCpu, "Override the target cpu given to the LLVM backend. Unset derives it from the target device.")
+            .def_readwrite("llvm_target_features", &value::CompilerOptions::llvmTargetFeatures, "Override the target feature string given to the LLVM backend. Unset derives it from the target device.")
             .def_readwrite("include_diagnostic_info", &value::CompilerOptions::includeDiagnosticInfo, "Allow printing of diagnostic messages from the compiled model.")
             .def_readwrite("target_device", &value::CompilerOptions::targetDevice, "Name of the target device. Defaults to 'host'.")
             .def_readwrite("execution_runtime", &value::CompilerOptions::executionRuntime, "Target the specified runtime for execution.")
@@ -163,6 +168,7 @@ Args:
             .def("addTag", &value::FunctionDeclaration::AddTag, "addTag"_a, py::return_value_policy::reference_internal, "A tag to add to a function as an attribute.")
             .def("baseName", &value::FunctionDeclaration::BaseName, "baseName"_a, py::return_value_policy::reference_internal, "Sets the base name for this function to use as an alias in the generated header file.")
             .def("outputVerifiers", &value::FunctionDeclaration::OutputVerifiers, "outputVerifiers"_a, py::return_value_policy::reference_internal, "Sets the verification functions for output checking, one per output argument.")
+            .def("debugSampleInterval", &value::FunctionDeclaration::DebugSampleInterval, "interval"_a, py::return_value_policy::reference_internal, "Sets the invocation sampling interval for Debug mode verification (verify every Nth call).")
             .def(
                 "define", [](value::FunctionDeclaration& fn, std::function<std::optional<value::Value>(std::vector<value::Value>)> defFn) -> value::FunctionDeclaration& {
                     (void)fn.Define(defFn);
@@ -0,0 +1,27 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Async invocation support for a package's emitted functions. Work is enqueued onto a shared,
+//  lazily-created worker pool instead of spawning an OS thread per call, and each invocation
+//  returns a completion handle the caller can wait on, so independent kernels can overlap.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+/// Enqueues `fn(context)` onto the shared worker pool and returns a completion handle.
+/// The pool is created on first use with one worker per hardware thread.
+void* AcceraAsyncInvoke(void (*fn)(void* context), void* context);
+
+/// Blocks until the invocation identified by `handle` has finished, then releases the handle.
+/// Each handle must be waited on exactly once.
+void AcceraAsyncWait(void* handle);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
@@ -0,0 +1,33 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Recycling arena for heap-allocated cache buffers. Cache footprints are static per function,
+//  so blocks released at the end of one invocation are reused verbatim by the next instead of
+//  paying malloc/free and page-fault churn on every call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+/// Returns a 64-byte-aligned buffer of at least `sizeBytes` bytes, reusing a previously released
+/// block of the same size class when the calling thread's arena holds one.
+void* AcceraCacheArenaAllocate(int64_t sizeBytes);
+
+/// Returns a buffer obtained from AcceraCacheArenaAllocate to the arena so a later allocation can
+/// reuse it. The memory is kept by the arena rather than released back to the system.
+void AcceraCacheArenaFree(void* buffer);
+
+/// Releases every block held by the calling thread's arena back to the system. Buffers still in
+/// use are unaffected; only blocks waiting for reuse are freed.
+void AcceraCacheArenaRelease(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Per-thread event recorder that dumps chrome://tracing JSON. When the ACCERA_CHROME_TRACE
+//  environment variable names an output file, every profile-region enter/exit and every
+//  parallel-region chunk is appended to the recording thread's private stream, and the merged
+//  streams are written at process exit (or on an explicit write call). One flame view then shows
+//  which thread ran what and where cores idled, with Accera's own region names on the slices.
+//  With the variable unset every call is a cheap early-out, so the hooks can stay in
+//  production builds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+/// Records a begin event named `regionName` on the calling thread's stream.
+void AcceraProfileTraceEnter(const char* regionName);
+
+/// Records the matching end event on the calling thread's stream.
+void AcceraProfileTraceExit(const char* regionName);
+
+/// Merges every thread's stream and writes the chrome://tracing JSON to the file named by
+/// ACCERA_CHROME_TRACE. Runs automatically at process exit; calling it earlier snapshots the
+/// events recorded so far. A no-op when tracing is disabled.
+void AcceraProfileTraceWrite(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Cached CPU feature, cache-size, and core-topology queries. Generated dispatchers use the
+//  feature checks to pick between multiversioned function bodies, and the thread pool uses the
+//  topology queries to size itself; both need answers that are cheap enough to consult on every
+//  call, so everything here is detected once on first use and then served from a cached snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+/// Feature identifiers for AcceraCpuHasFeature. Features of other architectures simply report
+/// absent, so dispatch chains can be emitted without architecture ifdefs.
+enum
+{
+    ACCERA_CPU_FEATURE_SSE42 = 0,
+    ACCERA_CPU_FEATURE_AVX,
+    ACCERA_CPU_FEATURE_AVX2,
+    ACCERA_CPU_FEATURE_FMA,
+    ACCERA_CPU_FEATURE_AVX512F,
+    ACCERA_CPU_FEATURE_AVX512VNNI,
+    ACCERA_CPU_FEATURE_AVX512BF16,
+    ACCERA_CPU_FEATURE_AMX_INT8,
+    ACCERA_CPU_FEATURE_AMX_BF16,
+    ACCERA_CPU_FEATURE_NEON,
+    ACCERA_CPU_FEATURE_DOTPROD,
+    ACCERA_CPU_FEATURE_SVE,
+    ACCERA_CPU_FEATURE_COUNT
+};
+
+/// Returns nonzero when the host CPU (and, where relevant, the OS) supports the feature; vector
+/// features are only reported when the OS saves the corresponding register state.
+int AcceraCpuHasFeature(int feature);
+
+/// Returns nonzero when 512-bit vectors are advisable on this host. This is the single
+/// downclocking policy for every dispatcher: AVX-512 is used on cores that run it at full
+/// frequency (those exposing VNNI or BF16 — Ice Lake and later, Zen 4 and later) and avoided on
+/// earlier server parts where the license-based frequency drop usually costs more than the wider
+/// vectors recover.
+int AcceraCpuVector512Advisable(void);
+
+/// Returns the per-core data cache size in bytes for the given level (1, 2, or 3; level 3 is the
+/// shared last-level cache), or a conservative default when the level cannot be queried.
+int64_t AcceraCpuCacheSizeBytes(int level);
+
+/// Returns the data cache line size in bytes (typically 64).
+int AcceraCpuCacheLineBytes(void);
+
+/// Returns the number of logical processors visible to this process.
+int AcceraCpuNumLogicalCores(void);
+
+/// Returns the number of physical cores, counting each SMT sibling group once.
+int AcceraCpuNumPhysicalCores(void);
+
+/// Returns the number of performance cores on hybrid parts (e.g. recent Intel P/E designs); equal
+/// to the physical core count on homogeneous CPUs.
+int AcceraCpuNumPerformanceCores(void);
+
+/// Returns the number of NUMA nodes, or 1 when the system is not NUMA (or cannot be queried).
+int AcceraCpuNumNumaNodes(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
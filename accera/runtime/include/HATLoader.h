@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Native loader for built HAT packages. Maps the binary metadata sidecar emitted next to the
+//  package header (single mmap, offsets fixed up in place), loads the package's shared library,
+//  and resolves every declared entry point into a typed function table in one pass, so consumers
+//  don't reimplement dlopen-plus-header-parsing per product. Calls through the resolved function
+//  pointers have no added overhead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace accera
+{
+namespace runtime
+{
+    /// Element type codes, matching the binary metadata emitter in TranslateToHeader.cpp
+    enum class HATElementType : uint32_t
+    {
+        unknown = 0,
+        f16 = 1,
+        bf16 = 2,
+        f32 = 3,
+        f64 = 4,
+        i1 = 5,
+        i8 = 6,
+        i16 = 7,
+        i32 = 8,
+        i64 = 9,
+        index = 10
+    };
+
+    /// Describes one argument of a packaged function. For shaped arguments `shape` and `strides`
+    /// point at `rank` sizes and `rank` strides inside the mapped metadata (no copies are made);
+    /// they are null for scalar arguments.
+    struct HATArgumentInfo
+    {
+        HATElementType elementType = HATElementType::unknown;
+        uint32_t rank = 0;
+        const int64_t* shape = nullptr;
+        const int64_t* strides = nullptr;
+    };
+
+    /// Describes one entry point of a loaded package, with its resolved address.
+    struct HATFunctionInfo
+    {
+        std::string name;
+        std::string baseName; // empty when the function has no base-name alias
+        void* address = nullptr;
+        HATElementType returnType = HATElementType::unknown; // unknown for void functions
+        bool isRawPointerAPI = false;
+        bool isAsyncAPI = false;
+        std::vector<HATArgumentInfo> arguments;
+    };
+
+    /// A loaded HAT package: the mapped metadata, the loaded shared library, and the resolved
+    /// function table. Movable but not copyable; unmaps and unloads on destruction.
+    class HATPackage
+    {
+    public:
+        HATPackage() = default;
+        HATPackage(const HATPackage&) = delete;
+        HATPackage& operator=(const HATPackage&) = delete;
+        HATPackage(HATPackage&& other) noexcept;
+        HATPackage& operator=(HATPackage&& other) noexcept;
+        ~HATPackage();
+
+        /// Opens a package: maps the binary metadata file (the ".hat.bin" emitted next to the
+        /// package header), loads the shared library, and resolves every declared function.
+        /// Throws std::runtime_error on a missing or malformed metadata file, a library that
+        /// cannot be loaded, or an entry point that cannot be resolved.
+        static HATPackage Open(const std::string& metadataPath, const std::string& libraryPath);
+
+        /// The resolved function table, in metadata order.
+        const std::vector<HATFunctionInfo>& Functions() const { return _functions; }
+
+        /// Looks up a function by its name or base-name alias. Returns null when not present.
+        const HATFunctionInfo* FindFunction(const std::string& name) const;
+
+        /// Returns the entry point for `name` cast to the given function type, or null when the
+        /// function isn't present. The cast is unchecked; the argument records in
+        /// `FindFunction(name)->arguments` describe the expected signature.
+        template <typename FunctionType>
+        FunctionType* GetEntryPoint(const std::string& name) const
+        {
+            auto info = FindFunction(name);
+            return info ? reinterpret_cast<FunctionType*>(info->address) : nullptr;
+        }
+
+        /// Checks whether the host CPU supports the named features (e.g. "avx2", "fma",
+        /// "avx512f"), as listed in the package header's target description. Unrecognized feature
+        /// names and non-x86 hosts report true, leaving the decision to the caller.
+        static bool HostSupportsCpuFeatures(const std::vector<std::string>& features);
+
+    private:
+        void Reset();
+
+        void* _libraryHandle = nullptr;
+        const uint8_t* _metadata = nullptr;
+        uint64_t _metadataSize = 0;
+        bool _metadataIsMapped = false;
+        std::vector<HATFunctionInfo> _functions;
+        std::unordered_map<std::string, size_t> _functionIndex;
+    };
+
+} // namespace runtime
+} // namespace accera
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  PMU counter capture for profile regions. When the ACCERA_PMU_EVENTS environment variable
+//  names a comma-separated set of events (e.g. "cycles,instructions,cache-misses"), each
+//  thread opens a perf_event counter group on first use and enter/exit record per-region
+//  deltas into thread-local accumulators. With the variable unset (or on platforms without
+//  perf_event) every call is a cheap early-out, so the hooks can stay in production builds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+/// Snapshots the calling thread's counter group at entry to the given profile region.
+void AcceraProfileCountersEnter(int64_t regionId);
+
+/// Reads the counter group again and folds the deltas since the matching enter into the
+/// calling thread's accumulators for the region.
+void AcceraProfileCountersExit(int64_t regionId);
+
+/// Prints one "\t<event>=<total> ..." line for the region, summing the accumulators of every
+/// thread that has touched it. Prints nothing when counter capture is disabled.
+void AcceraProfileCountersPrint(int64_t regionId);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
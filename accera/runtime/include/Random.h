@@ -3,11 +3,16 @@
 //  Licensed under the MIT License. See LICENSE in the project root for license information.
 //  Authors: Mason Remy
 //
-//  Library for runtime utilities
+//  Library for runtime utilities. Besides the legacy stateful engine, this exposes a
+//  counter-based generator (Philox 4x32-10): every draw is a pure function of (seed, counter),
+//  so array fills split across threads without sharing state and kernels can draw per-element
+//  randomness inside a nest (dropout-style masks) without serializing on an engine.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #pragma once
 
+#include <stdint.h>
+
 #if defined(__cplusplus)
 extern "C" {
 #endif // defined(__cplusplus)
@@ -19,6 +24,22 @@ void GetNextRandomIntValue(int*, int lo, int hi);
 void GetNextNRandomValues(float* buffer, unsigned int N);
 void GetNextNRandomIntValues(int* buffer, int lo, int hi, unsigned int N);
 
+/// Returns the `counter`-th draw of the stream keyed by `seed` as a raw 32-bit word. Stateless
+/// and cheap enough to call per element, which makes it the emittable primitive for in-nest
+/// randomness: each iteration passes its own counter (e.g. the flattened element index).
+uint32_t AcceraRandomUint32(uint64_t seed, uint64_t counter);
+
+/// Returns the `counter`-th draw of the stream keyed by `seed`, mapped uniformly onto [lo, hi).
+float AcceraRandomUniformFloat(uint64_t seed, uint64_t counter, float lo, float hi);
+
+/// Fills buffer[0, count) with uniform floats in [lo, hi), where buffer[i] is draw `i` of the
+/// stream keyed by `seed`. The result is deterministic for a given seed regardless of thread
+/// count; large fills are split across the runtime's thread pool.
+void AcceraRandomFillUniformFloat(float* buffer, int64_t count, uint64_t seed, float lo, float hi);
+
+/// Fills buffer[0, count) with uniform integers in [lo, hi], deterministically as above.
+void AcceraRandomFillUniformInt(int32_t* buffer, int64_t count, uint64_t seed, int32_t lo, int32_t hi);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif // defined(__cplusplus)
@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Invocation-scoped bump allocator for a package's internal buffers. When a host opens a
+//  request scope, every internal allocation made on that thread (caches, TEMP arrays,
+//  dynamic-size results) bump-allocates out of a slab that is reclaimed wholesale at the end of
+//  the request, so a chain of package functions serving one request stops paying per-boundary
+//  malloc/free traffic, and peak RSS follows the request high-water mark instead of the sum of
+//  each function's transient footprint. Outside a scope every call degrades to plain heap
+//  allocation, so emitted code can route through these entry points unconditionally.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+/// Opens a request scope on the calling thread. Scopes nest; allocations are reclaimed when the
+/// outermost scope ends. The slab from the previous request is reused, so a steady-state server
+/// thread allocates from the system only while its high-water mark is still growing.
+void AcceraRequestBegin(void);
+
+/// Closes the current request scope. When the outermost scope ends, every request allocation made
+/// on this thread is reclaimed at once and the high-water statistics are updated.
+void AcceraRequestEnd(void);
+
+/// Returns a 64-byte-aligned buffer of at least `sizeBytes` bytes. Inside a request scope this is
+/// a bump-pointer increment; outside it falls back to the heap.
+void* AcceraRequestAllocate(int64_t sizeBytes);
+
+/// Releases a buffer obtained from AcceraRequestAllocate. Inside a request scope this is a no-op
+/// (the memory is reclaimed when the scope ends); heap fallback buffers are freed immediately.
+void AcceraRequestFree(void* buffer);
+
+/// Returns the high-water mark in bytes of the calling thread's current request, or of its most
+/// recently completed request when no scope is open.
+int64_t AcceraRequestHighWaterBytes(void);
+
+/// Returns the largest per-request high-water mark observed by any thread since process start;
+/// hosts use this to size pre-reserved slabs or to alert on footprint regressions.
+int64_t AcceraRequestPeakBytes(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
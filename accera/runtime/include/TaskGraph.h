@@ -0,0 +1,37 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Task-graph executor for running a package's emitted functions in pipeline-parallel fashion.
+//  Tasks declare the buffers they read and write; dependences are derived from read/write overlap
+//  (producer before consumer, writers ordered), and independent tasks run concurrently on a
+//  thread pool instead of serializing whole operators.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+typedef void (*AcceraTaskFunction)(void* context);
+
+/// Creates a task graph executed by `numThreads` worker threads (0 = hardware concurrency).
+void* AcceraTaskGraphCreate(int numThreads);
+
+/// Adds a task. `reads`/`writes` are the base pointers of the buffers the task accesses; a task is
+/// ordered after every earlier task whose writes overlap its reads or writes (RAW/WAW) or whose
+/// reads overlap its writes (WAR). Returns the task's id.
+int AcceraTaskGraphAddTask(void* graph, AcceraTaskFunction fn, void* context, const void** reads, int numReads, const void** writes, int numWrites);
+
+/// Runs all tasks, respecting the derived dependences, and blocks until every task has finished.
+/// The graph can be run again (e.g. for the next inference call) without being rebuilt.
+void AcceraTaskGraphRun(void* graph);
+
+/// Destroys the graph and joins its worker threads.
+void AcceraTaskGraphDestroy(void* graph);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
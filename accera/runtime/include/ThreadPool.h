@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Persistent thread pool for the runtime's parallel loops. The workers are created once, parked
+//  between calls, and reused across invocations, so short loops don't pay the fork/join startup
+//  cost of opening a fresh parallel region on each call.
+//
+//  Scope note: the pool currently backs the runtime's own utilities (AcceraRandomFill); parallel
+//  regions in emitted package functions (Plan::Parallelize) still lower to OpenMP, and routing
+//  that lowering through this pool is future work.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // defined(__cplusplus)
+
+/// Returns the number of worker threads in the process-wide pool (including the calling thread,
+/// which participates in parallel regions). The pool is created on first use.
+int AcceraThreadPoolNumThreads(void);
+
+/// Runs `fn(context, index)` for every index in [0, numIterations) across the pool's workers and
+/// returns when all iterations have finished. Iterations are handed out in chunks of `chunkSize`
+/// (0 = one contiguous chunk per worker); the calling thread works alongside the pool. Safe to
+/// call from multiple host threads; concurrent callers are serialized.
+void AcceraParallelFor(void (*fn)(void* context, int index), void* context, int numIterations, int chunkSize);
+
+/// Like AcceraParallelFor, but each thread claims chunks sized proportionally to its measured
+/// throughput, so on hosts mixing performance and efficiency cores every core class finishes its
+/// share at about the same time instead of the fast cores waiting on an equal partition. Each
+/// thread calibrates itself once (a few microseconds, on its first proportional region) and the
+/// measurement is reused for the life of the process.
+void AcceraParallelForProportional(void (*fn)(void* context, int index), void* context, int numIterations);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif // defined(__cplusplus)
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Library for runtime utilities
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Async.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct Completion
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+};
+
+struct WorkItem
+{
+    void (*fn)(void* context) = nullptr;
+    void* context = nullptr;
+    Completion* completion = nullptr;
+};
+
+// Shared worker pool, created on first use and joined at process exit. A single pool sized to the
+// hardware concurrency is used for every async invocation so overlapping kernels don't oversubscribe
+// the machine with one OS thread per call.
+class AsyncWorkerPool
+{
+public:
+    static AsyncWorkerPool& GetInstance()
+    {
+        static AsyncWorkerPool instance;
+        return instance;
+    }
+
+    void* Enqueue(void (*fn)(void* context), void* context)
+    {
+        auto completion = new Completion();
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            queue.push_back(WorkItem{ fn, context, completion });
+        }
+        queueCV.notify_one();
+        return completion;
+    }
+
+private:
+    AsyncWorkerPool()
+    {
+        auto numThreads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < numThreads; ++i)
+        {
+            workers.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ~AsyncWorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopped = true;
+        }
+        queueCV.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    void WorkerLoop()
+    {
+        for (;;)
+        {
+            WorkItem item;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                queueCV.wait(lock, [this] { return stopped || !queue.empty(); });
+                if (queue.empty())
+                {
+                    return; // stopped and drained
+                }
+                item = queue.front();
+                queue.pop_front();
+            }
+
+            item.fn(item.context);
+
+            {
+                std::lock_guard<std::mutex> lock(item.completion->mutex);
+                item.completion->done = true;
+            }
+            item.completion->cv.notify_all();
+        }
+    }
+
+    std::mutex queueMutex;
+    std::condition_variable queueCV;
+    std::deque<WorkItem> queue;
+    std::vector<std::thread> workers;
+    bool stopped = false;
+};
+
+} // namespace
+
+extern "C" void* AcceraAsyncInvoke(void (*fn)(void* context), void* context)
+{
+    return AsyncWorkerPool::GetInstance().Enqueue(fn, context);
+}
+
+extern "C" void AcceraAsyncWait(void* handle)
+{
+    auto completion = static_cast<Completion*>(handle);
+    {
+        std::unique_lock<std::mutex> lock(completion->mutex);
+        completion->cv.wait(lock, [completion] { return completion->done; });
+    }
+    delete completion;
+}
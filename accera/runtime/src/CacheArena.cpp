@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Library for runtime utilities
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CacheArena.h"
+
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+constexpr int64_t ArenaAlignment = 64;
+
+// Each block is over-allocated so the returned pointer can be aligned and carry a header just
+// below it recording the malloc'd base pointer and the block's size class
+struct BlockHeader
+{
+    void* basePointer;
+    int64_t sizeClass;
+};
+
+// Power-of-two size classes keep the bucket count small and let differently-sized caches with
+// similar footprints share blocks, while capping the rounding overhead at 2x
+int64_t RoundUpToSizeClass(int64_t sizeBytes)
+{
+    int64_t sizeClass = ArenaAlignment;
+    while (sizeClass < sizeBytes)
+    {
+        sizeClass <<= 1;
+    }
+    return sizeClass;
+}
+
+class CacheArena
+{
+public:
+    ~CacheArena()
+    {
+        Release();
+    }
+
+    void* Allocate(int64_t sizeBytes)
+    {
+        auto sizeClass = RoundUpToSizeClass(sizeBytes);
+        auto& bucket = _freeBlocks[sizeClass];
+        if (!bucket.empty())
+        {
+            void* buffer = bucket.back();
+            bucket.pop_back();
+            return buffer;
+        }
+
+        auto allocationSize = static_cast<size_t>(sizeClass + ArenaAlignment + sizeof(BlockHeader));
+        void* basePointer = std::malloc(allocationSize);
+        if (basePointer == nullptr)
+        {
+            return nullptr;
+        }
+        auto headerEnd = reinterpret_cast<uintptr_t>(basePointer) + sizeof(BlockHeader);
+        auto alignedAddress = (headerEnd + ArenaAlignment - 1) & ~static_cast<uintptr_t>(ArenaAlignment - 1);
+        auto* header = reinterpret_cast<BlockHeader*>(alignedAddress) - 1;
+        header->basePointer = basePointer;
+        header->sizeClass = sizeClass;
+        return reinterpret_cast<void*>(alignedAddress);
+    }
+
+    void Free(void* buffer)
+    {
+        if (buffer == nullptr)
+        {
+            return;
+        }
+        auto* header = reinterpret_cast<BlockHeader*>(buffer) - 1;
+        _freeBlocks[header->sizeClass].push_back(buffer);
+    }
+
+    void Release()
+    {
+        for (auto& [sizeClass, bucket] : _freeBlocks)
+        {
+            for (void* buffer : bucket)
+            {
+                std::free((reinterpret_cast<BlockHeader*>(buffer) - 1)->basePointer);
+            }
+        }
+        _freeBlocks.clear();
+    }
+
+private:
+    std::unordered_map<int64_t, std::vector<void*>> _freeBlocks;
+};
+
+// One arena per thread: a cache buffer is allocated and released within a single invocation on
+// the calling thread, so thread-local arenas keep the allocation path lock-free
+CacheArena& GetThreadArena()
+{
+    thread_local CacheArena arena;
+    return arena;
+}
+
+} // namespace
+
+extern "C" {
+
+void* AcceraCacheArenaAllocate(int64_t sizeBytes)
+{
+    return GetThreadArena().Allocate(sizeBytes);
+}
+
+void AcceraCacheArenaFree(void* buffer)
+{
+    GetThreadArena().Free(buffer);
+}
+
+void AcceraCacheArenaRelease(void)
+{
+    GetThreadArena().Release();
+}
+
+} // extern "C"
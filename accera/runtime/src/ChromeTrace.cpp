@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Library for runtime utilities
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ChromeTrace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct TraceEvent
+{
+    std::string name; // copied: the caller's string may not outlive the trace dump
+    double timestampUs;
+    bool isEnter;
+};
+
+// Each thread appends to its own stream without synchronization; the global registry of streams
+// is only locked when a thread records its first event and when the merged trace is written.
+// Streams are held by shared_ptr so they survive their thread exiting before the dump runs.
+struct ThreadStream
+{
+    int threadIndex;
+    std::vector<TraceEvent> events;
+};
+
+class TraceRecorder
+{
+public:
+    static TraceRecorder& GetInstance()
+    {
+        static TraceRecorder instance;
+        return instance;
+    }
+
+    // The output path is fixed for the life of the process, read once from ACCERA_CHROME_TRACE
+    const char* OutputPath()
+    {
+        static const char* path = [] {
+            const char* envValue = std::getenv("ACCERA_CHROME_TRACE");
+            if (envValue && envValue[0] != '\0')
+            {
+                std::atexit([] { AcceraProfileTraceWrite(); });
+                return envValue;
+            }
+            return static_cast<const char*>(nullptr);
+        }();
+        return path;
+    }
+
+    void Record(const char* name, bool isEnter)
+    {
+        auto& stream = GetThreadStream();
+        auto now = std::chrono::steady_clock::now();
+        auto timestampUs = std::chrono::duration<double, std::micro>(now - _startTime).count();
+        stream.events.push_back({ name, timestampUs, isEnter });
+    }
+
+    void Write()
+    {
+        auto path = OutputPath();
+        if (!path)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto file = std::fopen(path, "w");
+        if (!file)
+        {
+            return;
+        }
+        std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+        bool first = true;
+        for (const auto& stream : _streams)
+        {
+            std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"accera worker %d\"}}", first ? "" : ",\n", stream->threadIndex, stream->threadIndex);
+            first = false;
+            for (const auto& event : stream->events)
+            {
+                std::fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":0,\"tid\":%d}", Escaped(event.name).c_str(), event.isEnter ? "B" : "E", event.timestampUs, stream->threadIndex);
+            }
+        }
+        std::fputs("\n]}\n", file);
+        std::fclose(file);
+    }
+
+private:
+    TraceRecorder() :
+        _startTime(std::chrono::steady_clock::now())
+    {}
+
+    ThreadStream& GetThreadStream()
+    {
+        thread_local std::shared_ptr<ThreadStream> stream = [this] {
+            auto newStream = std::make_shared<ThreadStream>();
+            std::lock_guard<std::mutex> lock(_mutex);
+            newStream->threadIndex = static_cast<int>(_streams.size());
+            _streams.push_back(newStream);
+            return newStream;
+        }();
+        return *stream;
+    }
+
+    static std::string Escaped(const std::string& name)
+    {
+        std::string result;
+        result.reserve(name.size());
+        for (char c : name)
+        {
+            if (c == '"' || c == '\\')
+            {
+                result.push_back('\\');
+            }
+            result.push_back(c);
+        }
+        return result;
+    }
+
+    std::chrono::steady_clock::time_point _startTime;
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<ThreadStream>> _streams;
+};
+
+} // namespace
+
+extern "C" void AcceraProfileTraceEnter(const char* regionName)
+{
+    auto& recorder = TraceRecorder::GetInstance();
+    if (recorder.OutputPath())
+    {
+        recorder.Record(regionName, /*isEnter=*/true);
+    }
+}
+
+extern "C" void AcceraProfileTraceExit(const char* regionName)
+{
+    auto& recorder = TraceRecorder::GetInstance();
+    if (recorder.OutputPath())
+    {
+        recorder.Record(regionName, /*isEnter=*/false);
+    }
+}
+
+extern "C" void AcceraProfileTraceWrite(void)
+{
+    TraceRecorder::GetInstance().Write();
+}
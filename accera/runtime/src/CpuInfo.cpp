@@ -0,0 +1,345 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CpuInfo.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <set>
+#include <thread>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define ACCERA_CPUINFO_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <unistd.h>
+#endif
+
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+namespace
+{
+
+struct CpuSnapshot
+{
+    bool features[ACCERA_CPU_FEATURE_COUNT] = {};
+    int64_t cacheSizes[3] = { 32 * 1024, 1024 * 1024, 8 * 1024 * 1024 }; // conservative defaults
+    int cacheLineBytes = 64;
+    int numLogicalCores = 1;
+    int numPhysicalCores = 1;
+    int numPerformanceCores = 1;
+    int numNumaNodes = 1;
+};
+
+#if ACCERA_CPUINFO_X86
+void QueryCpuid(uint32_t leaf, uint32_t subleaf, uint32_t registers[4])
+{
+#if defined(_MSC_VER)
+    __cpuidex(reinterpret_cast<int*>(registers), static_cast<int>(leaf), static_cast<int>(subleaf));
+#else
+    __get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]);
+#endif
+}
+
+uint64_t QueryXcr0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+void DetectX86Features(CpuSnapshot& info)
+{
+    uint32_t regs[4];
+    QueryCpuid(0, 0, regs);
+    const uint32_t maxLeaf = regs[0];
+
+    QueryCpuid(1, 0, regs);
+    info.features[ACCERA_CPU_FEATURE_SSE42] = (regs[2] >> 20) & 1;
+    info.features[ACCERA_CPU_FEATURE_FMA] = (regs[2] >> 12) & 1;
+    const bool hasOsxsave = (regs[2] >> 27) & 1;
+    const bool hasAvxCpuid = (regs[2] >> 28) & 1;
+
+    // Vector features only count when the OS saves the corresponding register state
+    const uint64_t xcr0 = hasOsxsave ? QueryXcr0() : 0;
+    const bool osAvx = (xcr0 & 0x6) == 0x6; // XMM + YMM
+    const bool osAvx512 = (xcr0 & 0xe6) == 0xe6; // + opmask, ZMM hi
+    const bool osAmx = (xcr0 & 0x60000) == 0x60000; // TILECFG + TILEDATA
+
+    info.features[ACCERA_CPU_FEATURE_AVX] = hasAvxCpuid && osAvx;
+
+    if (maxLeaf >= 7)
+    {
+        QueryCpuid(7, 0, regs);
+        info.features[ACCERA_CPU_FEATURE_AVX2] = osAvx && ((regs[1] >> 5) & 1);
+        info.features[ACCERA_CPU_FEATURE_AVX512F] = osAvx512 && ((regs[1] >> 16) & 1);
+        info.features[ACCERA_CPU_FEATURE_AVX512VNNI] = osAvx512 && ((regs[2] >> 11) & 1);
+        info.features[ACCERA_CPU_FEATURE_AMX_BF16] = osAmx && ((regs[3] >> 22) & 1);
+        info.features[ACCERA_CPU_FEATURE_AMX_INT8] = osAmx && ((regs[3] >> 25) & 1);
+
+        QueryCpuid(7, 1, regs);
+        info.features[ACCERA_CPU_FEATURE_AVX512BF16] = osAvx512 && ((regs[0] >> 5) & 1);
+    }
+}
+#endif // ACCERA_CPUINFO_X86
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+void DetectArmFeatures(CpuSnapshot& info)
+{
+    info.features[ACCERA_CPU_FEATURE_NEON] = true; // baseline on AArch64
+#if defined(__linux__)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+#if defined(HWCAP_ASIMDDP)
+    info.features[ACCERA_CPU_FEATURE_DOTPROD] = (hwcap & HWCAP_ASIMDDP) != 0;
+#endif
+#if defined(HWCAP_SVE)
+    info.features[ACCERA_CPU_FEATURE_SVE] = (hwcap & HWCAP_SVE) != 0;
+#endif
+#elif defined(__APPLE__)
+    int value = 0;
+    size_t size = sizeof(value);
+    if (::sysctlbyname("hw.optional.arm.FEAT_DotProd", &value, &size, nullptr, 0) == 0)
+    {
+        info.features[ACCERA_CPU_FEATURE_DOTPROD] = value != 0;
+    }
+#endif
+}
+#endif // defined(__aarch64__) || defined(_M_ARM64)
+
+#if defined(__linux__)
+// Reads a small sysfs/procfs value file; returns defaultValue when absent (e.g. inside
+// containers with a restricted /sys)
+int64_t ReadValueFile(const char* path, int64_t defaultValue)
+{
+    FILE* file = std::fopen(path, "r");
+    if (!file)
+    {
+        return defaultValue;
+    }
+    long long value = defaultValue;
+    char suffix = '\0';
+    const int fields = std::fscanf(file, "%lld%c", &value, &suffix);
+    std::fclose(file);
+    if (fields < 1)
+    {
+        return defaultValue;
+    }
+    if (suffix == 'K')
+    {
+        value *= 1024; // cache "size" files report e.g. "512K"
+    }
+    else if (suffix == 'M')
+    {
+        value *= 1024 * 1024;
+    }
+    return value;
+}
+
+// Counts the cpus listed in a cpulist file like "0-7,16-23"; returns 0 when the file is absent
+int CountCpuListFile(const char* path)
+{
+    FILE* file = std::fopen(path, "r");
+    if (!file)
+    {
+        return 0;
+    }
+    int count = 0;
+    int first = 0, last = 0;
+    while (std::fscanf(file, "%d", &first) == 1)
+    {
+        last = first;
+        int ch = std::fgetc(file);
+        if (ch == '-' && std::fscanf(file, "%d", &last) != 1)
+        {
+            break;
+        }
+        count += last - first + 1;
+        if (ch != ',' && ch != '-')
+        {
+            break;
+        }
+        if (ch == '-' && std::fgetc(file) != ',')
+        {
+            break;
+        }
+    }
+    std::fclose(file);
+    return count;
+}
+
+void DetectLinuxCachesAndTopology(CpuSnapshot& info)
+{
+    const long lineSize = ::sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+    if (lineSize > 0)
+    {
+        info.cacheLineBytes = static_cast<int>(lineSize);
+    }
+    // cpu0's cache indices: index0 = L1d, index1 = L1i, index2 = L2, index3 = L3
+    info.cacheSizes[0] = ReadValueFile("/sys/devices/system/cpu/cpu0/cache/index0/size", info.cacheSizes[0]);
+    info.cacheSizes[1] = ReadValueFile("/sys/devices/system/cpu/cpu0/cache/index2/size", info.cacheSizes[1]);
+    info.cacheSizes[2] = ReadValueFile("/sys/devices/system/cpu/cpu0/cache/index3/size", info.cacheSizes[2]);
+
+    // Count each (package, core) pair once to fold SMT siblings together
+    std::set<std::pair<int64_t, int64_t>> physicalCores;
+    for (int cpu = 0; cpu < info.numLogicalCores; ++cpu)
+    {
+        char path[128];
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+        const int64_t packageId = ReadValueFile(path, 0);
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/core_id", cpu);
+        const int64_t coreId = ReadValueFile(path, cpu);
+        physicalCores.insert({ packageId, coreId });
+    }
+    if (!physicalCores.empty())
+    {
+        info.numPhysicalCores = static_cast<int>(physicalCores.size());
+    }
+
+    // Hybrid parts expose their P cores as a distinct cpu type; homogeneous ones lack the file
+    const int performanceCpus = CountCpuListFile("/sys/devices/cpu_core/cpus");
+    info.numPerformanceCores = performanceCpus > 0 ? std::min(performanceCpus, info.numPhysicalCores)
+                                                   : info.numPhysicalCores;
+
+    int numaNodes = 0;
+    for (;; ++numaNodes)
+    {
+        char path[64];
+        std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%d", numaNodes);
+        if (::access(path, F_OK) != 0)
+        {
+            break;
+        }
+    }
+    if (numaNodes > 0)
+    {
+        info.numNumaNodes = numaNodes;
+    }
+}
+#endif // defined(__linux__)
+
+#if defined(__APPLE__)
+void DetectAppleCachesAndTopology(CpuSnapshot& info)
+{
+    auto queryInt64 = [](const char* name, int64_t defaultValue) {
+        int64_t value = 0;
+        size_t size = sizeof(value);
+        return ::sysctlbyname(name, &value, &size, nullptr, 0) == 0 ? value : defaultValue;
+    };
+    info.cacheLineBytes = static_cast<int>(queryInt64("hw.cachelinesize", info.cacheLineBytes));
+    info.cacheSizes[0] = queryInt64("hw.l1dcachesize", info.cacheSizes[0]);
+    info.cacheSizes[1] = queryInt64("hw.l2cachesize", info.cacheSizes[1]);
+    info.cacheSizes[2] = queryInt64("hw.l3cachesize", info.cacheSizes[2]);
+    info.numPhysicalCores = static_cast<int>(queryInt64("hw.physicalcpu", info.numLogicalCores));
+    info.numPerformanceCores = static_cast<int>(queryInt64("hw.perflevel0.physicalcpu", info.numPhysicalCores));
+}
+#endif // defined(__APPLE__)
+
+CpuSnapshot DetectCpu()
+{
+    CpuSnapshot info;
+    info.numLogicalCores = static_cast<int>(std::thread::hardware_concurrency());
+    if (info.numLogicalCores < 1)
+    {
+        info.numLogicalCores = 1;
+    }
+    info.numPhysicalCores = info.numLogicalCores;
+    info.numPerformanceCores = info.numLogicalCores;
+
+#if ACCERA_CPUINFO_X86
+    DetectX86Features(info);
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    DetectArmFeatures(info);
+#endif
+#if defined(__linux__)
+    DetectLinuxCachesAndTopology(info);
+#elif defined(__APPLE__)
+    DetectAppleCachesAndTopology(info);
+#endif
+    return info;
+}
+
+// Detected once on first query; function-local static initialization is thread-safe, and every
+// subsequent call is a plain read so dispatchers can consult this on each invocation
+const CpuSnapshot& GetCpuSnapshot()
+{
+    static const CpuSnapshot info = DetectCpu();
+    return info;
+}
+
+} // namespace
+
+extern "C" {
+
+int AcceraCpuHasFeature(int feature)
+{
+    if (feature < 0 || feature >= ACCERA_CPU_FEATURE_COUNT)
+    {
+        return 0;
+    }
+    return GetCpuSnapshot().features[feature] ? 1 : 0;
+}
+
+int AcceraCpuVector512Advisable(void)
+{
+    // VNNI/BF16-capable cores (Ice Lake+, Zen 4+) run 512-bit vectors without the heavy
+    // license-based downclock of the first AVX-512 server generation
+    const auto& info = GetCpuSnapshot();
+    return (info.features[ACCERA_CPU_FEATURE_AVX512F] &&
+            (info.features[ACCERA_CPU_FEATURE_AVX512VNNI] || info.features[ACCERA_CPU_FEATURE_AVX512BF16]))
+               ? 1
+               : 0;
+}
+
+int64_t AcceraCpuCacheSizeBytes(int level)
+{
+    if (level < 1 || level > 3)
+    {
+        return 0;
+    }
+    return GetCpuSnapshot().cacheSizes[level - 1];
+}
+
+int AcceraCpuCacheLineBytes(void)
+{
+    return GetCpuSnapshot().cacheLineBytes;
+}
+
+int AcceraCpuNumLogicalCores(void)
+{
+    return GetCpuSnapshot().numLogicalCores;
+}
+
+int AcceraCpuNumPhysicalCores(void)
+{
+    return GetCpuSnapshot().numPhysicalCores;
+}
+
+int AcceraCpuNumPerformanceCores(void)
+{
+    return GetCpuSnapshot().numPerformanceCores;
+}
+
+int AcceraCpuNumNumaNodes(void)
+{
+    return GetCpuSnapshot().numNumaNodes;
+}
+
+} // extern "C"
@@ -0,0 +1,344 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "HATLoader.h"
+#include "HugePages.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <link.h>
+#endif // defined(__linux__)
+#endif // defined(_WIN32)
+
+namespace accera
+{
+namespace runtime
+{
+    namespace
+    {
+        // Binary metadata file layout, kept in sync with the emitter in
+        // accera/ir/src/TranslateToHeader.cpp
+        constexpr char kMagic[4] = { 'H', 'A', 'T', 'B' };
+        constexpr uint32_t kVersion = 1;
+        constexpr uint64_t kNoOffset = ~0ull;
+
+        struct FileHeader
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t headerSize;
+            uint32_t functionCount;
+            uint64_t functionTableOffset;
+            uint64_t argumentTableOffset;
+            uint64_t int64PoolOffset;
+            uint64_t stringTableOffset;
+            uint64_t totalSize;
+        };
+
+        struct FunctionRecord
+        {
+            uint64_t nameOffset;
+            uint64_t baseNameOffset; // kNoOffset when the function has no base name alias
+            uint32_t firstArgument; // index into the argument table
+            uint32_t argumentCount;
+            uint32_t returnTypeCode; // 0 for void
+            uint32_t flags; // bit 0: raw-pointer API, bit 1: async API
+        };
+
+        struct ArgumentRecord
+        {
+            uint32_t typeCode; // element type for shaped arguments
+            uint32_t rank; // 0 for scalars
+            uint64_t shapeOffset; // element offset of rank sizes followed by rank strides; kNoOffset for scalars
+        };
+
+        static_assert(sizeof(FileHeader) == 56, "unexpected padding in binary metadata file header");
+        static_assert(sizeof(FunctionRecord) == 32, "unexpected padding in binary metadata function record");
+        static_assert(sizeof(ArgumentRecord) == 16, "unexpected padding in binary metadata argument record");
+
+        [[noreturn]] void ThrowLoadError(const std::string& path, const std::string& reason)
+        {
+            throw std::runtime_error("Failed to load HAT package (" + path + "): " + reason);
+        }
+
+        // Maps (or, on Windows, reads) the metadata file. Returns the base pointer and size;
+        // `isMapped` reports whether the pointer must be munmap'd rather than delete[]'d.
+        const uint8_t* MapMetadataFile(const std::string& path, uint64_t& size, bool& isMapped)
+        {
+#if defined(_WIN32)
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file)
+            {
+                ThrowLoadError(path, "cannot open metadata file");
+            }
+            size = static_cast<uint64_t>(file.tellg());
+            auto buffer = new uint8_t[size];
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(size));
+            isMapped = false;
+            return buffer;
+#else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                ThrowLoadError(path, "cannot open metadata file");
+            }
+            struct stat fileInfo;
+            if (::fstat(fd, &fileInfo) != 0)
+            {
+                ::close(fd);
+                ThrowLoadError(path, "cannot stat metadata file");
+            }
+            size = static_cast<uint64_t>(fileInfo.st_size);
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd); // the mapping keeps its own reference
+            if (mapping == MAP_FAILED)
+            {
+                ThrowLoadError(path, "cannot map metadata file");
+            }
+            isMapped = true;
+            return static_cast<const uint8_t*>(mapping);
+#endif // defined(_WIN32)
+        }
+
+        void* LoadLibraryFile(const std::string& path)
+        {
+#if defined(_WIN32)
+            return ::LoadLibraryA(path.c_str());
+#else
+            // RTLD_NOW front-loads relocation work into the open so the resolved entry points
+            // never take a lazy-binding hit on first call
+            return ::dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif // defined(_WIN32)
+        }
+
+        // Packages built with PackAndEmbedBuffer carry their packed weights as data segments of
+        // the shared library; advise the kernel to back the large ones with transparent huge
+        // pages so walking multi-gigabyte weight buffers doesn't thrash the TLB. Best effort:
+        // failure just leaves the segments on ordinary pages.
+        void AdviseHugePagesForEmbeddedData(void* libraryHandle)
+        {
+#if defined(__linux__)
+            constexpr int64_t kHugePageSize = 2ll * 1024 * 1024;
+            struct link_map* map = nullptr;
+            if (::dlinfo(libraryHandle, RTLD_DI_LINKMAP, &map) != 0 || map == nullptr || map->l_addr == 0)
+            {
+                return;
+            }
+            const auto* elfHeader = reinterpret_cast<const ElfW(Ehdr)*>(map->l_addr);
+            const auto* programHeaders = reinterpret_cast<const ElfW(Phdr)*>(map->l_addr + elfHeader->e_phoff);
+            for (int segmentIdx = 0; segmentIdx < elfHeader->e_phnum; ++segmentIdx)
+            {
+                const auto& segment = programHeaders[segmentIdx];
+                // Segments smaller than a huge page can't be collapsed; skipping them also
+                // leaves code and ordinary data alone, since only embedded weights get this big
+                if (segment.p_type != PT_LOAD || static_cast<int64_t>(segment.p_memsz) < kHugePageSize)
+                {
+                    continue;
+                }
+                AcceraHugePageAdvise(reinterpret_cast<void*>(map->l_addr + segment.p_vaddr), static_cast<int64_t>(segment.p_memsz));
+            }
+#else
+            (void)libraryHandle;
+#endif // defined(__linux__)
+        }
+
+        void* ResolveSymbol(void* libraryHandle, const char* name)
+        {
+#if defined(_WIN32)
+            return reinterpret_cast<void*>(::GetProcAddress(static_cast<HMODULE>(libraryHandle), name));
+#else
+            return ::dlsym(libraryHandle, name);
+#endif // defined(_WIN32)
+        }
+    } // namespace
+
+    HATPackage::HATPackage(HATPackage&& other) noexcept :
+        _libraryHandle(std::exchange(other._libraryHandle, nullptr)),
+        _metadata(std::exchange(other._metadata, nullptr)),
+        _metadataSize(std::exchange(other._metadataSize, 0)),
+        _metadataIsMapped(std::exchange(other._metadataIsMapped, false)),
+        _functions(std::move(other._functions)),
+        _functionIndex(std::move(other._functionIndex))
+    {
+    }
+
+    HATPackage& HATPackage::operator=(HATPackage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            _libraryHandle = std::exchange(other._libraryHandle, nullptr);
+            _metadata = std::exchange(other._metadata, nullptr);
+            _metadataSize = std::exchange(other._metadataSize, 0);
+            _metadataIsMapped = std::exchange(other._metadataIsMapped, false);
+            _functions = std::move(other._functions);
+            _functionIndex = std::move(other._functionIndex);
+        }
+        return *this;
+    }
+
+    HATPackage::~HATPackage()
+    {
+        Reset();
+    }
+
+    void HATPackage::Reset()
+    {
+        if (_metadata != nullptr)
+        {
+#if defined(_WIN32)
+            delete[] _metadata;
+#else
+            if (_metadataIsMapped)
+            {
+                ::munmap(const_cast<uint8_t*>(_metadata), _metadataSize);
+            }
+#endif // defined(_WIN32)
+            _metadata = nullptr;
+            _metadataSize = 0;
+            _metadataIsMapped = false;
+        }
+        if (_libraryHandle != nullptr)
+        {
+#if defined(_WIN32)
+            ::FreeLibrary(static_cast<HMODULE>(_libraryHandle));
+#else
+            ::dlclose(_libraryHandle);
+#endif // defined(_WIN32)
+            _libraryHandle = nullptr;
+        }
+        _functions.clear();
+        _functionIndex.clear();
+    }
+
+    HATPackage HATPackage::Open(const std::string& metadataPath, const std::string& libraryPath)
+    {
+        HATPackage package;
+        package._metadata = MapMetadataFile(metadataPath, package._metadataSize, package._metadataIsMapped);
+
+        if (package._metadataSize < sizeof(FileHeader))
+        {
+            ThrowLoadError(metadataPath, "metadata file is truncated");
+        }
+        const auto* header = reinterpret_cast<const FileHeader*>(package._metadata);
+        if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 || header->version != kVersion)
+        {
+            ThrowLoadError(metadataPath, "unrecognized metadata format or version");
+        }
+        if (header->totalSize > package._metadataSize || header->stringTableOffset > header->totalSize)
+        {
+            ThrowLoadError(metadataPath, "metadata file is truncated");
+        }
+
+        const auto* functionTable = reinterpret_cast<const FunctionRecord*>(package._metadata + header->functionTableOffset);
+        const auto* argumentTable = reinterpret_cast<const ArgumentRecord*>(package._metadata + header->argumentTableOffset);
+        const auto* int64Pool = reinterpret_cast<const int64_t*>(package._metadata + header->int64PoolOffset);
+        const auto* stringTable = reinterpret_cast<const char*>(package._metadata + header->stringTableOffset);
+
+        package._libraryHandle = LoadLibraryFile(libraryPath);
+        if (package._libraryHandle == nullptr)
+        {
+            ThrowLoadError(libraryPath, "cannot load package library");
+        }
+        AdviseHugePagesForEmbeddedData(package._libraryHandle);
+
+        package._functions.reserve(header->functionCount);
+        for (uint32_t functionIdx = 0; functionIdx < header->functionCount; ++functionIdx)
+        {
+            const auto& record = functionTable[functionIdx];
+
+            HATFunctionInfo info;
+            info.name = stringTable + record.nameOffset;
+            if (record.baseNameOffset != kNoOffset)
+            {
+                info.baseName = stringTable + record.baseNameOffset;
+            }
+            info.returnType = static_cast<HATElementType>(record.returnTypeCode);
+            info.isRawPointerAPI = (record.flags & 1) != 0;
+            info.isAsyncAPI = (record.flags & 2) != 0;
+
+            info.address = ResolveSymbol(package._libraryHandle, info.name.c_str());
+            if (info.address == nullptr)
+            {
+                ThrowLoadError(libraryPath, "cannot resolve entry point '" + info.name + "'");
+            }
+
+            info.arguments.reserve(record.argumentCount);
+            for (uint32_t argIdx = 0; argIdx < record.argumentCount; ++argIdx)
+            {
+                const auto& argRecord = argumentTable[record.firstArgument + argIdx];
+                HATArgumentInfo argInfo;
+                argInfo.elementType = static_cast<HATElementType>(argRecord.typeCode);
+                argInfo.rank = argRecord.rank;
+                if (argRecord.shapeOffset != kNoOffset && argRecord.rank > 0)
+                {
+                    // Shape and strides stay zero-copy views into the mapped pool
+                    argInfo.shape = int64Pool + argRecord.shapeOffset;
+                    argInfo.strides = argInfo.shape + argRecord.rank;
+                }
+                info.arguments.push_back(argInfo);
+            }
+
+            package._functionIndex.emplace(info.name, package._functions.size());
+            if (!info.baseName.empty())
+            {
+                // Base-name aliases resolve to the first function declaring them, matching the
+                // declaration order in the package header
+                package._functionIndex.emplace(info.baseName, package._functions.size());
+            }
+            package._functions.push_back(std::move(info));
+        }
+
+        return package;
+    }
+
+    const HATFunctionInfo* HATPackage::FindFunction(const std::string& name) const
+    {
+        auto it = _functionIndex.find(name);
+        return it != _functionIndex.end() ? &_functions[it->second] : nullptr;
+    }
+
+    bool HATPackage::HostSupportsCpuFeatures(const std::vector<std::string>& features)
+    {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        for (const auto& feature : features)
+        {
+            bool supported = true;
+            if (feature == "sse4.1") supported = __builtin_cpu_supports("sse4.1");
+            else if (feature == "sse4.2") supported = __builtin_cpu_supports("sse4.2");
+            else if (feature == "avx") supported = __builtin_cpu_supports("avx");
+            else if (feature == "avx2") supported = __builtin_cpu_supports("avx2");
+            else if (feature == "fma") supported = __builtin_cpu_supports("fma");
+            else if (feature == "avx512f") supported = __builtin_cpu_supports("avx512f");
+            else if (feature == "avx512bw") supported = __builtin_cpu_supports("avx512bw");
+            else if (feature == "avx512dq") supported = __builtin_cpu_supports("avx512dq");
+            else if (feature == "avx512vl") supported = __builtin_cpu_supports("avx512vl");
+            // Unrecognized feature names report supported; the caller sees the full list and can
+            // apply stricter policy if needed
+            if (!supported)
+            {
+                return false;
+            }
+        }
+#endif
+        return true;
+    }
+
+} // namespace runtime
+} // namespace accera
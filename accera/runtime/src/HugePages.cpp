@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "HugePages.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+#if !defined(MAP_HUGE_2MB)
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#if !defined(MAP_HUGE_1GB)
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+#endif // defined(__linux__)
+
+namespace
+{
+
+constexpr int64_t kHugePageSize = 2ll * 1024 * 1024;
+constexpr int64_t kGiantPageSize = 1024ll * 1024 * 1024;
+
+int64_t RoundUpTo(int64_t value, int64_t multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+enum class BackingKind
+{
+    mapped, // mmap'd (explicit huge pages or madvise'd ordinary pages); released with munmap
+    heap // malloc fallback; released with free
+};
+
+struct AllocationRecord
+{
+    void* basePointer; // the pointer the system gave us (the heap fallback over-allocates to align)
+    int64_t mappedSize;
+    BackingKind kind;
+};
+
+// Huge-page buffers are long-lived (packed weights typically persist for the process lifetime),
+// so allocation and release are rare enough that a single locked registry is not a bottleneck
+std::mutex& RegistryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_map<void*, AllocationRecord>& Registry()
+{
+    static std::unordered_map<void*, AllocationRecord> registry;
+    return registry;
+}
+
+void RecordAllocation(void* buffer, void* basePointer, int64_t mappedSize, BackingKind kind)
+{
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    Registry()[buffer] = AllocationRecord{ basePointer, mappedSize, kind };
+}
+
+#if defined(__linux__)
+void* TryExplicitHugePageMap(int64_t sizeBytes, int64_t pageSize, int pageSizeFlag)
+{
+    auto mappedSize = RoundUpTo(sizeBytes, pageSize);
+    void* mapping = ::mmap(nullptr, static_cast<size_t>(mappedSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | pageSizeFlag, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    RecordAllocation(mapping, mapping, mappedSize, BackingKind::mapped);
+    return mapping;
+}
+
+void* TryTransparentHugePageMap(int64_t sizeBytes)
+{
+    // An anonymous mapping is only 4KB-aligned, and the kernel collapses transparent huge pages
+    // on 2MB-aligned interiors only, so over-map and trim the head and tail to a 2MB boundary
+    auto mappedSize = RoundUpTo(sizeBytes, kHugePageSize);
+    auto overmapSize = mappedSize + kHugePageSize;
+    void* mapping = ::mmap(nullptr, static_cast<size_t>(overmapSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    auto base = reinterpret_cast<uintptr_t>(mapping);
+    auto aligned = RoundUpTo(static_cast<int64_t>(base), kHugePageSize);
+    if (aligned != static_cast<int64_t>(base))
+    {
+        ::munmap(mapping, static_cast<size_t>(aligned - static_cast<int64_t>(base)));
+    }
+    auto tail = static_cast<int64_t>(base) + overmapSize - (aligned + mappedSize);
+    if (tail > 0)
+    {
+        ::munmap(reinterpret_cast<void*>(aligned + mappedSize), static_cast<size_t>(tail));
+    }
+    void* buffer = reinterpret_cast<void*>(aligned);
+    // Advisory only; the mapping is usable either way
+    ::madvise(buffer, static_cast<size_t>(mappedSize), MADV_HUGEPAGE);
+    RecordAllocation(buffer, buffer, mappedSize, BackingKind::mapped);
+    return buffer;
+}
+#endif // defined(__linux__)
+
+void* HeapFallbackAllocate(int64_t sizeBytes)
+{
+    // Preserve the 2MB alignment contract even without huge pages, so generated code that
+    // assumes a huge-page-aligned base stays correct
+    auto allocationSize = static_cast<size_t>(sizeBytes + kHugePageSize);
+    void* basePointer = std::malloc(allocationSize);
+    if (basePointer == nullptr)
+    {
+        return nullptr;
+    }
+    auto aligned = RoundUpTo(static_cast<int64_t>(reinterpret_cast<uintptr_t>(basePointer)), kHugePageSize);
+    void* buffer = reinterpret_cast<void*>(aligned);
+    RecordAllocation(buffer, basePointer, static_cast<int64_t>(allocationSize), BackingKind::heap);
+    return buffer;
+}
+
+} // namespace
+
+extern "C" {
+
+void* AcceraHugePageAllocate(int64_t sizeBytes)
+{
+    if (sizeBytes <= 0)
+    {
+        return nullptr;
+    }
+
+#if defined(__linux__)
+    // Gigabyte-scale buffers get 1GB pages when the system has them reserved; everything else
+    // (and the 1GB fallback) tries 2MB pages, then transparent huge pages over ordinary pages
+    if (sizeBytes >= kGiantPageSize)
+    {
+        if (void* buffer = TryExplicitHugePageMap(sizeBytes, kGiantPageSize, MAP_HUGE_1GB))
+        {
+            return buffer;
+        }
+    }
+    if (void* buffer = TryExplicitHugePageMap(sizeBytes, kHugePageSize, MAP_HUGE_2MB))
+    {
+        return buffer;
+    }
+    if (void* buffer = TryTransparentHugePageMap(sizeBytes))
+    {
+        return buffer;
+    }
+#endif // defined(__linux__)
+
+    return HeapFallbackAllocate(sizeBytes);
+}
+
+void AcceraHugePageFree(void* buffer)
+{
+    if (buffer == nullptr)
+    {
+        return;
+    }
+
+    AllocationRecord record;
+    {
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        auto it = Registry().find(buffer);
+        if (it == Registry().end())
+        {
+            return;
+        }
+        record = it->second;
+        Registry().erase(it);
+    }
+
+    switch (record.kind)
+    {
+    case BackingKind::mapped:
+#if defined(__linux__)
+        ::munmap(record.basePointer, static_cast<size_t>(record.mappedSize));
+#endif // defined(__linux__)
+        break;
+    case BackingKind::heap:
+        std::free(record.basePointer);
+        break;
+    }
+}
+
+void AcceraHugePageAdvise(void* data, int64_t sizeBytes)
+{
+#if defined(__linux__)
+    if (data == nullptr || sizeBytes <= 0)
+    {
+        return;
+    }
+    auto pageSize = static_cast<int64_t>(::sysconf(_SC_PAGESIZE));
+    auto begin = RoundUpTo(static_cast<int64_t>(reinterpret_cast<uintptr_t>(data)), pageSize);
+    auto end = (static_cast<int64_t>(reinterpret_cast<uintptr_t>(data)) + sizeBytes) / pageSize * pageSize;
+    if (end > begin)
+    {
+        // Best effort: a kernel without transparent huge pages just rejects the advice
+        ::madvise(reinterpret_cast<void*>(begin), static_cast<size_t>(end - begin), MADV_HUGEPAGE);
+    }
+#else
+    (void)data;
+    (void)sizeBytes;
+#endif // defined(__linux__)
+}
+
+} // extern "C"
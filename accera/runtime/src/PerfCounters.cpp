@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Library for runtime utilities
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PerfCounters.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+namespace
+{
+
+#if defined(__linux__)
+
+struct EventSpec
+{
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+};
+
+// The portable perf_event generalized events; anything more exotic should go through a raw
+// event code, which can be added here if the need arises
+const EventSpec KnownEvents[] = {
+    { "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { "cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES },
+    { "cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { "branches", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+    { "branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { "stalled-cycles-frontend", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND },
+    { "stalled-cycles-backend", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND },
+    { "page-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+    { "context-switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES },
+};
+
+// The event set is fixed for the life of the process, parsed once from ACCERA_PMU_EVENTS
+const std::vector<const EventSpec*>& GetRequestedEvents()
+{
+    static const std::vector<const EventSpec*> events = [] {
+        std::vector<const EventSpec*> result;
+        const char* envValue = std::getenv("ACCERA_PMU_EVENTS");
+        if (!envValue)
+        {
+            return result;
+        }
+        std::string eventList(envValue);
+        size_t pos = 0;
+        while (pos < eventList.size())
+        {
+            auto end = eventList.find(',', pos);
+            if (end == std::string::npos)
+            {
+                end = eventList.size();
+            }
+            auto name = eventList.substr(pos, end - pos);
+            bool found = false;
+            for (const auto& known : KnownEvents)
+            {
+                if (name == known.name)
+                {
+                    result.push_back(&known);
+                    found = true;
+                    break;
+                }
+            }
+            if (!found && !name.empty())
+            {
+                std::fprintf(stderr, "ACCERA_PMU_EVENTS: unknown event '%s' ignored\n", name.c_str());
+            }
+            pos = end + 1;
+        }
+        return result;
+    }();
+    return events;
+}
+
+// Per-region accumulated deltas, one vector entry per requested event
+struct RegionTotals
+{
+    std::vector<uint64_t> totals;
+};
+
+using RegionTotalsMap = std::unordered_map<int64_t, RegionTotals>;
+
+// Registry of every thread's accumulator map, so the print path can sum across threads. The
+// mutex guards registration and printing only; enter/exit touch nothing but thread-local state.
+std::mutex& GetRegistryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<std::shared_ptr<RegionTotalsMap>>& GetRegistry()
+{
+    static std::vector<std::shared_ptr<RegionTotalsMap>> registry;
+    return registry;
+}
+
+// One perf_event group per thread: the group leader is the first event, and a single read()
+// returns all counters coherently
+class ThreadCounterGroup
+{
+public:
+    ThreadCounterGroup()
+    {
+        const auto& events = GetRequestedEvents();
+        for (const auto* event : events)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = event->type;
+            attr.config = event->config;
+            attr.disabled = _fds.empty() ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+
+            int groupFd = _fds.empty() ? -1 : _fds[0];
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0 /* this thread */, -1 /* any cpu */, groupFd, 0));
+            if (fd < 0)
+            {
+                std::fprintf(stderr, "perf_event_open failed for '%s'; PMU capture disabled on this thread\n", event->name);
+                Close();
+                return;
+            }
+            _fds.push_back(fd);
+        }
+
+        if (!_fds.empty())
+        {
+            ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+
+        _regionTotals = std::make_shared<RegionTotalsMap>();
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+        GetRegistry().push_back(_regionTotals);
+    }
+
+    ~ThreadCounterGroup()
+    {
+        Close();
+    }
+
+    bool IsActive() const { return !_fds.empty(); }
+
+    bool Read(std::vector<uint64_t>& values)
+    {
+        // read_format = GROUP: { u64 nr; u64 values[nr]; }
+        const auto numEvents = _fds.size();
+        std::vector<uint64_t> buffer(1 + numEvents);
+        auto bytes = read(_fds[0], buffer.data(), buffer.size() * sizeof(uint64_t));
+        if (bytes < 0 || buffer[0] != numEvents)
+        {
+            return false;
+        }
+        values.assign(buffer.begin() + 1, buffer.end());
+        return true;
+    }
+
+    void Enter(int64_t regionId)
+    {
+        if (!IsActive())
+        {
+            return;
+        }
+        auto& start = _regionStarts[regionId];
+        Read(start);
+    }
+
+    void Exit(int64_t regionId)
+    {
+        if (!IsActive())
+        {
+            return;
+        }
+        auto startIt = _regionStarts.find(regionId);
+        if (startIt == _regionStarts.end() || startIt->second.empty())
+        {
+            return;
+        }
+
+        std::vector<uint64_t> current;
+        if (!Read(current))
+        {
+            return;
+        }
+
+        auto& totals = (*_regionTotals)[regionId].totals;
+        totals.resize(current.size(), 0);
+        for (size_t i = 0; i < current.size(); ++i)
+        {
+            totals[i] += current[i] - startIt->second[i];
+        }
+    }
+
+private:
+    void Close()
+    {
+        for (auto fd : _fds)
+        {
+            close(fd);
+        }
+        _fds.clear();
+    }
+
+    std::vector<int> _fds;
+    std::unordered_map<int64_t, std::vector<uint64_t>> _regionStarts;
+    std::shared_ptr<RegionTotalsMap> _regionTotals;
+};
+
+ThreadCounterGroup& GetThreadCounterGroup()
+{
+    thread_local ThreadCounterGroup group;
+    return group;
+}
+
+bool CaptureEnabled()
+{
+    return !GetRequestedEvents().empty();
+}
+
+#endif // defined(__linux__)
+
+} // namespace
+
+void AcceraProfileCountersEnter(int64_t regionId)
+{
+#if defined(__linux__)
+    if (!CaptureEnabled())
+    {
+        return;
+    }
+    GetThreadCounterGroup().Enter(regionId);
+#else
+    (void)regionId;
+#endif // defined(__linux__)
+}
+
+void AcceraProfileCountersExit(int64_t regionId)
+{
+#if defined(__linux__)
+    if (!CaptureEnabled())
+    {
+        return;
+    }
+    GetThreadCounterGroup().Exit(regionId);
+#else
+    (void)regionId;
+#endif // defined(__linux__)
+}
+
+void AcceraProfileCountersPrint(int64_t regionId)
+{
+#if defined(__linux__)
+    if (!CaptureEnabled())
+    {
+        return;
+    }
+
+    const auto& events = GetRequestedEvents();
+    std::vector<uint64_t> totals(events.size(), 0);
+    {
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+        for (const auto& threadTotals : GetRegistry())
+        {
+            auto it = threadTotals->find(regionId);
+            if (it == threadTotals->end())
+            {
+                continue;
+            }
+            for (size_t i = 0; i < it->second.totals.size() && i < totals.size(); ++i)
+            {
+                totals[i] += it->second.totals[i];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        std::printf("\t%s=%llu", events[i]->name, static_cast<unsigned long long>(totals[i]));
+    }
+    std::printf("\n");
+#else
+    (void)regionId;
+#endif // defined(__linux__)
+}
@@ -8,6 +8,9 @@
 
 #include "Random.h"
 
+#include "ThreadPool.h"
+
+#include <algorithm>
 #include <random>
 
 static std::default_random_engine RandomEngine;
@@ -46,3 +49,137 @@ void ResetRandomEngine(unsigned int seed)
 {
     RandomEngine.seed(seed);
 }
+
+//
+// Counter-based generation (Philox 4x32-10). Each 64-bit block index produces four independent
+// 32-bit words from integer multiplies and xors only, so the per-block loop below vectorizes and
+// disjoint index ranges can be filled concurrently without any shared state.
+//
+
+namespace
+{
+
+struct PhiloxBlock
+{
+    uint32_t word[4];
+};
+
+PhiloxBlock PhiloxBlockAt(uint64_t seed, uint64_t blockIndex)
+{
+    uint32_t counter0 = static_cast<uint32_t>(blockIndex);
+    uint32_t counter1 = static_cast<uint32_t>(blockIndex >> 32);
+    uint32_t counter2 = 0;
+    uint32_t counter3 = 0;
+    uint32_t key0 = static_cast<uint32_t>(seed);
+    uint32_t key1 = static_cast<uint32_t>(seed >> 32);
+
+    for (int round = 0; round < 10; ++round)
+    {
+        const uint64_t product0 = 0xD2511F53ull * counter0;
+        const uint64_t product1 = 0xCD9E8D57ull * counter2;
+        const uint32_t high0 = static_cast<uint32_t>(product0 >> 32);
+        const uint32_t low0 = static_cast<uint32_t>(product0);
+        const uint32_t high1 = static_cast<uint32_t>(product1 >> 32);
+        const uint32_t low1 = static_cast<uint32_t>(product1);
+
+        counter0 = high1 ^ counter1 ^ key0;
+        counter1 = low1;
+        counter2 = high0 ^ counter3 ^ key1;
+        counter3 = low0;
+
+        key0 += 0x9E3779B9; // golden ratio
+        key1 += 0xBB67AE85; // sqrt(3) - 1
+    }
+
+    return PhiloxBlock{ { counter0, counter1, counter2, counter3 } };
+}
+
+float UniformFloatFromWord(uint32_t word, float lo, float hi)
+{
+    // The top 24 bits map exactly onto a float mantissa, giving a uniform value in [0, 1)
+    const float unit = static_cast<float>(word >> 8) * 0x1.0p-24f;
+    return lo + unit * (hi - lo);
+}
+
+// Each fill task covers a contiguous run of whole Philox blocks, so the output is identical no
+// matter how the tasks are distributed across threads
+constexpr int64_t kFillElementsPerTask = 1 << 18;
+
+template <typename ElementFn>
+void FillDeterministic(int64_t count, ElementFn&& writeBlock)
+{
+    const int64_t numBlocks = (count + 3) / 4;
+    const int64_t blocksPerTask = kFillElementsPerTask / 4;
+    const int64_t numTasks = (numBlocks + blocksPerTask - 1) / blocksPerTask;
+
+    auto runTask = [&](int64_t task) {
+        const int64_t firstBlock = task * blocksPerTask;
+        const int64_t lastBlock = std::min(firstBlock + blocksPerTask, numBlocks);
+        for (int64_t block = firstBlock; block < lastBlock; ++block)
+        {
+            writeBlock(block);
+        }
+    };
+
+    if (numTasks <= 1 || AcceraThreadPoolNumThreads() <= 1)
+    {
+        for (int64_t task = 0; task < numTasks; ++task)
+        {
+            runTask(task);
+        }
+        return;
+    }
+
+    struct TaskContext
+    {
+        decltype(runTask)* run;
+    } context{ &runTask };
+    AcceraParallelFor(
+        [](void* rawContext, int index) {
+            (*static_cast<TaskContext*>(rawContext)->run)(index);
+        },
+        &context,
+        static_cast<int>(numTasks),
+        /*chunkSize=*/1);
+}
+
+} // namespace
+
+uint32_t AcceraRandomUint32(uint64_t seed, uint64_t counter)
+{
+    return PhiloxBlockAt(seed, counter >> 2).word[counter & 3];
+}
+
+float AcceraRandomUniformFloat(uint64_t seed, uint64_t counter, float lo, float hi)
+{
+    return UniformFloatFromWord(AcceraRandomUint32(seed, counter), lo, hi);
+}
+
+void AcceraRandomFillUniformFloat(float* buffer, int64_t count, uint64_t seed, float lo, float hi)
+{
+    FillDeterministic(count, [=](int64_t block) {
+        const auto words = PhiloxBlockAt(seed, block);
+        const int64_t base = block * 4;
+        const int64_t lanes = std::min<int64_t>(4, count - base);
+        for (int64_t lane = 0; lane < lanes; ++lane)
+        {
+            buffer[base + lane] = UniformFloatFromWord(words.word[lane], lo, hi);
+        }
+    });
+}
+
+void AcceraRandomFillUniformInt(int32_t* buffer, int64_t count, uint64_t seed, int32_t lo, int32_t hi)
+{
+    const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(hi) - lo) + 1;
+    FillDeterministic(count, [=](int64_t block) {
+        const auto words = PhiloxBlockAt(seed, block);
+        const int64_t base = block * 4;
+        const int64_t lanes = std::min<int64_t>(4, count - base);
+        for (int64_t lane = 0; lane < lanes; ++lane)
+        {
+            // Fixed-point scaling keeps every lane branch-free; the bias of multiply-shift versus
+            // rejection sampling is below 2^-32 per draw, which benchmark inputs don't notice
+            buffer[base + lane] = lo + static_cast<int32_t>((static_cast<uint64_t>(words.word[lane]) * range) >> 32);
+        }
+    });
+}
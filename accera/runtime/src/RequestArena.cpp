@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "RequestArena.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+constexpr int64_t kArenaAlignment = 64;
+constexpr int64_t kInitialSlabBytes = 1ll << 20; // 1MB; grows to the request high-water mark
+
+int64_t RoundUpTo(int64_t value, int64_t multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+void FreeSlabBase(void* base)
+{
+#if defined(_WIN32)
+    _aligned_free(base);
+#else
+    std::free(base);
+#endif
+}
+
+// Largest per-request high-water mark seen by any thread
+std::atomic<int64_t> ProcessPeakBytes{ 0 };
+
+struct Slab
+{
+    char* base;
+    int64_t capacity;
+    int64_t used;
+};
+
+// Per-thread request context. Package functions only allocate internal buffers on the thread
+// that invoked them, so keeping the arena thread-local makes every path lock-free.
+class RequestArena
+{
+public:
+    ~RequestArena()
+    {
+        for (auto& slab : _slabs)
+        {
+            FreeSlabBase(slab.base);
+        }
+    }
+
+    void Begin()
+    {
+        if (_depth++ == 0)
+        {
+            _highWaterBytes = 0;
+            _liveBytes = 0;
+        }
+    }
+
+    void End()
+    {
+        if (_depth == 0 || --_depth > 0)
+        {
+            return;
+        }
+
+        auto previousPeak = ProcessPeakBytes.load(std::memory_order_relaxed);
+        while (_highWaterBytes > previousPeak &&
+               !ProcessPeakBytes.compare_exchange_weak(previousPeak, _highWaterBytes, std::memory_order_relaxed))
+        {
+        }
+
+        // Reclaim everything at once. A request that spilled into multiple slabs leaves a single
+        // slab sized to its high-water mark behind, so the next request of the same shape is
+        // served by one bump pointer with no system allocation at all.
+        if (_slabs.size() > 1)
+        {
+            for (auto& slab : _slabs)
+            {
+                FreeSlabBase(slab.base);
+            }
+            _slabs.clear();
+            AddSlab(RoundUpTo(_highWaterBytes, kArenaAlignment));
+        }
+        else if (!_slabs.empty())
+        {
+            _slabs.front().used = 0;
+        }
+    }
+
+    bool InRequest() const
+    {
+        return _depth > 0;
+    }
+
+    void* Allocate(int64_t sizeBytes)
+    {
+        const auto alignedSize = RoundUpTo(sizeBytes, kArenaAlignment);
+        if (_slabs.empty() || _slabs.back().used + alignedSize > _slabs.back().capacity)
+        {
+            if (!AddSlab(alignedSize))
+            {
+                return nullptr;
+            }
+        }
+        auto& slab = _slabs.back();
+        void* buffer = slab.base + slab.used;
+        slab.used += alignedSize;
+        _liveBytes += alignedSize;
+        if (_liveBytes > _highWaterBytes)
+        {
+            _highWaterBytes = _liveBytes;
+        }
+        return buffer;
+    }
+
+    bool Owns(const void* buffer) const
+    {
+        for (const auto& slab : _slabs)
+        {
+            const char* pointer = static_cast<const char*>(buffer);
+            if (pointer >= slab.base && pointer < slab.base + slab.capacity)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int64_t HighWaterBytes() const
+    {
+        return _highWaterBytes;
+    }
+
+private:
+    bool AddSlab(int64_t minimumBytes)
+    {
+        // Each new slab doubles the last one's size so long requests settle quickly; oversized
+        // single allocations get a dedicated slab
+        int64_t capacity = _slabs.empty() ? kInitialSlabBytes : _slabs.back().capacity * 2;
+        if (capacity < minimumBytes)
+        {
+            capacity = RoundUpTo(minimumBytes, kArenaAlignment);
+        }
+        void* base = nullptr;
+#if defined(_WIN32)
+        base = _aligned_malloc(static_cast<size_t>(capacity), static_cast<size_t>(kArenaAlignment));
+#else
+        if (::posix_memalign(&base, static_cast<size_t>(kArenaAlignment), static_cast<size_t>(capacity)) != 0)
+        {
+            base = nullptr;
+        }
+#endif
+        if (!base)
+        {
+            return false;
+        }
+        _slabs.push_back(Slab{ static_cast<char*>(base), capacity, 0 });
+        return true;
+    }
+
+    std::vector<Slab> _slabs;
+    int _depth = 0;
+    int64_t _liveBytes = 0;
+    int64_t _highWaterBytes = 0;
+};
+
+RequestArena& GetThreadArena()
+{
+    thread_local RequestArena arena;
+    return arena;
+}
+
+} // namespace
+
+extern "C" {
+
+void AcceraRequestBegin(void)
+{
+    GetThreadArena().Begin();
+}
+
+void AcceraRequestEnd(void)
+{
+    GetThreadArena().End();
+}
+
+void* AcceraRequestAllocate(int64_t sizeBytes)
+{
+    if (sizeBytes <= 0)
+    {
+        return nullptr;
+    }
+    auto& arena = GetThreadArena();
+    if (arena.InRequest())
+    {
+        if (void* buffer = arena.Allocate(sizeBytes))
+        {
+            return buffer;
+        }
+        // Slab allocation failed; fall through to the heap so the caller sees the same
+        // out-of-memory behavior as an unpooled allocation
+    }
+    return std::malloc(static_cast<size_t>(sizeBytes));
+}
+
+void AcceraRequestFree(void* buffer)
+{
+    if (!buffer)
+    {
+        return;
+    }
+    // Request-owned memory is reclaimed wholesale at AcceraRequestEnd; only heap fallbacks (and
+    // allocations made outside any scope) are released here
+    if (!GetThreadArena().Owns(buffer))
+    {
+        std::free(buffer);
+    }
+}
+
+int64_t AcceraRequestHighWaterBytes(void)
+{
+    return GetThreadArena().HighWaterBytes();
+}
+
+int64_t AcceraRequestPeakBytes(void)
+{
+    return ProcessPeakBytes.load(std::memory_order_relaxed);
+}
+
+} // extern "C"
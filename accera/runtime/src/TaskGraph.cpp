@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Library for runtime utilities
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "TaskGraph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct Task
+{
+    AcceraTaskFunction fn = nullptr;
+    void* context = nullptr;
+    std::vector<const void*> reads;
+    std::vector<const void*> writes;
+    std::vector<int> successors;
+    int numPredecessors = 0;
+
+    // per-run state
+    std::atomic<int> remainingPredecessors{ 0 };
+};
+
+bool Overlaps(const std::vector<const void*>& a, const std::vector<const void*>& b)
+{
+    for (auto pa : a)
+    {
+        if (std::find(b.begin(), b.end(), pa) != b.end())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct TaskGraph
+{
+    explicit TaskGraph(int numThreads) :
+        numThreads(numThreads <= 0 ? static_cast<int>(std::thread::hardware_concurrency()) : numThreads)
+    {}
+
+    int AddTask(AcceraTaskFunction fn, void* context, const void** reads, int numReads, const void** writes, int numWrites)
+    {
+        auto& task = *tasks.emplace_back(std::make_unique<Task>());
+        task.fn = fn;
+        task.context = context;
+        task.reads.assign(reads, reads + numReads);
+        task.writes.assign(writes, writes + numWrites);
+
+        int taskId = static_cast<int>(tasks.size()) - 1;
+        for (int earlier = 0; earlier < taskId; ++earlier)
+        {
+            auto& other = *tasks[earlier];
+            // RAW, WAW: ordered after earlier writers; WAR: ordered after earlier readers
+            if (Overlaps(other.writes, task.reads) ||
+                Overlaps(other.writes, task.writes) ||
+                Overlaps(other.reads, task.writes))
+            {
+                other.successors.push_back(taskId);
+                ++task.numPredecessors;
+            }
+        }
+        return taskId;
+    }
+
+    void Run()
+    {
+        if (tasks.empty())
+        {
+            return;
+        }
+
+        for (auto& task : tasks)
+        {
+            task->remainingPredecessors.store(task->numPredecessors);
+        }
+        numCompleted.store(0);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (int i = 0; i < static_cast<int>(tasks.size()); ++i)
+            {
+                if (tasks[i]->numPredecessors == 0)
+                {
+                    readyQueue.push_back(i);
+                }
+            }
+        }
+        readyCondition.notify_all();
+
+        std::vector<std::thread> workers;
+        int workerCount = std::min<int>(numThreads, static_cast<int>(tasks.size()));
+        workers.reserve(workerCount);
+        for (int i = 0; i < workerCount; ++i)
+        {
+            workers.emplace_back([this] { WorkerLoop(); });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+private:
+    void WorkerLoop()
+    {
+        for (;;)
+        {
+            int taskId = -1;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                readyCondition.wait(lock, [this] {
+                    return !readyQueue.empty() || numCompleted.load() == static_cast<int>(tasks.size());
+                });
+                if (readyQueue.empty())
+                {
+                    return; // all tasks done
+                }
+                taskId = readyQueue.back();
+                readyQueue.pop_back();
+            }
+
+            auto& task = *tasks[taskId];
+            task.fn(task.context);
+
+            bool allDone = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (auto successor : task.successors)
+                {
+                    if (tasks[successor]->remainingPredecessors.fetch_sub(1) == 1)
+                    {
+                        readyQueue.push_back(successor);
+                    }
+                }
+                allDone = numCompleted.fetch_add(1) + 1 == static_cast<int>(tasks.size());
+            }
+            readyCondition.notify_all();
+            if (allDone)
+            {
+                return;
+            }
+        }
+    }
+
+    int numThreads;
+    std::vector<std::unique_ptr<Task>> tasks;
+    std::vector<int> readyQueue;
+    std::mutex mutex;
+    std::condition_variable readyCondition;
+    std::atomic<int> numCompleted{ 0 };
+};
+
+} // namespace
+
+void* AcceraTaskGraphCreate(int numThreads)
+{
+    return new TaskGraph(numThreads);
+}
+
+int AcceraTaskGraphAddTask(void* graph, AcceraTaskFunction fn, void* context, const void** reads, int numReads, const void** writes, int numWrites)
+{
+    return static_cast<TaskGraph*>(graph)->AddTask(fn, context, reads, numReads, writes, numWrites);
+}
+
+void AcceraTaskGraphRun(void* graph)
+{
+    static_cast<TaskGraph*>(graph)->Run();
+}
+
+void AcceraTaskGraphDestroy(void* graph)
+{
+    delete static_cast<TaskGraph*>(graph);
+}
@@ -0,0 +1,320 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+//
+//  Library for runtime utilities
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool.h"
+
+#include "ChromeTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// The current parallel region. Workers claim chunks of the iteration space by advancing the index
+// half of claimState with a CAS, so no locking happens on the work-distribution path; the
+// mutex/condition pair is only used to park idle workers between regions and to signal completion
+// back to the caller.
+//
+// claimState packs (region generation, next unclaimed index) into one 64-bit atomic. The
+// generation tag is what makes a late-waking worker safe: a thread that was preempted while a
+// region drained and got replaced sees a generation it doesn't recognize, and its CAS can never
+// accidentally claim (or skip) iterations of the new region the way a bare fetch_add could. The
+// tag is the low 32 bits of the region counter, so confusing two regions would take a worker
+// staying preempted across 2^32 intervening regions.
+struct ParallelRegion
+{
+    void (*fn)(void* context, int index) = nullptr;
+    void* context = nullptr;
+    int numIterations = 0;
+    int chunkSize = 1;
+    // When set, each thread scales chunkSize by its calibrated relative throughput, so a
+    // performance core claims proportionally bigger chunks than an efficiency core
+    bool proportional = false;
+    std::atomic<uint64_t> claimState{ 0 };
+    std::atomic<int> remainingIterations{ 0 };
+};
+
+constexpr uint64_t PackClaim(uint32_t generation, uint32_t index)
+{
+    return (static_cast<uint64_t>(generation) << 32) | index;
+}
+
+constexpr uint32_t ClaimGeneration(uint64_t claim)
+{
+    return static_cast<uint32_t>(claim >> 32);
+}
+
+constexpr uint32_t ClaimIndex(uint64_t claim)
+{
+    return static_cast<uint32_t>(claim);
+}
+
+// A thread's private copy of the region parameters, taken under the mutex while the generation it
+// was woken for is known to be current. Working from a snapshot keeps stale threads from reading
+// the non-atomic region fields while a later caller rewrites them.
+struct RegionSnapshot
+{
+    void (*fn)(void* context, int index) = nullptr;
+    void* context = nullptr;
+    int numIterations = 0;
+    int chunkSize = 1;
+    bool proportional = false;
+    uint32_t generation = 0;
+};
+
+// Fastest per-thread calibration result seen so far; each thread's weight is its own result
+// relative to this, so weights stay in (0, 1] even as faster cores calibrate later
+std::atomic<uint64_t> FastestCalibration{ 0 };
+
+// Measures this thread's throughput once with a dependency-chained integer kernel (a few
+// microseconds) and returns its weight relative to the fastest thread measured so far. On a
+// hybrid part the OS scheduler keeps pool threads resident long enough that the measurement
+// tracks the core class the thread actually runs on.
+double ThreadRelativeThroughput()
+{
+    thread_local uint64_t opsPerSecond = 0;
+    if (opsPerSecond == 0)
+    {
+        constexpr int kCalibrationOps = 1 << 20;
+        volatile uint64_t sink = 1;
+        const auto start = std::chrono::steady_clock::now();
+        uint64_t value = sink;
+        for (int i = 0; i < kCalibrationOps; ++i)
+        {
+            value = value * 6364136223846793005ull + 1442695040888963407ull;
+        }
+        sink = value;
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        opsPerSecond = elapsed > 0 ? static_cast<uint64_t>(kCalibrationOps / elapsed) : 1;
+
+        auto fastest = FastestCalibration.load(std::memory_order_relaxed);
+        while (opsPerSecond > fastest &&
+               !FastestCalibration.compare_exchange_weak(fastest, opsPerSecond, std::memory_order_relaxed))
+        {
+        }
+    }
+    const auto fastest = FastestCalibration.load(std::memory_order_relaxed);
+    return fastest > 0 ? static_cast<double>(opsPerSecond) / static_cast<double>(fastest) : 1.0;
+}
+
+class ThreadPool
+{
+public:
+    static ThreadPool& GetInstance()
+    {
+        static ThreadPool instance;
+        return instance;
+    }
+
+    int NumThreads() const
+    {
+        return static_cast<int>(workers.size()) + 1; // the caller participates
+    }
+
+    void ParallelFor(void (*fn)(void* context, int index), void* context, int numIterations, int chunkSize, bool proportional = false)
+    {
+        if (numIterations <= 0)
+        {
+            return;
+        }
+
+        // One region at a time: package functions may be invoked from multiple host threads (the
+        // OpenMP regions this pool replaces allow that), but the pool has a single shared region,
+        // so concurrent callers take turns
+        std::lock_guard<std::mutex> callerLock(callerMutex);
+
+        if (chunkSize <= 0)
+        {
+            if (proportional)
+            {
+                // The per-thread chunk at full weight; each thread scales it down by its relative
+                // throughput, so the whole space drains in a couple of claiming rounds with every
+                // core class finishing at about the same time
+                chunkSize = std::max(1, (numIterations + 2 * NumThreads() - 1) / (2 * NumThreads()));
+            }
+            else
+            {
+                // One contiguous chunk per thread
+                chunkSize = std::max(1, (numIterations + NumThreads() - 1) / NumThreads());
+            }
+        }
+
+        RegionSnapshot snapshot;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            region.fn = fn;
+            region.context = context;
+            region.numIterations = numIterations;
+            region.chunkSize = chunkSize;
+            region.proportional = proportional;
+            region.remainingIterations.store(numIterations, std::memory_order_relaxed);
+            ++generation;
+            // Publishes the fields above to racing workers and invalidates any claim a stale
+            // worker might still be holding from an earlier region
+            region.claimState.store(PackClaim(static_cast<uint32_t>(generation), 0), std::memory_order_release);
+            snapshot = Snapshot();
+        }
+        wakeCV.notify_all();
+
+        AcceraProfileTraceEnter("parallel_for");
+
+        // The calling thread works alongside the pool
+        RunChunks(snapshot);
+
+        // Wait for the workers to drain the chunks the caller didn't claim
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCV.wait(lock, [this] { return region.remainingIterations.load(std::memory_order_acquire) == 0; });
+        region.fn = nullptr;
+        AcceraProfileTraceExit("parallel_for");
+    }
+
+private:
+    ThreadPool()
+    {
+        auto numWorkers = std::max(1u, std::thread::hardware_concurrency()) - 1;
+        for (unsigned i = 0; i < numWorkers; ++i)
+        {
+            workers.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        wakeCV.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Must be called with the mutex held while `generation` matches the region fields
+    RegionSnapshot Snapshot() const
+    {
+        RegionSnapshot snapshot;
+        snapshot.fn = region.fn;
+        snapshot.context = region.context;
+        snapshot.numIterations = region.numIterations;
+        snapshot.chunkSize = region.chunkSize;
+        snapshot.proportional = region.proportional;
+        snapshot.generation = static_cast<uint32_t>(generation);
+        return snapshot;
+    }
+
+    void WorkerLoop()
+    {
+        uint64_t lastGeneration = 0;
+        for (;;)
+        {
+            RegionSnapshot snapshot;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeCV.wait(lock, [this, lastGeneration] { return stopped || generation != lastGeneration; });
+                if (stopped)
+                {
+                    return;
+                }
+                lastGeneration = generation;
+                snapshot = Snapshot();
+            }
+
+            RunChunks(snapshot);
+        }
+    }
+
+    void RunChunks(const RegionSnapshot& snapshot)
+    {
+        int chunkSize = snapshot.chunkSize;
+        if (snapshot.proportional)
+        {
+            chunkSize = std::max(1, static_cast<int>(chunkSize * ThreadRelativeThroughput()));
+        }
+
+        int completed = 0;
+        auto state = region.claimState.load(std::memory_order_acquire);
+        for (;;)
+        {
+            if (ClaimGeneration(state) != snapshot.generation)
+            {
+                // A later region replaced this one while we were preempted; none of its
+                // iterations are ours to claim. This can only happen before our first
+                // successful claim: the caller cannot retire a region until every claimed
+                // iteration has been counted, including ours
+                break;
+            }
+            auto begin = static_cast<int>(ClaimIndex(state));
+            if (begin >= snapshot.numIterations)
+            {
+                break;
+            }
+            auto end = std::min(begin + chunkSize, snapshot.numIterations);
+            if (!region.claimState.compare_exchange_weak(
+                    state, PackClaim(snapshot.generation, static_cast<uint32_t>(end)), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                continue; // state was reloaded by the failed CAS; re-validate and retry
+            }
+            // One trace slice per chunk: gaps between a thread's slices are exactly the time it
+            // spent idle or contending, which is what the trace view is for
+            AcceraProfileTraceEnter("parallel_chunk");
+            for (int index = begin; index < end; ++index)
+            {
+                snapshot.fn(snapshot.context, index);
+            }
+            AcceraProfileTraceExit("parallel_chunk");
+            completed += end - begin;
+            state = region.claimState.load(std::memory_order_acquire);
+        }
+
+        if (completed > 0 && region.remainingIterations.fetch_sub(completed, std::memory_order_acq_rel) == completed)
+        {
+            // This thread finished the last iterations; wake the caller. The empty critical
+            // section orders this notify after the caller's predicate check, so the wakeup
+            // cannot slip between that check and the wait
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+            doneCV.notify_all();
+        }
+    }
+
+    std::mutex callerMutex; // serializes concurrent ParallelFor callers
+    std::mutex mutex;
+    std::condition_variable wakeCV;
+    std::condition_variable doneCV;
+    std::vector<std::thread> workers;
+    ParallelRegion region;
+    uint64_t generation = 0;
+    bool stopped = false;
+};
+
+} // namespace
+
+extern "C" int AcceraThreadPoolNumThreads(void)
+{
+    return ThreadPool::GetInstance().NumThreads();
+}
+
+extern "C" void AcceraParallelFor(void (*fn)(void* context, int index), void* context, int numIterations, int chunkSize)
+{
+    ThreadPool::GetInstance().ParallelFor(fn, context, numIterations, chunkSize);
+}
+
+extern "C" void AcceraParallelForProportional(void (*fn)(void* context, int index), void* context, int numIterations)
+{
+    ThreadPool::GetInstance().ParallelFor(fn, context, numIterations, /*chunkSize=*/0, /*proportional=*/true);
+}
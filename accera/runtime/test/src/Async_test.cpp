@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch_all.hpp>
+
+#include <Async.h>
+
+#include <atomic>
+#include <vector>
+
+namespace accera
+{
+
+TEST_CASE("Async_InvokeAndWait")
+{
+    std::atomic<int> ran{ 0 };
+    auto* handle = AcceraAsyncInvoke([](void* context) { static_cast<std::atomic<int>*>(context)->fetch_add(1); }, &ran);
+    REQUIRE(handle != nullptr);
+    AcceraAsyncWait(handle);
+    CHECK(ran == 1);
+}
+
+TEST_CASE("Async_OverlappingInvocations")
+{
+    constexpr int kNumInvocations = 100;
+    std::atomic<int> ran{ 0 };
+
+    std::vector<void*> handles;
+    for (int i = 0; i < kNumInvocations; ++i)
+    {
+        handles.push_back(AcceraAsyncInvoke([](void* context) { static_cast<std::atomic<int>*>(context)->fetch_add(1); }, &ran));
+    }
+    for (auto* handle : handles)
+    {
+        AcceraAsyncWait(handle);
+    }
+
+    CHECK(ran == kNumInvocations);
+}
+
+} // namespace accera
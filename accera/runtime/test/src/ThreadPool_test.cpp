@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch_all.hpp>
+
+#include <ThreadPool.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace accera
+{
+
+namespace
+{
+    struct IterationCounters
+    {
+        explicit IterationCounters(int numIterations) :
+            perIndex(numIterations) {}
+
+        std::atomic<long> total{ 0 };
+        std::vector<std::atomic<int>> perIndex;
+
+        void Reset()
+        {
+            total = 0;
+            for (auto& count : perIndex)
+            {
+                count = 0;
+            }
+        }
+    };
+
+    void CountIteration(void* context, int index)
+    {
+        auto& counters = *static_cast<IterationCounters*>(context);
+        counters.total.fetch_add(1);
+        counters.perIndex[index].fetch_add(1);
+    }
+} // namespace
+
+TEST_CASE("ThreadPool_NumThreads")
+{
+    REQUIRE(AcceraThreadPoolNumThreads() >= 1);
+}
+
+TEST_CASE("ThreadPool_RunsEveryIterationExactlyOnce")
+{
+    constexpr int kNumIterations = 1024;
+    IterationCounters counters(kNumIterations);
+
+    for (int chunkSize : { 0, 1, 3, 64, kNumIterations, 2 * kNumIterations })
+    {
+        counters.Reset();
+        AcceraParallelFor(CountIteration, &counters, kNumIterations, chunkSize);
+        REQUIRE(counters.total == kNumIterations);
+        for (int index = 0; index < kNumIterations; ++index)
+        {
+            REQUIRE(counters.perIndex[index] == 1);
+        }
+    }
+}
+
+TEST_CASE("ThreadPool_EmptyAndNegativeRegionsAreNoOps")
+{
+    IterationCounters counters(1);
+    AcceraParallelFor(CountIteration, &counters, 0, 1);
+    AcceraParallelFor(CountIteration, &counters, -5, 1);
+    CHECK(counters.total == 0);
+}
+
+// Regression stress for the generation-tagged chunk claiming: a worker that wakes late for one
+// region must not claim (or double-run) iterations of the region that replaced it. Before the
+// claim state carried a generation tag, back-to-back regions could double-execute iterations and
+// drive the completion counter negative, hanging the caller. Small regions maximize the chance
+// that a region retires while some worker is still waking up for it.
+TEST_CASE("ThreadPool_BackToBackRegionsDoNotDoubleExecute")
+{
+    constexpr int kNumIterations = 64;
+    constexpr int kNumRounds = 2000;
+    IterationCounters counters(kNumIterations);
+
+    for (int round = 0; round < kNumRounds; ++round)
+    {
+        counters.Reset();
+        AcceraParallelFor(CountIteration, &counters, kNumIterations, 3);
+        REQUIRE(counters.total == kNumIterations);
+        for (int index = 0; index < kNumIterations; ++index)
+        {
+            REQUIRE(counters.perIndex[index] == 1);
+        }
+    }
+}
+
+TEST_CASE("ThreadPool_ConcurrentCallersAreSerialized")
+{
+    constexpr int kNumIterations = 257;
+    constexpr int kRoundsPerCaller = 200;
+    constexpr int kNumCallers = 3;
+
+    std::atomic<long> total{ 0 };
+    auto caller = [&total] {
+        for (int round = 0; round < kRoundsPerCaller; ++round)
+        {
+            AcceraParallelFor([](void* context, int) { static_cast<std::atomic<long>*>(context)->fetch_add(1); },
+                              &total,
+                              kNumIterations,
+                              /*chunkSize=*/0);
+        }
+    };
+
+    std::vector<std::thread> callers;
+    for (int i = 0; i < kNumCallers; ++i)
+    {
+        callers.emplace_back(caller);
+    }
+    for (auto& thread : callers)
+    {
+        thread.join();
+    }
+
+    CHECK(total == static_cast<long>(kNumCallers) * kRoundsPerCaller * kNumIterations);
+}
+
+TEST_CASE("ThreadPool_ProportionalPartitionCoversTheSpace")
+{
+    constexpr int kNumIterations = 1000;
+    IterationCounters counters(kNumIterations);
+
+    // The per-thread chunk sizes differ under the proportional policy, but every index must still
+    // run exactly once
+    for (int round = 0; round < 50; ++round)
+    {
+        counters.Reset();
+        AcceraParallelForProportional(CountIteration, &counters, kNumIterations);
+        REQUIRE(counters.total == kNumIterations);
+        for (int index = 0; index < kNumIterations; ++index)
+        {
+            REQUIRE(counters.perIndex[index] == 1);
+        }
+    }
+}
+
+} // namespace accera
@@ -7,14 +7,20 @@
 #pragma once
 
 #include "affine/AffineSimplifications.h"
+#include "affine/CacheFillFusion.h"
 #include "exec/ExecutionPlanToAffineLoweringPass.h"
 #include "gpu/AcceraToGPUPass.h"
 #include "gpu/AcceraVulkanPasses.h"
 #include "ir/include/value/ValueEnums.h"
+#include "nest/ArgoOpRecognitionPass.h"
 #include "nest/LoopNestPasses.h"
 #include "nest/LoopNestToValueFunc.h"
+#include "nest/ScheduleCostModelPass.h"
+#include "nest/ScheduleDiff.h"
 #include "util/DebugFunctionPass.h"
+#include "util/PassStatisticsPass.h"
 #include "value/BarrierOptPass.h"
+#include "value/CallerWorkspacePass.h"
 #include "value/FunctionPointerResolutionPass.h"
 #include "value/RangeValueOptimizePass.h"
 #include "value/ValueFuncToTargetPass.h"
@@ -88,8 +94,21 @@ struct AcceraPassPipelineOptions : mlir::PassPipelineOptions<AcceraPassPipelineO
     Option<bool> enableProfile{ *this, "enable-profiling", llvm::cl::init(false) };
     Option<bool> printLoops{ *this, "print-loops", llvm::cl::init(false) };
     Option<bool> printVecOpDetails{ *this, "print-vec-details", llvm::cl::init(false) };
+    Option<bool> printCacheFootprints{ *this, "print-cache-footprints", llvm::cl::init(false) };
+    Option<bool> strictCacheFootprint{ *this, "strict-cache-footprint", llvm::cl::init(false) };
+    Option<bool> printRegisterPressure{ *this, "print-register-pressure", llvm::cl::init(false) };
+    Option<bool> strictRegisterPressure{ *this, "strict-register-pressure", llvm::cl::init(false) };
+    Option<bool> printRoofline{ *this, "print-roofline", llvm::cl::init(false) };
+    Option<bool> instrumentCacheCopies{ *this, "instrument-cache-copies", llvm::cl::init(false) };
     Option<bool> writeBarrierGraph{ *this, "barrier-opt-dot", llvm::cl::init(false) };
     Option<std::string> barrierGraphFilename{ *this, "barrier-opt-dot-filename", llvm::cl::init(std::string{}) };
+    Option<std::string> llvmTargetCpu{ *this, "llvm-target-cpu", llvm::cl::init(std::string{}) };
+    Option<std::string> llvmTargetFeatures{ *this, "llvm-target-features", llvm::cl::init(std::string{}) };
+    Option<bool> llvmFastMathFuncAttrs{ *this, "llvm-fast-math-func-attrs", llvm::cl::init(false) };
+    Option<bool> passStatistics{ *this, "pass-statistics", llvm::cl::init(false) };
+    Option<std::string> passStatisticsFile{ *this, "pass-statistics-file", llvm::cl::init(std::string{}) };
+    Option<bool> passStatisticsCumulative{ *this, "pass-statistics-cumulative", llvm::cl::init(false) };
+    Option<int64_t> passMemoryBudgetMB{ *this, "pass-memory-budget-mb", llvm::cl::init(0) };
 };
 
 void addAcceraToLLVMPassPipeline(mlir::OpPassManager& pm, const AcceraPassPipelineOptions& options);
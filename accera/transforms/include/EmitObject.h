@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "AcceraPasses.h"
+
+#include <mlir/IR/BuiltinOps.h>
+
+#include <llvm/ADT/ArrayRef.h>
+
+#include <string>
+#include <vector>
+
+namespace accera::transforms
+{
+
+/// Options controlling the LLVM half of in-process object emission. The MLIR half is controlled
+/// by the AcceraPassPipelineOptions passed alongside (its `target`, `llvmTargetCpu` and
+/// `llvmTargetFeatures` options also select the code generation target).
+struct ObjectEmissionOptions
+{
+    /// LLVM optimization level to run on the translated module (0-3)
+    unsigned optimizationLevel = 3;
+
+    /// LLVM size optimization level (0-2)
+    unsigned sizeLevel = 0;
+
+    /// When non-empty, write per-stage debug dumps next to the given basename:
+    /// `<basename>_llvm.mlir` (after the MLIR lowering pipeline), `<basename>.ll` (translated
+    /// LLVM IR) and `<basename>_opt.ll` (optimized LLVM IR). When empty (the default) all
+    /// intermediate results stay in memory.
+    std::string dumpBasename;
+};
+
+/// Lowers the given module through the full Accera-to-LLVM pipeline, translates it to LLVM IR,
+/// optimizes it, and emits target object code, all in-process with in-memory buffers between
+/// stages. The input module is not modified. Returns the object file contents.
+/// Throws std::runtime_error if any stage fails.
+std::vector<char> EmitObjectCode(mlir::ModuleOp module,
+                                 const AcceraPassPipelineOptions& pipelineOptions,
+                                 const ObjectEmissionOptions& emissionOptions = {});
+
+/// Package-level variant of EmitObjectCode: lowers and translates each function module, links
+/// them into a single LLVM module, internalizes every symbol not named in `exportedSymbols`,
+/// and optimizes the linked whole before emitting one object file. Internalizing first lets the
+/// package's shared packing/init helpers inline into their callers and be discarded, which
+/// per-module emission can never do. The exported list should name the package's public entry
+/// points (including their unwrapped variants); everything else becomes internal.
+std::vector<char> EmitPackageObjectCode(llvm::ArrayRef<mlir::ModuleOp> modules,
+                                        const std::vector<std::string>& exportedSymbols,
+                                        const AcceraPassPipelineOptions& pipelineOptions,
+                                        const ObjectEmissionOptions& emissionOptions = {});
+
+/// Convenience wrapper around EmitObjectCode that writes the emitted object code to a file.
+void EmitObjectFile(mlir::ModuleOp module,
+                    const std::string& outputPath,
+                    const AcceraPassPipelineOptions& pipelineOptions,
+                    const ObjectEmissionOptions& emissionOptions = {});
+
+} // namespace accera::transforms
@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace mlir
+{
+class Operation;
+} // namespace mlir
+
+namespace accera::transforms::executionPlan
+{
+
+/// Wraps every cache fill, writeback, reduce, and zero op under `op` (a function) in a profile
+/// region whose name encodes the op kind, the loop level it sits at, and the bytes it moves per
+/// invocation, and appends a profile results dump before each return. The per-region invocation
+/// counts and accumulated wall time then give achieved bandwidth per cache stage at runtime
+/// (bytes x count / time). Must run while the execution plan cache ops are still present, i.e.
+/// before the copy/reduce lowering patterns expand them into loops. The inserted profile ops are
+/// erased during lowering unless profiling is enabled, so this is a no-op in shipped binaries.
+void InstrumentCacheCopies(mlir::Operation* op);
+
+} // namespace accera::transforms::executionPlan
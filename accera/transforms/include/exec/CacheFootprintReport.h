@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <mlir/Support/LogicalResult.h>
+
+#include <string>
+
+namespace mlir
+{
+class Operation;
+} // namespace mlir
+
+namespace accera::transforms::executionPlan
+{
+
+/// Reports the memory footprint of the caches in the given function against the cache sizes of
+/// the named target device. Emits a remark per cache and an aggregate working set summary when
+/// `printCacheFootprints` is set, and a warning when the aggregate working set exceeds the
+/// target's per-core cache budget. When `warningsAsErrors` is set the budget overflow warning
+/// becomes an error and this function returns failure.
+/// Must run while MakeCacheOps with resolved static shapes are still present, i.e. before the
+/// cache finalization patterns lower them to allocations.
+mlir::LogicalResult EmitCacheFootprintReport(mlir::Operation* op,
+                                             const std::string& targetDeviceName,
+                                             bool printCacheFootprints,
+                                             bool warningsAsErrors);
+
+} // namespace accera::transforms::executionPlan
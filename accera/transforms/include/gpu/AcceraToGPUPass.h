@@ -54,6 +54,8 @@ std::unique_ptr<mlir::OperationPass<mlir::ModuleOp>> createGPUToROCDLPass();
 
 std::unique_ptr<mlir::OperationPass<mlir::gpu::GPUModuleOp>> createSerializeToHSACOPass();
 
+std::unique_ptr<mlir::OperationPass<mlir::gpu::GPUModuleOp>> createGPUOccupancyCheckPass();
+
 // Abstract method which dispatches to SPIRV, NVVM, or ROCDL depending on the execution environment's runtime
 std::unique_ptr<mlir::OperationPass<mlir::ModuleOp>> createAcceraToGPUPass(accera::value::ExecutionRuntime runtime);
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 namespace mlir
 {
@@ -22,6 +23,9 @@ struct VulkanTimingOptions
     bool printTimings = false;
     int64_t warmupCount = 0;
     int64_t runCount = 1;
+    int64_t concurrentDispatchCount = 1;
+    int64_t launchBatchSize = 1;
+    std::string timingOutputFile = "";
 
     static const VulkanTimingOptions& getDefaultOptions()
     {
@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+// fwd decls
+namespace mlir
+{
+class Pass;
+} // namespace mlir
+
+namespace accera::ir::loopnest
+{
+class ScheduleOp;
+} // namespace accera::ir::loopnest
+
+namespace accera::transforms::loopnest
+{
+
+/// The argo named structured op a schedule's kernel computes, recognized from the kernel body.
+/// `opName` holds the argo mnemonic ("argo.matmul", "argo.copy" or "argo.fill"); the transpose
+/// flags only apply to matmul and say whether the corresponding input is accessed with its
+/// index tuple reversed relative to the plain C(i,j) += A(i,k) * B(k,j) form.
+struct ArgoNamedOpMatch
+{
+    std::string opName;
+    bool transposeA = false;
+    bool transposeB = false;
+};
+
+/// Tries to recognize the named structured op computed by the schedule's kernel. Only schedules
+/// with a single kernel whose body is a pure slice/get_element/bin_op/copy expression tree are
+/// considered; anything else returns nullopt and takes the generic lowering path.
+std::optional<ArgoNamedOpMatch> MatchArgoNamedOp(accera::ir::loopnest::ScheduleOp scheduleOp);
+
+/// Creates a pass that annotates each recognized schedule with an `argo.named_op` attribute and,
+/// for untransformed matmul schedules on a CPU target, replaces full schedule search with the
+/// pre-tuned tiling template for the named target device.
+std::unique_ptr<mlir::Pass> createArgoOpRecognitionPass();
+
+} // namespace accera::transforms::loopnest
@@ -9,6 +9,7 @@
 #include <transforms/include/util/SnapshotUtilities.h>
 
 #include <memory>
+#include <string>
 
 // fwd decls
 namespace mlir
@@ -35,6 +36,13 @@ namespace transforms::loopnest
         accera::transforms::IntraPassSnapshotOptions snapshotOptions;
         bool printLoops = false;
         bool printVecOpDetails = false;
+        bool printCacheFootprints = false;
+        bool strictCacheFootprint = false;
+        bool printRegisterPressure = false;
+        bool strictRegisterPressure = false;
+        bool printRoofline = false;
+        bool instrumentCacheCopies = false;
+        std::string targetDeviceName = "host";
     };
 
     void populateLoopnestToValueFuncPatterns(mlir::RewritePatternSet& patterns);
@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <mlir/Support/LogicalResult.h>
+
+#include <string>
+
+namespace mlir
+{
+class Operation;
+} // namespace mlir
+
+namespace accera::ir::loopnest
+{
+class ScheduleOp;
+} // namespace accera::ir::loopnest
+
+namespace accera::transforms::loopnest
+{
+
+/// Estimates the number of vector registers one iteration of the given schedule's innermost body
+/// needs, from a live-range scan of its kernel bodies. Unroll-and-jam replicates the body, so the
+/// post-interleave demand is this estimate times the product of the schedule's unroll-and-jam
+/// factors.
+int64_t EstimateKernelRegisterPressure(accera::ir::loopnest::ScheduleOp scheduleOp);
+
+/// Reports the estimated register pressure of every unroll-and-jammed schedule in the given
+/// function against the vector register file of the named target device. Emits a remark per
+/// schedule when `printRegisterPressure` is set, and a warning naming the largest non-spilling
+/// interleave factor when the estimate exceeds the register file. When `warningsAsErrors` is set
+/// the overflow warning becomes an error and this function returns failure.
+/// Must run while ScheduleOps and their kernels are still present, i.e. before the loop nest
+/// lowering patterns expand them into loops.
+mlir::LogicalResult EmitRegisterPressureReport(mlir::Operation* op,
+                                               const std::string& targetDeviceName,
+                                               bool printRegisterPressure,
+                                               bool warningsAsErrors);
+
+} // namespace accera::transforms::loopnest
@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <mlir/Support/LogicalResult.h>
+
+#include <string>
+
+namespace mlir
+{
+class Operation;
+} // namespace mlir
+
+namespace accera::transforms::loopnest
+{
+
+/// A build-time roofline estimate for one function, computed from its schedules' iteration
+/// domains and kernel bodies before any lowering. flops counts the floating point operations
+/// across the full iteration space; minBytesMoved is the compulsory traffic (each accessed
+/// buffer's unique footprint, touched at least once). The percent-of-peak figures say what
+/// fraction of the target's peak flop rate the function can sustain if its working set streams
+/// from the given level, i.e. whether the schedule is memory-bound by construction at that level.
+struct RooflineEstimate
+{
+    double flops = 0;
+    double minBytesMoved = 0;
+    double arithmeticIntensity = 0; // flops / minBytesMoved
+    double peakFlopsPerCycle = 0; // f32 lanes x FMA for the target's vector width
+    double percentOfPeakL1 = 0;
+    double percentOfPeakL2 = 0;
+    double percentOfPeakL3 = 0;
+    double percentOfPeakDram = 0;
+};
+
+/// Computes the roofline estimate for the schedules under `op` (a function) against the named
+/// target device, records it on the function as an `accera.roofline` dictionary attribute so it
+/// lands in the emitted package metadata, and emits it as a remark when `printRoofline` is set.
+/// Must run while ScheduleOps and their kernels are still present, i.e. before the loop nest
+/// lowering patterns expand them into loops.
+RooflineEstimate EmitRooflineReport(mlir::Operation* op,
+                                    const std::string& targetDeviceName,
+                                    bool printRoofline);
+
+} // namespace accera::transforms::loopnest
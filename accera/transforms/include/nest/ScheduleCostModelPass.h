@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+
+// fwd decls
+namespace mlir
+{
+class Pass;
+} // namespace mlir
+
+namespace accera::ir::loopnest
+{
+class ScheduleOp;
+} // namespace accera::ir::loopnest
+
+namespace accera::transforms::loopnest
+{
+
+/// Tunable machine parameters for the analytical schedule cost model. The defaults describe a
+/// generic modern x64 core and are good enough for ranking candidate schedules against each other,
+/// which is all the model is meant for.
+struct ScheduleCostModelParameters
+{
+    int64_t cacheLineBytes = 64;
+    int64_t cacheSizeBytes = 32 * 1024; // L1 data cache
+    int64_t vectorWidthBytes = 32; // e.g. AVX2
+    int64_t numVectorRegisters = 16;
+};
+
+/// A coarse analytical estimate of a schedule's quality, computed purely from its iteration-space
+/// transformations (order, splits, unrolls) without lowering it. The absolute numbers are
+/// meaningless; only the relative ordering between candidate schedules for the same nest is.
+struct ScheduleCostEstimate
+{
+    double cacheTrafficEstimate = 0; // estimated cache lines moved per kernel invocation
+    double registerPressureEstimate = 0; // estimated live vector registers in the innermost body
+    double vectorEfficiencyEstimate = 1; // fraction of innermost iterations that fill a full vector
+    double totalCost = 0; // combined score; lower is better
+};
+
+/// Estimates the cost of a single schedule from its transformed iteration domain.
+ScheduleCostEstimate EstimateScheduleCost(accera::ir::loopnest::ScheduleOp scheduleOp, const ScheduleCostModelParameters& parameters = {});
+
+/// Creates a pass that annotates every ScheduleOp with the cost model's estimates, so that tuning
+/// drivers can rank and prune candidate schedules before any of them are lowered.
+std::unique_ptr<mlir::Pass> createScheduleCostModelPass();
+
+} // namespace accera::transforms::loopnest
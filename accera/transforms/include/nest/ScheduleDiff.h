@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// fwd decls
+namespace mlir
+{
+class Pass;
+} // namespace mlir
+
+namespace llvm
+{
+class raw_ostream;
+} // namespace llvm
+
+namespace accera::ir::loopnest
+{
+class ScheduleOp;
+} // namespace accera::ir::loopnest
+
+namespace accera::transforms::loopnest
+{
+
+/// A structured, diffable summary of one schedule: the per-dimension index tree left by splits,
+/// the loop order with each loop's range, and the unroll / vectorization / parallelization
+/// annotations attached through the exec dialect. Loops are named canonically by their dimension
+/// and their depth within that dimension's split chain (e.g. `i.1` for the second loop derived
+/// from dimension `i`), so descriptions of schedules built in different sessions --- whose raw
+/// index ids differ --- still line up when compared.
+struct ScheduleDescription
+{
+    struct LoopEntry
+    {
+        std::string name; // canonical name: <dimension>.<depth in the dimension's chain>
+        std::string dimension; // the original dimension this loop derives from
+        int64_t begin = 0;
+        int64_t end = -1; // -1 when the range isn't a compile-time constant
+        int64_t increment = 1;
+        std::optional<uint64_t> unrollLimit; // set when the loop is marked for unrolling
+        std::optional<uint64_t> unrollAndJamFactor;
+        std::vector<std::string> annotations; // printed exec-dialect loop attributes, sorted
+
+        /// One printable line: range, step, unroll markings and annotations
+        std::string Summary() const;
+    };
+
+    std::string name; // the enclosing symbol, when there is one
+    std::vector<LoopEntry> loops; // in schedule order, outermost first
+    std::map<std::string, std::vector<std::string>> indexTrees; // dimension -> its loops, outermost first
+    double totalIterations = 0; // product of the constant loop ranges
+};
+
+/// Builds the description of one schedule. Must run while the ScheduleOp is still present,
+/// i.e. before the loop nest lowering patterns expand it into loops.
+ScheduleDescription DescribeSchedule(accera::ir::loopnest::ScheduleOp scheduleOp);
+
+/// Prints one schedule's description in a stable, human-readable form.
+void PrintScheduleDescription(const ScheduleDescription& description, llvm::raw_ostream& os);
+
+/// Prints the semantic differences between two schedules --- loops added, removed or reordered,
+/// range and split changes, unroll and exec-annotation changes, iteration count changes --- and
+/// returns true when any difference was found. Identical schedules print nothing.
+bool DiffSchedules(const ScheduleDescription& before, const ScheduleDescription& after, llvm::raw_ostream& os);
+
+/// Creates a pass that prints the description of every schedule in the module and, when the
+/// module holds exactly two schedules, their semantic diff. Running `acc-opt --schedule-diff`
+/// on two snapshot files (or on one module holding a pair of candidate schedules) answers "what
+/// is actually different between these?" without eyeballing IR dumps.
+std::unique_ptr<mlir::Pass> createScheduleDiffPass();
+
+} // namespace accera::transforms::loopnest
@@ -13,4 +13,12 @@
 namespace accera::transforms
 {
 mlir::Value SaturateValue(mlir::PatternRewriter& rewriter, mlir::Value value, int64_t bitWidth, bool isSigned);
+
+// Saturating arithmetic on (scalar or vector) integers stored in a wider type: the operation is
+// computed at full width and the result clamped to the range of a bitWidth-bit integer
+mlir::Value SaturatedAdd(mlir::PatternRewriter& rewriter, mlir::Value lhs, mlir::Value rhs, int64_t bitWidth, bool isSigned);
+mlir::Value SaturatedSub(mlir::PatternRewriter& rewriter, mlir::Value lhs, mlir::Value rhs, int64_t bitWidth, bool isSigned);
+
+// Q-format fixed-point multiply: (lhs * rhs) >> fractionalBits, saturated to bitWidth bits
+mlir::Value SaturatedMulShift(mlir::PatternRewriter& rewriter, mlir::Value lhs, mlir::Value rhs, int64_t fractionalBits, int64_t bitWidth, bool isSigned);
 } // namespace accera::transforms
@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace mlir
+{
+class Pass;
+} // namespace mlir
+
+namespace accera::transforms
+{
+
+struct PassStatisticsOptions
+{
+    // Label for the checkpoint, typically the name of the pass that ran just before it
+    std::string stageName;
+
+    // File to append report rows to; empty writes to stderr
+    std::string reportFilename;
+
+    // Also aggregate wall time and op deltas by stage name across checkpoints and emit totals at exit
+    bool cumulative = false;
+
+    // Fail the pipeline when peak RSS exceeds this many megabytes, naming the offending stage and
+    // the largest function. 0 disables the budget.
+    int64_t memoryBudgetMB = 0;
+
+    // Emit report rows; disabled when only the memory budget is wanted
+    bool reportRows = true;
+};
+
+std::unique_ptr<mlir::Pass> createPassStatisticsPass();
+std::unique_ptr<mlir::Pass> createPassStatisticsPass(const PassStatisticsOptions& options);
+
+} // namespace accera::transforms
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include <transforms/include/util/SnapshotUtilities.h>
 
@@ -34,6 +35,15 @@ class RewritePatternSet;
 
 namespace accera::transforms::value
 {
+// Per-function LLVM backend overrides recorded as function attributes on the lowered functions so
+// they survive translation to LLVM IR and apply regardless of the flags the opt/llc invocation uses
+struct LLVMFunctionAttributeOptions
+{
+    std::string targetCpu;
+    std::string targetFeatures;
+    bool fastMathFuncAttrs = false;
+};
+
 void populateValueToLLVMPatterns(mlir::LLVMTypeConverter& typeConverter, mlir::RewritePatternSet& patterns);
 void populateGlobalValueToLLVMPatterns(mlir::LLVMTypeConverter& typeConverter, mlir::RewritePatternSet& patterns);
 void populateLocalValueToLLVMPatterns(mlir::LLVMTypeConverter& typeConverter, mlir::RewritePatternSet& patterns);
@@ -47,5 +57,6 @@ std::unique_ptr<mlir::OperationPass<mlir::ModuleOp>> createValueToLLVMPass(bool
                                                                            unsigned indexBitwidth,
                                                                            bool useAlignedAlloc,
                                                                            llvm::DataLayout dataLayout,
-                                                                           const IntraPassSnapshotOptions& options = {});
+                                                                           const IntraPassSnapshotOptions& options = {},
+                                                                           const LLVMFunctionAttributeOptions& funcAttrOptions = {});
 } // namespace accera::transforms::value
@@ -46,12 +46,17 @@ struct NestedPassAdaptor;
 // and add nested pass managers
 struct PassManagerAdaptor
 {
-    PassManagerAdaptor(OpPassManager& basePM, bool dumpPasses, const std::string& basename) :
+    PassManagerAdaptor(OpPassManager& basePM, bool dumpPasses, const std::string& basename, const accera::transforms::PassStatisticsOptions* statsOptions = nullptr) :
         _basePM(basePM),
         _idx(0),
         _dumpPasses(dumpPasses),
         _basename(basename)
     {
+        if (statsOptions)
+        {
+            _collectStats = true;
+            _statsOptions = *statsOptions;
+        }
         if (!_basename.empty() && _basename[_basename.size() - 1] != '/' && _basename[_basename.size() - 1] != '\\')
         {
             _basename += "_";
@@ -66,6 +71,10 @@ struct PassManagerAdaptor
         {
             addLocationSnapshot(passName);
         }
+        if (collectStatistics())
+        {
+            addStatisticsCheckpoint(passName);
+        }
     }
 
     template <typename PassManagerGeneratorFn>
@@ -82,10 +91,25 @@ struct PassManagerAdaptor
                 llvm::formatv("{0}{1}_{2}.mlir", _basename, ++_idx, passName).str()));
     }
 
+    bool collectStatistics() const
+    {
+        return _collectStats;
+    }
+
+    void addStatisticsCheckpoint(llvm::StringRef passName)
+    {
+        auto checkpointOptions = _statsOptions;
+        checkpointOptions.stageName = passName.str();
+        _basePM.addPass(accera::transforms::createPassStatisticsPass(checkpointOptions));
+    }
+
     OpPassManager& _basePM;
     size_t _idx;
     bool _dumpPasses;
     std::string _basename;
+    bool _collectStats = false;
+    // The stage name of each checkpoint is replaced with the name of the pass it follows
+    accera::transforms::PassStatisticsOptions _statsOptions;
 };
 
 // Utility adaptor for nested passes that can conditionally:
@@ -109,17 +133,40 @@ struct NestedPassAdaptor
     void addPass(std::unique_ptr<mlir::Pass> pass)
     {
         auto passName = pass->getName();
-        _pmGeneratorFn().addPass(std::move(pass));
-
-        if (_dumpPasses)
+        if (_dumpPasses || _parent.collectStatistics())
         {
-            _parent.addLocationSnapshot(passName);
+            // One nested pass manager per pass, so a snapshot or statistics checkpoint can be taken
+            // after each stage; per-pass statistics trade away the cross-function pipelining below
+            // the same way per-pass snapshots do
+            _pmGeneratorFn().addPass(std::move(pass));
+            if (_dumpPasses)
+            {
+                _parent.addLocationSnapshot(passName);
+            }
+            if (_parent.collectStatistics())
+            {
+                _parent.addStatisticsCheckpoint(passName);
+            }
+        }
+        else
+        {
+            // Re-use a single nested pass manager for all of the passes added via this adaptor.
+            // Keeping the passes in one nested pass manager lets the MLIR pass manager pipeline
+            // them and run them concurrently across the instances of the nested op (e.g. across
+            // the hundreds of ValueFuncOps / FuncOps in a multi-function package), rather than
+            // walking the module serially once per pass.
+            if (!_cachedPM)
+            {
+                _cachedPM = &(_pmGeneratorFn());
+            }
+            _cachedPM->addPass(std::move(pass));
         }
     }
 
     PassManagerAdaptor& _parent;
     PassManagerGeneratorFn _pmGeneratorFn;
     bool _dumpPasses;
+    OpPassManager* _cachedPM = nullptr;
 };
 }; // namespace
 
@@ -139,7 +186,19 @@ void addAcceraToLLVMPassPipeline(OpPassManager& pm, const AcceraPassPipelineOpti
 
     accera::value::ExecutionRuntime execRuntime = options.runtime;
 
-    PassManagerAdaptor pmAdaptor(pm, options.dumpPasses.getValue(), options.basename);
+    // A memory budget alone also needs the checkpoints, but without the report spam
+    PassStatisticsOptions statsOptions{ /*stageName=*/"input",
+                                        options.passStatisticsFile.getValue(),
+                                        options.passStatisticsCumulative.getValue(),
+                                        options.passMemoryBudgetMB.getValue(),
+                                        /*reportRows=*/options.passStatistics.getValue() };
+    bool collectStatistics = options.passStatistics.getValue() || options.passMemoryBudgetMB.getValue() > 0;
+    PassManagerAdaptor pmAdaptor(pm, options.dumpPasses.getValue(), options.basename, collectStatistics ? &statsOptions : nullptr);
+    if (pmAdaptor.collectStatistics())
+    {
+        // Baseline checkpoint so the first pass's row reports the input module's size
+        pmAdaptor.addStatisticsCheckpoint("input");
+    }
     pmAdaptor.addPass(createEmitDebugFunctionPass());
 
     auto valueFuncOpPM = pmAdaptor.nestPassManager([&]() -> OpPassManager& { return pm.nest<v::ValueModuleOp>().nest<v::ValueFuncOp>(); });
@@ -147,7 +206,7 @@ void addAcceraToLLVMPassPipeline(OpPassManager& pm, const AcceraPassPipelineOpti
     // Can't use ValueSimplify here because ExecToAffine doesn't know how to handle "simplified" ops (memref::SubView, etc.)
     // valueFuncOpPM.addPass(value::createValueSimplifyPass());
     valueFuncOpPM.addPass(createCanonicalizerPass());
-    valueFuncOpPM.addPass(loopnest::createLoopNestToValueFuncPass({ { options.dumpIntraPassIR.getValue(), options.basename + "LoopNestToValueFuncPass_Subpasses" }, options.printLoops.getValue(), options.printVecOpDetails.getValue() }));
+    valueFuncOpPM.addPass(loopnest::createLoopNestToValueFuncPass({ { options.dumpIntraPassIR.getValue(), options.basename + "LoopNestToValueFuncPass_Subpasses" }, options.printLoops.getValue(), options.printVecOpDetails.getValue(), options.printCacheFootprints.getValue(), options.strictCacheFootprint.getValue(), options.printRegisterPressure.getValue(), options.strictRegisterPressure.getValue(), options.printRoofline.getValue(), options.instrumentCacheCopies.getValue(), options.target.getValue() }));
 
     pmAdaptor.addPass(value::createValueFuncToTargetPass());
     pmAdaptor.addPass(createSymbolDCEPass());
@@ -158,9 +217,15 @@ void addAcceraToLLVMPassPipeline(OpPassManager& pm, const AcceraPassPipelineOpti
     funcOpPM.addPass(createCanonicalizerPass());
     funcOpPM.addPass(createLoopInvariantCodeMotionPass());
     funcOpPM.addPass(createCSEPass());
+    // Run after CSE so references to the same cache buffer have been merged and the fusion
+    // legality check can compare buffers by identity
+    funcOpPM.addPass(affine::createCacheFillFusionPass());
 
     pmAdaptor.addPass(createConvertSCFToOpenMPPass());
     pmAdaptor.addPass(value::createValueToStdPass(options.enableProfile));
+    // Allocations exist as memref.alloc ops now, so functions tagged for a
+    // caller-provided workspace can have theirs folded into the workspace arg
+    pmAdaptor.addPass(value::createCallerWorkspacePass());
     pmAdaptor.addPass(value::createRangeValueOptimizePass());
     pmAdaptor.addPass(createCanonicalizerPass());
     pmAdaptor.addPass(createCSEPass());
@@ -213,6 +278,9 @@ void addAcceraToLLVMPassPipeline(OpPassManager& pm, const AcceraPassPipelineOpti
             // TODO: enable this codepath when we add nvvm lowering, also enable NVVM translation in DialectRegistry.cpp
             //gpuModulePM.addPass(createLowerGpuOpsToNVVMOpsPass(32));
         }
+        // Validate the launch configuration against the target's multiprocessor limits and
+        // record launch bounds before the kernel is emitted
+        gpuModulePM.addPass(createGPUOccupancyCheckPass());
         gpuModulePM.addPass(createStripDebugInfoPass());
         if (options.gpuOnly) return;
     }
@@ -235,13 +303,18 @@ void addAcceraToLLVMPassPipeline(OpPassManager& pm, const AcceraPassPipelineOpti
         if (options.enableAsync) funcPm.addPass(createGpuAsyncRegionPass());
     }
 
+    value::LLVMFunctionAttributeOptions funcAttrOptions;
+    funcAttrOptions.targetCpu = options.llvmTargetCpu.getValue();
+    funcAttrOptions.targetFeatures = options.llvmTargetFeatures.getValue();
+    funcAttrOptions.fastMathFuncAttrs = options.llvmFastMathFuncAttrs.getValue();
     pmAdaptor.addPass(value::createValueToLLVMPass(
         /* useBasePtrCallConv = */ false,
         /* emitCWrappers = */ false,
         /* indexBitwidth = */ kDeriveIndexBitwidthFromDataLayout,
         /* useAlignedAlloc = */ true,
         /* dataLayout = */ llvm::DataLayout(accera::value::GetTargetDevice(options.target).dataLayout),
-        { options.dumpIntraPassIR.getValue(), options.basename + "ValueToLLVM_Subpasses" }));
+        { options.dumpIntraPassIR.getValue(), options.basename + "ValueToLLVM_Subpasses" },
+        funcAttrOptions));
     pmAdaptor.addPass(createCanonicalizerPass());
     pmAdaptor.addPass(LLVM::createLegalizeForExportPass());
     pmAdaptor.addPass(value::createFunctionPointerResolutionPass());
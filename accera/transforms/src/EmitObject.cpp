@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "EmitObject.h"
+
+#include <ir/include/InitializeAccera.h>
+#include <value/include/TargetDevice.h>
+
+#include <mlir/ExecutionEngine/OptUtils.h>
+#include <mlir/Pass/PassManager.h>
+#include <mlir/Target/LLVMIR/Export.h>
+
+#include <llvm/ADT/StringSet.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+
+#include <memory>
+#include <stdexcept>
+
+using namespace mlir;
+
+namespace accera::transforms
+{
+
+namespace
+{
+    std::unique_ptr<llvm::TargetMachine> CreateTargetMachine(const AcceraPassPipelineOptions& pipelineOptions, unsigned optimizationLevel)
+    {
+        auto targetDevice = accera::value::GetTargetDevice(pipelineOptions.target);
+
+        // The pipeline's explicit cpu/features options take precedence over the ones implied by
+        // the device name, matching how createValueToLLVMPass consumes them
+        auto cpu = pipelineOptions.llvmTargetCpu.getValue().empty() ? targetDevice.cpu : pipelineOptions.llvmTargetCpu.getValue();
+        auto features = pipelineOptions.llvmTargetFeatures.getValue().empty() ? targetDevice.features : pipelineOptions.llvmTargetFeatures.getValue();
+
+        std::string error;
+        const llvm::Target* target = llvm::TargetRegistry::lookupTarget(targetDevice.triple, error);
+        if (target == nullptr)
+        {
+            throw std::runtime_error("Couldn't create target: " + error);
+        }
+
+        const llvm::TargetOptions targetOptions;
+        const auto relocModel = llvm::Reloc::Model::PIC_;
+
+        // Aarch64 only supports Tiny, Small, Large
+        const llvm::CodeModel::Model codeModel = (targetDevice.architecture == "aarch64") ? llvm::CodeModel::Small : llvm::CodeModel::Medium;
+
+        std::unique_ptr<llvm::TargetMachine> targetMachine(target->createTargetMachine(targetDevice.triple,
+                                                                                       cpu,
+                                                                                       features,
+                                                                                       targetOptions,
+                                                                                       relocModel,
+                                                                                       codeModel,
+                                                                                       static_cast<llvm::CodeGenOpt::Level>(std::min(optimizationLevel, 3u))));
+        if (!targetMachine)
+        {
+            throw std::runtime_error("Unable to allocate target machine");
+        }
+        return targetMachine;
+    }
+
+    void WriteDumpFile(const std::string& filename, llvm::function_ref<void(llvm::raw_ostream&)> printFn)
+    {
+        std::error_code ec;
+        llvm::raw_fd_ostream out(filename, ec, llvm::sys::fs::OF_None);
+        if (ec)
+        {
+            throw std::runtime_error("Couldn't write dump file " + filename + ": " + ec.message());
+        }
+        printFn(out);
+    }
+
+    // Lowers the module through the Accera MLIR pipeline (on a clone, so the caller's module
+    // stays intact) and translates it to LLVM IR in the given context
+    std::unique_ptr<llvm::Module> LowerAndTranslate(mlir::ModuleOp module,
+                                                    const AcceraPassPipelineOptions& pipelineOptions,
+                                                    llvm::LLVMContext& llvmContext,
+                                                    const std::string& dumpBasename)
+    {
+        mlir::OwningOpRef<mlir::ModuleOp> loweredModule(module.clone());
+
+        mlir::PassManager pm(loweredModule->getContext());
+        addAcceraToLLVMPassPipeline(pm, pipelineOptions);
+        if (mlir::failed(pm.run(*loweredModule)))
+        {
+            throw std::runtime_error("failed to lower module to llvm dialect!");
+        }
+        if (!dumpBasename.empty())
+        {
+            WriteDumpFile(dumpBasename + "_llvm.mlir", [&](llvm::raw_ostream& out) { loweredModule->print(out); });
+        }
+
+        auto llvmModule = mlir::translateModuleToLLVMIR(*loweredModule, llvmContext);
+        if (!llvmModule)
+        {
+            throw std::runtime_error("failed to translate module to LLVM IR!");
+        }
+        return llvmModule;
+    }
+
+    // Optimizes the translated module for the given target and runs codegen, returning the
+    // object file contents
+    std::vector<char> OptimizeAndEmit(llvm::Module& llvmModule,
+                                      llvm::TargetMachine& targetMachine,
+                                      const ObjectEmissionOptions& emissionOptions)
+    {
+        const auto& dumpBasename = emissionOptions.dumpBasename;
+
+        llvmModule.setTargetTriple(targetMachine.getTargetTriple().getTriple());
+        llvmModule.setDataLayout(targetMachine.createDataLayout());
+        if (!dumpBasename.empty())
+        {
+            WriteDumpFile(dumpBasename + ".ll", [&](llvm::raw_ostream& out) { llvmModule.print(out, nullptr); });
+        }
+
+        auto optPipeline = mlir::makeOptimizingTransformer(emissionOptions.optimizationLevel, emissionOptions.sizeLevel, &targetMachine);
+        if (auto error = optPipeline(&llvmModule))
+        {
+            throw std::runtime_error("failed to optimize LLVM IR: " + llvm::toString(std::move(error)));
+        }
+        if (!dumpBasename.empty())
+        {
+            WriteDumpFile(dumpBasename + "_opt.ll", [&](llvm::raw_ostream& out) { llvmModule.print(out, nullptr); });
+        }
+
+        llvm::SmallVector<char, 0> objectBuffer;
+        llvm::raw_svector_ostream objectStream(objectBuffer);
+        llvm::legacy::PassManager codegenPasses;
+        if (targetMachine.addPassesToEmitFile(codegenPasses, objectStream, nullptr, llvm::CGFT_ObjectFile))
+        {
+            throw std::runtime_error("target machine can't emit an object file!");
+        }
+        codegenPasses.run(llvmModule);
+
+        return { objectBuffer.begin(), objectBuffer.end() };
+    }
+
+    // Gives internal linkage to every definition not on the exported list, so that the package's
+    // shared packing/init helpers become candidates for inlining and global DCE instead of
+    // surviving as externally-visible call targets
+    void InternalizeNonExportedSymbols(llvm::Module& llvmModule, const std::vector<std::string>& exportedSymbols)
+    {
+        llvm::StringSet<> exported;
+        for (const auto& symbol : exportedSymbols)
+        {
+            exported.insert(symbol);
+        }
+
+        auto internalize = [&](llvm::GlobalValue& globalValue) {
+            if (globalValue.isDeclaration() || exported.contains(globalValue.getName()))
+            {
+                return;
+            }
+            // llvm.used / llvm.global_ctors entries and comdat members have visibility
+            // requirements of their own; leave anything unusual alone
+            if (globalValue.hasLocalLinkage() || globalValue.hasAppendingLinkage() || globalValue.hasComdat())
+            {
+                return;
+            }
+            globalValue.setLinkage(llvm::GlobalValue::InternalLinkage);
+            globalValue.setVisibility(llvm::GlobalValue::DefaultVisibility);
+        };
+
+        for (auto& function : llvmModule.functions())
+        {
+            internalize(function);
+        }
+        for (auto& global : llvmModule.globals())
+        {
+            internalize(global);
+        }
+        for (auto& alias : llvmModule.aliases())
+        {
+            internalize(alias);
+        }
+    }
+} // namespace
+
+std::vector<char> EmitObjectCode(mlir::ModuleOp module,
+                                 const AcceraPassPipelineOptions& pipelineOptions,
+                                 const ObjectEmissionOptions& emissionOptions)
+{
+    accera::ir::InitializeAccera();
+
+    llvm::LLVMContext llvmContext;
+    auto llvmModule = LowerAndTranslate(module, pipelineOptions, llvmContext, emissionOptions.dumpBasename);
+
+    auto targetMachine = CreateTargetMachine(pipelineOptions, emissionOptions.optimizationLevel);
+    return OptimizeAndEmit(*llvmModule, *targetMachine, emissionOptions);
+}
+
+std::vector<char> EmitPackageObjectCode(llvm::ArrayRef<mlir::ModuleOp> modules,
+                                        const std::vector<std::string>& exportedSymbols,
+                                        const AcceraPassPipelineOptions& pipelineOptions,
+                                        const ObjectEmissionOptions& emissionOptions)
+{
+    accera::ir::InitializeAccera();
+
+    if (modules.empty())
+    {
+        throw std::runtime_error("no modules given to emit!");
+    }
+
+    // Lower and translate every function module into one LLVM context, then link them into a
+    // single module. Linking before optimization is what lets the shared helpers inline into
+    // their callers; per-module emission compiles each call in isolation.
+    llvm::LLVMContext llvmContext;
+    const auto& dumpBasename = emissionOptions.dumpBasename;
+    auto perModuleBasename = [&](size_t index) {
+        return dumpBasename.empty() ? dumpBasename : dumpBasename + "_" + std::to_string(index);
+    };
+
+    auto linkedModule = LowerAndTranslate(modules.front(), pipelineOptions, llvmContext, perModuleBasename(0));
+    llvm::Linker linker(*linkedModule);
+    for (size_t i = 1; i < modules.size(); ++i)
+    {
+        auto llvmModule = LowerAndTranslate(modules[i], pipelineOptions, llvmContext, perModuleBasename(i));
+        if (linker.linkInModule(std::move(llvmModule)))
+        {
+            throw std::runtime_error("failed to link module " + std::to_string(i) + " into the package module!");
+        }
+    }
+
+    InternalizeNonExportedSymbols(*linkedModule, exportedSymbols);
+
+    auto targetMachine = CreateTargetMachine(pipelineOptions, emissionOptions.optimizationLevel);
+    return OptimizeAndEmit(*linkedModule, *targetMachine, emissionOptions);
+}
+
+void EmitObjectFile(mlir::ModuleOp module,
+                    const std::string& outputPath,
+                    const AcceraPassPipelineOptions& pipelineOptions,
+                    const ObjectEmissionOptions& emissionOptions)
+{
+    auto objectCode = EmitObjectCode(module, pipelineOptions, emissionOptions);
+
+    std::error_code ec;
+    llvm::raw_fd_ostream out(outputPath, ec, llvm::sys::fs::OF_None);
+    if (ec)
+    {
+        throw std::runtime_error("Couldn't write object file " + outputPath + ": " + ec.message());
+    }
+    out.write(objectCode.data(), objectCode.size());
+}
+
+} // namespace accera::transforms
@@ -480,6 +480,172 @@ struct SmallNumeratorTermModSimplification : public OpRewritePattern<AffineOpTy>
     }
 };
 
+// Flattens an Add expression tree into its individual terms
+void GatherSumTerms(mlir::AffineExpr expr, std::vector<mlir::AffineExpr>& terms)
+{
+    if (expr.getKind() == mlir::AffineExprKind::Add)
+    {
+        auto binOp = expr.cast<mlir::AffineBinaryOpExpr>();
+        GatherSumTerms(binOp.getLHS(), terms);
+        GatherSumTerms(binOp.getRHS(), terms);
+    }
+    else
+    {
+        terms.push_back(expr);
+    }
+}
+
+// Returns true if modExpr is (e mod c) reconstructing the low bits of the quotient expression e
+// in quotientExpr = (e floordiv c). Multi-level splits mod out the outer split factor first, so
+// (e' mod c2) floordiv c paired with e' mod c also reconstructs when c divides c2, as
+// (e' mod c2) mod c == e' mod c in that case
+bool IsMatchingModTerm(mlir::AffineExpr quotientNumerator, mlir::AffineExpr modLhs, int64_t divisor)
+{
+    if (quotientNumerator == modLhs)
+    {
+        return true;
+    }
+    if (quotientNumerator.getKind() == mlir::AffineExprKind::Mod)
+    {
+        auto numeratorModOp = quotientNumerator.cast<mlir::AffineBinaryOpExpr>();
+        if (auto outerFactor = numeratorModOp.getRHS().dyn_cast<mlir::AffineConstantExpr>())
+        {
+            return numeratorModOp.getLHS() == modLhs && outerFactor.getValue() % divisor == 0;
+        }
+    }
+    return false;
+}
+
+// Collapses split-index reconstruction patterns of the form ((e floordiv c) * c + e mod c) to e.
+// This is the Euclidean division identity, so no range facts are needed; it holds for any
+// sub-expression e and positive constant c. Multi-level splits produce nested instances
+// (e.g. (i floordiv 256) * 256 + ((i mod 256) floordiv 16) * 16 + i mod 16), which collapse
+// pairwise from the innermost split outward
+mlir::AffineExpr CollapseSplitReconstruction(mlir::AffineExpr expr)
+{
+    auto binOp = expr.dyn_cast<mlir::AffineBinaryOpExpr>();
+    if (!binOp)
+    {
+        return expr;
+    }
+
+    // Simplify sub-expressions first so that reconstructions nested inside floordiv / mod
+    // numerators collapse before the enclosing expression is examined
+    auto newExpr = mlir::getAffineBinaryOpExpr(binOp.getKind(),
+                                               CollapseSplitReconstruction(binOp.getLHS()),
+                                               CollapseSplitReconstruction(binOp.getRHS()));
+    if (newExpr.getKind() != mlir::AffineExprKind::Add)
+    {
+        return newExpr;
+    }
+
+    std::vector<mlir::AffineExpr> terms;
+    GatherSumTerms(newExpr, terms);
+
+    bool collapsed = false;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t quotientIdx = 0; quotientIdx < terms.size() && !changed; ++quotientIdx)
+        {
+            // Look for a ((e floordiv c) * c) term; canonicalization keeps constants on the RHS
+            if (terms[quotientIdx].getKind() != mlir::AffineExprKind::Mul)
+            {
+                continue;
+            }
+            auto mulOp = terms[quotientIdx].cast<mlir::AffineBinaryOpExpr>();
+            auto mulConstant = mulOp.getRHS().dyn_cast<mlir::AffineConstantExpr>();
+            if (!mulConstant || mulOp.getLHS().getKind() != mlir::AffineExprKind::FloorDiv)
+            {
+                continue;
+            }
+            auto floorDivOp = mulOp.getLHS().cast<mlir::AffineBinaryOpExpr>();
+            auto divisorConstant = floorDivOp.getRHS().dyn_cast<mlir::AffineConstantExpr>();
+            if (!divisorConstant || divisorConstant.getValue() <= 0 || divisorConstant.getValue() != mulConstant.getValue())
+            {
+                continue;
+            }
+
+            // Find the partner (e mod c) term
+            for (size_t modIdx = 0; modIdx < terms.size(); ++modIdx)
+            {
+                if (modIdx == quotientIdx || terms[modIdx].getKind() != mlir::AffineExprKind::Mod)
+                {
+                    continue;
+                }
+                auto modOp = terms[modIdx].cast<mlir::AffineBinaryOpExpr>();
+                auto modConstant = modOp.getRHS().dyn_cast<mlir::AffineConstantExpr>();
+                if (!modConstant || modConstant.getValue() != divisorConstant.getValue())
+                {
+                    continue;
+                }
+                if (!IsMatchingModTerm(floorDivOp.getLHS(), modOp.getLHS(), divisorConstant.getValue()))
+                {
+                    continue;
+                }
+
+                terms[quotientIdx] = floorDivOp.getLHS();
+                terms.erase(terms.begin() + modIdx);
+                collapsed = true;
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    if (!collapsed)
+    {
+        return newExpr;
+    }
+
+    mlir::AffineExpr sumExpr = terms.front();
+    for (size_t idx = 1; idx < terms.size(); ++idx)
+    {
+        sumExpr = sumExpr + terms[idx];
+    }
+    return sumExpr;
+}
+
+// Eliminates the floordiv/mod chains that reconstruct a pre-split index, e.g. the
+// ((i floordiv 16) * 16 + i mod 16) address expressions left behind by multi-level
+// Split / Fuse transformations, which otherwise materialize as real arithmetic in the
+// inner loop. Residual terms whose ranges make them droppable are handled separately
+// by the small-numerator patterns above
+template <typename AffineOpTy>
+struct SplitIndexReconstructionSimplification : public OpRewritePattern<AffineOpTy>
+{
+    using OpRewritePattern<AffineOpTy>::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(AffineOpTy affineOp, PatternRewriter& rewriter) const final
+    {
+        auto map = affineOp.getAffineMap();
+        auto exprs = map.getResults();
+        MutableAffineMap mutableMap(map);
+        bool modifiedMap = false;
+        for (size_t exprIdx = 0; exprIdx < exprs.size(); ++exprIdx)
+        {
+            auto newExpr = CollapseSplitReconstruction(exprs[exprIdx]);
+            newExpr = mlir::simplifyAffineExpr(newExpr, map.getNumDims(), map.getNumSymbols());
+            if (newExpr != exprs[exprIdx])
+            {
+                mutableMap.setResult(exprIdx, newExpr);
+                modifiedMap = true;
+            }
+        }
+
+        if (modifiedMap)
+        {
+            auto newMap = mutableMap.getAffineMap();
+            mlir::AffineValueMap newAffineValueMap(newMap, affineOp.getMapOperands());
+            (void)newAffineValueMap.canonicalize();
+            ReplaceOpUsingNewValueMap(rewriter, affineOp, newAffineValueMap);
+            return success();
+        }
+        return failure();
+    }
+};
+
 template <typename AffineOpTy>
 struct PropagateGPUConstants : public OpRewritePattern<AffineOpTy>
 {
@@ -570,6 +736,9 @@ void populateAcceraAffineSimplificationPatterns(mlir::OwningRewritePatternList&
     patterns.insert<SmallNumeratorTermModSimplification<mlir::AffineLoadOp>>(patterns.getContext());
     patterns.insert<SmallNumeratorTermModSimplification<mlir::AffineStoreOp>>(patterns.getContext());
     patterns.insert<SmallNumeratorTermModSimplification<mlir::AffineApplyOp>>(patterns.getContext());
+    patterns.insert<SplitIndexReconstructionSimplification<mlir::AffineLoadOp>>(patterns.getContext());
+    patterns.insert<SplitIndexReconstructionSimplification<mlir::AffineStoreOp>>(patterns.getContext());
+    patterns.insert<SplitIndexReconstructionSimplification<mlir::AffineApplyOp>>(patterns.getContext());
     patterns.insert<PropagateGPUConstants<mlir::AffineLoadOp>>(patterns.getContext());
     patterns.insert<PropagateGPUConstants<mlir::AffineStoreOp>>(patterns.getContext());
     patterns.insert<PropagateGPUConstants<mlir::AffineApplyOp>>(patterns.getContext());
@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AcceraPasses.h"
+
+#include "affine/CacheFillFusion.h"
+
+#include <ir/include/exec/ExecutionPlanOps.h>
+
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+#include <mlir/IR/Operation.h>
+
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/SmallPtrSet.h>
+
+using namespace mlir;
+
+namespace
+{
+
+// Caches created at the same trigger index each lower to their own copy loopnest, so filling
+// several arrays re-streams the same index space once per cache and pays the loop overhead
+// repeatedly. The loops of those fill nests are tagged with CacheFillNestAttrName by the cache
+// lowering, and this pass fuses adjacent tagged nests with identical bounds into one interleaved
+// copy loop when their memory accesses are provably independent.
+
+bool IsCacheFillLoop(AffineForOp forOp)
+{
+    return forOp->hasAttr(accera::ir::executionPlan::CacheFillNestAttrName);
+}
+
+bool HaveIdenticalBounds(AffineForOp first, AffineForOp second)
+{
+    return first.getNumIterOperands() == 0 &&
+           second.getNumIterOperands() == 0 &&
+           first.getStep() == second.getStep() &&
+           first.getLowerBoundMap() == second.getLowerBoundMap() &&
+           first.getUpperBoundMap() == second.getUpperBoundMap() &&
+           llvm::equal(first.getLowerBoundOperands(), second.getLowerBoundOperands()) &&
+           llvm::equal(first.getUpperBoundOperands(), second.getUpperBoundOperands());
+}
+
+// Collects the memrefs read and written inside the given loop nest. Returns false if the nest
+// contains an op this pass doesn't understand well enough to reason about fusing around
+bool CollectNestAccesses(AffineForOp root,
+                         llvm::SmallPtrSetImpl<void*>& reads,
+                         llvm::SmallPtrSetImpl<void*>& writes)
+{
+    auto result = root.walk([&](Operation* op) {
+        if (auto loadOp = dyn_cast<AffineReadOpInterface>(op))
+        {
+            reads.insert(loadOp.getMemRef().getAsOpaquePointer());
+            return WalkResult::advance();
+        }
+        if (auto storeOp = dyn_cast<AffineWriteOpInterface>(op))
+        {
+            writes.insert(storeOp.getMemRef().getAsOpaquePointer());
+            return WalkResult::advance();
+        }
+        if (auto loadOp = dyn_cast<memref::LoadOp>(op))
+        {
+            reads.insert(loadOp.getMemRef().getAsOpaquePointer());
+            return WalkResult::advance();
+        }
+        if (auto storeOp = dyn_cast<memref::StoreOp>(op))
+        {
+            writes.insert(storeOp.getMemRef().getAsOpaquePointer());
+            return WalkResult::advance();
+        }
+        if (auto prefetchOp = dyn_cast<AffinePrefetchOp>(op))
+        {
+            // Prefetches are hints, but keep the prefetched memref as a read so a fused
+            // nest doesn't reorder one across a store to the same buffer
+            reads.insert(prefetchOp.memref().getAsOpaquePointer());
+            return WalkResult::advance();
+        }
+        if (isa<AffineForOp, AffineIfOp, AffineYieldOp, AffineApplyOp>(op))
+        {
+            return WalkResult::advance();
+        }
+        if (auto memEffects = dyn_cast<MemoryEffectOpInterface>(op))
+        {
+            if (memEffects.hasNoEffect())
+            {
+                return WalkResult::advance();
+            }
+        }
+        return WalkResult::interrupt();
+    });
+    return !result.wasInterrupted();
+}
+
+// The fill nests being fused copy between distinct buffers, so independence reduces to no
+// buffer being written in one nest and touched in the other. Memrefs are compared by value
+// identity, which is sound here because the written buffers are the per-cache allocations
+// and this pass runs after CSE has merged duplicate references to the same buffer
+bool AccessesConflict(const llvm::SmallPtrSetImpl<void*>& firstReads,
+                      const llvm::SmallPtrSetImpl<void*>& firstWrites,
+                      const llvm::SmallPtrSetImpl<void*>& secondReads,
+                      const llvm::SmallPtrSetImpl<void*>& secondWrites)
+{
+    for (auto memref : firstWrites)
+    {
+        if (secondReads.count(memref) || secondWrites.count(memref))
+        {
+            return true;
+        }
+    }
+    for (auto memref : secondWrites)
+    {
+        if (firstReads.count(memref))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Checks that every op between the two loops can be moved ahead of the first loop to make
+// them adjacent. The values those ops produce are all defined before the first loop already,
+// so side-effect-free ops are safe to hoist
+bool CanHoistInterveningOps(AffineForOp first, AffineForOp second)
+{
+    for (auto* op = first->getNextNode(); op != second.getOperation(); op = op->getNextNode())
+    {
+        auto memEffects = dyn_cast<MemoryEffectOpInterface>(op);
+        if (!memEffects || !memEffects.hasNoEffect() || op->getNumRegions() != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CanFuse(AffineForOp first, AffineForOp second)
+{
+    if (!IsCacheFillLoop(first) || !IsCacheFillLoop(second))
+    {
+        return false;
+    }
+    if (!HaveIdenticalBounds(first, second))
+    {
+        return false;
+    }
+    if (!CanHoistInterveningOps(first, second))
+    {
+        return false;
+    }
+    llvm::SmallPtrSet<void*, 4> firstReads;
+    llvm::SmallPtrSet<void*, 4> firstWrites;
+    llvm::SmallPtrSet<void*, 4> secondReads;
+    llvm::SmallPtrSet<void*, 4> secondWrites;
+    if (!CollectNestAccesses(first, firstReads, firstWrites) ||
+        !CollectNestAccesses(second, secondReads, secondWrites))
+    {
+        return false;
+    }
+    return !AccessesConflict(firstReads, firstWrites, secondReads, secondWrites);
+}
+
+void FuseLoops(AffineForOp first, AffineForOp second)
+{
+    // Make the loops adjacent, then move the second loop's body ahead of the first loop's
+    // terminator. Any inner fill loops that become adjacent get fused by a later iteration
+    // of the fixpoint walk
+    while (auto* interveningOp = first->getNextNode())
+    {
+        if (interveningOp == second.getOperation())
+        {
+            break;
+        }
+        interveningOp->moveBefore(first);
+    }
+    second.getInductionVar().replaceAllUsesWith(first.getInductionVar());
+    auto& firstOps = first.getBody()->getOperations();
+    auto& secondOps = second.getBody()->getOperations();
+    firstOps.splice(std::prev(firstOps.end()), secondOps, secondOps.begin(), std::prev(secondOps.end()));
+    second.erase();
+}
+
+struct CacheFillFusionPass : public accera::transforms::AcceraCacheFillFusionBase<CacheFillFusionPass>
+{
+    void runOnOperation() final
+    {
+        auto op = getOperation();
+
+        // Fuse one pair at a time and restart the walk so the traversal never visits erased ops,
+        // re-examining merged nests until no adjacent compatible fills remain
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            op->walk([&](AffineForOp forOp) {
+                auto nextLoop = ForwardToNextFusableLoop(forOp);
+                if (nextLoop && CanFuse(forOp, nextLoop))
+                {
+                    FuseLoops(forOp, nextLoop);
+                    changed = true;
+                    return WalkResult::interrupt();
+                }
+                return WalkResult::advance();
+            });
+        }
+    }
+
+private:
+    // Finds the next cache fill loop in the block after the given loop, as long as only
+    // hoistable ops sit between them
+    AffineForOp ForwardToNextFusableLoop(AffineForOp forOp)
+    {
+        for (auto* op = forOp->getNextNode(); op != nullptr; op = op->getNextNode())
+        {
+            if (auto nextLoop = dyn_cast<AffineForOp>(op))
+            {
+                return nextLoop;
+            }
+            auto memEffects = dyn_cast<MemoryEffectOpInterface>(op);
+            if (!memEffects || !memEffects.hasNoEffect() || op->getNumRegions() != 0)
+            {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+};
+
+} // namespace
+
+namespace accera::transforms::affine
+{
+std::unique_ptr<mlir::Pass> createCacheFillFusionPass()
+{
+    return std::make_unique<CacheFillFusionPass>();
+}
+} // namespace accera::transforms::affine
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "exec/CacheCopyInstrumentation.h"
+
+#include <ir/include/IRUtil.h>
+#include <ir/include/exec/ExecutionPlanOps.h>
+#include <ir/include/value/ValueDialect.h>
+
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/SCF/SCF.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/Operation.h>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/TypeSwitch.h>
+
+#include <string>
+
+using namespace mlir;
+
+namespace vir = accera::ir::value;
+namespace xpir = accera::ir::executionPlan;
+
+namespace
+{
+
+// The bytes one invocation moves, taken from the cache buffer's static footprint. Boundary
+// invocations may move less, so this is the steady-state figure.
+int64_t GetCacheBytes(mlir::Value cache)
+{
+    auto memrefType = cache.getType().dyn_cast<mlir::MemRefType>();
+    if (!memrefType || !memrefType.hasStaticShape())
+    {
+        return 0;
+    }
+    auto elementType = memrefType.getElementType();
+    int64_t elementBytes = elementType.isIntOrFloat() ? elementType.getIntOrFloatBitWidth() / 8 : 8;
+    return memrefType.getNumElements() * elementBytes;
+}
+
+// How many loops enclose the op within the function: the level the copy fires at, which
+// determines its invocation count
+int64_t GetLoopLevel(Operation* op)
+{
+    int64_t level = 0;
+    for (auto* parent = op->getParentOp(); parent; parent = parent->getParentOp())
+    {
+        if (isa<mlir::AffineForOp, mlir::scf::ForOp>(parent))
+        {
+            ++level;
+        }
+    }
+    return level;
+}
+
+void WrapInProfileRegion(Operation* op, const std::string& regionName)
+{
+    OpBuilder builder(op);
+    builder.create<vir::EnterProfileRegionOp>(op->getLoc(), regionName);
+    builder.setInsertionPointAfter(op);
+    builder.create<vir::ExitProfileRegionOp>(op->getLoc(), regionName);
+}
+
+} // namespace
+
+namespace accera::transforms::executionPlan
+{
+
+void InstrumentCacheCopies(mlir::Operation* op)
+{
+    auto fnName = [&]() -> std::string {
+        if (auto symbol = op->getAttrOfType<StringAttr>(mlir::SymbolTable::getSymbolAttrName()))
+        {
+            return symbol.getValue().str();
+        }
+        return "fn";
+    }();
+
+    // Collect before mutating: inserting while walking would revisit the inserted ops
+    llvm::SmallVector<std::pair<Operation*, std::string>, 8> targets;
+    auto makeRegionName = [&](Operation* targetOp, const char* kind, mlir::Value cache) {
+        // The unique id keeps copies that share a kind, level, and size from aliasing one
+        // counter, including across the instrumentation runs of a multi-nest function
+        auto name = fnName + "_cache_" + kind +
+                    "_level" + std::to_string(GetLoopLevel(targetOp)) +
+                    "_" + std::to_string(GetCacheBytes(cache)) + "B" +
+                    "_" + std::to_string(accera::ir::util::GetUniqueId(targetOp));
+        targets.emplace_back(targetOp, name);
+    };
+
+    op->walk([&](Operation* walkedOp) {
+        llvm::TypeSwitch<Operation*>(walkedOp)
+            .Case([&](xpir::ActiveBlockCacheCopyOp copyOp) {
+                makeRegionName(copyOp, copyOp.toCache() ? "fill" : "writeback", copyOp.cache());
+            })
+            .Case([&](xpir::ActiveElementCacheCopyOp copyOp) {
+                makeRegionName(copyOp, "element_copy", copyOp.dst());
+            })
+            .Case([&](xpir::MultiCacheCopyOp copyOp) {
+                makeRegionName(copyOp, "multicache_fill", copyOp.cache());
+            })
+            .Case([&](xpir::ActiveBlockCacheReduceOp reduceOp) {
+                makeRegionName(reduceOp, "reduce", reduceOp.cache());
+            })
+            .Case([&](xpir::ActiveElementCacheReduceOp reduceOp) {
+                makeRegionName(reduceOp, "element_reduce", reduceOp.srcCache());
+            })
+            .Case([&](xpir::CacheZeroOp zeroOp) {
+                makeRegionName(zeroOp, "zero", zeroOp.cache());
+            });
+    });
+
+    if (targets.empty())
+    {
+        return;
+    }
+
+    for (auto& [targetOp, regionName] : targets)
+    {
+        WrapInProfileRegion(targetOp, regionName);
+    }
+
+    // Dump the accumulated counters on the way out of the function. Instrumentation may run
+    // once per nest in a multi-nest function, so only add the dump the first time through.
+    bool alreadyDumps = false;
+    op->walk([&](vir::PrintProfileResultsOp) { alreadyDumps = true; });
+    if (!alreadyDumps)
+    {
+        op->walk([&](vir::ReturnOp returnOp) {
+            if (returnOp->getParentOp() == op)
+            {
+                OpBuilder builder(returnOp);
+                builder.create<vir::PrintProfileResultsOp>(returnOp.getLoc());
+            }
+        });
+    }
+}
+
+} // namespace accera::transforms::executionPlan
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "exec/CacheFootprintReport.h"
+
+#include <ir/include/exec/ExecutionPlanOps.h>
+#include <value/include/TargetDevice.h>
+
+#include <mlir/IR/BuiltinTypes.h>
+#include <mlir/IR/Operation.h>
+
+#include <llvm/Support/MathExtras.h>
+
+using namespace mlir;
+
+namespace v = accera::ir::value;
+namespace xp = accera::ir::executionPlan;
+
+namespace
+{
+
+// The active-block analysis sizes each cache exactly, but that footprint is only compared against
+// the target's cache geometry by benchmarking today. This report surfaces the same numbers at
+// package build time: bytes per cache, the aggregate working set per function, and a warning
+// (or an error, in strict mode) when the working set cannot fit the target's per-core budget.
+
+// GPU caches live in explicitly-managed memory spaces (shared, private, tensor) that the CPU data
+// cache hierarchy doesn't back, so only default/global-space caches count against the budget
+bool IsCPUCache(xp::MakeCacheOp makeCacheOp)
+{
+    auto memSpace = makeCacheOp.memorySpace();
+    return memSpace == v::MemorySpace::None || memSpace == v::MemorySpace::Global;
+}
+
+int64_t GetFootprintBytes(mlir::MemRefType cacheType)
+{
+    return cacheType.getNumElements() * static_cast<int64_t>(llvm::divideCeil(cacheType.getElementTypeBitWidth(), 8));
+}
+
+} // namespace
+
+namespace accera::transforms::executionPlan
+{
+
+mlir::LogicalResult EmitCacheFootprintReport(mlir::Operation* op,
+                                             const std::string& targetDeviceName,
+                                             bool printCacheFootprints,
+                                             bool warningsAsErrors)
+{
+    auto targetDevice = accera::value::GetTargetDevice(targetDeviceName);
+
+    int64_t aggregateBytes = 0;
+    int64_t cacheCount = 0;
+    op->walk([&](xp::MakeCacheOp makeCacheOp) {
+        auto cacheType = makeCacheOp.cache().getType().cast<mlir::MemRefType>();
+        if (makeCacheOp.cache().use_empty() || !cacheType.hasStaticShape() || !IsCPUCache(makeCacheOp))
+        {
+            // Dynamically-shaped MakeCacheOps are the base ops used for cloning and don't
+            // allocate a buffer of their own
+            return;
+        }
+
+        auto footprintBytes = GetFootprintBytes(cacheType);
+        aggregateBytes += footprintBytes;
+        ++cacheCount;
+        if (printCacheFootprints)
+        {
+            makeCacheOp.emitRemark("Cache footprint: ") << footprintBytes << " bytes (" << cacheType << ")";
+        }
+    });
+
+    if (cacheCount == 0)
+    {
+        return mlir::success();
+    }
+
+    if (printCacheFootprints)
+    {
+        auto diagnostic = op->emitRemark("Aggregate cache working set: ");
+        diagnostic << aggregateBytes << " bytes across " << cacheCount << " caches on target '" << targetDevice.deviceName << "'";
+        const std::pair<const char*, size_t> cacheLevels[] = {
+            { "L1", targetDevice.l1CacheSize },
+            { "L2", targetDevice.l2CacheSize },
+            { "L3", targetDevice.l3CacheSize }
+        };
+        for (const auto& [levelName, levelSize] : cacheLevels)
+        {
+            if (levelSize != 0)
+            {
+                diagnostic << "; " << (static_cast<size_t>(aggregateBytes) <= levelSize ? "fits in " : "exceeds ") << levelName << " (" << levelSize << " bytes)";
+            }
+        }
+    }
+
+    // The caches of a function are all live at once on the core running it, so the per-core
+    // budget is the largest per-core level: L2 when the target reports one, else L1
+    auto budgetBytes = targetDevice.l2CacheSize != 0 ? targetDevice.l2CacheSize : targetDevice.l1CacheSize;
+    const auto* budgetName = targetDevice.l2CacheSize != 0 ? "L2" : "L1";
+    if (budgetBytes != 0 && static_cast<size_t>(aggregateBytes) > budgetBytes)
+    {
+        auto diagnostic = warningsAsErrors ? op->emitError() : op->emitWarning();
+        diagnostic << "Aggregate cache working set (" << aggregateBytes << " bytes across " << cacheCount
+                   << " caches) exceeds the " << budgetName << " size (" << budgetBytes
+                   << " bytes) of target '" << targetDevice.deviceName << "'";
+        if (warningsAsErrors)
+        {
+            return mlir::failure();
+        }
+    }
+
+    return mlir::success();
+}
+
+} // namespace accera::transforms::executionPlan
@@ -29,6 +29,7 @@
 #include <llvm/Support/Debug.h>
 #include <llvm/Support/raw_os_ostream.h>
 
+#include <mlir/Dialect/AMX/AMXDialect.h>
 #include <mlir/Dialect/Affine/Analysis/LoopAnalysis.h>
 #include <mlir/Dialect/Affine/Analysis/Utils.h>
 #include <mlir/Dialect/Affine/IR/AffineOps.h>
@@ -36,6 +37,7 @@
 #include <mlir/Dialect/Affine/Utils.h>
 #include <mlir/Dialect/Arithmetic/IR/Arithmetic.h>
 #include <mlir/Dialect/GPU/GPUDialect.h>
+#include <mlir/Dialect/Math/IR/Math.h>
 #include <mlir/Dialect/OpenMP/OpenMPDialect.h>
 #include <mlir/Dialect/SCF/SCF.h>
 #include <mlir/Dialect/SPIRV/IR/SPIRVOps.h>
@@ -55,6 +57,7 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <numeric>
 #include <queue>
 #include <stack>
@@ -102,6 +105,78 @@ const std::string ThreadZIndexName = "accxp_thread_z_loop_index";
 const std::string UnswitchPrefixItersName = "accxp_unswitch_prefix_iters";
 const std::string UnswitchSuffixItersName = "accxp_unswitch_suffix_iters";
 
+// Copies the software prefetch configuration attributes set on a cache region op onto a cache copy op
+// (or a derived cache region op) so the copy lowering can emit the prefetches
+void PropagatePrefetchAttrs(mlir::Operation* from, mlir::Operation* to)
+{
+    if (auto prefetchDistanceAttr = from->getAttrOfType<mlir::IntegerAttr>("prefetchDistance"))
+    {
+        to->setAttr("prefetchDistance", prefetchDistanceAttr);
+    }
+    if (auto prefetchL2OnlyAttr = from->getAttrOfType<mlir::BoolAttr>("prefetchL2Only"))
+    {
+        to->setAttr("prefetchL2Only", prefetchL2OnlyAttr);
+    }
+}
+
+// Attribute name marking stores that should become non-temporal (streaming) stores. The LLVM
+// lowering attaches the !nontemporal metadata to stores carrying this marker
+const std::string NonTemporalStoreAttrName = "accxp_nontemporal";
+
+// Copies the non-temporal writeback configuration from a cache region op onto a writeback or
+// zeroing op so their lowerings can mark the stores they create
+void PropagateNonTemporalAttr(mlir::Operation* from, mlir::Operation* to)
+{
+    if (auto nontemporalAttr = from->getAttrOfType<mlir::BoolAttr>("nontemporalWriteback"))
+    {
+        to->setAttr("nontemporalWriteback", nontemporalAttr);
+    }
+}
+
+bool HasNonTemporalWriteback(mlir::Operation* op)
+{
+    auto nontemporalAttr = op->getAttrOfType<mlir::BoolAttr>("nontemporalWriteback");
+    return nontemporalAttr && nontemporalAttr.getValue();
+}
+
+// Rounding configuration for cache reduce writebacks that narrow the accumulator element type
+// into the outer array element type (e.g. f32 accumulators written back to bf16 or int8).
+// The mode is "nearest_even" (the default when unset) or "stochastic"; the seed keys the
+// counter-based random stream stochastic rounding draws from
+const std::string WritebackRoundingModeAttrName = "writebackRoundingMode";
+const std::string WritebackRoundingSeedAttrName = "writebackRoundingSeed";
+const std::string StochasticRoundingModeName = "stochastic";
+
+// Copies the writeback rounding configuration from a cache region op onto a cache reduce op
+// so the reduce lowering can fuse the narrowing conversion into its writeback stores
+void PropagateWritebackRoundingAttrs(mlir::Operation* from, mlir::Operation* to)
+{
+    if (auto modeAttr = from->getAttrOfType<mlir::StringAttr>(WritebackRoundingModeAttrName))
+    {
+        to->setAttr(WritebackRoundingModeAttrName, modeAttr);
+    }
+    if (auto seedAttr = from->getAttrOfType<mlir::IntegerAttr>(WritebackRoundingSeedAttrName))
+    {
+        to->setAttr(WritebackRoundingSeedAttrName, seedAttr);
+    }
+}
+
+// Copies the quantized cache configuration from a cache region op onto a cache copy op
+// (or a derived cache region op) so the copy lowering can quantize fills and dequantize writebacks
+void PropagateQuantizedCacheAttr(mlir::Operation* from, mlir::Operation* to)
+{
+    if (auto quantizedAttr = from->getAttrOfType<mlir::BoolAttr>("quantizedCache"))
+    {
+        to->setAttr("quantizedCache", quantizedAttr);
+    }
+}
+
+bool IsQuantizedCache(mlir::Operation* op)
+{
+    auto quantizedAttr = op->getAttrOfType<mlir::BoolAttr>("quantizedCache");
+    return quantizedAttr && quantizedAttr.getValue();
+}
+
 GPUIndexDimension GPUProcessorToDim(v::Processor gpuProc)
 {
     switch (gpuProc)
@@ -159,25 +234,54 @@ struct ActiveElementCacheCopyOpRewrite : public OpRewritePattern<ActiveElementCa
     LogicalResult matchAndRewrite(ActiveElementCacheCopyOp cacheCopyOp, PatternRewriter& rewriter) const final;
 };
 
+// The thrifty single-element-stride determination is structural: it only depends on the access
+// bound maps, the array and cache memref layouts, the cache shape and step sizes, and which of
+// the bound operands are multiCache induction variables. Generated packages contain many
+// structurally identical caches, so the determination is memoized on that fingerprint and shared
+// across the thrifty patterns instead of re-running the symbolic stride walk per cache instance
+struct ThriftyCacheStrideAnalysis
+{
+    std::map<std::string, bool> singleElementStrideResults;
+};
+using ThriftyCacheStrideAnalysisPtr = std::shared_ptr<ThriftyCacheStrideAnalysis>;
+
 struct ThriftyCacheMultiCopyOpRewrite : public OpRewritePattern<MultiCacheCopyOp>
 {
-    using OpRewritePattern<MultiCacheCopyOp>::OpRewritePattern;
+    ThriftyCacheMultiCopyOpRewrite(mlir::MLIRContext* context, ThriftyCacheStrideAnalysisPtr strideAnalysis) :
+        OpRewritePattern<MultiCacheCopyOp>(context),
+        _strideAnalysis(std::move(strideAnalysis))
+    {}
 
     LogicalResult matchAndRewrite(MultiCacheCopyOp cacheCopyOp, PatternRewriter& rewriter) const final;
+
+private:
+    ThriftyCacheStrideAnalysisPtr _strideAnalysis;
 };
 
 struct ThriftyCacheCopyOpRewrite : public OpRewritePattern<ActiveBlockCacheCopyOp>
 {
-    using OpRewritePattern<ActiveBlockCacheCopyOp>::OpRewritePattern;
+    ThriftyCacheCopyOpRewrite(mlir::MLIRContext* context, ThriftyCacheStrideAnalysisPtr strideAnalysis) :
+        OpRewritePattern<ActiveBlockCacheCopyOp>(context),
+        _strideAnalysis(std::move(strideAnalysis))
+    {}
 
     LogicalResult matchAndRewrite(ActiveBlockCacheCopyOp cacheCopyOp, PatternRewriter& rewriter) const final;
+
+private:
+    ThriftyCacheStrideAnalysisPtr _strideAnalysis;
 };
 
 struct ThriftyCacheReduceOpRewrite : public OpRewritePattern<ActiveBlockCacheReduceOp>
 {
-    using OpRewritePattern<ActiveBlockCacheReduceOp>::OpRewritePattern;
+    ThriftyCacheReduceOpRewrite(mlir::MLIRContext* context, ThriftyCacheStrideAnalysisPtr strideAnalysis) :
+        OpRewritePattern<ActiveBlockCacheReduceOp>(context),
+        _strideAnalysis(std::move(strideAnalysis))
+    {}
 
     LogicalResult matchAndRewrite(ActiveBlockCacheReduceOp cacheReduceOp, PatternRewriter& rewriter) const final;
+
+private:
+    ThriftyCacheStrideAnalysisPtr _strideAnalysis;
 };
 
 struct MultiCacheCopyOpRewrite : public OpRewritePattern<MultiCacheCopyOp>
@@ -229,6 +333,13 @@ struct AdjustCacheMappingPositionRewrite : public OpRewritePattern<BeginCacheMap
     LogicalResult matchAndRewrite(BeginCacheMappingOp beginCacheMappingOp, PatternRewriter& rewriter) const final;
 };
 
+struct HoistCacheMappingOpsRewrite : public OpRewritePattern<BeginCacheMappingOp>
+{
+    using OpRewritePattern<BeginCacheMappingOp>::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(BeginCacheMappingOp beginCacheMappingOp, PatternRewriter& rewriter) const final;
+};
+
 struct BeginCreateCacheOpRewrite : public OpRewritePattern<BeginCreateCacheOp>
 {
     using OpRewritePattern<BeginCreateCacheOp>::OpRewritePattern;
@@ -585,6 +696,395 @@ ParallelizationInfo GetParallelizationInfo(Operation* op)
     return parallelizationInfoAttr.getValue();
 }
 
+// Returns the identity element attribute for a parallel reduction operator, or a null
+// attribute if the element type / operator combination isn't supported
+mlir::Attribute GetParallelReductionIdentityAttr(OpBuilder& builder, mlir::Type elementType, int64_t reduction)
+{
+    if (reduction == ParallelizationInfo::SumReduction)
+    {
+        return builder.getZeroAttr(elementType);
+    }
+    if (auto floatType = elementType.dyn_cast<mlir::FloatType>())
+    {
+        auto infinity = llvm::APFloat::getInf(floatType.getFloatSemantics(), /*Negative=*/(reduction == ParallelizationInfo::MaxReduction));
+        return builder.getFloatAttr(floatType, infinity);
+    }
+    if (auto intType = elementType.dyn_cast<mlir::IntegerType>())
+    {
+        auto identity = (reduction == ParallelizationInfo::MaxReduction) ? llvm::APInt::getSignedMinValue(intType.getWidth()) : llvm::APInt::getSignedMaxValue(intType.getWidth());
+        return mlir::IntegerAttr::get(intType, identity);
+    }
+    return {};
+}
+
+mlir::Value CreateParallelReductionCombine(OpBuilder& builder, Location loc, int64_t reduction, mlir::Value lhs, mlir::Value rhs)
+{
+    bool isFloat = lhs.getType().isa<mlir::FloatType>();
+    switch (reduction)
+    {
+    case ParallelizationInfo::MaxReduction:
+        return isFloat ? builder.create<arith::MaxFOp>(loc, lhs, rhs).getResult() : builder.create<arith::MaxSIOp>(loc, lhs, rhs).getResult();
+    case ParallelizationInfo::MinReduction:
+        return isFloat ? builder.create<arith::MinFOp>(loc, lhs, rhs).getResult() : builder.create<arith::MinSIOp>(loc, lhs, rhs).getResult();
+    default: // SumReduction
+        return isFloat ? builder.create<arith::AddFOp>(loc, lhs, rhs).getResult() : builder.create<arith::AddIOp>(loc, lhs, rhs).getResult();
+    }
+}
+
+// Rewrites an affine.for loop that parallelizes a reduction index into a privatized form
+// that has no races on the shared accumulator locations:
+//   %priv = alloca memref<numThreads x accumShape>
+//   <initialize %priv to the reduction identity>
+//   affine.for %t = 0 to numThreads {    <- tagged for the standard parallelization rewrite
+//       affine.for %i = chunkBegin(%t) to min(chunkEnd(%t), ub) step s {
+//           <original body, with accumulator accesses redirected to %priv[%t, ...]>
+//       }
+//   }
+//   <combine %priv into the shared accumulators>
+// Each thread accumulates its chunk of the iteration range into its own copy of the
+// accumulators, and the copies are combined after the parallel region joins (pairwise tree
+// when the thread count is a power of two, linearly otherwise)
+LogicalResult RewriteParallelReduction(AffineForOp affineForOp, const ParallelizationInfo& parallelizationInfo, PatternRewriter& rewriter)
+{
+    auto loc = affineForOp.getLoc();
+    auto inductionVar = affineForOp.getInductionVar();
+    int64_t numThreads = parallelizationInfo.numThreads;
+    int64_t reduction = parallelizationInfo.reduction;
+    if (numThreads <= 1)
+    {
+        return failure();
+    }
+
+    // A value carries the parallel iteration if it is the induction variable or is computed from it
+    std::function<bool(mlir::Value)> dependsOnInductionVar = [&](mlir::Value value) -> bool {
+        if (value == inductionVar)
+        {
+            return true;
+        }
+        auto definingOp = value.getDefiningOp();
+        if (!definingOp)
+        {
+            return false; // a different loop's induction variable
+        }
+        return llvm::any_of(definingOp->getOperands(), dependsOnInductionVar);
+    };
+
+    // Find the racing accumulators: stores whose target location doesn't depend on the parallel
+    // index. Stores indexed by the parallel index write disjoint locations and are left alone.
+    SmallVector<mlir::Value, 2> accumulatorMemrefs;
+    bool canPrivatize = true;
+    affineForOp.getBody()->walk([&](mlir::AffineStoreOp storeOp) {
+        if (llvm::any_of(storeOp.getMapOperands(), dependsOnInductionVar))
+        {
+            return;
+        }
+        auto memref = storeOp.getMemRef();
+        if (!memref.getType().cast<mlir::MemRefType>().hasStaticShape() || dependsOnInductionVar(memref))
+        {
+            canPrivatize = false;
+            return;
+        }
+        if (!llvm::is_contained(accumulatorMemrefs, memref))
+        {
+            accumulatorMemrefs.push_back(memref);
+        }
+    });
+    if (!canPrivatize || accumulatorMemrefs.empty())
+    {
+        return failure();
+    }
+
+    // Each accumulator must be read-modify-write (the body also loads the buffer) and its
+    // element type must have a known identity for the requested reduction operator
+    SmallVector<mlir::Attribute, 2> identityAttrs;
+    for (auto memref : accumulatorMemrefs)
+    {
+        bool hasLoad = false;
+        affineForOp.getBody()->walk([&](mlir::AffineLoadOp loadOp) {
+            hasLoad |= (loadOp.getMemRef() == memref);
+        });
+        auto identityAttr = GetParallelReductionIdentityAttr(rewriter, memref.getType().cast<mlir::MemRefType>().getElementType(), reduction);
+        if (!hasLoad || !identityAttr)
+        {
+            return failure();
+        }
+        identityAttrs.push_back(identityAttr);
+    }
+
+    int64_t lowerBound = affineForOp.getConstantLowerBound();
+    int64_t upperBound = affineForOp.getConstantUpperBound();
+    int64_t step = affineForOp.getStep();
+    int64_t iterationsPerThread = CeilDiv(CeilDiv(upperBound - lowerBound, step), numThreads);
+
+    rewriter.setInsertionPoint(affineForOp);
+
+    // One private copy of each accumulator per thread
+    SmallVector<mlir::Value, 2> privateBuffers;
+    for (auto memref : accumulatorMemrefs)
+    {
+        auto memRefType = memref.getType().cast<mlir::MemRefType>();
+        SmallVector<int64_t, 4> privateShape{ numThreads };
+        privateShape.append(memRefType.getShape().begin(), memRefType.getShape().end());
+        auto privateType = mlir::MemRefType::get(privateShape, memRefType.getElementType());
+        privateBuffers.push_back(rewriter.create<mlir::memref::AllocaOp>(loc, privateType, mlir::ValueRange{}, rewriter.getI64IntegerAttr(32)));
+    }
+
+    // Initialize the private copies to the reduction identity
+    for (auto&& [privateBuffer, identityAttr] : llvm::zip(privateBuffers, identityAttrs))
+    {
+        auto privateType = privateBuffer.getType().cast<mlir::MemRefType>();
+        auto rank = privateType.getRank();
+        SmallVector<int64_t, 4> lbs(rank, 0);
+        SmallVector<int64_t, 4> steps(rank, 1);
+        mlir::buildAffineLoopNest(rewriter, loc, lbs, privateType.getShape(), steps, [&](OpBuilder& builder, Location nestedLoc, ValueRange indices) {
+            auto identity = builder.create<arith::ConstantOp>(nestedLoc, identityAttr);
+            builder.create<mlir::AffineStoreOp>(nestedLoc, identity, privateBuffer, indices);
+        });
+    }
+
+    // Per-thread chunk loop, tagged so the standard parallelization rewrite turns it into an
+    // affine.parallel region (the reduction is handled here, so the tag drops it)
+    auto threadLoop = rewriter.create<mlir::AffineForOp>(loc, 0, numThreads, 1);
+    auto threadParallelizationInfo = parallelizationInfo;
+    threadParallelizationInfo.reduction = ParallelizationInfo::NoReduction;
+    auto parallelizationInfoIdentifier = rewriter.getStringAttr(ParallelizationInfoAttr::getKeyName());
+    threadLoop->setAttr(parallelizationInfoIdentifier, ParallelizationInfoAttr::get(threadParallelizationInfo, rewriter.getContext()));
+
+    rewriter.setInsertionPointToStart(threadLoop.getBody());
+    auto threadIdx = threadLoop.getInductionVar();
+    auto d0 = rewriter.getAffineDimExpr(0);
+    auto chunkBegin = rewriter.getAffineConstantExpr(lowerBound) + d0 * (iterationsPerThread * step);
+    auto chunkEnd = rewriter.getAffineConstantExpr(lowerBound) + (d0 + 1) * (iterationsPerThread * step);
+    auto lowerBoundMap = mlir::AffineMap::get(1, 0, chunkBegin);
+    auto upperBoundMap = mlir::AffineMap::get(1, 0, { chunkEnd, rewriter.getAffineConstantExpr(upperBound) }, rewriter.getContext());
+    auto chunkLoop = rewriter.create<mlir::AffineForOp>(loc, mlir::ValueRange{ threadIdx }, lowerBoundMap, mlir::ValueRange{ threadIdx }, upperBoundMap, step);
+
+    rewriter.setInsertionPointToStart(chunkLoop.getBody());
+    mlir::BlockAndValueMapping bodyMapping;
+    bodyMapping.map(inductionVar, chunkLoop.getInductionVar());
+    for (auto& bodyOp : affineForOp.getBody()->without_terminator())
+    {
+        rewriter.clone(bodyOp, bodyMapping);
+    }
+
+    // Redirect accumulator accesses in the cloned body to the thread's private copy
+    auto privateBufferFor = [&](mlir::Value memref) {
+        auto it = llvm::find(accumulatorMemrefs, memref);
+        return privateBuffers[std::distance(accumulatorMemrefs.begin(), it)];
+    };
+    auto prependThreadDim = [&](mlir::AffineMap accessMap) {
+        SmallVector<mlir::AffineExpr, 4> dimReplacements;
+        for (unsigned idx = 0; idx < accessMap.getNumDims(); ++idx)
+        {
+            dimReplacements.push_back(rewriter.getAffineDimExpr(idx + 1));
+        }
+        SmallVector<mlir::AffineExpr, 5> exprs{ rewriter.getAffineDimExpr(0) };
+        for (auto expr : accessMap.getResults())
+        {
+            exprs.push_back(expr.replaceDimsAndSymbols(dimReplacements, {}));
+        }
+        return mlir::AffineMap::get(accessMap.getNumDims() + 1, accessMap.getNumSymbols(), exprs, rewriter.getContext());
+    };
+
+    SmallVector<mlir::Operation*, 8> accessesToRedirect;
+    chunkLoop.getBody()->walk([&](mlir::Operation* op) {
+        if (auto loadOp = dyn_cast<mlir::AffineLoadOp>(op); loadOp && llvm::is_contained(accumulatorMemrefs, loadOp.getMemRef()))
+        {
+            accessesToRedirect.push_back(op);
+        }
+        else if (auto storeOp = dyn_cast<mlir::AffineStoreOp>(op); storeOp && llvm::is_contained(accumulatorMemrefs, storeOp.getMemRef()))
+        {
+            accessesToRedirect.push_back(op);
+        }
+    });
+    for (auto accessOp : accessesToRedirect)
+    {
+        rewriter.setInsertionPoint(accessOp);
+        if (auto loadOp = dyn_cast<mlir::AffineLoadOp>(accessOp))
+        {
+            SmallVector<mlir::Value, 5> operands{ threadIdx };
+            operands.append(loadOp.getMapOperands().begin(), loadOp.getMapOperands().end());
+            auto newLoad = rewriter.create<mlir::AffineLoadOp>(loc, privateBufferFor(loadOp.getMemRef()), prependThreadDim(loadOp.getAffineMap()), operands);
+            rewriter.replaceOp(accessOp, newLoad.getResult());
+        }
+        else
+        {
+            auto storeOp = cast<mlir::AffineStoreOp>(accessOp);
+            SmallVector<mlir::Value, 5> operands{ threadIdx };
+            operands.append(storeOp.getMapOperands().begin(), storeOp.getMapOperands().end());
+            rewriter.create<mlir::AffineStoreOp>(loc, storeOp.getValueToStore(), privateBufferFor(storeOp.getMemRef()), prependThreadDim(storeOp.getAffineMap()), operands);
+            rewriter.eraseOp(accessOp);
+        }
+    }
+
+    // Combine the private copies into the shared accumulators after the parallel region joins
+    rewriter.setInsertionPointAfter(threadLoop);
+    for (auto&& [memref, privateBuffer] : llvm::zip(accumulatorMemrefs, privateBuffers))
+    {
+        auto memRefType = memref.getType().cast<mlir::MemRefType>();
+        auto shape = memRefType.getShape();
+        auto rank = memRefType.getRank();
+        if (llvm::isPowerOf2_64(numThreads))
+        {
+            // Pairwise tree: at each level the first `stride` copies absorb the next `stride`;
+            // iterations within a level are independent, so the inner dimensions vectorize
+            for (int64_t stride = numThreads / 2; stride >= 1; stride /= 2)
+            {
+                SmallVector<int64_t, 4> lbs(rank + 1, 0);
+                SmallVector<int64_t, 4> steps(rank + 1, 1);
+                SmallVector<int64_t, 4> ubs{ stride };
+                ubs.append(shape.begin(), shape.end());
+                mlir::buildAffineLoopNest(rewriter, loc, lbs, ubs, steps, [&](OpBuilder& builder, Location nestedLoc, ValueRange indices) {
+                    auto lhs = builder.create<mlir::AffineLoadOp>(nestedLoc, privateBuffer, indices);
+                    SmallVector<mlir::AffineExpr, 5> offsetExprs{ builder.getAffineDimExpr(0) + stride };
+                    for (int64_t dim = 1; dim <= rank; ++dim)
+                    {
+                        offsetExprs.push_back(builder.getAffineDimExpr(dim));
+                    }
+                    auto offsetMap = mlir::AffineMap::get(rank + 1, 0, offsetExprs, builder.getContext());
+                    auto rhs = builder.create<mlir::AffineLoadOp>(nestedLoc, privateBuffer, offsetMap, indices);
+                    auto combined = CreateParallelReductionCombine(builder, nestedLoc, reduction, lhs, rhs);
+                    builder.create<mlir::AffineStoreOp>(nestedLoc, combined, privateBuffer, indices);
+                });
+            }
+            // Fold the fully-combined first copy into the shared accumulator
+            SmallVector<int64_t, 4> lbs(rank, 0);
+            SmallVector<int64_t, 4> steps(rank, 1);
+            SmallVector<int64_t, 4> ubs(shape.begin(), shape.end());
+            mlir::buildAffineLoopNest(rewriter, loc, lbs, ubs, steps, [&](OpBuilder& builder, Location nestedLoc, ValueRange indices) {
+                SmallVector<mlir::AffineExpr, 5> firstCopyExprs{ builder.getAffineConstantExpr(0) };
+                for (int64_t dim = 0; dim < rank; ++dim)
+                {
+                    firstCopyExprs.push_back(builder.getAffineDimExpr(dim));
+                }
+                auto firstCopyMap = mlir::AffineMap::get(rank, 0, firstCopyExprs, builder.getContext());
+                auto partial = builder.create<mlir::AffineLoadOp>(nestedLoc, privateBuffer, firstCopyMap, indices);
+                auto current = builder.create<mlir::AffineLoadOp>(nestedLoc, memref, indices);
+                auto combined = CreateParallelReductionCombine(builder, nestedLoc, reduction, current, partial);
+                builder.create<mlir::AffineStoreOp>(nestedLoc, combined, memref, indices);
+            });
+        }
+        else
+        {
+            // Non-power-of-two thread counts fold linearly; the inner dimensions still vectorize
+            SmallVector<int64_t, 4> lbs(rank + 1, 0);
+            SmallVector<int64_t, 4> steps(rank + 1, 1);
+            SmallVector<int64_t, 4> ubs{ numThreads };
+            ubs.append(shape.begin(), shape.end());
+            mlir::buildAffineLoopNest(rewriter, loc, lbs, ubs, steps, [&](OpBuilder& builder, Location nestedLoc, ValueRange indices) {
+                auto partial = builder.create<mlir::AffineLoadOp>(nestedLoc, privateBuffer, indices);
+                auto current = builder.create<mlir::AffineLoadOp>(nestedLoc, memref, indices.drop_front());
+                auto combined = CreateParallelReductionCombine(builder, nestedLoc, reduction, current, partial);
+                builder.create<mlir::AffineStoreOp>(nestedLoc, combined, memref, indices.drop_front());
+            });
+        }
+    }
+
+    rewriter.eraseOp(affineForOp);
+    return success();
+}
+
+// Emits a parallel first-touch initialization of heap-allocated cache buffers whose first use
+// is inside the given parallelized loop. Pages are physically allocated on the NUMA node of
+// the thread that first writes them, so zero-filling each thread's share of a buffer inside
+// an identically-configured parallel region (same thread count, policy and affinity) places
+// the memory near the thread that will use it. The emitted loop is tagged with the same
+// parallelization info, plus a marker so it isn't itself treated as a first-touch candidate,
+// and is converted to a parallel region by this same pattern.
+void EmitFirstTouchInitForCacheBuffers(AffineForOp affineForOp, const ParallelizationInfo& parallelizationInfo, PatternRewriter& rewriter)
+{
+    int64_t numThreads = parallelizationInfo.numThreads;
+    if (numThreads <= 1)
+    {
+        return;
+    }
+
+    // Collect the heap-allocated statically-shaped buffers accessed in the loop body
+    SmallVector<mlir::Value, 4> candidateBuffers;
+    affineForOp.getBody()->walk([&](mlir::Operation* op) {
+        mlir::Value memref;
+        if (auto loadOp = dyn_cast<mlir::AffineLoadOp>(op))
+        {
+            memref = loadOp.getMemRef();
+        }
+        else if (auto storeOp = dyn_cast<mlir::AffineStoreOp>(op))
+        {
+            memref = storeOp.getMemRef();
+        }
+        else
+        {
+            return;
+        }
+        auto definingOp = memref.getDefiningOp();
+        if (!definingOp || !isa<v::AllocOp, mlir::memref::AllocOp>(definingOp))
+        {
+            return;
+        }
+        auto memRefType = memref.getType().cast<mlir::MemRefType>();
+        if (!memRefType.hasStaticShape() || memRefType.getRank() == 0 || !memRefType.getElementType().isIntOrFloat())
+        {
+            return;
+        }
+        if (!llvm::is_contained(candidateBuffers, memref))
+        {
+            candidateBuffers.push_back(memref);
+        }
+    });
+
+    for (auto memref : candidateBuffers)
+    {
+        // Only first-touch buffers this loop is the first to access; a buffer touched earlier
+        // already has its pages placed
+        bool usedBefore = false;
+        for (auto user : memref.getUsers())
+        {
+            auto ancestorOp = affineForOp->getBlock()->findAncestorOpInBlock(*user);
+            if (!ancestorOp || (ancestorOp != affineForOp.getOperation() && ancestorOp->isBeforeInBlock(affineForOp)))
+            {
+                usedBefore = true;
+                break;
+            }
+        }
+        if (usedBefore)
+        {
+            continue;
+        }
+
+        auto allocOp = memref.getDefiningOp();
+        OpBuilder::InsertionGuard guard(rewriter);
+        rewriter.setInsertionPointAfter(allocOp);
+        auto loc = allocOp->getLoc();
+        auto memRefType = memref.getType().cast<mlir::MemRefType>();
+        auto shape = memRefType.getShape();
+        auto rank = memRefType.getRank();
+        int64_t rowsPerThread = CeilDiv(shape[0], numThreads);
+
+        auto threadLoop = rewriter.create<mlir::AffineForOp>(loc, 0, numThreads, 1);
+        auto firstTouchInfo = parallelizationInfo;
+        firstTouchInfo.reduction = ParallelizationInfo::NoReduction;
+        threadLoop->setAttr(rewriter.getStringAttr(ParallelizationInfoAttr::getKeyName()), ParallelizationInfoAttr::get(firstTouchInfo, rewriter.getContext()));
+        threadLoop->setAttr("accv_first_touch_init", rewriter.getUnitAttr());
+
+        // Each thread zero-fills its block of the outermost dimension; the inner dimensions
+        // are filled completely
+        rewriter.setInsertionPointToStart(threadLoop.getBody());
+        auto threadIdx = threadLoop.getInductionVar();
+        auto d0 = rewriter.getAffineDimExpr(0);
+        auto lowerBoundMap = mlir::AffineMap::get(1, 0, d0 * rowsPerThread);
+        auto upperBoundMap = mlir::AffineMap::get(1, 0, { (d0 + 1) * rowsPerThread, rewriter.getAffineConstantExpr(shape[0]) }, rewriter.getContext());
+        auto rowLoop = rewriter.create<mlir::AffineForOp>(loc, mlir::ValueRange{ threadIdx }, lowerBoundMap, mlir::ValueRange{ threadIdx }, upperBoundMap);
+        rewriter.setInsertionPointToStart(rowLoop.getBody());
+        SmallVector<int64_t, 4> lbs(rank - 1, 0);
+        SmallVector<int64_t, 4> steps(rank - 1, 1);
+        mlir::buildAffineLoopNest(rewriter, loc, lbs, shape.drop_front(), steps, [&](OpBuilder& builder, Location nestedLoc, ValueRange indices) {
+            auto zero = builder.create<arith::ConstantOp>(nestedLoc, builder.getZeroAttr(memRefType.getElementType()));
+            SmallVector<mlir::Value, 4> storeIndices{ rowLoop.getInductionVar() };
+            storeIndices.append(indices.begin(), indices.end());
+            builder.create<mlir::AffineStoreOp>(nestedLoc, zero, memref, storeIndices);
+        });
+    }
+}
+
 bool IsTerminalOp(mlir::Operation* op)
 {
     // TODO: change this to also look for terminator ops
@@ -1388,23 +1888,20 @@ ArrayAccessInfo ComputeAccessInfoForArrayAtLevel(PatternRewriter& rewriter, mlir
             result.cacheShapingIVHandles.push_back(forOp.getInductionVar());
         }
     });
+    // Collect the ops inside the cache region once, rather than re-walking the whole region for
+    // every user of the array, which made this analysis quadratic on large fused schedules
+    llvm::DenseSet<Operation*> opsInRegion;
+    parentBlock->walk(mlir::Block::iterator(startOp), mlir::Block::iterator(endOp), [&](Operation* op) {
+        opsInRegion.insert(op);
+    });
     for (Operation* arrayUserOp : array.getUsers())
     {
         // Check if this use is inside of the cache region
-        bool isInRegion = false;
-        // TODO : fix this pattern, this seems like a really inefficient way of doing this
-        parentBlock->walk(mlir::Block::iterator(startOp), mlir::Block::iterator(endOp), [&](Operation* op) {
-            if (op == arrayUserOp)
-            {
-                isInRegion = true;
-                result.cacheUsedInRegion = true;
-                return WalkResult::interrupt();
-            }
-            else
-            {
-                return WalkResult::advance();
-            }
-        });
+        bool isInRegion = opsInRegion.contains(arrayUserOp);
+        if (isInRegion)
+        {
+            result.cacheUsedInRegion = true;
+        }
 
         if (isInRegion)
         {
@@ -1626,6 +2123,27 @@ MakeCacheOp UpdateActiveBlockCacheShape(PatternRewriter& rewriter,
             cacheShape[0] = std::max(cacheShape[0], volumePlusOffset);
         }
     }
+    // Pad the innermost cache dimension when its stride would alias cache sets: a power-of-two
+    // row stride maps successive rows onto the same sets of a set-associative cache, so walking
+    // the cache column-wise evicts its own earlier rows. Bumping the stride by one cache line
+    // staggers the rows across sets for one line of memory per row. GPU shared and private
+    // memory is banked and allocated against a hard budget, so only heap/stack caches are padded.
+    auto cacheElementType = currentCacheMemRefType.getElementType();
+    auto cacheMemSpace = baseMakeCacheOp.memorySpace();
+    if ((cacheMemSpace == v::MemorySpace::None || cacheMemSpace == v::MemorySpace::Global) &&
+        cacheShape.size() >= 2 &&
+        cacheShape.back() != DynamicSizeSentinelValue &&
+        cacheElementType.isIntOrFloat())
+    {
+        constexpr int64_t kCacheLineBytes = 64;
+        constexpr int64_t kCriticalStrideBytes = 4096; // cache size / associativity for the common 32KB 8-way L1
+        int64_t elementBytes = std::max<int64_t>(1, cacheElementType.getIntOrFloatBitWidth() / 8);
+        if ((cacheShape.back() * elementBytes) % kCriticalStrideBytes == 0)
+        {
+            cacheShape.back() += std::max<int64_t>(1, kCacheLineBytes / elementBytes);
+        }
+    }
+
     // insert the multiCache dimensions as the outer dimensions
     cacheShape.insert(cacheShape.begin(), multiCacheShape.begin(), multiCacheShape.end());
 
@@ -1655,6 +2173,36 @@ mlir::AffineMap CreateActiveBlockToCacheMap(PatternRewriter& rewriter,
     return activeBlockToCacheMap;
 }
 
+// Tensorized kernels read MMA fragments from shared memory caches with the same column group
+// active across a whole fragment of rows at once, so a row-major tile whose row length is a
+// multiple of the bank count replays the same banks on every row of the fragment. An XOR
+// swizzle isn't expressible as an affine cache map, so rotate each row's columns by the
+// fragment width instead: (row, col) -> (row, (col + row * fragmentWidth) mod rowLength).
+// The rotation is bijective per row and leaves the buffer shape unchanged, fragment-width
+// groups stay contiguous because the shift is always a multiple of the fragment width, and
+// since the fill and the fragment reads both go through the cache map they stay consistent
+mlir::AffineMap ApplySharedMemoryBankSwizzle(mlir::AffineMap activeBlockToCacheMap,
+                                             llvm::ArrayRef<int64_t> cacheShape,
+                                             int64_t fragmentWidth,
+                                             mlir::MLIRContext* context)
+{
+    auto rank = activeBlockToCacheMap.getNumResults();
+    if (rank < 2 || cacheShape.empty() || fragmentWidth <= 1)
+    {
+        return activeBlockToCacheMap;
+    }
+    auto rowLength = cacheShape.back();
+    if (mlir::ShapedType::isDynamic(rowLength) || rowLength <= fragmentWidth || rowLength % fragmentWidth != 0)
+    {
+        return activeBlockToCacheMap;
+    }
+    std::vector<mlir::AffineExpr> swizzledExprs(activeBlockToCacheMap.getResults().begin(), activeBlockToCacheMap.getResults().end());
+    auto rowExpr = swizzledExprs[rank - 2];
+    auto colExpr = swizzledExprs[rank - 1];
+    swizzledExprs[rank - 1] = (colExpr + rowExpr * fragmentWidth) % rowLength;
+    return mlir::AffineMap::get(activeBlockToCacheMap.getNumDims(), activeBlockToCacheMap.getNumSymbols(), swizzledExprs, context);
+}
+
 mlir::AffineMap CreateArrayToCacheMap(mlir::OpBuilder& builder,
                                       size_t arrayRank,
                                       mlir::AffineMap activeBlockOffsetMap,
@@ -1949,6 +2497,34 @@ StoreOp CreateStore(mlir::OpBuilder& builder,
     }
 }
 
+// Gets the buffer holding the quantization scale for the given cache, creating it alongside
+// the cache's MakeCacheOp on first use. Managing the scale buffer next to the cache lets the
+// fill and writeback lowerings resolve the same buffer from just the cache value
+std::optional<mlir::Value> GetOrCreateQuantizationScaleBuffer(mlir::OpBuilder& builder,
+                                                              mlir::Value cache,
+                                                              mlir::Type scaleElementType)
+{
+    auto makeCacheOp = cache.getDefiningOp<MakeCacheOp>();
+    if (!makeCacheOp)
+    {
+        return std::nullopt;
+    }
+    if (auto scaleCacheOp = mlir::dyn_cast_or_null<MakeCacheOp>(makeCacheOp->getNextNode()))
+    {
+        if (scaleCacheOp->hasAttr("quantizationScaleCache"))
+        {
+            return scaleCacheOp.cache();
+        }
+    }
+    mlir::OpBuilder::InsertionGuard guard(builder);
+    builder.setInsertionPointAfter(makeCacheOp);
+    auto cacheType = makeCacheOp.cache().getType().cast<mlir::MemRefType>();
+    auto scaleBufferType = mlir::MemRefType::get({ 1 }, scaleElementType, mlir::MemRefLayoutAttrInterface{}, cacheType.getMemorySpace());
+    auto scaleCacheOp = builder.create<MakeCacheOp>(makeCacheOp.getLoc(), scaleBufferType, makeCacheOp.memorySpace());
+    scaleCacheOp->setAttr("quantizationScaleCache", builder.getUnitAttr());
+    return scaleCacheOp.cache();
+}
+
 // Create an MMALoadSyncOp that understands how to access caches
 v::MMALoadSyncOp CreateMMALoad(PatternRewriter& builder,
                                mlir::Location loc,
@@ -2357,7 +2933,20 @@ LogicalResult MakeCacheOpLowering::matchAndRewrite(MakeCacheOp makeCacheOp, Patt
         }
         else
         {
-            cacheGlobalBuffer = util::CreateGlobalBuffer(rewriter, makeCacheOp, cacheType, "cache");
+            // Draw heap-allocated cache buffers from the runtime's recycling arena: the footprint
+            // is static, so every invocation reuses the block the previous call released instead
+            // of paying malloc/free and first-touch page faults each time. This also gives each
+            // invocation its own buffer, unlike a module-level global. The paired dealloc at the
+            // end of the enclosing block returns the buffer to the arena
+            auto arenaAllocOp = rewriter.create<mlir::memref::AllocOp>(loc, cacheType);
+            arenaAllocOp->setAttr(CacheArenaAllocationAttrName, rewriter.getUnitAttr());
+            {
+                mlir::OpBuilder::InsertionGuard insertGuard(rewriter);
+                rewriter.setInsertionPoint(arenaAllocOp->getBlock()->getTerminator());
+                auto arenaDeallocOp = rewriter.create<mlir::memref::DeallocOp>(loc, arenaAllocOp.getResult());
+                arenaDeallocOp->setAttr(CacheArenaAllocationAttrName, rewriter.getUnitAttr());
+            }
+            cacheGlobalBuffer = arenaAllocOp;
         }
 
         break;
@@ -2418,7 +3007,11 @@ LogicalResult CacheZeroOpRewrite::matchAndRewrite(CacheZeroOp cacheZeroOp, Patte
             loops.push_back(newLoop);
         }
         auto castZero = currentBuilder.create<accera::ir::value::CastOp>(loc, constantZero, innerElementType, true /* compiler-internal */);
-        currentBuilder.create<mlir::memref::StoreOp>(loc, castZero, cache, loopIndices);
+        auto zeroStore = currentBuilder.create<mlir::memref::StoreOp>(loc, castZero, cache, loopIndices);
+        if (HasNonTemporalWriteback(cacheZeroOp))
+        {
+            zeroStore->setAttr(NonTemporalStoreAttrName, currentBuilder.getUnitAttr());
+        }
     }
 
     rewriter.eraseOp(cacheZeroOp);
@@ -2505,6 +3098,22 @@ LogicalResult ActiveElementCacheCopyOpRewrite::matchAndRewrite(ActiveElementCach
         copyScheduleOp.addLoopAttribute(loopIndex, rewriter.getStringAttr(AccessBoundsCheckAttrName), rewriter.getUnitAttr());
     }
 
+    // Emitted packing functions tag their copy op with parallelization / vectorization requests
+    // since the copy loopnest doesn't exist until this lowering runs. Apply them here: the
+    // outermost copy loop is parallelized and the innermost loop is vectorized
+    if (!copyOrder.empty())
+    {
+        if (auto parallelizationInfoAttr = cacheCopyOp->getAttrOfType<ParallelizationInfoAttr>(ParallelizationInfoAttr::getKeyName()))
+        {
+            copyScheduleOp.addLoopAttribute(copyOrder.front(), rewriter.getStringAttr(ParallelizationInfoAttr::getKeyName()), parallelizationInfoAttr);
+        }
+        if (auto vectorizationInfoAttr = cacheCopyOp->getAttrOfType<VectorizationInfoAttr>(VectorizationInfoAttr::getKeyName()))
+        {
+            copyScheduleOp.addLoopAttribute(copyOrder.back(), rewriter.getStringAttr(VectorizationInfoAttr::getKeyName()), vectorizationInfoAttr);
+            copyExecPlanOp->setAttr(VectorizationInfoAttr::getKeyName(), vectorizationInfoAttr);
+        }
+    }
+
     if (execTarget == v::ExecutionTarget::GPU && !IsMemspaceLocal(dstMemRefSpace))
     {
         // Create thread mappings for the different levels of the copy loopnest
@@ -2599,21 +3208,23 @@ LogicalResult MultiCacheCopyOpRewrite::matchAndRewrite(MultiCacheCopyOp multiCac
     }
 
     MultiCacheLoopInfo multiCacheInfo = CreateMultiCacheLoops(rewriter, multiCacheCopyOp, [&](mlir::OpBuilder& currentBuilder, const MultiCacheLoopInfo& info) {
-        currentBuilder.create<ActiveBlockCacheCopyOp>(loc,
-                                                      multiCacheCopyOp.array(),
-                                                      multiCacheCopyOp.cache(),
-                                                      info.activeBlockExternalSymbols,
-                                                      info.activeBlockExternalSymbols,
-                                                      info.multiCacheIterCounters,
-                                                      multiCacheCopyOp.activeBlockLowerBoundMaps(),
-                                                      multiCacheCopyOp.activeBlockUpperBoundMaps(),
-                                                      multiCacheCopyOp.activeBlockToCacheMap(),
-                                                      multiCacheCopyOp.toCache(),
-                                                      multiCacheCopyOp.thrifty(),
-                                                      multiCacheCopyOp.strategy(),
-                                                      true, // skipBarriers : this copy will already be guarded by barriers at the multicache level, so skip creating them internally
-                                                      multiCacheCopyOp.vectorizationInfoAttr(),
-                                                      multiCacheCopyOp.tensorizationInfoAttr());
+        auto activeBlockCacheCopyOp = currentBuilder.create<ActiveBlockCacheCopyOp>(loc,
+                                                                                    multiCacheCopyOp.array(),
+                                                                                    multiCacheCopyOp.cache(),
+                                                                                    info.activeBlockExternalSymbols,
+                                                                                    info.activeBlockExternalSymbols,
+                                                                                    info.multiCacheIterCounters,
+                                                                                    multiCacheCopyOp.activeBlockLowerBoundMaps(),
+                                                                                    multiCacheCopyOp.activeBlockUpperBoundMaps(),
+                                                                                    multiCacheCopyOp.activeBlockToCacheMap(),
+                                                                                    multiCacheCopyOp.toCache(),
+                                                                                    multiCacheCopyOp.thrifty(),
+                                                                                    multiCacheCopyOp.strategy(),
+                                                                                    true, // skipBarriers : this copy will already be guarded by barriers at the multicache level, so skip creating them internally
+                                                                                    multiCacheCopyOp.vectorizationInfoAttr(),
+                                                                                    multiCacheCopyOp.tensorizationInfoAttr());
+        PropagatePrefetchAttrs(multiCacheCopyOp, activeBlockCacheCopyOp);
+        PropagateQuantizedCacheAttr(multiCacheCopyOp, activeBlockCacheCopyOp);
     });
 
     rewriter.eraseOp(multiCacheCopyOp);
@@ -2663,6 +3274,50 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
 
     const bool arrayToCache = cacheCopyOp.toCache();
 
+    // Software prefetch configuration set on the cache region and propagated onto this copy op
+    int64_t prefetchDistance = 0;
+    bool prefetchL2Only = false;
+    if (auto prefetchDistanceAttr = cacheCopyOp->getAttrOfType<mlir::IntegerAttr>("prefetchDistance"))
+    {
+        prefetchDistance = prefetchDistanceAttr.getInt();
+    }
+    if (auto prefetchL2OnlyAttr = cacheCopyOp->getAttrOfType<mlir::BoolAttr>("prefetchL2Only"))
+    {
+        prefetchL2Only = prefetchL2OnlyAttr.getValue();
+    }
+    // llvm.prefetch locality hints: 3 keeps the line resident in all cache levels, while 2 skips
+    // the L1 cache so streaming fills don't evict the compute working set from it
+    const unsigned prefetchLocalityHint = prefetchL2Only ? 2 : 3;
+
+    // Set when the cache was configured for streaming writeback, in which case the
+    // cache-to-array copy stores shouldn't displace cache lines
+    const bool nontemporalStores = !arrayToCache && HasNonTemporalWriteback(cacheCopyOp);
+
+    // Quantized caches hold a reduced-precision integer form of a floating point array along with
+    // a per-active-block scale kept in a companion buffer next to the cache. Fills compute the
+    // scale and quantize, writebacks dequantize with the fill's scale, and the compute loops in
+    // between read the cache in the integer domain
+    auto arrayElementType = GetInnerElementType(array);
+    auto cacheElementType = GetInnerElementType(cache);
+    const bool quantizedCache = IsQuantizedCache(cacheCopyOp) &&
+                                arrayElementType.isa<mlir::FloatType>() &&
+                                cacheElementType.isa<mlir::IntegerType>();
+
+    // Prefetches a fixed element distance ahead of the current copy position along the innermost
+    // dimension of the source array. Prefetching is only a hint, so running past the end of the
+    // active block on the last iterations is safe
+    auto createSourcePrefetch = [&](mlir::OpBuilder& builder, mlir::Value memref, const std::vector<mlir::Value>& accessIVs) {
+        std::vector<mlir::AffineExpr> prefetchExprs;
+        prefetchExprs.reserve(accessIVs.size());
+        for (size_t dim = 0; dim < accessIVs.size(); ++dim)
+        {
+            prefetchExprs.push_back(builder.getAffineDimExpr(dim));
+        }
+        prefetchExprs.back() = prefetchExprs.back() + builder.getAffineConstantExpr(prefetchDistance);
+        auto prefetchMap = mlir::AffineMap::get(accessIVs.size(), 0, prefetchExprs, builder.getContext());
+        builder.create<mlir::AffinePrefetchOp>(loc, memref, prefetchMap, accessIVs, false /* isWrite */, prefetchLocalityHint, true /* isDataCache */);
+    };
+
     // Similar to generatePointWiseCopy() from llvm-project/mlir/lib/Dialect/Affine/Utils/LoopUtils.cpp however
     // we have a custom mapping from the active block to the cache position
 
@@ -2739,9 +3394,19 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
             int64_t totalLoadsPerThread = std::max<int64_t>(1, activeBlockVolume / threadsPerBlock);
 
             int64_t vectorSizePerThread = 1;
-            if (vecInfo.has_value() && vecInfo->vectorBytes > 0)
+            auto vectorBytesPerThread = (vecInfo.has_value() && vecInfo->vectorBytes > 0) ? vecInfo->vectorBytes : 0;
+            if (vectorBytesPerThread == 0 && outerArrayMemRefSpace == v::MemorySpace::None && cacheMemRefSpace == v::MemorySpace::Shared)
+            {
+                // Hardware async global-to-shared copies (cp.async / global-to-LDS) move 128 bits
+                // per thread per instruction, but those ops aren't available in the dialect versions
+                // this lowering targets. Default un-vectorized shared cache fills to the same
+                // 128-bit-per-thread shape to get the wide transactions and reduced register
+                // staging; the double-buffer rotation already provides the overlap with compute
+                vectorBytesPerThread = 16;
+            }
+            if (vectorBytesPerThread > 0)
             {
-                const auto vecWidth = std::max<int64_t>(1, std::min(vecInfo->vectorBytes / elementByteWidth, totalLoadsPerThread));
+                const auto vecWidth = std::max<int64_t>(1, std::min(vectorBytesPerThread / elementByteWidth, totalLoadsPerThread));
                 if (totalLoadsPerThread % vecWidth == 0)
                     vectorSizePerThread = vecWidth;
             }
@@ -2767,7 +3432,11 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
                 }
                 else
                 {
-                    rewriter.create<MMAStoreSyncOp>(loc, cache, array, mmaOp.getShapeType(), indices);
+                    auto mmaStoreOp = rewriter.create<MMAStoreSyncOp>(loc, cache, array, mmaOp.getShapeType(), indices);
+                    if (auto epilogueOp = tensorizationInfo->getValue().epilogueOp; epilogueOp != v::MMAFragmentOpType::None)
+                    {
+                        mmaStoreOp->setAttr(v::MMAEpilogueOpAttrName, rewriter.getI8IntegerAttr(static_cast<int8_t>(epilogueOp)));
+                    }
                 }
             }
             else
@@ -2776,7 +3445,12 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
                 const auto globalToShared = outerArrayMemRefSpace == v::MemorySpace::None && cacheMemRefSpace == v::MemorySpace::Shared;
                 const auto privateToShared = outerArrayMemRefSpace == v::MemorySpace::Shared && cacheMemRefSpace == v::MemorySpace::Private;
 
-                if (fullCacheRank == 2 && /*batchgemm not supported*/ activeBlockShape.size() == 2 && (globalToPrivate || globalToShared || privateToShared))
+                // The block cache fast path only understands row-major and transposed cache
+                // layouts, so swizzled caches fall through to the general loopnest below, which
+                // routes every access through the cache map
+                const auto cacheLayoutMap = cacheCopyOp.activeBlockToCacheMap();
+                const bool fastPathLayout = cacheLayoutMap.isIdentity() || cacheLayoutMap.isPermutation();
+                if (fullCacheRank == 2 && /*batchgemm not supported*/ activeBlockShape.size() == 2 && fastPathLayout && (globalToPrivate || globalToShared || privateToShared))
                 {
                     std::vector<mlir::Value> indices;
                     MemRefType resultType = memRefType;
@@ -2928,23 +3602,88 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
         }
         else
         {
-            auto [copyNestOp, copyScheduleOp, copyExecPlanOp] = CreateActiveBlockCacheLoopnest(rewriter, loc, memRefType, activeBlockShape, {}, vecInfo, elementByteWidth, execTarget, std::nullopt, "copy", [&](OpBuilder& currentBuilder, const std::vector<mlir::Value>& domainIndices, const std::vector<mlir::Value>& /*orderedSymbolicIndexOpValues*/) {
-                // The induction variables have been shifted to represent the constant iteration space
-                // however, the maps expect they are constructed based on the original mappings so we
-                // need to offset each IV by its lower bound map applied to its lower bound operands
-                // e.g. affine.for %arg5 = affine_map<(d0) -> (d0)>(%arg4) to affine_map<(d0) -> (d0 + 256)>(%arg4) {
-                //      became
-                //      affine.for %arg5 = 0 to 256 {
-                //      so now we need to do
-                //      %lb_resolve = affine.apply affine_map<(d0) -> (d0)>(%arg4)
-                //      %real_arg5 = affine.apply affine_map<(d0, d1) -> (d0 + d1)>(%lb_resolve, %arg5)
-
-                std::vector<mlir::Value> lowerBoundOffsetIVs;
-                lowerBoundOffsetIVs.reserve(domainIndices.size());
-                assert(lbMaps.size() == domainIndices.size());
-                mlir::AffineExpr sumExpr = currentBuilder.getAffineDimExpr(0) + currentBuilder.getAffineDimExpr(1);
-                mlir::AffineMap sumMap = mlir::AffineMap::get(2, 0, sumExpr);
-                for (unsigned arrayDim = 0; arrayDim < domainIndices.size(); ++arrayDim)
+            mlir::Value quantizationScaleBuffer;
+            if (quantizedCache)
+            {
+                if (auto scaleBufferOpt = GetOrCreateQuantizationScaleBuffer(rewriter, cache, arrayElementType))
+                {
+                    quantizationScaleBuffer = *scaleBufferOpt;
+                }
+            }
+            mlir::Value quantizationRecip;
+            mlir::Value quantizationHalf;
+            mlir::Value quantizationScale;
+            if (quantizationScaleBuffer)
+            {
+                mlir::Value zeroIndex = rewriter.create<arith::ConstantIndexOp>(loc, 0);
+                auto intWidth = cacheElementType.cast<mlir::IntegerType>().getWidth();
+                auto quantLimit = static_cast<double>((1ll << (intWidth - 1)) - 1);
+                mlir::Value limitConst = rewriter.create<arith::ConstantOp>(loc, rewriter.getFloatAttr(arrayElementType, quantLimit));
+                mlir::Value zeroConst = rewriter.create<arith::ConstantOp>(loc, rewriter.getFloatAttr(arrayElementType, 0.0));
+                if (arrayToCache)
+                {
+                    // Range pass: reduce the max absolute value of the active block into the scale buffer
+                    rewriter.create<mlir::memref::StoreOp>(loc, zeroConst, quantizationScaleBuffer, mlir::ValueRange{ zeroIndex });
+                    auto [rangeNestOp, rangeScheduleOp, rangeExecPlanOp] = CreateActiveBlockCacheLoopnest(rewriter, loc, memRefType, activeBlockShape, {}, std::nullopt, elementByteWidth, execTarget, std::nullopt, "quantize_range", [&](OpBuilder& currentBuilder, const std::vector<mlir::Value>& domainIndices, const std::vector<mlir::Value>& /*orderedSymbolicIndexOpValues*/) {
+                        std::vector<mlir::Value> lowerBoundOffsetIVs;
+                        lowerBoundOffsetIVs.reserve(domainIndices.size());
+                        assert(lbMaps.size() == domainIndices.size());
+                        mlir::AffineExpr sumExpr = currentBuilder.getAffineDimExpr(0) + currentBuilder.getAffineDimExpr(1);
+                        mlir::AffineMap sumMap = mlir::AffineMap::get(2, 0, sumExpr);
+                        for (unsigned arrayDim = 0; arrayDim < domainIndices.size(); ++arrayDim)
+                        {
+                            mlir::Value lbMapApplied = currentBuilder.create<mlir::AffineApplyOp>(loc, lbMaps[arrayDim], lbOperands);
+                            mlir::Value lbOffsetIV = currentBuilder.create<mlir::AffineApplyOp>(loc, sumMap, mlir::ValueRange{ lbMapApplied, domainIndices[arrayDim] });
+                            lowerBoundOffsetIVs.push_back(lbOffsetIV);
+                        }
+
+                        mlir::Value loadedValue = CreateLoad(currentBuilder, loc, array, lowerBoundOffsetIVs);
+                        mlir::Value absValue = currentBuilder.create<mlir::math::AbsOp>(loc, loadedValue);
+                        mlir::Value currentMax = currentBuilder.create<mlir::memref::LoadOp>(loc, quantizationScaleBuffer, mlir::ValueRange{ zeroIndex });
+                        mlir::Value newMax = currentBuilder.create<arith::MaxFOp>(loc, absValue, currentMax);
+                        currentBuilder.create<mlir::memref::StoreOp>(loc, newMax, quantizationScaleBuffer, mlir::ValueRange{ zeroIndex });
+                    });
+                    auto rangeOrder = rangeScheduleOp.getOrder();
+                    for (const auto& loopIndex : rangeOrder)
+                    {
+                        rangeScheduleOp.addLoopAttribute(loopIndex, rewriter.getStringAttr(AccessBoundsCheckAttrName), rewriter.getUnitAttr());
+                    }
+
+                    // Turn the max into the stored scale and the reciprocal the fill multiplies by,
+                    // guarding against an all-zero active block
+                    mlir::Value maxAbs = rewriter.create<mlir::memref::LoadOp>(loc, quantizationScaleBuffer, mlir::ValueRange{ zeroIndex });
+                    mlir::Value nonZero = rewriter.create<arith::CmpFOp>(loc, arith::CmpFPredicate::OGT, maxAbs, zeroConst);
+                    mlir::Value oneConst = rewriter.create<arith::ConstantOp>(loc, rewriter.getFloatAttr(arrayElementType, 1.0));
+                    mlir::Value rawScale = rewriter.create<arith::DivFOp>(loc, maxAbs, limitConst);
+                    mlir::Value scale = rewriter.create<mlir::SelectOp>(loc, nonZero, rawScale, oneConst);
+                    rewriter.create<mlir::memref::StoreOp>(loc, scale, quantizationScaleBuffer, mlir::ValueRange{ zeroIndex });
+                    mlir::Value rawRecip = rewriter.create<arith::DivFOp>(loc, limitConst, maxAbs);
+                    quantizationRecip = rewriter.create<mlir::SelectOp>(loc, nonZero, rawRecip, oneConst);
+                    quantizationHalf = rewriter.create<arith::ConstantOp>(loc, rewriter.getFloatAttr(arrayElementType, 0.5));
+                }
+                else
+                {
+                    quantizationScale = rewriter.create<mlir::memref::LoadOp>(loc, quantizationScaleBuffer, mlir::ValueRange{ zeroIndex });
+                }
+            }
+
+            auto [copyNestOp, copyScheduleOp, copyExecPlanOp] = CreateActiveBlockCacheLoopnest(rewriter, loc, memRefType, activeBlockShape, {}, vecInfo, elementByteWidth, execTarget, std::nullopt, "copy", [&](OpBuilder& currentBuilder, const std::vector<mlir::Value>& domainIndices, const std::vector<mlir::Value>& /*orderedSymbolicIndexOpValues*/) {
+                // The induction variables have been shifted to represent the constant iteration space
+                // however, the maps expect they are constructed based on the original mappings so we
+                // need to offset each IV by its lower bound map applied to its lower bound operands
+                // e.g. affine.for %arg5 = affine_map<(d0) -> (d0)>(%arg4) to affine_map<(d0) -> (d0 + 256)>(%arg4) {
+                //      became
+                //      affine.for %arg5 = 0 to 256 {
+                //      so now we need to do
+                //      %lb_resolve = affine.apply affine_map<(d0) -> (d0)>(%arg4)
+                //      %real_arg5 = affine.apply affine_map<(d0, d1) -> (d0 + d1)>(%lb_resolve, %arg5)
+
+                std::vector<mlir::Value> lowerBoundOffsetIVs;
+                lowerBoundOffsetIVs.reserve(domainIndices.size());
+                assert(lbMaps.size() == domainIndices.size());
+                mlir::AffineExpr sumExpr = currentBuilder.getAffineDimExpr(0) + currentBuilder.getAffineDimExpr(1);
+                mlir::AffineMap sumMap = mlir::AffineMap::get(2, 0, sumExpr);
+                for (unsigned arrayDim = 0; arrayDim < domainIndices.size(); ++arrayDim)
                 {
                     mlir::Value lbMapApplied = currentBuilder.create<mlir::AffineApplyOp>(loc, lbMaps[arrayDim], lbOperands);
                     mlir::Value lbOffsetIV = currentBuilder.create<mlir::AffineApplyOp>(loc, sumMap, mlir::ValueRange{ lbMapApplied, domainIndices[arrayDim] });
@@ -2953,13 +3692,34 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
 
                 if (arrayToCache)
                 {
+                    if (prefetchDistance > 0)
+                    {
+                        createSourcePrefetch(currentBuilder, array, lowerBoundOffsetIVs);
+                    }
                     mlir::Value loadedValue = CreateLoad(currentBuilder, loc, array, lowerBoundOffsetIVs);
+                    if (quantizationRecip)
+                    {
+                        // Scale into the integer range and bias by +/- 0.5 so the store's truncating
+                        // float-to-int cast rounds to nearest
+                        mlir::Value scaled = currentBuilder.create<arith::MulFOp>(loc, loadedValue, quantizationRecip);
+                        mlir::Value signedHalf = currentBuilder.create<mlir::math::CopySignOp>(loc, quantizationHalf, scaled);
+                        loadedValue = currentBuilder.create<arith::AddFOp>(loc, scaled, signedHalf);
+                    }
                     CreateStore(currentBuilder, loc, loadedValue, cache, lowerBoundOffsetIVs);
                 }
                 else
                 {
                     mlir::Value loadedValue = CreateLoad(currentBuilder, loc, cache, lowerBoundOffsetIVs);
-                    CreateStore(currentBuilder, loc, loadedValue, array, lowerBoundOffsetIVs);
+                    if (quantizationScale)
+                    {
+                        mlir::Value dequantized = currentBuilder.create<accera::ir::value::CastOp>(loc, loadedValue, arrayElementType, true /* compiler-internal */);
+                        loadedValue = currentBuilder.create<arith::MulFOp>(loc, dequantized, quantizationScale);
+                    }
+                    auto arrayStore = CreateStore(currentBuilder, loc, loadedValue, array, lowerBoundOffsetIVs);
+                    if (nontemporalStores)
+                    {
+                        arrayStore->setAttr(NonTemporalStoreAttrName, currentBuilder.getUnitAttr());
+                    }
                 }
             });
             // Bounds check cache copy loads/stores so we don't introduce
@@ -2968,6 +3728,12 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
             for (const auto& loopIndex : copyOrder)
             {
                 copyScheduleOp.addLoopAttribute(loopIndex, rewriter.getStringAttr(AccessBoundsCheckAttrName), rewriter.getUnitAttr());
+                if (arrayToCache)
+                {
+                    // Tag the fill loops so the cache fill fusion pass can interleave adjacent
+                    // compatible fills once they've been lowered to affine loops
+                    copyScheduleOp.addLoopAttribute(loopIndex, rewriter.getStringAttr(CacheFillNestAttrName), rewriter.getUnitAttr());
+                }
             }
         }
     }
@@ -2987,13 +3753,21 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
 
         if (arrayToCache)
         {
+            if (prefetchDistance > 0 && execTarget == v::ExecutionTarget::CPU)
+            {
+                createSourcePrefetch(currentBuilder, array, copyIVs);
+            }
             mlir::Value loadedValue = CreateLoad(currentBuilder, loc, array, copyIVs);
             CreateStore(currentBuilder, loc, loadedValue, cache, copyIVs);
         }
         else
         {
             mlir::Value loadedValue = CreateLoad(currentBuilder, loc, cache, copyIVs);
-            CreateStore(currentBuilder, loc, loadedValue, array, copyIVs);
+            auto arrayStore = CreateStore(currentBuilder, loc, loadedValue, array, copyIVs);
+            if (nontemporalStores)
+            {
+                arrayStore->setAttr(NonTemporalStoreAttrName, currentBuilder.getUnitAttr());
+            }
         }
     }
 
@@ -3002,6 +3776,93 @@ LogicalResult ActiveBlockCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCop
     return success();
 }
 
+// Emits a counter-based random word for stochastic rounding: a pure function of the seed and the
+// access indices, in the spirit of the runtime's Philox generator. The hash is built from
+// splitmix-style integer mixing of the IVs so it stays in the vector domain when the writeback
+// loop is vectorized instead of serializing on a runtime RNG call per element
+mlir::Value CreateStochasticRoundingWord(mlir::OpBuilder& builder, mlir::Location loc, int64_t seed, const std::vector<mlir::Value>& accessIVs)
+{
+    auto i32Type = builder.getIntegerType(32);
+    auto i32Const = [&](uint32_t val) -> mlir::Value {
+        return builder.create<arith::ConstantOp>(loc, builder.getIntegerAttr(i32Type, static_cast<int64_t>(val)));
+    };
+
+    // Fold the full 64-bit seed into the 32-bit stream key at compile time
+    mlir::Value hash = i32Const((static_cast<uint32_t>(seed) ^ static_cast<uint32_t>(seed >> 32)) | 1u);
+    mlir::Value shift15 = i32Const(15);
+    mlir::Value shift16 = i32Const(16);
+    mlir::Value mult = i32Const(0x9E3779B9u);
+    for (auto& iv : accessIVs)
+    {
+        mlir::Value ivWord = builder.create<arith::IndexCastOp>(loc, i32Type, iv);
+        hash = builder.create<arith::XOrIOp>(loc, hash, ivWord);
+        hash = builder.create<arith::MulIOp>(loc, hash, mult);
+        hash = builder.create<arith::XOrIOp>(loc, hash, builder.create<arith::ShRUIOp>(loc, hash, shift16));
+    }
+    // splitmix32-style finalizer so neighboring elements decorrelate in the low bits too
+    hash = builder.create<arith::MulIOp>(loc, hash, i32Const(0x7FEB352Du));
+    hash = builder.create<arith::XOrIOp>(loc, hash, builder.create<arith::ShRUIOp>(loc, hash, shift15));
+    hash = builder.create<arith::MulIOp>(loc, hash, i32Const(0x846CA68Bu));
+    hash = builder.create<arith::XOrIOp>(loc, hash, builder.create<arith::ShRUIOp>(loc, hash, shift16));
+    return hash;
+}
+
+// Narrows a float accumulator value to the array element type with the requested rounding mode.
+// All of the emitted sequences are elementwise arith/math ops, so they vectorize with the
+// surrounding writeback loop
+mlir::Value CreateRoundedWritebackValue(mlir::OpBuilder& builder, mlir::Location loc, mlir::Value accumValue, mlir::Type targetType, bool stochasticRounding, int64_t roundingSeed, const std::vector<mlir::Value>& accessIVs)
+{
+    auto accumType = accumValue.getType();
+    if (targetType.isa<mlir::FloatType>())
+    {
+        if (stochasticRounding && targetType.isBF16() && accumType.isF32())
+        {
+            // bf16 is the top half of an f32, so stochastic rounding is an integer add of random
+            // low bits followed by truncation: the value rounds up with probability equal to the
+            // fraction of the discarded mantissa
+            auto i32Type = builder.getIntegerType(32);
+            auto i16Type = builder.getIntegerType(16);
+            mlir::Value bits = builder.create<arith::BitcastOp>(loc, i32Type, accumValue);
+            mlir::Value randomWord = CreateStochasticRoundingWord(builder, loc, roundingSeed, accessIVs);
+            mlir::Value lowMask = builder.create<arith::ConstantOp>(loc, builder.getIntegerAttr(i32Type, 0xFFFF));
+            bits = builder.create<arith::AddIOp>(loc, bits, builder.create<arith::AndIOp>(loc, randomWord, lowMask));
+            mlir::Value shift16 = builder.create<arith::ConstantOp>(loc, builder.getIntegerAttr(i32Type, 16));
+            mlir::Value truncatedBits = builder.create<arith::TruncIOp>(loc, i16Type, builder.create<arith::ShRUIOp>(loc, bits, shift16));
+            return builder.create<arith::BitcastOp>(loc, targetType, truncatedBits);
+        }
+        // fptrunc rounds to nearest-even, which also covers stochastic requests on float targets
+        // whose narrowing isn't a bit-level truncation of the accumulator (e.g. f32 -> f16)
+        return builder.create<arith::TruncFOp>(loc, targetType, accumValue);
+    }
+
+    // Integer target: clamp to the representable range first so the rounding bias can't wrap
+    auto intWidth = targetType.cast<mlir::IntegerType>().getWidth();
+    auto limit = static_cast<double>((1ll << (intWidth - 1)) - 1);
+    mlir::Value lowerLimit = builder.create<arith::ConstantOp>(loc, builder.getFloatAttr(accumType, -limit - 1));
+    mlir::Value upperLimit = builder.create<arith::ConstantOp>(loc, builder.getFloatAttr(accumType, limit));
+    mlir::Value clamped = builder.create<arith::MinFOp>(loc, builder.create<arith::MaxFOp>(loc, accumValue, lowerLimit), upperLimit);
+    mlir::Value rounded;
+    if (stochasticRounding)
+    {
+        // floor(x + u) with u uniform in [0, 1) rounds up with probability frac(x)
+        mlir::Value randomWord = CreateStochasticRoundingWord(builder, loc, roundingSeed, accessIVs);
+        mlir::Value uniform = builder.create<arith::UIToFPOp>(loc, accumType, randomWord);
+        mlir::Value wordScale = builder.create<arith::ConstantOp>(loc, builder.getFloatAttr(accumType, 1.0 / 4294967296.0));
+        mlir::Value biased = builder.create<arith::AddFOp>(loc, clamped, builder.create<arith::MulFOp>(loc, uniform, wordScale));
+        rounded = builder.create<mlir::math::FloorOp>(loc, biased);
+    }
+    else
+    {
+        // Round to nearest-even via the shift-by-magic-number trick: adding and subtracting
+        // 1.5 * 2^mantissaBits leaves the integer-rounded value under the default FP rounding
+        // mode, and unlike a libm roundeven call it vectorizes
+        auto magicNumber = accumType.isF64() ? 6755399441055744.0 : 12582912.0;
+        mlir::Value magic = builder.create<arith::ConstantOp>(loc, builder.getFloatAttr(accumType, magicNumber));
+        rounded = builder.create<arith::SubFOp>(loc, builder.create<arith::AddFOp>(loc, clamped, magic), magic);
+    }
+    return builder.create<arith::FPToSIOp>(loc, targetType, rounded);
+}
+
 LogicalResult ActiveBlockCacheReduceOpRewrite::matchAndRewrite(ActiveBlockCacheReduceOp cacheReduceOp, PatternRewriter& rewriter) const
 {
     // Copy data from the source buffer to the destination buffer by iterating over the cache region shape described
@@ -3030,7 +3891,11 @@ LogicalResult ActiveBlockCacheReduceOpRewrite::matchAndRewrite(ActiveBlockCacheR
     auto array = cacheReduceOp.array();
     assert(array.getType().isa<MemRefType>());
     auto memRefType = array.getType().cast<MemRefType>();
-    [[maybe_unused]] auto baseArrayElementType = GetInnerElementType(array); // e.g. f32
+    auto baseArrayElementType = GetInnerElementType(array); // e.g. f32
+
+    // Set when the cache was configured for streaming writeback and the region analysis showed
+    // the output is not re-read after this reduce, so the stores shouldn't displace cache lines
+    const bool nontemporalStores = HasNonTemporalWriteback(cacheReduceOp);
 
     auto elementBitWidth = memRefType.getElementTypeBitWidth();
     auto elementByteWidth = elementBitWidth / 8;
@@ -3040,6 +3905,23 @@ LogicalResult ActiveBlockCacheReduceOpRewrite::matchAndRewrite(ActiveBlockCacheR
     auto cacheMemRefType = cache.getType().cast<MemRefType>();
     const v::MemorySpace cacheMemRefSpace{ cacheMemRefType.getMemorySpaceAsInt() };
 
+    // When the cache holds a wider float accumulator than the array element type (e.g. f32
+    // accumulators reduced into an int8 or bf16 output), fuse the narrowing conversion into the
+    // writeback instead of requiring a separate conversion pass over the output, honoring the
+    // configured rounding mode
+    auto cacheElementType = GetInnerElementType(cache);
+    const bool fusedNarrowingWriteback = cacheElementType != baseArrayElementType && cacheElementType.isa<mlir::FloatType>();
+    bool stochasticRounding = false;
+    int64_t roundingSeed = 0;
+    if (auto roundingModeAttr = cacheReduceOp->getAttrOfType<mlir::StringAttr>(WritebackRoundingModeAttrName))
+    {
+        stochasticRounding = roundingModeAttr.getValue() == StochasticRoundingModeName;
+    }
+    if (auto roundingSeedAttr = cacheReduceOp->getAttrOfType<mlir::IntegerAttr>(WritebackRoundingSeedAttrName))
+    {
+        roundingSeed = roundingSeedAttr.getInt();
+    }
+
     // Similar to generatePointWiseCopy() from llvm-project/mlir/lib/Dialect/Affine/Utils/LoopUtils.cpp however
     // we have a custom mapping from the active block to the cache position
 
@@ -3077,13 +3959,17 @@ LogicalResult ActiveBlockCacheReduceOpRewrite::matchAndRewrite(ActiveBlockCacheR
         auto& colIdx = indices.end()[-1];
         rowIdx = rewriter.create<mlir::arith::SubIOp>(loc, rowIdx, rewriter.create<mlir::arith::RemSIOp>(loc, rowIdx, mmaTileRows));
         colIdx = rewriter.create<mlir::arith::SubIOp>(loc, colIdx, rewriter.create<mlir::arith::RemSIOp>(loc, colIdx, mmaTileCols));
-        rewriter.create<MMAStoreSyncOp>(loc, cache, array, mmaOp.getShapeType(), indices);
+        auto mmaStoreOp = rewriter.create<MMAStoreSyncOp>(loc, cache, array, mmaOp.getShapeType(), indices);
+        if (auto epilogueOp = tensorizationInfo->getValue().epilogueOp; epilogueOp != v::MMAFragmentOpType::None)
+        {
+            mmaStoreOp->setAttr(v::MMAEpilogueOpAttrName, rewriter.getI8IntegerAttr(static_cast<int8_t>(epilogueOp)));
+        }
     }
     else
     {
         OpBuilder currentBuilder = rewriter;
 
-        auto scaleValue = CreateProductOfValues(rewriter, loc, baseArrayElementType, adaptor.scaleValues());
+        auto scaleValue = CreateProductOfValues(rewriter, loc, fusedNarrowingWriteback ? cacheElementType : baseArrayElementType, adaptor.scaleValues());
 
         auto constantShapeOpt = GetConstantActiveBlockShape(lbMaps, ubMaps);
 
@@ -3140,8 +4026,22 @@ LogicalResult ActiveBlockCacheReduceOpRewrite::matchAndRewrite(ActiveBlockCacheR
                 mlir::Value loadedCacheValue = CreateLoad(currentBuilder, loc, cache, lowerBoundOffsetIVs);
                 auto scaledCacheValue = currentBuilder.create<v::BinOp>(loc, BinaryOpPredicate::MUL, scaleValue, loadedCacheValue);
                 mlir::Value currentArrayValue = CreateLoad(currentBuilder, loc, array, lowerBoundOffsetIVs);
-                auto accumulatedValue = currentBuilder.create<v::BinOp>(loc, BinaryOpPredicate::ADD, currentArrayValue, scaledCacheValue);
-                CreateStore(currentBuilder, loc, accumulatedValue, array, lowerBoundOffsetIVs);
+                if (fusedNarrowingWriteback)
+                {
+                    // Accumulate in the cache's wider type; the store below narrows with the
+                    // configured rounding
+                    currentArrayValue = currentBuilder.create<v::CastOp>(loc, currentArrayValue, cacheElementType, true /* compiler-internal */);
+                }
+                mlir::Value accumulatedValue = currentBuilder.create<v::BinOp>(loc, BinaryOpPredicate::ADD, currentArrayValue, scaledCacheValue);
+                if (fusedNarrowingWriteback)
+                {
+                    accumulatedValue = CreateRoundedWritebackValue(currentBuilder, loc, accumulatedValue, baseArrayElementType, stochasticRounding, roundingSeed, lowerBoundOffsetIVs);
+                }
+                auto arrayStore = CreateStore(currentBuilder, loc, accumulatedValue, array, lowerBoundOffsetIVs);
+                if (nontemporalStores)
+                {
+                    arrayStore->setAttr(NonTemporalStoreAttrName, currentBuilder.getUnitAttr());
+                }
             });
 
             // Bounds check cache copy loads/stores so we don't introduce
@@ -3167,8 +4067,20 @@ LogicalResult ActiveBlockCacheReduceOpRewrite::matchAndRewrite(ActiveBlockCacheR
             mlir::Value loadedCacheValue = CreateLoad(currentBuilder, loc, cache, IVs);
             auto scaledCacheValue = currentBuilder.create<v::BinOp>(loc, BinaryOpPredicate::MUL, scaleValue, loadedCacheValue);
             mlir::Value currentArrayValue = CreateLoad(currentBuilder, loc, array, IVs);
-            auto accumulatedValue = currentBuilder.create<v::BinOp>(loc, BinaryOpPredicate::ADD, currentArrayValue, scaledCacheValue);
-            CreateStore(currentBuilder, loc, accumulatedValue, array, IVs);
+            if (fusedNarrowingWriteback)
+            {
+                currentArrayValue = currentBuilder.create<v::CastOp>(loc, currentArrayValue, cacheElementType, true /* compiler-internal */);
+            }
+            mlir::Value accumulatedValue = currentBuilder.create<v::BinOp>(loc, BinaryOpPredicate::ADD, currentArrayValue, scaledCacheValue);
+            if (fusedNarrowingWriteback)
+            {
+                accumulatedValue = CreateRoundedWritebackValue(currentBuilder, loc, accumulatedValue, baseArrayElementType, stochasticRounding, roundingSeed, IVs);
+            }
+            auto arrayStore = CreateStore(currentBuilder, loc, accumulatedValue, array, IVs);
+            if (nontemporalStores)
+            {
+                arrayStore->setAttr(NonTemporalStoreAttrName, currentBuilder.getUnitAttr());
+            }
         }
     }
     rewriter.eraseOp(cacheReduceOp);
@@ -3328,6 +4240,48 @@ std::vector<int64_t> GetFullCacheShapeHelper(const std::vector<int64_t>& multiCa
     return combinedCacheShape;
 }
 
+// Builds the structural fingerprint that the thrifty stride determination depends on. The
+// iteration-to-iteration stride diffs cancel the bound operands symbolically, so as long as the
+// operands are block arguments (loop IVs) the result is fully determined by the maps, layouts,
+// shapes and which operand positions are multiCache IVs. Operands defined by other ops get
+// composed through their defining maps and so aren't captured by this fingerprint; those calls
+// return an empty key and skip memoization
+std::string GetThriftyStrideAnalysisKey(mlir::Value outerArray,
+                                        mlir::Value cacheArray,
+                                        const std::vector<mlir::Value>& multiCacheIVs,
+                                        const std::vector<int64_t>& fullCacheShape,
+                                        const std::vector<int64_t>& fullCacheStepSizes,
+                                        const std::vector<mlir::Value>& activeBlockExternalSymbols,
+                                        mlir::ArrayAttr lbMapsArrayAttr,
+                                        mlir::ArrayAttr ubMapsArrayAttr)
+{
+    if (!std::all_of(activeBlockExternalSymbols.begin(), activeBlockExternalSymbols.end(), [](mlir::Value symbol) {
+            return symbol.isa<mlir::BlockArgument>();
+        }))
+    {
+        return {};
+    }
+
+    std::string key;
+    llvm::raw_string_ostream keyStream(key);
+    keyStream << outerArray.getType() << "|" << cacheArray.getType() << "|" << lbMapsArrayAttr << "|" << ubMapsArrayAttr;
+    for (auto extent : fullCacheShape)
+    {
+        keyStream << "|" << extent;
+    }
+    for (auto stepSize : fullCacheStepSizes)
+    {
+        keyStream << "|" << stepSize;
+    }
+    for (auto symbol : activeBlockExternalSymbols)
+    {
+        auto multiCacheIVIter = std::find(multiCacheIVs.begin(), multiCacheIVs.end(), symbol);
+        keyStream << "|" << (multiCacheIVIter == multiCacheIVs.end() ? -1 : std::distance(multiCacheIVs.begin(), multiCacheIVIter));
+    }
+    keyStream.flush();
+    return key;
+}
+
 bool ThriftyCacheAllSingleElementStridesHelper(mlir::PatternRewriter& rewriter,
                                                mlir::OpBuilder& currentBuilder, // Builder positioned inside of the temp multicache loops (if there are any)
                                                mlir::Location loc,
@@ -3338,8 +4292,19 @@ bool ThriftyCacheAllSingleElementStridesHelper(mlir::PatternRewriter& rewriter,
                                                const std::vector<int64_t>& fullCacheStepSizes,
                                                const std::vector<mlir::Value>& activeBlockExternalSymbols,
                                                mlir::ArrayAttr lbMapsArrayAttr,
-                                               mlir::ArrayAttr ubMapsArrayAttr)
+                                               mlir::ArrayAttr ubMapsArrayAttr,
+                                               const ThriftyCacheStrideAnalysisPtr& strideAnalysis)
 {
+    auto strideAnalysisKey = strideAnalysis ? GetThriftyStrideAnalysisKey(outerArray, cacheArray, multiCacheIVs, fullCacheShape, fullCacheStepSizes, activeBlockExternalSymbols, lbMapsArrayAttr, ubMapsArrayAttr) : std::string{};
+    if (!strideAnalysisKey.empty())
+    {
+        auto cachedResultIter = strideAnalysis->singleElementStrideResults.find(strideAnalysisKey);
+        if (cachedResultIter != strideAnalysis->singleElementStrideResults.end())
+        {
+            return cachedResultIter->second;
+        }
+    }
+
     mlir::ValueRange lbOperands = activeBlockExternalSymbols;
     [[maybe_unused]] mlir::ValueRange ubOperands = activeBlockExternalSymbols;
 
@@ -3513,6 +4478,11 @@ bool ThriftyCacheAllSingleElementStridesHelper(mlir::PatternRewriter& rewriter,
     assert(temporaryOpsOne.empty());
     assert(temporaryOpsTwo.empty());
 
+    if (!strideAnalysisKey.empty())
+    {
+        strideAnalysis->singleElementStrideResults[strideAnalysisKey] = allSingleElementStrides;
+    }
+
     return allSingleElementStrides;
 }
 
@@ -3673,7 +4643,8 @@ LogicalResult ThriftyCacheMultiCopyOpRewrite::matchAndRewrite(MultiCacheCopyOp m
                                                                                      fullCacheStepSizes,
                                                                                      info.activeBlockExternalSymbols,
                                                                                      lbMapsArrayAttr,
-                                                                                     ubMapsArrayAttr);
+                                                                                     ubMapsArrayAttr,
+                                                                                     _strideAnalysis);
 
             if (allSingleElementStrides)
             {
@@ -3754,7 +4725,8 @@ LogicalResult ThriftyCacheCopyOpRewrite::matchAndRewrite(ActiveBlockCacheCopyOp
                                                                              activeBlockStepSizes,
                                                                              lbOperandsVec,
                                                                              lbMapsArrayAttr,
-                                                                             ubMapsArrayAttr);
+                                                                             ubMapsArrayAttr,
+                                                                             _strideAnalysis);
 
     if (allSingleElementStrides)
     {
@@ -3823,7 +4795,8 @@ LogicalResult ThriftyCacheReduceOpRewrite::matchAndRewrite(ActiveBlockCacheReduc
                                                                              activeBlockStepSizes,
                                                                              lbOperandsVec,
                                                                              lbMapsArrayAttr,
-                                                                             ubMapsArrayAttr);
+                                                                             ubMapsArrayAttr,
+                                                                             _strideAnalysis);
 
     if (allSingleElementStrides)
     {
@@ -4144,6 +5117,56 @@ LogicalResult AdjustCacheMappingPositionRewrite::matchAndRewrite(BeginCacheMappi
     return success();
 }
 
+LogicalResult HoistCacheMappingOpsRewrite::matchAndRewrite(BeginCacheMappingOp beginCacheMappingOp, PatternRewriter& rewriter) const
+{
+    // If a cache mapping region spans the entire body of an AffineForOp and the mapping setup doesn't depend on
+    // anything defined inside that loop, then the mapping is invariant with respect to the loop and the
+    // BeginCacheMappingOp / EndCacheMappingOp pair can be hoisted to wrap the loop rather than being re-entered
+    // on every iteration.
+    // AdjustCacheMappingPositionRewrite already pushes mapping begin/end ops to the extremes of their block, so
+    // here we only need to recognize the block-spanning case and step the pair out one loop level at a time,
+    // letting repeated applications walk invariant mappings out of multi-level nests.
+
+    auto parentLoop = mlir::dyn_cast_or_null<AffineForOp>(beginCacheMappingOp->getParentOp());
+    if (!parentLoop)
+    {
+        return failure();
+    }
+
+    auto parentBlock = beginCacheMappingOp->getBlock();
+    auto endOp = mlir::dyn_cast<EndCacheMappingOp>(beginCacheMappingOp.getEndOp());
+    if (endOp->getBlock() != parentBlock)
+    {
+        return failure();
+    }
+
+    // The mapping region must cover the full loop body: the begin op is the first op in the block and the end op
+    // is the last op before the loop terminator. Anything outside of the region would otherwise be pulled into it
+    // (or pushed out of it) by the hoist.
+    if (beginCacheMappingOp.getOperation() != &(parentBlock->front()))
+    {
+        return failure();
+    }
+    if (endOp->getNextNode() != parentBlock->getTerminator())
+    {
+        return failure();
+    }
+
+    // The mapping setup must not depend on any value defined inside the loop, such as the loop induction variable
+    // or a per-iteration multiCache slice
+    auto& loopRegion = parentLoop.getLoopBody();
+    if (llvm::any_of(beginCacheMappingOp->getOperands(), [&](mlir::Value operand) {
+            return loopRegion.isAncestor(operand.getParentRegion());
+        }))
+    {
+        return failure();
+    }
+
+    beginCacheMappingOp->moveBefore(parentLoop);
+    endOp->moveAfter(parentLoop);
+    return success();
+}
+
 LogicalResult BeginCacheMappingOpRewrite::matchAndRewrite(BeginCacheMappingOp beginCacheMappingOp, PatternRewriter& rewriter) const
 {
     // BeginCacheMappingOp examines the subgraph contained between it and its corresponding EndCacheMappingOp,
@@ -4368,6 +5391,10 @@ LogicalResult BeginCacheMappingOpRewrite::matchAndRewrite(BeginCacheMappingOp be
                         auto baseArrayPosition = GetBaseArrayPosition(rewriter, loc, storeOp);
                         auto newStoreOp = CreateMMAStore(rewriter, loc, storeAdaptor.src(), cacheSrc, mmaShapeType, baseArrayPosition);
                         TransferOrSetAccessAttrs(storeOp, newStoreOp);
+                        if (auto epilogueAttr = storeOp->getAttr(v::MMAEpilogueOpAttrName))
+                        {
+                            newStoreOp->setAttr(v::MMAEpilogueOpAttrName, epilogueAttr);
+                        }
                         rewriter.eraseOp(storeOp);
                     }
                 }
@@ -4375,7 +5402,12 @@ LogicalResult BeginCacheMappingOpRewrite::matchAndRewrite(BeginCacheMappingOp be
                 {
                     const auto accessIndices = ResolveParentRelevantScheduleIndices(storeOp, toValueAccessContext.fullRelevantScheduleIndices);
                     auto indices = util::MultiDimAffineApply(rewriter, loc, cacheMap, accessIndices);
-                    rewriter.replaceOpWithNewOp<v::MMAStoreSyncOp>(storeOp, storeAdaptor.src(), cacheSrc, mmaShapeType, indices);
+                    auto epilogueAttr = storeOp->getAttr(v::MMAEpilogueOpAttrName);
+                    auto newStoreOp = rewriter.replaceOpWithNewOp<v::MMAStoreSyncOp>(storeOp, storeAdaptor.src(), cacheSrc, mmaShapeType, indices);
+                    if (epilogueAttr)
+                    {
+                        newStoreOp->setAttr(v::MMAEpilogueOpAttrName, epilogueAttr);
+                    }
                 }
             })
             .Case([&](ActiveElementCacheCopyOp cacheCopyOp) {
@@ -5218,6 +6250,23 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
 
             currentMultiCacheInfo.activeBlockToCacheMap = CreateActiveBlockToCacheMap(rewriter, tempActiveBlockRegionInfo.cacheAccessContext);
 
+            // Swizzle shared memory cache layouts when tensorization is active so MMA fragment
+            // reads don't serialize on bank conflicts, sizing the rotation by how many
+            // contiguous elements each lane of the MMA loads
+            if (shapedMakeCacheOp.memorySpace() == v::MemorySpace::Shared && vLambdaOp && HasTensorizationInfo(vLambdaOp))
+            {
+                auto tensorizationInfo = GetTensorizationInfo(vLambdaOp);
+                const v::MMAOp mmaOp(tensorizationInfo.dim);
+                if (auto warpSizeOpt = util::ResolveWarpSize(util::ResolveExecutionRuntime(beginCreateCacheOp)))
+                {
+                    auto fragmentWidth = mmaOp.getInElementsPerThread(warpSizeOpt->first * warpSizeOpt->second);
+                    currentMultiCacheInfo.activeBlockToCacheMap = ApplySharedMemoryBankSwizzle(currentMultiCacheInfo.activeBlockToCacheMap,
+                                                                                              shapedMakeCacheOp.getType().cast<mlir::MemRefType>().getShape(),
+                                                                                              fragmentWidth,
+                                                                                              rewriter.getContext());
+                }
+            }
+
             size_t activeBlockRank = currentMultiCacheInfo.activeBlockInfo.shape.size();
             std::vector<mlir::Value> multiCacheIVs;
             std::transform(currentMultiCacheInfo.multiCacheLoops.begin(), currentMultiCacheInfo.multiCacheLoops.end(), std::back_inserter(multiCacheIVs), [&](mlir::AffineForOp loop) {
@@ -5264,7 +6313,21 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                 assert(inputOnlyCache && "Double buffering is only supported for read-only caches");
                 assert(multiCacheInfo.multiCache.memorySpace() != v::MemorySpace::Tensor && "Tensor caching cannot be used with double-buffering.");
 
-                auto doubleBufferTempArray = CreateDoubleBufferTempArray(rewriter, multiCacheInfo, beginCreateCacheOp);
+                // Resolve the fill pipeline depth: 2 is classic double-buffering with a single in-flight
+                // temp buffer, while deeper values rotate (pipelineDepth - 1) temp stage buffers so that
+                // more cache fill iterations can be in flight at once
+                int64_t pipelineDepth = 2;
+                if (auto pipelineDepthAttr = beginCreateCacheOp->getAttrOfType<mlir::IntegerAttr>("pipelineDepth"))
+                {
+                    pipelineDepth = std::max<int64_t>(2, pipelineDepthAttr.getInt());
+                }
+                int64_t numStages = pipelineDepth - 1;
+
+                std::vector<MakeCacheOp> stageTempArrays;
+                for (int64_t stageIdx = 0; stageIdx < numStages; ++stageIdx)
+                {
+                    stageTempArrays.push_back(CreateDoubleBufferTempArray(rewriter, multiCacheInfo, beginCreateCacheOp));
+                }
 
                 // Create the 0'th iteration copy just before the triggerLoopParentLoop
                 auto parentLoopBlock = triggerLoopParentLoop->getBlock();
@@ -5272,7 +6335,7 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                 rewriter.setInsertionPoint(parentLoopBlock, triggerLoopParentLoop->getIterator());
 
                 mlir::Value triggerLoopParentIV = triggerLoopParentLoop.getInductionVar();
-                [[maybe_unused]] int64_t triggerLoopParentFirstIterIntValue = triggerLoopParentLoop.getConstantLowerBound();
+                int64_t triggerLoopParentFirstIterIntValue = triggerLoopParentLoop.getConstantLowerBound();
                 [[maybe_unused]] int64_t triggerLoopParentStepSize = triggerLoopParentLoop.getStep();
 
                 // Clone the parent loop and wrap it around this ActiveBlockCacheCopyOp for cache access resolution
@@ -5302,22 +6365,67 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                                                                           true, // toCache
                                                                           beginCreateCacheOp.vectorizationInfoAttr(),
                                                                           TensorizationInfoAttr{});
+                PropagatePrefetchAttrs(beginCreateCacheOp, firstIterCopy);
+                PropagateQuantizedCacheAttr(beginCreateCacheOp, firstIterCopy);
                 // Re-create the affine yield op at the end of the block that we erased
                 loopBuilder.create<mlir::AffineYieldOp>(loc);
                 firstIterCopy->replaceUsesOfWith(triggerLoopParentIV, clonedtriggerLoopParentLoop.getInductionVar());
 
+                // Pre-fill iterations 1..(numStages - 1) into their stage temp buffers so that each
+                // steady-state iteration only has to issue the fill that is numStages iterations ahead
+                for (int64_t warmupIdx = 1; warmupIdx < numStages; ++warmupIdx)
+                {
+                    auto warmupLoop = dyn_cast<mlir::AffineForOp>(rewriter.clone(*(triggerLoopParentLoop.getOperation())));
+                    warmupLoop.setConstantLowerBound(triggerLoopParentFirstIterIntValue + warmupIdx * triggerLoopParentStepSize);
+                    warmupLoop.setConstantUpperBound(triggerLoopParentFirstIterIntValue + (warmupIdx + 1) * triggerLoopParentStepSize);
+
+                    util::EraseAllOpsInBlock(rewriter, warmupLoop.getLoopBody().front());
+
+                    auto warmupBuilder = util::MakeBodyBuilder(warmupLoop);
+                    auto warmupCopy = warmupBuilder.create<MultiCacheCopyOp>(loc,
+                                                                             beginCreateCacheOp.input(),
+                                                                             stageTempArrays[warmupIdx],
+                                                                             multiCacheInfo.multiCacheExternalSymbols,
+                                                                             rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheLBMaps),
+                                                                             rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheUBMaps),
+                                                                             rewriter.getI64ArrayAttr(multiCacheInfo.multiCacheStepSizes),
+                                                                             util::ConvertIndexVectorToArrayAttr(multiCacheInfo.multiCacheLoopIndexIds, rewriter.getContext()),
+                                                                             rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.lbMaps),
+                                                                             rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.ubMaps),
+                                                                             multiCacheInfo.multiCacheExternalSymbolsPermutationMap,
+                                                                             multiCacheInfo.activeBlockToCacheMap,
+                                                                             beginCreateCacheOp.thrifty(),
+                                                                             beginCreateCacheOp.strategy(),
+                                                                             true, // toCache
+                                                                             beginCreateCacheOp.vectorizationInfoAttr(),
+                                                                             TensorizationInfoAttr{});
+                    PropagatePrefetchAttrs(beginCreateCacheOp, warmupCopy);
+                    PropagateQuantizedCacheAttr(beginCreateCacheOp, warmupCopy);
+                    warmupBuilder.create<mlir::AffineYieldOp>(loc);
+                    warmupCopy->replaceUsesOfWith(triggerLoopParentIV, warmupLoop.getInductionVar());
+                }
+
                 rewriter.setInsertionPoint(triggerLevelBlock, cacheRegionStart);
 
                 // Create the BeginActiveRegionOp, denoting the beginning of the cache region as a utility for other optimizations
                 auto beginActiveRegionOp = rewriter.create<BeginActiveCacheRegionOp>(loc, multiCacheInfo.multiCache, activeBlockId);
 
-                // Create the i+1 iteration copy to the temp buffer
+                // Create the i+numStages iteration copy to the temp buffer
 
                 // Create the prologue cache data moving op
                 auto loopStepIncrementExpr = rewriter.getAffineDimExpr(0) + rewriter.getAffineConstantExpr(triggerLoopParentStepSize);
                 auto loopStepIncrementMap = mlir::AffineMap::get(1, 0, loopStepIncrementExpr);
                 mlir::Value triggerLoopParentNextIterValue = rewriter.create<mlir::AffineApplyOp>(loc, loopStepIncrementMap, mlir::ValueRange{ triggerLoopParentIV });
 
+                // The prologue fill targets the iteration numStages steps ahead of the current one
+                mlir::Value triggerLoopParentFillIterValue = triggerLoopParentNextIterValue;
+                if (numStages > 1)
+                {
+                    auto pipelineFillIncrementExpr = rewriter.getAffineDimExpr(0) + rewriter.getAffineConstantExpr(numStages * triggerLoopParentStepSize);
+                    auto pipelineFillIncrementMap = mlir::AffineMap::get(1, 0, pipelineFillIncrementExpr);
+                    triggerLoopParentFillIterValue = rewriter.create<mlir::AffineApplyOp>(loc, pipelineFillIncrementMap, mlir::ValueRange{ triggerLoopParentIV });
+                }
+
                 // Create an AffineIfOp to guard the cache fills so that it doesn't happen in the final iteration
                 // We want to load if triggerLoopParentLoop < parentLoopLastIterInt
                 int64_t parentLoopLastIterInt = triggerLoopParentLoop.getConstantUpperBound() - triggerLoopParentLoop.getStep();
@@ -5330,28 +6438,58 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
 
                 auto nonLastIterCheckSet = mlir::IntegerSet::get(1, 0, conditionalLoadConstraintExprs, constraintEqFlags);
 
-                auto prologueCopyIfOp = rewriter.create<mlir::AffineIfOp>(loc, nonLastIterCheckSet, ValueRange{ triggerLoopParentIV }, false); // false indicating we do not want an "else" region
+                // The prologue additionally has to stop filling numStages iterations before the end since the
+                // fill it issues is numStages iterations ahead
+                mlir::AffineExpr prologueGuardExpr = rewriter.getAffineConstantExpr(parentLoopLastIterInt - 1 - (numStages - 1) * triggerLoopParentStepSize) - rewriter.getAffineDimExpr(0);
+                std::vector<mlir::AffineExpr> prologueGuardExprs{ prologueGuardExpr };
+                auto prologueCheckSet = mlir::IntegerSet::get(1, 0, prologueGuardExprs, constraintEqFlags);
+
+                auto prologueCopyIfOp = rewriter.create<mlir::AffineIfOp>(loc, prologueCheckSet, ValueRange{ triggerLoopParentIV }, false); // false indicating we do not want an "else" region
                 auto prologueThenBuilder = prologueCopyIfOp.getThenBodyBuilder();
 
-                MakeDelayedMappingRegion(prologueThenBuilder, triggerLoopParentIV, triggerLoopParentNextIterValue, [&](mlir::OpBuilder& builder) {
-                    [[maybe_unused]] auto prologueTempCopy = builder.create<MultiCacheCopyOp>(loc,
-                                                                                              beginCreateCacheOp.input(),
-                                                                                              doubleBufferTempArray,
-                                                                                              multiCacheInfo.multiCacheExternalSymbols,
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheLBMaps),
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheUBMaps),
-                                                                                              rewriter.getI64ArrayAttr(multiCacheInfo.multiCacheStepSizes),
-                                                                                              util::ConvertIndexVectorToArrayAttr(multiCacheInfo.multiCacheLoopIndexIds, rewriter.getContext()),
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.lbMaps),
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.ubMaps),
-                                                                                              multiCacheInfo.multiCacheExternalSymbolsPermutationMap,
-                                                                                              multiCacheInfo.activeBlockToCacheMap,
-                                                                                              beginCreateCacheOp.thrifty(),
-                                                                                              beginCreateCacheOp.strategy(),
-                                                                                              true, // toCache
-                                                                                              beginCreateCacheOp.vectorizationInfoAttr(),
-                                                                                              TensorizationInfoAttr{});
-                });
+                auto createPrologueTempCopy = [&](mlir::OpBuilder& stageBuilder, MakeCacheOp stageTempArray) {
+                    MakeDelayedMappingRegion(stageBuilder, triggerLoopParentIV, triggerLoopParentFillIterValue, [&](mlir::OpBuilder& builder) {
+                        auto prologueTempCopy = builder.create<MultiCacheCopyOp>(loc,
+                                                                                 beginCreateCacheOp.input(),
+                                                                                 stageTempArray,
+                                                                                 multiCacheInfo.multiCacheExternalSymbols,
+                                                                                 rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheLBMaps),
+                                                                                 rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheUBMaps),
+                                                                                 rewriter.getI64ArrayAttr(multiCacheInfo.multiCacheStepSizes),
+                                                                                 util::ConvertIndexVectorToArrayAttr(multiCacheInfo.multiCacheLoopIndexIds, rewriter.getContext()),
+                                                                                 rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.lbMaps),
+                                                                                 rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.ubMaps),
+                                                                                 multiCacheInfo.multiCacheExternalSymbolsPermutationMap,
+                                                                                 multiCacheInfo.activeBlockToCacheMap,
+                                                                                 beginCreateCacheOp.thrifty(),
+                                                                                 beginCreateCacheOp.strategy(),
+                                                                                 true, // toCache
+                                                                                 beginCreateCacheOp.vectorizationInfoAttr(),
+                                                                                 TensorizationInfoAttr{});
+                        PropagatePrefetchAttrs(beginCreateCacheOp, prologueTempCopy);
+                        PropagateQuantizedCacheAttr(beginCreateCacheOp, prologueTempCopy);
+                    });
+                };
+
+                if (numStages == 1)
+                {
+                    createPrologueTempCopy(prologueThenBuilder, stageTempArrays[0]);
+                }
+                else
+                {
+                    // Iteration (i + numStages) rotates into stage ((i - lb) / step) mod numStages, so guard
+                    // each stage's fill with an equality check selecting it for the current iteration
+                    for (int64_t stageIdx = 0; stageIdx < numStages; ++stageIdx)
+                    {
+                        auto stageSelectExpr = (rewriter.getAffineDimExpr(0) - rewriter.getAffineConstantExpr(triggerLoopParentFirstIterIntValue)).floorDiv(triggerLoopParentStepSize) % numStages - rewriter.getAffineConstantExpr(stageIdx);
+                        std::vector<mlir::AffineExpr> stageSelectExprs{ stageSelectExpr };
+                        SmallVector<bool, 4> stageSelectEqFlags(1, true); // true indicating an == 0 equality check
+                        auto stageSelectSet = mlir::IntegerSet::get(1, 0, stageSelectExprs, stageSelectEqFlags);
+                        auto stageSelectIfOp = prologueThenBuilder.create<mlir::AffineIfOp>(loc, stageSelectSet, ValueRange{ triggerLoopParentIV }, false);
+                        auto stageSelectThenBuilder = stageSelectIfOp.getThenBodyBuilder();
+                        createPrologueTempCopy(stageSelectThenBuilder, stageTempArrays[stageIdx]);
+                    }
+                }
 
                 // Create mapping ops for each cache active block region associated with this multiCache
                 CreateCacheMappingRegionHelper(rewriter, beginCreateCacheOp, multiCacheInfo);
@@ -5362,28 +6500,50 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                 auto epilogueCopyIfOp = rewriter.create<mlir::AffineIfOp>(loc, nonLastIterCheckSet, ValueRange{ triggerLoopParentIV }, false); // false indicating we do not want an "else" region
                 auto epilogueThenBuilder = epilogueCopyIfOp.getThenBodyBuilder();
 
-                MakeDelayedMappingRegion(epilogueThenBuilder, triggerLoopParentIV, triggerLoopParentNextIterValue, [&](mlir::OpBuilder& builder) {
-                    [[maybe_unused]] auto epilogueTempCopy = builder.create<MultiCacheCopyOp>(loc,
-                                                                                              multiCacheInfo.multiCache,
-                                                                                              doubleBufferTempArray,
-                                                                                              multiCacheInfo.multiCacheExternalSymbols,
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheLBMaps),
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheUBMaps),
-                                                                                              rewriter.getI64ArrayAttr(multiCacheInfo.multiCacheStepSizes),
-                                                                                              util::ConvertIndexVectorToArrayAttr(multiCacheInfo.multiCacheLoopIndexIds, rewriter.getContext()),
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.lbMaps),
-                                                                                              rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.ubMaps),
-                                                                                              multiCacheInfo.multiCacheExternalSymbolsPermutationMap,
-                                                                                              multiCacheInfo.activeBlockToCacheMap,
-                                                                                              beginCreateCacheOp.thrifty(),
-                                                                                              beginCreateCacheOp.strategy(),
-                                                                                              false, // toCache
-                                                                                              beginCreateCacheOp.vectorizationInfoAttr(),
-                                                                                              TensorizationInfoAttr{});
-                });
-                // Mark the trigger loop parent loop to unswitch the last iteration so that our affine.if checks
-                // are always true in the main loop and always false in the unswitched final iteration
-                triggerLoopParentLoop->setAttr(UnswitchSuffixItersName, rewriter.getI64IntegerAttr(1));
+                auto createEpilogueTempCopy = [&](mlir::OpBuilder& stageBuilder, MakeCacheOp stageTempArray) {
+                    MakeDelayedMappingRegion(stageBuilder, triggerLoopParentIV, triggerLoopParentNextIterValue, [&](mlir::OpBuilder& builder) {
+                        [[maybe_unused]] auto epilogueTempCopy = builder.create<MultiCacheCopyOp>(loc,
+                                                                                                  multiCacheInfo.multiCache,
+                                                                                                  stageTempArray,
+                                                                                                  multiCacheInfo.multiCacheExternalSymbols,
+                                                                                                  rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheLBMaps),
+                                                                                                  rewriter.getAffineMapArrayAttr(multiCacheInfo.multiCacheUBMaps),
+                                                                                                  rewriter.getI64ArrayAttr(multiCacheInfo.multiCacheStepSizes),
+                                                                                                  util::ConvertIndexVectorToArrayAttr(multiCacheInfo.multiCacheLoopIndexIds, rewriter.getContext()),
+                                                                                                  rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.lbMaps),
+                                                                                                  rewriter.getAffineMapArrayAttr(multiCacheInfo.activeBlockInfo.ubMaps),
+                                                                                                  multiCacheInfo.multiCacheExternalSymbolsPermutationMap,
+                                                                                                  multiCacheInfo.activeBlockToCacheMap,
+                                                                                                  beginCreateCacheOp.thrifty(),
+                                                                                                  beginCreateCacheOp.strategy(),
+                                                                                                  false, // toCache
+                                                                                                  beginCreateCacheOp.vectorizationInfoAttr(),
+                                                                                                  TensorizationInfoAttr{});
+                    });
+                };
+
+                if (numStages == 1)
+                {
+                    createEpilogueTempCopy(epilogueThenBuilder, stageTempArrays[0]);
+                }
+                else
+                {
+                    // Iteration (i + 1)'s data lives in stage ((i - lb) / step + 1) mod numStages
+                    for (int64_t stageIdx = 0; stageIdx < numStages; ++stageIdx)
+                    {
+                        auto stageSelectExpr = ((rewriter.getAffineDimExpr(0) - rewriter.getAffineConstantExpr(triggerLoopParentFirstIterIntValue)).floorDiv(triggerLoopParentStepSize) + 1) % numStages - rewriter.getAffineConstantExpr(stageIdx);
+                        std::vector<mlir::AffineExpr> stageSelectExprs{ stageSelectExpr };
+                        SmallVector<bool, 4> stageSelectEqFlags(1, true); // true indicating an == 0 equality check
+                        auto stageSelectSet = mlir::IntegerSet::get(1, 0, stageSelectExprs, stageSelectEqFlags);
+                        auto stageSelectIfOp = epilogueThenBuilder.create<mlir::AffineIfOp>(loc, stageSelectSet, ValueRange{ triggerLoopParentIV }, false);
+                        auto stageSelectThenBuilder = stageSelectIfOp.getThenBodyBuilder();
+                        createEpilogueTempCopy(stageSelectThenBuilder, stageTempArrays[stageIdx]);
+                    }
+                }
+                // Mark the trigger loop parent loop to unswitch the last numStages iterations so that our
+                // affine.if guard checks are always true in the main loop and the prologue guard is always
+                // false in the unswitched suffix iterations
+                triggerLoopParentLoop->setAttr(UnswitchSuffixItersName, rewriter.getI64IntegerAttr(numStages));
 
                 // Create the EndCacheOp for the BeginActiveCacheRegionOp created earlier, denoting the end of the cache region as a utility for other optimizations
                 rewriter.create<EndCacheRegionOp>(loc, beginActiveRegionOp);
@@ -5407,6 +6567,7 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                     if (/*TODO: change to beta*/ execRuntime != ExecutionRuntime::CUDA && (!multiCacheInfo.arrayAccessInfo.valueRead || multiCacheInfo.arrayAccessInfo.onlyReadsAreAccumulates))
                     {
                         prologueOp = builder.create<CacheZeroOp>(loc, multiCacheInfo.multiCache, beginCreateCacheOp.thrifty(), tensorizeInfoAttr);
+                        PropagateNonTemporalAttr(beginCreateCacheOp, prologueOp);
                     }
                     else
                     {
@@ -5429,6 +6590,8 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                                                                           true, // toCache
                                                                           beginCreateCacheOp.vectorizationInfoAttr(),
                                                                           tensorizeInfoAttr);
+                            PropagatePrefetchAttrs(beginCreateCacheOp, prologueOp);
+                            PropagateQuantizedCacheAttr(beginCreateCacheOp, prologueOp);
                         }
                         else
                         {
@@ -5472,6 +6635,7 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                                                                                       beginCreateCacheOp.thrifty(),
                                                                                       beginCreateCacheOp.vectorizationInfoAttr(),
                                                                                       tensorizeInfoAttr);
+                                PropagateWritebackRoundingAttrs(beginCreateCacheOp, epilogueOp);
                             }
                             else
                             {
@@ -5497,6 +6661,9 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                                                                                     false, // skipBarriers : this copy isn't already guarded by barriers, so don't skip them
                                                                                     beginCreateCacheOp.vectorizationInfoAttr(),
                                                                                     tensorizeInfoAttr);
+                                // This writeback pairs with a quantizing fill, so it needs to
+                                // dequantize with the scale that fill computed
+                                PropagateQuantizedCacheAttr(beginCreateCacheOp, epilogueOp);
                             }
                             else
                             {
@@ -5504,6 +6671,14 @@ LogicalResult BeginCreateCacheOpRewrite::matchAndRewrite(BeginCreateCacheOp begi
                             }
                         }
 
+                        // Only allow streaming writeback stores when the access analysis shows the array
+                        // is never read in the region except to accumulate into, i.e. the writeback is
+                        // the last touch of those lines and there is no reuse to preserve
+                        if (!multiCacheInfo.arrayAccessInfo.valueRead || multiCacheInfo.arrayAccessInfo.onlyReadsAreAccumulates)
+                        {
+                            PropagateNonTemporalAttr(beginCreateCacheOp, epilogueOp);
+                        }
+
                         for (auto& dimBoundIV : multiCacheInfo.arrayAccessInfo.parametricIVHandles)
                         {
                             assert(indexRemapping.contains(dimBoundIV));
@@ -5681,6 +6856,16 @@ LogicalResult MaxElementCacheRegionOpRewrite::matchAndRewrite(BeginCreateMaxElem
     // This new cache region op has already been hoisted as high as we want to hoist it
     newBeginOp->setAttr("hoisted", rewriter.getUnitAttr());
 
+    // Preserve the fill pipelining, software prefetch, and streaming writeback configuration
+    // from the original cache region op
+    if (auto pipelineDepthAttr = beginCreateMaxElementCacheOp->getAttrOfType<mlir::IntegerAttr>("pipelineDepth"))
+    {
+        newBeginOp->setAttr("pipelineDepth", pipelineDepthAttr);
+    }
+    PropagatePrefetchAttrs(beginCreateMaxElementCacheOp, newBeginOp);
+    PropagateNonTemporalAttr(beginCreateMaxElementCacheOp, newBeginOp);
+    PropagateQuantizedCacheAttr(beginCreateMaxElementCacheOp, newBeginOp);
+
     // Replace uses and erase the original BeginCreateCacheOp
     rewriter.replaceOp(beginCreateMaxElementCacheOp, newBeginOp.getResult());
 
@@ -6379,6 +7564,407 @@ private:
     }
 };
 
+
+// Lowers a tensorized matmul micro-tile on a CPU target. CPU targets have no warp-cooperative
+// matrix ops to map onto, so by default the micro-tile is emitted as a broadcast-multiply-accumulate
+// vector kernel: each row of the output tile is kept in a vector accumulator and receives the widened
+// (element of A) * (row of B) product for every accumulation step. For narrow integer inputs
+// accumulating into a wider integer output this is the shape the LLVM backends' partial-reduction
+// combines select to the fixed-point dot-product instructions (AVX512-VNNI vpdpbusd, AArch64
+// sdot/udot) when the target has them, and it degrades to plain widening multiply-accumulate
+// vector code when it doesn't. In the default form the tile shape comes from the tensorized loop
+// ranges rather than from a hardware MMA shape.
+//
+// When the tensorization info requests the AMX tile shape (M16xN16xK64_B1), the micro-tile is
+// instead decomposed into 16x16x64 i8->i32 tiles emitted with the AMX dialect ops, which export
+// to the tdpbssd tile intrinsics. The X86 backend materializes the required tile-palette
+// configuration (ldtilecfg) in the function prologue from the tile shapes in use, so no explicit
+// prologue setup is emitted here. AMX consumes the B tile in the VNNI group-packed layout
+// (element (k, j) at position (k floordiv 4, 4*j + k mod 4)), so B must be cached with that
+// layout and the access map is verified to match it.
+LogicalResult RewriteCPUTensorizedMatmul(PatternRewriter& rewriter,
+                                         AffineForOp affineForOp,
+                                         const std::vector<mlir::AffineForOp>& loops,
+                                         const TensorizationInfo& tensorizationInfo,
+                                         mlir::AffineLoadOp loadAOp,
+                                         mlir::AffineLoadOp loadBOp,
+                                         mlir::AffineLoadOp loadCOp,
+                                         std::stack<Operation*>& opsToErase)
+{
+    auto reportMatchFailure = [&](mlir::Operation* op, std::string message) -> LogicalResult {
+        llvm::dbgs() << "While processing " << *op << ". " << message << "\n";
+        return rewriter.notifyMatchFailure(op, message);
+    };
+
+    if (loops.size() != 3)
+    {
+        return reportMatchFailure(affineForOp, "CPU tensorization expects exactly 3 tensorized loops");
+    }
+
+    // Find the affine dim position a loop induction variable occupies in a load's access map
+    auto getDimPosition = [](mlir::AffineLoadOp op, mlir::Value inductionVar) -> std::optional<unsigned> {
+        for (auto& en : llvm::enumerate(op.getMapOperands()))
+        {
+            if (en.value() == inductionVar && en.index() < op.getAffineMap().getNumDims())
+            {
+                return static_cast<unsigned>(en.index());
+            }
+        }
+        return std::nullopt;
+    };
+
+    auto dependsOnIV = [&](mlir::AffineLoadOp op, mlir::Value inductionVar) {
+        auto dimPos = getDimPosition(op, inductionVar);
+        if (!dimPos.has_value())
+        {
+            return false;
+        }
+        auto map = op.getAffineMap();
+        return llvm::any_of(map.getResults(), [&](mlir::AffineExpr expr) { return expr.isFunctionOfDim(*dimPos); });
+    };
+
+    // Identify the roles of the tensorized loops from how the loads use them: the accumulation
+    // index feeds both inputs but not the output, the output row index feeds one input and the
+    // output, and the output column index feeds the other input and the output
+    mlir::AffineForOp iLoop;
+    mlir::AffineForOp jLoop;
+    mlir::AffineForOp kLoop;
+    for (auto loop : loops)
+    {
+        auto iv = loop.getInductionVar();
+        bool inA = dependsOnIV(loadAOp, iv);
+        bool inB = dependsOnIV(loadBOp, iv);
+        bool inC = dependsOnIV(loadCOp, iv);
+        if (inA && inB && !inC && !kLoop)
+        {
+            kLoop = loop;
+        }
+        else if (inA && inC && !inB && !iLoop)
+        {
+            iLoop = loop;
+        }
+        else if (inB && inC && !inA && !jLoop)
+        {
+            jLoop = loop;
+        }
+        else
+        {
+            return reportMatchFailure(loop, "Failed to infer the role of a tensorized loop from the matmul accesses");
+        }
+    }
+
+    // Per-result constant change in the access map when the given induction variable advances by
+    // `delta` iterations, or nullopt when some result doesn't change by a constant amount
+    auto shiftDiffs = [&](mlir::AffineLoadOp op, mlir::Value inductionVar, int64_t delta) -> std::optional<std::vector<int64_t>> {
+        auto map = op.getAffineMap();
+        auto ctx = map.getContext();
+        std::vector<int64_t> diffs(map.getNumResults(), 0);
+        auto dimPos = getDimPosition(op, inductionVar);
+        if (!dimPos.has_value())
+        {
+            return diffs;
+        }
+        llvm::SmallVector<mlir::AffineExpr, 4> dimReplacements;
+        llvm::SmallVector<mlir::AffineExpr, 4> symReplacements;
+        for (unsigned d = 0; d < map.getNumDims(); ++d)
+        {
+            auto dimExpr = mlir::getAffineDimExpr(d, ctx);
+            dimReplacements.push_back(d == *dimPos ? dimExpr + delta : dimExpr);
+        }
+        for (unsigned sym = 0; sym < map.getNumSymbols(); ++sym)
+        {
+            symReplacements.push_back(mlir::getAffineSymbolExpr(sym, ctx));
+        }
+        for (unsigned r = 0; r < map.getNumResults(); ++r)
+        {
+            auto result = map.getResult(r);
+            auto shifted = result.replaceDimsAndSymbols(dimReplacements, symReplacements);
+            auto diff = mlir::simplifyAffineExpr(shifted - result, map.getNumDims(), map.getNumSymbols());
+            if (auto constDiff = diff.dyn_cast<mlir::AffineConstantExpr>())
+            {
+                diffs[r] = constDiff.getValue();
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+        return diffs;
+    };
+
+    // Checks that advancing the induction variable only moves the given access map result, by the
+    // expected constant amount
+    auto advancesSingleResult = [&](mlir::AffineLoadOp op, mlir::Value inductionVar, int64_t delta, unsigned resultIdx, int64_t expected) {
+        auto diffs = shiftDiffs(op, inductionVar, delta);
+        if (!diffs.has_value())
+        {
+            return false;
+        }
+        for (unsigned r = 0; r < diffs->size(); ++r)
+        {
+            if ((*diffs)[r] != (r == resultIdx ? expected : 0))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto hasUnitLastDimStride = [](mlir::MemRefType type) {
+        int64_t offset;
+        llvm::SmallVector<int64_t, 4> strides;
+        return succeeded(mlir::getStridesAndOffset(type, strides, offset)) && !strides.empty() && strides.back() == 1;
+    };
+
+    // The output column index must advance the last dimension of C by one element per iteration
+    // so rows of the output tile can be accessed as contiguous vectors
+    if (jLoop.getStep() != 1 ||
+        !advancesSingleResult(loadCOp, jLoop.getInductionVar(), 1, loadCOp.getAffineMap().getNumResults() - 1, 1) ||
+        !hasUnitLastDimStride(loadCOp.getMemRefType()))
+    {
+        return reportMatchFailure(loadCOp, "The output column index must be contiguous in C");
+    }
+
+    // The inputs widen into the accumulator type before the multiply the way the dot-product
+    // instructions do, so they may be narrower than the output element type but not wider
+    auto aElementType = loadAOp.getMemRefType().getElementType();
+    auto bElementType = loadBOp.getMemRefType().getElementType();
+    auto cElementType = loadCOp.getMemRefType().getElementType();
+    const bool integerKernel = aElementType.isa<mlir::IntegerType>() && bElementType.isa<mlir::IntegerType>() && cElementType.isa<mlir::IntegerType>();
+    const bool floatKernel = aElementType.isa<mlir::FloatType>() && bElementType.isa<mlir::FloatType>() && cElementType.isa<mlir::FloatType>();
+    if (!integerKernel && !floatKernel)
+    {
+        return reportMatchFailure(affineForOp, "A, B, and C must be all-integer or all-float");
+    }
+    if (aElementType.getIntOrFloatBitWidth() > cElementType.getIntOrFloatBitWidth() ||
+        bElementType.getIntOrFloatBitWidth() > cElementType.getIntOrFloatBitWidth())
+    {
+        return reportMatchFailure(affineForOp, "A and B must not have wider elements than C");
+    }
+
+    auto tripCount = [](mlir::AffineForOp loop) {
+        return (loop.getConstantUpperBound() + loop.getStep() - 1) / loop.getStep();
+    };
+    const int64_t numRows = tripCount(iLoop);
+    const int64_t numCols = tripCount(jLoop);
+    const int64_t numAccumSteps = tripCount(kLoop);
+    if (numCols < 2)
+    {
+        return reportMatchFailure(jLoop, "The output column index must span a multi-element vector");
+    }
+
+    const bool useAMXTiles = (tensorizationInfo.dim == v::MMAShape::M16xN16xK64_B1);
+    const v::MMAOp tileOp(tensorizationInfo.dim);
+
+    auto innerLoop = loops.back();
+    auto loc = innerLoop.getLoc();
+    mlir::OpBuilder::InsertionGuard guard(rewriter);
+    rewriter.setInsertionPoint(innerLoop.getBody(), innerLoop.getBody()->getTerminator()->getIterator());
+
+    // Materialize offset versions of an induction variable for each unrolled position in the tile
+    auto makeOffsetInductionVars = [&](mlir::AffineForOp loop, int64_t count, int64_t blockSize) {
+        std::vector<mlir::Value> offsetIVs;
+        auto iv = loop.getInductionVar();
+        auto inductionVarMap = AffineMap::get(1, 1, rewriter.getAffineDimExpr(0) + loop.getStep() * rewriter.getAffineSymbolExpr(0));
+        offsetIVs.push_back(iv);
+        for (int64_t idx = 1; idx < count; ++idx)
+        {
+            auto offset = rewriter.create<arith::ConstantIndexOp>(loc, idx * blockSize);
+            offsetIVs.push_back(rewriter.create<AffineApplyOp>(loc, inductionVarMap, ValueRange{ iv, offset }));
+        }
+        return offsetIVs;
+    };
+
+    // Replay a load's access map with the given induction variable replacements to get the
+    // memref position of an unrolled tile element. The column induction variable is left at its
+    // base value, as the tile ops cover the column extent themselves
+    auto applyAccessMap = [&](mlir::AffineLoadOp op, mlir::Value originalIV, mlir::Value replacementIV, mlir::Value secondOriginalIV, mlir::Value secondReplacementIV) {
+        std::vector<mlir::Value> operands(op.getMapOperands().begin(), op.getMapOperands().end());
+        for (auto& operand : operands)
+        {
+            if (operand == originalIV)
+            {
+                operand = replacementIV;
+            }
+            else if (secondOriginalIV && operand == secondOriginalIV)
+            {
+                operand = secondReplacementIV;
+            }
+        }
+        return util::MultiDimAffineApply(rewriter, loc, op.getAffineMap(), operands, true);
+    };
+
+    auto iIV = iLoop.getInductionVar();
+    auto jIV = jLoop.getInductionVar();
+    auto kIV = kLoop.getInductionVar();
+
+    if (useAMXTiles)
+    {
+        // AMX tdpbssd computes a 16x16 i32 tile from 16x64 i8 tiles of A and (VNNI-packed) B
+        if (!integerKernel || aElementType.getIntOrFloatBitWidth() != 8 || bElementType.getIntOrFloatBitWidth() != 8 || cElementType.getIntOrFloatBitWidth() != 32)
+        {
+            return reportMatchFailure(affineForOp, "AMX tensorization requires i8 inputs and an i32 accumulator");
+        }
+        if (iLoop.getStep() != 1 || kLoop.getStep() != 1)
+        {
+            return reportMatchFailure(affineForOp, "AMX tensorization requires unit-step tensorized loops");
+        }
+        if (numRows % tileOp.getM() != 0 || numCols % tileOp.getN() != 0 || numAccumSteps % tileOp.getK() != 0)
+        {
+            return reportMatchFailure(affineForOp, "The micro-tile shape must be a multiple of the 16x16x64 AMX tile shape");
+        }
+        if (!hasUnitLastDimStride(loadAOp.getMemRefType()) || !hasUnitLastDimStride(loadBOp.getMemRefType()))
+        {
+            return reportMatchFailure(affineForOp, "AMX tile loads require unit-stride innermost array dimensions");
+        }
+
+        auto aMap = loadAOp.getAffineMap();
+        auto cMap = loadCOp.getAffineMap();
+        if (!advancesSingleResult(loadAOp, iIV, 1, aMap.getNumResults() - 2, 1) ||
+            !advancesSingleResult(loadAOp, kIV, 1, aMap.getNumResults() - 1, 1))
+        {
+            return reportMatchFailure(loadAOp, "AMX tensorization requires A tiles with rows over the output row index and contiguous accumulation elements");
+        }
+        if (!advancesSingleResult(loadCOp, iIV, 1, cMap.getNumResults() - 2, 1))
+        {
+            return reportMatchFailure(loadCOp, "AMX tensorization requires C tiles with rows over the output row index");
+        }
+
+        // B must be stored in the VNNI group-packed layout AMX consumes: element (k, j) at
+        // position (k floordiv 4, 4*j + k mod 4). Verify the group-level strides and the
+        // intra-group interleaving on the access map
+        auto bMap = loadBOp.getAffineMap();
+        auto bCtx = bMap.getContext();
+        auto kPosB = getDimPosition(loadBOp, kIV);
+        auto jPosB = getDimPosition(loadBOp, jIV);
+        assert(kPosB.has_value() && jPosB.has_value());
+        auto kDimExpr = mlir::getAffineDimExpr(*kPosB, bCtx);
+        auto jDimExpr = mlir::getAffineDimExpr(*jPosB, bCtx);
+        auto bRowExpr = bMap.getResult(bMap.getNumResults() - 2);
+        auto bColExpr = bMap.getResult(bMap.getNumResults() - 1);
+        auto rowResidual = mlir::simplifyAffineExpr(bRowExpr - kDimExpr.floorDiv(4), bMap.getNumDims(), bMap.getNumSymbols());
+        auto colResidual = mlir::simplifyAffineExpr(bColExpr - kDimExpr % 4 - 4 * jDimExpr, bMap.getNumDims(), bMap.getNumSymbols());
+        bool packedLayout = !rowResidual.isFunctionOfDim(*kPosB) && !rowResidual.isFunctionOfDim(*jPosB) &&
+                            !colResidual.isFunctionOfDim(*kPosB) && !colResidual.isFunctionOfDim(*jPosB);
+        for (unsigned r = 0; packedLayout && r < bMap.getNumResults() - 2; ++r)
+        {
+            packedLayout = !bMap.getResult(r).isFunctionOfDim(*kPosB) && !bMap.getResult(r).isFunctionOfDim(*jPosB);
+        }
+        if (!packedLayout)
+        {
+            return reportMatchFailure(loadBOp, "AMX tensorization requires B in the VNNI group-packed layout (cache B with coefficients mapping (k, j) to (k floordiv 4, 4*j + k mod 4))");
+        }
+
+        rewriter.startRootUpdate(affineForOp);
+
+        auto inTileType = mlir::VectorType::get({ tileOp.getM(), tileOp.getK() }, rewriter.getIntegerType(8));
+        auto accTileType = mlir::VectorType::get({ tileOp.getM(), tileOp.getN() }, rewriter.getIntegerType(32));
+
+        auto rowTileIVs = makeOffsetInductionVars(iLoop, numRows / tileOp.getM(), tileOp.getM());
+        auto colTileIVs = makeOffsetInductionVars(jLoop, numCols / tileOp.getN(), tileOp.getN());
+        auto accumTileIVs = makeOffsetInductionVars(kLoop, numAccumSteps / tileOp.getK(), tileOp.getK());
+
+        for (size_t rowTile = 0; rowTile < rowTileIVs.size(); ++rowTile)
+        {
+            for (size_t colTile = 0; colTile < colTileIVs.size(); ++colTile)
+            {
+                auto cIndices = applyAccessMap(loadCOp, iIV, rowTileIVs[rowTile], jIV, colTileIVs[colTile]);
+                mlir::Value accumTile = rewriter.create<mlir::amx::TileLoadOp>(loc, accTileType, loadCOp.getMemRef(), cIndices);
+                for (size_t accumStep = 0; accumStep < accumTileIVs.size(); ++accumStep)
+                {
+                    auto aIndices = applyAccessMap(loadAOp, iIV, rowTileIVs[rowTile], kIV, accumTileIVs[accumStep]);
+                    auto aTile = rewriter.create<mlir::amx::TileLoadOp>(loc, inTileType, loadAOp.getMemRef(), aIndices);
+                    auto bIndices = applyAccessMap(loadBOp, kIV, accumTileIVs[accumStep], jIV, colTileIVs[colTile]);
+                    auto bTile = rewriter.create<mlir::amx::TileLoadOp>(loc, inTileType, loadBOp.getMemRef(), bIndices);
+                    // Signed-signed tile multiply-accumulate, exported as tdpbssd. The X86
+                    // backend derives the tile-palette configuration in the function prologue
+                    // from the tile shapes in use
+                    accumTile = rewriter.create<mlir::amx::TileMulIOp>(loc, mlir::TypeRange{ accTileType }, mlir::ValueRange{ aTile, bTile, accumTile })->getResult(0);
+                }
+                rewriter.create<mlir::amx::TileStoreOp>(loc, loadCOp.getMemRef(), cIndices, accumTile);
+            }
+        }
+    }
+    else
+    {
+        // The output column index must also be contiguous in B so rows of B can be loaded as
+        // vectors
+        if (!advancesSingleResult(loadBOp, jIV, 1, loadBOp.getAffineMap().getNumResults() - 1, 1) || !hasUnitLastDimStride(loadBOp.getMemRefType()))
+        {
+            return reportMatchFailure(loadBOp, "The output column index must be contiguous in B");
+        }
+
+        rewriter.startRootUpdate(affineForOp);
+
+        auto accumulatorVecType = mlir::VectorType::get({ numCols }, cElementType);
+        auto bVecType = mlir::VectorType::get({ numCols }, bElementType);
+
+        auto widen = [&](mlir::Value value, mlir::Type resultType) -> mlir::Value {
+            if (value.getType() == resultType)
+            {
+                return value;
+            }
+            if (integerKernel)
+            {
+                return rewriter.create<mlir::arith::ExtSIOp>(loc, resultType, value);
+            }
+            return rewriter.create<mlir::arith::ExtFOp>(loc, resultType, value);
+        };
+
+        auto rowIVs = makeOffsetInductionVars(iLoop, numRows, 1);
+        auto accumIVs = makeOffsetInductionVars(kLoop, numAccumSteps, 1);
+
+        for (int64_t row = 0; row < numRows; ++row)
+        {
+            auto cIndices = applyAccessMap(loadCOp, iIV, rowIVs[row], mlir::Value{}, mlir::Value{});
+            mlir::Value accumulator = rewriter.create<mlir::vector::LoadOp>(loc, accumulatorVecType, loadCOp.getMemRef(), cIndices);
+            for (int64_t accumStep = 0; accumStep < numAccumSteps; ++accumStep)
+            {
+                auto aIndices = applyAccessMap(loadAOp, iIV, rowIVs[row], kIV, accumIVs[accumStep]);
+                mlir::Value aElement = rewriter.create<mlir::memref::LoadOp>(loc, loadAOp.getMemRef(), aIndices);
+                auto aSplat = rewriter.create<mlir::vector::BroadcastOp>(loc, accumulatorVecType, widen(aElement, cElementType));
+                auto bIndices = applyAccessMap(loadBOp, kIV, accumIVs[accumStep], mlir::Value{}, mlir::Value{});
+                auto bVec = rewriter.create<mlir::vector::LoadOp>(loc, bVecType, loadBOp.getMemRef(), bIndices);
+                auto bWide = widen(bVec, accumulatorVecType);
+                if (integerKernel)
+                {
+                    auto product = rewriter.create<mlir::arith::MulIOp>(loc, aSplat, bWide);
+                    accumulator = rewriter.create<mlir::arith::AddIOp>(loc, accumulator, product);
+                }
+                else
+                {
+                    auto product = rewriter.create<mlir::arith::MulFOp>(loc, aSplat, bWide);
+                    accumulator = rewriter.create<mlir::arith::AddFOp>(loc, accumulator, product);
+                }
+            }
+            rewriter.create<mlir::vector::StoreOp>(loc, accumulator, loadCOp.getMemRef(), cIndices);
+        }
+    }
+
+    while (!opsToErase.empty())
+    {
+        auto eraseOp = opsToErase.top();
+        if (eraseOp->use_empty())
+        {
+            rewriter.eraseOp(eraseOp);
+        }
+        opsToErase.pop();
+    }
+
+    for (auto loop : loops)
+    {
+        // change loop step so that the loop runs once
+        loop.setConstantUpperBound(1);
+
+        // remove the tensorization annotation
+        RemoveTensorizationInfo(loop);
+    }
+    RemoveTensorizationInfo(affineForOp);
+    rewriter.finalizeRootUpdate(affineForOp);
+
+    return success();
+}
+
 LogicalResult TensorizeAffineForOpConversion::matchAndRewrite(AffineForOp affineForOp, PatternRewriter& rewriter) const
 {
     auto reportMatchFailure = [&](mlir::Operation* op, std::string message) -> LogicalResult {
@@ -6394,6 +7980,10 @@ LogicalResult TensorizeAffineForOpConversion::matchAndRewrite(AffineForOp affine
 
     auto tensorizationInfo = GetTensorizationInfo(affineForOp);
 
+    std::optional<v::ExecutionTarget> execTargetOpt = util::ResolveExecutionTarget(affineForOp);
+    assert(execTargetOpt.has_value());
+    const bool cpuTensorization = (*execTargetOpt == v::ExecutionTarget::CPU);
+
     SmallVector<AffineForOp, 4> nestedLoops;
     mlir::getPerfectlyNestedLoops(nestedLoops, affineForOp);
     std::vector<mlir::AffineForOp> loops; // tensorized loops
@@ -6496,17 +8086,22 @@ LogicalResult TensorizeAffineForOpConversion::matchAndRewrite(AffineForOp affine
     int loadAAccumulationIndexPos = 1 - loadAGPUIndexPos;
     int loadBAccumulationIndexPos = 1 - loadBGPUIndexPos;
 
-    if (!gpuDimsPerDimA[1 - loadAGPUIndexPos].empty())
+    // CPU loops carry no GPU bindings, so the index roles are inferred from the access maps in
+    // the CPU rewrite instead
+    if (!cpuTensorization)
     {
-        return reportMatchFailure(loadAOp, "A must be accessed with bindings on only 1 index");
-    }
-    if (!gpuDimsPerDimB[1 - loadBGPUIndexPos].empty())
-    {
-        return reportMatchFailure(loadBOp, "B must be accessed with bindings on only 1 index");
-    }
-    if (loadAAccumulationIndexPos != (1 - loadBAccumulationIndexPos))
-    {
-        return reportMatchFailure(loadBOp, "A and B must have opposite accumulation index positions");
+        if (!gpuDimsPerDimA[1 - loadAGPUIndexPos].empty())
+        {
+            return reportMatchFailure(loadAOp, "A must be accessed with bindings on only 1 index");
+        }
+        if (!gpuDimsPerDimB[1 - loadBGPUIndexPos].empty())
+        {
+            return reportMatchFailure(loadBOp, "B must be accessed with bindings on only 1 index");
+        }
+        if (loadAAccumulationIndexPos != (1 - loadBAccumulationIndexPos))
+        {
+            return reportMatchFailure(loadBOp, "A and B must have opposite accumulation index positions");
+        }
     }
 
     // 3. muliply A * B
@@ -6661,6 +8256,11 @@ LogicalResult TensorizeAffineForOpConversion::matchAndRewrite(AffineForOp affine
         return rewriter.notifyMatchFailure(&*innerLoopBodyIter, "The store into C was not the last instruction");
     }
 
+    if (cpuTensorization)
+    {
+        return RewriteCPUTensorizedMatmul(rewriter, affineForOp, loops, tensorizationInfo, loadAOp, loadBOp, loadCOp, opsToErase);
+    }
+
     // C += A * A is valid matmul, however we need to assert that the indexing into the arrays are opposites of one another
     // E.g. C[i, j] += A[i, k] * A[k, j] is valid matmul
     //  but C[i, j] += A[i, k] * A[j, k] is not
@@ -6890,16 +8490,55 @@ LogicalResult TensorizeAffineForOpConversion::matchAndRewrite(AffineForOp affine
             cMmaMatrix.push_back(opHelper.LoadMatrix(cProp, blockRowOffset, cFrag)[0]);
         }
 
-        // Load A, B and perform matmul
-        for (int passGroup = 0, passGroupOffset = 0; passGroup < numPassGroups; ++passGroup, passGroupOffset += passGroupIncrement)
+        if (tensorizationInfo.pipelinePasses && numPassGroups > 1)
         {
-            auto aMmaMatrix = opHelper.LoadMatrix(aProp, passGroupOffset, aFrags);
-            auto bMmaMatrix = opHelper.LoadMatrix(bProp, passGroupOffset, bFrags);
-            for (int iBlock = 0; iBlock < numBlocks; ++iBlock)
+            // Software-pipeline the pass groups: keep two sets of A/B fragments alive and
+            // issue the loads for pass group (p + 1) before the matrix ops of pass group p,
+            // so the backend can overlap the fragment loads with the MMA issue latency.
+            // This doubles the A/B register footprint relative to the serial schedule.
+            auto aFragsNext = opHelper.AllocMatrix(aProp);
+            auto bFragsNext = opHelper.AllocMatrix(bProp);
+
+            auto aMmaMatrix = opHelper.LoadMatrix(aProp, 0, aFrags);
+            auto bMmaMatrix = opHelper.LoadMatrix(bProp, 0, bFrags);
+            auto* aCurrentFrags = &aFrags;
+            auto* bCurrentFrags = &bFrags;
+            auto* aNextFrags = &aFragsNext;
+            auto* bNextFrags = &bFragsNext;
+            for (int passGroup = 0, passGroupOffset = 0; passGroup < numPassGroups; ++passGroup, passGroupOffset += passGroupIncrement)
             {
-                for (auto&& [matA, matB] : llvm::zip(aMmaMatrix, bMmaMatrix))
+                std::vector<mlir::Value> aMmaMatrixNext, bMmaMatrixNext;
+                if (passGroup + 1 < numPassGroups)
+                {
+                    aMmaMatrixNext = opHelper.LoadMatrix(aProp, passGroupOffset + passGroupIncrement, *aNextFrags);
+                    bMmaMatrixNext = opHelper.LoadMatrix(bProp, passGroupOffset + passGroupIncrement, *bNextFrags);
+                }
+                for (int iBlock = 0; iBlock < numBlocks; ++iBlock)
+                {
+                    for (auto&& [matA, matB] : llvm::zip(aMmaMatrix, bMmaMatrix))
+                    {
+                        opHelper.ComputeMatrix(matA, matB, cMmaMatrix[iBlock], cbsz, iBlock);
+                    }
+                }
+                aMmaMatrix = std::move(aMmaMatrixNext);
+                bMmaMatrix = std::move(bMmaMatrixNext);
+                std::swap(aCurrentFrags, aNextFrags);
+                std::swap(bCurrentFrags, bNextFrags);
+            }
+        }
+        else
+        {
+            // Load A, B and perform matmul
+            for (int passGroup = 0, passGroupOffset = 0; passGroup < numPassGroups; ++passGroup, passGroupOffset += passGroupIncrement)
+            {
+                auto aMmaMatrix = opHelper.LoadMatrix(aProp, passGroupOffset, aFrags);
+                auto bMmaMatrix = opHelper.LoadMatrix(bProp, passGroupOffset, bFrags);
+                for (int iBlock = 0; iBlock < numBlocks; ++iBlock)
                 {
-                    opHelper.ComputeMatrix(matA, matB, cMmaMatrix[iBlock], cbsz, iBlock);
+                    for (auto&& [matA, matB] : llvm::zip(aMmaMatrix, bMmaMatrix))
+                    {
+                        opHelper.ComputeMatrix(matA, matB, cMmaMatrix[iBlock], cbsz, iBlock);
+                    }
                 }
             }
         }
@@ -6946,6 +8585,30 @@ LogicalResult ParallelizeAffineForOpConversion::matchAndRewrite(AffineForOp affi
     assert(affineForOp.hasConstantLowerBound() && "Parallelized loops must have a constant lower bound");
     assert(affineForOp.hasConstantUpperBound() && "Parallelized loops must have a constant upper bound");
 
+    auto parallelizationInfo = GetParallelizationInfo(affineForOp);
+
+    if (parallelizationInfo.reduction != accera::ir::executionPlan::ParallelizationInfo::NoReduction)
+    {
+        if (succeeded(RewriteParallelReduction(affineForOp, parallelizationInfo, rewriter)))
+        {
+            return success();
+        }
+        // Couldn't prove the accumulator pattern, so leave the loop serial rather than emit a
+        // parallel region that races on the shared accumulators
+        affineForOp.emitWarning("Unable to privatize accumulators for parallelized reduction; leaving the loop serial");
+        rewriter.startRootUpdate(affineForOp);
+        affineForOp->removeAttr(rewriter.getStringAttr(ParallelizationInfoAttr::getKeyName()));
+        rewriter.finalizeRootUpdate(affineForOp);
+        return success();
+    }
+
+    // First-touch the heap cache buffers this parallel region is the first to access, so their
+    // pages land on the NUMA nodes of the threads that use them
+    if (!affineForOp->hasAttr("accv_first_touch_init"))
+    {
+        EmitFirstTouchInitForCacheBuffers(affineForOp, parallelizationInfo, rewriter);
+    }
+
     rewriter.startRootUpdate(affineForOp);
 
     //  Replace affine.for with affine.parallel, tagged with vectorization info
@@ -6959,12 +8622,59 @@ LogicalResult ParallelizeAffineForOpConversion::matchAndRewrite(AffineForOp affi
 
     // Unpack the parallelization info into OpenMP dialect attributes
     // cf. mlir\lib\Conversion\SCFToOpenMP\SCFToOpenMP.cpp
-    auto parallelizationInfo = GetParallelizationInfo(affineForOp);
     newParallelOp->setAttr(mlir::omp::getNumThreadsAttrName(), rewriter.getI64IntegerAttr(parallelizationInfo.numThreads));
 
     // Valid clause values: llvm\include\llvm\Frontend\OpenMP\OMP.td
-    newParallelOp->setAttr(mlir::omp::getScheduleAttrName(), rewriter.getStringAttr(parallelizationInfo.isDynamicPolicy ? "Dynamic" : "Static"));
-    newParallelOp->setAttr(mlir::omp::getProcBindAttrName(), rewriter.getStringAttr("close"));
+    // The work-stealing policy maps to OpenMP guided scheduling: chunks are handed out from a shared
+    // queue with decreasing sizes, so idle threads keep claiming work from the tail instead of
+    // waiting on a static partition
+    llvm::StringRef ompSchedule = "Static";
+    switch (parallelizationInfo.policy)
+    {
+    case accera::ir::executionPlan::ParallelizationInfo::DynamicPolicy:
+        ompSchedule = "Dynamic";
+        break;
+    case accera::ir::executionPlan::ParallelizationInfo::WorkStealingPolicy:
+        ompSchedule = "Guided";
+        break;
+    case accera::ir::executionPlan::ParallelizationInfo::HeterogeneousPolicy:
+        // OpenMP cannot express a throughput-weighted static partition, so heterogeneous maps to
+        // dynamic scheduling with granules small enough that each core class settles into a share
+        // proportional to its speed (a P-core simply claims more of them per unit time); the chunk
+        // computed below keeps the granule count high enough to balance P/E cores without drowning
+        // in dispatch overhead. The runtime thread pool offers a calibrated proportional partition
+        // (AcceraParallelForProportional), but this lowering still emits OpenMP for every parallel
+        // region; only the runtime's own utilities call the pool today.
+        ompSchedule = "Dynamic";
+        break;
+    default:
+        break;
+    }
+    newParallelOp->setAttr(mlir::omp::getScheduleAttrName(), rewriter.getStringAttr(ompSchedule));
+    int64_t scheduleChunkSize = parallelizationInfo.chunkSize;
+    if (scheduleChunkSize == 0 &&
+        parallelizationInfo.policy == accera::ir::executionPlan::ParallelizationInfo::HeterogeneousPolicy &&
+        affineForOp.hasConstantLowerBound() && affineForOp.hasConstantUpperBound())
+    {
+        // Aim for ~8 granules per thread: enough that an efficiency core can shed half its equal
+        // share to faster cores, few enough that dispatch overhead stays in the noise
+        const int64_t numIterations = (affineForOp.getConstantUpperBound() - affineForOp.getConstantLowerBound()) / std::max<int64_t>(1, affineForOp.getStep());
+        scheduleChunkSize = std::max<int64_t>(1, numIterations / (parallelizationInfo.numThreads * 8));
+    }
+    if (scheduleChunkSize > 0)
+    {
+        // Iterations handed to a thread at a time; without this the dynamic policy falls back to
+        // its default chunking, which can be off by orders of magnitude for ragged fused schedules
+        newParallelOp->setAttr("omp.schedule_chunk", rewriter.getI64IntegerAttr(scheduleChunkSize));
+    }
+    // Compact affinity binds the threads to neighboring cores (proc_bind(close)); scatter spreads
+    // them across the available places (proc_bind(spread)) so on multi-socket machines each thread
+    // stays near the NUMA node holding the memory it first-touched
+    llvm::StringRef ompProcBind = (parallelizationInfo.affinity == accera::ir::executionPlan::ParallelizationInfo::ScatterAffinity) ? "spread" : "close";
+    newParallelOp->setAttr(mlir::omp::getProcBindAttrName(), rewriter.getStringAttr(ompProcBind));
+    // Regions with the same nesting level get collapsed together; differing levels stay as nested
+    // parallel regions with their own thread counts
+    newParallelOp->setAttr("accv_parallel_nesting_level", rewriter.getI64IntegerAttr(parallelizationInfo.nestingLevel));
 
     rewriter.eraseOp(affineForOp);
     rewriter.finalizeRootUpdate(affineForOp);
@@ -7006,6 +8716,16 @@ LogicalResult CollapseAffineParallelOpsRewrite::matchAndRewrite(AffineParallelOp
         return failure();
     }
 
+    // Only collapse regions that were parallelized at the same nesting level; differing levels were
+    // requested as nested parallelism (e.g. sockets x cores) and must remain separate regions
+    auto nestingLevelAttrName = "accv_parallel_nesting_level";
+    auto parentLevel = affineParallelOp->getAttrOfType<IntegerAttr>(nestingLevelAttrName);
+    auto childLevel = childOp->getAttrOfType<IntegerAttr>(nestingLevelAttrName);
+    if (parentLevel && childLevel && parentLevel.getInt() != childLevel.getInt())
+    {
+        return failure();
+    }
+
     // Merge the current op with its perfectly nested child. For example:
     //   affine.parallel (%arg3) = (0) to (256) step (64) {
     //      affine.parallel (%arg4) = (0) to (256) {
@@ -7090,6 +8810,10 @@ LogicalResult CollapseAffineParallelOpsRewrite::matchAndRewrite(AffineParallelOp
     mergedParallelOp->setAttr(mlir::omp::getNumThreadsAttrName(), affineParallelOp->getAttr(mlir::omp::getNumThreadsAttrName()));
     mergedParallelOp->setAttr(mlir::omp::getScheduleAttrName(), affineParallelOp->getAttr(mlir::omp::getScheduleAttrName()));
     mergedParallelOp->setAttr(mlir::omp::getProcBindAttrName(), affineParallelOp->getAttr(mlir::omp::getProcBindAttrName()));
+    if (auto nestingLevel = affineParallelOp->getAttr("accv_parallel_nesting_level"))
+    {
+        mergedParallelOp->setAttr("accv_parallel_nesting_level", nestingLevel);
+    }
 
     // Merge and set the collapse attribute
     int64_t collapse = (affineParallelOp->hasAttrOfType<IntegerAttr>(mlir::omp::getCollapseAttrName())) ? affineParallelOp->getAttrOfType<IntegerAttr>(mlir::omp::getCollapseAttrName()).getInt() : 1;
@@ -7876,9 +9600,12 @@ void populateExecutionPlanCacheFinalizePatterns(mlir::RewritePatternSet& pattern
 
 void populateExecutionPlanThriftyCachePatterns(mlir::RewritePatternSet& patterns)
 {
-    patterns.insert<ThriftyCacheMultiCopyOpRewrite>(patterns.getContext());
-    patterns.insert<ThriftyCacheCopyOpRewrite>(patterns.getContext());
-    patterns.insert<ThriftyCacheReduceOpRewrite>(patterns.getContext());
+    // Share one stride analysis memo across the thrifty patterns so structurally identical
+    // caches only pay for the stride walk once per pattern application
+    auto strideAnalysis = std::make_shared<ThriftyCacheStrideAnalysis>();
+    patterns.insert<ThriftyCacheMultiCopyOpRewrite>(patterns.getContext(), strideAnalysis);
+    patterns.insert<ThriftyCacheCopyOpRewrite>(patterns.getContext(), strideAnalysis);
+    patterns.insert<ThriftyCacheReduceOpRewrite>(patterns.getContext(), strideAnalysis);
 }
 
 void populateExecutionPlanMultiCachePatterns(mlir::RewritePatternSet& patterns)
@@ -7937,7 +9664,10 @@ void populateExecutionPlanAdjustHierarchicalCacheRegionPositionPatterns(mlir::Re
 
 void populateExecutionPlanAdjustCacheMappingPositionPatterns(mlir::RewritePatternSet& patterns)
 {
-    patterns.insert<AdjustCacheMappingPositionRewrite>(patterns.getContext());
+    // Interleave the in-block position adjustment with loop-invariant hoisting so that mappings that get pushed
+    // out to the extremes of a loop body block can then step out of the loop entirely and repeat at the next level
+    patterns.insert<AdjustCacheMappingPositionRewrite,
+                    HoistCacheMappingOpsRewrite>(patterns.getContext());
 }
 
 void populateExecutionPlanVectorizePatterns(bool printVectorizationDetails, mlir::RewritePatternSet& patterns)
@@ -298,6 +298,59 @@ struct ValueBarrierToGPUBarrierConversion final : public OpRewritePattern<vir::B
     }
 };
 
+static Value CombineWarpReducePartials(PatternRewriter& rewriter, Location loc, vir::WarpReduceKind kind, Value lhs, Value rhs)
+{
+    const bool isFloat = lhs.getType().isa<FloatType>();
+    switch (kind)
+    {
+    case vir::WarpReduceKind::Sum:
+        if (isFloat)
+        {
+            return rewriter.create<arith::AddFOp>(loc, lhs, rhs);
+        }
+        return rewriter.create<arith::AddIOp>(loc, lhs, rhs);
+    case vir::WarpReduceKind::Max: {
+        // Compare-and-select rather than arith.max* so that every downstream consumer,
+        // including the C++ source emitter, has a spelling for the combiner
+        Value cmp = isFloat ? rewriter.create<arith::CmpFOp>(loc, arith::CmpFPredicate::OGT, lhs, rhs).getResult()
+                            : rewriter.create<arith::CmpIOp>(loc, arith::CmpIPredicate::sgt, lhs, rhs).getResult();
+        return rewriter.create<SelectOp>(loc, cmp, lhs, rhs);
+    }
+    }
+    llvm_unreachable("Unhandled warp reduce kind");
+}
+
+// Expands a warp-scope reduction into a butterfly of xor shuffles that combines the lane
+// values register-to-register, with no shared memory round-trip or barrier. A block-level
+// reduction built on top of this only goes through shared memory for the cross-warp combine
+// of one partial value per warp.
+struct ValueWarpReduceToGPUShuffleConversion final : public OpRewritePattern<vir::WarpReduceOp>
+{
+    using OpRewritePattern<vir::WarpReduceOp>::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(vir::WarpReduceOp op, PatternRewriter& rewriter) const final
+    {
+        auto inputType = op.input().getType();
+        if (!inputType.isF32() && !inputType.isInteger(32))
+        {
+            return rewriter.notifyMatchFailure(op, "gpu.shuffle only operates on 32-bit values");
+        }
+
+        auto [warpSizeX, warpSizeY] = utilir::ResolveWarpSize(utilir::ResolveExecutionRuntime(op)).value();
+        const int32_t warpSize = warpSizeX * warpSizeY;
+
+        auto loc = op.getLoc();
+        Value result = op.input();
+        for (int32_t offset = warpSize / 2; offset >= 1; offset /= 2)
+        {
+            auto shuffle = rewriter.create<gpu::ShuffleOp>(loc, result, offset, warpSize, gpu::ShuffleMode::XOR);
+            result = CombineWarpReducePartials(rewriter, loc, op.kind(), result, shuffle.shuffleResult());
+        }
+        rewriter.replaceOp(op, result);
+        return success();
+    }
+};
+
 template <typename MFMALoadStoreOpTy, typename PostMFMAOp>
 void MFMALoadStoreAccumulator(MFMALoadStoreOpTy op, ConversionPatternRewriter& rewriter, const vir::MMAOp& mfmaMatrixType, const int64_t vecSize, PostMFMAOp&& doAfterFn)
 {
@@ -600,9 +653,31 @@ struct ValueMMAStoreSyncOpToRocDLConversion final : public OpConversionPattern<v
         auto srcMemRefType = src.getType().cast<MemRefType>();
         auto srcMemRefShape = srcMemRefType.getShape();
         const auto vecSize = std::accumulate(srcMemRefShape.begin(), srcMemRefShape.end(), 1, std::multiplies<int64_t>());
+        auto epilogueOp = vir::MMAFragmentOpType::None;
+        if (auto epilogueAttr = op->getAttrOfType<IntegerAttr>(vir::MMAEpilogueOpAttrName))
+        {
+            epilogueOp = static_cast<vir::MMAFragmentOpType>(epilogueAttr.getInt());
+        }
         MFMALoadStoreAccumulator(op, rewriter, mfmaOpType, vecSize, [&](Location& loc, AffineForOp& loop, OpBuilder& loopBuilder, ValueRange mappedOperands) {
             mlir::Value castedElem = loopBuilder.create<memref::LoadOp>(loc, src, loop.getInductionVar());
 
+            // Apply the fused epilogue while the accumulator element is still in registers,
+            // before any narrowing cast
+            if (epilogueOp == vir::MMAFragmentOpType::ReLU)
+            {
+                auto elemType = srcMemRefType.getElementType();
+                if (elemType.isa<FloatType>())
+                {
+                    auto zero = loopBuilder.create<arith::ConstantOp>(loc, elemType, loopBuilder.getZeroAttr(elemType));
+                    castedElem = loopBuilder.create<arith::MaxFOp>(loc, castedElem, zero);
+                }
+                else
+                {
+                    auto zero = loopBuilder.create<arith::ConstantIntOp>(loc, 0, elemType);
+                    castedElem = loopBuilder.create<arith::MaxSIOp>(loc, castedElem, zero);
+                }
+            }
+
             // Check if we need to cast before storing back the result
             auto srcType = srcMemRefType.getElementType();
             auto dstType = memref.getType().cast<MemRefType>().getElementType();
@@ -765,8 +840,10 @@ struct ValueMFMAComputeToRocDLConversion final : public OpConversionPattern<vir:
                 }
             }
         }
-        else if (inputType.isInteger(8))
+        else if (inputType.isSignlessInteger(8))
         {
+            // The CDNA i8 mfma instructions sign-extend their operands, so only signed 8-bit
+            // inputs lower here; unsigned 8-bit goes through the CUDA WMMA path
             auto innerLoop = loopBuilder.create<AffineForOp>(loc, 0, inElemsPerThread, 1, matD);
             auto innerLoopbuilder = utilir::MakeBodyBuilder(innerLoop);
             mlir::Value acc = innerLoop.getRegionIterArgs()[0];
@@ -815,6 +892,21 @@ struct ValueMFMAComputeToRocDLConversion final : public OpConversionPattern<vir:
                 return failure();
             }
         }
+        else if (inputType.isF64())
+        {
+            // CDNA2 (gfx90a and up) double-precision mfma; same 16x16x4 tile as the f32 shape,
+            // with one f64 operand element per thread per step
+            auto elemA = loopBuilder.create<memref::LoadOp>(loc, opA, inductionVar);
+            auto elemB = loopBuilder.create<memref::LoadOp>(loc, opB, inductionVar);
+            switch (mfmaShape)
+            {
+            case MMAShape::M16xN16xK4_B1:
+                loopBuilder.create<AffineYieldOp>(loc, ValueRange{ loopBuilder.create<ROCDL::mfma_f64_16x16x4f64>(loc, vecC.getType(), ValueRange{ elemA, elemB, matD, cbsz, abid, blgp }) });
+                break;
+            default:
+                return failure();
+            }
+        }
         else
         {
             return failure();
@@ -1032,6 +1124,7 @@ struct AcceraToROCDLPass : public accera::transforms::ConvertAcceraToROCDLBase<A
             vir::MMALoadSyncOp,
             vir::MMAStoreSyncOp,
             vir::BarrierOp,
+            vir::WarpReduceOp,
             gpu::BlockDimOp,
             ROCDL::BlockDimXOp,
             ROCDL::BlockDimYOp,
@@ -1125,6 +1218,7 @@ struct AcceraToNVVMPass : public accera::transforms::ConvertAcceraToNVVMBase<Acc
         target.addIllegalOp<
             vir::EarlyReturnOp,
             vir::BarrierOp,
+            vir::WarpReduceOp,
             gpu::BlockDimOp,
             ROCDL::BlockDimXOp,
             ROCDL::BlockDimYOp,
@@ -1181,7 +1275,8 @@ void populateAcceraToNVVMPatterns(mlir::RewritePatternSet& patterns)
     patterns.insert<
         ResolveBlockDimPattern,
         EarlyReturnToGPUReturnPattern,
-        ValueBarrierToGPUBarrierConversion>(patterns.getContext());
+        ValueBarrierToGPUBarrierConversion,
+        ValueWarpReduceToGPUShuffleConversion>(patterns.getContext());
 }
 
 void populateAcceraToROCDLPatterns(mlir::RewritePatternSet& patterns)
@@ -1190,6 +1285,7 @@ void populateAcceraToROCDLPatterns(mlir::RewritePatternSet& patterns)
         ResolveBlockDimPattern,
         EarlyReturnToGPUReturnPattern,
         ValueBarrierToGPUBarrierConversion,
+        ValueWarpReduceToGPUShuffleConversion,
         ValueMMAAllocSyncOpToRocDLConversion,
         ValueMMALoadSyncOpToRocDLConversion,
         ValueMFMAComputeToRocDLConversion,
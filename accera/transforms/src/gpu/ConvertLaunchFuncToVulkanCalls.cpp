@@ -55,6 +55,9 @@ static constexpr const char* kVulkanLaunch = "vulkanLaunch";
 
 // Custom to acc-vulkan-runtime-wrappers
 static constexpr const char* kSetRepeatedRunCharacteristics = "setRepeatedRunCharacteristics";
+static constexpr const char* kSetConcurrentDispatchCount = "setConcurrentDispatchCount";
+static constexpr const char* kSetLaunchBatchSize = "setLaunchBatchSize";
+static constexpr const char* kSetTimingOutputFile = "setTimingOutputFile";
 static constexpr const char* kVulkanRuntimeInstanceHandle = "VulkanRuntime_Instance_Handle";
 static constexpr const char* kInitVulkanEmittedFunc = "initVulkanUtilities";
 static constexpr const char* kDestroyVulkanEmittedFunc = "destroyVulkanUtilities";
@@ -74,6 +77,8 @@ namespace
 /// * setEntryPoint                     -- sets the entry point name
 /// * setNumWorkGroups                  -- sets the number of a local workgroups
 /// * setRepeatedRunCharacteristics     -- sets the warmup and run counts for timing runs
+/// * setConcurrentDispatchCount        -- sets the number of concurrent dispatches per run
+/// * setLaunchBatchSize                -- sets the number of dispatches recorded per submission
 /// * runOnVulkan                       -- runs vulkan runtime
 /// * deinitVulkan                      -- deinitializes vulkan runtime
 ///
@@ -225,11 +230,14 @@ private:
     void markVulkanLaunchInternal();
 
 public:
-    VulkanLaunchFuncToVulkanCallsWithTimingPass(bool printTimings, uint32_t warmupCount, uint32_t runCount)
+    VulkanLaunchFuncToVulkanCallsWithTimingPass(bool printTimings, uint32_t warmupCount, uint32_t runCount, uint32_t concurrentDispatchCount, uint32_t launchBatchSize, const std::string& timingOutputFile)
     {
         this->printTimings = printTimings;
         this->warmupCount = warmupCount;
         this->runCount = runCount;
+        this->concurrentDispatchCount = concurrentDispatchCount;
+        this->launchBatchSize = launchBatchSize;
+        this->timingOutputFile = timingOutputFile;
     }
 
     void runOnModule() override;
@@ -451,6 +459,27 @@ void VulkanLaunchFuncToVulkanCallsWithTimingPass::declareVulkanFunctions(Locatio
                                                                              /*isVarArg=*/false));
     }
 
+    if (!module.lookupSymbol(kSetConcurrentDispatchCount))
+    {
+        builder.create<LLVM::LLVMFuncOp>(
+            loc, kSetConcurrentDispatchCount, LLVM::LLVMFunctionType::get(getVoidType(), { getPointerType(), getInt32Type() },
+                                                                          /*isVarArg=*/false));
+    }
+
+    if (!module.lookupSymbol(kSetTimingOutputFile))
+    {
+        builder.create<LLVM::LLVMFuncOp>(
+            loc, kSetTimingOutputFile, LLVM::LLVMFunctionType::get(getVoidType(), { getPointerType(), getPointerType() },
+                                                                   /*isVarArg=*/false));
+    }
+
+    if (!module.lookupSymbol(kSetLaunchBatchSize))
+    {
+        builder.create<LLVM::LLVMFuncOp>(
+            loc, kSetLaunchBatchSize, LLVM::LLVMFunctionType::get(getVoidType(), { getPointerType(), getInt32Type() },
+                                                                  /*isVarArg=*/false));
+    }
+
     for (unsigned i = 1; i <= 3; i++)
     {
 
@@ -553,6 +582,39 @@ void VulkanLaunchFuncToVulkanCallsWithTimingPass::translateVulkanLaunchCall(
                          warmupCountConstant,
                          runCountConstant });
 
+    // Create call to setConcurrentDispatchCount to set the number of concurrent dispatches per run
+    Value concurrentDispatchCountConstant = builder.create<LLVM::ConstantOp>(loc, getInt32Type(), builder.getI32IntegerAttr(concurrentDispatchCount));
+    builder.create<LLVM::CallOp>(
+        loc,
+        ArrayRef<Type>{},
+        kSetConcurrentDispatchCount,
+        ArrayRef<Value>{ vulkanRuntime, concurrentDispatchCountConstant });
+
+    // Create call to setLaunchBatchSize to set the number of dispatches recorded per submission
+    Value launchBatchSizeConstant = builder.create<LLVM::ConstantOp>(loc, getInt32Type(), builder.getI32IntegerAttr(launchBatchSize));
+    builder.create<LLVM::CallOp>(
+        loc,
+        ArrayRef<Type>{},
+        kSetLaunchBatchSize,
+        ArrayRef<Value>{ vulkanRuntime, launchBatchSizeConstant });
+
+    // Create call to setTimingOutputFile with the path of the JSON timing
+    // report, when one was requested.
+    if (!timingOutputFile.empty())
+    {
+        SmallString<64> timingFilePath(timingOutputFile.begin(), timingOutputFile.end());
+        // Append `\0` to follow C style string given that LLVM::createGlobalString()
+        // won't handle this directly for us.
+        timingFilePath.push_back('\0');
+        Value timingFilePathGlobal = LLVM::createGlobalString(
+            loc, builder, "vulkan_timing_output_file", timingFilePath, LLVM::Linkage::Internal);
+        builder.create<LLVM::CallOp>(
+            loc,
+            ArrayRef<Type>{},
+            kSetTimingOutputFile,
+            ArrayRef<Value>{ vulkanRuntime, timingFilePathGlobal });
+    }
+
     // This SetNumWorkGroups call needs to be in whatever function is called with the emit-time-constant dimensions
     // TODO : move the hard-coded workgroup dimensions out of the caller of vulkanLaunch
     builder.create<LLVM::CallOp>(
@@ -686,6 +748,6 @@ namespace accera::transforms::vulkan
 {
 std::unique_ptr<mlir::OperationPass<mlir::ModuleOp>> createConvertVulkanLaunchFuncToVulkanCallsWithTimingPass(const VulkanTimingOptions& options)
 {
-    return std::make_unique<VulkanLaunchFuncToVulkanCallsWithTimingPass>(options.printTimings, static_cast<uint32_t>(options.warmupCount), static_cast<uint32_t>(options.runCount));
+    return std::make_unique<VulkanLaunchFuncToVulkanCallsWithTimingPass>(options.printTimings, static_cast<uint32_t>(options.warmupCount), static_cast<uint32_t>(options.runCount), static_cast<uint32_t>(options.concurrentDispatchCount), static_cast<uint32_t>(options.launchBatchSize), options.timingOutputFile);
 }
 } // namespace accera::transforms::vulkan
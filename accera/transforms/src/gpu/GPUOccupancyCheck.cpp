@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AcceraPasses.h"
+
+#include <ir/include/IRUtil.h>
+
+#include <value/include/TargetDevice.h>
+
+#include <mlir/Dialect/GPU/GPUDialect.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+namespace utilir = accera::ir::util;
+namespace vir = accera::ir::value;
+
+using namespace mlir;
+
+namespace
+{
+
+// Occupancy limits of a single multiprocessor (SM/CU). Register pressure is only known after
+// device compilation, so the estimate here covers the thread and shared memory limits; the
+// register file size is carried on TargetDevice for when serialized kernels can report usage.
+struct MultiprocessorLimits
+{
+    size_t maxThreadsPerBlock;
+    size_t maxThreadsPerMultiprocessor;
+    size_t maxSharedMemoryPerBlock;
+    size_t sharedMemoryPerMultiprocessor;
+};
+
+MultiprocessorLimits ResolveMultiprocessorLimits(const std::string& deviceName, gpu::GPUModuleOp module)
+{
+    if (!deviceName.empty())
+    {
+        try
+        {
+            auto device = accera::value::GetTargetDevice(deviceName);
+            if (device.maxThreadsPerMultiprocessor != 0)
+            {
+                return { device.maxThreadsPerBlock,
+                         device.maxThreadsPerMultiprocessor,
+                         device.maxSharedMemoryPerBlock,
+                         device.sharedMemoryPerMultiprocessor };
+            }
+            module.emitWarning("target device '" + deviceName + "' has no GPU occupancy limits, using runtime defaults");
+        }
+        catch (const std::exception&)
+        {
+            module.emitWarning("unknown target device '" + deviceName + "', using runtime defaults");
+        }
+    }
+
+    // Conservative architecture-family defaults when no SKU is given
+    if (utilir::ResolveExecutionRuntime(module) == vir::ExecutionRuntime::ROCM)
+    {
+        return { 1024, 2560, 64 * 1024, 64 * 1024 };
+    }
+    return { 1024, 2048, 48 * 1024, 96 * 1024 };
+}
+
+// Sums the statically-sized workgroup (shared/LDS) memory a kernel allocates.
+size_t ComputeWorkgroupMemoryUsage(gpu::GPUFuncOp funcOp)
+{
+    auto memRefBytes = [](MemRefType type) -> size_t {
+        if (!type.hasStaticShape())
+        {
+            return 0;
+        }
+        return type.getNumElements() * type.getElementTypeBitWidth() / 8;
+    };
+
+    size_t bytes = 0;
+    for (auto attribution : funcOp.getWorkgroupAttributions())
+    {
+        if (auto memRefType = attribution.getType().dyn_cast<MemRefType>())
+        {
+            bytes += memRefBytes(memRefType);
+        }
+    }
+    funcOp.walk([&](Operation* op) {
+        if (!isa<memref::AllocOp, memref::AllocaOp>(op))
+        {
+            return;
+        }
+        auto memRefType = op->getResult(0).getType().cast<MemRefType>();
+        if (memRefType.getMemorySpaceAsInt() == gpu::GPUDialect::getWorkgroupAddressSpace())
+        {
+            bytes += memRefBytes(memRefType);
+        }
+    });
+    return bytes;
+}
+
+class GPUOccupancyCheckPass : public accera::transforms::GPUOccupancyCheckBase<GPUOccupancyCheckPass>
+{
+public:
+    void runOnOperation() override
+    {
+        auto module = getOperation();
+        const auto limits = ResolveMultiprocessorLimits(targetDeviceName.getValue(), module);
+
+        auto result = module.walk([&](gpu::GPUFuncOp funcOp) -> WalkResult {
+            auto blockSizeAttr = funcOp->getAttrOfType<ArrayAttr>("blockSize");
+            if (!blockSizeAttr)
+            {
+                return WalkResult::advance();
+            }
+            auto blockSize = utilir::ArrayAttrToVector<IntegerAttr>(blockSizeAttr);
+            const size_t threadsPerBlock = blockSize[0].getInt() * blockSize[1].getInt() * blockSize[2].getInt();
+            if (threadsPerBlock == 0)
+            {
+                return WalkResult::advance();
+            }
+            if (threadsPerBlock > limits.maxThreadsPerBlock)
+            {
+                funcOp.emitError() << "block size " << threadsPerBlock
+                                   << " exceeds the device limit of " << limits.maxThreadsPerBlock
+                                   << " threads per block";
+                return WalkResult::interrupt();
+            }
+
+            const size_t sharedBytes = ComputeWorkgroupMemoryUsage(funcOp);
+            if (sharedBytes > limits.maxSharedMemoryPerBlock)
+            {
+                funcOp.emitError() << "kernel uses " << sharedBytes
+                                   << " bytes of shared memory, exceeding the device limit of "
+                                   << limits.maxSharedMemoryPerBlock << " bytes per block";
+                return WalkResult::interrupt();
+            }
+
+            // Resident blocks per multiprocessor, limited by threads and shared memory
+            size_t blocksPerMultiprocessor = limits.maxThreadsPerMultiprocessor / threadsPerBlock;
+            if (sharedBytes > 0)
+            {
+                blocksPerMultiprocessor = std::min(blocksPerMultiprocessor,
+                                                   limits.sharedMemoryPerMultiprocessor / sharedBytes);
+            }
+            const size_t occupancyPercent =
+                blocksPerMultiprocessor * threadsPerBlock * 100 / limits.maxThreadsPerMultiprocessor;
+
+            // Record the launch bounds so the C++ emitter can forward them to the device compiler
+            OpBuilder builder(funcOp);
+            funcOp->setAttr("minBlocksPerMultiprocessor",
+                            builder.getI64IntegerAttr(static_cast<int64_t>(std::max<size_t>(blocksPerMultiprocessor, 1))));
+
+            // Record per-kernel resource usage for the HAT package so deployment tooling and the
+            // autotuner can prune candidates without executing them. Register and spill counts come
+            // from the device compiler and are appended by the serialization passes when available.
+            funcOp->setAttr(accera::ir::KernelResourceUsageAttrName,
+                            builder.getDictionaryAttr({
+                                builder.getNamedAttr("threads_per_block", builder.getI64IntegerAttr(static_cast<int64_t>(threadsPerBlock))),
+                                builder.getNamedAttr("shared_memory_bytes", builder.getI64IntegerAttr(static_cast<int64_t>(sharedBytes))),
+                                builder.getNamedAttr("blocks_per_multiprocessor", builder.getI64IntegerAttr(static_cast<int64_t>(blocksPerMultiprocessor))),
+                                builder.getNamedAttr("occupancy_percent", builder.getI64IntegerAttr(static_cast<int64_t>(occupancyPercent))),
+                            }));
+
+            if (occupancyFloor > 0 && occupancyPercent < occupancyFloor)
+            {
+                funcOp.emitError() << "estimated occupancy of " << occupancyPercent
+                                   << "% (" << blocksPerMultiprocessor << " blocks of " << threadsPerBlock
+                                   << " threads, " << sharedBytes << " shared memory bytes) is below the floor of "
+                                   << occupancyFloor.getValue() << "%";
+                return WalkResult::interrupt();
+            }
+            return WalkResult::advance();
+        });
+
+        if (result.wasInterrupted())
+        {
+            signalPassFailure();
+        }
+    }
+};
+
+} // namespace
+
+namespace accera::transforms
+{
+std::unique_ptr<mlir::OperationPass<mlir::gpu::GPUModuleOp>> createGPUOccupancyCheckPass()
+{
+    return std::make_unique<GPUOccupancyCheckPass>();
+}
+} // namespace accera::transforms
@@ -0,0 +1,374 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AcceraPasses.h"
+#include "nest/ArgoOpRecognitionPass.h"
+
+#include <ir/include/IRUtil.h>
+#include <ir/include/nest/Index.h>
+#include <ir/include/nest/LoopNestOps.h>
+#include <ir/include/nest/TransformedDomain.h>
+#include <ir/include/value/ValueDialect.h>
+#include <value/include/TargetDevice.h>
+
+#include <mlir/Dialect/Arithmetic/IR/Arithmetic.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/BuiltinAttributes.h>
+#include <mlir/IR/SymbolTable.h>
+#include <mlir/Pass/Pass.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+using namespace mlir;
+using namespace accera::ir::loopnest;
+
+namespace ln = accera::ir::loopnest;
+namespace vir = accera::ir::value;
+namespace util = accera::ir::util;
+
+namespace
+{
+
+// A load or store of one element of a buffer, addressed purely by loop indices
+struct BufferAccess
+{
+    mlir::Value buffer;
+    std::vector<Index> indices;
+};
+
+// The recognition result, including the loop indices the pass needs to dispatch a schedule
+// template. Only the name and transpose flags are exposed through the public API.
+struct RecognizedOp
+{
+    accera::transforms::loopnest::ArgoNamedOpMatch match;
+    Index i, j, k; // matmul loop indices; only valid when match.opName == "argo.matmul"
+};
+
+std::optional<BufferAccess> MatchSliceAccess(mlir::Value value)
+{
+    auto sliceOp = value.getDefiningOp<vir::SliceOp>();
+    if (!sliceOp)
+    {
+        return std::nullopt;
+    }
+    // Chained slices address sub-views whose indexing this matcher doesn't model
+    if (sliceOp.source().getDefiningOp<vir::SliceOp>())
+    {
+        return std::nullopt;
+    }
+
+    BufferAccess access{ sliceOp.source(), {} };
+    for (auto offset : sliceOp.offsets())
+    {
+        auto symIndexOp = offset.getDefiningOp<ln::SymbolicIndexOp>();
+        if (!symIndexOp)
+        {
+            return std::nullopt;
+        }
+        access.indices.push_back(symIndexOp.getValue());
+    }
+    return access;
+}
+
+// Matches get_element(slice(buffer, indices...)), looking through value casts so that
+// upcasting kernels (e.g. the int8 matmul that widens to int32) still match
+std::optional<BufferAccess> MatchElementLoad(mlir::Value value)
+{
+    while (auto castOp = value.getDefiningOp<vir::CastOp>())
+    {
+        value = castOp.source();
+    }
+    auto getElementOp = value.getDefiningOp<vir::GetElementOp>();
+    if (!getElementOp)
+    {
+        return std::nullopt;
+    }
+    return MatchSliceAccess(getElementOp.value());
+}
+
+bool SameAccess(const BufferAccess& a, const BufferAccess& b)
+{
+    return a.buffer == b.buffer && a.indices == b.indices;
+}
+
+bool ContainsIndex(const std::vector<Index>& indices, const Index& index)
+{
+    return std::find(indices.begin(), indices.end(), index) != indices.end();
+}
+
+ln::KernelOp ResolveKernel(ln::ScheduledKernelOp scheduledKernel)
+{
+    auto symTableOp = mlir::SymbolTable::getNearestSymbolTable(scheduledKernel);
+    auto idAttr = StringAttr::get(scheduledKernel->getContext(), scheduledKernel.getKernel());
+    auto* symbolOp = mlir::SymbolTable::lookupNearestSymbolFrom(symTableOp, idAttr);
+    return mlir::dyn_cast_or_null<ln::KernelOp>(symbolOp);
+}
+
+std::optional<RecognizedOp> RecognizeNamedOp(ln::ScheduleOp scheduleOp)
+{
+    auto kernels = scheduleOp.getKernels();
+    if (kernels.size() != 1)
+    {
+        return std::nullopt;
+    }
+    auto kernelOp = ResolveKernel(kernels.front());
+    if (!kernelOp)
+    {
+        return std::nullopt;
+    }
+
+    // The kernel body must be a single copy fed by a pure expression tree; any other op with
+    // side effects means the kernel computes something this matcher doesn't understand
+    vir::CopyOp copyOp;
+    for (auto& op : kernelOp.getBody()->without_terminator())
+    {
+        if (auto thisCopy = mlir::dyn_cast<vir::CopyOp>(op))
+        {
+            if (copyOp)
+            {
+                return std::nullopt;
+            }
+            copyOp = thisCopy;
+            continue;
+        }
+        if (!mlir::isa<vir::SliceOp, vir::GetElementOp, vir::BinOp, vir::CastOp, ln::SymbolicIndexOp, arith::ConstantOp>(op))
+        {
+            return std::nullopt;
+        }
+    }
+    if (!copyOp)
+    {
+        return std::nullopt;
+    }
+
+    auto dest = MatchSliceAccess(copyOp.output());
+    if (!dest)
+    {
+        return std::nullopt;
+    }
+
+    RecognizedOp recognized;
+    auto input = copyOp.input();
+
+    // fill: a constant stored at every point of the iteration space
+    if (input.getDefiningOp<arith::ConstantOp>())
+    {
+        recognized.match.opName = "argo.fill";
+        return recognized;
+    }
+
+    // copy: an element of another buffer addressed by (a permutation of) the same indices
+    if (auto src = MatchElementLoad(input))
+    {
+        if (src->buffer == dest->buffer || src->indices.size() != dest->indices.size())
+        {
+            return std::nullopt;
+        }
+        auto sortedSrc = src->indices;
+        auto sortedDest = dest->indices;
+        std::sort(sortedSrc.begin(), sortedSrc.end());
+        std::sort(sortedDest.begin(), sortedDest.end());
+        if (sortedSrc != sortedDest)
+        {
+            return std::nullopt;
+        }
+        recognized.match.opName = "argo.copy";
+        return recognized;
+    }
+
+    // matmul: C(i,j) = C(i,j) + A(.,.) * B(.,.) with A and B each carrying one of the output
+    // indices plus a shared reduction index
+    auto addOp = mlir::dyn_cast_or_null<vir::BinOp>(input.getDefiningOp());
+    if (!addOp || addOp.getPredicate() != vir::BinaryOpPredicate::ADD || dest->indices.size() != 2)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<BufferAccess> accumulator;
+    vir::BinOp mulOp;
+    for (int operand = 0; operand < 2; ++operand)
+    {
+        if (auto load = MatchElementLoad(addOp.getOperand(operand)); load && SameAccess(*load, *dest))
+        {
+            accumulator = load;
+            mulOp = mlir::dyn_cast_or_null<vir::BinOp>(addOp.getOperand(1 - operand).getDefiningOp());
+        }
+    }
+    if (!accumulator || !mulOp || mulOp.getPredicate() != vir::BinaryOpPredicate::MUL)
+    {
+        return std::nullopt;
+    }
+
+    auto lhs = MatchElementLoad(mulOp.getOperand(0));
+    auto rhs = MatchElementLoad(mulOp.getOperand(1));
+    if (!lhs || !rhs || lhs->indices.size() != 2 || rhs->indices.size() != 2)
+    {
+        return std::nullopt;
+    }
+
+    auto i = dest->indices[0];
+    auto j = dest->indices[1];
+
+    // A is whichever input carries the output row index; B carries the column index
+    if (ContainsIndex(rhs->indices, i) && !ContainsIndex(lhs->indices, i))
+    {
+        std::swap(lhs, rhs);
+    }
+    if (!ContainsIndex(lhs->indices, i) || ContainsIndex(lhs->indices, j) ||
+        !ContainsIndex(rhs->indices, j) || ContainsIndex(rhs->indices, i))
+    {
+        return std::nullopt;
+    }
+
+    auto k = lhs->indices[0] == i ? lhs->indices[1] : lhs->indices[0];
+    if (!ContainsIndex(rhs->indices, k) || k == i || k == j)
+    {
+        return std::nullopt;
+    }
+
+    recognized.match.opName = "argo.matmul";
+    recognized.match.transposeA = lhs->indices[0] == k;
+    recognized.match.transposeB = rhs->indices[0] == j;
+    recognized.i = i;
+    recognized.j = j;
+    recognized.k = k;
+    return recognized;
+}
+
+// The pre-tuned register/cache tiling for a plain matmul on the given CPU target: j split to
+// two accumulator vectors, i split to the accumulator rows the register file affords, k blocked
+// so the B tile stays resident in L2. Deliberately unsophisticated --- its job is to beat the
+// untransformed nest without any schedule search, not to beat a hand-tuned schedule.
+void ApplyMatmulScheduleTemplate(ln::ScheduleOp scheduleOp, const RecognizedOp& recognized, const accera::value::TargetDevice& targetDevice, mlir::NamedAttrList& entries)
+{
+    auto domain = scheduleOp.getDomain().getValue();
+    if (!domain.HasConstantDimensionSize(recognized.i) ||
+        !domain.HasConstantDimensionSize(recognized.j) ||
+        !domain.HasConstantDimensionSize(recognized.k))
+    {
+        return;
+    }
+    auto M = domain.GetDimensionSize(recognized.i);
+    auto N = domain.GetDimensionSize(recognized.j);
+    auto K = domain.GetDimensionSize(recognized.k);
+
+    const int64_t elementBytes = 4; // tuned for f32; other element types still get a reasonable blocking
+    int64_t vectorBytes = targetDevice.HasFeature("avx512f") ? 64 : (targetDevice.HasFeature("avx") ? 32 : 16);
+    int64_t numVectorRegisters = targetDevice.numVectorRegisters > 0 ? static_cast<int64_t>(targetDevice.numVectorRegisters) : 16;
+    int64_t l2CacheBytes = targetDevice.l2CacheSize > 0 ? static_cast<int64_t>(targetDevice.l2CacheSize) : 256 * 1024;
+
+    int64_t jTile = 2 * (vectorBytes / elementBytes); // two accumulator vectors wide
+    int64_t iTile = numVectorRegisters >= 32 ? 6 : 4; // accumulator rows; leaves registers for A broadcasts and the B tile
+    int64_t kTile = std::clamp<int64_t>(l2CacheBytes / (2 * jTile * elementBytes), 16, 256); // half of L2 for the B tile
+
+    Index iOuter = recognized.i, jOuter = recognized.j, kOuter = recognized.k;
+    std::optional<Index> iInner, jInner, kInner;
+    if (jTile < N)
+    {
+        auto split = scheduleOp.split(jOuter, static_cast<int>(jTile));
+        jOuter = split.outer;
+        jInner = split.inner;
+    }
+    if (kTile < K)
+    {
+        auto split = scheduleOp.split(kOuter, static_cast<int>(kTile));
+        kOuter = split.outer;
+        kInner = split.inner;
+    }
+    if (iTile < M)
+    {
+        auto split = scheduleOp.split(iOuter, static_cast<int>(iTile));
+        iOuter = split.outer;
+        iInner = split.inner;
+    }
+
+    std::vector<Index> order{ jOuter, kOuter, iOuter };
+    if (kInner) order.push_back(*kInner);
+    if (iInner) order.push_back(*iInner);
+    if (jInner) order.push_back(*jInner);
+    scheduleOp.setOrder(order);
+
+    if (iInner)
+    {
+        scheduleOp.unrollAndJam(*iInner, static_cast<uint64_t>(iTile));
+    }
+    if (jInner)
+    {
+        // Fully unrolling the two-vector-wide loop leaves the backend straight-line code to vectorize
+        scheduleOp.unroll(*jInner);
+    }
+
+    mlir::Builder builder(scheduleOp->getContext());
+    entries.append("template", builder.getStringAttr(targetDevice.deviceName));
+    entries.append("iTile", builder.getI64IntegerAttr(iTile));
+    entries.append("jTile", builder.getI64IntegerAttr(jTile));
+    entries.append("kTile", builder.getI64IntegerAttr(kTile));
+}
+
+struct ArgoOpRecognitionPass : public ArgoOpRecognitionBase<ArgoOpRecognitionPass>
+{
+    void runOnOperation() final
+    {
+        auto op = getOperation();
+        auto targetDevice = accera::value::GetTargetDevice(target);
+        Builder builder(op->getContext());
+        op->walk([&](ln::ScheduleOp scheduleOp) {
+            auto recognized = RecognizeNamedOp(scheduleOp);
+            if (!recognized)
+            {
+                return;
+            }
+
+            mlir::NamedAttrList entries;
+            entries.append("op", builder.getStringAttr(recognized->match.opName));
+            if (recognized->match.opName == "argo.matmul")
+            {
+                entries.append("transposeA", builder.getBoolAttr(recognized->match.transposeA));
+                entries.append("transposeB", builder.getBoolAttr(recognized->match.transposeB));
+
+                // Only dispatch the template when the schedule is still untransformed --- a
+                // schedule someone already split or reordered is theirs, not ours --- and only
+                // the plain layout, whose template is the one we trust
+                auto execTarget = util::ResolveExecutionTarget(scheduleOp);
+                bool untransformed = scheduleOp.getOrder().size() == domainRank(scheduleOp);
+                if (execTarget == vir::ExecutionTarget::CPU && untransformed && scheduleOp.hasConstantRanges() &&
+                    !recognized->match.transposeA && !recognized->match.transposeB)
+                {
+                    ApplyMatmulScheduleTemplate(scheduleOp, *recognized, targetDevice, entries);
+                }
+            }
+            scheduleOp->setAttr("argo.named_op", entries.getDictionary(op->getContext()));
+        });
+    }
+
+    static size_t domainRank(ln::ScheduleOp scheduleOp)
+    {
+        return scheduleOp.getDomain().getValue().GetDimensions().size();
+    }
+};
+
+} // namespace
+
+namespace accera::transforms::loopnest
+{
+
+std::optional<ArgoNamedOpMatch> MatchArgoNamedOp(ln::ScheduleOp scheduleOp)
+{
+    auto recognized = RecognizeNamedOp(scheduleOp);
+    if (!recognized)
+    {
+        return std::nullopt;
+    }
+    return recognized->match;
+}
+
+std::unique_ptr<mlir::Pass> createArgoOpRecognitionPass()
+{
+    return std::make_unique<ArgoOpRecognitionPass>();
+}
+
+} // namespace accera::transforms::loopnest
@@ -187,6 +187,16 @@ void LoopNestOptPass::runOnOperation()
             if (tripCount && *tripCount >= 1)
                 (void)loopUnrollFull(op);
         }
+        else if (auto factorAttr = op->getAttrOfType<IntegerAttr>("accv_unroll_by_factor"))
+        {
+            // Partial unroll: the loop's trip count is an exact multiple of the factor (the
+            // residue was partitioned into a separate fully-unrolled loop), so unrolling by
+            // the factor produces no generic remainder loop
+            auto factor = (uint64_t)factorAttr.getInt();
+            auto tripCount = getConstantTripCount(op);
+            if (tripCount && *tripCount >= factor && *tripCount % factor == 0)
+                (void)loopUnrollByFactor(op, factor);
+        }
     });
 }
 
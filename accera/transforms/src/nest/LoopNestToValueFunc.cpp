@@ -10,7 +10,11 @@
 #include <ir/include/exec/ExecutionPlanAttributes.h>
 #include <ir/include/value/ValueDialect.h>
 
+#include <transforms/include/exec/CacheCopyInstrumentation.h>
+#include <transforms/include/exec/CacheFootprintReport.h>
 #include <transforms/include/nest/LoopNestToValue.h>
+#include <transforms/include/nest/RegisterPressureReport.h>
+#include <transforms/include/nest/RooflineReport.h>
 #include <transforms/include/util/SnapshotUtilities.h>
 
 #include <mlir/Dialect/Affine/LoopUtils.h>
@@ -44,6 +48,13 @@ struct LoopNestToValueFuncPass : public accera::transforms::LoopNestToValueFuncB
     {
         printVecOpDetails = options.printVecOpDetails;
         printLoops = options.printLoops;
+        printCacheFootprints = options.printCacheFootprints;
+        strictCacheFootprint = options.strictCacheFootprint;
+        printRegisterPressure = options.printRegisterPressure;
+        strictRegisterPressure = options.strictRegisterPressure;
+        printRoofline = options.printRoofline;
+        instrumentCacheCopies = options.instrumentCacheCopies;
+        targetDeviceName = options.targetDeviceName;
     }
 
     void runOnOperation() final
@@ -56,6 +67,20 @@ struct LoopNestToValueFuncPass : public accera::transforms::LoopNestToValueFuncB
         auto snapshotter = _intrapassSnapshotter.MakeSnapshotPipe();
         snapshotter.Snapshot("Initial", vFuncOp);
 
+        {
+            // The unroll-and-jam factors and the kernels they replicate are only visible while
+            // the ScheduleOps still exist, so the register pressure report runs before any lowering
+            if (failed(lntr::EmitRegisterPressureReport(vFuncOp, targetDeviceName, printRegisterPressure, strictRegisterPressure)))
+            {
+                signalPassFailure();
+                return;
+            }
+
+            // The roofline estimate likewise needs the iteration domains and kernel bodies
+            // intact, and its attribute has to be on the function before metadata emission
+            (void)lntr::EmitRooflineReport(vFuncOp, targetDeviceName, printRoofline);
+        }
+
         mlir::GreedyRewriteConfig topDownConfig; // Some patterns require a top-down handling of ops to ensure relative orders stay consistent
         topDownConfig.useTopDownTraversal = true;
 
@@ -239,6 +264,14 @@ struct LoopNestToValueFuncPass : public accera::transforms::LoopNestToValueFuncB
                 snapshotter.Snapshot("ExecutionPlanMultiCacheCopy", vFuncOp);
             }
 
+            if (instrumentCacheCopies)
+            {
+                // The cache copy ops are lowered into loops by the copy/reduce patterns below,
+                // so the profile regions have to go in here while one op still means one transfer
+                xptr::InstrumentCacheCopies(vFuncOp);
+                snapshotter.Snapshot("CacheCopyInstrumentation", vFuncOp);
+            }
+
             {
                 RewritePatternSet patterns(context);
                 xptr::populateExecutionPlanCopyReducePatterns(patterns);
@@ -315,6 +348,17 @@ struct LoopNestToValueFuncPass : public accera::transforms::LoopNestToValueFuncB
             snapshotter.Snapshot("LoopOptimization", vFuncOp);
         }
 
+        {
+            // Last point where the caches still exist as MakeCacheOps with resolved static
+            // shapes, so the footprint report can tie bytes back to the caches that requested
+            // them before the finalize patterns lower them to allocations
+            if (failed(xptr::EmitCacheFootprintReport(vFuncOp, targetDeviceName, printCacheFootprints, strictCacheFootprint)))
+            {
+                signalPassFailure();
+                return;
+            }
+        }
+
         {
             RewritePatternSet patterns(context);
             xptr::populateExecutionPlanCacheFinalizePatterns(patterns);
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "nest/RegisterPressureReport.h"
+
+#include <ir/include/nest/LoopNestOps.h>
+#include <value/include/TargetDevice.h>
+
+#include <mlir/IR/Operation.h>
+#include <mlir/IR/SymbolTable.h>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace mlir;
+
+namespace ln = accera::ir::loopnest;
+
+namespace
+{
+
+// Unroll-and-jam replicates the kernel body by the interleave factor, so the right factor depends
+// on how many registers one copy of the body already holds live: too high spills, too low leaves
+// FMA ports idle. The per-iteration demand here is a straight-line live-range scan of the kernel
+// bodies. Index and address arithmetic is excluded since it lands in scalar registers, and after
+// vectorization each counted value occupies one vector register per interleaved copy.
+
+bool OccupiesVectorRegister(mlir::Value value)
+{
+    return !value.getType().isa<mlir::IndexType>();
+}
+
+int64_t EstimateBlockRegisterPressure(mlir::Block& block)
+{
+    llvm::DenseMap<mlir::Operation*, int64_t> opPositions;
+    int64_t numOps = 0;
+    for (auto& op : block)
+    {
+        opPositions[&op] = numOps++;
+    }
+
+    std::vector<int64_t> births(numOps, 0);
+    std::vector<int64_t> deaths(numOps, 0);
+    for (auto& op : block)
+    {
+        for (auto result : op.getResults())
+        {
+            if (!OccupiesVectorRegister(result))
+            {
+                continue;
+            }
+            auto lastUse = opPositions[&op];
+            for (auto* user : result.getUsers())
+            {
+                if (auto* ancestor = block.findAncestorOpInBlock(*user))
+                {
+                    lastUse = std::max(lastUse, opPositions[ancestor]);
+                }
+            }
+            ++births[opPositions[&op]];
+            ++deaths[lastUse];
+        }
+    }
+
+    int64_t liveCount = 0;
+    int64_t peakCount = 0;
+    for (int64_t position = 0; position < numOps; ++position)
+    {
+        liveCount += births[position];
+        peakCount = std::max(peakCount, liveCount);
+        liveCount -= deaths[position];
+    }
+    return peakCount;
+}
+
+} // namespace
+
+namespace accera::transforms::loopnest
+{
+
+int64_t EstimateKernelRegisterPressure(ln::ScheduleOp scheduleOp)
+{
+    int64_t pressure = 0;
+    for (auto scheduledKernel : scheduleOp.getKernels())
+    {
+        auto symTableOp = mlir::SymbolTable::getNearestSymbolTable(scheduledKernel);
+        auto idAttr = StringAttr::get(scheduledKernel->getContext(), scheduledKernel.getKernel());
+        auto* symbolOp = mlir::SymbolTable::lookupNearestSymbolFrom(symTableOp, idAttr);
+        if (auto kernelOp = mlir::dyn_cast_or_null<ln::KernelOp>(symbolOp))
+        {
+            pressure = std::max(pressure, EstimateBlockRegisterPressure(*kernelOp.getBody()));
+        }
+    }
+    return pressure;
+}
+
+mlir::LogicalResult EmitRegisterPressureReport(mlir::Operation* op,
+                                               const std::string& targetDeviceName,
+                                               bool printRegisterPressure,
+                                               bool warningsAsErrors)
+{
+    auto targetDevice = accera::value::GetTargetDevice(targetDeviceName);
+    auto numRegisters = static_cast<int64_t>(targetDevice.numVectorRegisters);
+
+    auto result = mlir::success();
+    op->walk([&](ln::ScheduleOp scheduleOp) {
+        int64_t interleaveProduct = 1;
+        for (const auto& index : scheduleOp.getOrder())
+        {
+            if (auto factor = scheduleOp.getUnrollAndJamFactor(index))
+            {
+                interleaveProduct *= static_cast<int64_t>(*factor);
+            }
+        }
+        if (interleaveProduct == 1)
+        {
+            // Only unroll-and-jammed schedules are worth validating: without interleaving a
+            // single copy of the body rarely strains the register file
+            return;
+        }
+
+        auto pressurePerIteration = std::max<int64_t>(EstimateKernelRegisterPressure(scheduleOp), 1);
+        auto estimatedRegisters = pressurePerIteration * interleaveProduct;
+        if (printRegisterPressure)
+        {
+            scheduleOp.emitRemark("Register pressure estimate: ")
+                << pressurePerIteration << " live values per iteration x interleave factor " << interleaveProduct
+                << " = " << estimatedRegisters << " vector registers; target '" << targetDevice.deviceName
+                << "' has " << numRegisters;
+        }
+
+        if (numRegisters != 0 && estimatedRegisters > numRegisters)
+        {
+            auto diagnostic = warningsAsErrors ? scheduleOp.emitError() : scheduleOp.emitWarning();
+            diagnostic << "Estimated register pressure (" << pressurePerIteration
+                       << " live values per iteration x interleave factor " << interleaveProduct
+                       << " = " << estimatedRegisters << " vector registers) exceeds the "
+                       << numRegisters << " vector registers of target '" << targetDevice.deviceName
+                       << "'; the largest non-spilling interleave factor is "
+                       << std::max<int64_t>(numRegisters / pressurePerIteration, 1);
+            if (warningsAsErrors)
+            {
+                result = mlir::failure();
+            }
+        }
+    });
+
+    return result;
+}
+
+} // namespace accera::transforms::loopnest
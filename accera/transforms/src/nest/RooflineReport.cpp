@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "nest/RooflineReport.h"
+
+#include <ir/include/nest/LoopNestOps.h>
+#include <ir/include/value/ValueDialect.h>
+#include <value/include/TargetDevice.h>
+
+#include <mlir/Dialect/Arithmetic/IR/Arithmetic.h>
+#include <mlir/IR/BuiltinAttributes.h>
+#include <mlir/IR/BuiltinTypes.h>
+#include <mlir/IR/Operation.h>
+#include <mlir/IR/SymbolTable.h>
+#include <mlir/Interfaces/ViewLikeInterface.h>
+
+#include <llvm/ADT/SmallPtrSet.h>
+
+#include <algorithm>
+
+using namespace mlir;
+
+namespace ln = accera::ir::loopnest;
+namespace vir = accera::ir::value;
+
+namespace
+{
+
+// Floating point work is what the roofline measures; index arithmetic and address computation
+// are free from its point of view
+bool IsFloatArithmeticOp(Operation* op)
+{
+    if (op->getNumResults() != 1 || !op->getResult(0).getType().isa<mlir::FloatType>())
+    {
+        return false;
+    }
+    if (mlir::isa<vir::BinOp>(op))
+    {
+        return true;
+    }
+    if (op->getDialect() && op->getDialect()->getNamespace() == "math")
+    {
+        return true;
+    }
+    return mlir::isa<arith::AddFOp, arith::SubFOp, arith::MulFOp, arith::DivFOp, arith::NegFOp>(op);
+}
+
+// Accumulates the unique footprint of each buffer the kernel touches, resolving views back to
+// their source so a sliced row counts its parent buffer once rather than per slice
+void AccumulateAccessedBufferBytes(Operation* op, llvm::SmallPtrSet<void*, 16>& seenBuffers, double& bytes)
+{
+    for (auto operand : op->getOperands())
+    {
+        if (!operand.getType().isa<mlir::MemRefType>())
+        {
+            continue;
+        }
+
+        auto base = operand;
+        while (auto viewOp = base.getDefiningOp<mlir::ViewLikeOpInterface>())
+        {
+            base = viewOp.getViewSource();
+        }
+        if (!seenBuffers.insert(base.getAsOpaquePointer()).second)
+        {
+            continue;
+        }
+
+        auto memrefType = base.getType().dyn_cast<mlir::MemRefType>();
+        if (!memrefType || !memrefType.hasStaticShape())
+        {
+            continue;
+        }
+        auto elementType = memrefType.getElementType();
+        double elementBytes = elementType.isIntOrFloat() ? elementType.getIntOrFloatBitWidth() / 8.0 : 8.0;
+        bytes += static_cast<double>(memrefType.getNumElements()) * elementBytes;
+    }
+}
+
+} // namespace
+
+namespace accera::transforms::loopnest
+{
+
+RooflineEstimate EmitRooflineReport(mlir::Operation* op,
+                                    const std::string& targetDeviceName,
+                                    bool printRoofline)
+{
+    auto targetDevice = accera::value::GetTargetDevice(targetDeviceName);
+
+    // Peak f32 rate of one FMA pipe at the target's vector width, counting a fused
+    // multiply-add as two flops
+    double vectorBytes = targetDevice.HasFeature("avx512f") ? 64.0 : (targetDevice.HasFeature("avx") ? 32.0 : 16.0);
+    bool hasFusedMultiplyAdd = targetDevice.HasFeature("fma") || targetDevice.HasFeature("neon") || targetDevice.HasFeature("fp-armv8");
+    double f32Lanes = vectorBytes / 4.0;
+
+    RooflineEstimate estimate;
+    estimate.peakFlopsPerCycle = f32Lanes * (hasFusedMultiplyAdd ? 2.0 : 1.0);
+
+    // Sustained per-core load bandwidth in bytes/cycle at each level; generic modern x64
+    // figures, in the same spirit as the schedule cost model's defaults. Only the position of
+    // the resulting percent-of-peak relative to 100% matters.
+    const double l1BytesPerCycle = 2.0 * vectorBytes; // two vector loads per cycle
+    const double l2BytesPerCycle = vectorBytes;
+    const double l3BytesPerCycle = vectorBytes / 2.0;
+    const double dramBytesPerCycle = 8.0;
+
+    llvm::SmallPtrSet<void*, 16> seenBuffers;
+    op->walk([&](ln::ScheduleOp scheduleOp) {
+        auto domain = scheduleOp.getDomain().getValue();
+        double iterations = 1;
+        for (const auto& dimension : domain.GetDimensions())
+        {
+            if (domain.HasConstantDimensionSize(dimension))
+            {
+                iterations *= static_cast<double>(domain.GetDimensionSize(dimension));
+            }
+        }
+
+        for (auto scheduledKernel : scheduleOp.getKernels())
+        {
+            auto symTableOp = mlir::SymbolTable::getNearestSymbolTable(scheduledKernel);
+            auto idAttr = StringAttr::get(scheduledKernel->getContext(), scheduledKernel.getKernel());
+            auto* symbolOp = mlir::SymbolTable::lookupNearestSymbolFrom(symTableOp, idAttr);
+            auto kernelOp = mlir::dyn_cast_or_null<ln::KernelOp>(symbolOp);
+            if (!kernelOp)
+            {
+                continue;
+            }
+
+            double flopsPerIteration = 0;
+            kernelOp->walk([&](Operation* innerOp) {
+                if (IsFloatArithmeticOp(innerOp))
+                {
+                    flopsPerIteration += 1;
+                }
+                AccumulateAccessedBufferBytes(innerOp, seenBuffers, estimate.minBytesMoved);
+            });
+            estimate.flops += iterations * flopsPerIteration;
+        }
+    });
+
+    estimate.arithmeticIntensity = estimate.minBytesMoved > 0 ? estimate.flops / estimate.minBytesMoved : 0;
+    auto percentOfPeakAt = [&](double bytesPerCycle) {
+        return estimate.peakFlopsPerCycle > 0 ? std::min(1.0, estimate.arithmeticIntensity * bytesPerCycle / estimate.peakFlopsPerCycle) : 0.0;
+    };
+    estimate.percentOfPeakL1 = percentOfPeakAt(l1BytesPerCycle);
+    estimate.percentOfPeakL2 = percentOfPeakAt(l2BytesPerCycle);
+    estimate.percentOfPeakL3 = percentOfPeakAt(l3BytesPerCycle);
+    estimate.percentOfPeakDram = percentOfPeakAt(dramBytesPerCycle);
+
+    // Record the estimate on the function so it flows into the emitted package metadata
+    mlir::OpBuilder builder(op->getContext());
+    mlir::NamedAttrList entries;
+    entries.append("flops", builder.getF64FloatAttr(estimate.flops));
+    entries.append("min_bytes_moved", builder.getF64FloatAttr(estimate.minBytesMoved));
+    entries.append("arithmetic_intensity", builder.getF64FloatAttr(estimate.arithmeticIntensity));
+    entries.append("peak_flops_per_cycle", builder.getF64FloatAttr(estimate.peakFlopsPerCycle));
+    entries.append("percent_of_peak_l1", builder.getF64FloatAttr(estimate.percentOfPeakL1));
+    entries.append("percent_of_peak_l2", builder.getF64FloatAttr(estimate.percentOfPeakL2));
+    entries.append("percent_of_peak_l3", builder.getF64FloatAttr(estimate.percentOfPeakL3));
+    entries.append("percent_of_peak_dram", builder.getF64FloatAttr(estimate.percentOfPeakDram));
+    op->setAttr("accera.roofline", entries.getDictionary(op->getContext()));
+
+    if (printRoofline)
+    {
+        op->emitRemark("Roofline estimate: ")
+            << estimate.flops << " flops / " << estimate.minBytesMoved << " bytes minimum = intensity "
+            << estimate.arithmeticIntensity << " flops/byte; peak " << estimate.peakFlopsPerCycle
+            << " flops/cycle on target '" << targetDevice.deviceName
+            << "'; percent of peak from L1 " << 100 * estimate.percentOfPeakL1
+            << "%, L2 " << 100 * estimate.percentOfPeakL2
+            << "%, L3 " << 100 * estimate.percentOfPeakL3
+            << "%, DRAM " << 100 * estimate.percentOfPeakDram << "%";
+    }
+
+    return estimate;
+}
+
+} // namespace accera::transforms::loopnest
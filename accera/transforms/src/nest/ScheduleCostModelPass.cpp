@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AcceraPasses.h"
+#include "nest/ScheduleCostModelPass.h"
+
+#include <ir/include/nest/LoopNestOps.h>
+#include <ir/include/nest/TransformedDomain.h>
+
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/BuiltinAttributes.h>
+#include <mlir/Pass/Pass.h>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace mlir;
+using namespace accera::ir::loopnest;
+using namespace accera::transforms;
+
+namespace
+{
+
+// The element size assumed when converting iteration counts into footprints. The model only ranks
+// schedules relative to each other, so being off by a constant factor for other element types is benign.
+constexpr int64_t assumedElementBytes = 4;
+
+int64_t GetNumIterations(const TransformedDomain& domain, const Index& index)
+{
+    auto range = domain.GetIndexRange(index);
+    return std::max<int64_t>(range.NumIterations(), 1);
+}
+
+} // namespace
+
+namespace accera::transforms::loopnest
+{
+
+ScheduleCostEstimate EstimateScheduleCost(ScheduleOp scheduleOp, const ScheduleCostModelParameters& parameters)
+{
+    ScheduleCostEstimate estimate;
+
+    auto domain = scheduleOp.getDomain().getValue();
+    auto order = scheduleOp.getOrder();
+    if (order.empty() || !scheduleOp.hasConstantRanges())
+    {
+        return estimate;
+    }
+
+    double totalIterations = 1;
+    for (const auto& index : order)
+    {
+        totalIterations *= static_cast<double>(GetNumIterations(domain, index));
+    }
+
+    // Vector efficiency: the fraction of innermost iterations that fill a full vector. A schedule
+    // whose innermost loop is shorter than (or not a multiple of) the vector width wastes lanes.
+    auto innermostIterations = GetNumIterations(domain, order.back());
+    auto vectorLanes = std::max<int64_t>(parameters.vectorWidthBytes / assumedElementBytes, 1);
+    estimate.vectorEfficiencyEstimate =
+        static_cast<double>((innermostIterations / vectorLanes) * vectorLanes) / static_cast<double>(innermostIterations);
+    if (innermostIterations < vectorLanes)
+    {
+        estimate.vectorEfficiencyEstimate = static_cast<double>(innermostIterations) / static_cast<double>(vectorLanes);
+    }
+
+    // Register pressure: unrolled and unroll-and-jammed loops multiply the number of simultaneously
+    // live values in the innermost body.
+    double unrollProduct = 1;
+    for (const auto& index : order)
+    {
+        if (auto jamFactor = scheduleOp.getUnrollAndJamFactor(index))
+        {
+            unrollProduct *= static_cast<double>(*jamFactor);
+        }
+        else if (auto unrollLimit = scheduleOp.getUnrollIfRangeSmallerThan(index))
+        {
+            auto numIterations = GetNumIterations(domain, index);
+            if (numIterations <= static_cast<int64_t>(*unrollLimit))
+            {
+                unrollProduct *= static_cast<double>(numIterations);
+            }
+        }
+    }
+    estimate.registerPressureEstimate = unrollProduct;
+
+    // Cache traffic: walk the loops from the innermost outward, accumulating the iteration footprint
+    // until it no longer fits in cache. Iterations inside that window are assumed to hit; every loop
+    // outside it re-streams the footprint. This deliberately ignores the kernels' actual access
+    // patterns --- it only sees the iteration space --- but it strongly separates cache-blocked
+    // schedules from unblocked ones, which is what candidate pruning needs.
+    double footprintElements = 1;
+    double reuseWindowIterations = 1;
+    auto cacheElements = static_cast<double>(parameters.cacheSizeBytes) / assumedElementBytes;
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        auto numIterations = static_cast<double>(GetNumIterations(domain, *it));
+        if (footprintElements * numIterations > cacheElements)
+        {
+            break;
+        }
+        footprintElements *= numIterations;
+        reuseWindowIterations *= numIterations;
+    }
+    auto elementsPerLine = std::max<int64_t>(parameters.cacheLineBytes / assumedElementBytes, 1);
+    estimate.cacheTrafficEstimate = (totalIterations / reuseWindowIterations) * (footprintElements / elementsPerLine);
+
+    // Combined score: traffic inflated by vector inefficiency and by register spilling once the
+    // unroll product exceeds the register file.
+    double spillPenalty = 1 + std::max(0.0, estimate.registerPressureEstimate - parameters.numVectorRegisters) / parameters.numVectorRegisters;
+    estimate.totalCost = (estimate.cacheTrafficEstimate / std::max(estimate.vectorEfficiencyEstimate, 1e-3)) * spillPenalty;
+
+    return estimate;
+}
+
+} // namespace accera::transforms::loopnest
+
+namespace
+{
+
+struct ScheduleCostModelPass : public ScheduleCostModelBase<ScheduleCostModelPass>
+{
+    void runOnOperation() final
+    {
+        auto op = getOperation();
+        Builder builder(op->getContext());
+        op->walk([&](ScheduleOp scheduleOp) {
+            auto estimate = accera::transforms::loopnest::EstimateScheduleCost(scheduleOp);
+            scheduleOp->setAttr("accln.cost_model",
+                                builder.getDictionaryAttr({
+                                    builder.getNamedAttr("cacheTraffic", builder.getF64FloatAttr(estimate.cacheTrafficEstimate)),
+                                    builder.getNamedAttr("registerPressure", builder.getF64FloatAttr(estimate.registerPressureEstimate)),
+                                    builder.getNamedAttr("vectorEfficiency", builder.getF64FloatAttr(estimate.vectorEfficiencyEstimate)),
+                                    builder.getNamedAttr("totalCost", builder.getF64FloatAttr(estimate.totalCost)),
+                                }));
+        });
+    }
+};
+
+} // namespace
+
+namespace accera::transforms::loopnest
+{
+
+std::unique_ptr<mlir::Pass> createScheduleCostModelPass()
+{
+    return std::make_unique<ScheduleCostModelPass>();
+}
+
+} // namespace accera::transforms::loopnest
@@ -0,0 +1,297 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AcceraPasses.h"
+#include "nest/ScheduleDiff.h"
+
+#include <ir/include/nest/LoopNestOps.h>
+#include <ir/include/nest/TransformedDomain.h>
+
+#include <mlir/IR/BuiltinAttributes.h>
+#include <mlir/IR/SymbolTable.h>
+#include <mlir/Pass/Pass.h>
+
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace mlir;
+using namespace accera::ir::loopnest;
+
+namespace accera::transforms::loopnest
+{
+
+std::string ScheduleDescription::LoopEntry::Summary() const
+{
+    std::stringstream summary;
+    summary << "[" << begin << ", ";
+    if (end < 0)
+    {
+        summary << "?";
+    }
+    else
+    {
+        summary << end;
+    }
+    summary << " : " << increment << ")";
+    if (unrollAndJamFactor)
+    {
+        summary << " unroll_and_jam=" << *unrollAndJamFactor;
+    }
+    if (unrollLimit)
+    {
+        summary << " unroll<" << *unrollLimit;
+    }
+    for (const auto& annotation : annotations)
+    {
+        summary << " {" << annotation << "}";
+    }
+    return summary.str();
+}
+
+ScheduleDescription DescribeSchedule(ScheduleOp scheduleOp)
+{
+    ScheduleDescription description;
+    auto domain = scheduleOp.getDomain().getValue();
+    auto order = scheduleOp.getOrder();
+
+    for (Operation* parent = scheduleOp->getParentOp(); parent; parent = parent->getParentOp())
+    {
+        if (auto symName = parent->getAttrOfType<StringAttr>(mlir::SymbolTable::getSymbolAttrName()))
+        {
+            description.name = symName.getValue().str();
+            break;
+        }
+    }
+
+    auto positionInOrder = [&order](const Index& index) {
+        return std::distance(order.begin(), std::find(order.begin(), order.end(), index));
+    };
+
+    // Name the loops canonically by dimension and split-chain depth: the raw index ids depend on
+    // construction order and differ between sessions, but "the second loop derived from dimension i"
+    // means the same thing in both schedules being compared
+    std::map<Index, std::string> canonicalNames;
+    for (const auto& dimension : domain.GetDimensions())
+    {
+        auto loopIndices = domain.GetLoopIndicesForDimension(dimension);
+        std::sort(loopIndices.begin(), loopIndices.end(), [&](const Index& a, const Index& b) {
+            return positionInOrder(a) < positionInOrder(b);
+        });
+        std::vector<std::string> chain;
+        for (const auto& loopIndex : loopIndices)
+        {
+            auto canonicalName = dimension.GetName() + "." + std::to_string(chain.size());
+            canonicalNames[loopIndex] = canonicalName;
+            chain.push_back(canonicalName);
+        }
+        description.indexTrees[dimension.GetName()] = chain;
+    }
+
+    description.totalIterations = 1;
+    for (const auto& index : order)
+    {
+        ScheduleDescription::LoopEntry entry;
+        auto nameIt = canonicalNames.find(index);
+        entry.name = nameIt != canonicalNames.end() ? nameIt->second : index.GetName();
+        entry.dimension = domain.GetBaseIndex(index).GetName();
+
+        auto range = domain.GetIndexRange(index);
+        entry.begin = range.Begin();
+        entry.increment = range.Increment();
+        if (range.HasConstantEnd())
+        {
+            entry.end = range.End();
+            description.totalIterations *= static_cast<double>(std::max<int64_t>(range.NumIterations(), 1));
+        }
+
+        entry.unrollLimit = scheduleOp.getUnrollIfRangeSmallerThan(index);
+        entry.unrollAndJamFactor = scheduleOp.getUnrollAndJamFactor(index);
+
+        if (auto loopAttrs = scheduleOp.getLoopAttributes(index))
+        {
+            for (auto& namedAttr : *loopAttrs)
+            {
+                std::string printed;
+                llvm::raw_string_ostream attrStream(printed);
+                attrStream << namedAttr.getName().getValue() << " = " << namedAttr.getValue();
+                entry.annotations.push_back(attrStream.str());
+            }
+            std::sort(entry.annotations.begin(), entry.annotations.end());
+        }
+
+        description.loops.push_back(entry);
+    }
+
+    return description;
+}
+
+void PrintScheduleDescription(const ScheduleDescription& description, llvm::raw_ostream& os)
+{
+    os << "schedule";
+    if (!description.name.empty())
+    {
+        os << " @" << description.name;
+    }
+    os << " (" << description.totalIterations << " iterations)\n";
+
+    for (const auto& [dimension, chain] : description.indexTrees)
+    {
+        os << "  dimension " << dimension << ": ";
+        llvm::interleave(chain, os, " -> ");
+        os << "\n";
+    }
+
+    os << "  order:\n";
+    for (const auto& loop : description.loops)
+    {
+        os << "    " << loop.name << " " << loop.Summary() << "\n";
+    }
+}
+
+bool DiffSchedules(const ScheduleDescription& before, const ScheduleDescription& after, llvm::raw_ostream& os)
+{
+    bool different = false;
+
+    auto loopsByName = [](const ScheduleDescription& description) {
+        std::map<std::string, const ScheduleDescription::LoopEntry*> result;
+        for (const auto& loop : description.loops)
+        {
+            result[loop.name] = &loop;
+        }
+        return result;
+    };
+    auto beforeLoops = loopsByName(before);
+    auto afterLoops = loopsByName(after);
+
+    // Split structure per dimension
+    for (const auto& [dimension, beforeChain] : before.indexTrees)
+    {
+        auto it = after.indexTrees.find(dimension);
+        if (it == after.indexTrees.end())
+        {
+            os << "- dimension " << dimension << " only in first schedule\n";
+            different = true;
+        }
+        else if (beforeChain.size() != it->second.size())
+        {
+            os << "~ dimension " << dimension << ": " << (beforeChain.size() - 1) << " split(s) -> " << (it->second.size() - 1) << " split(s)\n";
+            different = true;
+        }
+    }
+    for (const auto& [dimension, chain] : after.indexTrees)
+    {
+        (void)chain;
+        if (before.indexTrees.find(dimension) == before.indexTrees.end())
+        {
+            os << "+ dimension " << dimension << " only in second schedule\n";
+            different = true;
+        }
+    }
+
+    // Loops added, removed, or changed (range, step, unrolls, exec annotations)
+    for (const auto& loop : before.loops)
+    {
+        auto it = afterLoops.find(loop.name);
+        if (it == afterLoops.end())
+        {
+            os << "- loop " << loop.name << " " << loop.Summary() << "\n";
+            different = true;
+        }
+        else if (loop.Summary() != it->second->Summary())
+        {
+            os << "~ loop " << loop.name << ": " << loop.Summary() << "  ->  " << it->second->Summary() << "\n";
+            different = true;
+        }
+    }
+    for (const auto& loop : after.loops)
+    {
+        if (beforeLoops.find(loop.name) == beforeLoops.end())
+        {
+            os << "+ loop " << loop.name << " " << loop.Summary() << "\n";
+            different = true;
+        }
+    }
+
+    // Relative order of the loops common to both schedules
+    std::vector<std::string> beforeOrder;
+    std::vector<std::string> afterOrder;
+    for (const auto& loop : before.loops)
+    {
+        if (afterLoops.find(loop.name) != afterLoops.end())
+        {
+            beforeOrder.push_back(loop.name);
+        }
+    }
+    for (const auto& loop : after.loops)
+    {
+        if (beforeLoops.find(loop.name) != beforeLoops.end())
+        {
+            afterOrder.push_back(loop.name);
+        }
+    }
+    if (beforeOrder != afterOrder)
+    {
+        os << "~ order: ";
+        llvm::interleave(beforeOrder, os, ", ");
+        os << "  ->  ";
+        llvm::interleave(afterOrder, os, ", ");
+        os << "\n";
+        different = true;
+    }
+
+    if (before.totalIterations != after.totalIterations)
+    {
+        os << "~ total iterations: " << before.totalIterations << " -> " << after.totalIterations << "\n";
+        different = true;
+    }
+
+    return different;
+}
+
+} // namespace accera::transforms::loopnest
+
+namespace
+{
+
+struct ScheduleDiffPass : public ScheduleDiffBase<ScheduleDiffPass>
+{
+    void runOnOperation() final
+    {
+        std::vector<accera::transforms::loopnest::ScheduleDescription> descriptions;
+        getOperation()->walk([&](ScheduleOp scheduleOp) {
+            descriptions.push_back(accera::transforms::loopnest::DescribeSchedule(scheduleOp));
+        });
+
+        auto& os = llvm::errs();
+        for (const auto& description : descriptions)
+        {
+            accera::transforms::loopnest::PrintScheduleDescription(description, os);
+        }
+        if (descriptions.size() == 2)
+        {
+            os << "schedule diff:\n";
+            if (!accera::transforms::loopnest::DiffSchedules(descriptions[0], descriptions[1], os))
+            {
+                os << "  (no semantic differences)\n";
+            }
+        }
+    }
+};
+
+} // namespace
+
+namespace accera::transforms::loopnest
+{
+
+std::unique_ptr<mlir::Pass> createScheduleDiffPass()
+{
+    return std::make_unique<ScheduleDiffPass>();
+}
+
+} // namespace accera::transforms::loopnest
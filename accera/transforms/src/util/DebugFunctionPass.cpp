@@ -5,16 +5,22 @@
 
 #include "AcceraPasses.h"
 
+#include <ir/include/exec/ExecutionPlanAttributes.h>
 #include <ir/include/nest/LoopNestOps.h>
 #include <ir/include/value/ValueFuncOp.h>
 #include <value/include/Debugging.h>
 
 #include <llvm/ADT/TypeSwitch.h>
+#include <mlir/Dialect/Arithmetic/IR/Arithmetic.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+#include <mlir/Dialect/SCF/SCF.h>
 #include <mlir/IR/Builders.h>
 #include <mlir/IR/BuiltinTypes.h>
 #include <mlir/IR/MLIRContext.h>
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
 
+#include <algorithm>
+
 using namespace mlir;
 namespace ir = accera::ir;
 
@@ -89,6 +95,39 @@ void MapArguments(PatternRewriter& rewriter, ir::value::ValueFuncOp& targetFnOp,
     });
 }
 
+// Reference schedules exist only to produce values for comparison, so spread the outermost loop
+// across threads the same way Plan::Parallelize tags a user schedule; the standard lowering then
+// gives the reference path a parallel region instead of a serial nest. This keeps the overhead of
+// running the naive computation tolerable for large outputs.
+void ParallelizeReferenceSchedule(PatternRewriter& rewriter, ir::loopnest::NestOp& nestOp, ir::loopnest::ScheduleOp& scheduleOp)
+{
+    // Cap the thread count: the reference path is naive, typically bandwidth-bound code and stops
+    // scaling well before the core counts a tuned schedule might use
+    constexpr int64_t kMaxReferenceThreads = 16;
+
+    auto order = scheduleOp.getOrder();
+    if (order.empty())
+    {
+        return;
+    }
+
+    auto domain = nestOp.getDomain().getValue();
+    auto range = domain.GetDimensionRange(order.front());
+    auto numIterations = static_cast<int64_t>(range.Size() / std::max(1, range.Increment()));
+    auto numThreads = std::min(numIterations, kMaxReferenceThreads);
+    if (numThreads <= 1)
+    {
+        return;
+    }
+
+    ir::executionPlan::ParallelizationInfo parallelizationInfo;
+    parallelizationInfo.numThreads = numThreads;
+    parallelizationInfo.policy = ir::executionPlan::ParallelizationInfo::StaticPolicy;
+    auto parallelizationInfoIdentifier = rewriter.getStringAttr(ir::executionPlan::ParallelizationInfoAttr::getKeyName());
+    auto parallelizationInfoAttr = ir::executionPlan::ParallelizationInfoAttr::get(parallelizationInfo, rewriter.getContext());
+    scheduleOp.addLoopAttribute(order.front(), parallelizationInfoIdentifier, parallelizationInfoAttr);
+}
+
 void CreateReferenceSchedules(PatternRewriter& rewriter, ir::loopnest::ScheduleOp& scheduleOp, BlockAndValueMapping& valueMap)
 {
     auto targetNestOp = scheduleOp.getNest();
@@ -134,6 +173,7 @@ void CreateReferenceSchedules(PatternRewriter& rewriter, ir::loopnest::ScheduleO
             // Create the schedule and add the kernels (after the symbolic indices have been inserted into the IR)
             auto defaultSchedule = nest.getOrCreateSchedule();
             defaultSchedule.addKernel(kernel);
+            ParallelizeReferenceSchedule(rewriter, nest, defaultSchedule);
         }
     }
     else
@@ -165,6 +205,7 @@ void CreateReferenceSchedules(PatternRewriter& rewriter, ir::loopnest::ScheduleO
         {
             defaultSchedule.addKernel(kernel);
         }
+        ParallelizeReferenceSchedule(rewriter, nest, defaultSchedule);
     }
 }
 
@@ -255,6 +296,65 @@ std::vector<mlir::Value> GetTargetFunctionArgs(PatternRewriter& rewriter, Locati
     return result;
 }
 
+// Builds a dispatcher with the target function's signature that verifies every Nth call: a global
+// counter is incremented on entry, and only invocations where the previous count is a multiple of
+// the sampling interval take the checked path through the debug wrapper. The rest call the target
+// function directly and pay no verification cost, so debug packages with a sampling interval can
+// stay deployed in environments where verifying every call would be too slow.
+ir::value::ValueFuncOp CreateSamplingDispatchFunction(PatternRewriter& rewriter, Location loc, ir::value::ValueModuleOp& moduleOp, ir::value::ValueFuncOp& targetFnOp, ir::value::ValueFuncOp& dbgFnOp, const std::string& dbgFnName, int64_t sampleInterval)
+{
+    OpBuilder::InsertionGuard guard(rewriter);
+
+    auto funcInsertPt = ir::util::GetTerminalInsertPoint<ir::value::ValueModuleOp,
+                                                         ir::value::ModuleTerminatorOp>(moduleOp);
+    rewriter.restoreInsertionPoint(funcInsertPt);
+
+    auto argTypes = targetFnOp.getType().getInputs().vec();
+    auto callingFnType = rewriter.getFunctionType(argTypes, targetFnOp.getType().getResults());
+    auto dispatchFnOp = rewriter.create<ir::value::ValueFuncOp>(loc, dbgFnName + "_dispatch", callingFnType, targetFnOp.exec_target());
+
+    rewriter.setInsertionPointToStart(&dispatchFnOp.body().front());
+
+    // Per-function invocation counter (zero-initialized global)
+    auto counterType = mlir::MemRefType::get({ 1 }, rewriter.getI64Type());
+    auto counterName = moduleOp.getName().str() + "_" + dbgFnName + "_invocation_counter";
+    auto counter = ir::util::CreateGlobalBuffer(rewriter, dispatchFnOp, counterType, counterName);
+
+    // Replace the global-scoped ReferenceGlobalOp with one within the function context
+    auto globalScopeGlobalRef = mlir::dyn_cast_or_null<ir::value::ReferenceGlobalOp>(counter.getDefiningOp());
+    auto counterRef = rewriter.create<ir::value::ReferenceGlobalOp>(loc, globalScopeGlobalRef.getGlobal());
+    rewriter.eraseOp(globalScopeGlobalRef);
+
+    auto zeroIndex = rewriter.create<arith::ConstantIndexOp>(loc, 0);
+    auto count = rewriter.create<memref::LoadOp>(loc, counterRef, mlir::ValueRange{ zeroIndex.getResult() });
+    auto one = rewriter.create<arith::ConstantIntOp>(loc, 1, 64);
+    auto nextCount = rewriter.create<arith::AddIOp>(loc, count, one);
+    rewriter.create<memref::StoreOp>(loc, nextCount, counterRef, mlir::ValueRange{ zeroIndex.getResult() });
+
+    auto interval = rewriter.create<arith::ConstantIntOp>(loc, sampleInterval, 64);
+    auto remainder = rewriter.create<arith::RemSIOp>(loc, count, interval);
+    auto zero = rewriter.create<arith::ConstantIntOp>(loc, 0, 64);
+    auto isSampled = rewriter.create<arith::CmpIOp>(loc, arith::CmpIPredicate::eq, remainder, zero);
+
+    auto args = dispatchFnOp.getArguments();
+    std::vector<mlir::Value> callArgs(args.begin(), args.end());
+    rewriter.create<mlir::scf::IfOp>(
+        loc,
+        isSampled,
+        [&](mlir::OpBuilder& builder, mlir::Location loc) {
+            builder.create<ir::value::LaunchFuncOp>(loc, dbgFnOp, callArgs);
+            builder.create<mlir::scf::YieldOp>(loc);
+        },
+        [&](mlir::OpBuilder& builder, mlir::Location loc) {
+            builder.create<ir::value::LaunchFuncOp>(loc, targetFnOp, callArgs);
+            builder.create<mlir::scf::YieldOp>(loc);
+        });
+
+    rewriter.create<ir::value::ReturnOp>(loc);
+
+    return dispatchFnOp;
+}
+
 LogicalResult EmitNestDebugFunction(ir::value::ValueFuncOp& targetFnOp, PatternRewriter& rewriter)
 {
     // Find the ScheduleOp
@@ -262,6 +362,7 @@ LogicalResult EmitNestDebugFunction(ir::value::ValueFuncOp& targetFnOp, PatternR
     if (!scheduleOp)
     {
         targetFnOp->removeAttr(ir::GetOutputVerifiersAttrName());
+        targetFnOp->removeAttr(ir::GetDebugSampleIntervalAttrName());
         return failure(); // no match
     }
 
@@ -365,8 +466,17 @@ LogicalResult EmitNestDebugFunction(ir::value::ValueFuncOp& targetFnOp, PatternR
 
     if (targetLaunchFnOp)
     {
+        // When a sampling interval is set, route the launcher through a dispatcher that only
+        // verifies every Nth invocation; otherwise every call goes through the debug wrapper
+        int64_t sampleInterval = 1;
+        if (auto sampleIntervalAttr = targetFnOp->getAttrOfType<IntegerAttr>(ir::GetDebugSampleIntervalAttrName()))
+        {
+            sampleInterval = sampleIntervalAttr.getInt();
+        }
+        auto apiFnOp = sampleInterval > 1 ? CreateSamplingDispatchFunction(rewriter, loc, moduleOp, targetFnOp, dbgFnOp, dbgFnName, sampleInterval) : dbgFnOp;
+
         // Replace the original launcher with one that calls the debug wrapper function
-        auto newLaunchFnOp = ir::value::CreateRawPointerAPIWrapperFunction(rewriter, dbgFnOp, targetLaunchFnOp.sym_name());
+        auto newLaunchFnOp = ir::value::CreateRawPointerAPIWrapperFunction(rewriter, apiFnOp, targetLaunchFnOp.sym_name());
 
         // Propagate the base name so that aliases can be created
         if (auto baseName = targetLaunchFnOp->getAttrOfType<mlir::StringAttr>(ir::BaseNameAttrName))
@@ -377,6 +487,7 @@ LogicalResult EmitNestDebugFunction(ir::value::ValueFuncOp& targetFnOp, PatternR
     }
 
     targetFnOp->removeAttr(ir::GetOutputVerifiersAttrName());
+    targetFnOp->removeAttr(ir::GetDebugSampleIntervalAttrName());
 
     return success();
 }
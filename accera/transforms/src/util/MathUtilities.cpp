@@ -27,11 +27,46 @@ mlir::Value SaturateValue(mlir::PatternRewriter& rewriter, mlir::Value value, in
         minConst = rewriter.create<mlir::SplatOp>(loc, minConst, vectorType);
         maxConst = rewriter.create<mlir::SplatOp>(loc, maxConst, vectorType);
     }
-    auto maxCmp = rewriter.create<mlir::arith::CmpIOp>(loc, mlir::arith::CmpIPredicate::sgt, value, minConst);
-    auto temp = rewriter.create<mlir::SelectOp>(loc, maxCmp, value, minConst);
-    auto minCmp = rewriter.create<mlir::arith::CmpIOp>(loc, mlir::arith::CmpIPredicate::slt, temp, maxConst);
-    auto result = rewriter.create<mlir::SelectOp>(loc, minCmp, temp, maxConst);
+    // Emit the clamp as maxsi/minsi rather than cmp+select: one op per bound survives
+    // vectorization intact, and LLVM's backends fold min/max clamps around the feeding
+    // arithmetic into the native saturating instructions (vpaddsw, sqadd, ...)
+    auto lowerBounded = rewriter.create<mlir::arith::MaxSIOp>(loc, value, minConst);
+    auto result = rewriter.create<mlir::arith::MinSIOp>(loc, lowerBounded, maxConst);
 
     return result;
 }
+
+mlir::Value SaturatedAdd(mlir::PatternRewriter& rewriter, mlir::Value lhs, mlir::Value rhs, int64_t bitWidth, bool isSigned)
+{
+    auto loc = lhs.getLoc();
+    auto sum = rewriter.create<mlir::arith::AddIOp>(loc, lhs, rhs);
+    return SaturateValue(rewriter, sum, bitWidth, isSigned);
+}
+
+mlir::Value SaturatedSub(mlir::PatternRewriter& rewriter, mlir::Value lhs, mlir::Value rhs, int64_t bitWidth, bool isSigned)
+{
+    auto loc = lhs.getLoc();
+    auto difference = rewriter.create<mlir::arith::SubIOp>(loc, lhs, rhs);
+    return SaturateValue(rewriter, difference, bitWidth, isSigned);
+}
+
+mlir::Value SaturatedMulShift(mlir::PatternRewriter& rewriter, mlir::Value lhs, mlir::Value rhs, int64_t fractionalBits, int64_t bitWidth, bool isSigned)
+{
+    auto loc = lhs.getLoc();
+    auto resultType = lhs.getType();
+    auto resultBits = resultType.isa<mlir::VectorType>() ? resultType.cast<mlir::VectorType>().getElementType().getIntOrFloatBitWidth() : resultType.getIntOrFloatBitWidth();
+
+    mlir::Value shiftConst = rewriter.create<mlir::arith::ConstantIntOp>(loc, fractionalBits, resultBits);
+    if (auto vectorType = resultType.dyn_cast<mlir::VectorType>())
+    {
+        shiftConst = rewriter.create<mlir::SplatOp>(loc, shiftConst, vectorType);
+    }
+
+    // Q-format multiply: the full-width product keeps fractionalBits extra fractional bits,
+    // so shift them back out before saturating to the storage width (the sqdmulh / vpmulhrsw
+    // shape, minus their rounding term)
+    auto product = rewriter.create<mlir::arith::MulIOp>(loc, lhs, rhs);
+    auto shifted = rewriter.create<mlir::arith::ShRSIOp>(loc, product, shiftConst);
+    return SaturateValue(rewriter, shifted, bitWidth, isSigned);
+}
 } // namespace accera::transforms
@@ -0,0 +1,260 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AcceraPasses.h"
+
+#include "util/PassStatisticsPass.h"
+
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/Pass/Pass.h>
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif // defined(_WIN32)
+
+using namespace mlir;
+
+namespace v = accera::ir::value;
+
+namespace
+{
+
+// The process's high-water resident set: the number capacity planning needs, since a build box
+// has to fit the worst moment of the pipeline, not the current one
+uint64_t GetPeakRSSBytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS info;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info)))
+    {
+        return static_cast<uint64_t>(info.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined(__APPLE__)
+        return static_cast<uint64_t>(usage.ru_maxrss); // bytes on macOS
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024; // kilobytes elsewhere
+#endif // defined(__APPLE__)
+    }
+    return 0;
+#endif // defined(_WIN32)
+}
+
+// Accumulates checkpoint rows for the whole process so that wall-time deltas span the passes that
+// ran between consecutive checkpoints, and so cumulative totals can be aggregated across the many
+// checkpoint pass instances interleaved through the pipeline.
+class PassStatisticsRecorder
+{
+public:
+    static PassStatisticsRecorder& GetInstance()
+    {
+        static PassStatisticsRecorder instance;
+        return instance;
+    }
+
+    // Returns an empty string, or a diagnostic when the memory budget was exceeded
+    std::string RecordCheckpoint(const std::string& stageName,
+                                 const std::string& reportFilename,
+                                 bool cumulative,
+                                 int64_t memoryBudgetMB,
+                                 bool reportRows,
+                                 size_t opCount,
+                                 size_t attrCount,
+                                 const std::vector<std::pair<std::string, size_t>>& functionOpCounts)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto now = std::chrono::steady_clock::now();
+        auto wallMs = std::chrono::duration<double, std::milli>(now - _lastCheckpointTime).count();
+        auto mallocBytes = llvm::sys::Process::GetMallocUsage();
+        auto peakRSSBytes = GetPeakRSSBytes();
+        _reportFilename = reportFilename;
+
+        if (reportRows)
+        {
+            std::string row;
+            llvm::raw_string_ostream rowOs(row);
+            rowOs << "{\"checkpoint\":\"" << stageName << "\""
+                  << ",\"wall_ms\":" << llvm::format("%.3f", wallMs)
+                  << ",\"ops_before\":" << _lastOpCount
+                  << ",\"ops_after\":" << opCount
+                  << ",\"attrs_after\":" << attrCount
+                  << ",\"malloc_bytes\":" << mallocBytes
+                  << ",\"peak_rss_bytes\":" << peakRSSBytes
+                  << ",\"functions\":{";
+            bool first = true;
+            for (const auto& [functionName, functionOpCount] : functionOpCounts)
+            {
+                rowOs << (first ? "" : ",") << "\"" << functionName << "\":" << functionOpCount;
+                first = false;
+            }
+            rowOs << "}}\n";
+            WriteReport(rowOs.str());
+        }
+
+        if (cumulative)
+        {
+            _emitCumulativeSummary = true;
+            auto& totals = _cumulativeTotals[stageName];
+            totals.wallMs += wallMs;
+            totals.opDelta += static_cast<int64_t>(opCount) - static_cast<int64_t>(_lastOpCount);
+            totals.checkpoints++;
+        }
+
+        _lastCheckpointTime = now;
+        _lastOpCount = opCount;
+
+        if (memoryBudgetMB > 0 && peakRSSBytes > static_cast<uint64_t>(memoryBudgetMB) * 1024 * 1024)
+        {
+            std::string message;
+            llvm::raw_string_ostream messageOs(message);
+            messageOs << "memory budget exceeded after '" << stageName << "': peak RSS "
+                      << (peakRSSBytes >> 20) << " MB > budget " << memoryBudgetMB << " MB";
+            auto largest = std::max_element(functionOpCounts.begin(), functionOpCounts.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
+            if (largest != functionOpCounts.end())
+            {
+                messageOs << "; largest function '" << largest->first << "' with " << largest->second << " ops";
+            }
+            return messageOs.str();
+        }
+        return {};
+    }
+
+    ~PassStatisticsRecorder()
+    {
+        if (_emitCumulativeSummary)
+        {
+            for (const auto& [stageName, totals] : _cumulativeTotals)
+            {
+                std::string row;
+                llvm::raw_string_ostream rowOs(row);
+                rowOs << "{\"cumulative\":\"" << stageName << "\""
+                      << ",\"wall_ms\":" << llvm::format("%.3f", totals.wallMs)
+                      << ",\"op_delta\":" << totals.opDelta
+                      << ",\"checkpoints\":" << totals.checkpoints << "}\n";
+                WriteReport(rowOs.str());
+            }
+        }
+    }
+
+private:
+    struct CumulativeTotals
+    {
+        double wallMs = 0.0;
+        int64_t opDelta = 0;
+        size_t checkpoints = 0;
+    };
+
+    void WriteReport(const std::string& contents)
+    {
+        if (_reportFilename.empty())
+        {
+            llvm::errs() << contents;
+            return;
+        }
+        std::error_code ec;
+        llvm::raw_fd_ostream fileStream(_reportFilename, ec, llvm::sys::fs::OF_Append);
+        if (!ec)
+        {
+            fileStream << contents;
+        }
+    }
+
+    std::mutex _mutex;
+    std::chrono::steady_clock::time_point _lastCheckpointTime = std::chrono::steady_clock::now();
+    size_t _lastOpCount = 0;
+    std::string _reportFilename;
+    std::map<std::string, CumulativeTotals> _cumulativeTotals;
+    bool _emitCumulativeSummary = false;
+};
+
+struct PassStatisticsPass : public accera::transforms::PassStatisticsBase<PassStatisticsPass>
+{
+    PassStatisticsPass() = default;
+    PassStatisticsPass(const accera::transforms::PassStatisticsOptions& options)
+    {
+        stageName = options.stageName;
+        reportFilename = options.reportFilename;
+        cumulative = options.cumulative;
+        memoryBudgetMB = options.memoryBudgetMB;
+        reportRows = options.reportRows;
+    }
+
+    void runOnOperation() final
+    {
+        auto op = getOperation();
+
+        size_t opCount = 0;
+        size_t attrCount = 0;
+        op->walk([&](Operation* walkedOp) {
+            ++opCount;
+            attrCount += walkedOp->getAttrs().size();
+        });
+
+        // Break the total down per function so a regression in one function of a multi-function
+        // package is attributable; the wall-time column stays at checkpoint granularity
+        std::vector<std::pair<std::string, size_t>> functionOpCounts;
+        auto countFunctionOps = [&](Operation* functionOp, llvm::StringRef functionName) {
+            size_t functionOpCount = 0;
+            functionOp->walk([&](Operation*) { ++functionOpCount; });
+            functionOpCounts.emplace_back(functionName.str(), functionOpCount);
+        };
+        op->walk([&](Operation* nestedOp) {
+            if (auto funcOp = dyn_cast<FuncOp>(nestedOp))
+            {
+                countFunctionOps(funcOp, funcOp.getName());
+            }
+            else if (auto vFuncOp = dyn_cast<v::ValueFuncOp>(nestedOp))
+            {
+                countFunctionOps(vFuncOp, vFuncOp.sym_name());
+            }
+        });
+
+        auto budgetError = PassStatisticsRecorder::GetInstance().RecordCheckpoint(stageName, reportFilename, cumulative, memoryBudgetMB, reportRows, opCount, attrCount, functionOpCounts);
+        if (!budgetError.empty())
+        {
+            op->emitError(budgetError);
+            signalPassFailure();
+        }
+    }
+};
+
+} // namespace
+
+namespace accera::transforms
+{
+
+std::unique_ptr<mlir::Pass> createPassStatisticsPass()
+{
+    return std::make_unique<PassStatisticsPass>();
+}
+
+std::unique_ptr<mlir::Pass> createPassStatisticsPass(const PassStatisticsOptions& options)
+{
+    return std::make_unique<PassStatisticsPass>(options);
+}
+
+} // namespace accera::transforms
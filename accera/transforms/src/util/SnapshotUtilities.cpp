@@ -9,15 +9,108 @@
 #include <mlir/Transforms/LocationSnapshot.h>
 
 #include <llvm/Support/FormatVariadic.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
 
 namespace accera::transforms
 {
 static std::atomic<size_t> _nextPipeIdx = 0;
 
+namespace
+{
+    // Writes snapshot files from a background thread so the pass pipeline doesn't stall on disk.
+    // The queue is bounded so a slow filesystem applies backpressure rather than accumulating an
+    // unbounded number of serialized modules in memory.
+    class AsyncSnapshotWriter
+    {
+    public:
+        static AsyncSnapshotWriter& GetInstance()
+        {
+            static AsyncSnapshotWriter instance;
+            return instance;
+        }
+
+        void Write(std::string filename, std::string contents)
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _queueNotFull.wait(lock, [this] { return _queue.size() < MaxPendingWrites; });
+                _queue.emplace_back(std::move(filename), std::move(contents));
+            }
+            _queueNotEmpty.notify_one();
+        }
+
+        ~AsyncSnapshotWriter()
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _done = true;
+            }
+            _queueNotEmpty.notify_one();
+            _worker.join();
+        }
+
+    private:
+        AsyncSnapshotWriter() :
+            _worker([this] { WorkerLoop(); })
+        {}
+
+        void WorkerLoop()
+        {
+            while (true)
+            {
+                std::pair<std::string, std::string> entry;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _queueNotEmpty.wait(lock, [this] { return _done || !_queue.empty(); });
+                    if (_queue.empty())
+                    {
+                        return;
+                    }
+                    entry = std::move(_queue.front());
+                    _queue.pop_front();
+                }
+                _queueNotFull.notify_one();
+
+                std::error_code ec;
+                llvm::raw_fd_ostream fileStream(entry.first, ec);
+                if (!ec)
+                {
+                    fileStream << entry.second;
+                }
+            }
+        }
+
+        static constexpr size_t MaxPendingWrites = 64;
+
+        std::mutex _mutex;
+        std::condition_variable _queueNotEmpty;
+        std::condition_variable _queueNotFull;
+        std::deque<std::pair<std::string, std::string>> _queue;
+        bool _done = false;
+        std::thread _worker;
+    };
+} // namespace
+
 void IRSnapshot(const std::string& filename, mlir::Operation* op, const std::string& fileExtension)
 {
     auto fullFileNameStr = filename + fileExtension;
-    (void)generateLocationsFromIR(fullFileNameStr, op, mlir::OpPrintingFlags{});
+    // Serialize on the calling thread so the location remapping observes the IR exactly as it is at
+    // the snapshot point, then hand the formatted text to the background writer
+    std::string contents;
+    llvm::raw_string_ostream os(contents);
+    if (failed(mlir::generateLocationsFromIR(os, fullFileNameStr, op, mlir::OpPrintingFlags{})))
+    {
+        return;
+    }
+    os.flush();
+    AsyncSnapshotWriter::GetInstance().Write(std::move(fullFileNameStr), std::move(contents));
 }
 
 IRSnapshotter::IRSnapshotter(const IRSnapshotter& other)
@@ -39,6 +132,12 @@ void IRSnapshotter::Snapshot(const std::string& nameSuffix, mlir::Operation* op)
 
 IRSnapshotter IRSnapshotter::MakeSnapshotPipe()
 {
+    if (!_options.EnableIntraPassSnapshots)
+    {
+        // Disabled pipes are checked once here rather than paying for name construction on every
+        // snapshot point in the pipeline
+        return IRSnapshotter(IntraPassSnapshotOptions{});
+    }
     size_t pipeIdx = _nextPipeIdx++;
     auto combinedNamePrefix = llvm::formatv("{0}_{1}", _options.FileNamePrefix, pipeIdx);
     auto combinedNamePrefixStr = combinedNamePrefix.str();
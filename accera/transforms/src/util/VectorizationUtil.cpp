@@ -23,6 +23,7 @@
 #include <mlir/Dialect/Vector/Utils/VectorUtils.h>
 
 #include <llvm/ADT/TypeSwitch.h>
+#include <llvm/Support/MathExtras.h>
 
 #include <algorithm>
 #include <map>
@@ -113,6 +114,8 @@ bool CanVectorizeOp(mlir::Operation* op,
             .Case([](mlir::arith::ShLIOp) { return true; })
             .Case([](mlir::arith::FPToSIOp) { return true; })
             .Case([](mlir::arith::ExtSIOp) { return true; })
+            .Case([](mlir::arith::ExtFOp) { return true; })
+            .Case([](mlir::arith::TruncFOp) { return true; })
             .Case([](mlir::math::AbsOp) { return true; })
             // .Case([&](mlir::AffineApplyOp) { return true; }) // TODO: either enable or remove this
             .Case([](mlir::math::ExpOp) { return true; })
@@ -256,13 +259,18 @@ std::optional<mlir::Operation*> VectorizeConstantOp(mlir::PatternRewriter& rewri
     return constVec;
 }
 
+// Returns the constant element stride between the memory locations touched by consecutive
+// unrolled lanes of the given access op, or nullopt when the lane-to-lane difference isn't a
+// single compile-time constant. A stride of 1 is the contiguous case; small constant strides
+// (interleaved complex, xyxy coordinates, NHWC with small C) are handled with wide loads plus
+// deinterleaving shuffles below
 template <typename OpType>
-bool IsUnrolledAccessSequential(mlir::PatternRewriter& rewriter,
-                                OpType op,
-                                std::vector<mlir::BlockAndValueMapping>& laneMappings,
-                                int64_t vectorSize)
+std::optional<int64_t> GetUnrolledAccessConstantStride(mlir::PatternRewriter& rewriter,
+                                                       OpType op,
+                                                       std::vector<mlir::BlockAndValueMapping>& laneMappings,
+                                                       int64_t vectorSize)
 {
-    // Create some unrolled clones in-memory and see whether they are accessing memory-sequential elements in the MemRef
+    // Create some unrolled clones in-memory and compare the memory locations they access in the MemRef
     auto loc = op.getLoc();
     std::vector<OpType> temporaryClones;
     temporaryClones.reserve(vectorSize);
@@ -271,10 +279,10 @@ bool IsUnrolledAccessSequential(mlir::PatternRewriter& rewriter,
         temporaryClones.push_back(mlir::dyn_cast<OpType>(rewriter.clone(*op.getOperation(), laneMappings[i])));
     }
 
-    // Check if the temporary clones are all accessing sequential memory
+    // Check if the temporary clones are all accessing constantly-strided memory
     auto accessMapComposition = ir::util::GetIndexToMemoryLocationMap(rewriter.getContext(), op);
 
-    bool sequential = true;
+    std::optional<int64_t> stride;
     for (int64_t unrollIdx = 1; unrollIdx < vectorSize; ++unrollIdx)
     {
         std::vector<mlir::Value> prevIndicesVec(temporaryClones[unrollIdx - 1].indices().begin(), temporaryClones[unrollIdx - 1].indices().end());
@@ -292,15 +300,17 @@ bool IsUnrolledAccessSequential(mlir::PatternRewriter& rewriter,
 
         assert(diffMap.getNumResults() == 1);
         auto resultExpr = diffMap.getResult(0);
-        if (resultExpr.isa<mlir::AffineConstantExpr>())
+        if (auto constExpr = resultExpr.dyn_cast<mlir::AffineConstantExpr>())
         {
-            auto constExpr = resultExpr.dyn_cast<mlir::AffineConstantExpr>();
-            if (constExpr.getValue() != 1)
+            if (!stride.has_value())
             {
-                // There is a constant difference between sequential op memory accesses
-                // but the stride is not 1, so the memory isn't contiguous and therefore
-                // it's not safe to replace all of the memory ops with a single vector op
-                sequential = false;
+                stride = constExpr.getValue();
+            }
+            else if (*stride != constExpr.getValue())
+            {
+                // The lane-to-lane differences are constant but not all the same, so the
+                // accesses don't form a single strided pattern
+                stride = std::nullopt;
                 break;
             }
         }
@@ -309,7 +319,7 @@ bool IsUnrolledAccessSequential(mlir::PatternRewriter& rewriter,
             // There isn't a constant difference between sequential op memory accesses
             // so it's not necessarily safe to convert all of the memory ops into a single
             // vector op
-            sequential = false;
+            stride = std::nullopt;
             break;
         }
     }
@@ -319,7 +329,17 @@ bool IsUnrolledAccessSequential(mlir::PatternRewriter& rewriter,
     {
         rewriter.eraseOp(clone);
     }
-    return sequential;
+    return stride;
+}
+
+template <typename OpType>
+bool IsUnrolledAccessSequential(mlir::PatternRewriter& rewriter,
+                                OpType op,
+                                std::vector<mlir::BlockAndValueMapping>& laneMappings,
+                                int64_t vectorSize)
+{
+    auto stride = GetUnrolledAccessConstantStride(rewriter, op, laneMappings, vectorSize);
+    return stride.has_value() && *stride == 1;
 }
 
 mlir::Value FlattenMemRefCast(mlir::OpBuilder& builder, mlir::Value memref)
@@ -346,6 +366,277 @@ std::pair<mlir::Value, mlir::Value> FlattenAccess(mlir::OpBuilder& builder, OpTy
     return std::make_pair(flatCastMemref, flatPosition);
 }
 
+// Boundary loops produced by schedule splits commonly have trip counts that aren't a power of
+// two, and LLVM legalizes loads and stores of the resulting odd-width vectors by splitting them
+// into progressively narrower pieces, leaving boundary kernels running at near-scalar speed.
+// For those widths, emit a predicated access over the next power-of-two width instead, with a
+// create_mask covering the real lanes: targets with predicated memory ops (AVX-512 k-masks, SVE
+// predicates, AVX2 vmaskmov) execute it as a single instruction, and targets without them
+// scalarize to no worse than the splitting would have produced
+bool ShouldUseMaskedAccess(int64_t vectorSize)
+{
+    return !llvm::isPowerOf2_64(static_cast<uint64_t>(vectorSize));
+}
+
+// Below this many lanes the scalar fallback is at least as fast as a gather or scatter on every
+// target we generate for, so indirect accesses in narrow loops keep the unrolled form
+constexpr int64_t MinGatherScatterLanes = 4;
+
+// Builds the vector of flattened memory positions that the unrolled lanes of the given access op
+// touch, for feeding a gather or scatter. Indirectly indexed accesses (A[idx[i]]) aren't valid
+// affine dim operands, so the positions are computed with explicit arithmetic from the memref's
+// static strides rather than with affine applies: each lane's indices are resolved by cloning
+// the access op through that lane's mapping, exactly like the scalar fallback would have
+template <typename OpType>
+std::optional<mlir::Value> BuildUnrolledAccessPositionVector(mlir::PatternRewriter& rewriter,
+                                                             OpType op,
+                                                             std::vector<mlir::BlockAndValueMapping>& laneMappings,
+                                                             int64_t vectorSize)
+{
+    auto loc = op.getLoc();
+    auto memRefType = op.getMemRefType();
+    llvm::SmallVector<int64_t, 4> strides;
+    int64_t offset;
+    if (failed(mlir::getStridesAndOffset(memRefType, strides, offset)) ||
+        offset == mlir::ShapedType::kDynamicStrideOrOffset ||
+        llvm::any_of(strides, [](int64_t stride) { return stride == mlir::ShapedType::kDynamicStrideOrOffset; }))
+    {
+        return std::nullopt;
+    }
+
+    auto i64Type = rewriter.getI64Type();
+    auto positionVecType = mlir::VectorType::get({ vectorSize }, i64Type);
+    auto zeroI64 = rewriter.create<mlir::arith::ConstantOp>(loc, i64Type, rewriter.getIntegerAttr(i64Type, 0));
+    mlir::Value positions = rewriter.create<mlir::vector::BroadcastOp>(loc, positionVecType, zeroI64);
+    for (int64_t i = 0; i < vectorSize; ++i)
+    {
+        auto laneClone = mlir::dyn_cast<OpType>(rewriter.clone(*op.getOperation(), laneMappings[i]));
+        mlir::Value lanePosition = rewriter.create<mlir::arith::ConstantIndexOp>(loc, offset);
+        for (auto&& [stride, laneIndex] : llvm::zip(strides, laneClone.indices()))
+        {
+            auto strideConst = rewriter.create<mlir::arith::ConstantIndexOp>(loc, stride);
+            mlir::Value scaled = rewriter.create<mlir::arith::MulIOp>(loc, laneIndex, strideConst);
+            lanePosition = rewriter.create<mlir::arith::AddIOp>(loc, lanePosition, scaled);
+        }
+        mlir::Value lanePositionI64 = rewriter.create<mlir::arith::IndexCastOp>(loc, i64Type, lanePosition);
+        positions = rewriter.create<mlir::vector::InsertElementOp>(loc, lanePositionI64, positions, rewriter.create<mlir::arith::ConstantIndexOp>(loc, i));
+        rewriter.eraseOp(laneClone);
+    }
+    return positions;
+}
+
+mlir::Value CreateSequentialVectorLoad(mlir::PatternRewriter& rewriter,
+                                       mlir::Location loc,
+                                       mlir::VectorType vectorType,
+                                       mlir::Value flatCastMemref,
+                                       mlir::Value flattenedPosition)
+{
+    auto vectorSize = vectorType.getDimSize(0);
+    if (!ShouldUseMaskedAccess(vectorSize))
+    {
+        return rewriter.create<mlir::vector::LoadOp>(loc, vectorType, flatCastMemref, mlir::ValueRange{ flattenedPosition });
+    }
+
+    auto elementType = vectorType.getElementType();
+    auto fullVectorSize = static_cast<int64_t>(llvm::PowerOf2Ceil(vectorSize));
+    auto fullVectorType = mlir::VectorType::get({ fullVectorSize }, elementType);
+    auto maskType = mlir::VectorType::get({ fullVectorSize }, rewriter.getI1Type());
+    auto maskExtent = rewriter.create<mlir::arith::ConstantIndexOp>(loc, vectorSize);
+    auto mask = rewriter.create<mlir::vector::CreateMaskOp>(loc, maskType, mlir::ValueRange{ maskExtent });
+    auto zero = rewriter.create<mlir::arith::ConstantOp>(loc, elementType, rewriter.getZeroAttr(elementType));
+    mlir::Value passthrough = rewriter.create<mlir::vector::BroadcastOp>(loc, fullVectorType, zero);
+    mlir::Value fullResult = rewriter.create<mlir::vector::MaskedLoadOp>(loc, fullVectorType, flatCastMemref, mlir::ValueRange{ flattenedPosition }, mask, passthrough);
+    // Slice back down to the logical width so the rest of the vectorized ops keep their types
+    return rewriter.create<mlir::vector::ExtractStridedSliceOp>(loc, fullResult, std::vector<int64_t>{ 0 }, std::vector<int64_t>{ vectorSize }, std::vector<int64_t>{ 1 });
+}
+
+mlir::Operation* CreateSequentialVectorStore(mlir::PatternRewriter& rewriter,
+                                             mlir::Location loc,
+                                             mlir::Value vectorizedValueToStore,
+                                             mlir::Value flatCastMemref,
+                                             mlir::Value flattenedPosition)
+{
+    auto vectorType = vectorizedValueToStore.getType().cast<mlir::VectorType>();
+    auto vectorSize = vectorType.getDimSize(0);
+    if (!ShouldUseMaskedAccess(vectorSize))
+    {
+        return rewriter.create<mlir::vector::StoreOp>(loc, vectorizedValueToStore, flatCastMemref, mlir::ValueRange{ flattenedPosition });
+    }
+
+    auto elementType = vectorType.getElementType();
+    auto fullVectorSize = static_cast<int64_t>(llvm::PowerOf2Ceil(vectorSize));
+    auto fullVectorType = mlir::VectorType::get({ fullVectorSize }, elementType);
+    auto maskType = mlir::VectorType::get({ fullVectorSize }, rewriter.getI1Type());
+    auto maskExtent = rewriter.create<mlir::arith::ConstantIndexOp>(loc, vectorSize);
+    auto mask = rewriter.create<mlir::vector::CreateMaskOp>(loc, maskType, mlir::ValueRange{ maskExtent });
+    auto zero = rewriter.create<mlir::arith::ConstantOp>(loc, elementType, rewriter.getZeroAttr(elementType));
+    mlir::Value paddedValue = rewriter.create<mlir::vector::BroadcastOp>(loc, fullVectorType, zero);
+    paddedValue = rewriter.create<mlir::vector::InsertStridedSliceOp>(loc, vectorizedValueToStore, paddedValue, std::vector<int64_t>{ 0 }, std::vector<int64_t>{ 1 });
+    return rewriter.create<mlir::vector::MaskedStoreOp>(loc, flatCastMemref, mlir::ValueRange{ flattenedPosition }, mask, paddedValue);
+}
+
+// Largest compile-time-constant stride that gets lowered as a wide contiguous access plus a
+// deinterleaving (or interleaving) shuffle. Beyond this the wide vector covers mostly-unused
+// lanes and a gather/scatter or the scalar fallback wins
+constexpr int64_t MaxInterleavedStride = 4;
+
+// Loads vectorSize elements spaced `stride` apart as one wide masked contiguous load plus a
+// deinterleaving shuffle, the standard trick for interleaved data where a scalar gather would
+// otherwise serialize the loop. The mask enables only the lanes the scalar loop would have read,
+// so the wide access can't run past the end of the buffer on the final interleave group; targets
+// with predicated loads execute it as a single instruction
+mlir::Value CreateStridedVectorLoad(mlir::PatternRewriter& rewriter,
+                                    mlir::Location loc,
+                                    mlir::VectorType vectorType,
+                                    mlir::Value flatCastMemref,
+                                    mlir::Value flattenedPosition,
+                                    int64_t stride)
+{
+    auto vectorSize = vectorType.getDimSize(0);
+    auto elementType = vectorType.getElementType();
+    auto wideSize = vectorSize * stride;
+    auto wideVectorType = mlir::VectorType::get({ wideSize }, elementType);
+    auto maskType = mlir::VectorType::get({ wideSize }, rewriter.getI1Type());
+
+    llvm::SmallVector<bool, 32> maskPattern(wideSize, false);
+    llvm::SmallVector<int64_t, 16> deinterleaveIndices;
+    deinterleaveIndices.reserve(vectorSize);
+    for (int64_t i = 0; i < vectorSize; ++i)
+    {
+        maskPattern[i * stride] = true;
+        deinterleaveIndices.push_back(i * stride);
+    }
+
+    auto mask = rewriter.create<mlir::arith::ConstantOp>(loc, maskType, mlir::DenseElementsAttr::get(maskType, maskPattern));
+    auto zero = rewriter.create<mlir::arith::ConstantOp>(loc, elementType, rewriter.getZeroAttr(elementType));
+    mlir::Value passthrough = rewriter.create<mlir::vector::BroadcastOp>(loc, wideVectorType, zero);
+    mlir::Value wideLoad = rewriter.create<mlir::vector::MaskedLoadOp>(loc, wideVectorType, flatCastMemref, mlir::ValueRange{ flattenedPosition }, mask, passthrough);
+    return rewriter.create<mlir::vector::ShuffleOp>(loc, vectorType, wideLoad, wideLoad, rewriter.getI64ArrayAttr(deinterleaveIndices));
+}
+
+// Symmetric store path: spreads the lanes to multiples of the stride with an interleaving
+// shuffle and writes them with one wide masked store. The lanes between the strided positions
+// are masked off, so whatever the shuffle leaves in them never reaches memory
+mlir::Operation* CreateStridedVectorStore(mlir::PatternRewriter& rewriter,
+                                          mlir::Location loc,
+                                          mlir::Value vectorizedValueToStore,
+                                          mlir::Value flatCastMemref,
+                                          mlir::Value flattenedPosition,
+                                          int64_t stride)
+{
+    auto vectorType = vectorizedValueToStore.getType().cast<mlir::VectorType>();
+    auto vectorSize = vectorType.getDimSize(0);
+    auto elementType = vectorType.getElementType();
+    auto wideSize = vectorSize * stride;
+    auto wideVectorType = mlir::VectorType::get({ wideSize }, elementType);
+    auto maskType = mlir::VectorType::get({ wideSize }, rewriter.getI1Type());
+
+    llvm::SmallVector<bool, 32> maskPattern(wideSize, false);
+    llvm::SmallVector<int64_t, 32> interleaveIndices(wideSize, 0);
+    for (int64_t i = 0; i < vectorSize; ++i)
+    {
+        maskPattern[i * stride] = true;
+        interleaveIndices[i * stride] = i;
+    }
+
+    auto mask = rewriter.create<mlir::arith::ConstantOp>(loc, maskType, mlir::DenseElementsAttr::get(maskType, maskPattern));
+    mlir::Value spreadValue = rewriter.create<mlir::vector::ShuffleOp>(loc, wideVectorType, vectorizedValueToStore, vectorizedValueToStore, rewriter.getI64ArrayAttr(interleaveIndices));
+    return rewriter.create<mlir::vector::MaskedStoreOp>(loc, flatCastMemref, mlir::ValueRange{ flattenedPosition }, mask, spreadValue);
+}
+
+// True if none of the given access indices vary with the induction variable, i.e. every
+// unrolled lane reads or writes the same location
+bool IsLaneInvariantAccess(mlir::Value inductionVar, mlir::Operation::operand_range indices)
+{
+    for (auto index : indices)
+    {
+        if (index == inductionVar)
+        {
+            return false;
+        }
+        if (auto defOp = index.getDefiningOp(); defOp && ir::util::hasRecursiveUseOfOp(inductionVar, defOp))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Inner-loop reductions (dot products, norms) store an accumulation chain back to a
+// lane-invariant location: store(add(load(loc), contribution), loc) where every lane reads and
+// writes the same position. Unrolling that chain serializes every lane on the accumulator, so
+// instead reduce the contribution vector horizontally with vector.reduction -- which lowers to
+// a tree reduction (haddps, faddv) -- and fold the single scalar into the accumulator once
+template <typename StoreOpType, typename LoadOpType>
+std::optional<mlir::Operation*> TryVectorizeHorizontalReductionStore(mlir::PatternRewriter& rewriter,
+                                                                     StoreOpType op,
+                                                                     const VectorizedOpMap& vectorizedOps,
+                                                                     std::vector<mlir::BlockAndValueMapping>& laneMappings,
+                                                                     mlir::Value inductionVar,
+                                                                     int64_t step,
+                                                                     int64_t vectorSize)
+{
+    if (!inductionVar || !IsLaneInvariantAccess(inductionVar, op.indices()))
+    {
+        return std::nullopt;
+    }
+
+    auto binOp = op.getValueToStore().template getDefiningOp<v::BinOp>();
+    if (!binOp || binOp.predicate() != v::BinaryOpPredicate::ADD)
+    {
+        return std::nullopt;
+    }
+
+    // Find which side of the add re-loads the accumulator location; the other side is the
+    // per-lane contribution
+    auto matchesAccumulatorLoad = [&](mlir::Value operand) {
+        auto loadOp = operand.template getDefiningOp<LoadOpType>();
+        if (!loadOp || loadOp.memref() != op.memref() || loadOp.indices().size() != op.indices().size())
+        {
+            return false;
+        }
+        if constexpr (std::is_same_v<StoreOpType, mlir::AffineStoreOp>)
+        {
+            if (loadOp.getAffineMap() != op.getAffineMap())
+            {
+                return false;
+            }
+        }
+        return std::equal(loadOp.indices().begin(), loadOp.indices().end(), op.indices().begin());
+    };
+
+    mlir::Value accumulatorLoad;
+    mlir::Value contribution;
+    if (matchesAccumulatorLoad(binOp.lhs()))
+    {
+        accumulatorLoad = binOp.lhs();
+        contribution = binOp.rhs();
+    }
+    else if (matchesAccumulatorLoad(binOp.rhs()))
+    {
+        accumulatorLoad = binOp.rhs();
+        contribution = binOp.lhs();
+    }
+    else
+    {
+        return std::nullopt;
+    }
+
+    auto vecContribution = GetVectorizedPredecessor(rewriter, contribution, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+    if (!vecContribution || !vecContribution->HasVectorType())
+    {
+        return std::nullopt;
+    }
+
+    auto loc = op.getLoc();
+    auto elementType = accumulatorLoad.getType();
+    mlir::Value reduced = rewriter.create<mlir::vector::ReductionOp>(loc, elementType, rewriter.getStringAttr("add"), vecContribution->GetVectorResult(), mlir::ValueRange{});
+    mlir::Value combined = rewriter.create<v::BinOp>(loc, v::BinaryOpPredicate::ADD, accumulatorLoad, reduced);
+    auto reductionStore = rewriter.clone(*op.getOperation());
+    reductionStore->setOperand(0, combined);
+    return reductionStore;
+}
+
 std::optional<VectorizedOp> VectorizeLoadOp(mlir::PatternRewriter& rewriter,
                                             mlir::memref::LoadOp op,
                                             const VectorizedOpMap& vectorizedOps,
@@ -362,13 +653,35 @@ std::optional<VectorizedOp> VectorizeLoadOp(mlir::PatternRewriter& rewriter,
     mlir::memref::LoadOpAdaptor adaptor{ op };
     std::vector<mlir::Value> indices(adaptor.indices().begin(), adaptor.indices().end());
 
+    auto constantStride = GetUnrolledAccessConstantStride(rewriter, op, laneMappings, vectorSize);
+
     mlir::Value result;
-    if (IsUnrolledAccessSequential(rewriter, op, laneMappings, vectorSize))
+    if (constantStride == 1)
     {
         // We know these reads are sequential, but mlir::vector::LoadOp only operates on memrefs where the minor
         // dimension has unit stride, so cast the memref to a flat buffer and load from that shape
         auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, indices);
-        result = rewriter.create<mlir::vector::LoadOp>(op.getLoc(), vectorType, flatCastMemref, mlir::ValueRange{ flattenedPosition });
+        result = CreateSequentialVectorLoad(rewriter, op.getLoc(), vectorType, flatCastMemref, flattenedPosition);
+    }
+    else if (constantStride && *constantStride > 1 && *constantStride <= MaxInterleavedStride)
+    {
+        // Small constant strides come from interleaved layouts; one wide load plus a
+        // deinterleaving shuffle beats both a gather and the scalar fallback there
+        auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, indices);
+        result = CreateStridedVectorLoad(rewriter, op.getLoc(), vectorType, flatCastMemref, flattenedPosition, *constantStride);
+    }
+    else if (auto positions = vectorSize >= MinGatherScatterLanes ? BuildUnrolledAccessPositionVector(rewriter, op, laneMappings, vectorSize) : std::nullopt)
+    {
+        // Non-sequential but statically-strided accesses (e.g. indirectly indexed embedding
+        // lookups) can keep memory-bound loops at load-port throughput with a single hardware
+        // gather instead of serializing on scalar loads
+        auto flatCastMemref = FlattenMemRefCast(rewriter, op.memref());
+        auto zeroIndex = rewriter.create<mlir::arith::ConstantIndexOp>(loc, 0);
+        auto maskType = mlir::VectorType::get({ vectorSize }, rewriter.getI1Type());
+        auto mask = rewriter.create<mlir::vector::ConstantMaskOp>(loc, maskType, rewriter.getI64ArrayAttr({ vectorSize }));
+        auto zero = rewriter.create<mlir::arith::ConstantOp>(loc, elementType, rewriter.getZeroAttr(elementType));
+        mlir::Value passthrough = rewriter.create<mlir::vector::BroadcastOp>(loc, vectorType, zero);
+        result = rewriter.create<mlir::vector::GatherOp>(loc, vectorType, flatCastMemref, mlir::ValueRange{ zeroIndex }, *positions, mask, passthrough);
     }
     else
     {
@@ -392,6 +705,11 @@ std::optional<VectorizedOp> VectorizeStoreOp(mlir::PatternRewriter& rewriter,
                                              int64_t step,
                                              int64_t vectorSize)
 {
+    if (auto reductionStore = TryVectorizeHorizontalReductionStore<mlir::memref::StoreOp, mlir::memref::LoadOp>(rewriter, op, vectorizedOps, laneMappings, inductionVar, step, vectorSize))
+    {
+        return *reductionStore;
+    }
+
     // Get (vector) value to store from map
     mlir::memref::StoreOpAdaptor adaptor{ op };
     auto scalarValue = op.getValueToStore();
@@ -410,14 +728,35 @@ std::optional<VectorizedOp> VectorizeStoreOp(mlir::PatternRewriter& rewriter,
 
     std::vector<mlir::Value> indices(adaptor.indices().begin(), adaptor.indices().end());
 
-    if (IsUnrolledAccessSequential(rewriter, op, laneMappings, vectorSize))
+    auto constantStride = GetUnrolledAccessConstantStride(rewriter, op, laneMappings, vectorSize);
+
+    if (constantStride == 1)
     {
         // We know these reads are sequential, but mlir::vector::StoreOp only operates on memrefs where the minor
         // dimension has unit stride, so cast the memref to a flat buffer and load from that shape
         auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, indices);
-        mlir::Operation* storeOp = rewriter.create<mlir::vector::StoreOp>(op.getLoc(), vectorizedValueToStore, flatCastMemref, mlir::ValueRange{ flattenedPosition });
+        mlir::Operation* storeOp = CreateSequentialVectorStore(rewriter, op.getLoc(), vectorizedValueToStore, flatCastMemref, flattenedPosition);
+        return storeOp;
+    }
+    else if (constantStride && *constantStride > 1 && *constantStride <= MaxInterleavedStride)
+    {
+        // Interleaving store mirroring the strided load path
+        auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, indices);
+        mlir::Operation* storeOp = CreateStridedVectorStore(rewriter, op.getLoc(), vectorizedValueToStore, flatCastMemref, flattenedPosition, *constantStride);
         return storeOp;
     }
+    else if (auto positions = vectorSize >= MinGatherScatterLanes ? BuildUnrolledAccessPositionVector(rewriter, op, laneMappings, vectorSize) : std::nullopt)
+    {
+        // Scattered writes collapse to a single instruction on targets with hardware scatter
+        // and scalarize elsewhere. Repeated positions keep the scalar fallback's semantics:
+        // like the lane-ascending store order, the highest lane wins
+        auto flatCastMemref = FlattenMemRefCast(rewriter, op.memref());
+        auto zeroIndex = rewriter.create<mlir::arith::ConstantIndexOp>(loc, 0);
+        auto maskType = mlir::VectorType::get({ vectorSize }, rewriter.getI1Type());
+        auto mask = rewriter.create<mlir::vector::ConstantMaskOp>(loc, maskType, rewriter.getI64ArrayAttr({ vectorSize }));
+        mlir::Operation* scatterOp = rewriter.create<mlir::vector::ScatterOp>(loc, flatCastMemref, mlir::ValueRange{ zeroIndex }, *positions, mask, vectorizedValueToStore);
+        return scatterOp;
+    }
     else
     {
         std::vector<mlir::Operation*> storeOps;
@@ -449,13 +788,22 @@ std::optional<VectorizedOp> VectorizeAffineLoadOp(mlir::PatternRewriter& rewrite
     mlir::AffineLoadOpAdaptor adaptor{ op };
     std::vector<mlir::Value> baseIndices(adaptor.indices().begin(), adaptor.indices().end());
 
+    auto constantStride = GetUnrolledAccessConstantStride(rewriter, op, laneMappings, vectorSize);
+
     mlir::Value result;
-    if (IsUnrolledAccessSequential(rewriter, op, laneMappings, vectorSize))
+    if (constantStride == 1)
     {
         // We know these reads are sequential, but mlir::vector::LoadOp only operates on memrefs where the minor
         // dimension has unit stride, so cast the memref to a flat buffer and load from that shape
         auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, baseIndices);
-        result = rewriter.create<mlir::vector::LoadOp>(op.getLoc(), vectorType, flatCastMemref, mlir::ValueRange{ flattenedPosition });
+        result = CreateSequentialVectorLoad(rewriter, op.getLoc(), vectorType, flatCastMemref, flattenedPosition);
+    }
+    else if (constantStride && *constantStride > 1 && *constantStride <= MaxInterleavedStride)
+    {
+        // Small constant strides come from interleaved layouts; one wide load plus a
+        // deinterleaving shuffle beats the scalar fallback there
+        auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, baseIndices);
+        result = CreateStridedVectorLoad(rewriter, op.getLoc(), vectorType, flatCastMemref, flattenedPosition, *constantStride);
     }
     else
     {
@@ -479,6 +827,11 @@ std::optional<VectorizedOp> VectorizeAffineStoreOp(mlir::PatternRewriter& rewrit
                                                    int64_t step,
                                                    int64_t vectorSize)
 {
+    if (auto reductionStore = TryVectorizeHorizontalReductionStore<mlir::AffineStoreOp, mlir::AffineLoadOp>(rewriter, op, vectorizedOps, laneMappings, inductionVar, step, vectorSize))
+    {
+        return *reductionStore;
+    }
+
     // Get (vector) value to store from map
     mlir::AffineStoreOpAdaptor adaptor{ op };
     auto scalarValue = op.getValueToStore();
@@ -497,12 +850,21 @@ std::optional<VectorizedOp> VectorizeAffineStoreOp(mlir::PatternRewriter& rewrit
 
     std::vector<mlir::Value> baseIndices(adaptor.indices().begin(), adaptor.indices().end());
 
-    if (IsUnrolledAccessSequential(rewriter, op, laneMappings, vectorSize))
+    auto constantStride = GetUnrolledAccessConstantStride(rewriter, op, laneMappings, vectorSize);
+
+    if (constantStride == 1)
     {
         // We know these reads are sequential, but mlir::vector::StoreOp only operates on memrefs where the minor
         // dimension has unit stride, so cast the memref to a flat buffer and load from that shape
         auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, baseIndices);
-        mlir::Operation* storeOp = rewriter.create<mlir::vector::StoreOp>(op.getLoc(), vectorizedValueToStore, flatCastMemref, mlir::ValueRange{ flattenedPosition });
+        mlir::Operation* storeOp = CreateSequentialVectorStore(rewriter, op.getLoc(), vectorizedValueToStore, flatCastMemref, flattenedPosition);
+        return storeOp;
+    }
+    else if (constantStride && *constantStride > 1 && *constantStride <= MaxInterleavedStride)
+    {
+        // Interleaving store mirroring the strided load path
+        auto [flatCastMemref, flattenedPosition] = FlattenAccess(rewriter, op, baseIndices);
+        mlir::Operation* storeOp = CreateStridedVectorStore(rewriter, op.getLoc(), vectorizedValueToStore, flatCastMemref, flattenedPosition, *constantStride);
         return storeOp;
     }
     else
@@ -592,6 +954,32 @@ std::optional<mlir::Operation*> VectorizeShiftLeftOp(mlir::PatternRewriter& rewr
     return result;
 }
 
+// Vectorizes elementwise binary arith dialect ops (add/sub/mul, min/max, shifts). The min/max
+// cases matter for saturated arithmetic: SaturateValue emits maxsi/minsi clamps, and keeping
+// them as single vector ops lets the backend fold clamp-around-arithmetic into native
+// saturating SIMD instructions (vpaddsw, sqadd, and friends) instead of falling back to scalar
+template <typename OpType>
+std::optional<mlir::Operation*> VectorizeBinArithOp(mlir::PatternRewriter& rewriter,
+                                                    OpType op,
+                                                    const VectorizedOpMap& vectorizedOps,
+                                                    std::vector<mlir::BlockAndValueMapping>& laneMappings,
+                                                    mlir::Value inductionVar,
+                                                    int64_t step,
+                                                    int64_t vectorSize)
+{
+    // Get (vector) arguments from map
+    auto lhs = GetVectorizedPredecessor(rewriter, op.getLhs(), vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+    auto rhs = GetVectorizedPredecessor(rewriter, op.getRhs(), vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+    if (!lhs || !rhs)
+    {
+        return std::nullopt;
+    }
+
+    auto loc = op.getLoc();
+    auto result = rewriter.create<OpType>(loc, lhs->GetVectorResult(), rhs->GetVectorResult());
+    return result;
+}
+
 std::optional<mlir::Operation*> VectorizeFPToSIOp(mlir::PatternRewriter& rewriter,
                                                   mlir::arith::FPToSIOp op,
                                                   const VectorizedOpMap& vectorizedOps,
@@ -638,6 +1026,52 @@ std::optional<mlir::Operation*> VectorizeSignExtendIOp(mlir::PatternRewriter& re
     return result;
 }
 
+std::optional<mlir::Operation*> VectorizeExtFOp(mlir::PatternRewriter& rewriter,
+                                                mlir::arith::ExtFOp op,
+                                                const VectorizedOpMap& vectorizedOps,
+                                                std::vector<mlir::BlockAndValueMapping>& laneMappings,
+                                                mlir::Value inductionVar,
+                                                int64_t step,
+                                                int64_t vectorSize)
+{
+    // Get (vector) arguments from map
+    auto inputOp = op.getIn();
+    auto input = GetVectorizedPredecessor(rewriter, inputOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+    if (!input)
+    {
+        return std::nullopt;
+    }
+
+    auto loc = op.getLoc();
+    auto scalarResultType = op.getResult().getType();
+    auto resultType = mlir::VectorType::get({ vectorSize }, scalarResultType);
+    auto result = rewriter.create<mlir::arith::ExtFOp>(loc, resultType, input->GetVectorResult());
+    return result;
+}
+
+std::optional<mlir::Operation*> VectorizeTruncFOp(mlir::PatternRewriter& rewriter,
+                                                  mlir::arith::TruncFOp op,
+                                                  const VectorizedOpMap& vectorizedOps,
+                                                  std::vector<mlir::BlockAndValueMapping>& laneMappings,
+                                                  mlir::Value inductionVar,
+                                                  int64_t step,
+                                                  int64_t vectorSize)
+{
+    // Get (vector) arguments from map
+    auto inputOp = op.getIn();
+    auto input = GetVectorizedPredecessor(rewriter, inputOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+    if (!input)
+    {
+        return std::nullopt;
+    }
+
+    auto loc = op.getLoc();
+    auto scalarResultType = op.getResult().getType();
+    auto resultType = mlir::VectorType::get({ vectorSize }, scalarResultType);
+    auto result = rewriter.create<mlir::arith::TruncFOp>(loc, resultType, input->GetVectorResult());
+    return result;
+}
+
 std::optional<mlir::Operation*> VectorizeAbsFOp(mlir::PatternRewriter& rewriter,
                                                 mlir::math::AbsOp op,
                                                 const VectorizedOpMap& vectorizedOps,
@@ -835,12 +1269,36 @@ std::optional<VectorizedOp> VectorizeOp(mlir::PatternRewriter& rewriter,
             .Case([&](mlir::arith::ShLIOp shiftLeftOp) {
                 return VectorizeShiftLeftOp(rewriter, shiftLeftOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
             })
+            .Case([&](mlir::arith::ShRSIOp shiftRightOp) {
+                return VectorizeBinArithOp(rewriter, shiftRightOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
+            .Case([&](mlir::arith::AddIOp addOp) {
+                return VectorizeBinArithOp(rewriter, addOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
+            .Case([&](mlir::arith::SubIOp subOp) {
+                return VectorizeBinArithOp(rewriter, subOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
+            .Case([&](mlir::arith::MulIOp mulOp) {
+                return VectorizeBinArithOp(rewriter, mulOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
+            .Case([&](mlir::arith::MaxSIOp maxOp) {
+                return VectorizeBinArithOp(rewriter, maxOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
+            .Case([&](mlir::arith::MinSIOp minOp) {
+                return VectorizeBinArithOp(rewriter, minOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
             .Case([&](mlir::arith::FPToSIOp castOp) {
                 return VectorizeFPToSIOp(rewriter, castOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
             })
             .Case([&](mlir::arith::ExtSIOp castOp) {
                 return VectorizeSignExtendIOp(rewriter, castOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
             })
+            .Case([&](mlir::arith::ExtFOp castOp) {
+                return VectorizeExtFOp(rewriter, castOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
+            .Case([&](mlir::arith::TruncFOp castOp) {
+                return VectorizeTruncFOp(rewriter, castOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
+            })
             .Case([&](mlir::math::ExpOp expOp) {
                 return VectorizeExpOp(rewriter, expOp, vectorizedOps, laneMappings, inductionVar, step, vectorSize);
             })
@@ -10,7 +10,10 @@
 
 #include <utilities/include/TypeTraits.h>
 
+#include <mlir/Dialect/Affine/Analysis/AffineAnalysis.h>
+#include <mlir/Dialect/Affine/Analysis/AffineStructures.h>
 #include <mlir/Dialect/Affine/Analysis/LoopAnalysis.h>
+#include <mlir/Dialect/Affine/Analysis/Utils.h>
 
 #include <mlir/IR/Visitors.h>
 
@@ -851,6 +854,90 @@ private:
         // CopyOpInterface -- getSource, getTarget --- ugh: 2 memrefs
     }
 
+    // Returns true if any pair of shared-memory accesses inside `loop` has a dependence that is
+    // actually carried by `loop`. Pairs that affine dependence analysis proves independent at the
+    // loop's depth (e.g. double-buffered accesses that alternate buffers with the induction
+    // variable) don't count; accesses the analysis can't reason about are conservatively assumed
+    // to conflict.
+    static bool HasLoopCarriedSharedMemoryConflict(mlir::AffineForOp loop)
+    {
+        std::vector<MemoryAccessInfo> accesses;
+        loop.walk([&](Operation* op) {
+            if (auto info = GetSharedMemoryAccessInfo(op))
+                accesses.push_back(*info);
+        });
+
+        auto loopDepth = mlir::getNestingDepth(loop) + 1;
+        for (auto& src : accesses)
+        {
+            for (auto& dst : accesses)
+            {
+                if (src.accessType == MemoryAccessType::Read && dst.accessType == MemoryAccessType::Read)
+                    continue;
+
+                if (!UsesSameMemory(src, dst))
+                    continue;
+
+                if (!isa<mlir::AffineReadOpInterface, mlir::AffineWriteOpInterface>(src.op) ||
+                    !isa<mlir::AffineReadOpInterface, mlir::AffineWriteOpInterface>(dst.op))
+                    return true; // not an affine access; assume the dependence is carried
+
+                mlir::MemRefAccess srcAccess(src.op);
+                mlir::MemRefAccess dstAccess(dst.op);
+                mlir::FlatAffineValueConstraints dependenceConstraints;
+                auto result = mlir::checkMemrefAccessDependence(srcAccess, dstAccess, loopDepth, &dependenceConstraints, /*dependenceComponents=*/nullptr);
+                if (result.value != mlir::DependenceResult::NoDependence)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Hoists barriers that sit at a loop body's boundary out of loops that don't carry a
+    // shared-memory dependence between iterations. A barrier that is the first or last op of the
+    // body orders nothing within an iteration, so once the cross-iteration conflicts are
+    // disproven its only remaining purpose is ordering against the code around the loop, and a
+    // single barrier at the loop boundary serves that at 1/tripcount the cost.
+    void HoistLoopBoundaryBarriers()
+    {
+        std::vector<ValueBarrierOp> barriers;
+        getOperation()->walk([&](ValueBarrierOp barrier) {
+            barriers.push_back(barrier);
+        });
+
+        for (auto barrier : barriers)
+        {
+            auto loop = dyn_cast_or_null<mlir::AffineForOp>(barrier->getParentOp());
+            if (!loop || loop->hasAttr("accv_gpu_map"))
+                continue;
+
+            auto body = loop.getBody();
+            bool isFirst = &body->front() == barrier.getOperation();
+            bool isLast = barrier->getNextNode() == body->getTerminator();
+            if (!isFirst && !isLast)
+                continue; // the barrier also orders accesses within an iteration
+
+            if (HasLoopCarriedSharedMemoryConflict(loop))
+                continue;
+
+            if (isLast)
+            {
+                if (auto next = loop->getNextNode(); next && isa<ValueBarrierOp>(next))
+                    barrier.erase(); // a barrier already follows the loop
+                else
+                    barrier->moveAfter(loop);
+            }
+            else
+            {
+                if (auto prev = loop->getPrevNode(); prev && isa<ValueBarrierOp>(prev))
+                    barrier.erase(); // a barrier already precedes the loop
+                else
+                    barrier->moveBefore(loop);
+            }
+        }
+    }
+
     static AnalysisGraph ComputeRegionGraph(mlir::Region& region, const std::shared_ptr<AnalysisNode>& in = {}, int barrierWeight = 1)
     {
         // Create a dedicated entry node for the region
@@ -1026,6 +1113,11 @@ void BarrierOptPass::runOnOperation()
         // Now delete all the inactive barrier ops
         cfg.DeleteInactiveBarrierOps();
 
+        // The graph analysis treats accesses to the same buffer as conflicting across loop
+        // iterations, so refine the surviving barriers with a per-loop dependence check and
+        // hoist the ones whose conflicts aren't actually loop-carried
+        HoistLoopBoundaryBarriers();
+
         if (writeBarrierGraph)
         {
             cfg.AnalyzeBarriers();
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AcceraPasses.h"
+
+#include <ir/include/value/ValueDialect.h>
+
+#include <mlir/Dialect/Arithmetic/IR/Arithmetic.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+#include <mlir/Dialect/StandardOps/IR/Ops.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/Pass/Pass.h>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Support/MathExtras.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace mlir;
+
+namespace
+{
+
+// Minimum alignment handed out for workspace slices; matches what the default
+// aligned allocator guarantees so rewritten buffers never lose alignment.
+constexpr int64_t kMinWorkspaceAlignment = 16;
+
+// Rewrites the local allocations of functions tagged with
+// accv.caller_workspace into views of the function's trailing workspace
+// argument. Each eligible allocation gets a build-time byte offset into the
+// workspace, and the aggregate size and alignment requirement is recorded on
+// the function so callers (and header emission) can size their buffers.
+//
+// Allocations are eligible when they have a static shape and an identity
+// layout (what memref.view can express) and are not routed to a special
+// allocator (huge pages). Anything else keeps its per-call allocation.
+struct CallerWorkspacePass : public accera::transforms::ConvertCallerWorkspaceBase<CallerWorkspacePass>
+{
+    void runOnOperation() final
+    {
+        getOperation()->walk([&](FuncOp fnOp) {
+            if (fnOp->hasAttr(accera::ir::CallerWorkspaceAttrName) && !fnOp.isExternal())
+            {
+                rewriteFunction(fnOp);
+            }
+        });
+    }
+
+    void rewriteFunction(FuncOp fnOp)
+    {
+        if (fnOp.getNumArguments() == 0)
+        {
+            return;
+        }
+        auto workspaceArg = fnOp.getArguments().back();
+        auto workspaceType = workspaceArg.getType().dyn_cast<MemRefType>();
+        if (!workspaceType || workspaceType.getRank() != 1 ||
+            !workspaceType.getElementType().isInteger(8))
+        {
+            fnOp.emitWarning("caller-workspace function does not end in a byte-buffer argument; leaving allocations in place");
+            return;
+        }
+
+        OpBuilder builder(fnOp.getContext());
+        int64_t workspaceSize = 0;
+        int64_t workspaceAlignment = kMinWorkspaceAlignment;
+
+        SmallVector<memref::AllocOp, 8> allocs;
+        fnOp.walk([&](memref::AllocOp allocOp) {
+            auto allocType = allocOp.getType();
+            if (!allocType.hasStaticShape() || !allocType.getLayout().isIdentity())
+            {
+                return;
+            }
+            if (allocOp->hasAttr(accera::ir::HugePageAllocationAttrName))
+            {
+                // Huge-page buffers go through their dedicated allocator.
+                return;
+            }
+            allocs.push_back(allocOp);
+        });
+
+        for (auto allocOp : allocs)
+        {
+            auto allocType = allocOp.getType();
+            const int64_t sizeInBytes = allocType.getNumElements() * llvm::divideCeil(allocType.getElementTypeBitWidth(), 8);
+
+            int64_t alignment = kMinWorkspaceAlignment;
+            if (auto alignmentAttr = allocOp.alignment())
+            {
+                alignment = std::max<int64_t>(alignment, alignmentAttr.getValue());
+            }
+            workspaceAlignment = std::max(workspaceAlignment, alignment);
+
+            const int64_t offset = llvm::alignTo(workspaceSize, alignment);
+            workspaceSize = offset + sizeInBytes;
+
+            builder.setInsertionPoint(allocOp);
+            auto loc = allocOp.getLoc();
+            auto offsetValue = builder.create<arith::ConstantIndexOp>(loc, offset);
+            auto view = builder.create<memref::ViewOp>(loc, allocType, workspaceArg, offsetValue, ValueRange{});
+
+            // The caller owns the memory now, so the per-call deallocs go away.
+            SmallVector<memref::DeallocOp, 2> deallocs;
+            for (auto user : allocOp->getUsers())
+            {
+                if (auto deallocOp = dyn_cast<memref::DeallocOp>(user))
+                {
+                    deallocs.push_back(deallocOp);
+                }
+            }
+            for (auto deallocOp : deallocs)
+            {
+                deallocOp.erase();
+            }
+
+            allocOp.replaceAllUsesWith(view.getResult());
+            allocOp.erase();
+        }
+
+        // Record the aggregate requirement even when it is zero so callers can
+        // rely on the attributes being present on every tagged function.
+        builder.setInsertionPoint(fnOp);
+        fnOp->setAttr(accera::ir::WorkspaceSizeAttrName, builder.getI64IntegerAttr(workspaceSize));
+        fnOp->setAttr(accera::ir::WorkspaceAlignmentAttrName, builder.getI64IntegerAttr(workspaceAlignment));
+    }
+};
+
+} // namespace
+
+namespace accera::transforms::value
+{
+std::unique_ptr<mlir::Pass> createCallerWorkspacePass()
+{
+    return std::make_unique<CallerWorkspacePass>();
+}
+} // namespace accera::transforms::value
@@ -36,9 +36,13 @@
 #include <llvm/ADT/TypeSwitch.h>
 #include <llvm/IR/ConstantRange.h>
 #include <llvm/Support/Debug.h>
+#include <llvm/Support/MathExtras.h>
 #include <llvm/Support/raw_os_ostream.h>
 
 #include <algorithm>
+#include <limits>
+#include <optional>
+#include <utility>
 
 #define DEBUG_TYPE "value-optimize"
 
@@ -75,6 +79,31 @@ struct RangeValueOptimizePass : public ConvertRangeValueOptimizeBase<RangeValueO
                 op.erase();
             }
         });
+
+        // Strength-reduce division and remainder whose operand ranges pin down the result. Split
+        // and fused indices frequently lower to div/mod address computations that survive into the
+        // final IR, and a stray sdiv in a tight inner loop costs more than the arithmetic around it.
+        getOperation()->walk([&](Operation* op) {
+            if (isa<arith::DivSIOp, arith::DivUIOp, arith::FloorDivSIOp>(op))
+            {
+                simplifyDivOp(op, builder);
+            }
+            else if (isa<arith::RemSIOp, arith::RemUIOp>(op))
+            {
+                simplifyRemOp(op, builder);
+            }
+        });
+
+        // Narrow provably-small index arithmetic to 32 bits. Index computations lower as 64-bit
+        // arithmetic even though the analysis proves most loop indices fit comfortably in 32 bits,
+        // and the wider ops halve vectorized-address throughput and waste registers. Values without
+        // a proven range (e.g. anything derived from a dynamic shape) are left at full width.
+        getOperation()->walk([&](Operation* op) {
+            if (isa<arith::AddIOp, arith::SubIOp, arith::MulIOp>(op))
+            {
+                narrowArithOp(op, builder);
+            }
+        });
     }
 
 private:
@@ -149,6 +178,178 @@ private:
 
         return CmpIOpClassification::Unknown;
     }
+
+    // Returns the signed bounds of the value when the analysis has a usable range for it
+    std::optional<std::pair<int64_t, int64_t>> getSignedBounds(Value value)
+    {
+        if (!rangeValue->hasRange(value))
+        {
+            return std::nullopt;
+        }
+        auto range = rangeValue->getRange(value);
+        if (range.isFullSet())
+        {
+            return std::nullopt;
+        }
+        return std::make_pair(range.getSignedMin().getSExtValue(), range.getSignedMax().getSExtValue());
+    }
+
+    // Returns the divisor of the div/mod op when it is a proven positive constant and the
+    // dividend is proven non-negative; the rewrites below rely on both
+    std::optional<int64_t> getStrengthReducibleDivisor(Operation* op)
+    {
+        auto lhsBounds = getSignedBounds(op->getOperand(0));
+        auto rhsBounds = getSignedBounds(op->getOperand(1));
+        if (!lhsBounds || !rhsBounds || rhsBounds->first != rhsBounds->second)
+        {
+            return std::nullopt;
+        }
+        if (rhsBounds->first <= 0 || lhsBounds->first < 0)
+        {
+            // Negative operands need the rounding behavior of the original op
+            return std::nullopt;
+        }
+        return rhsBounds->first;
+    }
+
+    void simplifyDivOp(Operation* op, OpBuilder& builder)
+    {
+        auto divisor = getStrengthReducibleDivisor(op);
+        if (!divisor)
+        {
+            return;
+        }
+        auto lhs = op->getOperand(0);
+        auto lhsBounds = *getSignedBounds(lhs);
+        auto type = op->getResult(0).getType();
+        auto loc = op->getLoc();
+
+        builder.setInsertionPoint(op);
+        Value replacement;
+        if (lhsBounds.first / *divisor == lhsBounds.second / *divisor)
+        {
+            // The dividend's whole range falls inside one quotient block
+            replacement = builder.create<arith::ConstantOp>(loc, type, builder.getIntegerAttr(type, lhsBounds.first / *divisor));
+        }
+        else if (llvm::isPowerOf2_64(*divisor))
+        {
+            auto shiftAmount = builder.create<arith::ConstantOp>(loc, type, builder.getIntegerAttr(type, llvm::Log2_64(*divisor)));
+            replacement = builder.create<arith::ShRUIOp>(loc, lhs, shiftAmount);
+        }
+        else
+        {
+            return;
+        }
+        op->getResult(0).replaceAllUsesWith(replacement);
+        op->erase();
+    }
+
+    void simplifyRemOp(Operation* op, OpBuilder& builder)
+    {
+        auto divisor = getStrengthReducibleDivisor(op);
+        if (!divisor)
+        {
+            return;
+        }
+        auto lhs = op->getOperand(0);
+        auto lhsBounds = *getSignedBounds(lhs);
+        auto type = op->getResult(0).getType();
+        auto loc = op->getLoc();
+
+        builder.setInsertionPoint(op);
+        Value replacement;
+        if (lhsBounds.first / *divisor == lhsBounds.second / *divisor)
+        {
+            // The dividend's whole range falls inside one quotient block, so the remainder is
+            // just the dividend rebased to the start of that block
+            auto blockBase = (lhsBounds.first / *divisor) * *divisor;
+            if (blockBase == 0)
+            {
+                replacement = lhs;
+            }
+            else
+            {
+                auto baseConstant = builder.create<arith::ConstantOp>(loc, type, builder.getIntegerAttr(type, blockBase));
+                replacement = builder.create<arith::SubIOp>(loc, lhs, baseConstant);
+            }
+        }
+        else if (llvm::isPowerOf2_64(*divisor))
+        {
+            auto mask = builder.create<arith::ConstantOp>(loc, type, builder.getIntegerAttr(type, *divisor - 1));
+            replacement = builder.create<arith::AndIOp>(loc, lhs, mask);
+        }
+        else
+        {
+            return;
+        }
+        op->getResult(0).replaceAllUsesWith(replacement);
+        op->erase();
+    }
+
+    // Returns true when the analysis proves the value's entire range fits in a signed 32-bit integer
+    bool fitsInI32(Value value)
+    {
+        auto bounds = getSignedBounds(value);
+        return bounds && bounds->first >= std::numeric_limits<int32_t>::min() && bounds->second <= std::numeric_limits<int32_t>::max();
+    }
+
+    void narrowArithOp(Operation* op, OpBuilder& builder)
+    {
+        auto result = op->getResult(0);
+        auto type = result.getType();
+        if (!type.isInteger(64) && !type.isIndex())
+        {
+            return;
+        }
+        // Both operands and the result must be proven to fit in i32 for the narrowed op to compute
+        // the same value; a result that fits guarantees the i32 arithmetic doesn't wrap
+        if (!fitsInI32(op->getOperand(0)) || !fitsInI32(op->getOperand(1)) || !fitsInI32(result))
+        {
+            return;
+        }
+
+        auto loc = op->getLoc();
+        builder.setInsertionPoint(op);
+        auto i32Ty = builder.getI32Type();
+        auto narrowOperand = [&](Value operand) -> Value {
+            if (operand.getType().isIndex())
+            {
+                return builder.create<arith::IndexCastOp>(loc, i32Ty, operand);
+            }
+            return builder.create<arith::TruncIOp>(loc, i32Ty, operand);
+        };
+        auto lhs = narrowOperand(op->getOperand(0));
+        auto rhs = narrowOperand(op->getOperand(1));
+
+        Value narrowed;
+        if (isa<arith::AddIOp>(op))
+        {
+            narrowed = builder.create<arith::AddIOp>(loc, lhs, rhs);
+        }
+        else if (isa<arith::SubIOp>(op))
+        {
+            narrowed = builder.create<arith::SubIOp>(loc, lhs, rhs);
+        }
+        else
+        {
+            narrowed = builder.create<arith::MulIOp>(loc, lhs, rhs);
+        }
+
+        // Rebuild the original width at the boundary; widen/narrow pairs between adjacent narrowed
+        // ops fold away downstream, leaving chains of index arithmetic entirely in 32 bits
+        Value widened;
+        if (type.isIndex())
+        {
+            widened = builder.create<arith::IndexCastOp>(loc, type, narrowed);
+        }
+        else
+        {
+            widened = builder.create<arith::ExtSIOp>(loc, type, narrowed);
+        }
+        result.replaceAllUsesWith(widened);
+        op->erase();
+    }
+
     RangeValueAnalysis* rangeValue = nullptr;
 };
 
@@ -137,6 +137,15 @@ struct ValueFuncToTargetPass : public tr::ValueFuncToTargetBase<ValueFuncToTarge
             {
                 (void)mlir::loopUnrollJamByFactor(op, (uint64_t)jammed.getInt());
             }
+            else if (auto factorAttr = op->getAttrOfType<IntegerAttr>("accv_unroll_by_factor"))
+            {
+                // Partial unroll whose residue was split into its own fully-unrolled loop; the
+                // trip count here is an exact multiple of the factor, so no remainder loop results
+                auto factor = (uint64_t)factorAttr.getInt();
+                auto tripCount = mlir::getConstantTripCount(op);
+                if (tripCount && *tripCount >= factor && *tripCount % factor == 0)
+                    (void)mlir::loopUnrollByFactor(op, factor);
+            }
             else
             {
                 (void)mlir::promoteIfSingleIteration(op);
@@ -22,6 +22,8 @@
 #include <mlir/Dialect/SCF/SCF.h>
 #include <mlir/Dialect/StandardOps/IR/Ops.h>
 
+#include <mlir/Interfaces/SideEffectInterfaces.h>
+
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
 
 #include <mlir/Pass/Pass.h>
@@ -295,6 +297,105 @@ LogicalResult CopyOpLowering::matchAndRewrite(
     return success();
 }
 
+struct AffineApplyCSEPattern : public OpRewritePattern<mlir::AffineApplyOp>
+{
+    // Share identical affine index computations within a block. Unrolled kernels replicate the
+    // same base-plus-offset address arithmetic per kernel instance (IndexCombinationBinOpLowering
+    // turns each copy into its own AffineApplyOp), so replacing later duplicates with the first
+    // instance keeps one register-resident copy per distinct address expression
+    using OpRewritePattern<mlir::AffineApplyOp>::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(
+        mlir::AffineApplyOp op,
+        PatternRewriter& rewriter) const override
+    {
+        auto block = op->getBlock();
+        for (auto& priorOp : llvm::make_range(block->begin(), mlir::Block::iterator(op)))
+        {
+            if (auto priorApplyOp = mlir::dyn_cast<mlir::AffineApplyOp>(&priorOp))
+            {
+                if (priorApplyOp.getAffineMap() == op.getAffineMap() &&
+                    llvm::equal(priorApplyOp.getMapOperands(), op.getMapOperands()))
+                {
+                    rewriter.replaceOp(op, priorApplyOp.getResult());
+                    return success();
+                }
+            }
+        }
+        return failure();
+    }
+};
+
+struct RedundantLoadElisionPattern : public OpRewritePattern<mlir::AffineLoadOp>
+{
+    // Share identical loads within a block. Adjacent kernels scheduled at the same loop level are
+    // spliced into the same block by the schedule lowering, and each kernel body re-loads the
+    // operands it touches (e.g. a matmul kernel and its epilogue both loading C), so replacing a
+    // later load with the value of an earlier identical one removes the redundant memory traffic
+    // at the kernel seam
+    using OpRewritePattern<mlir::AffineLoadOp>::OpRewritePattern;
+
+    // Returns true when the op could write to the given buffer. Buffers are compared by identity:
+    // caches are separate buffers that are explicitly copied to and from their base arrays rather
+    // than aliased views of them, so distinct values here are distinct allocations
+    static bool MayWriteToMemref(Operation* op, mlir::Value memref)
+    {
+        if (op->getNumRegions() != 0)
+        {
+            // Nested loops and regions may contain writes
+            return true;
+        }
+        if (auto storeOp = mlir::dyn_cast<mlir::AffineStoreOp>(op))
+        {
+            return storeOp.getMemRef() == memref;
+        }
+        if (auto storeOp = mlir::dyn_cast<memref::StoreOp>(op))
+        {
+            return storeOp.getMemRef() == memref;
+        }
+        if (auto memoryEffectsOp = mlir::dyn_cast<MemoryEffectOpInterface>(op))
+        {
+            llvm::SmallVector<MemoryEffects::EffectInstance> effects;
+            memoryEffectsOp.getEffects(effects);
+            return llvm::any_of(effects, [](const MemoryEffects::EffectInstance& effect) {
+                return mlir::isa<MemoryEffects::Write>(effect.getEffect());
+            });
+        }
+        // Unknown ops could write anywhere
+        return true;
+    }
+
+    LogicalResult matchAndRewrite(
+        mlir::AffineLoadOp op,
+        PatternRewriter& rewriter) const override
+    {
+        auto block = op->getBlock();
+        // Walk backwards from this load until a possible write to the buffer is found; any
+        // identical load seen before that point produces the same value as this one
+        for (auto iter = mlir::Block::iterator(op); iter != block->begin();)
+        {
+            --iter;
+            Operation* priorOp = &*iter;
+            if (auto priorLoadOp = mlir::dyn_cast<mlir::AffineLoadOp>(priorOp))
+            {
+                if (priorLoadOp.getMemRef() == op.getMemRef() &&
+                    priorLoadOp.getAffineMap() == op.getAffineMap() &&
+                    llvm::equal(priorLoadOp.getMapOperands(), op.getMapOperands()))
+                {
+                    rewriter.replaceOp(op, priorLoadOp.getResult());
+                    return success();
+                }
+                continue;
+            }
+            if (MayWriteToMemref(priorOp, op.getMemRef()))
+            {
+                break;
+            }
+        }
+        return failure();
+    }
+};
+
 struct IndexCombinationBinOpLowering : public OpRewritePattern<ValueBinOp>
 {
     // Convert value BinOps that are just combinations of index types into affine apply ops
@@ -441,6 +542,8 @@ void populateValueSimplifyPatterns(mlir::RewritePatternSet& patterns)
     patterns.insert<CopyOpLowering,
                     ValueSliceSimplifyPattern,
                     IndexCombinationBinOpLowering,
+                    AffineApplyCSEPattern,
+                    RedundantLoadElisionPattern,
                     BinOpCastOpExpandingPattern,
                     SequentialCastOpFoldingPattern>(context);
 }
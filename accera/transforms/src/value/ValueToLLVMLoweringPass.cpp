@@ -7,6 +7,7 @@
 #include "AcceraPasses.h"
 
 #include <ir/include/IRUtil.h>
+#include <ir/include/exec/ExecutionPlanOps.h>
 #include <ir/include/value/ValueDialect.h>
 #include <mlir/Dialect/LLVMIR/LLVMTypes.h>
 #include <mlir/IR/BuiltinTypes.h>
@@ -28,6 +29,8 @@
 #include <mlir/Conversion/VectorToLLVM/ConvertVectorToLLVM.h>
 #include <mlir/Conversion/MemRefToLLVM/AllocLikeConversion.h>
 
+#include <mlir/Dialect/AMX/AMXDialect.h>
+#include <mlir/Dialect/AMX/Transforms.h>
 #include <mlir/Dialect/Affine/IR/AffineOps.h>
 #include <mlir/Dialect/LLVMIR/FunctionCallUtils.h>
 #include <mlir/Dialect/LLVMIR/LLVMDialect.h>
@@ -46,7 +49,10 @@
 #include <llvm/IR/DataLayout.h>
 #include <llvm/Support/raw_os_ostream.h>
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <optional>
 
 #ifndef _MSC_VER
 #include <time.h>
@@ -171,6 +177,16 @@ public:
                                   ConversionPatternRewriter& rewriter) const override;
 };
 
+class TraceEventOpLowering : public PrintOpLoweringBase<TraceEventOp>
+{
+public:
+    using PrintOpLoweringBase<TraceEventOp>::PrintOpLoweringBase;
+
+    LogicalResult matchAndRewrite(TraceEventOp op,
+                                  TraceEventOp::Adaptor adaptor,
+                                  ConversionPatternRewriter& rewriter) const override;
+};
+
 template <typename OpTy>
 struct ValueLLVMOpConversionPattern : public OpConversionPattern<OpTy>
 {
@@ -383,12 +399,18 @@ struct MemrefAllocOpLowering : public ConvertOpToLLVMPattern<memref::AllocOp> {
         memref::AllocOp allocOp = cast<memref::AllocOp>(op);
         MemRefType memRefType = allocOp.getType();
 
+        // The huge-page allocator already returns 2MB-aligned buffers, which exceeds any
+        // alignment an alloc op can ask for, so skip the over-allocate-and-realign dance
+        bool useHugePages = allocOp->hasAttr(HugePageAllocationAttrName);
+
         Value alignment;
-        if (auto alignmentAttr = allocOp.alignment()) {
-            alignment = createIndexConstant(rewriter, loc, *alignmentAttr);
-        } 
-        else if (!memRefType.getElementType().isSignlessIntOrIndexOrFloat()) {
-            alignment = getSizeInBytes(loc, memRefType.getElementType(), rewriter);
+        if (!useHugePages) {
+            if (auto alignmentAttr = allocOp.alignment()) {
+                alignment = createIndexConstant(rewriter, loc, *alignmentAttr);
+            }
+            else if (!memRefType.getElementType().isSignlessIntOrIndexOrFloat()) {
+                alignment = getSizeInBytes(loc, memRefType.getElementType(), rewriter);
+            }
         }
 
         if (alignment) {
@@ -397,9 +419,24 @@ struct MemrefAllocOpLowering : public ConvertOpToLLVMPattern<memref::AllocOp> {
         }
 
         // Allocate the underlying buffer and store a pointer to it in the MemRef descriptor.
+        // Allocations marked for the cache arena draw from the runtime's recycling arena so
+        // repeated invocations reuse the same blocks instead of calling malloc every time.
         Type elementPtrType = this->getElementPtrType(memRefType);
-        auto allocFuncOp = LLVM::lookupOrCreateMallocFn(
-            allocOp->getParentOfType<ModuleOp>(), getIndexType());
+        LLVM::LLVMFuncOp allocFuncOp;
+        if (allocOp->hasAttr(executionPlan::CacheArenaAllocationAttrName)) {
+            allocFuncOp = LLVM::lookupOrCreateFn(
+                allocOp->getParentOfType<ModuleOp>(), "AcceraCacheArenaAllocate",
+                getIndexType(), getVoidPtrType());
+        }
+        else if (useHugePages) {
+            allocFuncOp = LLVM::lookupOrCreateFn(
+                allocOp->getParentOfType<ModuleOp>(), "AcceraHugePageAllocate",
+                getIndexType(), getVoidPtrType());
+        }
+        else {
+            allocFuncOp = LLVM::lookupOrCreateMallocFn(
+                allocOp->getParentOfType<ModuleOp>(), getIndexType());
+        }
         auto results = createLLVMCall(rewriter, loc, allocFuncOp, {sizeBytes},
                                     getVoidPtrType());
         Value allocatedPtr = rewriter.create<LLVM::BitcastOp>(loc, elementPtrType, results[0]);
@@ -466,10 +503,53 @@ struct MemrefAllocOpLowering : public ConvertOpToLLVMPattern<memref::AllocOp> {
     }
 };
 
+// Returns arena-allocated cache buffers to the runtime's arena. The default memref.dealloc
+// lowering would hand the pointer to free(), which doesn't understand the arena's blocks.
+struct CacheArenaDeallocOpLowering : public ConvertOpToLLVMPattern<memref::DeallocOp> {
+    using ConvertOpToLLVMPattern<memref::DeallocOp>::ConvertOpToLLVMPattern;
+
+    LogicalResult matchAndRewrite(memref::DeallocOp op, OpAdaptor adaptor, ConversionPatternRewriter &rewriter) const override
+    {
+        if (!op->hasAttr(executionPlan::CacheArenaAllocationAttrName))
+            return failure();
+
+        auto freeFuncOp = LLVM::lookupOrCreateFn(
+            op->getParentOfType<ModuleOp>(), "AcceraCacheArenaFree",
+            getVoidPtrType(), LLVM::LLVMVoidType::get(rewriter.getContext()));
+        MemRefDescriptor memRefDescriptor(adaptor.memref());
+        Value allocatedPtr = memRefDescriptor.allocatedPtr(rewriter, op.getLoc());
+        Value casted = rewriter.create<LLVM::BitcastOp>(op.getLoc(), getVoidPtrType(), allocatedPtr);
+        rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, freeFuncOp, casted);
+        return success();
+    }
+};
+
+// Huge-page-backed buffers are mmap'd, not malloc'd, so their deallocs must go back through the
+// huge-page runtime rather than free()
+struct HugePageDeallocOpLowering : public ConvertOpToLLVMPattern<memref::DeallocOp> {
+    using ConvertOpToLLVMPattern<memref::DeallocOp>::ConvertOpToLLVMPattern;
+
+    LogicalResult matchAndRewrite(memref::DeallocOp op, OpAdaptor adaptor, ConversionPatternRewriter &rewriter) const override
+    {
+        if (!op->hasAttr(HugePageAllocationAttrName))
+            return failure();
+
+        auto freeFuncOp = LLVM::lookupOrCreateFn(
+            op->getParentOfType<ModuleOp>(), "AcceraHugePageFree",
+            getVoidPtrType(), LLVM::LLVMVoidType::get(rewriter.getContext()));
+        MemRefDescriptor memRefDescriptor(adaptor.memref());
+        Value allocatedPtr = memRefDescriptor.allocatedPtr(rewriter, op.getLoc());
+        Value casted = rewriter.create<LLVM::BitcastOp>(op.getLoc(), getVoidPtrType(), allocatedPtr);
+        rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, freeFuncOp, casted);
+        return success();
+    }
+};
+
 struct ValueToLLVMLoweringPass : public ConvertValueToLLVMBase<ValueToLLVMLoweringPass>
 {
-    ValueToLLVMLoweringPass(bool useBarePtrCallConv, bool emitCWrappers, unsigned indexBitwidth, bool useAlignedAlloc, llvm::DataLayout dataLayout, const IntraPassSnapshotOptions& snapshotteroptions = {}) :
-        _intrapassSnapshotter(snapshotteroptions)
+    ValueToLLVMLoweringPass(bool useBarePtrCallConv, bool emitCWrappers, unsigned indexBitwidth, bool useAlignedAlloc, llvm::DataLayout dataLayout, const IntraPassSnapshotOptions& snapshotteroptions = {}, const LLVMFunctionAttributeOptions& funcAttrOptions = {}) :
+        _intrapassSnapshotter(snapshotteroptions),
+        _funcAttrOptions(funcAttrOptions)
     {
         this->useBarePtrCallConv = useBarePtrCallConv;
         this->emitCWrappers = emitCWrappers;
@@ -482,7 +562,12 @@ struct ValueToLLVMLoweringPass : public ConvertValueToLLVMBase<ValueToLLVMLoweri
     void runOnModule() final;
 
 private:
+    void AddFunctionAttributes(mlir::ModuleOp moduleOp);
+    void ApplyFastMathFlags(mlir::ModuleOp moduleOp);
+    void AnnotateLoopBranchWeights(mlir::ModuleOp moduleOp);
+
     IRSnapshotter _intrapassSnapshotter;
+    LLVMFunctionAttributeOptions _funcAttrOptions;
 };
 
 // Creates a constant Op producing a value of `resultType` from an index-typed
@@ -622,6 +707,23 @@ struct RawPointerAPIFnConversion : public ConvertOpToLLVMPattern<FuncOp>
         auto newFuncOp = convertFuncOpToLLVMFuncOp(funcOp, rewriter);
         if (!newFuncOp)
             return failure();
+
+        // The Accera calling contract requires every array argument to be a distinct buffer,
+        // whatever its role (INPUT, INPUT_OUTPUT, OUTPUT), so the bare pointers these memrefs
+        // lower to never alias each other. Saying so lets LLVM's late optimizer reorder and
+        // vectorize across arrays instead of assuming the worst. The element type's natural
+        // alignment is the strongest alignment the contract guarantees, so that is all that
+        // is claimed.
+        for (const auto& en : llvm::enumerate(oldArgTypes))
+        {
+            auto memrefTy = en.value().dyn_cast<MemRefType>();
+            if (!memrefTy || !memrefTy.getElementType().isIntOrFloat())
+                continue;
+            newFuncOp.setArgAttr(en.index(), LLVM::LLVMDialect::getNoAliasAttrName(), rewriter.getUnitAttr());
+            auto elementBytes = std::max<int64_t>(memrefTy.getElementTypeBitWidth() / 8, 1);
+            newFuncOp.setArgAttr(en.index(), LLVM::LLVMDialect::getAlignAttrName(), rewriter.getI64IntegerAttr(elementBytes));
+        }
+
         if (newFuncOp.getBody().empty())
         {
             rewriter.eraseOp(funcOp);
@@ -814,13 +916,27 @@ LogicalResult GlobalOpToLLVMLowering::matchAndRewrite(
     {
         OpBuilder::InsertionGuard guard(rewriter);
 
-        rewriter.create<LLVM::GlobalOp>(
+        // Carry any requested alignment through to the LLVM global; embedded constant buffers
+        // use page alignment so the loader can share whole read-only pages across processes
+        uint64_t alignment = 0;
+        if (auto alignmentAttr = op->getAttrOfType<IntegerAttr>(GlobalOp::getAlignmentAttrName()))
+        {
+            alignment = alignmentAttr.getValue().getZExtValue();
+        }
+
+        auto llvmGlobal = rewriter.create<LLVM::GlobalOp>(
             op.getLoc(),
             arrayType,
             op.constant(),
             op.external() ? LLVM::Linkage::External : LLVM::Linkage::Internal,
             op.sym_name(),
-            op.valueAttr());
+            op.valueAttr(),
+            alignment);
+
+        if (auto sectionAttr = op->getAttrOfType<StringAttr>(GlobalOp::getSectionAttrName()))
+        {
+            llvmGlobal.sectionAttr(sectionAttr);
+        }
     }
     rewriter.eraseOp(op);
 
@@ -916,6 +1032,30 @@ LogicalResult PrintFOpLowering::matchAndRewrite(PrintFOp op,
     return success();
 }
 
+LogicalResult TraceEventOpLowering::matchAndRewrite(TraceEventOp op,
+                                                    TraceEventOp::Adaptor,
+                                                    ConversionPatternRewriter& rewriter) const
+{
+    auto loc = op.getLoc();
+
+    auto* llvmDialect = op.getContext()->getOrLoadDialect<LLVM::LLVMDialect>();
+    assert(llvmDialect && "expected llvm dialect to be registered");
+
+    ModuleOp parentModule = op->getParentOfType<ModuleOp>();
+
+    std::string regionName = op.regionName().str();
+    auto tag = "trace_region_" + std::to_string(llvm::hash_value(regionName));
+    Value nameStr = getOrCreateGlobalString(loc, rewriter, tag, StringRef(regionName.c_str(), regionName.length() + 1), parentModule);
+
+    auto llvmI8PtrTy = LLVM::LLVMPointerType::get(IntegerType::get(rewriter.getContext(), 8));
+    auto traceFnType = LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(rewriter.getContext()), llvmI8PtrTy, /*isVarArg=*/false);
+    auto traceFnRef = getOrInsertLibraryFunction(rewriter, op.isEnter() ? "AcceraProfileTraceEnter" : "AcceraProfileTraceExit", traceFnType, parentModule, llvmDialect);
+    rewriter.create<LLVM::CallOp>(loc, TypeRange{}, traceFnRef, ArrayRef<Value>{ nameStr });
+
+    rewriter.eraseOp(op);
+    return success();
+}
+
 using UnsignedTypePair = std::pair<unsigned, Type>;
 static void getMemRefArgIndicesAndTypes(
     FunctionType type,
@@ -1183,6 +1323,9 @@ void ValueToLLVMLoweringPass::runOnModule()
         vector::populateVectorContractLoweringPatterns(patterns, vector::VectorTransformsOptions{}.setVectorTransferSplit(mlir::vector::VectorTransferSplit::VectorTransfer));
         vector::populateVectorMaskMaterializationPatterns(patterns, true);
 
+        amx::populateAMXLegalizeForLLVMExportPatterns(llvmTypeConverter, patterns);
+        amx::configureAMXLegalizeForExportTarget(target);
+
         if (failed(applyPartialConversion(moduleOp, target, std::move(patterns))))
         {
             signalPassFailure();
@@ -1204,6 +1347,8 @@ void ValueToLLVMLoweringPass::runOnModule()
         vector::populateVectorContractLoweringPatterns(patterns, vector::VectorTransformsOptions{}.setVectorTransferSplit(mlir::vector::VectorTransferSplit::VectorTransfer));
         vector::populateVectorMaskMaterializationPatterns(patterns, true);
 
+        amx::populateAMXLegalizeForLLVMExportPatterns(llvmTypeConverter, patterns);
+
         // cf. mlir\lib\Conversion\OpenMPToLLVM\OpenMPToLLVM.cpp
         target.addDynamicallyLegalOp<mlir::omp::ParallelOp, mlir::omp::WsLoopOp>(
             [&](Operation* op) { return llvmTypeConverter.isLegal(&op->getRegion(0)); });
@@ -1233,11 +1378,211 @@ void ValueToLLVMLoweringPass::runOnModule()
         }
     }
 
+    AddFunctionAttributes(moduleOp);
+    ApplyFastMathFlags(moduleOp);
+    AnnotateLoopBranchWeights(moduleOp);
+
     snapshotter.Snapshot("Final", moduleOp);
 
     llvm::DebugFlag = false;
 }
 
+void ValueToLLVMLoweringPass::AddFunctionAttributes(mlir::ModuleOp moduleOp)
+{
+    // Record the per-package backend overrides as LLVM function attributes via the LLVM dialect's
+    // passthrough mechanism. mlir-translate carries them into LLVM IR, where opt and llc honor them
+    // per function without needing matching command line flags on the tool invocations.
+    if (_funcAttrOptions.targetCpu.empty() && _funcAttrOptions.targetFeatures.empty() && !_funcAttrOptions.fastMathFuncAttrs)
+    {
+        return;
+    }
+
+    OpBuilder builder(&getContext());
+    moduleOp.walk([&](LLVM::LLVMFuncOp funcOp) {
+        if (funcOp.isExternal())
+        {
+            return;
+        }
+        llvm::SmallVector<Attribute> passthrough;
+        if (auto existingAttrs = funcOp->getAttrOfType<ArrayAttr>("passthrough"))
+        {
+            passthrough.append(existingAttrs.begin(), existingAttrs.end());
+        }
+        auto addEntry = [&](llvm::StringRef key, llvm::StringRef value) {
+            passthrough.push_back(builder.getArrayAttr({ builder.getStringAttr(key), builder.getStringAttr(value) }));
+        };
+        if (!_funcAttrOptions.targetCpu.empty())
+        {
+            addEntry("target-cpu", _funcAttrOptions.targetCpu);
+        }
+        if (!_funcAttrOptions.targetFeatures.empty())
+        {
+            addEntry("target-features", _funcAttrOptions.targetFeatures);
+        }
+        if (_funcAttrOptions.fastMathFuncAttrs)
+        {
+            addEntry("unsafe-fp-math", "true");
+            addEntry("no-infs-fp-math", "true");
+            addEntry("no-nans-fp-math", "true");
+            addEntry("no-signed-zeros-fp-math", "true");
+        }
+        funcOp->setAttr("passthrough", builder.getArrayAttr(passthrough));
+    });
+}
+
+void ValueToLLVMLoweringPass::ApplyFastMathFlags(mlir::ModuleOp moduleOp)
+{
+    // Functions tagged by Plan::SetFastMathPolicy carry a flag bitmask through the lowering.
+    // Translate it here into fastmath flags on the function's floating-point ops, so the
+    // relaxation stays scoped to that schedule's kernel while the unsafe-fp-math passthrough
+    // attributes above remain the package-wide switch.
+    moduleOp.walk([&](LLVM::LLVMFuncOp funcOp) {
+        auto flagsAttr = funcOp->getAttrOfType<IntegerAttr>(FastMathFlagsAttrName);
+        if (!flagsAttr)
+        {
+            return;
+        }
+        auto flagBits = flagsAttr.getInt();
+        LLVM::FastmathFlags fmf{};
+        if (flagBits & FastMathContractFlag)
+        {
+            fmf = fmf | LLVM::FastmathFlags::contract;
+        }
+        if (flagBits & FastMathReassocFlag)
+        {
+            fmf = fmf | LLVM::FastmathFlags::reassoc;
+        }
+        if (flagBits & FastMathNoNaNsFlag)
+        {
+            fmf = fmf | LLVM::FastmathFlags::nnan;
+        }
+        auto fmfAttr = LLVM::FMFAttr::get(fmf, &getContext());
+        funcOp.walk([&](Operation* op) {
+            if (isa<LLVM::FAddOp, LLVM::FSubOp, LLVM::FMulOp, LLVM::FDivOp, LLVM::FRemOp, LLVM::FNegOp>(op))
+            {
+                op->setAttr("fastmathFlags", fmfAttr);
+            }
+        });
+        funcOp->removeAttr(FastMathFlagsAttrName);
+    });
+}
+
+void ValueToLLVMLoweringPass::AnnotateLoopBranchWeights(mlir::ModuleOp moduleOp)
+{
+    // The nest dialect knows every loop's range exactly, but by the time loops reach the LLVM
+    // dialect they are plain conditional branches and that knowledge is gone. Rebuild the trip
+    // count from the canonical latch shape the SCF lowering produces (`icmp slt iv, ub` against a
+    // constant bound, with a constant initial value and constant step feeding the header) and
+    // record it as branch weights, which is the metadata LLVM's estimated-trip-count, block
+    // layout and unrolling heuristics consume.
+    auto getConstant = [](mlir::Value value) -> std::optional<int64_t> {
+        if (auto constOp = value.getDefiningOp<LLVM::ConstantOp>())
+        {
+            if (auto intAttr = constOp.value().dyn_cast<IntegerAttr>())
+            {
+                return intAttr.getInt();
+            }
+        }
+        return std::nullopt;
+    };
+
+    OpBuilder builder(&getContext());
+    moduleOp.walk([&](LLVM::CondBrOp condBr) {
+        if (condBr.branch_weightsAttr())
+        {
+            return; // don't second-guess weights set elsewhere
+        }
+        auto cmp = condBr.condition().getDefiningOp<LLVM::ICmpOp>();
+        if (!cmp || (cmp.predicate() != LLVM::ICmpPredicate::slt && cmp.predicate() != LLVM::ICmpPredicate::ult))
+        {
+            return;
+        }
+        auto ivArg = cmp.lhs().dyn_cast<mlir::BlockArgument>();
+        Block* header = condBr->getBlock();
+        if (!ivArg || ivArg.getOwner() != header)
+        {
+            return;
+        }
+        auto upperBound = getConstant(cmp.rhs());
+        if (!upperBound)
+        {
+            return;
+        }
+
+        // Classify each incoming edge: the entry edge passes a constant initial value for the
+        // induction variable while the back edge passes iv + step. Anything else means this
+        // isn't the loop shape we know the range of, so leave it alone.
+        std::optional<int64_t> lowerBound;
+        std::optional<int64_t> step;
+        auto classifyIncoming = [&](mlir::OperandRange incomingOperands) -> bool {
+            if (incomingOperands.size() != header->getNumArguments())
+            {
+                return false;
+            }
+            mlir::Value incoming = incomingOperands[ivArg.getArgNumber()];
+            if (auto initVal = getConstant(incoming))
+            {
+                if (lowerBound && *lowerBound != *initVal)
+                {
+                    return false;
+                }
+                lowerBound = initVal;
+                return true;
+            }
+            if (auto addOp = incoming.getDefiningOp<LLVM::AddOp>())
+            {
+                mlir::Value other = addOp.lhs() == ivArg ? addOp.rhs() : (addOp.rhs() == ivArg ? addOp.lhs() : mlir::Value{});
+                if (auto stepVal = other ? getConstant(other) : std::optional<int64_t>{})
+                {
+                    if (step && *step != *stepVal)
+                    {
+                        return false;
+                    }
+                    step = stepVal;
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (Block* pred : header->getPredecessors())
+        {
+            Operation* terminator = pred->getTerminator();
+            bool classified = false;
+            if (auto br = dyn_cast<LLVM::BrOp>(terminator))
+            {
+                classified = br.dest() == header && classifyIncoming(br.destOperands());
+            }
+            else if (auto predCondBr = dyn_cast<LLVM::CondBrOp>(terminator))
+            {
+                if (predCondBr.trueDest() == header)
+                {
+                    classified = classifyIncoming(predCondBr.trueDestOperands());
+                }
+                else if (predCondBr.falseDest() == header)
+                {
+                    classified = classifyIncoming(predCondBr.falseDestOperands());
+                }
+            }
+            if (!classified)
+            {
+                return;
+            }
+        }
+        if (!lowerBound || !step || *step <= 0 || *upperBound <= *lowerBound)
+        {
+            return;
+        }
+
+        // Weight the continue edge by the trip count: one exit per (tripCount) continues is
+        // exactly what the backend's estimated trip count works out to, so short boundary
+        // loops stop being laid out and unrolled as if they were hot
+        auto tripCount = (*upperBound - *lowerBound + *step - 1) / *step;
+        auto bodyWeight = static_cast<int32_t>(std::min<int64_t>(tripCount, std::numeric_limits<int32_t>::max() - 1));
+        condBr->setAttr("branch_weights", builder.getI32VectorAttr({ bodyWeight, 1 }));
+    });
+}
+
 namespace accera::transforms::value
 {
 
@@ -1257,9 +1602,12 @@ void populateLocalValueToLLVMPatterns(mlir::LLVMTypeConverter& typeConverter, ml
         BitcastOpLowering,
         CallOpLowering,
         PrintFOpLowering,
+        TraceEventOpLowering,
         GetTimeOpLowering,
         RangeOpLowering,
         MemrefAllocOpLowering>(typeConverter, context);
+    patterns.insert<CacheArenaDeallocOpLowering>(typeConverter);
+    patterns.insert<HugePageDeallocOpLowering>(typeConverter);
 }
 
 void populateValueToLLVMPatterns(mlir::LLVMTypeConverter& typeConverter, mlir::RewritePatternSet& patterns)
@@ -1293,9 +1641,10 @@ std::unique_ptr<mlir::OperationPass<mlir::ModuleOp>> createValueToLLVMPass(bool
                                                                            unsigned indexBitwidth,
                                                                            bool useAlignedAlloc,
                                                                            llvm::DataLayout dataLayout,
-                                                                           const IntraPassSnapshotOptions& options /*  = {} */)
+                                                                           const IntraPassSnapshotOptions& options /*  = {} */,
+                                                                           const LLVMFunctionAttributeOptions& funcAttrOptions /*  = {} */)
 {
-    return std::make_unique<ValueToLLVMLoweringPass>(useBasePtrCallConv, emitCWrappers, indexBitwidth, useAlignedAlloc, dataLayout, options);
+    return std::make_unique<ValueToLLVMLoweringPass>(useBasePtrCallConv, emitCWrappers, indexBitwidth, useAlignedAlloc, dataLayout, options, funcAttrOptions);
 }
 
 std::unique_ptr<mlir::OperationPass<mlir::ModuleOp>> createValueToLLVMPass()
@@ -79,6 +79,24 @@ const char kGlobalOpSymNameFormat[] = "allocated_memref_{0}";
 const char kProfileRegionSymNameFormat[] = "profile_region_{0}_{1}";
 const char kProfileRegionNameIdentifier[] = "profile_region_name";
 const char kProfileRegionTypeIdentifier[] = "profile_region_type";
+const char kProfileThreadNumFnName[] = "omp_get_thread_num";
+
+// Runtime hooks for PMU counter capture (accera/runtime PerfCounters). The hooks early-out
+// when the ACCERA_PMU_EVENTS environment variable is unset, so they are always emitted when
+// profiling is enabled and the event set is chosen at run time.
+const char kProfileCountersEnterFnName[] = "AcceraProfileCountersEnter";
+const char kProfileCountersExitFnName[] = "AcceraProfileCountersExit";
+const char kProfileCountersPrintFnName[] = "AcceraProfileCountersPrint";
+const char kProfileTraceWriteFnName[] = "AcceraProfileTraceWrite";
+
+// Profile counters are striped per thread so regions entered inside parallelized loops don't
+// serialize on (or false-share) a single counter: each thread updates the slot at
+// (threadNum % kProfileRegionMaxThreads) * kProfileRegionSlotStride, with the stride padding
+// each slot out to its own cache line. PrintProfileResults aggregates the slots with plain
+// loads (each slot has a single writer, so no synchronization is needed).
+constexpr int64_t kProfileRegionMaxThreads = 64;
+constexpr int64_t kProfileRegionSlotStride = 8; // 8 x 8-byte counters = one 64-byte cache line
+constexpr int64_t kProfileRegionNumSlots = kProfileRegionMaxThreads * kProfileRegionSlotStride;
 
 enum class ProfileCounterType
 {
@@ -102,24 +120,27 @@ void InitializeProfileRegions(mlir::ModuleOp module, mlir::OpBuilder& builder)
     builder.setInsertionPoint(body, body->begin());
     auto int64Type = builder.getI64Type();
     auto doubleType = builder.getF64Type();
-    auto executionCounterType = mlir::MemRefType::get({ 1 }, int64Type);
-    auto timeType = mlir::MemRefType::get({ 1 }, doubleType);
-    auto timeTensorType = mlir::RankedTensorType::get({ 1 }, doubleType);
+    auto executionCounterType = mlir::MemRefType::get({ kProfileRegionNumSlots }, int64Type);
+    auto timeType = mlir::MemRefType::get({ kProfileRegionNumSlots }, doubleType);
+    auto countTensorType = mlir::RankedTensorType::get({ kProfileRegionNumSlots }, int64Type);
+    auto timeTensorType = mlir::RankedTensorType::get({ kProfileRegionNumSlots }, doubleType);
+    auto zeroCounts = mlir::DenseElementsAttr::get(countTensorType, builder.getI64IntegerAttr(0));
+    auto zeroTimes = mlir::DenseElementsAttr::get(timeTensorType, builder.getF64FloatAttr(0.0));
     // TODO: maybe make a new "profile region" type that holds a reference to the counters?
 
     for (auto name : regionNames)
     {
         auto nameAttr = builder.getStringAttr(name);
 
-        auto count = builder.create<vir::GlobalOp>(loc, executionCounterType, false, llvm::formatv(kProfileRegionSymNameFormat, name, "count").str(), builder.getI64TensorAttr({ 0 }));
+        auto count = builder.create<vir::GlobalOp>(loc, executionCounterType, false, llvm::formatv(kProfileRegionSymNameFormat, name, "count").str(), zeroCounts);
         count->setAttr(kProfileRegionNameIdentifier, nameAttr);
         count->setAttr(kProfileRegionTypeIdentifier, builder.getI32IntegerAttr(static_cast<int>(ProfileCounterType::count)));
 
-        auto time = builder.create<vir::GlobalOp>(loc, timeType, false, llvm::formatv(kProfileRegionSymNameFormat, name, "time").str(), mlir::DenseFPElementsAttr::get(timeTensorType, { 0.0 }));
+        auto time = builder.create<vir::GlobalOp>(loc, timeType, false, llvm::formatv(kProfileRegionSymNameFormat, name, "time").str(), zeroTimes);
         time->setAttr(kProfileRegionNameIdentifier, nameAttr);
         time->setAttr(kProfileRegionTypeIdentifier, builder.getI32IntegerAttr(static_cast<int>(ProfileCounterType::time)));
 
-        auto startTime = builder.create<vir::GlobalOp>(loc, timeType, false, llvm::formatv(kProfileRegionSymNameFormat, name, "start").str(), mlir::DenseFPElementsAttr::get(timeTensorType, { 0.0 }));
+        auto startTime = builder.create<vir::GlobalOp>(loc, timeType, false, llvm::formatv(kProfileRegionSymNameFormat, name, "start").str(), zeroTimes);
         startTime->setAttr(kProfileRegionNameIdentifier, nameAttr);
         startTime->setAttr(kProfileRegionTypeIdentifier, builder.getI32IntegerAttr(static_cast<int>(ProfileCounterType::startTime)));
     }
@@ -159,6 +180,14 @@ struct ProfileRegions
         });
     }
 
+    // Stable numeric id for a region, used to key the runtime PMU counter hooks. counters is an
+    // ordered map rebuilt from the same module walk at every lowering, so the ids agree between
+    // the enter, exit, and print lowerings.
+    int64_t GetRegionId(const std::string& name) const
+    {
+        return static_cast<int64_t>(std::distance(counters.begin(), counters.find(name)));
+    }
+
     std::map<std::string, ProfileCounter> counters;
 };
 
@@ -475,14 +504,22 @@ struct AllocOpLowering : public OpRewritePattern<ValueAllocOp>
             switch (allocType)
             {
             case vir::MemoryAllocType::Global: {
-                    if (memrefType.getNumDynamicDims() == 0)
+                    auto useHugePages = op->hasAttr(HugePageAllocationAttrName);
+                    if (memrefType.getNumDynamicDims() == 0 && !useHugePages)
                     {
                         auto globalOp = irutil::CreateGlobalBufferOp(rewriter, op, MemRefType::Builder{ memrefType }.setLayout({}), kGlobalOpSymNameFormat);
                         rewriter.replaceOpWithNewOp<vir::ReferenceGlobalOp>(op, memrefType, globalOp.sym_name());
                     }
                     else
                     {
-                        rewriter.replaceOpWithNewOp<memref::AllocOp>(op, memrefType, op.getOperation()->getOperands(), op.alignmentAttr());
+                        // Huge-page-backed buffers can't live in the data section; they become
+                        // heap allocs and keep the marker so the LLVM lowering routes them to
+                        // the huge-page runtime allocator
+                        auto allocOp = rewriter.replaceOpWithNewOp<memref::AllocOp>(op, memrefType, op.getOperation()->getOperands(), op.alignmentAttr());
+                        if (useHugePages)
+                        {
+                            allocOp->setAttr(HugePageAllocationAttrName, rewriter.getUnitAttr());
+                        }
                     }
                 }
                 break;
@@ -567,6 +604,14 @@ struct CastOpLowering : public OpRewritePattern<ValueCastOp>
 
         CAST_FROM_TO_WITH_OP_IF(mlir::FloatType, mlir::FloatType, mlir::arith::TruncFOp, (fromType.getIntOrFloatBitWidth() > toType.getIntOrFloatBitWidth()));
         CAST_FROM_TO_WITH_OP_IF(mlir::FloatType, mlir::FloatType, mlir::arith::ExtFOp, (fromType.getIntOrFloatBitWidth() < toType.getIntOrFloatBitWidth()));
+        if (fromType.isa<mlir::FloatType>() && toType.isa<mlir::FloatType>() && (fromType.getIntOrFloatBitWidth() == toType.getIntOrFloatBitWidth()))
+        {
+            // Same-width float casts (f16 <-> bf16) have no direct conversion op, so round-trip
+            // through f32, which represents both exactly
+            auto f32Value = rewriter.create<mlir::arith::ExtFOp>(loc, signlessFromValue, rewriter.getF32Type());
+            rewriter.replaceOpWithNewOp<mlir::arith::TruncFOp>(op, f32Value, toType);
+            return success();
+        }
 
         // Index casts
         CAST_FROM_TO_WITH_OP(mlir::IntegerType, mlir::IndexType, mlir::arith::IndexCastOp);
@@ -2394,6 +2439,69 @@ LogicalResult ReduceMaxOpLowering::matchAndRewrite(
     return success();
 }
 
+mlir::FuncOp GetOrInsertThreadNumFunction(PatternRewriter& rewriter, mlir::ModuleOp module)
+{
+    if (auto fn = module.lookupSymbol<mlir::FuncOp>(kProfileThreadNumFnName))
+    {
+        return fn;
+    }
+
+    OpBuilder::InsertionGuard guard(rewriter);
+    rewriter.setInsertionPointToStart(module.getBody());
+    auto fnType = rewriter.getFunctionType({}, { rewriter.getI32Type() });
+    auto fn = rewriter.create<mlir::FuncOp>(module.getLoc(), kProfileThreadNumFnName, fnType);
+    fn.setPrivate();
+    return fn;
+}
+
+mlir::FuncOp GetOrInsertProfileCountersFunction(PatternRewriter& rewriter, mlir::ModuleOp module, llvm::StringRef fnName)
+{
+    if (auto fn = module.lookupSymbol<mlir::FuncOp>(fnName))
+    {
+        return fn;
+    }
+
+    OpBuilder::InsertionGuard guard(rewriter);
+    rewriter.setInsertionPointToStart(module.getBody());
+    auto fnType = rewriter.getFunctionType({ rewriter.getI64Type() }, {});
+    auto fn = rewriter.create<mlir::FuncOp>(module.getLoc(), fnName, fnType);
+    fn.setPrivate();
+    return fn;
+}
+
+void CreateProfileCountersCall(PatternRewriter& rewriter, mlir::Location loc, mlir::ModuleOp module, llvm::StringRef fnName, int64_t regionId)
+{
+    auto fn = GetOrInsertProfileCountersFunction(rewriter, module, fnName);
+    mlir::Value regionIdVal = rewriter.create<ConstantOp>(loc, rewriter.getI64Type(), rewriter.getI64IntegerAttr(regionId));
+    rewriter.create<mlir::CallOp>(loc, fn, ValueRange{ regionIdVal });
+}
+
+void CreateProfileTraceWriteCall(PatternRewriter& rewriter, mlir::Location loc, mlir::ModuleOp module)
+{
+    auto fn = module.lookupSymbol<mlir::FuncOp>(kProfileTraceWriteFnName);
+    if (!fn)
+    {
+        OpBuilder::InsertionGuard guard(rewriter);
+        rewriter.setInsertionPointToStart(module.getBody());
+        fn = rewriter.create<mlir::FuncOp>(module.getLoc(), kProfileTraceWriteFnName, rewriter.getFunctionType({}, {}));
+        fn.setPrivate();
+    }
+    rewriter.create<mlir::CallOp>(loc, fn, ValueRange{});
+}
+
+// Returns the index of the calling thread's counter slot. omp_get_thread_num returns 0 outside
+// of parallel regions, so serial code always lands in slot 0.
+mlir::Value GetProfileCounterSlot(PatternRewriter& rewriter, mlir::Location loc, mlir::ModuleOp module)
+{
+    auto threadNumFn = GetOrInsertThreadNumFunction(rewriter, module);
+    auto threadNumCall = rewriter.create<mlir::CallOp>(loc, threadNumFn, ValueRange{});
+    mlir::Value threadNum = rewriter.create<arith::IndexCastOp>(loc, rewriter.getIndexType(), threadNumCall.getResult(0));
+    mlir::Value maxThreads = rewriter.create<arith::ConstantIndexOp>(loc, kProfileRegionMaxThreads);
+    mlir::Value wrapped = rewriter.create<arith::RemUIOp>(loc, threadNum, maxThreads);
+    mlir::Value stride = rewriter.create<arith::ConstantIndexOp>(loc, kProfileRegionSlotStride);
+    return rewriter.create<arith::MulIOp>(loc, wrapped, stride);
+}
+
 LogicalResult EnterProfileRegionOpLowering::matchAndRewrite(EnterProfileRegionOp op, PatternRewriter& rewriter) const
 {
     if (!enableProfiling)
@@ -2414,12 +2522,20 @@ LogicalResult EnterProfileRegionOpLowering::matchAndRewrite(EnterProfileRegionOp
         return failure();
     }
 
+    // record the trace event first so its cost lands outside the region's measured interval
+    rewriter.create<vir::TraceEventOp>(loc, rewriter.getStringAttr(regionName), /*isEnter=*/true);
+
     auto startTimeGlobal = regions.counters[regionName].startTime;
     mlir::Value startTimeRef = rewriter.create<vir::ReferenceGlobalOp>(loc, startTimeGlobal);
 
-    // get current time and store it in the startTime entry
+    // get current time and store it in this thread's startTime slot
+    auto slot = GetProfileCounterSlot(rewriter, loc, module);
     mlir::Value currentTime = rewriter.create<vir::GetTimeOp>(loc);
-    rewriter.create<vir::CopyOp>(loc, currentTime, startTimeRef);
+    rewriter.create<memref::StoreOp>(loc, currentTime, startTimeRef, ValueRange{ slot });
+
+    // snapshot the PMU counter group last, so the time bookkeeping above isn't attributed
+    // to the region
+    CreateProfileCountersCall(rewriter, loc, module, kProfileCountersEnterFnName, regions.GetRegionId(regionName));
     rewriter.eraseOp(op);
     return success();
 }
@@ -2453,17 +2569,26 @@ LogicalResult ExitProfileRegionOpLowering::matchAndRewrite(ExitProfileRegionOp o
     auto countGlobal = regions.counters[regionName].count;
     mlir::Value countRef = rewriter.create<vir::ReferenceGlobalOp>(loc, countGlobal);
 
-    mlir::Value startTime = rewriter.create<vir::GetElementOp>(loc, startTimeRef);
+    // read the PMU counter group first, before the time bookkeeping below can pollute it
+    CreateProfileCountersCall(rewriter, loc, module, kProfileCountersExitFnName, regions.GetRegionId(regionName));
+
+    // All three counters live in this thread's private slot, so the read-modify-write
+    // sequences need no synchronization
+    auto slot = GetProfileCounterSlot(rewriter, loc, module);
+    mlir::Value startTime = rewriter.create<memref::LoadOp>(loc, startTimeRef, ValueRange{ slot });
     mlir::Value currentTime = rewriter.create<vir::GetTimeOp>(loc);
     mlir::Value duration = rewriter.create<vir::BinOp>(loc, vir::BinaryOpPredicate::SUB, currentTime, startTime);
-    mlir::Value prevTotalTime = rewriter.create<vir::GetElementOp>(loc, totalTimeRef);
+    mlir::Value prevTotalTime = rewriter.create<memref::LoadOp>(loc, totalTimeRef, ValueRange{ slot });
     mlir::Value totalTime = rewriter.create<vir::BinOp>(loc, vir::BinaryOpPredicate::ADD, prevTotalTime, duration);
-    rewriter.create<vir::CopyOp>(loc, totalTime, totalTimeRef);
+    rewriter.create<memref::StoreOp>(loc, totalTime, totalTimeRef, ValueRange{ slot });
 
-    mlir::Value prevCount = rewriter.create<vir::GetElementOp>(loc, countRef);
+    mlir::Value prevCount = rewriter.create<memref::LoadOp>(loc, countRef, ValueRange{ slot });
     auto one = rewriter.create<ConstantOp>(loc, rewriter.getI64Type(), rewriter.getI64IntegerAttr(1));
     mlir::Value newCount = rewriter.create<vir::BinOp>(loc, vir::BinaryOpPredicate::ADD, prevCount, one);
-    rewriter.create<vir::CopyOp>(loc, newCount, countRef);
+    rewriter.create<memref::StoreOp>(loc, newCount, countRef, ValueRange{ slot });
+
+    // record the trace event last, mirroring the enter lowering
+    rewriter.create<vir::TraceEventOp>(loc, rewriter.getStringAttr(regionName), /*isEnter=*/false);
 
     rewriter.eraseOp(op);
     return success();
@@ -2483,7 +2608,9 @@ LogicalResult PrintProfileResultsOpLowering::matchAndRewrite(PrintProfileResults
 
     ProfileRegions regions(module);
 
-    // foreach region, print count and number
+    // foreach region, sum the per-thread slots and print count and time. Each slot has a single
+    // writing thread and this is a plain read of each one, so no locking is involved; regions
+    // still running on other threads simply haven't folded their current interval in yet.
     for (auto [name, counters] : regions.counters)
     {
         auto totalTimeGlobal = counters.time;
@@ -2492,13 +2619,32 @@ LogicalResult PrintProfileResultsOpLowering::matchAndRewrite(PrintProfileResults
         auto countGlobal = counters.count;
         mlir::Value countRef = rewriter.create<vir::ReferenceGlobalOp>(loc, countGlobal);
 
-        mlir::Value totalTime = rewriter.create<vir::GetElementOp>(loc, totalTimeRef);
-        mlir::Value count = rewriter.create<vir::GetElementOp>(loc, countRef);
+        mlir::Value lowerBound = rewriter.create<arith::ConstantIndexOp>(loc, 0);
+        mlir::Value upperBound = rewriter.create<arith::ConstantIndexOp>(loc, kProfileRegionNumSlots);
+        mlir::Value slotStep = rewriter.create<arith::ConstantIndexOp>(loc, kProfileRegionSlotStride);
+        mlir::Value zeroCount = rewriter.create<ConstantOp>(loc, rewriter.getI64Type(), rewriter.getI64IntegerAttr(0));
+        mlir::Value zeroTime = rewriter.create<ConstantOp>(loc, rewriter.getF64Type(), rewriter.getF64FloatAttr(0.0));
+
+        auto sumLoop = rewriter.create<scf::ForOp>(loc, lowerBound, upperBound, slotStep, ValueRange{ zeroCount, zeroTime }, [&](OpBuilder& builder, Location bodyLoc, mlir::Value slot, ValueRange iterArgs) {
+            mlir::Value slotCount = builder.create<memref::LoadOp>(bodyLoc, countRef, ValueRange{ slot });
+            mlir::Value slotTime = builder.create<memref::LoadOp>(bodyLoc, totalTimeRef, ValueRange{ slot });
+            mlir::Value countSum = builder.create<arith::AddIOp>(bodyLoc, iterArgs[0], slotCount);
+            mlir::Value timeSum = builder.create<arith::AddFOp>(bodyLoc, iterArgs[1], slotTime);
+            builder.create<scf::YieldOp>(bodyLoc, ValueRange{ countSum, timeSum });
+        });
+        mlir::Value count = sumLoop.getResult(0);
+        mlir::Value totalTime = sumLoop.getResult(1);
 
         std::string formatStr = name + "\t%ld\t%f\n";
         rewriter.create<vir::PrintFOp>(loc, formatStr, ValueRange{ count, totalTime }, /*toStderr=*/false);
+
+        // emit the region's aggregated PMU counter line (a no-op when capture is disabled)
+        CreateProfileCountersCall(rewriter, loc, module, kProfileCountersPrintFnName, regions.GetRegionId(name));
     }
 
+    // snapshot the chrome trace alongside the printed summary (a no-op when tracing is disabled)
+    CreateProfileTraceWriteCall(rewriter, loc, module);
+
     rewriter.eraseOp(op);
     return success();
 }
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "TunableParameters.h"
+
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace accera
+{
+namespace utilities
+{
+    /// <summary> The outcome of evaluating a single tuning candidate: the parameter assignment that produced it
+    /// and its measured cost (typically wall-clock time of the benchmarked candidate, in seconds). </summary>
+    struct TuningResult
+    {
+        std::map<std::string, std::string> parameterValues;
+        double cost = std::numeric_limits<double>::max();
+
+        bool IsValid() const { return cost != std::numeric_limits<double>::max(); }
+    };
+
+    /// <summary> A persistent cache of tuning winners, keyed by an arbitrary string key (by convention
+    /// "target/function/shape"). Entries survive across process invocations by being written to a simple
+    /// line-oriented text file, so that package builds after the first can skip the search entirely. </summary>
+    class TuningResultCache
+    {
+    public:
+        TuningResultCache() = default;
+
+        /// <summary> Opens (and creates, if necessary) the cache backed by the given file. </summary>
+        explicit TuningResultCache(const std::string& cacheFilePath);
+
+        /// <summary> Looks up a previously-recorded winner for the given key. </summary>
+        std::optional<TuningResult> Lookup(const std::string& key) const;
+
+        /// <summary> Records the winner for the given key, replacing any existing entry, and flushes
+        /// the cache file if this cache is file-backed. </summary>
+        void Update(const std::string& key, const TuningResult& result);
+
+        /// <summary> Returns the number of cached entries. </summary>
+        size_t Size() const { return _entries.size(); }
+
+    private:
+        void Load();
+        void Save() const;
+
+        std::string _cacheFilePath;
+        std::map<std::string, TuningResult> _entries;
+    };
+
+    /// <summary> Drives a `TuningEngine` over its full combinatorial space, evaluating each candidate with a
+    /// caller-supplied cost function (which is expected to build and benchmark the candidate schedule), and
+    /// records the winning parameter assignment in a `TuningResultCache`. If the cache already holds a winner
+    /// for the requested key, the search is skipped and the cached result returned. For example,
+    /// ```
+    /// TunableParameter kernelRows = std::vector{ 4, 6 }, kernelCols = std::vector{ 8, 16 };
+    /// TuningEngine engine(kernelRows, kernelCols);
+    /// AutoTuner tuner(engine, cache);
+    /// auto best = tuner.Run("avx2/gemm/256x256x256", [&] { return BuildAndTimeGemm(kernelRows, kernelCols); });
+    /// ```
+    /// </summary>
+    template <typename... Ts>
+    class AutoTuner
+    {
+    public:
+        AutoTuner(TuningEngine<Ts...>& engine, TuningResultCache& cache) :
+            _engine(engine),
+            _cache(cache)
+        {}
+
+        /// <summary> Runs the search for the given cache key, evaluating candidates with `costFunction`.
+        /// Candidates whose evaluation throws are skipped (treated as infeasible). </summary>
+        TuningResult Run(const std::string& key, const std::function<double()>& costFunction)
+        {
+            if (auto cached = _cache.Lookup(key))
+            {
+                return *cached;
+            }
+
+            TuningResult best;
+            _engine.Reset();
+            do
+            {
+                double cost;
+                try
+                {
+                    cost = costFunction();
+                }
+                catch (...)
+                {
+                    continue; // infeasible candidate
+                }
+                if (cost < best.cost)
+                {
+                    best.cost = cost;
+                    best.parameterValues = _engine.CurrentValues();
+                }
+            } while (_engine.Next());
+
+            if (best.IsValid())
+            {
+                _cache.Update(key, best);
+            }
+            return best;
+        }
+
+    private:
+        TuningEngine<Ts...>& _engine;
+        TuningResultCache& _cache;
+    };
+} // namespace utilities
+} // namespace accera
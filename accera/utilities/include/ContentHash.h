@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace accera
+{
+namespace utilities
+{
+    /// <summary> A 128-bit content hash. Non-cryptographic: suitable for keying compilation
+    /// caches and detecting content changes, not for anything adversarial. </summary>
+    struct ContentHash128
+    {
+        uint64_t low = 0;
+        uint64_t high = 0;
+
+        /// <summary> Renders the hash as 32 lowercase hex digits, high half first, for use in
+        /// cache file names and build logs. </summary>
+        std::string ToString() const;
+
+        friend bool operator==(const ContentHash128& a, const ContentHash128& b)
+        {
+            return a.low == b.low && a.high == b.high;
+        }
+        friend bool operator!=(const ContentHash128& a, const ContentHash128& b)
+        {
+            return !(a == b);
+        }
+        friend bool operator<(const ContentHash128& a, const ContentHash128& b)
+        {
+            return a.high != b.high ? a.high < b.high : a.low < b.low;
+        }
+    };
+
+    /// <summary> A streaming 128-bit non-cryptographic hasher (xxhash-style lane accumulators
+    /// with multiply-rotate mixing). Feed it bytes in any chunking — the result depends only on
+    /// the byte sequence — and call Finish() for the digest. Finish() doesn't consume the
+    /// hasher, so intermediate digests of a growing stream are cheap. </summary>
+    class ContentHasher
+    {
+    public:
+        ContentHasher();
+
+        /// <summary> Resets the hasher to its initial state. </summary>
+        void Reset();
+
+        /// <summary> Appends a span of bytes to the stream being hashed. </summary>
+        void Update(const void* data, size_t sizeBytes);
+
+        /// <summary> Appends the characters of a string view to the stream being hashed. </summary>
+        void Update(std::string_view text) { Update(text.data(), text.size()); }
+
+        /// <summary> Appends the object representation of a trivially-copyable value to the
+        /// stream being hashed. </summary>
+        template <typename T, std::enable_if_t<std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>, int> = 0>
+        void Update(const T& value)
+        {
+            Update(&value, sizeof(T));
+        }
+
+        /// <summary> Returns the digest of everything appended so far. </summary>
+        ContentHash128 Finish() const;
+
+    private:
+        void ProcessStripe(const unsigned char* stripe);
+
+        uint64_t _accumulators[4];
+        unsigned char _buffer[32];
+        size_t _bufferedBytes = 0;
+        uint64_t _totalBytes = 0;
+    };
+
+    /// <summary> Convenience one-shot hash of a span of bytes. </summary>
+    ContentHash128 HashContent(const void* data, size_t sizeBytes);
+
+    /// <summary> Convenience one-shot hash of the characters of a string view. </summary>
+    inline ContentHash128 HashContent(std::string_view text)
+    {
+        return HashContent(text.data(), text.size());
+    }
+
+} // namespace utilities
+} // namespace accera
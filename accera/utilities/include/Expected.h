@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Exception.h"
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace accera
+{
+namespace utilities
+{
+    /// <summary> An error descriptor holding an error code and a lazily-formatted message.
+    /// The formatter only runs if the error is actually surfaced (thrown or printed), so
+    /// validation code on hot paths pays nothing for message construction on success. </summary>
+    template <typename ErrorCodeType>
+    struct ErrorInfo
+    {
+        ErrorCodeType errorCode;
+        std::function<std::string()> formatMessage;
+
+        std::string GetMessage() const { return formatMessage ? formatMessage() : std::string{}; }
+
+        [[noreturn]] void Throw() const { throw ErrorCodeException<ErrorCodeType>(errorCode, GetMessage()); }
+    };
+
+    /// <summary> A value-or-error result type for validation paths that are too hot to use
+    /// exceptions as flow control. Callers that can recover test and branch; API boundaries
+    /// call ValueOrThrow() to convert the error into the usual ErrorCodeException. </summary>
+    template <typename T, typename ErrorCodeType = InputExceptionErrors>
+    class Expected
+    {
+    public:
+        Expected(T value) :
+            _contents(std::move(value)) {}
+
+        Expected(ErrorInfo<ErrorCodeType> error) :
+            _contents(std::move(error)) {}
+
+        /// <summary> Creates a failed result. The message formatter is only invoked if the
+        /// error is surfaced. </summary>
+        static Expected MakeError(ErrorCodeType errorCode, std::function<std::string()> formatMessage = {})
+        {
+            return Expected(ErrorInfo<ErrorCodeType>{ errorCode, std::move(formatMessage) });
+        }
+
+        bool HasValue() const { return std::holds_alternative<T>(_contents); }
+        explicit operator bool() const { return HasValue(); }
+
+        /// <summary> Gets the value. Only valid when HasValue() is true. </summary>
+        T& Value() { return std::get<T>(_contents); }
+        const T& Value() const { return std::get<T>(_contents); }
+
+        /// <summary> Gets the error info. Only valid when HasValue() is false. </summary>
+        const ErrorInfo<ErrorCodeType>& Error() const { return std::get<ErrorInfo<ErrorCodeType>>(_contents); }
+
+        /// <summary> Returns the value, or throws the deferred error as an ErrorCodeException.
+        /// This is the API-boundary conversion back to the library's exception conventions. </summary>
+        T& ValueOrThrow()
+        {
+            if (!HasValue())
+            {
+                Error().Throw();
+            }
+            return Value();
+        }
+
+        const T& ValueOrThrow() const
+        {
+            if (!HasValue())
+            {
+                Error().Throw();
+            }
+            return Value();
+        }
+
+    private:
+        std::variant<T, ErrorInfo<ErrorCodeType>> _contents;
+    };
+
+    /// <summary> A success/error result for validation routines with no value to return. </summary>
+    template <typename ErrorCodeType = InputExceptionErrors>
+    using ValidationResult = Expected<std::monostate, ErrorCodeType>;
+
+    /// <summary> The successful result for a ValidationResult-returning routine. </summary>
+    inline std::monostate ValidationSuccess()
+    {
+        return {};
+    }
+
+} // namespace utilities
+} // namespace accera
@@ -65,7 +65,11 @@ namespace utilities
         /// Log() = f;
         /// ```
         ///
-        /// NB: The reference is thread-safe, the underlying object may not be.
+        /// NB: The default log target buffers writes in per-thread rings drained to stdout by a
+        /// background thread, so logging from concurrent threads is safe and cheap; output from
+        /// different threads interleaves at drain granularity rather than mid-write. Assigning a
+        /// replacement stream (as above) bypasses the buffering and writes synchronously; the
+        /// replacement object may not be thread-safe.
         /// </summary>
         ///
         /// <returns> Returns a reference to a global OutputStreamImpostor object </returns>
@@ -27,14 +27,153 @@ namespace utilities
         int64_t offset{};
     };
 
+    /// <summary> Storage for DimensionVector: a vector of int64_t that keeps up to 6 elements
+    /// inline. Layouts are created and copied constantly during nest construction and lowering,
+    /// and nearly all of them have rank 6 or less, so inline storage keeps those copies off the
+    /// heap; higher ranks spill to a heap buffer transparently. </summary>
+    class InlineInt64Vector
+    {
+    public:
+        static constexpr size_t InlineCapacity = 6;
+
+        using iterator = int64_t*;
+        using const_iterator = const int64_t*;
+
+        InlineInt64Vector() = default;
+
+        template <typename InputIt>
+        InlineInt64Vector(InputIt first, InputIt last)
+        {
+            reserve(static_cast<size_t>(std::distance(first, last)));
+            for (; first != last; ++first)
+            {
+                _data[_count++] = static_cast<int64_t>(*first);
+            }
+        }
+
+        InlineInt64Vector(const InlineInt64Vector& other) :
+            InlineInt64Vector(other.begin(), other.end()) {}
+
+        InlineInt64Vector(InlineInt64Vector&& other) noexcept { MoveFrom(std::move(other)); }
+
+        InlineInt64Vector& operator=(const InlineInt64Vector& other)
+        {
+            if (this != &other)
+            {
+                _count = 0;
+                reserve(other._count);
+                std::copy(other.begin(), other.end(), _data);
+                _count = other._count;
+            }
+            return *this;
+        }
+
+        InlineInt64Vector& operator=(InlineInt64Vector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                ReleaseHeap();
+                MoveFrom(std::move(other));
+            }
+            return *this;
+        }
+
+        ~InlineInt64Vector() { ReleaseHeap(); }
+
+        size_t size() const { return _count; }
+        bool empty() const { return _count == 0; }
+
+        int64_t operator[](size_t index) const { return _data[index]; }
+        int64_t& operator[](size_t index) { return _data[index]; }
+
+        iterator begin() { return _data; }
+        const_iterator begin() const { return _data; }
+        const_iterator cbegin() const { return _data; }
+        iterator end() { return _data + _count; }
+        const_iterator end() const { return _data + _count; }
+        const_iterator cend() const { return _data + _count; }
+
+        void reserve(size_t capacity)
+        {
+            if (capacity <= _capacity)
+            {
+                return;
+            }
+            auto newCapacity = std::max(capacity, _capacity * 2);
+            auto* newData = new int64_t[newCapacity];
+            std::copy(_data, _data + _count, newData);
+            ReleaseHeap();
+            _data = newData;
+            _capacity = newCapacity;
+        }
+
+        void push_back(int64_t value)
+        {
+            reserve(_count + 1);
+            _data[_count++] = value;
+        }
+
+        iterator insert(iterator position, size_t count, int64_t value)
+        {
+            auto index = static_cast<size_t>(position - begin());
+            reserve(_count + count);
+            std::move_backward(_data + index, _data + _count, _data + _count + count);
+            std::fill(_data + index, _data + index + count, value);
+            _count += count;
+            return _data + index;
+        }
+
+        iterator erase(iterator position)
+        {
+            std::move(position + 1, end(), position);
+            --_count;
+            return position;
+        }
+
+    private:
+        void MoveFrom(InlineInt64Vector&& other) noexcept
+        {
+            if (other._data != other._inlineData)
+            {
+                _data = other._data;
+                _capacity = other._capacity;
+                other._data = other._inlineData;
+                other._capacity = InlineCapacity;
+            }
+            else
+            {
+                _data = _inlineData;
+                _capacity = InlineCapacity;
+                std::copy(other._data, other._data + other._count, _data);
+            }
+            _count = other._count;
+            other._count = 0;
+        }
+
+        void ReleaseHeap()
+        {
+            if (_data != _inlineData)
+            {
+                delete[] _data;
+                _data = _inlineData;
+                _capacity = InlineCapacity;
+            }
+        }
+
+        int64_t _inlineData[InlineCapacity] = {};
+        int64_t* _data = _inlineData;
+        size_t _capacity = InlineCapacity;
+        size_t _count = 0;
+    };
+
     /// <summary> An abstract base class for DimensionOrder,  MemoryShape, and MemoryCoordinates. </summary>
     class DimensionVector
     {
     public:
         /// <summary> Convert to a std::vector of integers. </summary>
         ///
-        /// <returns> The elements as a std::vector. </returns>
-        const std::vector<int64_t>& ToVector() const { return _data; }
+        /// <returns> The elements copied into a std::vector. </returns>
+        std::vector<int64_t> ToVector() const { return { _data.begin(), _data.end() }; }
 
         /// <summary> Element access operator. </summary>
         int64_t operator[](int64_t index) const { return _data[index]; }
@@ -58,8 +197,8 @@ namespace utilities
         auto end() { return _data.end(); }
         auto end() const { return _data.cend(); }
 
-        using iterator = std::vector<int64_t>::iterator;
-        using const_iterator = std::vector<int64_t>::const_iterator;
+        using iterator = InlineInt64Vector::iterator;
+        using const_iterator = InlineInt64Vector::const_iterator;
 
     protected:
         DimensionVector() = default;
@@ -83,7 +222,7 @@ namespace utilities
             ApplyToEach(addIndex, indices...);
         }
 
-        std::vector<int64_t> _data;
+        InlineInt64Vector _data;
     };
 
     class MemoryShape;
@@ -498,6 +637,19 @@ namespace utilities
             copy._memorySpace = space;
             return copy;
         }
+
+        /// <summary> The guaranteed base-address alignment in bytes (0 when unspecified). </summary>
+        int64_t GetAlignment() const { return _alignmentBytes; }
+
+        /// <summary> Returns a copy of this layout carrying a guaranteed base-address alignment.
+        /// Internal allocations honor the alignment; for external buffers it is asserted at
+        /// function entry, so the vectorizer may emit aligned accesses against it. </summary>
+        MemoryLayout SetAlignment(int64_t alignmentBytes) const
+        {
+            auto copy = *this;
+            copy._alignmentBytes = alignmentBytes;
+            return copy;
+        }
         //
         // Converting between logical and physical dimensions
         //
@@ -544,6 +696,33 @@ namespace utilities
         /// The dimension order of the new memory layout has also been adjusted accordingly. </returns>
         MemoryLayout GetSplitDimensionLayout(int dimension, int innerSize) const;
 
+        /// <summary> Creates a new MemoryLayout with the specified dimension blocked: split into an
+        /// outer dimension, kept in place, and an inner dimension of the given block size that is
+        /// stored physically innermost. </summary>
+        ///
+        /// <param name="dimension"> The dimension to block </param>
+        /// <param name="blockSize"> The extent of the inner block dimension </param>
+        /// <returns> A new memory layout with one more dimension, where the inner block is appended
+        /// as the last logical dimension and occupies the unit-stride physical position. </returns>
+        /// <remarks> Unlike `GetSplitDimensionLayout`, which reinterprets the same storage, the
+        /// blocked layout is a different storage arrangement, intended for newly-declared arrays
+        /// and caches: blocking the channel dimension of an NCHW layout yields NCHWc, and blocking
+        /// both dimensions of a matrix yields a tile-major operand. Blocking composes, with each
+        /// application nesting a new innermost block. </remarks>
+        MemoryLayout GetBlockedLayout(int dimension, int64_t blockSize) const;
+
+        /// <summary> Creates a new MemoryLayout with the same active shape, but whose strides for
+        /// every dimension other than the physically-innermost one are resolved at runtime. </summary>
+        ///
+        /// <returns> A new memory layout with runtime leading strides. </returns>
+        /// <remarks> Intended for function arguments that are views into larger buffers: the caller
+        /// supplies the actual strides at the call site, so a sub-tile of a bigger tensor can be
+        /// passed directly instead of being copied into a dense staging buffer first. The innermost
+        /// dimension keeps its build-time increment, so elements along it remain contiguous. The
+        /// layout must be fixed-size and unpadded, because the parent buffer's extents are not
+        /// known until runtime. </remarks>
+        MemoryLayout GetRuntimeStridedLayout() const;
+
         /// <summary> Creates a new MemoryLayout with the same memory layout, but with the specified dimension sliced out </summary>
         ///
         /// <param name="dimension"> The dimension to slice out </param>
@@ -564,6 +743,23 @@ namespace utilities
         /// in a layout of size `{1,1,2,3,4}`.
         MemoryLayout CopyWithExtraDimensions(int addedDimensions) const;
 
+        /// <summary> Creates a new MemoryLayout with the physically-innermost extent padded to a
+        /// conflict-free value. </summary>
+        ///
+        /// <param name="elementSizeBytes"> The size in bytes of one element. </param>
+        /// <param name="cacheLineBytes"> The target's cache line size in bytes. </param>
+        /// <param name="criticalStrideBytes"> The stride at which successive rows alias the same
+        ///   cache sets, i.e. cache size divided by associativity. The default covers the common
+        ///   32KB 8-way L1. </param>
+        /// <returns> A new memory layout whose row stride has been bumped by one cache line when
+        /// the original stride was a multiple of the critical stride, and an unchanged copy
+        /// otherwise. </returns>
+        /// <remarks> Power-of-two row strides (512, 1024, 2048 elements at 4-byte elements) map
+        /// successive rows onto the same sets of a set-associative cache, so walking a column
+        /// evicts its own earlier rows. Padding the innermost extent staggers the rows across
+        /// sets at the cost of one line of memory per row. </remarks>
+        MemoryLayout WithConflictFreePadding(int64_t elementSizeBytes, int64_t cacheLineBytes = 64, int64_t criticalStrideBytes = 4096) const;
+
         /// <summary> If the layout is contiguous, return a new layout that interprets this block as
         /// a simple one dimensional vector, otherwise throws an exception. </summary>
         MemoryLayout Flatten() const;
@@ -592,6 +788,7 @@ namespace utilities
         DimensionOrder _dimensionOrder;
 
         MemorySpace _memorySpace = MemorySpace::None;
+        int64_t _alignmentBytes = 0; // guaranteed base-address alignment; 0 = unspecified
     };
 
     /// <summary> Helper value to denote a scalar (degree 0) memory layout </summary>
@@ -9,17 +9,24 @@
 #include "StringUtil.h"
 
 #include <any>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <type_traits>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace accera
 {
 namespace utilities
 {
-    /// <summary> PropertyBag: A metadata class consisting of a string -> Variant map </summary>
+    /// <summary> PropertyBag: A metadata class consisting of a string -> Variant map.
+    ///
+    /// Entries live in a flat array alongside their precomputed key hashes; small bags are
+    /// served by a linear scan of the hash array, and bags that outgrow that get an
+    /// open-addressing index on the side. Keys are taken as `string_view` so querying with a
+    /// string literal doesn't allocate. </summary>
     class PropertyBag
     {
     public:
@@ -32,14 +39,14 @@ namespace utilities
         /// <param name="key"> The key to use for the metadata. </param>
         /// <param name="value"> The value to set for the given key. </param>
         template <typename ValueType>
-        void SetEntry(const std::string& key, ValueType value);
+        void SetEntry(std::string_view key, ValueType value);
 
         /// <summary> Get the metadata for a given key. </summary>
         ///
         /// <param name="key"> The key for the metadata. </param>
         ///
         /// <returns> A const reference to the value for the given key, returned as a `Variant`. </returns>
-        const Variant& GetEntry(const std::string& key) const;
+        const Variant& GetEntry(std::string_view key) const;
 
         /// <summary> Get the metadata for a given key. </summary>
         ///
@@ -47,7 +54,7 @@ namespace utilities
         ///
         /// <returns> A const reference to the value for the given key. </returns>
         template <typename ValueType>
-        const ValueType& GetEntry(const std::string& key) const;
+        const ValueType& GetEntry(std::string_view key) const;
 
         /// <summary> Get the metadata for a given key. </summary>
         ///
@@ -56,7 +63,7 @@ namespace utilities
         ///
         /// <returns> A const reference to the value for the given key. </returns>
         template <typename ValueType>
-        const ValueType& GetEntry(const std::string& key, const ValueType& defaultValue) const;
+        const ValueType& GetEntry(std::string_view key, const ValueType& defaultValue) const;
 
         /// <summary> Get the typed metadata for a given key, parsing the value if it is stored as a string. </summary>
         ///
@@ -64,7 +71,7 @@ namespace utilities
         ///
         /// <returns> A const reference to the value for the given key. </returns>
         template <typename ValueType>
-        ValueType GetOrParseEntry(const std::string& key, std::function<ValueType(const std::string&)> parse = FromString<ValueType>) const;
+        ValueType GetOrParseEntry(std::string_view key, std::function<ValueType(const std::string&)> parse = FromString<ValueType>) const;
 
         /// <summary> Get the typed metadata for a given key, parsing the value if it is stored as a string. </summary>
         ///
@@ -73,28 +80,29 @@ namespace utilities
         ///
         /// <returns> A const reference to the value for the given key. </returns>
         template <typename ValueType>
-        ValueType GetOrParseEntry(const std::string& key, const ValueType& defaultValue, std::function<ValueType(const std::string&)> parse = FromString<ValueType>) const;
+        ValueType GetOrParseEntry(std::string_view key, const ValueType& defaultValue, std::function<ValueType(const std::string&)> parse = FromString<ValueType>) const;
 
         /// <summary> Find the given key and return its value (and add the key if it is not defined). </summary>
         ///
         /// <param name="key"> The key to add to the metadata. </param>
         ///
-        /// <returns> A Variant reference you can update. </returns>
-        Variant& operator[](const std::string& key);
+        /// <returns> A Variant reference you can update. The reference is invalidated by a
+        /// subsequent insertion into the bag. </returns>
+        Variant& operator[](std::string_view key);
 
         /// <summary> Removes metadata for the given key. </summary>
         ///
         /// <param name="key"> The key to use for the metadata. </param>
         ///
         /// <returns> The entry that was removed, or an empty `Variant` if none was present. </returns>
-        Variant RemoveEntry(const std::string& key);
+        Variant RemoveEntry(std::string_view key);
 
         /// <summary> Checks if there is a metadata entry for the given key. </summary>
         ///
         /// <param name="key"> The key to check for. </param>
         ///
         /// <returns> true if there is any metadata set for the given key. </returns>
-        bool HasEntry(const std::string& key) const;
+        bool HasEntry(std::string_view key) const;
 
         /// <summary> Checks if the property bag is empty. </summary>
         ///
@@ -102,7 +110,7 @@ namespace utilities
         bool IsEmpty() const;
 
         /// <summary> Removes all entries from the property bag. </summary>
-        void Clear() { _metadata.clear(); }
+        void Clear();
 
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
@@ -114,20 +122,118 @@ namespace utilities
         /// <returns> The list of keys. </returns>
         std::vector<std::string> Keys() const;
 
+        /// <summary> Serializes the property bag into a compact typed binary form (varint/flat layout).
+        /// Supported entry types are bool, int, int64_t, double, std::string, std::vector<int64_t>,
+        /// and std::vector<std::string>; entries holding other types throw. </summary>
+        ///
+        /// <returns> The serialized bytes. </returns>
+        std::vector<uint8_t> ToBinary() const;
+
+        /// <summary> Reconstructs a property bag from the binary form produced by `ToBinary`. </summary>
+        ///
+        /// <param name="data"> The serialized bytes. </param>
+        ///
+        /// <returns> The deserialized property bag. </returns>
+        static PropertyBag FromBinary(const std::vector<uint8_t>& data);
+
         /// <summary> Returns an iterator to the first entry. </summary>
-        auto begin() { return _metadata.begin(); }
+        auto begin() { return _entries.begin(); }
 
         /// <summary> Returns an iterator to the first entry. </summary>
-        auto begin() const { return _metadata.cbegin(); }
+        auto begin() const { return _entries.cbegin(); }
 
         /// <summary> Returns an iterator to a point just past the last entry. </summary>
-        auto end() { return _metadata.end(); }
+        auto end() { return _entries.end(); }
 
         /// <summary> Returns an iterator to a point just past the last entry. </summary>
-        auto end() const { return _metadata.cend(); }
+        auto end() const { return _entries.cend(); }
 
     private:
-        std::unordered_map<std::string, Variant> _metadata;
+        using Entry = std::pair<std::string, Variant>;
+
+        static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+        // Bags at or below this size skip the bucket index and are served by a linear scan
+        // of the (contiguous) hash array
+        static constexpr size_t kLinearScanLimit = 8;
+
+        static uint64_t HashKey(std::string_view key);
+        size_t FindEntryIndex(uint64_t hash, std::string_view key) const;
+        Entry& FindOrCreateEntry(std::string_view key);
+        void InsertBucket(uint64_t hash, uint32_t entryIndex);
+        void RebuildBuckets();
+
+        std::vector<Entry> _entries;
+        std::vector<uint64_t> _hashes; // parallel to _entries: the precomputed key hashes
+        std::vector<uint32_t> _buckets; // power-of-two open-addressing index into _entries; empty until the bag outgrows linear scans
+    };
+
+    /// <summary> A non-owning, read-only view over a `PropertyBag`. A view is a single pointer,
+    /// so pass it by value instead of taking a defensive copy of the bag; a default-constructed
+    /// view behaves like an empty bag. The view must not outlive the bag it refers to. </summary>
+    class PropertyBagView
+    {
+    public:
+        using Variant = PropertyBag::Variant;
+
+        PropertyBagView() = default;
+        PropertyBagView(const PropertyBag& bag) :
+            _bag(&bag) {}
+
+        /// <summary> Get the metadata for a given key (throws if the key isn't present). </summary>
+        const Variant& GetEntry(std::string_view key) const { return Bag().GetEntry(key); }
+
+        /// <summary> Get the metadata for a given key (throws if the key isn't present). </summary>
+        template <typename ValueType>
+        const ValueType& GetEntry(std::string_view key) const
+        {
+            return Bag().GetEntry<ValueType>(key);
+        }
+
+        /// <summary> Get the metadata for a given key, or the given default if it isn't present. </summary>
+        template <typename ValueType>
+        const ValueType& GetEntry(std::string_view key, const ValueType& defaultValue) const
+        {
+            return Bag().GetEntry<ValueType>(key, defaultValue);
+        }
+
+        /// <summary> Get the typed metadata for a given key, parsing the value if it is stored as a string. </summary>
+        template <typename ValueType>
+        ValueType GetOrParseEntry(std::string_view key, std::function<ValueType(const std::string&)> parse = FromString<ValueType>) const
+        {
+            return Bag().GetOrParseEntry<ValueType>(key, parse);
+        }
+
+        /// <summary> Get the typed metadata for a given key, parsing the value if it is stored as a string. </summary>
+        template <typename ValueType>
+        ValueType GetOrParseEntry(std::string_view key, const ValueType& defaultValue, std::function<ValueType(const std::string&)> parse = FromString<ValueType>) const
+        {
+            return Bag().GetOrParseEntry<ValueType>(key, defaultValue, parse);
+        }
+
+        /// <summary> Checks if there is a metadata entry for the given key. </summary>
+        bool HasEntry(std::string_view key) const { return Bag().HasEntry(key); }
+
+        /// <summary> Checks if the viewed property bag is empty. </summary>
+        bool IsEmpty() const { return Bag().IsEmpty(); }
+
+        /// <summary> Gets the list of keys. </summary>
+        std::vector<std::string> Keys() const { return Bag().Keys(); }
+
+        /// <summary> Returns an iterator to the first entry. </summary>
+        auto begin() const { return Bag().begin(); }
+
+        /// <summary> Returns an iterator to a point just past the last entry. </summary>
+        auto end() const { return Bag().end(); }
+
+    private:
+        const PropertyBag& Bag() const
+        {
+            static const PropertyBag empty;
+            return _bag ? *_bag : empty;
+        }
+
+        const PropertyBag* _bag = nullptr;
     };
 } // namespace utilities
 } // namespace accera
@@ -139,22 +245,22 @@ namespace accera
 namespace utilities
 {
     template <typename ValueType>
-    void PropertyBag::SetEntry(const std::string& key, ValueType value)
+    void PropertyBag::SetEntry(std::string_view key, ValueType value)
     {
-        _metadata[key] = Variant(value);
+        FindOrCreateEntry(key).second = Variant(std::move(value));
     }
 
     template <>
-    inline void PropertyBag::SetEntry(const std::string& key, const char* value)
+    inline void PropertyBag::SetEntry(std::string_view key, const char* value)
     {
-        _metadata[key] = Variant(std::string(value));
+        FindOrCreateEntry(key).second = Variant(std::string(value));
     }
 
     template <typename ValueType>
-    const ValueType& PropertyBag::GetEntry(const std::string& key) const
+    const ValueType& PropertyBag::GetEntry(std::string_view key) const
     {
         // This function throws an exception if there aren't any entries for the key, or if the underlying Variant doesn't contain a value of the correct type
-        const auto& variant = _metadata.at(key);
+        const auto& variant = GetEntry(key);
         const auto* ptr = std::any_cast<ValueType>(&variant);
         if (!ptr)
         {
@@ -164,7 +270,7 @@ namespace utilities
     }
 
     template <typename ValueType>
-    const ValueType& PropertyBag::GetEntry(const std::string& key, const ValueType& defaultValue) const
+    const ValueType& PropertyBag::GetEntry(std::string_view key, const ValueType& defaultValue) const
     {
         if (!HasEntry(key))
         {
@@ -174,9 +280,9 @@ namespace utilities
     }
 
     template <typename ValueType>
-    ValueType PropertyBag::GetOrParseEntry(const std::string& key, std::function<ValueType(const std::string&)> parse) const
+    ValueType PropertyBag::GetOrParseEntry(std::string_view key, std::function<ValueType(const std::string&)> parse) const
     {
-        const auto& variant = _metadata.at(key);
+        const auto& variant = GetEntry(key);
         if (variant.type() == typeid(std::string) && !std::is_same_v<ValueType, std::string>)
         {
             return parse(std::any_cast<std::string>(variant));
@@ -185,7 +291,7 @@ namespace utilities
     }
 
     template <typename ValueType>
-    ValueType PropertyBag::GetOrParseEntry(const std::string& key, const ValueType& defaultValue, std::function<ValueType(const std::string&)> parse) const
+    ValueType PropertyBag::GetOrParseEntry(std::string_view key, const ValueType& defaultValue, std::function<ValueType(const std::string&)> parse) const
     {
         if (!HasEntry(key))
         {
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "MemoryLayout.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace accera
+{
+namespace utilities
+{
+    /// <summary> A fixed-rank, constexpr-capable memory layout for fully static shapes. All
+    /// stride math happens at compile time of the generator, so drivers that declare thousands
+    /// of variants pay nothing per declaration; ToMemoryLayout() materializes an equivalent
+    /// dynamic MemoryLayout in a single pass at the Nest/Array API boundary. Canonical
+    /// (row-major) dimension order, full extent, zero offset — the common case for declared
+    /// variants; anything fancier starts from the dynamic MemoryLayout. </summary>
+    template <size_t N>
+    class StaticMemoryLayout
+    {
+    public:
+        static constexpr size_t Rank = N;
+
+        constexpr StaticMemoryLayout(const std::array<int64_t, N>& sizes) :
+            _size(sizes),
+            _increment(ComputeIncrements(sizes))
+        {}
+
+        /// <summary> Get the number of dimensions. </summary>
+        constexpr int64_t NumDimensions() const { return static_cast<int64_t>(N); }
+
+        /// <summary> Returns the size of the given logical dimension. </summary>
+        constexpr int64_t GetActiveSize(size_t dimension) const { return _size[dimension]; }
+
+        /// <summary> Returns the distance in memory between adjacent elements of the given
+        /// logical dimension. </summary>
+        constexpr int64_t GetIncrement(size_t dimension) const { return _increment[dimension]; }
+
+        /// <summary> Returns the number of elements of allocated memory. </summary>
+        constexpr int64_t GetMemorySize() const
+        {
+            int64_t result = 1;
+            for (size_t dimension = 0; dimension < N; ++dimension)
+            {
+                result *= _size[dimension];
+            }
+            return result;
+        }
+
+        /// <summary> Returns the offset in memory of the entry at the given coordinates. </summary>
+        constexpr int64_t GetEntryOffset(const std::array<int64_t, N>& coordinates) const
+        {
+            int64_t result = 0;
+            for (size_t dimension = 0; dimension < N; ++dimension)
+            {
+                result += coordinates[dimension] * _increment[dimension];
+            }
+            return result;
+        }
+
+        /// <summary> Materializes an equivalent dynamic MemoryLayout. The precomputed increments
+        /// are handed over directly, so nothing is recomputed. </summary>
+        MemoryLayout ToMemoryLayout() const
+        {
+            MemoryShape shape(std::vector<int64_t>(_size.begin(), _size.end()));
+            MemoryShape zeros(std::vector<int64_t>(N, 0));
+            MemoryShape increments(std::vector<int64_t>(_increment.begin(), _increment.end()));
+            return MemoryLayout(shape, shape, zeros, increments);
+        }
+
+        operator MemoryLayout() const { return ToMemoryLayout(); }
+
+        /// <summary> The sizes as a MemoryShape, for APIs that take a shape (e.g. Nest). </summary>
+        MemoryShape GetShape() const
+        {
+            return MemoryShape(std::vector<int64_t>(_size.begin(), _size.end()));
+        }
+
+        operator MemoryShape() const { return GetShape(); }
+
+    private:
+        static constexpr std::array<int64_t, N> ComputeIncrements(const std::array<int64_t, N>& sizes)
+        {
+            std::array<int64_t, N> increments{};
+            int64_t increment = 1;
+            for (size_t dimension = N; dimension-- > 0;)
+            {
+                increments[dimension] = increment;
+                increment *= sizes[dimension];
+            }
+            return increments;
+        }
+
+        std::array<int64_t, N> _size;
+        std::array<int64_t, N> _increment;
+    };
+
+    /// <summary> Convenience maker with the sizes as template arguments:
+    /// `constexpr auto layout = MakeStaticLayout<256, 256, 64>();` </summary>
+    template <int64_t... Sizes>
+    constexpr StaticMemoryLayout<sizeof...(Sizes)> MakeStaticLayout()
+    {
+        return StaticMemoryLayout<sizeof...(Sizes)>({ Sizes... });
+    }
+
+    /// <summary> One dimension of a static iteration domain: a half-open range with a step. </summary>
+    struct StaticRange
+    {
+        int64_t begin = 0;
+        int64_t end = 0;
+        int64_t increment = 1;
+
+        /// <summary> The number of iterations the range performs. </summary>
+        constexpr int64_t NumIterations() const
+        {
+            return (end - begin + increment - 1) / increment;
+        }
+    };
+
+    /// <summary> A fixed-rank, constexpr-capable iteration domain for fully static nests.
+    /// Extents and trip counts are compile-time constants; GetShape() materializes the
+    /// per-dimension iteration counts as a MemoryShape for the Nest API. </summary>
+    template <size_t N>
+    class StaticIterationDomain
+    {
+    public:
+        static constexpr size_t Rank = N;
+
+        constexpr StaticIterationDomain(const std::array<StaticRange, N>& ranges) :
+            _ranges(ranges)
+        {}
+
+        /// <summary> Get the number of dimensions. </summary>
+        constexpr int64_t NumDimensions() const { return static_cast<int64_t>(N); }
+
+        /// <summary> Returns the range of the given dimension. </summary>
+        constexpr const StaticRange& GetRange(size_t dimension) const { return _ranges[dimension]; }
+
+        /// <summary> The total number of iteration-space points. </summary>
+        constexpr int64_t NumIterations() const
+        {
+            int64_t result = 1;
+            for (size_t dimension = 0; dimension < N; ++dimension)
+            {
+                result *= _ranges[dimension].NumIterations();
+            }
+            return result;
+        }
+
+        /// <summary> The per-dimension iteration counts as a MemoryShape, for APIs that take a
+        /// shape (e.g. Nest). </summary>
+        MemoryShape GetShape() const
+        {
+            std::vector<int64_t> counts(N);
+            for (size_t dimension = 0; dimension < N; ++dimension)
+            {
+                counts[dimension] = _ranges[dimension].NumIterations();
+            }
+            return MemoryShape(counts);
+        }
+
+        operator MemoryShape() const { return GetShape(); }
+
+    private:
+        std::array<StaticRange, N> _ranges;
+    };
+
+} // namespace utilities
+} // namespace accera
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace accera
+{
+namespace utilities
+{
+    /// <summary> A handle to a string held in the global intern table. Identifiers that are
+    /// created and compared constantly during lowering (index names, decorated ids) are stored
+    /// once and compared by handle in O(1); the character data is materialized only at
+    /// diagnostics and emission boundaries via str(). Default-constructed handles refer to the
+    /// empty string. </summary>
+    class InternedString
+    {
+    public:
+        InternedString() = default;
+
+        /// <summary> Interns the given text, returning a handle that compares equal to every
+        /// other handle interned from the same characters. </summary>
+        InternedString(std::string_view text);
+        InternedString(const std::string& text) :
+            InternedString(std::string_view(text)) {}
+        InternedString(const char* text) :
+            InternedString(std::string_view(text)) {}
+
+        /// <summary> The interned characters. The reference is stable for the process lifetime. </summary>
+        const std::string& str() const;
+
+        /// <summary> True when this handle refers to the empty string. </summary>
+        bool empty() const { return _handle == 0; }
+
+        /// <summary> The raw handle, for hashing. Handles are assigned in intern order and are
+        /// stable within a process, but carry no meaning across processes. </summary>
+        uint32_t GetHandle() const { return _handle; }
+
+        friend bool operator==(InternedString a, InternedString b) { return a._handle == b._handle; }
+        friend bool operator!=(InternedString a, InternedString b) { return a._handle != b._handle; }
+
+        /// <summary> Lexicographic comparison of the interned characters, for containers whose
+        /// iteration order must not depend on intern order. Costs a string compare when the
+        /// handles differ. </summary>
+        friend bool operator<(InternedString a, InternedString b)
+        {
+            return a._handle != b._handle && a.str() < b.str();
+        }
+
+        friend std::ostream& operator<<(std::ostream& stream, InternedString text)
+        {
+            return stream << text.str();
+        }
+
+    private:
+        uint32_t _handle = 0;
+    };
+
+} // namespace utilities
+} // namespace accera
+
+namespace std
+{
+/// <summary> Implements a hash function for InternedString so it can be used with associative containers. </summary>
+template <>
+struct hash<accera::utilities::InternedString>
+{
+    using argument_type = accera::utilities::InternedString;
+    using result_type = std::size_t;
+
+    result_type operator()(const argument_type& text) const
+    {
+        return static_cast<result_type>(text.GetHandle());
+    }
+};
+} // namespace std
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "StringInterner.h"
+
 #include <functional>
 #include <ostream>
 #include <string>
@@ -54,11 +56,12 @@ namespace utilities
         friend std::string to_string(const UniqueId& id);
 
         /// <summary> String conversion </summary>
-        std::string ToString() const { return _id; }
+        std::string ToString() const { return _id.str(); }
 
     private:
         friend std::hash<UniqueId>;
-        std::string _id = "0";
+        // Interned: ids are compared and hashed far more often than they are printed
+        InternedString _id = InternedString("0");
         static size_t _nextId;
     };
 
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AutoTuner.h"
+#include "Files.h"
+
+#include <sstream>
+
+namespace accera
+{
+namespace utilities
+{
+    namespace
+    {
+        // Cache file format: one entry per line,
+        //   <key>\t<cost>\t<name>=<value>[,<name>=<value>...]
+        // Keys may not contain tabs; parameter names/values may not contain ',' or '='.
+        constexpr char entrySeparator = '\t';
+        constexpr char parameterSeparator = ',';
+        constexpr char valueSeparator = '=';
+    } // namespace
+
+    TuningResultCache::TuningResultCache(const std::string& cacheFilePath) :
+        _cacheFilePath(cacheFilePath)
+    {
+        if (FileExists(_cacheFilePath))
+        {
+            Load();
+        }
+    }
+
+    std::optional<TuningResult> TuningResultCache::Lookup(const std::string& key) const
+    {
+        if (auto it = _entries.find(key); it != _entries.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    void TuningResultCache::Update(const std::string& key, const TuningResult& result)
+    {
+        _entries[key] = result;
+        if (!_cacheFilePath.empty())
+        {
+            Save();
+        }
+    }
+
+    void TuningResultCache::Load()
+    {
+        auto stream = OpenIfstream(_cacheFilePath);
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            std::istringstream lineStream(line);
+            std::string key, costString, parameters;
+            if (!std::getline(lineStream, key, entrySeparator) ||
+                !std::getline(lineStream, costString, entrySeparator) ||
+                !std::getline(lineStream, parameters, entrySeparator))
+            {
+                continue; // malformed entry, ignore
+            }
+
+            TuningResult result;
+            result.cost = std::stod(costString);
+
+            std::istringstream parameterStream(parameters);
+            std::string parameter;
+            while (std::getline(parameterStream, parameter, parameterSeparator))
+            {
+                if (auto pos = parameter.find(valueSeparator); pos != std::string::npos)
+                {
+                    result.parameterValues[parameter.substr(0, pos)] = parameter.substr(pos + 1);
+                }
+            }
+            _entries[key] = result;
+        }
+    }
+
+    void TuningResultCache::Save() const
+    {
+        auto stream = OpenOfstream(_cacheFilePath);
+        for (const auto& [key, result] : _entries)
+        {
+            stream << key << entrySeparator << result.cost << entrySeparator;
+            bool first = true;
+            for (const auto& [name, value] : result.parameterValues)
+            {
+                if (!first)
+                {
+                    stream << parameterSeparator;
+                }
+                stream << name << valueSeparator << value;
+                first = false;
+            }
+            stream << '\n';
+        }
+    }
+} // namespace utilities
+} // namespace accera
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ContentHash.h"
+
+#include <algorithm>
+
+namespace accera
+{
+namespace utilities
+{
+    namespace
+    {
+        // The xxhash64 prime constants; large odd numbers with good bit dispersion
+        constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+        constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+        constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+        constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ull;
+
+        uint64_t RotateLeft(uint64_t value, int bits)
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        uint64_t ReadUint64(const unsigned char* bytes)
+        {
+            uint64_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+            return value;
+        }
+
+        uint64_t Round(uint64_t accumulator, uint64_t lane)
+        {
+            return RotateLeft(accumulator + lane * kPrime2, 31) * kPrime1;
+        }
+
+        uint64_t MergeRound(uint64_t hash, uint64_t accumulator)
+        {
+            return (hash ^ Round(0, accumulator)) * kPrime1 + kPrime4;
+        }
+
+        uint64_t Avalanche(uint64_t hash)
+        {
+            hash ^= hash >> 33;
+            hash *= kPrime2;
+            hash ^= hash >> 29;
+            hash *= kPrime3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+    } // namespace
+
+    std::string ContentHash128::ToString() const
+    {
+        static const char hexDigits[] = "0123456789abcdef";
+        std::string result(32, '0');
+        for (int digit = 0; digit < 16; ++digit)
+        {
+            result[15 - digit] = hexDigits[(high >> (4 * digit)) & 0xF];
+            result[31 - digit] = hexDigits[(low >> (4 * digit)) & 0xF];
+        }
+        return result;
+    }
+
+    ContentHasher::ContentHasher()
+    {
+        Reset();
+    }
+
+    void ContentHasher::Reset()
+    {
+        _accumulators[0] = kPrime1 + kPrime2;
+        _accumulators[1] = kPrime2;
+        _accumulators[2] = 0;
+        _accumulators[3] = 0 - kPrime1;
+        _bufferedBytes = 0;
+        _totalBytes = 0;
+    }
+
+    void ContentHasher::ProcessStripe(const unsigned char* stripe)
+    {
+        _accumulators[0] = Round(_accumulators[0], ReadUint64(stripe));
+        _accumulators[1] = Round(_accumulators[1], ReadUint64(stripe + 8));
+        _accumulators[2] = Round(_accumulators[2], ReadUint64(stripe + 16));
+        _accumulators[3] = Round(_accumulators[3], ReadUint64(stripe + 24));
+    }
+
+    void ContentHasher::Update(const void* data, size_t sizeBytes)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        _totalBytes += sizeBytes;
+
+        if (_bufferedBytes > 0)
+        {
+            auto toCopy = std::min(sizeBytes, sizeof(_buffer) - _bufferedBytes);
+            std::memcpy(_buffer + _bufferedBytes, bytes, toCopy);
+            _bufferedBytes += toCopy;
+            bytes += toCopy;
+            sizeBytes -= toCopy;
+            if (_bufferedBytes < sizeof(_buffer))
+            {
+                return;
+            }
+            ProcessStripe(_buffer);
+            _bufferedBytes = 0;
+        }
+
+        while (sizeBytes >= sizeof(_buffer))
+        {
+            ProcessStripe(bytes);
+            bytes += sizeof(_buffer);
+            sizeBytes -= sizeof(_buffer);
+        }
+
+        if (sizeBytes > 0)
+        {
+            std::memcpy(_buffer, bytes, sizeBytes);
+            _bufferedBytes = sizeBytes;
+        }
+    }
+
+    ContentHash128 ContentHasher::Finish() const
+    {
+        uint64_t hash;
+        if (_totalBytes >= sizeof(_buffer))
+        {
+            hash = RotateLeft(_accumulators[0], 1) + RotateLeft(_accumulators[1], 7) +
+                   RotateLeft(_accumulators[2], 12) + RotateLeft(_accumulators[3], 18);
+            hash = MergeRound(hash, _accumulators[0]);
+            hash = MergeRound(hash, _accumulators[1]);
+            hash = MergeRound(hash, _accumulators[2]);
+            hash = MergeRound(hash, _accumulators[3]);
+        }
+        else
+        {
+            hash = kPrime5;
+        }
+        hash += _totalBytes;
+
+        // Fold in the tail 8 bytes at a time, then byte by byte
+        const auto* tail = _buffer;
+        auto remaining = _bufferedBytes;
+        while (remaining >= 8)
+        {
+            hash = RotateLeft(hash ^ Round(0, ReadUint64(tail)), 27) * kPrime1 + kPrime4;
+            tail += 8;
+            remaining -= 8;
+        }
+        while (remaining > 0)
+        {
+            hash = RotateLeft(hash ^ (*tail * kPrime5), 11) * kPrime1;
+            ++tail;
+            --remaining;
+        }
+
+        // The two halves avalanche the same stream state under different mixing constants, so
+        // they disagree unless the full 128-bit state matches
+        ContentHash128 result;
+        result.low = Avalanche(hash);
+        result.high = Avalanche(RotateLeft(hash, 32) ^ (_accumulators[2] + kPrime3) ^ ((_totalBytes + 1) * kPrime2));
+        return result;
+    }
+
+    ContentHash128 HashContent(const void* data, size_t sizeBytes)
+    {
+        ContentHasher hasher;
+        hasher.Update(data, sizeBytes);
+        return hasher.Finish();
+    }
+
+} // namespace utilities
+} // namespace accera
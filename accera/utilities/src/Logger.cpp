@@ -6,8 +6,17 @@
 
 #include "Logger.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace accera
 {
@@ -15,6 +24,194 @@ namespace utilities
 {
     namespace logging
     {
+        namespace
+        {
+            // Log producers write into a per-thread ring and never touch the sink stream, so
+            // verbose logging inside hot lowering loops costs a memcpy rather than formatted
+            // synchronous I/O; a background thread drains the rings to the sink.
+            class LogRing
+            {
+            public:
+                // Must be a power of two so the head/tail counters can wrap with a mask.
+                // 256KB absorbs the burstiest pass logging between 10ms drains.
+                static constexpr uint64_t Capacity = 1 << 18;
+
+                // Called only by the owning thread
+                void Write(const char* data, uint64_t count)
+                {
+                    auto head = _head.load(std::memory_order_relaxed);
+                    auto tail = _tail.load(std::memory_order_acquire);
+                    if (count > Capacity - (head - tail))
+                    {
+                        // Dropping is preferable to blocking the build; the drain reports the loss
+                        _droppedBytes.fetch_add(count, std::memory_order_relaxed);
+                        return;
+                    }
+                    auto offset = head & (Capacity - 1);
+                    auto firstChunk = std::min(count, Capacity - offset);
+                    std::memcpy(_buffer.get() + offset, data, firstChunk);
+                    std::memcpy(_buffer.get(), data + firstChunk, count - firstChunk);
+                    _head.store(head + count, std::memory_order_release);
+                }
+
+                // Called only by the drain thread
+                void Drain(std::ostream& sink)
+                {
+                    auto tail = _tail.load(std::memory_order_relaxed);
+                    auto head = _head.load(std::memory_order_acquire);
+                    while (tail != head)
+                    {
+                        auto offset = tail & (Capacity - 1);
+                        auto chunk = std::min(head - tail, Capacity - offset);
+                        sink.write(_buffer.get() + offset, static_cast<std::streamsize>(chunk));
+                        tail += chunk;
+                    }
+                    _tail.store(tail, std::memory_order_release);
+
+                    if (auto dropped = _droppedBytes.exchange(0, std::memory_order_relaxed))
+                    {
+                        sink << "[logger] dropped " << dropped << " bytes (ring full)\n";
+                    }
+                }
+
+            private:
+                std::unique_ptr<char[]> _buffer{ new char[Capacity] };
+                std::atomic<uint64_t> _head{ 0 };
+                std::atomic<uint64_t> _tail{ 0 };
+                std::atomic<uint64_t> _droppedBytes{ 0 };
+            };
+
+            class LogDrainThread
+            {
+            public:
+                static LogDrainThread& Instance()
+                {
+                    static LogDrainThread instance;
+                    return instance;
+                }
+
+                // Rings are shared_ptrs so a ring outlives its producer thread until its final
+                // contents have been drained
+                std::shared_ptr<LogRing> RegisterThreadRing()
+                {
+                    auto ring = std::make_shared<LogRing>();
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _rings.push_back(ring);
+                    if (!_thread.joinable())
+                    {
+                        _thread = std::thread([this] { Run(); });
+                    }
+                    return ring;
+                }
+
+                void RequestFlush()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _flushRequested = true;
+                    }
+                    _wakeup.notify_one();
+                }
+
+                ~LogDrainThread()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _done = true;
+                    }
+                    _wakeup.notify_one();
+                    if (_thread.joinable())
+                    {
+                        _thread.join();
+                    }
+                    DrainAll(/*flush=*/true); // whatever arrived after the thread stopped
+                }
+
+            private:
+                void Run()
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    while (!_done)
+                    {
+                        _wakeup.wait_for(lock, std::chrono::milliseconds(10), [this] { return _done || _flushRequested; });
+                        bool flush = _flushRequested || ShouldFlush();
+                        _flushRequested = false;
+                        lock.unlock();
+                        DrainAll(flush);
+                        lock.lock();
+                    }
+                }
+
+                void DrainAll(bool flush)
+                {
+                    std::vector<std::shared_ptr<LogRing>> rings;
+                    {
+                        std::lock_guard<std::mutex> lock(_ringsMutex);
+                        rings = _rings;
+                    }
+                    auto& sink = std::cout;
+                    for (auto& ring : rings)
+                    {
+                        ring->Drain(sink);
+                    }
+                    if (flush)
+                    {
+                        sink << std::flush;
+                    }
+                }
+
+                std::mutex _mutex; // guards _done/_flushRequested and thread startup
+                std::mutex _ringsMutex; // guards _rings only, so registration never blocks a drain wakeup
+                std::condition_variable _wakeup;
+                std::vector<std::shared_ptr<LogRing>> _rings;
+                std::thread _thread;
+                bool _done = false;
+                bool _flushRequested = false;
+            };
+
+            // A streambuf shared by every producer; it keeps no put area so every write lands in
+            // xsputn/overflow, which route to the calling thread's ring
+            class AsyncLogStreamBuf : public std::streambuf
+            {
+            protected:
+                std::streamsize xsputn(const char* data, std::streamsize count) override
+                {
+                    GetThreadRing().Write(data, static_cast<uint64_t>(count));
+                    return count;
+                }
+
+                int overflow(int ch) override
+                {
+                    if (ch != traits_type::eof())
+                    {
+                        char c = static_cast<char>(ch);
+                        GetThreadRing().Write(&c, 1);
+                    }
+                    return ch;
+                }
+
+                int sync() override
+                {
+                    LogDrainThread::Instance().RequestFlush();
+                    return 0;
+                }
+
+            private:
+                static LogRing& GetThreadRing()
+                {
+                    thread_local std::shared_ptr<LogRing> ring = LogDrainThread::Instance().RegisterThreadRing();
+                    return *ring;
+                }
+            };
+
+            std::ostream& AsyncLogStream()
+            {
+                static AsyncLogStreamBuf buffer;
+                static std::ostream stream(&buffer);
+                return stream;
+            }
+        } // namespace
+
         bool& ShouldFlush()
         {
             static bool shouldFlush = false;
@@ -41,7 +238,7 @@ namespace utilities
         OutputStreamImpostor& Log()
         {
             static OutputStreamImpostor nullHandle;
-            static OutputStreamImpostor logHandle{ std::cout };
+            static OutputStreamImpostor logHandle{ AsyncLogStream() };
             if (ShouldLog())
             {
                 return logHandle;
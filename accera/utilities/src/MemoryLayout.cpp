@@ -8,6 +8,7 @@
 #include "Exception.h"
 #include "Hash.h"
 
+#include <algorithm>
 #include <cassert>
 #include <numeric>
 #include <sstream>
@@ -245,6 +246,13 @@ namespace utilities
         }
 
         auto outermostDimension = GetOutermostDimension();
+        if (_extent[outermostDimension] == mlir::ShapedType::kDynamicSize ||
+            _increment[outermostDimension] == mlir::ShapedType::kDynamicStrideOrOffset)
+        {
+            // Runtime-strided layouts span an amount of the parent buffer only known at runtime
+            return mlir::ShapedType::kDynamicSize;
+        }
+
         return static_cast<size_t>(_extent[outermostDimension] * _increment[outermostDimension]);
     }
 
@@ -598,6 +606,62 @@ namespace utilities
                  DimensionOrder{ order } };
     }
 
+    MemoryLayout MemoryLayout::GetBlockedLayout(int dimension, int64_t blockSize) const
+    {
+        BoundsCheckDimensionIndex(dimension);
+        ConstantSizeCheckDimensionIndex(dimension);
+        ThrowIf(_size[dimension] != _extent[dimension], InputExceptionErrors::invalidArgument, "Dimension to block must have full extent");
+        ThrowIf(blockSize <= 0 || _size[dimension] % blockSize != 0, InputExceptionErrors::invalidArgument, "Dimension to block must be a multiple of the block size");
+        ThrowIf(_offset[dimension] != 0, LogicExceptionErrors::illegalState, "Dimension to block should have an offset of 0"); // sanity check
+
+        auto size = _size.ToVector();
+        auto extent = _extent.ToVector();
+        auto offset = _offset.ToVector();
+        auto order = _dimensionOrder.ToVector();
+
+        size[dimension] /= blockSize;
+        extent[dimension] /= blockSize;
+
+        // The inner block becomes the last logical dimension and takes the physically-innermost
+        // position; the increments (and hence the affine map) are regenerated from the blocked
+        // extents and order
+        size.push_back(blockSize);
+        extent.push_back(blockSize);
+        offset.push_back(0);
+        order.push_back(static_cast<int64_t>(order.size()));
+
+        return { MemoryShape{ size },
+                 MemoryShape{ extent },
+                 MemoryShape{ offset },
+                 DimensionOrder{ order } };
+    }
+
+    MemoryLayout MemoryLayout::GetRuntimeStridedLayout() const
+    {
+        if (*this == ScalarLayout || NumDimensions() < 2)
+        {
+            return *this;
+        }
+
+        ThrowIf(IsVariableSized(), InputExceptionErrors::invalidArgument, "Runtime strides require a fixed-size active shape");
+        ThrowIf(HasPadding() || GetFirstEntryOffset() != 0, InputExceptionErrors::invalidArgument, "Runtime strides cannot be combined with build-time padding");
+
+        // Keep the innermost increment so elements along the fastest-changing dimension remain
+        // contiguous; every other stride (and the corresponding extent) becomes a runtime value
+        // supplied by the caller's view.
+        auto copy = *this;
+        const auto innermostDimension = GetInnermostDimension();
+        for (int64_t d = 0; d < NumDimensions(); ++d)
+        {
+            if (d != innermostDimension)
+            {
+                copy._increment[d] = mlir::ShapedType::kDynamicStrideOrOffset;
+                copy._extent[d] = mlir::ShapedType::kDynamicSize;
+            }
+        }
+        return copy;
+    }
+
     MemoryLayout MemoryLayout::CopyWithExtraDimensions(int addedDimensions) const
     {
         if (addedDimensions < 0)
@@ -634,6 +698,40 @@ namespace utilities
                  DimensionOrder{ order } };
     }
 
+    MemoryLayout MemoryLayout::WithConflictFreePadding(int64_t elementSizeBytes, int64_t cacheLineBytes, int64_t criticalStrideBytes) const
+    {
+        if (NumDimensions() < 2 || IsVariableSized() || elementSizeBytes <= 0 || criticalStrideBytes <= 0)
+        {
+            return *this;
+        }
+
+        // The physically-innermost logical dimension is the one with unit increment; its extent is
+        // the row stride of the next-outer dimension
+        int innerDimension = -1;
+        for (int d = 0; d < NumDimensions(); ++d)
+        {
+            if (GetIncrement(d) == 1)
+            {
+                innerDimension = d;
+                break;
+            }
+        }
+        if (innerDimension == -1)
+        {
+            return *this;
+        }
+
+        auto rowStrideBytes = GetExtent(innerDimension) * elementSizeBytes;
+        if (rowStrideBytes % criticalStrideBytes != 0)
+        {
+            return *this;
+        }
+
+        auto extent = _extent.ToVector();
+        extent[innerDimension] += std::max<int64_t>(1, cacheLineBytes / elementSizeBytes);
+        return { _size, MemoryShape{ extent }, _offset, _dimensionOrder };
+    }
+
     void MemoryLayout::BoundsCheckDimensionIndex(size_t index) const
     {
         if (static_cast<int>(index) >= NumDimensions())
@@ -9,58 +9,253 @@
 #include "TypeTraits.h"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 
 namespace accera
 {
 namespace utilities
 {
+    namespace
+    {
+        // Binary layout (version 1): version byte, varint entry count, then per entry a
+        // varint-length-prefixed key, a type tag byte, and a typed payload. Integers use
+        // zigzag + LEB128 varints; doubles are raw 8-byte values; strings and vectors are
+        // varint-length-prefixed.
+        constexpr uint8_t kBinaryFormatVersion = 1;
+
+        enum class EntryTag : uint8_t
+        {
+            boolean = 0,
+            int32 = 1,
+            int64 = 2,
+            float64 = 3,
+            string = 4,
+            int64Vector = 5,
+            stringVector = 6
+        };
+
+        void AppendVarint(std::vector<uint8_t>& buffer, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<uint8_t>(value));
+        }
+
+        void AppendSignedVarint(std::vector<uint8_t>& buffer, int64_t value)
+        {
+            AppendVarint(buffer, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        void AppendString(std::vector<uint8_t>& buffer, const std::string& str)
+        {
+            AppendVarint(buffer, str.size());
+            buffer.insert(buffer.end(), str.begin(), str.end());
+        }
+
+        uint64_t ReadVarint(const std::vector<uint8_t>& data, size_t& pos)
+        {
+            uint64_t result = 0;
+            int shift = 0;
+            while (pos < data.size())
+            {
+                uint8_t byte = data[pos++];
+                result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return result;
+                }
+                shift += 7;
+            }
+            throw InputException(InputExceptionErrors::badData, "Truncated varint in serialized PropertyBag");
+        }
+
+        int64_t ReadSignedVarint(const std::vector<uint8_t>& data, size_t& pos)
+        {
+            auto encoded = ReadVarint(data, pos);
+            return static_cast<int64_t>((encoded >> 1) ^ (~(encoded & 1) + 1));
+        }
+
+        std::string ReadString(const std::vector<uint8_t>& data, size_t& pos)
+        {
+            auto length = ReadVarint(data, pos);
+            if (pos + length > data.size())
+            {
+                throw InputException(InputExceptionErrors::badData, "Truncated string in serialized PropertyBag");
+            }
+            std::string result(data.begin() + pos, data.begin() + pos + length);
+            pos += length;
+            return result;
+        }
+    } // namespace
+
+    namespace
+    {
+        constexpr uint32_t kEmptyBucket = std::numeric_limits<uint32_t>::max();
+    } // namespace
 
     //
     // PropertyBag
     //
-    const std::any& PropertyBag::GetEntry(const std::string& key) const
+    uint64_t PropertyBag::HashKey(std::string_view key)
     {
-        return _metadata.at(key);
+        // FNV-1a; keys are short, and the hash is computed once per query and cached per entry
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (unsigned char c : key)
+        {
+            hash ^= c;
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
     }
 
-    std::any& PropertyBag::operator[](const std::string& key)
+    size_t PropertyBag::FindEntryIndex(uint64_t hash, std::string_view key) const
     {
-        return _metadata[key];
+        if (_buckets.empty())
+        {
+            // Small bag: scan the contiguous hash array, only touching the strings on a hash match
+            for (size_t index = 0; index < _hashes.size(); ++index)
+            {
+                if (_hashes[index] == hash && _entries[index].first == key)
+                {
+                    return index;
+                }
+            }
+            return kNotFound;
+        }
+
+        auto mask = _buckets.size() - 1;
+        for (auto slot = static_cast<size_t>(hash) & mask;; slot = (slot + 1) & mask)
+        {
+            auto index = _buckets[slot];
+            if (index == kEmptyBucket)
+            {
+                return kNotFound;
+            }
+            if (_hashes[index] == hash && _entries[index].first == key)
+            {
+                return index;
+            }
+        }
     }
 
-    bool PropertyBag::IsEmpty() const
+    void PropertyBag::InsertBucket(uint64_t hash, uint32_t entryIndex)
     {
-        if (_metadata.empty())
+        auto mask = _buckets.size() - 1;
+        auto slot = static_cast<size_t>(hash) & mask;
+        while (_buckets[slot] != kEmptyBucket)
         {
-            return true;
+            slot = (slot + 1) & mask;
         }
+        _buckets[slot] = entryIndex;
+    }
 
-        return !std::any_of(_metadata.begin(), _metadata.end(), [](const std::any& any) { return any.has_value(); });
+    void PropertyBag::RebuildBuckets()
+    {
+        // Keep the load factor at or below 1/2 so probe sequences stay short
+        size_t capacity = 16;
+        while (capacity < _entries.size() * 2)
+        {
+            capacity *= 2;
+        }
+        _buckets.assign(capacity, kEmptyBucket);
+        for (size_t index = 0; index < _entries.size(); ++index)
+        {
+            InsertBucket(_hashes[index], static_cast<uint32_t>(index));
+        }
+    }
+
+    PropertyBag::Entry& PropertyBag::FindOrCreateEntry(std::string_view key)
+    {
+        auto hash = HashKey(key);
+        auto index = FindEntryIndex(hash, key);
+        if (index == kNotFound)
+        {
+            index = _entries.size();
+            _entries.emplace_back(std::string(key), Variant{});
+            _hashes.push_back(hash);
+            if (_entries.size() * 2 > _buckets.size())
+            {
+                if (_entries.size() > kLinearScanLimit)
+                {
+                    RebuildBuckets();
+                }
+            }
+            else
+            {
+                InsertBucket(hash, static_cast<uint32_t>(index));
+            }
+        }
+        return _entries[index];
     }
 
-    std::any PropertyBag::RemoveEntry(const std::string& key)
+    const std::any& PropertyBag::GetEntry(std::string_view key) const
+    {
+        auto index = FindEntryIndex(HashKey(key), key);
+        if (index == kNotFound)
+        {
+            throw std::out_of_range("PropertyBag: no entry for key '" + std::string(key) + "'");
+        }
+        return _entries[index].second;
+    }
+
+    std::any& PropertyBag::operator[](std::string_view key)
+    {
+        return FindOrCreateEntry(key).second;
+    }
+
+    bool PropertyBag::IsEmpty() const
+    {
+        return !std::any_of(_entries.begin(), _entries.end(), [](const Entry& entry) { return entry.second.has_value(); });
+    }
+
+    std::any PropertyBag::RemoveEntry(std::string_view key)
     {
         Variant result;
-        auto keyIter = _metadata.find(key);
-        if (keyIter != _metadata.end())
+        auto index = FindEntryIndex(HashKey(key), key);
+        if (index != kNotFound)
         {
-            result = keyIter->second;
-            _metadata.erase(keyIter);
+            result = std::move(_entries[index].second);
+            _entries.erase(_entries.begin() + index);
+            _hashes.erase(_hashes.begin() + index);
+            if (!_buckets.empty())
+            {
+                // The indices of everything past the erased entry just shifted down
+                if (_entries.size() <= kLinearScanLimit)
+                {
+                    _buckets.clear();
+                }
+                else
+                {
+                    RebuildBuckets();
+                }
+            }
         }
         return result;
     }
 
-    bool PropertyBag::HasEntry(const std::string& key) const
+    bool PropertyBag::HasEntry(std::string_view key) const
     {
-        auto keyIter = _metadata.find(key);
-        return (keyIter != _metadata.end()) && (keyIter->second.has_value());
+        auto index = FindEntryIndex(HashKey(key), key);
+        return (index != kNotFound) && (_entries[index].second.has_value());
+    }
+
+    void PropertyBag::Clear()
+    {
+        _entries.clear();
+        _hashes.clear();
+        _buckets.clear();
     }
 
     std::vector<std::string> PropertyBag::Keys() const
     {
         std::vector<std::string> result;
-        result.reserve(_metadata.size());
-        for (const auto& keyValue : _metadata)
+        result.reserve(_entries.size());
+        for (const auto& keyValue : _entries)
         {
             if (keyValue.second.has_value())
             {
@@ -70,5 +265,153 @@ namespace utilities
         return result;
     }
 
+    std::vector<uint8_t> PropertyBag::ToBinary() const
+    {
+        std::vector<uint8_t> buffer;
+        buffer.push_back(kBinaryFormatVersion);
+
+        std::vector<std::string> keys = Keys();
+        std::sort(keys.begin(), keys.end()); // deterministic output independent of map order
+        AppendVarint(buffer, keys.size());
+
+        for (const auto& key : keys)
+        {
+            const auto& variant = GetEntry(key);
+            AppendString(buffer, key);
+            if (variant.type() == typeid(bool))
+            {
+                buffer.push_back(static_cast<uint8_t>(EntryTag::boolean));
+                buffer.push_back(std::any_cast<bool>(variant) ? 1 : 0);
+            }
+            else if (variant.type() == typeid(int))
+            {
+                buffer.push_back(static_cast<uint8_t>(EntryTag::int32));
+                AppendSignedVarint(buffer, std::any_cast<int>(variant));
+            }
+            else if (variant.type() == typeid(int64_t))
+            {
+                buffer.push_back(static_cast<uint8_t>(EntryTag::int64));
+                AppendSignedVarint(buffer, std::any_cast<int64_t>(variant));
+            }
+            else if (variant.type() == typeid(double))
+            {
+                buffer.push_back(static_cast<uint8_t>(EntryTag::float64));
+                auto value = std::any_cast<double>(variant);
+                uint8_t raw[sizeof(double)];
+                std::memcpy(raw, &value, sizeof(double));
+                buffer.insert(buffer.end(), raw, raw + sizeof(double));
+            }
+            else if (variant.type() == typeid(std::string))
+            {
+                buffer.push_back(static_cast<uint8_t>(EntryTag::string));
+                AppendString(buffer, std::any_cast<const std::string&>(variant));
+            }
+            else if (variant.type() == typeid(std::vector<int64_t>))
+            {
+                buffer.push_back(static_cast<uint8_t>(EntryTag::int64Vector));
+                const auto& values = std::any_cast<const std::vector<int64_t>&>(variant);
+                AppendVarint(buffer, values.size());
+                for (auto value : values)
+                {
+                    AppendSignedVarint(buffer, value);
+                }
+            }
+            else if (variant.type() == typeid(std::vector<std::string>))
+            {
+                buffer.push_back(static_cast<uint8_t>(EntryTag::stringVector));
+                const auto& values = std::any_cast<const std::vector<std::string>&>(variant);
+                AppendVarint(buffer, values.size());
+                for (const auto& value : values)
+                {
+                    AppendString(buffer, value);
+                }
+            }
+            else
+            {
+                throw InputException(InputExceptionErrors::invalidArgument, "PropertyBag entry '" + key + "' holds a type without a binary encoding");
+            }
+        }
+        return buffer;
+    }
+
+    PropertyBag PropertyBag::FromBinary(const std::vector<uint8_t>& data)
+    {
+        size_t pos = 0;
+        if (data.empty() || data[pos++] != kBinaryFormatVersion)
+        {
+            throw InputException(InputExceptionErrors::badData, "Unrecognized serialized PropertyBag version");
+        }
+
+        PropertyBag result;
+        auto entryCount = ReadVarint(data, pos);
+        for (uint64_t entryIdx = 0; entryIdx < entryCount; ++entryIdx)
+        {
+            auto key = ReadString(data, pos);
+            if (pos >= data.size())
+            {
+                throw InputException(InputExceptionErrors::badData, "Truncated entry in serialized PropertyBag");
+            }
+            auto tag = static_cast<EntryTag>(data[pos++]);
+            switch (tag)
+            {
+            case EntryTag::boolean:
+                if (pos >= data.size())
+                {
+                    throw InputException(InputExceptionErrors::badData, "Truncated entry in serialized PropertyBag");
+                }
+                result.SetEntry(key, data[pos++] != 0);
+                break;
+            case EntryTag::int32:
+                result.SetEntry(key, static_cast<int>(ReadSignedVarint(data, pos)));
+                break;
+            case EntryTag::int64:
+                result.SetEntry(key, ReadSignedVarint(data, pos));
+                break;
+            case EntryTag::float64:
+            {
+                if (pos + sizeof(double) > data.size())
+                {
+                    throw InputException(InputExceptionErrors::badData, "Truncated entry in serialized PropertyBag");
+                }
+                double value;
+                std::memcpy(&value, data.data() + pos, sizeof(double));
+                pos += sizeof(double);
+                result.SetEntry(key, value);
+                break;
+            }
+            case EntryTag::string:
+                result.SetEntry(key, ReadString(data, pos));
+                break;
+            case EntryTag::int64Vector:
+            {
+                auto count = ReadVarint(data, pos);
+                std::vector<int64_t> values;
+                values.reserve(count);
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    values.push_back(ReadSignedVarint(data, pos));
+                }
+                result.SetEntry(key, values);
+                break;
+            }
+            case EntryTag::stringVector:
+            {
+                auto count = ReadVarint(data, pos);
+                std::vector<std::string> values;
+                values.reserve(count);
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    values.push_back(ReadString(data, pos));
+                }
+                result.SetEntry(key, values);
+                break;
+            }
+            default:
+                throw InputException(InputExceptionErrors::badData, "Unknown entry tag in serialized PropertyBag");
+            }
+        }
+        return result;
+    }
+
 } // namespace utilities
 } // namespace accera
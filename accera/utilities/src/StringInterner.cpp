@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "StringInterner.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace accera
+{
+namespace utilities
+{
+    namespace
+    {
+        // The global intern table. A deque keeps the interned strings' addresses stable so str()
+        // can hand out references for the process lifetime; the map's keys view into the deque's
+        // storage, so no string is held twice.
+        class InternTable
+        {
+        public:
+            static InternTable& Global()
+            {
+                static InternTable table;
+                return table;
+            }
+
+            uint32_t Intern(std::string_view text)
+            {
+                if (text.empty())
+                {
+                    return 0;
+                }
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = _handles.find(text);
+                if (it != _handles.end())
+                {
+                    return it->second;
+                }
+                _strings.emplace_back(text);
+                auto handle = static_cast<uint32_t>(_strings.size() - 1);
+                _handles.emplace(_strings.back(), handle);
+                return handle;
+            }
+
+            const std::string& Lookup(uint32_t handle)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _strings[handle];
+            }
+
+        private:
+            InternTable()
+            {
+                _strings.emplace_back(); // handle 0 is the empty string
+            }
+
+            std::mutex _mutex;
+            std::deque<std::string> _strings;
+            std::unordered_map<std::string_view, uint32_t> _handles;
+        };
+    } // namespace
+
+    InternedString::InternedString(std::string_view text) :
+        _handle(InternTable::Global().Intern(text))
+    {
+    }
+
+    const std::string& InternedString::str() const
+    {
+        return InternTable::Global().Lookup(_handle);
+    }
+
+} // namespace utilities
+} // namespace accera
@@ -14,13 +14,13 @@ namespace utilities
 
     UniqueId::UniqueId()
     {
-        _id = std::to_string(_nextId);
+        _id = InternedString(std::to_string(_nextId));
         ++_nextId;
     }
 
     UniqueId::UniqueId(const std::string& idString)
     {
-        _id = idString;
+        _id = InternedString(idString);
     }
 
     bool UniqueId::operator==(const UniqueId& other) const
@@ -33,6 +33,8 @@ namespace utilities
         return !(other == *this);
     }
 
+    // Ordering stays lexicographic on the id text so containers keyed by UniqueId keep a
+    // deterministic order that doesn't depend on intern order
     bool UniqueId::operator<(const UniqueId& other) const
     {
         return _id < other._id;
@@ -40,7 +42,7 @@ namespace utilities
 
     bool UniqueId::operator>(const UniqueId& other) const
     {
-        return _id > other._id;
+        return other._id < _id;
     }
 
     std::ostream& operator<<(std::ostream& stream, const UniqueId& id)
@@ -51,12 +53,12 @@ namespace utilities
 
     std::string to_string(const UniqueId& id)
     {
-        return id._id;
+        return id._id.str();
     }
 } // namespace utilities
 } // namespace accera
 
 std::hash<accera::utilities::UniqueId>::result_type std::hash<accera::utilities::UniqueId>::operator()(const argument_type& id) const
 {
-    return std::hash<std::string>()(id._id);
+    return std::hash<accera::utilities::InternedString>()(id._id);
 }
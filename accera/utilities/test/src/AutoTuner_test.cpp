@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch_all.hpp>
+
+#include <utilities/include/AutoTuner.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace accera
+{
+
+using namespace utilities;
+
+TEST_CASE("AutoTuner_test1")
+{
+    std::vector<int> mValues{ 2, 4, 6 };
+    std::vector<int> nValues{ 3, 5 };
+    TunableParameter m(mValues, "m");
+    TunableParameter n(nValues, "n");
+    TuningEngine engine(m, n);
+    TuningResultCache cache;
+    AutoTuner tuner(engine, cache);
+
+    int evaluations = 0;
+    auto cost = [&] {
+        ++evaluations;
+        // minimized at m = 6, n = 3
+        return static_cast<double>((6 - (int)m) * (6 - (int)m) + (int)n);
+    };
+
+    auto best = tuner.Run("test/shape1", cost);
+    CHECK(best.IsValid());
+    CHECK(evaluations == 6);
+    CHECK(best.parameterValues.at("m") == "6");
+    CHECK(best.parameterValues.at("n") == "3");
+
+    // second run with the same key should be served from the cache
+    auto cached = tuner.Run("test/shape1", cost);
+    CHECK(evaluations == 6);
+    CHECK(cached.parameterValues == best.parameterValues);
+}
+
+TEST_CASE("AutoTuner_persistence_test")
+{
+    auto cacheFile = std::string("AutoTuner_persistence_test.cache");
+    std::remove(cacheFile.c_str());
+
+    std::vector<int> values{ 1, 2, 3 };
+    {
+        TunableParameter p(values, "p");
+        TuningEngine engine(p);
+        TuningResultCache cache(cacheFile);
+        AutoTuner tuner(engine, cache);
+        tuner.Run("test/shape2", [&] { return 10.0 - (int)p; });
+    }
+
+    // a fresh cache backed by the same file sees the recorded winner
+    TuningResultCache reloaded(cacheFile);
+    auto result = reloaded.Lookup("test/shape2");
+    REQUIRE(result.has_value());
+    CHECK(result->parameterValues.at("p") == "3");
+    CHECK(result->cost == 7.0);
+
+    std::remove(cacheFile.c_str());
+}
+
+TEST_CASE("AutoTuner_infeasible_candidates_test")
+{
+    std::vector<int> values{ 1, 2, 3, 4 };
+    TunableParameter p(values, "p");
+    TuningEngine engine(p);
+    TuningResultCache cache;
+    AutoTuner tuner(engine, cache);
+
+    // even values are infeasible; best feasible candidate is p = 3
+    auto best = tuner.Run("test/shape3", [&]() -> double {
+        if ((int)p % 2 == 0)
+        {
+            throw std::runtime_error("infeasible");
+        }
+        return 10.0 - (int)p;
+    });
+    CHECK(best.IsValid());
+    CHECK(best.parameterValues.at("p") == "3");
+}
+
+} // namespace accera
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Kern Handa
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch_all.hpp>
+
+#include <utilities/include/Expected.h>
+
+namespace accera
+{
+using namespace utilities;
+
+TEST_CASE("TestExpectedValue")
+{
+    Expected<int> result(42);
+    CHECK(result.HasValue());
+    CHECK(static_cast<bool>(result));
+    CHECK(result.Value() == 42);
+    CHECK(result.ValueOrThrow() == 42);
+}
+
+TEST_CASE("TestExpectedError")
+{
+    auto result = Expected<int>::MakeError(InputExceptionErrors::invalidArgument, [] { return "bad argument"; });
+    CHECK(!result.HasValue());
+    CHECK(result.Error().errorCode == InputExceptionErrors::invalidArgument);
+    CHECK(result.Error().GetMessage() == "bad argument");
+    CHECK_THROWS_AS(result.ValueOrThrow(), InputException);
+}
+
+TEST_CASE("TestExpectedLazyFormatting")
+{
+    // The formatter must not run unless the error is surfaced
+    bool formatterRan = false;
+    {
+        auto result = Expected<int>::MakeError(InputExceptionErrors::invalidArgument, [&] {
+            formatterRan = true;
+            return "formatted";
+        });
+        CHECK(!result.HasValue());
+    }
+    CHECK(!formatterRan);
+
+    auto result = Expected<int>::MakeError(InputExceptionErrors::invalidArgument, [&] {
+        formatterRan = true;
+        return "formatted";
+    });
+    try
+    {
+        (void)result.ValueOrThrow();
+        FAIL("expected an InputException");
+    }
+    catch (const InputException& e)
+    {
+        CHECK(e.GetMessage() == "formatted");
+    }
+    CHECK(formatterRan);
+}
+
+TEST_CASE("TestValidationResult")
+{
+    ValidationResult<> ok(ValidationSuccess());
+    CHECK(ok.HasValue());
+
+    auto failed = ValidationResult<>::MakeError(InputExceptionErrors::sizeMismatch);
+    CHECK(!failed.HasValue());
+    CHECK(failed.Error().errorCode == InputExceptionErrors::sizeMismatch);
+    CHECK(failed.Error().GetMessage().empty());
+}
+
+} // namespace accera
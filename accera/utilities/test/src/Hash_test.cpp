@@ -6,8 +6,10 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <utilities/include/ContentHash.h>
 #include <utilities/include/Hash.h>
 
+#include <string>
 #include <tuple>
 #include <utility>
 
@@ -26,4 +28,58 @@ TEST_CASE("Hash")
     REQUIRE(utilities::HashValue(std::vector{ 1, 2, 3 }) != utilities::HashValue(std::vector{ 3, 2, 1 }));
 }
 
+TEST_CASE("ContentHash")
+{
+    using utilities::ContentHasher;
+    using utilities::HashContent;
+
+    const std::string data(1000, 'x');
+
+    SECTION("ChunkingInvariance")
+    {
+        // The digest depends only on the byte sequence, not on how it was fed in
+        ContentHasher oneShot;
+        oneShot.Update(data);
+
+        ContentHasher chunked;
+        for (size_t offset = 0; offset < data.size(); offset += 7)
+        {
+            chunked.Update(data.substr(offset, 7));
+        }
+
+        CHECK(oneShot.Finish() == chunked.Finish());
+        CHECK(oneShot.Finish() == HashContent(data));
+    }
+
+    SECTION("Sensitivity")
+    {
+        auto baseline = HashContent(data);
+        auto flipped = data;
+        flipped[500] = 'y';
+        CHECK(baseline != HashContent(flipped));
+        CHECK(baseline != HashContent(data.substr(0, 999)));
+        CHECK(HashContent("") != HashContent(std::string(1, '\0')));
+        CHECK(HashContent("abc") != HashContent("acb"));
+    }
+
+    SECTION("ToString")
+    {
+        auto hash = HashContent("abc");
+        CHECK(hash.ToString().size() == 32);
+        CHECK(hash.ToString() == HashContent("abc").ToString());
+        CHECK(hash.ToString() != HashContent("abd").ToString());
+    }
+
+    SECTION("StreamingContinues")
+    {
+        // Finish is non-destructive; updating afterwards extends the same stream
+        ContentHasher hasher;
+        hasher.Update(std::string_view("ab"));
+        auto partial = hasher.Finish();
+        hasher.Update(std::string_view("c"));
+        CHECK(partial == HashContent("ab"));
+        CHECK(hasher.Finish() == HashContent("abc"));
+    }
+}
+
 } // namespace accera
@@ -241,6 +241,121 @@ TEST_CASE("TestSplitDimensions")
     }
 }
 
+TEST_CASE("TestBlockedLayout")
+{
+    SECTION("ChannelBlocking")
+    {
+        MemoryLayout layout(MemoryShape{ 2, 8, 3, 3 }); // NCHW
+
+        MemoryLayout blocked = layout.GetBlockedLayout(1, 4); // NCHWc
+        CHECK(blocked.NumDimensions() == layout.NumDimensions() + 1);
+        CHECK(blocked.GetActiveSize() == MemoryShape{ 2, 2, 3, 3, 4 });
+        CHECK(blocked.GetExtent() == MemoryShape{ 2, 2, 3, 3, 4 });
+        CHECK(blocked.GetOffset() == MemoryShape{ 0, 0, 0, 0, 0 });
+        CHECK(blocked.GetIncrement() == MemoryShape{ 72, 36, 12, 4, 1 });
+        CHECK(blocked.GetDimensionOrder() == DimensionOrder{ 0, 1, 2, 3, 4 });
+        CHECK(blocked.GetMemorySize() == layout.GetMemorySize());
+    }
+
+    SECTION("TileMajorMatrix")
+    {
+        MemoryLayout layout(MemoryShape{ 4, 6 });
+
+        MemoryLayout tiled = layout.GetBlockedLayout(0, 2).GetBlockedLayout(1, 3);
+        CHECK(tiled.NumDimensions() == layout.NumDimensions() + 2);
+        CHECK(tiled.GetActiveSize() == MemoryShape{ 2, 2, 2, 3 });
+        CHECK(tiled.GetExtent() == MemoryShape{ 2, 2, 2, 3 });
+        CHECK(tiled.GetIncrement() == MemoryShape{ 12, 6, 3, 1 });
+        CHECK(tiled.GetDimensionOrder() == DimensionOrder{ 0, 1, 2, 3 });
+        CHECK(tiled.GetMemorySize() == layout.GetMemorySize());
+    }
+
+    SECTION("InvalidBlocking")
+    {
+        MemoryLayout layout(MemoryShape{ 4, 6 });
+
+        MemoryLayout blocked;
+        CHECK_THROWS(blocked = layout.GetBlockedLayout(0, 3)); // not a multiple of the block size
+        CHECK_THROWS(blocked = layout.GetBlockedLayout(1, 0)); // degenerate block
+    }
+}
+
+TEST_CASE("TestRuntimeStridedLayout")
+{
+    SECTION("MatrixView")
+    {
+        MemoryLayout layout(MemoryShape{ 16, 32 });
+
+        MemoryLayout strided = layout.GetRuntimeStridedLayout();
+        CHECK(strided.GetActiveSize() == layout.GetActiveSize());
+        CHECK(strided.GetIncrement(0) == mlir::ShapedType::kDynamicStrideOrOffset);
+        CHECK(strided.GetIncrement(1) == 1); // innermost stays contiguous
+        CHECK(strided.IsVariableSized(0));
+        CHECK(!strided.IsVariableSized(1));
+        CHECK(!strided.IsVariableSized()); // active shape is still fixed
+        CHECK(strided.GetMemorySize() == static_cast<size_t>(mlir::ShapedType::kDynamicSize));
+    }
+
+    SECTION("ColumnMajorView")
+    {
+        MemoryLayout layout(MemoryShape{ 16, 32 }, DimensionOrder{ 1, 0 });
+
+        MemoryLayout strided = layout.GetRuntimeStridedLayout();
+        CHECK(strided.GetIncrement(0) == 1); // rows are innermost in column-major order
+        CHECK(strided.GetIncrement(1) == mlir::ShapedType::kDynamicStrideOrOffset);
+    }
+
+    SECTION("InvalidLayouts")
+    {
+        MemoryLayout scalar = ScalarLayout;
+        CHECK(scalar.GetRuntimeStridedLayout() == scalar); // no strides to parameterize
+
+        MemoryLayout padded(MemoryShape{ 16, 32 }, MemoryShape{ 18, 34 }, MemoryShape{ 1, 1 });
+        CHECK_THROWS(padded.GetRuntimeStridedLayout());
+    }
+}
+
+TEST_CASE("TestHighRankLayout")
+{
+    // Dimension storage keeps up to 6 entries inline and spills to the heap above that; exercise
+    // both sides of the boundary and the copy/move paths across it
+    SECTION("SpilledShape")
+    {
+        auto shape = MemoryShape({ 2, 3, 4, 5, 6, 7, 8, 9 });
+        CHECK(shape.NumDimensions() == 8);
+        CHECK(shape[0] == 2);
+        CHECK(shape[7] == 9);
+        CHECK(shape.NumElements() == 362880);
+
+        auto copy = shape;
+        CHECK(copy == shape);
+
+        auto moved = std::move(copy);
+        CHECK(moved == shape);
+    }
+
+    SECTION("SpilledLayout")
+    {
+        MemoryLayout layout(MemoryShape{ 2, 3, 4, 5, 6, 7, 8 });
+        CHECK(layout.NumDimensions() == 7);
+        CHECK(layout.GetIncrement() == MemoryShape{ 20160, 6720, 1680, 336, 56, 8, 1 });
+        CHECK(layout.GetMemorySize() == 40320);
+
+        MemoryLayout copy = layout;
+        CHECK(copy == layout);
+        CHECK(copy.GetIncrement() == layout.GetIncrement());
+    }
+
+    SECTION("ResizeAcrossInlineBoundary")
+    {
+        auto shape = MemoryShape({ 3, 4 });
+        shape.Resize(8);
+        CHECK(shape == MemoryShape{ 1, 1, 1, 1, 1, 1, 3, 4 });
+        shape.Resize(2);
+        CHECK(shape == MemoryShape{ 3, 4 });
+    }
+}
+
 TEST_CASE("TestLayoutDimensionOrder")
 {
     MemoryLayout layout({ 7, 5, 3 }, ChannelMajorTensorOrder);
@@ -48,4 +48,115 @@ TEST_CASE("TestPropertyBag")
     }
 }
 
+TEST_CASE("TestPropertyBagGrowth")
+{
+    // Push the bag well past the linear-scan size so lookups go through the bucket index
+    PropertyBag metadata;
+    for (int i = 0; i < 100; ++i)
+    {
+        metadata.SetEntry("key_" + std::to_string(i), i);
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        auto key = "key_" + std::to_string(i);
+        REQUIRE(metadata.HasEntry(key));
+        CHECK(metadata.GetEntry<int>(key) == i);
+    }
+    CHECK(metadata.Keys().size() == 100);
+    CHECK_FALSE(metadata.HasEntry("key_100"));
+
+    SECTION("RemovalAfterGrowth")
+    {
+        for (int i = 0; i < 100; i += 2)
+        {
+            metadata.RemoveEntry("key_" + std::to_string(i));
+        }
+        CHECK(metadata.Keys().size() == 50);
+        CHECK_FALSE(metadata.HasEntry("key_42"));
+        CHECK(metadata.GetEntry<int>("key_43") == 43);
+    }
+
+    SECTION("ShrinkBackToSmall")
+    {
+        for (int i = 0; i < 95; ++i)
+        {
+            metadata.RemoveEntry("key_" + std::to_string(i));
+        }
+        CHECK(metadata.Keys().size() == 5);
+        CHECK(metadata.GetEntry<int>("key_99") == 99);
+    }
+}
+
+TEST_CASE("TestPropertyBagView")
+{
+    PropertyBag metadata;
+    metadata.SetEntry("count", 17);
+    metadata.SetEntry("name", std::string("view"));
+
+    PropertyBagView view = metadata;
+    CHECK_FALSE(view.IsEmpty());
+    CHECK(view.HasEntry("count"));
+    CHECK(view.GetEntry<int>("count") == 17);
+    CHECK(view.GetEntry<int>("missing", -1) == -1);
+    CHECK(view.Keys() == metadata.Keys());
+
+    SECTION("View tracks the underlying bag")
+    {
+        metadata.SetEntry("count", 18);
+        CHECK(view.GetEntry<int>("count") == 18);
+    }
+
+    SECTION("Default-constructed view is an empty bag")
+    {
+        PropertyBagView empty;
+        CHECK(empty.IsEmpty());
+        CHECK_FALSE(empty.HasEntry("count"));
+        CHECK(empty.GetEntry<int>("count", -1) == -1);
+        CHECK(empty.Keys().empty());
+    }
+}
+
+TEST_CASE("TestPropertyBagBinarySerialization")
+{
+    PropertyBag metadata;
+    metadata.SetEntry("flag", true);
+    metadata.SetEntry("count", 42);
+    metadata.SetEntry("bigCount", int64_t(-1234567890123LL));
+    metadata.SetEntry("ratio", 2.5);
+    metadata.SetEntry("name", std::string("example"));
+    metadata.SetEntry("shape", std::vector<int64_t>{ 16, -1, 256 });
+    metadata.SetEntry("tags", std::vector<std::string>{ "a", "bc", "" });
+
+    auto bytes = metadata.ToBinary();
+    auto roundTripped = PropertyBag::FromBinary(bytes);
+
+    CHECK(roundTripped.GetEntry<bool>("flag") == true);
+    CHECK(roundTripped.GetEntry<int>("count") == 42);
+    CHECK(roundTripped.GetEntry<int64_t>("bigCount") == -1234567890123LL);
+    CHECK(roundTripped.GetEntry<double>("ratio") == 2.5);
+    CHECK(roundTripped.GetEntry<std::string>("name") == "example");
+    CHECK(roundTripped.GetEntry<std::vector<int64_t>>("shape") == std::vector<int64_t>{ 16, -1, 256 });
+    CHECK(roundTripped.GetEntry<std::vector<std::string>>("tags") == std::vector<std::string>{ "a", "bc", "" });
+    CHECK(roundTripped.Keys().size() == metadata.Keys().size());
+
+    SECTION("Deterministic output")
+    {
+        CHECK(roundTripped.ToBinary() == bytes);
+    }
+
+    SECTION("Unsupported entry types throw")
+    {
+        metadata.SetEntry("bad", 1.0f);
+        CHECK_THROWS(metadata.ToBinary());
+    }
+
+    SECTION("Malformed input throws")
+    {
+        CHECK_THROWS(PropertyBag::FromBinary({}));
+        bytes.resize(bytes.size() / 2);
+        CHECK_THROWS(PropertyBag::FromBinary(bytes));
+    }
+}
+
 } // namespace accera
@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch_all.hpp>
+
+#include <utilities/include/StaticMemoryLayout.h>
+
+namespace accera
+{
+using namespace utilities;
+
+// The point of these types is that everything is a compile-time constant
+constexpr auto staticLayout = MakeStaticLayout<16, 10, 4>();
+static_assert(staticLayout.NumDimensions() == 3);
+static_assert(staticLayout.GetMemorySize() == 640);
+static_assert(staticLayout.GetIncrement(0) == 40);
+static_assert(staticLayout.GetIncrement(1) == 4);
+static_assert(staticLayout.GetIncrement(2) == 1);
+static_assert(staticLayout.GetEntryOffset({ 1, 2, 3 }) == 51);
+
+constexpr StaticIterationDomain<2> staticDomain({ StaticRange{ 0, 16, 1 }, StaticRange{ 0, 10, 3 } });
+static_assert(staticDomain.NumDimensions() == 2);
+static_assert(staticDomain.GetRange(1).NumIterations() == 4);
+static_assert(staticDomain.NumIterations() == 64);
+
+TEST_CASE("TestStaticMemoryLayout")
+{
+    SECTION("MatchesDynamicLayout")
+    {
+        MemoryLayout dynamicLayout(MemoryShape{ 16, 10, 4 });
+        MemoryLayout converted = staticLayout;
+
+        CHECK(converted == dynamicLayout);
+        CHECK(converted.GetIncrement() == dynamicLayout.GetIncrement());
+        CHECK(converted.GetMemorySize() == dynamicLayout.GetMemorySize());
+        CHECK(converted.GetEntryOffset(MemoryCoordinates{ 1, 2, 3 }) == dynamicLayout.GetEntryOffset(MemoryCoordinates{ 1, 2, 3 }));
+    }
+
+    SECTION("ShapeConversion")
+    {
+        MemoryShape shape = staticLayout;
+        CHECK(shape == MemoryShape{ 16, 10, 4 });
+
+        MemoryShape domainShape = staticDomain;
+        CHECK(domainShape == MemoryShape{ 16, 4 });
+    }
+}
+
+} // namespace accera
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch_all.hpp>
+
+#include <utilities/include/StringInterner.h>
+
+#include <string>
+#include <unordered_set>
+
+namespace accera
+{
+using namespace utilities;
+
+TEST_CASE("StringInterner")
+{
+    SECTION("HandleIdentity")
+    {
+        InternedString a("i_o_i");
+        InternedString b(std::string("i_o_i"));
+        InternedString c("i_o_o");
+
+        CHECK(a == b);
+        CHECK(a.GetHandle() == b.GetHandle());
+        CHECK(a != c);
+        CHECK(a.str() == "i_o_i");
+        CHECK(c.str() == "i_o_o");
+    }
+
+    SECTION("EmptyString")
+    {
+        InternedString empty;
+        CHECK(empty.empty());
+        CHECK(empty == InternedString(""));
+        CHECK(empty.str().empty());
+        CHECK_FALSE(InternedString("x").empty());
+    }
+
+    SECTION("StableReference")
+    {
+        const auto* before = &InternedString("stable").str();
+        for (int i = 0; i < 1000; ++i)
+        {
+            InternedString("churn_" + std::to_string(i));
+        }
+        CHECK(before == &InternedString("stable").str());
+    }
+
+    SECTION("LexicographicOrder")
+    {
+        CHECK(InternedString("abc") < InternedString("abd"));
+        CHECK_FALSE(InternedString("abd") < InternedString("abc"));
+        CHECK_FALSE(InternedString("abc") < InternedString("abc"));
+    }
+
+    SECTION("Hashing")
+    {
+        std::unordered_set<InternedString> set;
+        set.insert(InternedString("one"));
+        set.insert(InternedString("two"));
+        set.insert(InternedString("one"));
+        CHECK(set.size() == 2);
+        CHECK(set.count(InternedString("one")) == 1);
+    }
+}
+
+} // namespace accera
@@ -146,7 +146,7 @@ namespace value
         Value _value;
 
         template <typename T>
-        static Value MakeValue(const std::vector<T>& data, const std::optional<utilities::MemoryLayout> layout, const std::string& name = "")
+        static Value MakeValue(const std::vector<T>& data, std::optional<utilities::MemoryLayout> layout, const std::string& name = "")
         {
             if (layout.has_value())
             {
@@ -157,7 +157,7 @@ namespace value
                     throw InputException(InputExceptionErrors::invalidSize);
                 }
             }
-            return { data, layout, name };
+            return { data, std::move(layout), name };
         }
     };
 
@@ -206,8 +206,8 @@ namespace value
 {
 
     template <typename T>
-    Array::Array(const std::vector<T>& data, const std::optional<utilities::MemoryLayout> layout, const std::string& name) :
-        Array(MakeValue(data, layout, name))
+    Array::Array(const std::vector<T>& data, std::optional<utilities::MemoryLayout> layout, const std::string& name) :
+        Array(MakeValue(data, std::move(layout), name))
     {}
 
     template <typename... IndicesTypes>
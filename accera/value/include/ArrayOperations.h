@@ -9,6 +9,8 @@
 #include "Array.h"
 #include "Scalar.h"
 
+#include <functional>
+
 namespace accera
 {
 namespace value
@@ -20,11 +22,31 @@ namespace value
     Scalar VectorMax(Array v);
     Scalar VectorSum(Array v);
 
+    /// <summary> Tree-structured reduction of a 1-D array. Emits multi-accumulator, vectorized
+    /// partial reductions (optionally parallelized over numThreads contiguous chunks) followed by
+    /// a logarithmic combine, breaking the one-element-per-cycle serial dependence chain of
+    /// Reduce. reduceFn must be associative and commutative (reassociation changes the result for
+    /// floating point; pass allowReassociation = false to get the strictly ordered serial
+    /// reduction instead), and identity must be its identity element (0 for sum, -inf for max). </summary>
+    Scalar TreeReduce(Array v, Scalar identity, std::function<Scalar(Scalar, Scalar)> reduceFn, bool allowReassociation = true, int numThreads = 1);
+
     void ClearMatrix(Array A);
     void TransposeMatrix(Array A, Array B);
 
     void MatMulBasic(Array A, Array B, Array C, bool clearC = true);
     void MatMulSimpleTiled(Array A, Array B, Array C, bool clearC = true);
+
+    /// <summary> MLAS-style tiled matmul. Accumulates in C's element type: passing fp16 or bf16
+    /// A/B with an fp32 C gives a mixed-precision GEMM where the operand caches hold the narrow
+    /// type (half the bandwidth) and the inner kernel widens and accumulates in fp32. </summary>
     void MatMulMlas(Array A, Array B, Array C, bool clearC = true);
+
+    /// <summary> Per-channel quantization epilogues. QuantizeMatrix writes
+    /// output(i, j) = saturate(round(input(i, j) * scales(j))) in output's narrow integer element
+    /// type; DequantizeMatrix widens input into output's floating point element type and scales
+    /// by the per-column factor. scales has shape { columns }; the column loop is vectorized so
+    /// the round/clamp/cast sequence lowers to convert + saturating pack instructions. </summary>
+    void QuantizeMatrix(Array input, Array scales, Array output);
+    void DequantizeMatrix(Array input, Array scales, Array output);
 } // namespace value
 } // namespace accera
@@ -75,7 +75,12 @@ namespace value
               CacheAllocation allocation = CacheAllocation::Automatic,
               MemorySpace memorySpace = MemorySpace::None,
               MemorySpace doubleBufferMemorySpace = MemorySpace::None,
-              ExecutionTarget execTarget = targets::CPU{});
+              ExecutionTarget execTarget = targets::CPU{},
+              int64_t pipelineDepth = 2,
+              int64_t prefetchDistance = 0,
+              bool prefetchL2Only = false,
+              bool nontemporalWriteback = false,
+              bool quantizeCache = false);
 
         Cache(accera::ir::loopnest::ScheduleOp schedule,
               std::variant<ViewAdapter, Cache*> value,
@@ -92,14 +97,21 @@ namespace value
               CacheAllocation allocation = CacheAllocation::Automatic,
               MemorySpace memorySpace = MemorySpace::None,
               MemorySpace doubleBufferMemorySpace = MemorySpace::None,
-              ExecutionTarget execTarget = targets::CPU{});
+              ExecutionTarget execTarget = targets::CPU{},
+              int64_t pipelineDepth = 2,
+              int64_t prefetchDistance = 0,
+              bool prefetchL2Only = false,
+              bool nontemporalWriteback = false,
+              bool quantizeCache = false);
 
         // Runtime-Init caching version
         Cache(accera::ir::loopnest::ScheduleOp schedule,
               ViewAdapter value,
               const std::string& packingFunctionName,
               const std::string& packedBufferSizeFnName,
-              CacheIndexing mapping = CacheIndexing::GlobalToPhysical);
+              CacheIndexing mapping = CacheIndexing::GlobalToPhysical,
+              int64_t packingNumThreads = 1,
+              const std::optional<VectorizationInformation>& packingVectorizationInfo = std::nullopt);
 
         // Emit-time packed caching version
         Cache(accera::ir::loopnest::ScheduleOp schedule,
@@ -107,7 +119,8 @@ namespace value
               ViewAdapter constantData,
               const std::string& wrapperFnName,
               const std::string& packedBufferName,
-              CacheIndexing mapping = CacheIndexing::GlobalToPhysical);
+              CacheIndexing mapping = CacheIndexing::GlobalToPhysical,
+              bool compressEmbeddedBuffer = false);
 
         Cache(const Cache&) = delete;
         Cache(Cache&&) noexcept;
@@ -42,6 +42,21 @@ namespace value
         /// <summary> Allow emitting more efficient code that isn't necessarily IEEE-754 compatible. </summary>
         bool useFastMath = true;
 
+        /// <summary> Optimization level to run the LLVM opt and llc invocations at (0-3). </summary>
+        int llvmOptimizationLevel = 3;
+
+        /// <summary> Override LLVM's loop unrolling threshold. Unset uses the optimization level's default. </summary>
+        std::optional<int> llvmUnrollThreshold;
+
+        /// <summary> Force LLVM's loop vectorizer on or off. Unset uses the optimization level's default. </summary>
+        std::optional<bool> llvmLoopVectorize;
+
+        /// <summary> Override the target cpu given to the LLVM backend. Unset derives it from the target device. </summary>
+        std::optional<std::string> llvmTargetCpu;
+
+        /// <summary> Override the target feature string given to the LLVM backend. Unset derives it from the target device. </summary>
+        std::optional<std::string> llvmTargetFeatures;
+
         /// <summary> Allow printing of diagnostic messages from the compiled model. </summary>
         bool includeDiagnosticInfo = false;
 
@@ -61,6 +61,11 @@ namespace ir
         return "accv.output_verifiers";
     }
 
+    inline std::string GetDebugSampleIntervalAttrName()
+    {
+        return "accv.debug_sample_interval";
+    }
+
     inline std::string GetPrintErrorFunctionName()
     {
         return "_acc_eprintf_";
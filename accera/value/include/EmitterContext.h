@@ -47,6 +47,7 @@ namespace value
         None = 0,
         ThreadLocal = 1 << 0,
         Stack = 1 << 1,
+        HugePages = 1 << 2, // back the buffer with huge pages to cut TLB misses on large arrays
     };
     ACCERA_DEFINE_ENUM_FLAG_OPERATORS(AllocateFlags);
 
@@ -10,10 +10,42 @@ namespace accera
 {
 namespace value
 {
+    class Array;
     class Scalar;
 
+    // Accuracy tier for the polynomial transcendental kernels below. All kernels are branch-free
+    // so that the loop vectorizer can keep a whole row in SIMD registers. For exp, the two tiers
+    // are the existing FastExp (High) and FastExpMlas (Low) entry points.
+    enum class FastMathAccuracy
+    {
+        High, // minimax polynomials, a few ULP of error over the clamped input range
+        Low // shorter polynomials / algebraic identities, absolute error around 1e-2 near the clamp bounds
+    };
+
     Scalar FastExp(Scalar s);
     Scalar FastExpMlas(Scalar s);
+    Scalar FastLog(Scalar s, FastMathAccuracy accuracy = FastMathAccuracy::High);
+    Scalar FastTanh(Scalar s, FastMathAccuracy accuracy = FastMathAccuracy::High);
+    Scalar FastSigmoid(Scalar s, FastMathAccuracy accuracy = FastMathAccuracy::High);
+    Scalar FastErf(Scalar s, FastMathAccuracy accuracy = FastMathAccuracy::High);
+
+    // Approximate reciprocal and reciprocal square root: a bit-trick initial estimate refined
+    // with Newton-Raphson steps. Branch-free, so vectorized loops lower to mul/fma chains
+    // instead of the long-latency (and on some cores unpipelined) divide and sqrt units. Each
+    // refinement step roughly doubles the correct bits; two steps reach about 22 bits, close to
+    // full single precision.
+    Scalar FastReciprocal(Scalar s, int refinementIterations = 2);
+    Scalar FastReciprocalSqrt(Scalar s, int refinementIterations = 2);
+
+    // Batched elementwise transcendentals over whole arrays. These emit the loop themselves --
+    // vectorized and unrolled over the innermost dimension -- so the structure is guaranteed
+    // rather than rediscovered from a user-written scalar loop, and the accuracy tier selects
+    // the polynomial per call site. Input and output must have the same shape and may be the
+    // same array. SoftmaxifyRowsVectorized routes its exponentials through the same scalar
+    // kernels, so a softmax that follows a batched exp shares one accuracy policy.
+    void FastExpArray(Array input, Array output, FastMathAccuracy accuracy = FastMathAccuracy::High);
+    void FastLogArray(Array input, Array output, FastMathAccuracy accuracy = FastMathAccuracy::High);
+    void FastTanhArray(Array input, Array output, FastMathAccuracy accuracy = FastMathAccuracy::High);
 
 } // namespace value
 } // namespace accera
@@ -13,6 +13,7 @@
 
 #include "ir/include/value/ValueAttributes.h"
 
+#include <utilities/include/Expected.h>
 #include <utilities/include/StringUtil.h>
 #include <utilities/include/TupleUtils.h>
 
@@ -100,6 +101,29 @@ namespace value
         /// <param name="rawPointerAPI"> True if the raw pointer API should be emitted. </param>
         FunctionDeclaration& RawPointerAPI(bool rawPointerAPI);
 
+        /// <summary> Sets whether an async variant should additionally be emitted for this function in the
+        /// header file. The variant enqueues the call onto the Accera runtime's worker pool and returns a
+        /// completion handle the caller waits on, so independent functions can overlap. </summary>
+        /// <param name="emitAsyncAPI"> True if the async API should be emitted. </param>
+        FunctionDeclaration& AsyncAPI(bool emitAsyncAPI);
+
+        /// <summary> Sets whether a self-benchmark variant should additionally be emitted for this
+        /// function in the header file. The variant `<name>_benchmark(iterations, results*)`
+        /// allocates representative inputs from the declared argument shapes, runs a warmup call
+        /// plus a timing loop in-process, and fills a stats struct, so a deployment system can
+        /// verify on-host performance without a separate harness. </summary>
+        /// <param name="emitBenchmarkAPI"> True if the benchmark API should be emitted. </param>
+        FunctionDeclaration& BenchmarkAPI(bool emitBenchmarkAPI);
+
+        /// <summary> Sets whether this function takes a caller-provided workspace. When enabled the
+        /// function gains a trailing byte-buffer argument and its internal temporary allocations are
+        /// carved out of that buffer instead of being allocated per call, so concurrent callers can
+        /// supply per-thread persistent workspaces. The aggregate size and alignment requirement is
+        /// computed during lowering and recorded as function attributes. Only meaningful for entry
+        /// points; in-module callers do not pass the extra argument. </summary>
+        /// <param name="useCallerWorkspace"> True if the caller supplies the workspace. </param>
+        FunctionDeclaration& CallerWorkspace(bool useCallerWorkspace);
+
         /// <summary> A tag to add to a function as an attribute. </summary>
         /// <param name="tag"> The tag to add to the function. </param>
         FunctionDeclaration& AddTag(const std::string& tag);
@@ -154,6 +178,10 @@ namespace value
         /// <param name="functionNames"> List of verifier function names, one per output parameter. </param>
         FunctionDeclaration& OutputVerifiers(const std::vector<std::string>& functionNames = {});
 
+        /// <summary> Sets the invocation sampling interval for Debug mode verification. </summary>
+        /// <param name="interval"> Verify every Nth call to the function (1 verifies every call). </param>
+        FunctionDeclaration& DebugSampleInterval(int64_t interval = 1);
+
         /// <summary> Gets the final function name, including any decoration if so applicable </summary>
         const std::string& GetFunctionName() const;
 
@@ -197,16 +225,30 @@ namespace value
 
         [[nodiscard]] bool UseRawPointerAPI() const { return _rawPointerAPI; }
 
+        [[nodiscard]] bool EmitsAsyncAPI() const { return _emitAsyncAPI; }
+
+        [[nodiscard]] bool EmitsBenchmarkAPI() const { return _emitBenchmarkAPI; }
+
+        [[nodiscard]] bool UsesCallerWorkspace() const { return _useCallerWorkspace; }
+
         [[nodiscard]] std::vector<std::string> GetTags() const { return _tags; }
 
         [[nodiscard]] std::string GetBaseName() const { return _baseName; }
 
         [[nodiscard]] std::vector<std::string> GetOutputVerifiers() const { return _outputVerifiers; }
 
+        [[nodiscard]] int64_t GetDebugSampleInterval() const { return _debugSampleInterval; }
+
         [[nodiscard]] std::vector<std::string> GetArgumentsSymbol() const { return _argumentsSymbol; }
 
         static std::string GetTemporaryFunctionPointerPrefix() { return "__ACCERA_TEMPORARY__"; }
 
+        /// <summary> Checks the supplied call arguments against the declared parameter types without
+        /// throwing. Call sites that emit thousands of calls per tuning sweep branch on the result;
+        /// API boundaries convert failures back to exceptions with ValueOrThrow(). The failure
+        /// message is only formatted if the error is surfaced. </summary>
+        [[nodiscard]] utilities::ValidationResult<utilities::InputExceptionErrors> ValidateArguments(const std::vector<Value>& arguments) const;
+
     private:
         template <typename ReturnT, typename... Args>
         [[maybe_unused]] std::function<ReturnT(Args...)> DefineImpl(std::function<ReturnT(Args...)> fn);
@@ -243,9 +285,13 @@ namespace value
         bool _emitCWrapper = false;
         bool _emitHeaderDecl = false;
         bool _rawPointerAPI = false;
+        bool _emitAsyncAPI = false;
+        bool _emitBenchmarkAPI = false;
+        bool _useCallerWorkspace = false;
         std::vector<std::string> _tags;
         std::string _baseName;
         std::vector<std::string> _outputVerifiers;
+        int64_t _debugSampleInterval = 1;
         std::vector<std::string> _argumentsSymbol;
     };
 
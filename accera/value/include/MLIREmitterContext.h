@@ -33,6 +33,7 @@
 
 namespace mlir
 {
+class ExecutionEngine;
 class ModuleOp;
 class Value;
 } // namespace mlir
@@ -93,6 +94,25 @@ namespace value
 
         mlir::OwningOpRef<mlir::ModuleOp> cloneModule() const;
 
+        /// <summary> Entry point into JIT-compiled code; arguments follow the MLIR
+        /// packed-argument calling convention (an array of pointers to the actual
+        /// arguments). </summary>
+        using JitFunction = void (*)(void**);
+
+        /// <summary> Lowers a clone of the current module through the registered
+        /// acc-to-llvm pipeline, JIT-compiles it in-process and returns the named
+        /// function's entry point. The engine is built on the first call and reused
+        /// by later ones, so repeated lookups across tuning iterations only pay for
+        /// a symbol table hit. </summary>
+        ///
+        /// <param name="functionName"> Name of an emitted function to look up. </param>
+        JitFunction JitCompile(const std::string& functionName);
+
+        /// <summary> Discards the cached JIT engine and compiled symbols so the next
+        /// JitCompile call re-lowers the module; call after emitting new or changed
+        /// functions. </summary>
+        void InvalidateJitEngine();
+
         void writeHeader(std::optional<std::string> filename = std::nullopt) const;
 
         void setMetadata(const std::string& key, const accera::ir::MetadataValueType& value);
@@ -240,6 +260,9 @@ namespace value
         std::stack<std::forward_list<EmittableInfo>> _localEmittables;
         std::map<std::string, std::pair<Emittable, MemoryLayout>> _globals;
         std::unordered_map<FunctionDeclaration, DefinedFunction> _definedFunctions;
+
+        std::unique_ptr<mlir::ExecutionEngine> _jitEngine;
+        std::unordered_map<std::string, JitFunction> _jitFunctions;
     };
 
     bool HasMLIRTypeConversion(ValueType valueType);
@@ -265,6 +288,8 @@ namespace value
         static GPUIndex GridDim();
         static GPUIndex ThreadId();
         static void Barrier(BarrierScope scope = BarrierScope::Block);
+        static Scalar WarpReduceSum(Scalar value);
+        static Scalar WarpReduceMax(Scalar value);
     };
 
     void FillResource(ViewAdapter, Scalar);
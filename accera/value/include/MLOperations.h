@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Array.h"
+#include "FastMath.h"
 #include "Scalar.h"
 
 namespace accera
@@ -14,16 +15,53 @@ namespace accera
 namespace value
 {
     void SoftmaxifyRows(Array m);
-    void SoftmaxifyRowsVectorized(Array m);
+
+    // The accuracy tier selects the exp kernel for the exp-and-sum loop (the same kernels the
+    // batched FastExpArray uses); Low keeps the historical MLAS polynomial default
+    void SoftmaxifyRowsVectorized(Array m, FastMathAccuracy accuracy = FastMathAccuracy::Low);
 
     void LayerNormalize(Array m, Array alpha, Array beta);
     void LayerNormalizeFused(Array m, Array alpha, Array beta, Array residual);
-    void LayerNormalizeVectorized(Array m, Array alpha, Array beta);
-    void LayerNormalizeVectorizedFused(Array m, Array alpha, Array beta, Array residual);
+
+    // When useFastRsqrt is set, the per-row 1/sqrt(variance) uses FastReciprocalSqrt (estimate
+    // plus Newton-Raphson refinement) instead of the full-precision sqrt-and-divide pair, keeping
+    // the normalization loop on the pipelined multiply/fma units
+    void LayerNormalizeVectorized(Array m, Array alpha, Array beta, bool useFastRsqrt = false);
+    void LayerNormalizeVectorizedFused(Array m, Array alpha, Array beta, Array residual, bool useFastRsqrt = false);
 
     void ReLU(Array m);
 
     void Feedforward(Array attn, Array Wff1, Array Wff2, Array ffTemp, Array output);
     void FusedFeedforward(Array attn, Array Wff1, Array Wff2, Array ffTemp, Array output);
+
+    // One fused LSTM cell step. Wx is { inputSize, 4 * hidden } and Wh is { hidden, 4 * hidden }
+    // with the gate columns packed [input | forget | candidate | output], so both GEMMs pack
+    // x / h once for all four gates; gates is a { batch, 4 * hidden } workspace. The sigmoids,
+    // tanhs, and state update run in a single vectorized nest over the gate workspace, writing
+    // hNext and cNext without intermediate buffer round-trips.
+    void LSTMCell(Array x, Array h, Array c, Array Wx, Array Wh, Array bias, Array gates, Array hNext, Array cNext);
+
+    // One fused GRU cell step. Wx is { inputSize, 3 * hidden } and Wh is { hidden, 3 * hidden }
+    // with gate columns packed [reset | update | candidate]; gatesX and gatesH are
+    // { batch, 3 * hidden } workspaces (the candidate's recurrent term must stay separate so the
+    // reset gate can scale it). bias is { 3 * hidden }, applied to the input path.
+    void GRUCell(Array x, Array h, Array Wx, Array Wh, Array bias, Array gatesX, Array gatesH, Array hNext);
+
+    // output(i, :) = table(indices(i), :) -- gathers rows of an embedding table. The row for
+    // indices(i + prefetchDistance) is software-prefetched ahead of the copy, since the row
+    // addresses are data-dependent and the hardware prefetcher cannot follow them.
+    void EmbeddingLookup(Array table, Array indices, Array output, int prefetchDistance = 8, int numThreads = 1);
+
+    // output(b, :) = sum of table(indices(nz), :) for nz in [bagOffsets(b), bagOffsets(b + 1)),
+    // the EmbeddingBag-style gather-and-sum. Rows are prefetched prefetchDistance lookups ahead
+    // and the accumulate is vectorized; bags are parallelized across numThreads when > 1.
+    void EmbeddingBagSum(Array table, Array indices, Array bagOffsets, Array output, int prefetchDistance = 8, int numThreads = 1);
+
+    // output = softmax(Q*K^T / sqrt(d)) * V, materializing the full score matrix in `scores`
+    void ScaledDotProductAttention(Array Q, Array K, Array V, Array scores, Array output);
+
+    // Fused (flash-attention-style) version: streams K/V through column blocks with running
+    // row-max/row-sum state, so the full score matrix is never materialized
+    void FusedScaledDotProductAttention(Array Q, Array K, Array V, Array output);
 } // namespace value
 } // namespace accera
@@ -36,6 +36,8 @@ namespace value
             M32xN8xK16_B1,
             M8xN32xK16_B1,
 
+            M8xN8xK4_B1,
+
             Invalid
         };
 
@@ -11,6 +11,7 @@
 #include <utilities/include/MemoryLayout.h>
 
 #include <functional>
+#include <vector>
 
 namespace accera
 {
@@ -18,6 +19,7 @@ namespace value
 {
 
     class Matrix;
+    class Tensor;
     class Vector;
 
     /// <summary> Reinterprets the given data value as a matrix of the given size </summary>
@@ -39,6 +41,22 @@ namespace value
     Matrix MatrixMatrixMultiply(Matrix m1, Matrix m2);
     void MatrixMatrixMultiply(Matrix m1, Matrix m2, Matrix output);
 
+    /// <summary> Multiplies each matrix pair in a batch of strided matrices, generating a single
+    /// nest that iterates the batch dimension and parallelizes across it. The batch is the row
+    /// dimension of the rank-3 tensors: b1 is (Batch x M x K), b2 is (Batch x K x N) and the
+    /// output is (Batch x M x N). </summary>
+    Tensor BatchMatrixMatrixMultiply(Tensor b1, Tensor b2);
+    void BatchMatrixMatrixMultiply(Tensor b1, Tensor b2, Tensor output);
+
+    /// <summary> Multiplies each matrix in a batch of strided matrices by the same right-hand
+    /// matrix. m2 is packed once and reused by every batch entry. b1 is (Batch x M x K), m2 is
+    /// (K x N) and the output is (Batch x M x N). </summary>
+    void BatchMatrixMatrixMultiply(Tensor b1, Matrix m2, Tensor output);
+
+    /// <summary> Multiplies each matrix pair in a batch of separately-allocated matrices of
+    /// uniform shape, sharing one schedule across the batch. </summary>
+    void BatchMatrixMatrixMultiply(const std::vector<Matrix>& m1s, const std::vector<Matrix>& m2s, const std::vector<Matrix>& outputs);
+
     Vector MatrixVectorMultiply(Matrix m, Vector v);
 } // namespace value
 } // namespace accera
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "FunctionDeclaration.h"
+#include "TargetDevice.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace accera
+{
+namespace value
+{
+    /// <summary> The ISA tiers the emitted cpuid-based dispatcher can distinguish between, in increasing
+    /// order of capability. A variant built for a given tier is eligible to run on any machine whose
+    /// detected tier is greater than or equal to it. </summary>
+    enum class CPUFeatureLevel : int
+    {
+        Generic = 0,
+        AVX = 1,
+        AVX2 = 2,
+        AVX512 = 3
+    };
+
+    /// <summary> Returns the feature level a target device requires, derived from its feature string. </summary>
+    CPUFeatureLevel GetCPUFeatureLevel(const TargetDevice& device);
+
+    /// <summary> One ISA-specialized version of a multiversioned function: the device whose ISA the body
+    /// should be compiled for, and the body itself (same form as the callable passed to
+    /// `FunctionDeclaration::Define`, restricted to void-returning functions). </summary>
+    struct FunctionVersion
+    {
+        TargetDevice device;
+        std::function<void(std::vector<Value>)> body;
+    };
+
+    /// <summary> Defines several ISA-specialized bodies for one function declaration, plus a public
+    /// dispatcher with the declaration's own name that selects among them at runtime.
+    ///
+    /// Each version is emitted as an internal function named `<name>_<deviceName>`, tagged with its
+    /// device so the LLVM lowering applies that device's target features to just that body. The
+    /// dispatcher calls the runtime's `_accera_cpu_feature_level` helper once per invocation and
+    /// forwards to the most capable version the executing machine supports, falling back to the
+    /// lowest-tier version provided. One package artifact can therefore serve a heterogeneous fleet
+    /// without either crashing older nodes or leaving newer ISAs unused. </summary>
+    ///
+    /// <param name="fnDecl"> The declaration (name, parameters, visibility) of the dispatched function. Must be void-returning. </param>
+    /// <param name="versions"> The ISA-specialized versions. At least one version is required; the one with
+    /// the lowest feature level becomes the fallback. </param>
+    void DefineMultiVersionedFunction(FunctionDeclaration fnDecl, std::vector<FunctionVersion> versions);
+
+} // namespace value
+} // namespace accera
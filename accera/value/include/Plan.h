@@ -50,7 +50,47 @@ namespace value
     enum class ParallelizationPolicy : int
     {
         Static,
-        Dynamic
+        Dynamic,
+        /// Chunks of the collapsed iteration space are claimed by idle threads, so badly imbalanced
+        /// iteration costs (boundary tiles, fused epilogues) don't leave cores idle at the tail
+        WorkStealing,
+        /// For hosts mixing performance and efficiency cores: threads claim work in granules small
+        /// enough that each core class ends up with a share proportional to its throughput, so
+        /// P-cores don't idle waiting on an equal static partition assigned to E-cores
+        Heterogeneous
+    };
+
+    enum class ParallelReduction : int
+    {
+        None,
+        Sum,
+        Max,
+        Min
+    };
+
+    enum class ParallelAffinity : int
+    {
+        /// Bind the threads to neighboring cores so they share caches
+        Compact,
+        /// Spread the threads across the available places (e.g. one per NUMA node or socket)
+        /// so each thread stays near the memory it first-touched
+        Scatter
+    };
+
+    /// Per-schedule relaxed floating-point semantics. The default (all flags off) keeps the
+    /// strict IEEE evaluation order the lowering has always emitted; a schedule opts in flag by
+    /// flag, so numerically tolerant kernels can unlock reordering while bit-exact kernels in
+    /// the same package stay strict.
+    struct FastMathPolicy
+    {
+        /// Allow fusing multiply/add pairs into fma, trading the intermediate rounding step for
+        /// throughput
+        bool contract = false;
+        /// Allow reassociating reduction chains, which is what permits multi-accumulator
+        /// reductions to break the loop-carried dependence on a single accumulator
+        bool reassoc = false;
+        /// Assume no NaN inputs or results, enabling min/max and compare simplifications
+        bool noNaNs = false;
     };
 
     class Plan
@@ -75,8 +115,13 @@ namespace value
         /// <param name="allocation"> The cache allocation </param>
         /// <param name="memorySpace"> The memory space</param>
         /// <param name="doubleBufferMemorySpace"> The memory space to put the double buffer temporary buffer in </param>
+        /// <param name="pipelineDepth"> How many cache fill iterations to keep in flight when double-buffering; 2 is plain double-buffering, larger values rotate additional stage buffers in the double buffer memory space </param>
+        /// <param name="prefetchDistance"> How many elements ahead of the copy loops to software-prefetch the source array; 0 disables prefetching </param>
+        /// <param name="prefetchL2Only"> Whether prefetches should skip the L1 cache so streaming fills don't pollute it </param>
+        /// <param name="nontemporalWriteback"> Whether writeback and zeroing stores for this cache should be emitted as non-temporal streaming stores that bypass the cache hierarchy </param>
+        /// <param name="quantizeCache"> Whether to quantize the array into a reduced-precision integer cache during the fill, keeping a per-active-block scale alongside the cache. Requires an explicit integer cache element type </param>
         /// <returns> An instance of Cache </returns>
-        Cache AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const MemoryAffineCoefficients& memoryMap, const std::optional<value::ValueType>& elementType = std::nullopt, bool thrifty = false, bool doubleBuffer = false, const std::optional<VectorizationInformation>& vectorizationInfo = std::nullopt, CacheIndexing indexing = CacheIndexing::GlobalToPhysical, CacheAllocation allocation = CacheAllocation::Automatic, MemorySpace memorySpace = MemorySpace::None, MemorySpace doubleBufferMemorySpace = MemorySpace::None);
+        Cache AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const MemoryAffineCoefficients& memoryMap, const std::optional<value::ValueType>& elementType = std::nullopt, bool thrifty = false, bool doubleBuffer = false, const std::optional<VectorizationInformation>& vectorizationInfo = std::nullopt, CacheIndexing indexing = CacheIndexing::GlobalToPhysical, CacheAllocation allocation = CacheAllocation::Automatic, MemorySpace memorySpace = MemorySpace::None, MemorySpace doubleBufferMemorySpace = MemorySpace::None, int64_t pipelineDepth = 2, int64_t prefetchDistance = 0, bool prefetchL2Only = false, bool nontemporalWriteback = false, bool quantizeCache = false);
 
         /// <summary> Adds a manual active block cache for a view target or different cache </summary>
         /// <param name="target"> The target being cached (e.g Array, Matrix, etc) </param>
@@ -91,8 +136,13 @@ namespace value
         /// <param name="allocation"> The cache allocation </param>
         /// <param name="memorySpace"> The memory space</param>
         /// <param name="doubleBufferMemorySpace"> The memory space to put the double buffer temporary buffer in </param>
+        /// <param name="pipelineDepth"> How many cache fill iterations to keep in flight when double-buffering; 2 is plain double-buffering, larger values rotate additional stage buffers in the double buffer memory space </param>
+        /// <param name="prefetchDistance"> How many elements ahead of the copy loops to software-prefetch the source array; 0 disables prefetching </param>
+        /// <param name="prefetchL2Only"> Whether prefetches should skip the L1 cache so streaming fills don't pollute it </param>
+        /// <param name="nontemporalWriteback"> Whether writeback and zeroing stores for this cache should be emitted as non-temporal streaming stores that bypass the cache hierarchy </param>
+        /// <param name="quantizeCache"> Whether to quantize the array into a reduced-precision integer cache during the fill, keeping a per-active-block scale alongside the cache. Requires an explicit integer cache element type </param>
         /// <returns> An instance of Cache </returns>
-        Cache AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType = std::nullopt, bool thrifty = false, bool doubleBuffer = false, const std::optional<VectorizationInformation>& vectorizationInfo = std::nullopt, CacheIndexing indexing = CacheIndexing::GlobalToPhysical, CacheAllocation allocation = CacheAllocation::Automatic, MemorySpace memorySpace = MemorySpace::None, MemorySpace doubleBufferMemorySpace = MemorySpace::None);
+        Cache AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType = std::nullopt, bool thrifty = false, bool doubleBuffer = false, const std::optional<VectorizationInformation>& vectorizationInfo = std::nullopt, CacheIndexing indexing = CacheIndexing::GlobalToPhysical, CacheAllocation allocation = CacheAllocation::Automatic, MemorySpace memorySpace = MemorySpace::None, MemorySpace doubleBufferMemorySpace = MemorySpace::None, int64_t pipelineDepth = 2, int64_t prefetchDistance = 0, bool prefetchL2Only = false, bool nontemporalWriteback = false, bool quantizeCache = false);
 
         /// <summary> Adds a manual active block cache for a view target or different cache with an identity dimension ordering </summary>
         /// <param name="target"> The target being cached (e.g Array, Matrix, etc) </param>
@@ -156,8 +206,10 @@ namespace value
         /// <param name="packingFnName"> The name of the packing function to emit </param>
         /// <param name="packedBufferSizeFnName"> The name of the function giving the size of the packed buffer to emit </param>
         /// <param name="indexing"> The cache indexing </param>
+        /// <param name="numThreads"> The number of threads to parallelize the emitted packing function with, 1 leaves it serial </param>
+        /// <param name="vectorizationInfo"> Optional vectorization configuration for the emitted packing function's copy loop </param>
         /// <returns> An instance of Cache </returns>
-        Cache EmitRuntimeInitPacking(ViewAdapter target, const std::string& packingFnName, const std::string& packedBufferSizeFnName, CacheIndexing indexing = CacheIndexing::GlobalToPhysical);
+        Cache EmitRuntimeInitPacking(ViewAdapter target, const std::string& packingFnName, const std::string& packedBufferSizeFnName, CacheIndexing indexing = CacheIndexing::GlobalToPhysical, int64_t numThreads = 1, const std::optional<VectorizationInformation>& vectorizationInfo = std::nullopt);
 
         /// <summary> Packs and embeds the given buffer of data into the binary following the offline packing format for the given target and changes its usage in the function to assume a packed representation. Also removes the given buffer as an argument to the function </summary>
         /// <param name="target"> The target being cached (e.g Array, Matrix, etc) </param>
@@ -165,8 +217,9 @@ namespace value
         /// <param name="wrapperFnName"> The name to give the wrapping function that calls the base function with the packed data </param>
         /// <param name="packedBufferName"> The string name to give the buffer in the binary </param>
         /// <param name="indexing"> The cache indexing </param>
+        /// <param name="compress"> Whether to store the embedded buffer zero-run-length compressed and emit a one-time decompression function that must be called before the wrapper function is used </param>
         /// <returns> An instance of Cache </returns>
-        Cache PackAndEmbedBuffer(ViewAdapter target, ViewAdapter constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing indexing = CacheIndexing::GlobalToPhysical);
+        Cache PackAndEmbedBuffer(ViewAdapter target, ViewAdapter constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing indexing = CacheIndexing::GlobalToPhysical, bool compress = false);
 
         /// <summary> Vectorizes along an index </summary>
         /// <param name="i"> The scalar index indicating the axis to vectorize </param>
@@ -177,7 +230,34 @@ namespace value
         /// <param name="indices"> The scalar indices to parallelize. Specifying multiple indices is equivalent to the `collapse` argument in OpenMP. Therefore, the dimensions must be contiguous in the iteration space dimension order. </param>
         /// <param name="numThreads"> The number of threads to schedule. </param>
         /// <param name="policy"> The policy used to schedule work across the threads. </param>
-        void Parallelize(std::vector<ScalarIndex> indices, int64_t numThreads, ParallelizationPolicy policy);
+        /// <param name="affinity"> How the threads are bound to cores. </param>
+        /// <param name="chunkSize"> The number of iterations handed to a thread at a time under the dynamic and work-stealing policies. 0 lets the policy pick its own chunking. </param>
+        void Parallelize(std::vector<ScalarIndex> indices, int64_t numThreads, ParallelizationPolicy policy, ParallelAffinity affinity = ParallelAffinity::Compact, int64_t chunkSize = 0);
+
+        /// <summary> Parallelizes a reduction dimension </summary>
+        /// <param name="index"> The scalar index of the reduction dimension to parallelize. Iterations along this dimension accumulate into locations that do not depend on it (e.g. the K dimension of a GEMM), so a plain parallelization would race. </param>
+        /// <param name="numThreads"> The number of threads to schedule. </param>
+        /// <param name="policy"> The policy used to schedule work across the threads. </param>
+        /// <param name="reduction"> The reduction operator the loop body applies. Lowering gives each thread a private copy of the accumulators and combines them with this operator after the parallel region. </param>
+        /// <param name="affinity"> How the threads are bound to cores. </param>
+        /// <param name="chunkSize"> The number of iterations handed to a thread at a time under the dynamic and work-stealing policies. 0 lets the policy pick its own chunking. </param>
+        void Parallelize(ScalarIndex index, int64_t numThreads, ParallelizationPolicy policy, ParallelReduction reduction, ParallelAffinity affinity = ParallelAffinity::Compact, int64_t chunkSize = 0);
+
+        /// <summary> Tensorize three iteration space dimensions, mapping the matmul micro-tile they span onto
+        /// the target's dot-product instructions (e.g. AVX512-VNNI, ARM sdot/udot) where available. By default
+        /// the tile shape is taken from the ranges of the given indices. </summary>
+        /// <param name="indices"> The scalar indices to tensorize, ordered (row, column, accumulation). Three indices must be specified whose dimensions must be contiguous in the iteration space dimension order. </param>
+        /// <param name="dims"> Optionally requests a fixed-shape matrix unit instead of the default dot-product kernel.
+        /// Currently MMAShape::M16xN16xK64_B1 selects Intel AMX int8 tiles; the micro-tile must then be a multiple of
+        /// that shape, the target must support AMX, and the B array must be cached in the VNNI group-packed layout
+        /// (element (k, j) at position (k floordiv 4, 4*j + k mod 4)). </param>
+        void Tensorize(std::vector<ScalarIndex> indices, std::optional<ir::value::MMAShape> dims = std::nullopt);
+
+        /// <summary> Sets the floating-point relaxation policy for this schedule's emitted ops </summary>
+        /// <param name="policy"> The flags to enable. The policy is carried through lowering onto the
+        /// LLVM floating-point ops of the function holding this schedule, so it applies to this
+        /// kernel only and not to the rest of the package. </param>
+        void SetFastMathPolicy(const FastMathPolicy& policy);
 
     private:
         friend class Schedule;
@@ -208,8 +288,9 @@ namespace value
         /// <param name="allocation"> The cache allocation </param>
         /// <param name="memorySpace"> The memory space</param>
         /// <param name="doubleBufferMemorySpace"> The memory space to put the double buffer temporary buffer in </param>
+        /// <param name="pipelineDepth"> How many cache fill iterations to keep in flight when double-buffering; 2 is plain double-buffering, larger values rotate additional stage buffers in the double buffer memory space </param>
         /// <returns> An instance of Cache </returns>
-        Cache AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const value::ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, CacheStrategy strategy, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace = MemorySpace::None);
+        Cache AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const value::ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, CacheStrategy strategy, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace = MemorySpace::None, int64_t pipelineDepth = 2);
 
         /// <summary> Adds a cache for a view target </summary>
         /// <param name="target"> The target being cached (e.g Array, Matrix, etc) </param>
@@ -235,7 +316,9 @@ namespace value
         /// <param name="useStaticOffsets"> Use precomputed index offsets for address calculation (potential optimization). </param>
         /// <param name="numFusedPasses"> Number of passes of the tensor operation for which to allocate register, higher value indicates higher register allocation. </param>
         /// <param name="schedulingPolicy"> Determines whether we iterate over blocks or passes. </param>
-        void Tensorize(std::vector<ScalarIndex> indices, ir::value::MMAShape dims, int numTotalPasses = 1, bool useStaticOffsets = false, int numFusedPasses = -1, ir::value::MMASchedulingPolicy schedulingPolicy = ir::value::MMASchedulingPolicy::PassOrder, bool _useRocWMMA=false);
+        /// <param name="pipelinePasses"> Software-pipeline pass groups by issuing fragment loads for the next pass group before the matrix ops of the current one. </param>
+        /// <param name="epilogueOp"> Elementwise op fused into the fragment store, applied to the accumulator while it is still in registers. </param>
+        void Tensorize(std::vector<ScalarIndex> indices, ir::value::MMAShape dims, int numTotalPasses = 1, bool useStaticOffsets = false, int numFusedPasses = -1, ir::value::MMASchedulingPolicy schedulingPolicy = ir::value::MMASchedulingPolicy::PassOrder, bool _useRocWMMA=false, bool pipelinePasses = false, ir::value::MMAFragmentOpType epilogueOp = ir::value::MMAFragmentOpType::None);
 
     private:
         friend class Schedule;
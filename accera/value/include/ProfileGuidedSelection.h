@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace accera
+{
+namespace value
+{
+    /// <summary> Aggregated timing data for one profile region / emitted function, as recorded by a
+    /// deployed package. </summary>
+    struct FunctionProfile
+    {
+        uint64_t invocationCount = 0;
+        double totalSeconds = 0;
+        double minSeconds = 0;
+        double maxSeconds = 0;
+
+        double MeanSeconds() const { return invocationCount == 0 ? 0 : totalSeconds / invocationCount; }
+    };
+
+    /// <summary> Reads and writes the compact binary profile-data format shared between deployed
+    /// packages (which append region timings at shutdown) and the package builder (which consumes the
+    /// file on the next build to pick among schedule variants). The format is a little-endian
+    /// magic/version header followed by length-prefixed region names and their `FunctionProfile`
+    /// records; merging two files sums their counts and totals. </summary>
+    class ProfileDataFile
+    {
+    public:
+        ProfileDataFile() = default;
+
+        /// <summary> Loads the given profile data file; a missing file yields an empty profile. </summary>
+        explicit ProfileDataFile(const std::string& filePath);
+
+        /// <summary> Returns the profile for the given region name, if any was recorded. </summary>
+        std::optional<FunctionProfile> GetProfile(const std::string& regionName) const;
+
+        /// <summary> Merges another invocation's timings for the given region into this profile. </summary>
+        void Accumulate(const std::string& regionName, const FunctionProfile& profile);
+
+        /// <summary> Writes the profile data to the given file. </summary>
+        void Write(const std::string& filePath) const;
+
+        size_t Size() const { return _profiles.size(); }
+
+    private:
+        std::map<std::string, FunctionProfile> _profiles;
+    };
+
+    /// <summary> Picks the schedule variant with the lowest mean recorded time. Variants with no
+    /// recorded timings are skipped; returns nullopt if none of the candidates were profiled, in which
+    /// case the builder should fall back to its default (e.g. cost-model) choice. </summary>
+    std::optional<std::string> SelectBestVariant(const ProfileDataFile& profileData, const std::vector<std::string>& variantNames);
+
+} // namespace value
+} // namespace accera
@@ -52,7 +52,7 @@ namespace value
     Scalar Tanh(Scalar s);
     Scalar Square(Scalar s);
 
-    Scalar Round(Scalar s); // Note: not implemented
+    Scalar Round(Scalar s); // round to nearest, halves away from zero
     Scalar Floor(Scalar s);
     Scalar Ceil(Scalar s);
     Scalar CopySign(Scalar s1, Scalar s2); // Note: not implemented
@@ -60,5 +60,12 @@ namespace value
 
     Scalar Select(Scalar cmp, Scalar a, Scalar b); // returns (cmp ? a : b)
     Scalar LogicalNot(Scalar v);
+
+    /// <summary> Quantization primitives. QuantizeSaturate returns round(s * scale) clamped to
+    /// the representable range of destType (a narrow integer type) and cast to it; Dequantize
+    /// widens s to scale's (floating point) type and multiplies by scale. Both stay in registers,
+    /// so they can be used inside epilogue kernels added to a schedule via Schedule::AddKernel. </summary>
+    Scalar QuantizeSaturate(Scalar s, Scalar scale, ValueType destType);
+    Scalar Dequantize(Scalar s, Scalar scale);
 } // namespace value
 } // namespace accera
@@ -10,6 +10,7 @@
 #include "Index.h"
 #include "Scalar.h"
 #include "ScalarIndex.h"
+#include "TargetDevice.h"
 
 #include <utilities/include/TupleUtils.h>
 
@@ -39,6 +40,18 @@ namespace value
 
     using ScalarIndexPair = std::pair<ScalarIndex, ScalarIndex>;
 
+    /// <summary> The order in which a set of tile (outer) loops visits its tiles </summary>
+    enum class TileTraversal
+    {
+        /// Lexicographic order of the given indices: whole rows of tiles, one after another
+        RowMajor,
+
+        /// Morton (Z-order) curve over the tile grid: recursively visits one quadrant of the
+        /// grid before moving to the next, so successive tiles stay close in every dimension
+        /// and data cached for one tile row is still resident when nearby rows are visited
+        ZOrder,
+    };
+
     class Schedule
     {
     public:
@@ -59,6 +72,14 @@ namespace value
         /// <param name="i"> The dimension to split </param>
         /// <param name="factor"> The blocksize to split </param>
         /// <returns> A SplitIndex, containing the inner and outer indices.</returns>
+        ///
+        /// The factor must be a compile-time constant: scheduled loops lower to `affine.for`,
+        /// whose step is required to be constant, and boundary partitioning and constraint
+        /// solving do integer arithmetic on the increment. A runtime-valued (`Scalar`) factor
+        /// would need a non-affine loop lowering and is not supported. Dimensions with
+        /// runtime *sizes* can be split normally --- the boundary machinery handles variable
+        /// range ends --- so adaptive tiling of dynamic shapes should be expressed as
+        /// size-class dispatch between schedules with constant factors.
         SplitIndex Split(Index i, int factor);
 
         /// <summary> Split a loop along a dimension </summary>
@@ -67,6 +88,61 @@ namespace value
         /// <returns> An std::pair of scalars indicating the outer and inner indices </returns>
         ScalarIndexPair Split(ScalarIndex i, int factor); // `i` must be backed by a SymbolicIndexOp
 
+        /// <summary> Split a loop along a dimension, deriving the split factor from the target device's
+        /// cache geometry instead of a hand-chosen constant. The factor is the largest power of two whose
+        /// square active-block footprint occupies about half the requested cache level, which is the
+        /// classic tile-size rule for 2D-reuse (GEMM-like) kernels. </summary>
+        /// <param name="i"> The dimension to split </param>
+        /// <param name="cacheLevel"> The cache level the resulting tile should fit in </param>
+        /// <param name="targetDevice"> The device whose cache geometry to use </param>
+        /// <param name="bytesPerElement"> The element size of the arrays being tiled </param>
+        /// <returns> A SplitIndex, containing the inner and outer indices.</returns>
+        SplitIndex Split(Index i, CacheLevel cacheLevel, const TargetDevice& targetDevice, int bytesPerElement = 4);
+
+        /// <summary> Split a loop along a dimension, deriving the split factor from the target device's
+        /// cache geometry instead of a hand-chosen constant </summary>
+        /// <param name="i"> The dimension to split. Must be backed by a SymbolicIndexOp </param>
+        /// <param name="cacheLevel"> The cache level the resulting tile should fit in </param>
+        /// <param name="targetDevice"> The device whose cache geometry to use </param>
+        /// <param name="bytesPerElement"> The element size of the arrays being tiled </param>
+        /// <returns> An std::pair of scalars indicating the outer and inner indices </returns>
+        ScalarIndexPair Split(ScalarIndex i, CacheLevel cacheLevel, const TargetDevice& targetDevice, int bytesPerElement = 4);
+
+        /// <summary> Tiles several dimensions through a hierarchy of footprints in one call, performing
+        /// the per-level splits and the canonical ordering (each level's indices, in the dimensions'
+        /// given order, before the next level's) that would otherwise take a chain of `Split` calls and
+        /// a hand-built `SetOrder` across a dozen indices. </summary>
+        /// <param name="indices"> The dimensions to tile, outermost first </param>
+        /// <param name="levelFootprints"> One entry per level, largest footprint first; each entry holds
+        /// one tile size per dimension in `indices`, and each dimension's footprints must be strictly
+        /// decreasing from level to level </param>
+        /// <returns> The structured index tree: one entry per dimension, holding that dimension's chain
+        /// of indices from the outermost (largest tile) to the innermost (element) loop </returns>
+        std::vector<std::vector<ScalarIndex>> TileHierarchy(std::vector<ScalarIndex> indices, const std::vector<std::vector<int>>& levelFootprints);
+
+        /// <summary> Tiles several dimensions through a hierarchy of cache levels in one call, deriving
+        /// each level's footprint from the target device's cache geometry (see the cache-level `Split`
+        /// overload for the sizing rule) </summary>
+        /// <param name="indices"> The dimensions to tile, outermost first </param>
+        /// <param name="cacheLevels"> The cache levels to tile for, largest (e.g. L3) first </param>
+        /// <param name="targetDevice"> The device whose cache geometry to use </param>
+        /// <param name="bytesPerElement"> The element size of the arrays being tiled </param>
+        /// <returns> The structured index tree: one entry per dimension, holding that dimension's chain
+        /// of indices from the outermost (largest tile) to the innermost (element) loop </returns>
+        std::vector<std::vector<ScalarIndex>> TileHierarchy(std::vector<ScalarIndex> indices, const std::vector<CacheLevel>& cacheLevels, const TargetDevice& targetDevice, int bytesPerElement = 4);
+
+        /// <summary> Reorders how the given tile (outer) indices traverse the tile grid. The
+        /// traversal is realized purely through index splits and reordering, so the iteration
+        /// space stays affine and all downstream caching and boundary logic remains valid.
+        /// `ZOrder` decomposes each tile loop into a chain of 2-iteration loops and interleaves
+        /// the chains, which walks the tiles along a Morton curve; it requires the tile loops to
+        /// have constant ranges. </summary>
+        /// <param name="traversal"> The traversal policy </param>
+        /// <param name="tileIndices"> The tile indices to reorder, outermost first </param>
+        /// <returns> The loop indices realizing the traversal, outermost first (for `ZOrder`
+        /// these are the newly created bit-level split indices) </returns>
+        std::vector<ScalarIndex> SetTileTraversal(TileTraversal traversal, std::vector<ScalarIndex> tileIndices);
+
         /// <summary> Pads one dimension with empty (no-op) elements </summary>
         /// <param name="i"> The dimension to pad </param>
         /// <param name="size"> The number of elements to pad </param>
@@ -93,6 +169,23 @@ namespace value
         /// <returns> The skewed index </returns>
         ScalarIndex Skew(ScalarIndex i, ScalarIndex reference);
 
+        /// <summary> Flattens two adjacent indices that traverse contiguous memory into a single index over
+        /// the product of their extents, so memset/copy-like and elementwise nests lower to one flat loop
+        /// instead of paying per-loop overhead. The kernels' array accesses are validated against the
+        /// arrays' strides; the transform throws with a diagnostic if the pair doesn't form a single
+        /// contiguous stream. </summary>
+        /// <param name="outer"> The outer index </param>
+        /// <param name="inner"> The inner index; must address the array dimension immediately inside `outer`'s </param>
+        /// <returns> The flattened index </returns>
+        Index Flatten(Index outer, Index inner);
+
+        /// <summary> Flattens two adjacent indices that traverse contiguous memory into a single index over
+        /// the product of their extents (see above) </summary>
+        /// <param name="outer"> The outer index </param>
+        /// <param name="inner"> The inner index; must address the array dimension immediately inside `outer`'s </param>
+        /// <returns> The flattened index </returns>
+        ScalarIndex Flatten(ScalarIndex outer, ScalarIndex inner);
+
         /// <summary> Unroll the loop along a dimension </summary>
         /// <param name="i"> The dimension to unroll </param>
         /// <param name="size"> Unroll only if the range is smaller than size (exclusive) </param>
@@ -103,6 +196,23 @@ namespace value
         /// <param name="size"> Unroll only if the range is smaller than size (exclusive) </param>
         void Unroll(ScalarIndex i, std::optional<uint64_t> size = std::nullopt); // `i` must be backed by a SymbolicIndexOp
 
+        /// <summary> Creates a wavefront schedule for dependence-carrying nests: skews dimension `i`
+        /// along `reference` and moves the resulting wavefront index outermost. Iterations within one
+        /// wavefront (anti-diagonal of the original i/reference plane) don't depend on each other, so
+        /// `reference` can subsequently be parallelized even though the original nest carried
+        /// dependences across it (the stencil / dynamic-programming case). </summary>
+        /// <param name="i"> The dependence-carrying dimension to skew </param>
+        /// <param name="reference"> The dimension to skew along </param>
+        /// <returns> The wavefront index, placed outermost in the schedule order </returns>
+        Index Wavefront(Index i, Index reference);
+
+        /// <summary> Creates a wavefront schedule for dependence-carrying nests: skews dimension `i`
+        /// along `reference` and moves the resulting wavefront index outermost </summary>
+        /// <param name="i"> The dependence-carrying dimension to skew. Must be backed by a SymbolicIndexOp </param>
+        /// <param name="reference"> The dimension to skew along. Must be backed by a SymbolicIndexOp </param>
+        /// <returns> The wavefront index, placed outermost in the schedule order </returns>
+        ScalarIndex Wavefront(ScalarIndex i, ScalarIndex reference);
+
         /// <summary> Partially unroll the loop along a dimension </summary>
         /// <param name="i"> The dimension to unroll </param>
         /// <param name="factor"> The number of times to unroll the loop </param>
@@ -145,6 +255,15 @@ namespace value
         /// to the end (they will be the innermost loops), starting with the ones from the first nest, and then the second.
         ScalarIndex Fuse(std::vector<Schedule>& others, const std::vector<std::vector<ScalarIndex>>& indexCorrespondences);
 
+        /// Fuse other schedules into this one, destroying the other ones, inferring which indices are fused
+        /// together from the array accesses the schedules' kernels perform: indices that address the same
+        /// dimension of the same array correspond. Throws, with a diagnostic describing the conflicting
+        /// accesses, when the accesses don't determine a unique pairing; use the overload taking explicit
+        /// `indexCorrespondences` in that case.
+        ///
+        /// Returns the "fusing" index, which will be the outermost loop index.
+        ScalarIndex Fuse(std::vector<Schedule>& others);
+
         /// <summary> Creates an execution plan for the host </summary>
         /// <returns> The execution plan </returns>
         Plan CreatePlan();
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Array.h"
+#include "Scalar.h"
+
+#include <functional>
+
+namespace accera
+{
+namespace value
+{
+    /// <summary> A compressed-sparse-row matrix view over dense value and index buffers.
+    /// The member arrays are ordinary Arrays, so a CSR matrix is passed to a function as
+    /// three first-class arguments. </summary>
+    struct CSRMatrix
+    {
+        Array values; /// nonzero values, shape { nnz }
+        Array columnIndices; /// column index of each nonzero, shape { nnz }
+        Array rowOffsets; /// start of each row's nonzeros, shape { rows + 1 }
+        int rows;
+        int columns;
+    };
+
+    /// <summary> A block-sparse-row matrix view with fixed-size dense blocks (e.g. 4x4),
+    /// the block analogue of CSRMatrix. </summary>
+    struct BSRMatrix
+    {
+        Array blockValues; /// nonzero blocks, shape { numBlocks, blockRows, blockColumns }
+        Array blockColumnIndices; /// block-column index of each nonzero block, shape { numBlocks }
+        Array blockRowOffsets; /// start of each block row's blocks, shape { rows / blockRows + 1 }
+        int rows;
+        int columns;
+        int blockRows;
+        int blockColumns;
+    };
+
+    /// <summary> Iterates over the nonzeros of a CSR matrix, calling fn(row, column, value)
+    /// for each stored element </summary>
+    void ForEachNonzero(CSRMatrix A, std::function<void(Scalar, Scalar, Scalar)> fn);
+
+    /// <summary> C = A * B (or C += A * B when clearC is false) with A sparse CSR and B, C
+    /// dense row-major. The dense column loop is vectorized, so each nonzero of A scales a
+    /// contiguous row of B into a contiguous row of C. </summary>
+    void SpMM(CSRMatrix A, Array B, Array C, bool clearC = true);
+
+    /// <summary> C = A * B (or C += A * B when clearC is false) with A block-sparse BSR and
+    /// B, C dense row-major. Each stored block contributes a small dense matmul with the block
+    /// row loop unrolled and the dense column loop vectorized. </summary>
+    void SpMM(BSRMatrix A, Array B, Array C, bool clearC = true);
+
+} // namespace value
+} // namespace accera
@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "FunctionDeclaration.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace accera
+{
+namespace value
+{
+    /// <summary> One statically-specialized variant of a dynamic-shape function: the concrete value each
+    /// runtime dimension takes in this size class. A nest built against these sizes gets the full
+    /// static-shape treatment (unrolling, vectorization, boundary elimination) that generic
+    /// runtime-sized code misses out on. </summary>
+    struct SizeClass
+    {
+        std::vector<int64_t> dimensionSizes; // one entry per runtime dimension argument, in argument order
+    };
+
+    /// <summary> Defines a dynamic-shape function as a set of statically specialized variants plus a
+    /// generic fallback, fronted by a dispatch stub that selects by the actual runtime sizes.
+    ///
+    /// The body generator is invoked once per size class with that class's concrete sizes, and once
+    /// with an empty size vector to produce the generic runtime-sized fallback; inside the generator
+    /// the sizes (when present) should be used in place of the runtime dimension arguments when
+    /// constructing the nest. Each variant becomes an internal function named
+    /// `<name>_<d0>x<d1>x...`; the public function compares the runtime dimension arguments against
+    /// each size class in order and forwards to the first match, or to the fallback. </summary>
+    ///
+    /// <param name="fnDecl"> The declaration of the dispatched function. Must be void-returning. </param>
+    /// <param name="dimensionArgIndices"> The positions of the runtime dimension scalars within the
+    /// function's argument list, in the same order as the entries of each size class. </param>
+    /// <param name="sizeClasses"> The size classes to specialize for, tried in order. </param>
+    /// <param name="body"> The body generator. `sizes` is empty for the generic fallback, otherwise it
+    /// holds the concrete dimension sizes of the variant being defined. </param>
+    void DefineSizeClassSpecializedFunction(FunctionDeclaration fnDecl,
+                                            std::vector<size_t> dimensionArgIndices,
+                                            std::vector<SizeClass> sizeClasses,
+                                            std::function<void(std::vector<Value> args, const std::vector<int64_t>& sizes)> body);
+
+} // namespace value
+} // namespace accera
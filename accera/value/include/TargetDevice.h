@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,14 @@ namespace accera
 {
 namespace value
 {
+    /// <summary> Data cache levels of a target device, used when deriving cache-targeted split factors. </summary>
+    enum class CacheLevel : int
+    {
+        L1 = 1,
+        L2 = 2,
+        L3 = 3
+    };
+
     /// <summary> Properties of a target device. </summary>
     struct TargetDevice
     {
@@ -23,6 +32,35 @@ namespace value
         std::string cpu = "";
         std::string features = "";
         size_t numBits = 0;
+        size_t l1CacheSize = 0; // per-core L1 data cache size in bytes
+        size_t l2CacheSize = 0; // per-core L2 cache size in bytes
+        size_t l3CacheSize = 0; // shared L3 cache size in bytes
+        size_t numVectorRegisters = 0; // architectural SIMD register file size, in registers
+
+        // GPU occupancy limits, per multiprocessor (SM/CU); zero when the target is not a GPU
+        // or the limit is unknown.
+        size_t maxThreadsPerBlock = 0;
+        size_t maxThreadsPerMultiprocessor = 0;
+        size_t maxSharedMemoryPerBlock = 0; // bytes
+        size_t sharedMemoryPerMultiprocessor = 0; // bytes
+        size_t registersPerMultiprocessor = 0; // 32-bit registers
+        size_t numMultiprocessors = 0;
+
+        /// <summary> Returns the size in bytes of the given data cache level (0 if unknown) </summary>
+        size_t GetCacheSize(CacheLevel level) const
+        {
+            switch (level)
+            {
+            case CacheLevel::L1:
+                return l1CacheSize;
+            case CacheLevel::L2:
+                return l2CacheSize;
+            case CacheLevel::L3:
+                return l3CacheSize;
+            default:
+                return 0;
+            }
+        }
 
         /// <summary> Helper function to test whether the TargetDevice has a particular feature </summary>
         /// <remarks> If this is filled in by LLVM for the host target, the possible features are target dependent
@@ -48,6 +86,26 @@ namespace value
         bool IsMacOS() const;
     };
 
+    /// <summary> A register-blocking (micro-kernel) tile shape: `rows` accumulator rows by `cols`
+    /// accumulator columns, where `cols` is a multiple of the target's vector width in elements. </summary>
+    struct RegisterTileShape
+    {
+        int64_t rows;
+        int64_t cols;
+    };
+
+    /// <summary> Derives the register-blocking tile shape from a target's register file, so schedules
+    /// can query the micro-kernel shape instead of hardcoding one per target.
+    ///
+    /// For CPUs this applies the outer-product micro-kernel rule: a fixed number of column vectors
+    /// (more on 32-register files), with as many even accumulator rows as fit after reserving
+    /// registers for the column loads and one broadcast --- yielding the familiar 6x16 fp32 shape on
+    /// AVX2 and 8x48 on AVX-512. For GPUs it sizes a square per-thread block from the per-thread
+    /// register budget (registers per multiprocessor divided by resident threads). </summary>
+    /// <param name="targetDevice"> The device whose register file to use </param>
+    /// <param name="bytesPerElement"> The element size of the accumulators </param>
+    RegisterTileShape DeriveRegisterTileShape(const TargetDevice& targetDevice, int bytesPerElement = 4);
+
     /// <summary> Create a TargetDevice from a device name. </summary>
     TargetDevice GetTargetDevice(std::string deviceName);
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "Array.h"
 #include "Scalar.h"
 
 #include <utilities/include/MemoryLayout.h>
@@ -37,5 +38,27 @@ namespace value
     /// <param name="fn"> The function to be called for each coordinate where there is an active element </param>
     void For(const std::string& name, Tensor tensor, std::function<void(Scalar, Scalar, Scalar)> fn);
 
+    /// <summary> Direct 2-D convolution over channel-blocked (NCHWc) operands </summary>
+    /// <param name="input"> Input activations with layout { inputChannelBlocks, inputRows, inputColumns, inputBlockSize } </param>
+    /// <param name="weights"> Weights with layout { outputChannelBlocks, inputChannelBlocks, kernelRows, kernelColumns, inputBlockSize, outputBlockSize } </param>
+    /// <param name="output"> Output activations with layout { outputChannelBlocks, outputRows, outputColumns, outputBlockSize } </param>
+    /// <param name="rowStride"> Stride of the kernel along the row dimension </param>
+    /// <param name="columnStride"> Stride of the kernel along the column dimension </param>
+    /// <param name="clearOutput"> Whether to zero the output before accumulating </param>
+    /// <remarks> The convolution is "valid" (no padding): outputRows == (inputRows - kernelRows) / rowStride + 1,
+    /// and likewise for columns. The channel block dimension is innermost in every operand so the
+    /// generated kernel vectorizes along output channels regardless of the spatial strides. </remarks>
+    void Convolve2DNCHWc(Array input, Array weights, Array output, int rowStride = 1, int columnStride = 1, bool clearOutput = true);
+
+    /// <summary> Winograd F(2x2, 3x3) 2-D convolution for 3x3 kernels with stride 1 </summary>
+    /// <param name="input"> Input activations with layout { inputChannels, inputRows, inputColumns } </param>
+    /// <param name="weights"> Weights with layout { outputChannels, inputChannels, 3, 3 } </param>
+    /// <param name="output"> Output activations with layout { outputChannels, outputRows, outputColumns } </param>
+    /// <remarks> Emits the full Winograd recipe: the filter and input transform nests, a batched
+    /// small-GEMM core (one channels-by-tiles matmul per transform frequency), and the output
+    /// transform. Uses ~2.25x fewer multiplies than direct convolution. The convolution is
+    /// "valid" (no padding) and the output dimensions must be even. </remarks>
+    void ConvolveWinograd2D(Array input, Array weights, Array output);
+
 } // namespace value
 } // namespace accera
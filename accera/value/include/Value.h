@@ -245,7 +245,7 @@ namespace value
         Value(T t, std::optional<MemoryLayout> layout = {}) noexcept :
             _data(reinterpret_cast<std::add_pointer_t<utilities::RemoveAllPointersT<T>>>(t)),
             _type(GetValueTypeAndPointerLevel<T>()),
-            _layout(layout)
+            _layout(std::move(layout))
         {}
 
         /// <summary> Constructor that creates an instance which serves as a placeholder for data that matches the full type description and layout specified </summary>
@@ -383,7 +383,7 @@ namespace value
 
         /// <summary> Sets the MemoryLayout for this instance </summary>
         /// <param name="layout"> The MemoryLayout to be set on this instance </param>
-        void SetLayout(MemoryLayout layout);
+        void SetLayout(const MemoryLayout& layout);
 
         /// <summary> Clear the MemoryLayout, if any, on this instance </summary>
         void ClearLayout();
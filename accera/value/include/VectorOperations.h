@@ -40,6 +40,17 @@ namespace value
 
     Scalar Max(Vector input);
 
+    /// <summary> Quantized dot-product-accumulate: for each int32 element of accumulate, widens the
+    /// matching 4-element group of the 8-bit inputs to 32 bits, multiplies pointwise, and adds the
+    /// group sum in place (accumulate[i] += sum of a[4i + j] * b[4i + j] for j in [0, 4)). The group
+    /// sum is emitted as a pairwise add tree, which is the shape the backend recognizes when forming
+    /// the pmaddubsw/pmaddwd (x86) and smull/sadalp (ARM) sequences that quantized GEMM inner kernels
+    /// rely on where VNNI / dot-product instructions are unavailable. </summary>
+    /// <param name="a"> 8-bit (signed or unsigned) input vector; its size must be 4x the accumulator's </param>
+    /// <param name="b"> 8-bit (signed or unsigned) input vector of the same size as a </param>
+    /// <param name="accumulate"> int32 accumulator vector, updated in place </param>
+    void Int8DotProductAccumulate(Vector a, Vector b, Vector accumulate);
+
     /// todo pending for PR 1352 to merge
     /// <summary> Turn whatever the data memory layout is into a flat vector </summary>
     Vector ToVector(Value data);
@@ -12,6 +12,7 @@
 #include "Matrix.h"
 #include "Nest.h"
 #include "Plan.h"
+#include "ScalarOperations.h"
 #include "Schedule.h"
 #include "Vector.h"
 
@@ -38,6 +39,98 @@ namespace value
         return Reduce(v, Cast(Scalar(0.0f), elementType), [](Scalar a, Scalar s) { return a + s; });
     }
 
+    Scalar TreeReduce(Array v, Scalar identity, std::function<Scalar(Scalar, Scalar)> reduceFn, bool allowReassociation, int numThreads)
+    {
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+        const int accumulatorDepth = 4; // independent chains per vector lane, to cover FMA latency
+
+        const int numElements = (int)v.Shape()[0];
+        auto elementType = v.GetType();
+
+        if (!allowReassociation || numElements < 2 * vectorSize)
+        {
+            // Strictly ordered semantics (or too small to be worth restructuring)
+            return Reduce(v, identity, [&](Scalar a, Scalar s) { return reduceFn(s, a); });
+        }
+
+        int numAccumulators = vectorSize * accumulatorDepth;
+        while (numAccumulators > vectorSize && numElements / numThreads < numAccumulators)
+        {
+            numAccumulators /= 2;
+        }
+
+        const int totalAccumulators = numThreads * numAccumulators;
+        const int mainIterations = numElements / totalAccumulators;
+        const int tailStart = mainIterations * totalAccumulators;
+        const int chunkElements = mainIterations * numAccumulators;
+
+        auto partials = MakeArray({ numThreads, numAccumulators }, elementType, "treeReducePartials");
+        FillArray(partials, identity);
+
+        // Partial reductions: each thread folds a contiguous chunk into its own row of
+        // independent accumulators, so the accumulator loop vectorizes and the chains are
+        // accumulatorDepth FMAs apart
+        if (mainIterations > 0)
+        {
+            Nest nest(MemoryShape{ numThreads, mainIterations, numAccumulators });
+            ScalarIndex t, it, a;
+            std::tie(t, it, a) = nest.GetIndices<3>();
+            nest.Set([&]() {
+                partials(t, a) = reduceFn(partials(t, a), v(t * chunkElements + it * numAccumulators + a));
+            });
+            auto schedule = nest.CreateSchedule();
+            auto plan = schedule.CreatePlan();
+            if (numThreads > 1)
+            {
+                plan.Parallelize({ t }, numThreads, ParallelizationPolicy::Static);
+            }
+            plan.Vectorize(a, { vectorSize, vectorUnits, true });
+        }
+
+        // Fold the per-thread rows into row 0, still vectorized across accumulators
+        if (numThreads > 1)
+        {
+            Nest foldNest(MemoryShape{ numThreads - 1, numAccumulators });
+            ScalarIndex ft, fa;
+            std::tie(ft, fa) = foldNest.GetIndices<2>();
+            foldNest.Set([&]() {
+                partials(Scalar(0), fa) = reduceFn(partials(Scalar(0), fa), partials(ft + 1, fa));
+            });
+            auto foldSchedule = foldNest.CreateSchedule();
+            auto foldPlan = foldSchedule.CreatePlan();
+            foldPlan.Vectorize(fa, { vectorSize, vectorUnits, true });
+        }
+
+        // Logarithmic combine across the accumulators of row 0
+        for (int stride = numAccumulators / 2; stride >= 1; stride /= 2)
+        {
+            Nest combineNest(MemoryShape{ stride });
+            auto ci = combineNest.GetIndices()[0];
+            combineNest.Set([&]() {
+                partials(Scalar(0), ci) = reduceFn(partials(Scalar(0), ci), partials(Scalar(0), ci + stride));
+            });
+            auto combineSchedule = combineNest.CreateSchedule();
+            auto combinePlan = combineSchedule.CreatePlan();
+            if (stride >= vectorSize)
+            {
+                combinePlan.Vectorize(ci, { vectorSize, vectorUnits, true });
+            }
+        }
+
+        // Fold any ragged tail in serially
+        Scalar result = Allocate(elementType, ScalarLayout);
+        result = partials(Scalar(0), Scalar(0));
+        if (tailStart < numElements)
+        {
+            For(tailStart, numElements, 1, [&](Scalar idx) {
+                result = reduceFn(result, v(idx));
+            });
+        }
+
+        return result;
+    }
+
     void ClearArray(Array A)
     {
         Nest nest(A.Shape());
@@ -217,8 +310,17 @@ namespace value
         ScalarIndex i, j, k;
         std::tie(i, j, k) = nest.GetIndices<3>();
 
+        // Accumulate in C's element type: with fp16/bf16 operands and an fp32 C this widens the
+        // loads inside the kernel (a single vectorizable convert) while the operand caches below
+        // keep the narrow type, so cached A/B panels cost half the bandwidth
+        auto accumulationType = C.GetType();
+        const bool widenA = A.GetType() != accumulationType;
+        const bool widenB = B.GetType() != accumulationType;
+
         nest.Set([&]() {
-            C(i, j) += A(i, k) * B(k, j);
+            auto aVal = widenA ? Cast(A(i, k), accumulationType) : A(i, k);
+            auto bVal = widenB ? Cast(B(k, j), accumulationType) : B(k, j);
+            C(i, j) += aVal * bVal;
         });
 
         auto schedule = nest.CreateSchedule();
@@ -310,5 +412,61 @@ namespace value
         }
     }
 
+    void QuantizeMatrix(Array input, Array scales, Array output)
+    {
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int M = (int)input.Shape()[0];
+        const int N = (int)input.Shape()[1];
+        ThrowIfNot(M == (int)output.Shape()[0]);
+        ThrowIfNot(N == (int)output.Shape()[1]);
+        ThrowIfNot(N == (int)scales.Shape()[0]);
+
+        auto destType = output.GetType();
+
+        Nest nest(MemoryShape{ M, N });
+        ScalarIndex i, j;
+        std::tie(i, j) = nest.GetIndices<2>();
+
+        nest.Set([&]() {
+            output(i, j) = QuantizeSaturate(input(i, j), scales(j), destType);
+        });
+
+        auto schedule = nest.CreateSchedule();
+        auto plan = schedule.CreatePlan();
+        if (N >= vectorSize)
+        {
+            plan.Vectorize(j, { vectorSize, vectorUnits, true });
+        }
+    }
+
+    void DequantizeMatrix(Array input, Array scales, Array output)
+    {
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int M = (int)input.Shape()[0];
+        const int N = (int)input.Shape()[1];
+        ThrowIfNot(M == (int)output.Shape()[0]);
+        ThrowIfNot(N == (int)output.Shape()[1]);
+        ThrowIfNot(N == (int)scales.Shape()[0]);
+
+        Nest nest(MemoryShape{ M, N });
+        ScalarIndex i, j;
+        std::tie(i, j) = nest.GetIndices<2>();
+
+        nest.Set([&]() {
+            output(i, j) = Dequantize(input(i, j), scales(j));
+        });
+
+        auto schedule = nest.CreateSchedule();
+        auto plan = schedule.CreatePlan();
+        if (N >= vectorSize)
+        {
+            plan.Vectorize(j, { vectorSize, vectorUnits, true });
+        }
+    }
+
 } // namespace value
 } // namespace accera
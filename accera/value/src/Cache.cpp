@@ -23,6 +23,7 @@
 #include <mlir/Dialect/Affine/IR/AffineOps.h>
 #include <mlir/Dialect/Arithmetic/IR/Arithmetic.h>
 #include <mlir/Dialect/MemRef/IR/MemRef.h>
+#include <mlir/Dialect/SCF/SCF.h>
 #include <mlir/IR/Attributes.h>
 #include <mlir/IR/BuiltinTypes.h>
 
@@ -225,7 +226,12 @@ namespace value
                              CacheAllocation allocation,
                              MemorySpace dslMemorySpace,
                              MemorySpace dslDoubleBufferMemorySpace,
-                             ExecutionTarget execTarget) :
+                             ExecutionTarget execTarget,
+                             int64_t pipelineDepth = 2,
+                             int64_t prefetchDistance = 0,
+                             bool prefetchL2Only = false,
+                             bool nontemporalWriteback = false,
+                             bool quantizeCache = false) :
             CacheImpl(schedule, value, mapping),
             _execTarget(execTarget)
         {
@@ -301,6 +307,36 @@ namespace value
                                                                                  vectorizationInfo);
                 cacheRegionOp = regionOp;
             }
+            if (pipelineDepth > 2)
+            {
+                // Deeper-than-double buffering: the lowering rotates (pipelineDepth - 1) temp buffers
+                cacheRegionOp->setAttr("pipelineDepth", builder.getI64IntegerAttr(pipelineDepth));
+            }
+            if (prefetchDistance > 0)
+            {
+                // The cache copy lowering emits software prefetches this many elements ahead of the copy loops
+                cacheRegionOp->setAttr("prefetchDistance", builder.getI64IntegerAttr(prefetchDistance));
+                if (prefetchL2Only)
+                {
+                    cacheRegionOp->setAttr("prefetchL2Only", builder.getBoolAttr(true));
+                }
+            }
+            if (nontemporalWriteback)
+            {
+                // The writeback and zeroing lowerings mark their stores as non-temporal streaming stores
+                cacheRegionOp->setAttr("nontemporalWriteback", builder.getBoolAttr(true));
+            }
+            if (quantizeCache)
+            {
+                // Quantized caching packs a floating point array into an integer-typed cache with a
+                // per-active-block scale computed during the fill, so the reduced-precision cache
+                // element type has to be given explicitly
+                if (!elementType.has_value())
+                {
+                    throw accera::utilities::InputException(accera::utilities::InputExceptionErrors::invalidArgument, "Quantized caches require an explicit cache element type");
+                }
+                cacheRegionOp->setAttr("quantizedCache", builder.getBoolAttr(true));
+            }
             auto regionHandle = cacheRegionOp->getResult(0);
             [[maybe_unused]] auto endOp = builder.create<EndCacheRegionOp>(loc, regionHandle);
             _scheduleOp.injectMapping(cacheRegionOp);
@@ -473,8 +509,10 @@ namespace value
     class RuntimeInitCacheImpl : public OfflineCacheImpl
     {
     public:
-        RuntimeInitCacheImpl(ScheduleOp schedule, Value value, const std::string& packingFunctionName, const std::string& packedBufferSizeFnName, CacheIndexing mapping) :
-            OfflineCacheImpl(schedule, value, mapping)
+        RuntimeInitCacheImpl(ScheduleOp schedule, Value value, const std::string& packingFunctionName, const std::string& packedBufferSizeFnName, CacheIndexing mapping, int64_t packingNumThreads, const std::optional<VectorizationInformation>& packingVectorizationInfo) :
+            OfflineCacheImpl(schedule, value, mapping),
+            _packingNumThreads(packingNumThreads),
+            _packingVectorizationInfo(packingVectorizationInfo)
         {
             auto builder = GetBuilder();
 
@@ -507,13 +545,27 @@ namespace value
         void AddCacheCopy(mlir::OpBuilder& builder, mlir::Value input, CacheAccessContext cacheAccessContext, CopyDirection direction)
         {
             auto loc = builder.getUnknownLoc();
+            ActiveElementCacheCopyOp copyOp;
             if (direction == CopyDirection::SourceToCache)
             {
-                builder.create<ActiveElementCacheCopyOp>(loc, input, cacheAccessContext);
+                copyOp = builder.create<ActiveElementCacheCopyOp>(loc, input, cacheAccessContext);
             }
             else
             {
-                builder.create<ActiveElementCacheCopyOp>(loc, cacheAccessContext, input);
+                copyOp = builder.create<ActiveElementCacheCopyOp>(loc, cacheAccessContext, input);
+            }
+
+            // Tag the copy op with any parallelization / vectorization requests for the emitted
+            // packing function; the copy loopnest is only constructed during lowering, so the
+            // requests ride along on the op and get applied to that loopnest's schedule there
+            if (_packingNumThreads > 1)
+            {
+                ParallelizationInfo parallelizationInfo{ _packingNumThreads, ParallelizationInfo::StaticPolicy, 0, ParallelizationInfo::NoReduction, ParallelizationInfo::CompactAffinity, 0 };
+                copyOp->setAttr(ParallelizationInfoAttr::getKeyName(), ParallelizationInfoAttr::get(parallelizationInfo, builder.getContext()));
+            }
+            if (_packingVectorizationInfo.has_value())
+            {
+                copyOp->setAttr(VectorizationInfoAttr::getKeyName(), VectorizationInfoAttr::get(*_packingVectorizationInfo, builder.getContext()));
             }
         }
 
@@ -562,14 +614,18 @@ namespace value
             mlir::Value constantSize = builder.create<mlir::arith::ConstantIntOp>(loc, GetCacheVolume(), builder.getI64Type());
             builder.create<vir::ReturnOp>(loc, constantSize);
         }
+
+        int64_t _packingNumThreads;
+        std::optional<VectorizationInformation> _packingVectorizationInfo;
     };
 
     // Emit-time packed cache Implementation class
     class EmitTimePackedCacheImpl : public OfflineCacheImpl
     {
     public:
-        EmitTimePackedCacheImpl(ScheduleOp schedule, Value value, Value constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing mapping) :
-            OfflineCacheImpl(schedule, value, mapping)
+        EmitTimePackedCacheImpl(ScheduleOp schedule, Value value, Value constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing mapping, bool compressEmbeddedBuffer) :
+            OfflineCacheImpl(schedule, value, mapping),
+            _compressEmbeddedBuffer(compressEmbeddedBuffer)
         {
             auto builder = GetBuilder();
 
@@ -703,6 +759,15 @@ namespace value
             std::vector<ElementType> packedBufferInitData(GetCacheVolume());
             PackBuffer<ElementType>(_input.GetLayout(), constantDataAttr, packedBufferInitData, _shardMapping);
 
+            if (_compressEmbeddedBuffer)
+            {
+                if (auto compressedBuffer = TryEmbedCompressedBuffer<ElementType>(builder, packedBufferInitData, packedLayout, packedBufferName))
+                {
+                    return *compressedBuffer;
+                }
+                // Compression didn't pay for itself on this buffer, fall back to embedding it uncompressed
+            }
+
             accera::value::Array packedBuffer;
             {
                 // Jump to top of module and create the global
@@ -712,9 +777,203 @@ namespace value
                 builder.restoreInsertionPoint(insertionPoint);
                 packedBuffer = accera::value::Array(packedBufferInitData, packedLayout, packedBufferName);
             }
+
+            // Page-align the embedded constant buffer so the loader maps it as whole read-only
+            // pages and multiple processes loading the package share one physical copy
+            auto packedBufferValue = mlir::Value::getFromOpaquePointer(packedBuffer.GetValue().Get<Emittable>().GetDataAs<MLIRContext::EmittableInfo*>()->data);
+            if (auto packedBufferGlobalRef = mlir::dyn_cast_or_null<vir::ReferenceGlobalOp>(packedBufferValue.getDefiningOp()))
+            {
+                constexpr int64_t kEmbeddedBufferPageAlignment = 4096;
+                auto globalOp = packedBufferGlobalRef.getGlobal();
+                globalOp->setAttr(vir::GlobalOp::getAlignmentAttrName(), builder.getI64IntegerAttr(kEmbeddedBufferPageAlignment));
+            }
+
             return packedBuffer;
         }
 
+        // Zero-run-length compressed variant of EmbedPackedBuffer. The packed data is stored as a
+        // constant buffer of literal segments plus a constant table of (literalCount, zeroCount)
+        // segment records, and a mutable uncompressed arena buffer is emitted alongside a
+        // "<packedBufferName>_initialize" function that expands the segments into the arena.
+        // Like the runtime-init packing functions, the caller is responsible for invoking the
+        // initialization function once before calling the wrapper function.
+        template <typename ElementType>
+        std::optional<accera::value::Array> TryEmbedCompressedBuffer(mlir::OpBuilder& builder, const std::vector<ElementType>& packedBufferInitData, const accera::utilities::MemoryLayout& packedLayout, const std::string& packedBufferName)
+        {
+            // The literal buffer is stored with the in-memory representation of the element type, so
+            // skip compression when that representation differs from the MLIR element type (f16 / bf16
+            // are packed as their bit patterns in 16-bit integers)
+            if (GetElementType().isF16() || GetElementType().isBF16())
+            {
+                return std::nullopt;
+            }
+
+            // Split the packed data into alternating literal / zero segments. Short zero runs stay in
+            // the literal segments since a segment record costs more to store than the zeros it elides
+            constexpr int64_t kMinZeroRunElements = 32;
+            std::vector<int64_t> segmentData; // (literalCount, zeroCount) pairs
+            std::vector<ElementType> literalData;
+            const size_t volume = packedBufferInitData.size();
+            size_t idx = 0;
+            while (idx < volume)
+            {
+                size_t literalStart = idx;
+                while (idx < volume)
+                {
+                    if (packedBufferInitData[idx] == static_cast<ElementType>(0))
+                    {
+                        size_t runEnd = idx;
+                        while (runEnd < volume && packedBufferInitData[runEnd] == static_cast<ElementType>(0))
+                        {
+                            ++runEnd;
+                        }
+                        if (static_cast<int64_t>(runEnd - idx) >= kMinZeroRunElements)
+                        {
+                            break;
+                        }
+                        idx = runEnd;
+                    }
+                    else
+                    {
+                        ++idx;
+                    }
+                }
+                size_t zeroStart = idx;
+                while (idx < volume && packedBufferInitData[idx] == static_cast<ElementType>(0))
+                {
+                    ++idx;
+                }
+                segmentData.push_back(static_cast<int64_t>(zeroStart - literalStart));
+                segmentData.push_back(static_cast<int64_t>(idx - zeroStart));
+                literalData.insert(literalData.end(), packedBufferInitData.begin() + literalStart, packedBufferInitData.begin() + zeroStart);
+            }
+
+            // Only keep the compressed form when it saves at least a quarter of the footprint
+            size_t compressedBytes = literalData.size() * sizeof(ElementType) + segmentData.size() * sizeof(int64_t);
+            size_t uncompressedBytes = volume * sizeof(ElementType);
+            if (compressedBytes * 4 >= uncompressedBytes * 3)
+            {
+                return std::nullopt;
+            }
+            if (literalData.empty())
+            {
+                // Avoid emitting a zero-element buffer for all-zero data
+                literalData.push_back(static_cast<ElementType>(0));
+            }
+            int64_t recordCount = static_cast<int64_t>(segmentData.size() / 2);
+
+            accera::value::Array literalsBuffer;
+            accera::value::Array segmentsBuffer;
+            accera::value::Array arenaBuffer;
+            {
+                // Jump to top of module and create the globals
+                mlir::OpBuilder::InsertionGuard insertGuard(builder);
+
+                auto insertionPoint = accera::ir::util::GetTerminalInsertPoint<vir::ValueModuleOp, vir::ModuleTerminatorOp>(_vModuleOp);
+                builder.restoreInsertionPoint(insertionPoint);
+                literalsBuffer = accera::value::Array(literalData, accera::utilities::MemoryLayout{ accera::utilities::MemoryShape{ static_cast<int64_t>(literalData.size()) } }, packedBufferName + "_data");
+                segmentsBuffer = accera::value::Array(segmentData, accera::utilities::MemoryLayout{ accera::utilities::MemoryShape{ static_cast<int64_t>(segmentData.size()) } }, packedBufferName + "_segments");
+
+                // The arena the compressed data gets expanded into is a mutable global with the packed
+                // shape, referenced by the wrapper function the same way an uncompressed embedded
+                // buffer would be
+                auto loc = GetLocation();
+                auto arenaMemrefType = mlir::MemRefType::Builder{ _cacheInfo.cacheType }.setLayout({});
+                auto arenaGlobalOp = builder.create<vir::GlobalOp>(loc, arenaMemrefType, /*isConstant=*/false, packedBufferName, mlir::Attribute{});
+                constexpr int64_t kEmbeddedBufferPageAlignment = 4096;
+                arenaGlobalOp->setAttr(vir::GlobalOp::getAlignmentAttrName(), builder.getI64IntegerAttr(kEmbeddedBufferPageAlignment));
+                mlir::Value arenaRef = builder.create<vir::ReferenceGlobalOp>(loc, arenaGlobalOp);
+                arenaBuffer = accera::value::Array(accera::value::Wrap(arenaRef, packedLayout).GetValue(), packedBufferName);
+            }
+
+            CreateBufferDecompressFunction(builder, literalsBuffer, segmentsBuffer, arenaBuffer, recordCount, packedBufferName);
+
+            return arenaBuffer;
+        }
+
+        // Creates the "<packedBufferName>_initialize" function that expands the literal / zero
+        // segments into the mutable arena global
+        void CreateBufferDecompressFunction(mlir::OpBuilder& builder, accera::value::Array& literalsBuffer, accera::value::Array& segmentsBuffer, accera::value::Array& arenaBuffer, int64_t recordCount, const std::string& packedBufferName)
+        {
+            mlir::OpBuilder::InsertionGuard insertGuard(builder);
+            auto loc = GetLocation();
+
+            auto insertionPoint = accera::ir::util::GetTerminalInsertPoint<vir::ValueModuleOp, vir::ModuleTerminatorOp>(_vModuleOp);
+            builder.restoreInsertionPoint(insertionPoint);
+
+            auto initFnType = builder.getFunctionType({}, llvm::None);
+            vir::ValueFuncOp initFuncOp = builder.create<vir::ValueFuncOp>(loc, packedBufferName + "_initialize", initFnType, ir::value::ExecutionTarget::CPU);
+            initFuncOp->setAttr(ir::HeaderDeclAttrName, builder.getUnitAttr());
+            initFuncOp->setAttr(ir::RawPointerAPIAttrName, builder.getUnitAttr());
+
+            builder.setInsertionPointToStart(&initFuncOp.body().front());
+
+            auto getLocalGlobalRef = [&](accera::value::Array& arrayWrapper) {
+                auto unwrappedValue = mlir::Value::getFromOpaquePointer(arrayWrapper.GetValue().Get<Emittable>().GetDataAs<MLIRContext::EmittableInfo*>()->data);
+                auto globalScopeRef = mlir::dyn_cast_or_null<vir::ReferenceGlobalOp>(unwrappedValue.getDefiningOp());
+                assert(globalScopeRef != nullptr);
+                return builder.create<vir::ReferenceGlobalOp>(loc, globalScopeRef.getGlobal());
+            };
+            mlir::Value literalsRef = getLocalGlobalRef(literalsBuffer);
+            mlir::Value segmentsRef = getLocalGlobalRef(segmentsBuffer);
+            mlir::Value arenaRef = getLocalGlobalRef(arenaBuffer);
+
+            // View the arena as a flat buffer for linear writes
+            auto elementType = GetElementType();
+            auto flatArenaType = mlir::MemRefType::get({ GetCacheVolume() }, elementType);
+            mlir::Value shapelessArena = builder.create<mlir::memref::CastOp>(loc, arenaRef, mlir::UnrankedMemRefType::get(elementType, flatArenaType.getMemorySpace()));
+            mlir::Value flatArena = builder.create<mlir::memref::CastOp>(loc, shapelessArena, flatArenaType);
+
+            auto zero = builder.create<mlir::arith::ConstantIndexOp>(loc, 0);
+            auto one = builder.create<mlir::arith::ConstantIndexOp>(loc, 1);
+            auto two = builder.create<mlir::arith::ConstantIndexOp>(loc, 2);
+            auto recordCountVal = builder.create<mlir::arith::ConstantIndexOp>(loc, recordCount);
+            auto zeroElement = builder.create<mlir::arith::ConstantOp>(loc, builder.getZeroAttr(elementType));
+
+            // for each record: copy the literal run, then zero-fill the elided run, carrying the
+            // output and literal positions as loop iteration args
+            auto outerLoop = builder.create<mlir::scf::ForOp>(loc, zero, recordCountVal, one, mlir::ValueRange{ zero, zero });
+            {
+                mlir::OpBuilder::InsertionGuard loopGuard(builder);
+                builder.setInsertionPointToStart(outerLoop.getBody());
+                auto record = outerLoop.getInductionVar();
+                mlir::Value outIdx = outerLoop.getRegionIterArgs()[0];
+                mlir::Value litIdx = outerLoop.getRegionIterArgs()[1];
+
+                auto segmentBase = builder.create<mlir::arith::MulIOp>(loc, record, two);
+                auto segmentNext = builder.create<mlir::arith::AddIOp>(loc, segmentBase, one);
+                mlir::Value litCount = builder.create<mlir::arith::IndexCastOp>(loc, builder.getIndexType(), builder.create<mlir::memref::LoadOp>(loc, segmentsRef, mlir::ValueRange{ segmentBase }));
+                mlir::Value zeroCount = builder.create<mlir::arith::IndexCastOp>(loc, builder.getIndexType(), builder.create<mlir::memref::LoadOp>(loc, segmentsRef, mlir::ValueRange{ segmentNext }));
+
+                auto literalLoop = builder.create<mlir::scf::ForOp>(loc, zero, litCount, one);
+                {
+                    mlir::OpBuilder::InsertionGuard innerGuard(builder);
+                    builder.setInsertionPointToStart(literalLoop.getBody());
+                    auto offset = literalLoop.getInductionVar();
+                    auto srcIdx = builder.create<mlir::arith::AddIOp>(loc, litIdx, offset);
+                    auto dstIdx = builder.create<mlir::arith::AddIOp>(loc, outIdx, offset);
+                    auto element = builder.create<mlir::memref::LoadOp>(loc, literalsRef, mlir::ValueRange{ srcIdx.getResult() });
+                    builder.create<mlir::memref::StoreOp>(loc, element, flatArena, mlir::ValueRange{ dstIdx.getResult() });
+                }
+
+                mlir::Value outAfterLiterals = builder.create<mlir::arith::AddIOp>(loc, outIdx, litCount);
+                auto zeroLoop = builder.create<mlir::scf::ForOp>(loc, zero, zeroCount, one);
+                {
+                    mlir::OpBuilder::InsertionGuard innerGuard(builder);
+                    builder.setInsertionPointToStart(zeroLoop.getBody());
+                    auto offset = zeroLoop.getInductionVar();
+                    auto dstIdx = builder.create<mlir::arith::AddIOp>(loc, outAfterLiterals, offset);
+                    builder.create<mlir::memref::StoreOp>(loc, zeroElement, flatArena, mlir::ValueRange{ dstIdx.getResult() });
+                }
+
+                mlir::Value outNext = builder.create<mlir::arith::AddIOp>(loc, outAfterLiterals, zeroCount);
+                mlir::Value litNext = builder.create<mlir::arith::AddIOp>(loc, litIdx, litCount);
+                builder.create<mlir::scf::YieldOp>(loc, mlir::ValueRange{ outNext, litNext });
+            }
+
+            builder.create<vir::ReturnOp>(loc);
+        }
+
         void CreateWrapperFunction(mlir::OpBuilder& builder, const std::string& wrapperFnName)
         {
             mlir::OpBuilder::InsertionGuard insertGuard(builder);
@@ -773,6 +1032,7 @@ namespace value
 
         accera::value::Array _packedBuffer;
         mlir::Value _packedBufferMlirValue;
+        bool _compressEmbeddedBuffer;
     };
 
     //
@@ -814,7 +1074,12 @@ namespace value
                  CacheAllocation allocation,
                  MemorySpace memorySpace,
                  MemorySpace doubleBufferMemorySpace,
-                 ExecutionTarget execTarget)
+                 ExecutionTarget execTarget,
+                 int64_t pipelineDepth,
+                 int64_t prefetchDistance,
+                 bool prefetchL2Only,
+                 bool nontemporalWriteback,
+                 bool quantizeCache)
     {
         std::optional<Index> keySlice;
         if (keySliceIndex.has_value())
@@ -843,7 +1108,12 @@ namespace value
                                                            allocation,
                                                            memorySpace,
                                                            doubleBufferMemorySpace,
-                                                           execTarget);
+                                                           execTarget,
+                                                           pipelineDepth,
+                                                           prefetchDistance,
+                                                           prefetchL2Only,
+                                                           nontemporalWriteback,
+                                                           quantizeCache);
         }
         else
         {
@@ -862,7 +1132,12 @@ namespace value
                                                            allocation,
                                                            memorySpace,
                                                            doubleBufferMemorySpace,
-                                                           execTarget);
+                                                           execTarget,
+                                                           pipelineDepth,
+                                                           prefetchDistance,
+                                                           prefetchL2Only,
+                                                           nontemporalWriteback,
+                                                           quantizeCache);
         }
     }
 
@@ -881,7 +1156,12 @@ namespace value
                  CacheAllocation allocation,
                  MemorySpace memorySpace,
                  MemorySpace doubleBufferMemorySpace,
-                 ExecutionTarget execTarget)
+                 ExecutionTarget execTarget,
+                 int64_t pipelineDepth,
+                 int64_t prefetchDistance,
+                 bool prefetchL2Only,
+                 bool nontemporalWriteback,
+                 bool quantizeCache)
     {
         std::optional<Index> keySlice;
         if (keySliceIndex.has_value())
@@ -911,7 +1191,12 @@ namespace value
                                                            allocation,
                                                            memorySpace,
                                                            doubleBufferMemorySpace,
-                                                           execTarget);
+                                                           execTarget,
+                                                           pipelineDepth,
+                                                           prefetchDistance,
+                                                           prefetchL2Only,
+                                                           nontemporalWriteback,
+                                                           quantizeCache);
         }
         else
         {
@@ -930,7 +1215,12 @@ namespace value
                                                            allocation,
                                                            memorySpace,
                                                            doubleBufferMemorySpace,
-                                                           execTarget);
+                                                           execTarget,
+                                                           pipelineDepth,
+                                                           prefetchDistance,
+                                                           prefetchL2Only,
+                                                           nontemporalWriteback,
+                                                           quantizeCache);
         }
     }
 
@@ -939,8 +1229,10 @@ namespace value
                  ViewAdapter value,
                  const std::string& packingFunctionName,
                  const std::string& packedBufferSizeFnName,
-                 CacheIndexing mapping) :
-        _impl(std::make_unique<RuntimeInitCacheImpl>(schedule, value, packingFunctionName, packedBufferSizeFnName, mapping))
+                 CacheIndexing mapping,
+                 int64_t packingNumThreads,
+                 const std::optional<VectorizationInformation>& packingVectorizationInfo) :
+        _impl(std::make_unique<RuntimeInitCacheImpl>(schedule, value, packingFunctionName, packedBufferSizeFnName, mapping, packingNumThreads, packingVectorizationInfo))
     {
     }
 
@@ -950,8 +1242,9 @@ namespace value
                  ViewAdapter constantData,
                  const std::string& wrapperFnName,
                  const std::string& packedBufferName,
-                 CacheIndexing mapping) :
-        _impl(std::make_unique<EmitTimePackedCacheImpl>(schedule, value, constantData, wrapperFnName, packedBufferName, mapping))
+                 CacheIndexing mapping,
+                 bool compressEmbeddedBuffer) :
+        _impl(std::make_unique<EmitTimePackedCacheImpl>(schedule, value, constantData, wrapperFnName, packedBufferName, mapping, compressEmbeddedBuffer))
     {
     }
 
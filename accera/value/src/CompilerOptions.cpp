@@ -59,6 +59,23 @@ namespace value
         profile = properties.GetOrParseEntry<bool>("profile", profile);
         includeDiagnosticInfo = properties.GetOrParseEntry<bool>("includeDiagnosticInfo", includeDiagnosticInfo);
         useFastMath = properties.GetOrParseEntry<bool>("useFastMath", useFastMath);
+        llvmOptimizationLevel = properties.GetOrParseEntry<int>("llvmOptimizationLevel", llvmOptimizationLevel);
+        if (properties.HasEntry("llvmUnrollThreshold"))
+        {
+            llvmUnrollThreshold = properties.GetOrParseEntry<int>("llvmUnrollThreshold");
+        }
+        if (properties.HasEntry("llvmLoopVectorize"))
+        {
+            llvmLoopVectorize = properties.GetOrParseEntry<bool>("llvmLoopVectorize");
+        }
+        if (properties.HasEntry("llvmTargetCpu"))
+        {
+            llvmTargetCpu = properties.GetEntry<std::string>("llvmTargetCpu");
+        }
+        if (properties.HasEntry("llvmTargetFeatures"))
+        {
+            llvmTargetFeatures = properties.GetEntry<std::string>("llvmTargetFeatures");
+        }
         debug = properties.GetOrParseEntry<bool>("debug", debug);
         gpu_only = properties.GetOrParseEntry<bool>("gpu_only", gpu_only);
         globalValueAlignment = properties.GetOrParseEntry<int>("globalValueAlignment", globalValueAlignment);
@@ -5,10 +5,16 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "FastMath.h"
+#include "Array.h"
 #include "EmitterContext.h"
 #include "MLIREmitterContext.h"
+#include "Nest.h"
+#include "Plan.h"
 #include "Scalar.h"
 #include "ScalarOperations.h"
+#include "Schedule.h"
+
+#include <utilities/include/Exception.h>
 
 #include <mlir/Dialect/StandardOps/IR/Ops.h>
 
@@ -57,6 +63,68 @@ namespace value
             int32_t(0x3F800000), // MaximumExponent
         };
 
+        const struct
+        {
+            float LowerRange;
+            float UpperRange;
+            float alpha_13;
+            float alpha_11;
+            float alpha_9;
+            float alpha_7;
+            float alpha_5;
+            float alpha_3;
+            float alpha_1;
+            float beta_6;
+            float beta_4;
+            float beta_2;
+            float beta_0;
+        } MlasTanhConstants = {
+            -9.0f, // LowerRange
+            9.0f, // UpperRange
+            -2.76076847742355e-16f, // alpha_13
+            2.00018790482477e-13f, // alpha_11
+            -8.60467152213735e-11f, // alpha_9
+            5.12229709037114e-08f, // alpha_7
+            1.48572235717979e-05f, // alpha_5
+            6.37261928875436e-04f, // alpha_3
+            4.89352455891786e-03f, // alpha_1
+            1.19825839466702e-06f, // beta_6
+            1.18534705686654e-04f, // beta_4
+            2.26843463243900e-03f, // beta_2
+            4.89352518554385e-03f, // beta_0
+        };
+
+        const struct
+        {
+            float LowerRange;
+            float UpperRange;
+            float alpha_9;
+            float alpha_7;
+            float alpha_5;
+            float alpha_3;
+            float alpha_1;
+            float beta_10;
+            float beta_8;
+            float beta_6;
+            float beta_4;
+            float beta_2;
+            float beta_0;
+        } MlasLogisticConstants = {
+            -18.0f, // LowerRange
+            18.0f, // UpperRange
+            4.37031012579801e-11f, // alpha_9
+            1.15627324459942e-07f, // alpha_7
+            6.08574864600143e-05f, // alpha_5
+            8.51377133304701e-03f, // alpha_3
+            2.48287947061529e-01f, // alpha_1
+            6.10247389755681e-13f, // beta_10
+            5.76102136993427e-09f, // beta_8
+            6.29106785017040e-06f, // beta_6
+            1.70198817374094e-03f, // beta_4
+            1.16817656904453e-01f, // beta_2
+            9.93151921023180e-01f, // beta_0
+        };
+
         Scalar IntAsFloat(Scalar i)
         {
             // TODO: assert i is int32
@@ -179,5 +247,190 @@ namespace value
 #endif
         return p;
     }
+
+    Scalar FastLog(Scalar a, FastMathAccuracy accuracy)
+    {
+        if (accuracy == FastMathAccuracy::Low)
+        {
+            // adapted from fastlog2 in fastapprox (Paul Mineiro); absolute error around 2e-3 in log2 units
+            auto ia = FloatAsInt(a);
+            auto m = IntAsFloat(BitwiseOr(BitwiseAnd(ia, Scalar((int32_t)0x007fffff)), Scalar((int32_t)0x3f000000)));
+            auto y = Cast(ia, ValueType::Float) * 1.1920928955078125e-7f; // 0x1.0p-23
+            auto log2a = y - 124.22551499f - 1.498030302f * m - 1.72587999f / (0.3520887068f + m);
+            return log2a * 6.93147182e-1f; // log(2)
+        }
+
+        // adapted from https://stackoverflow.com/questions/39821367 (njuffa); maximum error 0.85 ulps
+        auto e = BitwiseAnd(FloatAsInt(a) - 0x3f2aaaab, Scalar((int32_t)0xff800000));
+        auto m = IntAsFloat(FloatAsInt(a) - e);
+        auto i = Cast(SignedShiftRight(e, 23), ValueType::Float);
+
+        // m is in [2/3, 4/3]; approximate log1p(f) for f in [-1/3, 1/3]
+        auto f = m - 1.0f;
+        auto s = f * f;
+        auto r = Fma(0.230836749f, f, -0.279208571f); // 0x1.d8c0f0p-3, -0x1.1de8dap-2
+        auto t = Fma(0.331826031f, f, -0.498910338f); // 0x1.53ca34p-2, -0x1.fee25ap-2
+        r = Fma(r, s, t);
+        r = Fma(r, s, f);
+        r = Fma(i, 6.93147182e-1f, r); // 0x1.62e430p-1 // log(2)
+        return r;
+    }
+
+    Scalar FastTanh(Scalar a, FastMathAccuracy accuracy)
+    {
+        if (accuracy == FastMathAccuracy::Low)
+        {
+            // Pade approximant x * (27 + x^2) / (27 + 9 * x^2); exact at the +/-3 clamp bounds,
+            // where the absolute error against tanh peaks at about 5e-3
+            auto x = Clamp(a, -3.0f, 3.0f);
+            auto s = x * x;
+            return x * (27.0f + s) / Fma(9.0f, s, 27.0f);
+        }
+
+        // adapted from MLAS: rational polynomial of routine MlasComputeTanhF32Kernel (also used by Eigen)
+        auto x = Clamp(a, MlasTanhConstants.LowerRange, MlasTanhConstants.UpperRange);
+        auto s = x * x;
+
+        auto p = Fma(Scalar(MlasTanhConstants.alpha_13), s, MlasTanhConstants.alpha_11);
+        p = Fma(p, s, MlasTanhConstants.alpha_9);
+        p = Fma(p, s, MlasTanhConstants.alpha_7);
+        p = Fma(p, s, MlasTanhConstants.alpha_5);
+        p = Fma(p, s, MlasTanhConstants.alpha_3);
+        p = Fma(p, s, MlasTanhConstants.alpha_1);
+        p = p * x;
+
+        auto q = Fma(Scalar(MlasTanhConstants.beta_6), s, MlasTanhConstants.beta_4);
+        q = Fma(q, s, MlasTanhConstants.beta_2);
+        q = Fma(q, s, MlasTanhConstants.beta_0);
+
+        return p / q;
+    }
+
+    Scalar FastSigmoid(Scalar a, FastMathAccuracy accuracy)
+    {
+        if (accuracy == FastMathAccuracy::Low)
+        {
+            // sigmoid(x) = 0.5 * tanh(x / 2) + 0.5
+            return Fma(FastTanh(a * 0.5f, accuracy), 0.5f, 0.5f);
+        }
+
+        // adapted from MLAS: rational polynomial of routine MlasComputeLogisticF32Kernel
+        auto x = Clamp(a, MlasLogisticConstants.LowerRange, MlasLogisticConstants.UpperRange);
+        auto s = x * x;
+
+        auto p = Fma(Scalar(MlasLogisticConstants.alpha_9), s, MlasLogisticConstants.alpha_7);
+        p = Fma(p, s, MlasLogisticConstants.alpha_5);
+        p = Fma(p, s, MlasLogisticConstants.alpha_3);
+        p = Fma(p, s, MlasLogisticConstants.alpha_1);
+        p = p * x;
+
+        auto q = Fma(Scalar(MlasLogisticConstants.beta_10), s, MlasLogisticConstants.beta_8);
+        q = Fma(q, s, MlasLogisticConstants.beta_6);
+        q = Fma(q, s, MlasLogisticConstants.beta_4);
+        q = Fma(q, s, MlasLogisticConstants.beta_2);
+        q = Fma(q, s, MlasLogisticConstants.beta_0);
+
+        return p / q + 0.5f;
+    }
+
+    Scalar FastErf(Scalar a, FastMathAccuracy accuracy)
+    {
+        if (accuracy == FastMathAccuracy::Low)
+        {
+            // erf(x) = tanh(sqrt(2/pi) * (sqrt(2) * x + 0.044715 * (sqrt(2) * x)^3)), the inverse of the
+            // tanh-flavored GELU approximation
+            auto s = a * a;
+            return FastTanh(a * Fma(Scalar(1.00905243e-1f), s, 1.12837916f), accuracy);
+        }
+
+        // Abramowitz & Stegun 7.1.26; maximum absolute error 1.5e-7
+        auto x = Abs(a);
+        auto t = 1.0f / Fma(3.275911e-1f, x, 1.0f);
+        auto y = Fma(Scalar(1.061405429f), t, -1.453152027f);
+        y = Fma(y, t, 1.421413741f);
+        y = Fma(y, t, -0.284496736f);
+        y = Fma(y, t, 0.254829592f);
+        y = 1.0f - y * t * FastExpMlas(-(x * x));
+        return Select(a < 0.0f, -y, y);
+    }
+
+    Scalar FastReciprocal(Scalar a, int refinementIterations)
+    {
+        // Initial estimate by exponent negation (magic constant tuned over the full float range),
+        // good to about 5 bits
+        auto y = IntAsFloat(Scalar((int32_t)0x7EF311C3) - FloatAsInt(a));
+        for (int iteration = 0; iteration < refinementIterations; ++iteration)
+        {
+            // y' = y * (2 - a*y)
+            y = y * Fma(-a, y, 2.0f);
+        }
+        return y;
+    }
+
+    Scalar FastReciprocalSqrt(Scalar a, int refinementIterations)
+    {
+        // The classic halved-exponent estimate (Quake/Lomont constant), good to about 4 bits
+        auto y = IntAsFloat(Scalar((int32_t)0x5F375A86) - SignedShiftRight(FloatAsInt(a), 1));
+        auto negHalfA = a * -0.5f;
+        for (int iteration = 0; iteration < refinementIterations; ++iteration)
+        {
+            // y' = y * (1.5 - 0.5*a*y*y)
+            y = y * Fma(negHalfA * y, y, 1.5f);
+        }
+        return y;
+    }
+
+    namespace
+    {
+        // Shared loop structure for the batched entry points: one nest over the array shape with
+        // the innermost dimension vectorized and unrolled, matching the vectorization parameters
+        // the fused ML operations use
+        template <typename KernelFnType>
+        void FastMathArrayImpl(Array input, Array output, KernelFnType kernelFn)
+        {
+            ThrowIfNot(input.Shape() == output.Shape());
+
+            const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+            const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+            Nest nest(input.Shape());
+            auto indices = nest.GetIndices();
+            nest.Set([&]() {
+                output(indices) = kernelFn(input(indices));
+            });
+
+            auto schedule = nest.CreateSchedule();
+            auto plan = schedule.CreatePlan();
+
+            auto shape = input.Shape();
+            int innermostSize = static_cast<int>(shape[static_cast<int>(shape.NumDimensions()) - 1]);
+            if (innermostSize >= vectorSize)
+            {
+                auto vectorUnitsToUse = innermostSize >= vectorUnits ? vectorUnits : vectorSize;
+                plan.Vectorize(indices.back(), { vectorSize, vectorUnitsToUse, true });
+            }
+        }
+    } // namespace
+
+    void FastExpArray(Array input, Array output, FastMathAccuracy accuracy)
+    {
+        FastMathArrayImpl(input, output, [accuracy](Scalar s) {
+            return accuracy == FastMathAccuracy::Low ? FastExpMlas(s) : FastExp(s);
+        });
+    }
+
+    void FastLogArray(Array input, Array output, FastMathAccuracy accuracy)
+    {
+        FastMathArrayImpl(input, output, [accuracy](Scalar s) {
+            return FastLog(s, accuracy);
+        });
+    }
+
+    void FastTanhArray(Array input, Array output, FastMathAccuracy accuracy)
+    {
+        FastMathArrayImpl(input, output, [accuracy](Scalar s) {
+            return FastTanh(s, accuracy);
+        });
+    }
 } // namespace value
 } // namespace accera
@@ -147,6 +147,30 @@ namespace value
         return *this;
     }
 
+    FunctionDeclaration& FunctionDeclaration::AsyncAPI(bool emitAsyncAPI)
+    {
+        CheckNonEmpty();
+
+        _emitAsyncAPI = emitAsyncAPI;
+        return *this;
+    }
+
+    FunctionDeclaration& FunctionDeclaration::BenchmarkAPI(bool emitBenchmarkAPI)
+    {
+        CheckNonEmpty();
+
+        _emitBenchmarkAPI = emitBenchmarkAPI;
+        return *this;
+    }
+
+    FunctionDeclaration& FunctionDeclaration::CallerWorkspace(bool useCallerWorkspace)
+    {
+        CheckNonEmpty();
+
+        _useCallerWorkspace = useCallerWorkspace;
+        return *this;
+    }
+
     FunctionDeclaration& FunctionDeclaration::OutputVerifiers(const std::vector<std::string>& functionNames)
     {
         CheckNonEmpty();
@@ -155,6 +179,14 @@ namespace value
         return *this;
     }
 
+    FunctionDeclaration& FunctionDeclaration::DebugSampleInterval(int64_t interval)
+    {
+        CheckNonEmpty();
+
+        _debugSampleInterval = interval;
+        return *this;
+    }
+
     FunctionDeclaration& FunctionDeclaration::AddTag(const std::string& tag)
     {
         CheckNonEmpty();
@@ -273,6 +305,34 @@ namespace value
         return _inlineState;
     }
 
+    ValidationResult<InputExceptionErrors> FunctionDeclaration::ValidateArguments(const std::vector<Value>& arguments) const
+    {
+        CheckNonEmpty();
+
+        auto makeError = [this](std::function<std::string()> formatMessage) {
+            return ValidationResult<InputExceptionErrors>::MakeError(InputExceptionErrors::invalidArgument, std::move(formatMessage));
+        };
+
+        if (arguments.size() != _paramTypes.size())
+        {
+            return makeError([name = _originalFunctionName, expected = _paramTypes.size(), actual = arguments.size()] {
+                return "Function '" + name + "' expects " + std::to_string(expected) + " arguments but was given " + std::to_string(actual);
+            });
+        }
+
+        for (size_t i = 0; i < arguments.size(); ++i)
+        {
+            if (arguments[i].GetBaseType() != _paramTypes[i].GetBaseType())
+            {
+                return makeError([name = _originalFunctionName, i, expected = _paramTypes[i].GetBaseType(), actual = arguments[i].GetBaseType()] {
+                    return "Argument " + std::to_string(i) + " of function '" + name + "' has type " + ToString(actual) + " but the declaration expects " + ToString(expected);
+                });
+            }
+        }
+
+        return ValidationSuccess();
+    }
+
     void FunctionDeclaration::CheckNonEmpty() const
     {
         if (_isEmpty)
@@ -43,6 +43,8 @@
 #include <mlir/Dialect/SPIRV/IR/SPIRVTypes.h>
 #include <mlir/Dialect/SPIRV/IR/TargetAndABI.h>
 #include <mlir/Dialect/StandardOps/IR/Ops.h>
+#include <mlir/ExecutionEngine/ExecutionEngine.h>
+#include <mlir/ExecutionEngine/OptUtils.h>
 #include <mlir/IR/Attributes.h>
 #include <mlir/IR/Builders.h>
 #include <mlir/IR/BuiltinOps.h>
@@ -54,6 +56,7 @@
 #include <mlir/IR/Types.h>
 #include <mlir/Pass/Pass.h>
 #include <mlir/Pass/PassManager.h>
+#include <mlir/Pass/PassRegistry.h>
 #include <mlir/Support/LLVM.h>
 #include <mlir/Support/LogicalResult.h>
 
@@ -63,6 +66,7 @@
 #include <llvm/Support/Debug.h>
 #include <llvm/Support/ErrorHandling.h>
 #include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_os_ostream.h>
 
 using namespace accera;
@@ -79,13 +83,11 @@ mlir::Type ToLLVMMemrefDescriptorType(mlir::OpBuilder& builder, ::accera::value:
 struct InitAccera
 {
     InitAccera(::mlir::MLIRContext* ctx) :
-        _ownedContext(ctx ? nullptr : new mlir::MLIRContext),
-        _context(ctx ? ctx : _ownedContext.get())
-
+        _context(ctx ? ctx : SharedContext())
     {
         accera::ir::InitializeAccera();
 
-        // By default, eagerly load all of our registered dialects in our owned MLIRContext
+        // By default, eagerly load all of our registered dialects in our MLIRContext
         // Eventually we may want to instead lazily load dialects once we have more
         // dialects to deal with
         _context->appendDialectRegistry(ir::GetDialectRegistry());
@@ -96,7 +98,18 @@ protected:
     mlir::MLIRContext& context() { return *_context; }
 
 private:
-    std::unique_ptr<mlir::MLIRContext> _ownedContext;
+    // One context shared by every package built in this process (unless the caller supplies its
+    // own). Attributes, types and affine maps are interned per-context, so generator processes
+    // that build many packages in sequence reuse the interned layout maps that recur across
+    // packages instead of re-creating them, and skip the per-build dialect registration and
+    // context thread pool setup. Packages stay isolated from each other at the module level:
+    // each MLIRContextBase::Impl creates its own ModuleOp inside this context.
+    static mlir::MLIRContext* SharedContext()
+    {
+        static mlir::MLIRContext instance;
+        return &instance;
+    }
+
     mlir::MLIRContext* _context;
 };
 
@@ -792,6 +805,69 @@ mlir::OwningOpRef<mlir::ModuleOp> MLIRContext::cloneModule() const
     return _impl->_mlirModule.clone();
 }
 
+MLIRContext::JitFunction MLIRContext::JitCompile(const std::string& functionName)
+{
+    if (auto it = _jitFunctions.find(functionName); it != _jitFunctions.end())
+    {
+        return it->second;
+    }
+
+    if (!_jitEngine)
+    {
+        // Lower a clone so this context's module stays at the value level for
+        // further emission and header generation.
+        auto loweredModule = cloneModule();
+
+        // The lowering pipeline lives in the transforms library, which links
+        // against this one, so pick it up through the pass registry instead of
+        // calling it directly.
+        mlir::PassManager pm(loweredModule->getContext());
+        if (failed(mlir::parsePassPipeline("acc-to-llvm", pm)))
+        {
+            throw LogicException(LogicExceptionErrors::illegalState, "JIT compilation requires the acc-to-llvm pipeline to be registered (see accera::transforms::RegisterAllPasses)");
+        }
+        if (failed(pm.run(*loweredModule)))
+        {
+            throw LogicException(LogicExceptionErrors::illegalState, "Failed to lower module for JIT compilation");
+        }
+
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+
+        auto transformer = mlir::makeOptimizingTransformer(
+            /*optLevel=*/2,
+            /*sizeLevel=*/0,
+            /*targetMachine=*/nullptr);
+        auto maybeEngine = mlir::ExecutionEngine::create(*loweredModule, /*llvmModuleBuilder=*/nullptr, transformer);
+        if (!maybeEngine)
+        {
+            llvm::consumeError(maybeEngine.takeError());
+            throw LogicException(LogicExceptionErrors::illegalState, "Failed to create JIT execution engine");
+        }
+        _jitEngine = std::move(*maybeEngine);
+    }
+
+    // ORC only materializes a function's machine code when its symbol is first
+    // looked up; cache the entry point so later tuning iterations pay for
+    // neither compilation nor the symbol search.
+    auto expectedFPtr = _jitEngine->lookupPacked(functionName);
+    if (!expectedFPtr)
+    {
+        llvm::consumeError(expectedFPtr.takeError());
+        throw InputException(InputExceptionErrors::invalidArgument, "JIT lookup failed for function: " + functionName);
+    }
+
+    auto fptr = *expectedFPtr;
+    _jitFunctions.emplace(functionName, fptr);
+    return fptr;
+}
+
+void MLIRContext::InvalidateJitEngine()
+{
+    _jitFunctions.clear();
+    _jitEngine.reset();
+}
+
 void MLIRContext::writeHeader(std::optional<std::string> filename) const
 {
     using llvm::raw_fd_ostream;
@@ -815,6 +891,18 @@ void MLIRContext::writeHeader(std::optional<std::string> filename) const
     }();
 
     (void)ir::TranslateToHeader(_impl->_mlirModule, stream);
+
+    if (filename)
+    {
+        // Emit the binary metadata sidecar alongside the text header so loaders can mmap the
+        // function metadata instead of re-parsing the TOML header at startup
+        std::error_code ec;
+        raw_fd_ostream binStream(*filename + ".bin", ec);
+        if (!ec)
+        {
+            (void)ir::TranslateToBinaryMetadata(_impl->_mlirModule, binStream);
+        }
+    }
 }
 
 void MLIRContext::setMetadata(const std::string& key, const accera::ir::MetadataValueType& value)
@@ -951,6 +1039,21 @@ Value MLIRContext::AllocateImpl(ValueType valueType, MemoryLayout layout, size_t
     }
     auto memrefTy = MemoryLayoutToMemRefType(b, layout, valueType);
 
+    constexpr int64_t kHugePageAlignment = 2 * 1024 * 1024;
+    if (static_cast<bool>(flags & AllocateFlags::HugePages) && layout.GetAlignment() == 0)
+    {
+        // The huge-page allocator hands back 2MB-aligned buffers; record the guarantee on the
+        // layout so it is visible wherever the layout travels
+        layout = layout.SetAlignment(kHugePageAlignment);
+    }
+
+    // An alignment carried by the layout is a guarantee this allocation must honor; an
+    // explicit alignment argument still wins
+    if (alignment == 0 && layout.GetAlignment() > 0)
+    {
+        alignment = static_cast<size_t>(layout.GetAlignment());
+    }
+
     mlir::OpBuilder::InsertionGuard guard(b);
     // Place the alloc op at the beginning of the block (after other allocs), unless it depends
     // on runtime sizes that are defined before this
@@ -999,6 +1102,11 @@ Value MLIRContext::AllocateImpl(ValueType valueType, MemoryLayout layout, size_t
                                                 : llvm::None);
     }
 
+    if (static_cast<bool>(flags & AllocateFlags::HugePages))
+    {
+        result.getDefiningOp()->setAttr(ir::value::HugePageAllocationAttrName, b.getUnitAttr());
+    }
+
     EmittableInfo& emittableInfo = StoreLocalEmittable({ result.getAsOpaquePointer(), { valueType, 1 } });
     Emittable emittable{ &emittableInfo };
 
@@ -1105,6 +1213,17 @@ EmitterContext::DefinedFunction MLIRContext::CreateFunctionImpl(FunctionDeclarat
     const auto& fnName = decl.GetFunctionName();
     auto argValuesCopy = argValues;
     auto fnType = ::ToMLIRType(b, decl);
+    if (decl.UsesCallerWorkspace())
+    {
+        // Append the caller-provided workspace as a trailing dynamically-sized
+        // byte buffer; the caller-workspace pass later rewrites the function's
+        // local allocations into views of it and records the aggregate size
+        // requirement on the function.
+        auto workspaceType = mlir::MemRefType::get({ mlir::ShapedType::kDynamicSize }, b.getIntegerType(8));
+        auto workspaceArgTypes = llvm::to_vector<4>(fnType.getInputs());
+        workspaceArgTypes.push_back(workspaceType);
+        fnType = b.getFunctionType(workspaceArgTypes, fnType.getResults());
+    }
 
     auto [fnOp, entryBlock] = std::visit(
         [&](auto target) {
@@ -1141,6 +1260,18 @@ EmitterContext::DefinedFunction MLIRContext::CreateFunctionImpl(FunctionDeclarat
             {
                 fnOp->setAttr(ir::HeaderDeclAttrName, b.getUnitAttr());
             }
+            if (decl.EmitsAsyncAPI())
+            {
+                fnOp->setAttr(ir::AsyncAPIAttrName, b.getUnitAttr());
+            }
+            if (decl.EmitsBenchmarkAPI())
+            {
+                fnOp->setAttr(ir::BenchmarkAPIAttrName, b.getUnitAttr());
+            }
+            if (decl.UsesCallerWorkspace())
+            {
+                fnOp->setAttr(ir::CallerWorkspaceAttrName, b.getUnitAttr());
+            }
             if (decl.InlineState() == FunctionInlining::never)
             {
                 fnOp->setAttr(ir::NoInlineAttrName, b.getUnitAttr());
@@ -1170,6 +1301,10 @@ EmitterContext::DefinedFunction MLIRContext::CreateFunctionImpl(FunctionDeclarat
                 }
                 fnOp->setAttr(ir::GetOutputVerifiersAttrName(), b.getArrayAttr(checkFunctionAttrs));
             }
+            if (auto sampleInterval = decl.GetDebugSampleInterval(); sampleInterval > 1)
+            {
+                fnOp->setAttr(ir::GetDebugSampleIntervalAttrName(), b.getI64IntegerAttr(sampleInterval));
+            }
             if (auto argumentsSymbol = decl.GetArgumentsSymbol(); !argumentsSymbol.empty())
             {
                 std::vector<mlir::Attribute> argumentsSymbolAttrs;
@@ -1236,9 +1371,21 @@ EmitterContext::DefinedFunction MLIRContext::CreateFunctionImpl(FunctionDeclarat
         for (auto zipped : llvm::zip(argValuesCopy, entryBlock->getArguments()))
         {
             Value& value = std::get<0>(zipped);
-            EmittableInfo& emittableInfo = StoreLocalEmittable({ std::get<1>(zipped).getAsOpaquePointer(), value.GetType() });
+            mlir::Value blockArg = std::get<1>(zipped);
+            EmittableInfo& emittableInfo = StoreLocalEmittable({ blockArg.getAsOpaquePointer(), value.GetType() });
             Emittable emittable(&emittableInfo);
             value.SetData(emittable);
+
+            // Assert any layout-guaranteed alignment of external buffers at function entry, so
+            // aligned SIMD accesses against them are provably safe after lowering
+            if (value.IsConstrained() && blockArg.getType().isa<mlir::MemRefType>())
+            {
+                auto alignment = value.GetLayout().GetAlignment();
+                if (alignment > 0 && llvm::isPowerOf2_64(static_cast<uint64_t>(alignment)))
+                {
+                    b.create<mlir::memref::AssumeAlignmentOp>(loc, blockArg, static_cast<unsigned>(alignment));
+                }
+            }
         }
 
         auto returnValueCopy = returnValue;
@@ -1270,19 +1417,11 @@ EmitterContext::DefinedFunction MLIRContext::CreateFunctionImpl(FunctionDeclarat
     }
 
     DefinedFunction returnFn = [this, fnOp = fnOp, decl, mlirExpectedValues = argValuesCopy, isGpu](std::vector<Value> args) -> std::optional<Value> {
-        const auto& argValues = decl.GetParameterTypes();
         const auto& returnValue = decl.GetReturnType();
 
-        if (!std::equal(args.begin(),
-                        args.end(),
-                        argValues.begin(),
-                        argValues.end(),
-                        [](Value suppliedValue, Value fnValue) {
-                            return suppliedValue.GetBaseType() == fnValue.GetBaseType();
-                        }))
-        {
-            throw InputException(InputExceptionErrors::invalidArgument, __FILE__ " : " + std::to_string(__LINE__));
-        }
+        // Exception-free validation on the hot path; the error message is only formatted if
+        // the arguments are actually bad
+        decl.ValidateArguments(args).ValueOrThrow();
 
         auto& builder = _impl->builder;
         auto loc = builder.getUnknownLoc();
@@ -1361,19 +1500,9 @@ EmitterContext::DefinedFunction MLIRContext::DeclareExternalFunctionImpl(Functio
     // Add to _definedFunctions so we can call it the normal way
 
     DefinedFunction returnFn = [this, fnOp = fnOp, decl](std::vector<Value> args) -> std::optional<Value> {
-        const auto& argValues = decl.GetParameterTypes();
         const auto& returnValue = decl.GetReturnType();
 
-        if (!std::equal(args.begin(),
-                        args.end(),
-                        argValues.begin(),
-                        argValues.end(),
-                        [](Value suppliedValue, Value fnValue) {
-                            return suppliedValue.GetBaseType() == fnValue.GetBaseType();
-                        }))
-        {
-            throw InputException(InputExceptionErrors::invalidArgument, __FILE__ " : " + std::to_string(__LINE__));
-        }
+        decl.ValidateArguments(args).ValueOrThrow();
 
         auto& builder = _impl->builder;
         auto loc = builder.getUnknownLoc();
@@ -2093,7 +2222,22 @@ Value MLIRContext::MMALoadSyncImpl(const Matrix& source, const int64_t rowOffset
     auto colOff = builder.create<mlir::arith::ConstantIndexOp>(loc, colOffset);
     const ir::value::MMAOperandType operandType{ static_cast<ir::value::MMAOperandType>(target.GetFragmentType()) };
     const auto isAcc = operandType == ir::value::MMAOperandType::Acc;
-    auto elementType = (source.GetValue().IsFloat32() || isAcc) ? builder.getF32Type() : builder.getF16Type();
+    const auto sourceElementType = ValueTypeToMLIRType(builder, source.GetValue().GetBaseType());
+    mlir::Type elementType;
+    if (sourceElementType.isa<mlir::IntegerType>())
+    {
+        // Integer tensor ops accumulate in i32; the signed/unsigned 8-bit operand
+        // fragments keep the source element type
+        elementType = isAcc ? static_cast<mlir::Type>(builder.getI32Type()) : sourceElementType;
+    }
+    else if (sourceElementType.isF64())
+    {
+        elementType = sourceElementType;
+    }
+    else
+    {
+        elementType = (source.GetValue().IsFloat32() || isAcc) ? builder.getF32Type() : builder.getF16Type();
+    }
     auto mmaTileShape = mmaType.getOperandShape(operandType);
     auto vecTy = mlir::MemRefType::get(mmaTileShape, elementType);
 
@@ -2746,6 +2890,22 @@ static std::string GPUBarrierScopeToValueIRBarrierScope(GPU::BarrierScope scope)
     (void)ir::util::CreateGPUControlBarrier(b, GPUBarrierScopeToValueIRBarrierScope(scope), loc);
 }
 
+/*static*/ Scalar GPU::WarpReduceSum(Scalar value)
+{
+    auto& b = GetMLIRContext().GetOpBuilder();
+    auto loc = b.getUnknownLoc();
+
+    return Wrap(ir::util::CreateGPUWarpReduce(b, UnwrapScalar(value), "Sum", loc));
+}
+
+/*static*/ Scalar GPU::WarpReduceMax(Scalar value)
+{
+    auto& b = GetMLIRContext().GetOpBuilder();
+    auto loc = b.getUnknownLoc();
+
+    return Wrap(ir::util::CreateGPUWarpReduce(b, UnwrapScalar(value), "Max", loc));
+}
+
 // this is declaring externs to reference the fillResource fn's in
 // mlir/tools/mlir-vulkan-runner/vulkan-runtime-wrappers.cpp and then proceeds
 // to emit calls to these functions
@@ -2920,6 +3080,13 @@ void WriteHeaderForModule(const std::string& filename, mlir::ModuleOp moduleOp)
     std::error_code ec;
     llvm::raw_fd_ostream fstream(filename, ec);
     (void)ir::TranslateToHeader(moduleOp, fstream);
+
+    std::error_code binEc;
+    llvm::raw_fd_ostream binStream(filename + ".bin", binEc);
+    if (!binEc)
+    {
+        (void)ir::TranslateToBinaryMetadata(moduleOp, binStream);
+    }
 }
 
 void WriteHeaderForModules(const std::string& filename,
@@ -2939,6 +3106,13 @@ void WriteHeaderForModules(const std::string& filename,
         owningModuleRefs.push_back(std::move(moduleCopy));
     }
     (void)ir::TranslateToHeader(moduleOps, libraryName, fstream);
+
+    std::error_code binEc;
+    llvm::raw_fd_ostream binStream(filename + ".bin", binEc);
+    if (!binEc)
+    {
+        (void)ir::TranslateToBinaryMetadata(moduleOps, binStream);
+    }
 }
 
 } // namespace accera::value
@@ -22,6 +22,7 @@
 #include <utilities/include/Exception.h>
 #include <utilities/include/MemoryLayout.h>
 
+#include <cmath>
 #include <optional>
 
 namespace accera
@@ -434,19 +435,23 @@ namespace value
         }
     }
 
-    void SoftmaxifyRowsVectorized(Array m)
+    void SoftmaxifyRowsVectorized(Array m, FastMathAccuracy accuracy)
     {
+        auto ExpFn = [accuracy](Scalar s) {
+            return accuracy == FastMathAccuracy::High ? FastExp(s) : FastExpMlas(s);
+        };
+
         if (m.GetLayout().GetDimensionOrder() == DimensionOrder{ 0, 1 })
         {
-            SoftmaxifyRowsVectorizedRowMajor(m, FastExpMlas);
+            SoftmaxifyRowsVectorizedRowMajor(m, ExpFn);
         }
         else if (m.GetLayout().GetDimensionOrder() == DimensionOrder{ 1, 0 })
         {
-            SoftmaxifyRowsVectorizedColumnMajor(m, FastExpMlas);
+            SoftmaxifyRowsVectorizedColumnMajor(m, ExpFn);
         }
         else if (m.GetLayout().GetDimensionOrder() == DimensionOrder{ 0, 1, 2 })
         {
-            SoftmaxifyRowsVectorizedMixedLayout(m, FastExpMlas);
+            SoftmaxifyRowsVectorizedMixedLayout(m, ExpFn);
         }
         else
         {
@@ -456,7 +461,7 @@ namespace value
 
     namespace
     {
-        void LayerNormalizeRowsVectorizedRowMajor(Array m, Array alpha, Array beta, std::optional<Array> residual)
+        void LayerNormalizeRowsVectorizedRowMajor(Array m, Array alpha, Array beta, std::optional<Array> residual, bool useFastRsqrt)
         {
             // Computes LayerNormalize(m) or LayerNormalize(m + residual)
             auto elementType = m.GetType();
@@ -495,12 +500,15 @@ namespace value
                 auto mean = sum / Scalar((float)numColumns);
                 auto variance = (sumSquares - ((sum * sum) / Scalar((float)numColumns))) / Scalar((float)numColumns); // == (sumSquares - mean*mean*N) / N
                 variance = Select(variance < Scalar(epsilon), Cast(Scalar(1.0f), elementType), variance);
-                auto stdDev = Sqrt(variance);
+
+                // Reciprocal of the denominator: the fast path trades the long-latency sqrt+divide
+                // pair for an estimate refined with multiplies, which vectorizes into fma chains
+                auto invStdDev = useFastRsqrt ? FastReciprocalSqrt(variance) : Cast(Scalar(1.0f), elementType) / Sqrt(variance);
 
                 Nest nest2({ Range{ 0, numColumns, 1 } });
                 auto j = nest2.GetIndices()[0];
                 nest2.Set([&] {
-                    row(j) = alpha(j) * ((row(j) - mean) / stdDev) + beta(j);
+                    row(j) = alpha(j) * ((row(j) - mean) * invStdDev) + beta(j);
                 });
                 auto schedule2 = nest2.CreateSchedule();
                 auto plan2 = schedule2.CreatePlan();
@@ -510,7 +518,7 @@ namespace value
             auto schedule = nest.CreateSchedule();
         }
 
-        void LayerNormalizeRowsVectorizedColumnMajor(Array m, Array alpha, Array beta, std::optional<Array> residual)
+        void LayerNormalizeRowsVectorizedColumnMajor(Array m, Array alpha, Array beta, std::optional<Array> residual, bool useFastRsqrt)
         {
             // Computes LayerNormalize(m) or LayerNormalize(m + residual)
             const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
@@ -524,7 +532,7 @@ namespace value
             auto sum = MakeArray({ numRows }, elementType, "sum");
             auto sumSquares = MakeArray({ numRows }, elementType, "sumSquares");
             auto mean = MakeArray({ numRows }, elementType, "mean");
-            auto stdDev = MakeArray({ numRows }, elementType, "stdDev");
+            auto invStdDev = MakeArray({ numRows }, elementType, "invStdDev");
 
             ClearArray(sum);
             ClearArray(sumSquares);
@@ -559,7 +567,9 @@ namespace value
                 auto varianceVal = (sumSquaresVal - ((sumVal * sumVal) / Scalar((float)numColumns))) / Scalar((float)numColumns); // == (sumSquares - mean*mean*N) / N
                 varianceVal = Select(varianceVal < Scalar(epsilon), Cast(Scalar(1.0f), elementType), varianceVal);
                 mean(i2) = meanVal;
-                stdDev(i2) = Sqrt(varianceVal);
+                // Reciprocal of the denominator: the fast path trades the long-latency sqrt+divide
+                // pair for an estimate refined with multiplies, which vectorizes into fma chains
+                invStdDev(i2) = useFastRsqrt ? FastReciprocalSqrt(varianceVal) : Cast(Scalar(1.0f), elementType) / Sqrt(varianceVal);
             });
 
             // loop 3: normalize
@@ -567,7 +577,7 @@ namespace value
             auto i3 = nest3.GetIndices()[0];
             auto j3 = nest3.GetIndices()[1];
             nest3.Set([&]() {
-                m(i3, j3) = alpha(j3) * ((m(i3, j3) - mean(i3)) / stdDev(i3)) + beta(j3);
+                m(i3, j3) = alpha(j3) * ((m(i3, j3) - mean(i3)) * invStdDev(i3)) + beta(j3);
             });
 
             auto schedule1 = nest1.CreateSchedule();
@@ -585,15 +595,15 @@ namespace value
             plan3.Vectorize(i3, { vectorSize, vectorUnits, true });
         }
 
-        void LayerNormalizeVectorized(Array m, Array alpha, Array beta, std::optional<Array> residual)
+        void LayerNormalizeVectorized(Array m, Array alpha, Array beta, std::optional<Array> residual, bool useFastRsqrt)
         {
             if (m.GetLayout().GetDimensionOrder() == DimensionOrder{ 0, 1 })
             {
-                LayerNormalizeRowsVectorizedRowMajor(m, alpha, beta, residual);
+                LayerNormalizeRowsVectorizedRowMajor(m, alpha, beta, residual, useFastRsqrt);
             }
             else if (m.GetLayout().GetDimensionOrder() == DimensionOrder{ 1, 0 })
             {
-                LayerNormalizeRowsVectorizedColumnMajor(m, alpha, beta, residual);
+                LayerNormalizeRowsVectorizedColumnMajor(m, alpha, beta, residual, useFastRsqrt);
             }
             else
             {
@@ -660,14 +670,14 @@ namespace value
         LayerNormalize(m, alpha, beta, residual);
     }
 
-    void LayerNormalizeVectorized(Array m, Array alpha, Array beta)
+    void LayerNormalizeVectorized(Array m, Array alpha, Array beta, bool useFastRsqrt)
     {
-        LayerNormalizeVectorized(m, alpha, beta, std::nullopt);
+        LayerNormalizeVectorized(m, alpha, beta, std::nullopt, useFastRsqrt);
     }
 
-    void LayerNormalizeVectorizedFused(Array m, Array alpha, Array beta, Array residual)
+    void LayerNormalizeVectorizedFused(Array m, Array alpha, Array beta, Array residual, bool useFastRsqrt)
     {
-        LayerNormalizeVectorized(m, alpha, beta, residual);
+        LayerNormalizeVectorized(m, alpha, beta, residual, useFastRsqrt);
     }
 
     void ReLU(Array m)
@@ -795,5 +805,396 @@ namespace value
         schedule.AddKernel(cKernel, First(iInner) && First(jInner) && First(kInner) && First(lInner) && First(s), IsDefined(iOuter) && IsDefined(jOuter) && IsDefined(kOuter) && IsDefined(lOuter) && IsDefined(s));
         schedule.AddKernel(eKernel, First(iInner) && First(lInner) && First(jInner) && Last(kInner) && Last(s), IsDefined(iOuter) && IsDefined(jOuter) && IsDefined(kOuter) && IsDefined(lOuter) && IsDefined(s));
     }
+
+    void LSTMCell(Array x, Array h, Array c, Array Wx, Array Wh, Array bias, Array gates, Array hNext, Array cNext)
+    {
+        ProfileRegion profileRegion("lstmcell_0_all");
+
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int batch = (int)x.Shape()[0];
+        const int hidden = (int)h.Shape()[1];
+        ThrowIfNot(batch == (int)h.Shape()[0]);
+        ThrowIfNot(4 * hidden == (int)Wx.Shape()[1]);
+        ThrowIfNot(4 * hidden == (int)Wh.Shape()[1]);
+        ThrowIfNot(4 * hidden == (int)bias.Shape()[0]);
+        ThrowIfNot(batch == (int)gates.Shape()[0]);
+        ThrowIfNot(4 * hidden == (int)gates.Shape()[1]);
+
+        {
+            ProfileRegion profileRegion_("lstmcell_1_matmul");
+            // Both GEMMs accumulate into the same { batch, 4 * hidden } workspace, so x and h
+            // are each packed once and shared across all four gates' columns
+            MatMulMlas(x, Wx, gates);
+            MatMulMlas(h, Wh, gates, false /* clearC */);
+        }
+
+        {
+            ProfileRegion profileRegion_("lstmcell_2_elementwise");
+            Nest nest(MemoryShape{ batch, hidden });
+            ScalarIndex b, j;
+            std::tie(b, j) = nest.GetIndices<2>();
+
+            nest.Set([&]() {
+                auto inputGate = FastSigmoid(gates(b, j) + bias(j));
+                auto forgetGate = FastSigmoid(gates(b, hidden + j) + bias(hidden + j));
+                auto candidate = FastTanh(gates(b, 2 * hidden + j) + bias(2 * hidden + j));
+                auto outputGate = FastSigmoid(gates(b, 3 * hidden + j) + bias(3 * hidden + j));
+
+                // The new cell state feeds the hidden state update directly, so neither state
+                // takes a round-trip through memory between the two writes
+                auto cVal = forgetGate * c(b, j) + inputGate * candidate;
+                cNext(b, j) = cVal;
+                hNext(b, j) = outputGate * FastTanh(cVal);
+            });
+
+            auto schedule = nest.CreateSchedule();
+            auto plan = schedule.CreatePlan();
+            if (hidden >= vectorSize)
+            {
+                plan.Vectorize(j, { vectorSize, vectorUnits, true });
+            }
+        }
+    }
+
+    void GRUCell(Array x, Array h, Array Wx, Array Wh, Array bias, Array gatesX, Array gatesH, Array hNext)
+    {
+        ProfileRegion profileRegion("grucell_0_all");
+
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int batch = (int)x.Shape()[0];
+        const int hidden = (int)h.Shape()[1];
+        ThrowIfNot(batch == (int)h.Shape()[0]);
+        ThrowIfNot(3 * hidden == (int)Wx.Shape()[1]);
+        ThrowIfNot(3 * hidden == (int)Wh.Shape()[1]);
+        ThrowIfNot(3 * hidden == (int)bias.Shape()[0]);
+        ThrowIfNot(batch == (int)gatesX.Shape()[0]);
+        ThrowIfNot(3 * hidden == (int)gatesX.Shape()[1]);
+        ThrowIfNot(batch == (int)gatesH.Shape()[0]);
+        ThrowIfNot(3 * hidden == (int)gatesH.Shape()[1]);
+
+        auto elementType = x.GetType();
+
+        {
+            ProfileRegion profileRegion_("grucell_1_matmul");
+            // The recurrent contribution stays in its own workspace because the reset gate
+            // scales only the candidate's recurrent term, not the input term
+            MatMulMlas(x, Wx, gatesX);
+            MatMulMlas(h, Wh, gatesH);
+        }
+
+        {
+            ProfileRegion profileRegion_("grucell_2_elementwise");
+            Nest nest(MemoryShape{ batch, hidden });
+            ScalarIndex b, j;
+            std::tie(b, j) = nest.GetIndices<2>();
+
+            nest.Set([&]() {
+                auto resetGate = FastSigmoid(gatesX(b, j) + gatesH(b, j) + bias(j));
+                auto updateGate = FastSigmoid(gatesX(b, hidden + j) + gatesH(b, hidden + j) + bias(hidden + j));
+                auto candidate = FastTanh(gatesX(b, 2 * hidden + j) + bias(2 * hidden + j) + resetGate * gatesH(b, 2 * hidden + j));
+
+                auto one = Cast(Scalar(1.0f), elementType);
+                hNext(b, j) = updateGate * h(b, j) + (one - updateGate) * candidate;
+            });
+
+            auto schedule = nest.CreateSchedule();
+            auto plan = schedule.CreatePlan();
+            if (hidden >= vectorSize)
+            {
+                plan.Vectorize(j, { vectorSize, vectorUnits, true });
+            }
+        }
+    }
+
+    namespace
+    {
+        template <typename ExpFnType>
+        void FusedScaledDotProductAttentionRowMajor(Array Q, Array K, Array V, Array output, ExpFnType ExpFn)
+        {
+            LocationGuard region(GET_LOCATION());
+            ProfileRegion profileRegion("attention_0_all");
+
+            const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+            const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+            auto elementType = Q.GetType();
+
+            int numRows = static_cast<int>(Q.Shape()[0]); // query sequence length
+            int depth = static_cast<int>(Q.Shape()[1]); // head dimension
+            int numColumns = static_cast<int>(K.Shape()[0]); // key/value sequence length
+
+            // Stream K/V through column blocks: the only score buffer ever materialized is one
+            // row of one block, so the full S = Q*K^T matrix never exists
+            const int defaultBlockColumns = 256;
+            int blockColumns = std::min(numColumns, defaultBlockColumns);
+            while (numColumns % blockColumns != 0)
+            {
+                --blockColumns; // keep whole blocks; pathological lengths degrade gracefully
+            }
+
+            const float scale = 1.0f / std::sqrt(static_cast<float>(depth));
+            auto epsilon = Cast(Scalar(1e-7f), elementType);
+
+            auto qScaled = MakeArray({ depth }, elementType, "qScaled");
+            auto scoreBlock = MakeArray({ blockColumns }, elementType, "scoreBlock");
+            auto acc = MakeArray({ depth }, elementType, "acc");
+
+            Nest nest(MemoryShape{ numRows });
+            auto i = nest.GetIndices()[0];
+
+            nest.Set([&]() {
+                auto q = Q.Slice({ 0 }, { i });
+                auto out = output.Slice({ 0 }, { i });
+
+                // Running row state; lives in registers across the K/V sweep
+                Scalar runningMax = Allocate(elementType, ScalarLayout);
+                Scalar runningSum = Allocate(elementType, ScalarLayout);
+                runningMax = Cast(Scalar(std::numeric_limits<float>::lowest()), elementType);
+                runningSum = Cast(Scalar(0.0f), elementType);
+                ClearArray(acc);
+
+                // Fold the 1/sqrt(d) scale into the query row once instead of into every score
+                {
+                    Nest nest0(MemoryShape{ depth });
+                    auto k0 = nest0.GetIndices()[0];
+                    nest0.Set([&]() {
+                        qScaled(k0) = q(k0) * Cast(Scalar(scale), elementType);
+                    });
+                    auto schedule0 = nest0.CreateSchedule();
+                    auto plan0 = schedule0.CreatePlan();
+                    plan0.Vectorize(k0, { vectorSize, vectorUnits, true });
+                }
+
+                For(0, numColumns, blockColumns, [&](Scalar jBlock) {
+                    // loop 1: scores for this block: s_j = <qScaled, K_(jBlock+j)>
+                    {
+                        LocationGuard region_(GET_LOCATION());
+                        ProfileRegion profileRegion_("attention_1_scores");
+                        ClearArray(scoreBlock);
+                        Nest nest1(MemoryShape{ blockColumns, depth });
+                        auto j1 = nest1.GetIndices()[0];
+                        auto k1 = nest1.GetIndices()[1];
+                        nest1.Set([&]() {
+                            scoreBlock(j1) += qScaled(k1) * K(jBlock + j1, k1);
+                        });
+                        auto schedule1 = nest1.CreateSchedule();
+                    }
+
+                    // Update the running max and rescale the state accumulated so far
+                    auto blockMax = VectorMax(scoreBlock);
+                    auto newMax = Max(runningMax, blockMax);
+                    auto correction = ExpFn(runningMax - newMax);
+                    runningSum *= correction;
+                    {
+                        LocationGuard region_(GET_LOCATION());
+                        ProfileRegion profileRegion_("attention_2_rescale");
+                        Nest nest2(MemoryShape{ depth });
+                        auto k2 = nest2.GetIndices()[0];
+                        nest2.Set([&]() {
+                            acc(k2) *= correction;
+                        });
+                        auto schedule2 = nest2.CreateSchedule();
+                        auto plan2 = schedule2.CreatePlan();
+                        plan2.Vectorize(k2, { vectorSize, vectorUnits, true });
+                    }
+
+                    // loop 2: probabilities p_j = exp(s_j - newMax) and their running sum
+                    {
+                        LocationGuard region_(GET_LOCATION());
+                        ProfileRegion profileRegion_("attention_3_expsum");
+                        runningSum += MapReduce(
+                            scoreBlock,
+                            Scalar(0.0f),
+                            [&](Scalar a) { return ExpFn(a - newMax); },
+                            [&](Scalar a, Scalar p) { return a + p; });
+                    }
+
+                    // loop 3: accumulate the weighted value rows: acc += p_j * V_(jBlock+j)
+                    {
+                        LocationGuard region_(GET_LOCATION());
+                        ProfileRegion profileRegion_("attention_4_accum");
+                        Nest nest3(MemoryShape{ blockColumns, depth });
+                        auto j3 = nest3.GetIndices()[0];
+                        auto k3 = nest3.GetIndices()[1];
+                        nest3.Set([&]() {
+                            acc(k3) += scoreBlock(j3) * V(jBlock + j3, k3);
+                        });
+                        auto schedule3 = nest3.CreateSchedule();
+                        auto plan3 = schedule3.CreatePlan();
+                        plan3.Vectorize(k3, { vectorSize, vectorUnits, true });
+                    }
+
+                    runningMax = newMax;
+                });
+
+                // loop 4: normalize into the output row
+                {
+                    LocationGuard region_(GET_LOCATION());
+                    ProfileRegion profileRegion_("attention_5_scale");
+                    auto sumVal = Select(runningSum < epsilon, Cast(Scalar(1.0f), elementType), runningSum);
+                    auto reciprocal = Cast(Scalar(1.0), sumVal.GetType()) / sumVal;
+                    Nest nest4(MemoryShape{ depth });
+                    auto k4 = nest4.GetIndices()[0];
+                    nest4.Set([&]() {
+                        out(k4) = acc(k4) * reciprocal;
+                    });
+                    auto schedule4 = nest4.CreateSchedule();
+                    auto plan4 = schedule4.CreatePlan();
+                    plan4.Vectorize(k4, { vectorSize, vectorUnits, true });
+                }
+            });
+
+            nest.CreateSchedule();
+        }
+    } // namespace
+
+    void EmbeddingLookup(Array table, Array indices, Array output, int prefetchDistance, int numThreads)
+    {
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int numIndices = static_cast<int>(indices.Shape()[0]);
+        const int embeddingDim = static_cast<int>(table.Shape()[1]);
+        ThrowIfNot(numIndices == static_cast<int>(output.Shape()[0]));
+        ThrowIfNot(embeddingDim == static_cast<int>(output.Shape()[1]));
+
+        Nest nest(MemoryShape{ numIndices });
+        auto i = nest.GetIndices()[0];
+
+        nest.Set([&]() {
+            auto row = indices(i);
+            if (prefetchDistance > 0)
+            {
+                // The gathered row addresses are data-dependent, so the hardware prefetcher can't
+                // follow them; issue a software prefetch for the row we'll need prefetchDistance
+                // lookups from now while this row's copy is in flight
+                auto next = i + prefetchDistance;
+                auto lookahead = Select(next < Cast(Scalar(numIndices), next.GetType()), next, i);
+                Prefetch(table.Slice({ 0 }, { indices(lookahead) }));
+            }
+
+            Nest copyNest(MemoryShape{ embeddingDim });
+            auto j = copyNest.GetIndices()[0];
+            copyNest.Set([&]() {
+                output(i, j) = table(row, j);
+            });
+            auto copySchedule = copyNest.CreateSchedule();
+            auto copyPlan = copySchedule.CreatePlan();
+            if (embeddingDim >= vectorSize)
+            {
+                copyPlan.Vectorize(j, { vectorSize, vectorUnits, true });
+            }
+        });
+
+        auto schedule = nest.CreateSchedule();
+        if (numThreads > 1)
+        {
+            auto plan = schedule.CreatePlan();
+            plan.Parallelize({ i }, numThreads, ParallelizationPolicy::Static);
+        }
+    }
+
+    void EmbeddingBagSum(Array table, Array indices, Array bagOffsets, Array output, int prefetchDistance, int numThreads)
+    {
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int numBags = static_cast<int>(output.Shape()[0]);
+        const int embeddingDim = static_cast<int>(table.Shape()[1]);
+        ThrowIfNot(numBags + 1 == static_cast<int>(bagOffsets.Shape()[0]));
+        ThrowIfNot(embeddingDim == static_cast<int>(output.Shape()[1]));
+
+        ClearMatrix(output);
+
+        Nest nest(MemoryShape{ numBags });
+        auto b = nest.GetIndices()[0];
+
+        nest.Set([&]() {
+            auto bagStart = bagOffsets(b);
+            auto bagEnd = bagOffsets(b + 1);
+            auto unitStep = Cast(Scalar(1), bagStart.GetType());
+            For(bagStart, bagEnd, unitStep, [&](Scalar nz) {
+                auto row = indices(nz);
+                if (prefetchDistance > 0)
+                {
+                    // Prefetch the row prefetchDistance lookups ahead, clamped to this bag so we
+                    // never chase an index past the end of the offsets range
+                    auto next = nz + Cast(Scalar(prefetchDistance), nz.GetType());
+                    auto lookahead = Select(next < bagEnd, next, nz);
+                    Prefetch(table.Slice({ 0 }, { indices(lookahead) }));
+                }
+
+                Nest accumulateNest(MemoryShape{ embeddingDim });
+                auto j = accumulateNest.GetIndices()[0];
+                accumulateNest.Set([&]() {
+                    output(b, j) += table(row, j);
+                });
+                auto accumulateSchedule = accumulateNest.CreateSchedule();
+                auto accumulatePlan = accumulateSchedule.CreatePlan();
+                if (embeddingDim >= vectorSize)
+                {
+                    accumulatePlan.Vectorize(j, { vectorSize, vectorUnits, true });
+                }
+            });
+        });
+
+        auto schedule = nest.CreateSchedule();
+        if (numThreads > 1)
+        {
+            auto plan = schedule.CreatePlan();
+            plan.Parallelize({ b }, numThreads, ParallelizationPolicy::Static);
+        }
+    }
+
+    void ScaledDotProductAttention(Array Q, Array K, Array V, Array scores, Array output)
+    {
+        ProfileRegion profileRegion("attention_0_all");
+
+        int depth = static_cast<int>(Q.Shape()[1]);
+        const float scale = 1.0f / std::sqrt(static_cast<float>(depth));
+
+        {
+            ProfileRegion profileRegion_("attention_1_matmul");
+            MatMulMlas(Q, K.Reorder({ 1, 0 }), scores);
+        }
+        {
+            ProfileRegion profileRegion_("attention_2_scale");
+            int numRows = static_cast<int>(scores.Shape()[0]);
+            int numColumns = static_cast<int>(scores.Shape()[1]);
+            Nest nest(MemoryShape{ numRows, numColumns });
+            auto i = nest.GetIndices()[0];
+            auto j = nest.GetIndices()[1];
+            nest.Set([&]() {
+                scores(i, j) *= Cast(Scalar(scale), scores.GetType());
+            });
+            nest.CreateSchedule();
+        }
+        {
+            ProfileRegion profileRegion_("attention_3_softmax");
+            SoftmaxifyRowsVectorized(scores);
+        }
+        {
+            ProfileRegion profileRegion_("attention_4_matmul");
+            MatMulMlas(scores, V, output);
+        }
+    }
+
+    void FusedScaledDotProductAttention(Array Q, Array K, Array V, Array output)
+    {
+        if (Q.GetLayout().GetDimensionOrder() == DimensionOrder{ 0, 1 } &&
+            K.GetLayout().GetDimensionOrder() == DimensionOrder{ 0, 1 } &&
+            V.GetLayout().GetDimensionOrder() == DimensionOrder{ 0, 1 })
+        {
+            FusedScaledDotProductAttentionRowMajor(Q, K, V, output, FastExpMlas);
+        }
+        else
+        {
+            throw LogicException(LogicExceptionErrors::illegalState, "Bad layout");
+        }
+    }
 } // namespace value
 } // namespace accera
@@ -13,6 +13,7 @@
 #include "Plan.h"
 #include "Scalar.h"
 #include "Schedule.h"
+#include "Tensor.h"
 
 #include <utilities/include/StringUtil.h>
 
@@ -136,6 +137,153 @@ namespace value
         plan.Vectorize(jInner3, { vectorSize, vectorUnits });
     }
 
+    Tensor BatchMatrixMatrixMultiply(Tensor b1, Tensor b2)
+    {
+        const int BatchSize = (int)(b1.Rows());
+        const int OutputRows = (int)(b1.Columns()); // M
+        const int OutputColumns = (int)(b2.Channels()); // N
+        Tensor output = MakeTensor(BatchSize, OutputRows, OutputColumns, b1.GetType());
+        BatchMatrixMatrixMultiply(b1, b2, output);
+        return output;
+    }
+
+    void BatchMatrixMatrixMultiply(Tensor b1, Tensor b2, Tensor output)
+    {
+        // Declare and/or calculate constants
+        const int BatchSize = (int)(b1.Rows());
+        const int OutputRows = (int)(b1.Columns()); // M
+        const int OutputColumns = (int)(b2.Channels()); // N
+        const int InnerDimension = (int)(b1.Channels()); // K
+
+        if ((int)(b2.Rows()) != BatchSize || (int)(output.Rows()) != BatchSize)
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "Batch dimensions must match");
+        }
+        if ((int)(b2.Columns()) != InnerDimension || (int)(output.Columns()) != OutputRows || (int)(output.Channels()) != OutputColumns)
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "Matrix dimensions must be compatible");
+        }
+
+        // Schedule constants
+        // TODO : read these values from the target system
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+        const int kUnroll = 4;
+        const int batchThreads = std::min(BatchSize, 16);
+
+        const int NumRowsInKernel = std::min(6, OutputRows);
+
+        // A single fused nest over the batch keeps one entry's working set warm while the next is
+        // computed, instead of paying per-call overhead and cold caches for each small multiply
+        Nest nest({ BatchSize, OutputRows, OutputColumns, InnerDimension });
+
+        // Get indexes
+        auto indices = nest.GetIndices();
+        Scalar b = indices[0];
+        Scalar i = indices[1];
+        Scalar j = indices[2];
+        Scalar k = indices[3];
+        nest.Set([&]() { output(b, i, j) += b1(b, i, k) * b2(b, k, j); });
+
+        auto schedule = nest.CreateSchedule();
+
+        // Declare splits
+        auto [kBlock, kInner] = schedule.Split(k, kUnroll);
+        auto [jKernelOuter, jInner] = schedule.Split(j, vectorSize);
+        auto [iKernelOuter, iInner] = schedule.Split(i, NumRowsInKernel);
+
+        // Set the order; the batch dimension stays outermost so entries can run on separate threads
+        schedule.SetOrder({ b, iKernelOuter, jKernelOuter, kBlock, kInner, iInner, jInner });
+
+        auto plan = schedule.CreatePlan();
+        plan.Parallelize({ b }, batchThreads, ParallelizationPolicy::Static);
+
+        // Set unrolling
+        schedule.Unroll(iInner);
+        plan.Vectorize(jInner, { vectorSize, vectorUnits });
+    }
+
+    void BatchMatrixMatrixMultiply(Tensor b1, Matrix m2, Tensor output)
+    {
+        // Declare and/or calculate constants
+        const int BatchSize = (int)(b1.Rows());
+        const int OutputRows = (int)(b1.Columns()); // M
+        const int OutputColumns = (int)(m2.Columns()); // N
+        const int InnerDimension = (int)(b1.Channels()); // K
+
+        if ((int)(output.Rows()) != BatchSize)
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "Batch dimensions must match");
+        }
+        if ((int)(m2.Rows()) != InnerDimension || (int)(output.Columns()) != OutputRows || (int)(output.Channels()) != OutputColumns)
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "Matrix dimensions must be compatible");
+        }
+
+        // Schedule constants
+        // TODO : read these values from the target system
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+        const int kUnroll = 4;
+        const int batchThreads = std::min(BatchSize, 16);
+
+        const int NumRowsInKernel = std::min(6, OutputRows);
+
+        Nest nest({ BatchSize, OutputRows, OutputColumns, InnerDimension });
+
+        // Get indexes
+        auto indices = nest.GetIndices();
+        Scalar b = indices[0];
+        Scalar i = indices[1];
+        Scalar j = indices[2];
+        Scalar k = indices[3];
+        nest.Set([&]() { output(b, i, j) += b1(b, i, k) * m2(k, j); });
+
+        auto schedule = nest.CreateSchedule();
+
+        // Declare splits
+        auto [kBlock, kInner] = schedule.Split(k, kUnroll);
+        auto [jKernelOuter, jInner] = schedule.Split(j, vectorSize);
+        auto [iKernelOuter, iInner] = schedule.Split(i, NumRowsInKernel);
+
+        schedule.SetOrder({ b, iKernelOuter, jKernelOuter, kBlock, kInner, iInner, jInner });
+
+        auto plan = schedule.CreatePlan();
+
+        // The shared operand's footprint doesn't depend on the batch index, so caching by max
+        // elements hoists the packing outside the batch loop and every entry reuses one packed copy
+        plan.AddCache(m2, static_cast<int64_t>(m2.Rows() * m2.Columns()));
+        plan.Parallelize({ b }, batchThreads, ParallelizationPolicy::Static);
+
+        // Set unrolling
+        schedule.Unroll(iInner);
+        plan.Vectorize(jInner, { vectorSize, vectorUnits });
+    }
+
+    void BatchMatrixMatrixMultiply(const std::vector<Matrix>& m1s, const std::vector<Matrix>& m2s, const std::vector<Matrix>& outputs)
+    {
+        if (m1s.size() != m2s.size() || m1s.size() != outputs.size())
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "Batch entry counts must match");
+        }
+        if (m1s.empty())
+        {
+            return;
+        }
+
+        // Separately-allocated matrices can't be indexed by a nest dimension, so each entry gets
+        // its own nest; shapes must be uniform so the entries share one schedule structure
+        for (size_t entry = 0; entry < m1s.size(); ++entry)
+        {
+            if (m1s[entry].Rows() != m1s[0].Rows() || m1s[entry].Columns() != m1s[0].Columns() ||
+                m2s[entry].Rows() != m2s[0].Rows() || m2s[entry].Columns() != m2s[0].Columns())
+            {
+                throw InputException(InputExceptionErrors::invalidArgument, "Batch entries must have uniform shapes");
+            }
+            MatrixMatrixMultiply(m1s[entry], m2s[entry], outputs[entry]);
+        }
+    }
+
     Vector MatrixVectorMultiply(Matrix m, Vector v)
     {
         Vector result = Allocate(v.GetType(), m.Rows());
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MultiVersioning.h"
+#include "EmitterContext.h"
+#include "Scalar.h"
+
+#include <utilities/include/Exception.h>
+
+#include <algorithm>
+
+namespace accera
+{
+namespace value
+{
+    namespace
+    {
+        // Provided by the runtime support library; returns the executing machine's CPUFeatureLevel
+        // (detected once via cpuid and cached)
+        const std::string CPUFeatureLevelFunctionName = "_accera_cpu_feature_level";
+
+        FunctionDeclaration DeclareCPUFeatureLevelFunction()
+        {
+            return DeclareFunction(CPUFeatureLevelFunctionName)
+                .Decorated(false)
+                .External(true)
+                .Returns(Value(ValueType::Int32, utilities::ScalarLayout));
+        }
+    } // namespace
+
+    CPUFeatureLevel GetCPUFeatureLevel(const TargetDevice& device)
+    {
+        if (device.HasFeature("avx512"))
+        {
+            return CPUFeatureLevel::AVX512;
+        }
+        if (device.HasFeature("avx2"))
+        {
+            return CPUFeatureLevel::AVX2;
+        }
+        if (device.HasFeature("avx"))
+        {
+            return CPUFeatureLevel::AVX;
+        }
+        return CPUFeatureLevel::Generic;
+    }
+
+    void DefineMultiVersionedFunction(FunctionDeclaration fnDecl, std::vector<FunctionVersion> versions)
+    {
+        if (versions.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Multiversioned functions require at least one version");
+        }
+        if (fnDecl.GetReturnType().has_value())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Multiversioned functions must be void-returning; use an output parameter instead");
+        }
+
+        // Most capable version first; the least capable one becomes the fallback
+        std::stable_sort(versions.begin(), versions.end(), [](const FunctionVersion& a, const FunctionVersion& b) {
+            return GetCPUFeatureLevel(a.device) > GetCPUFeatureLevel(b.device);
+        });
+
+        struct Variant
+        {
+            CPUFeatureLevel level;
+            FunctionDeclaration decl;
+        };
+        std::vector<Variant> variants;
+        variants.reserve(versions.size());
+        for (auto& version : versions)
+        {
+            std::vector<ViewAdapter> params(fnDecl.GetParameterTypes().begin(), fnDecl.GetParameterTypes().end());
+            auto variantDecl = DeclareFunction(fnDecl.GetFunctionName() + "_" + version.device.deviceName)
+                                   .Parameters(params, fnDecl.GetParameterUsages())
+                                   .AddTag("target_device_" + version.device.deviceName);
+            variantDecl.Define(version.body);
+            variants.push_back({ GetCPUFeatureLevel(version.device), std::move(variantDecl) });
+        }
+
+        fnDecl.Define([variants = std::move(variants)](std::vector<Value> args) {
+            std::vector<ViewAdapter> callArgs(args.begin(), args.end());
+            if (variants.size() == 1)
+            {
+                (void)variants.front().decl.Call(callArgs);
+                return;
+            }
+
+            Scalar featureLevel = *DeclareCPUFeatureLevelFunction().Call();
+            auto ifContext = If(featureLevel >= Scalar(static_cast<int32_t>(variants.front().level)), [&] {
+                (void)variants.front().decl.Call(callArgs);
+            });
+            for (size_t i = 1; i < variants.size() - 1; ++i)
+            {
+                ifContext.ElseIf(featureLevel >= Scalar(static_cast<int32_t>(variants[i].level)), [&] {
+                    (void)variants[i].decl.Call(callArgs);
+                });
+            }
+            ifContext.Else([&] {
+                (void)variants.back().decl.Call(callArgs);
+            });
+        });
+    }
+
+} // namespace value
+} // namespace accera
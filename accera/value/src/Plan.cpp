@@ -112,7 +112,12 @@ namespace value
                              MemorySpace memorySpace,
                              MemorySpace doubleBufferMemorySpace,
                              const MemoryAffineCoefficients& memoryMap,
-                             CacheStrategy strategy = CacheStrategy::Striped)
+                             CacheStrategy strategy = CacheStrategy::Striped,
+                             int64_t pipelineDepth = 2,
+                             int64_t prefetchDistance = 0,
+                             bool prefetchL2Only = false,
+                             bool nontemporalWriteback = false,
+                             bool quantizeCache = false)
         {
             return { _scheduleOp,
                      target,
@@ -129,7 +134,12 @@ namespace value
                      allocation,
                      memorySpace,
                      doubleBufferMemorySpace,
-                     _execTarget };
+                     _execTarget,
+                     pipelineDepth,
+                     prefetchDistance,
+                     prefetchL2Only,
+                     nontemporalWriteback,
+                     quantizeCache };
         }
 
         Cache AddManualCache(std::variant<ViewAdapter, Cache*> target,
@@ -145,7 +155,12 @@ namespace value
                              MemorySpace memorySpace,
                              MemorySpace doubleBufferMemorySpace,
                              const DimensionOrder& dimOrder,
-                             CacheStrategy strategy = CacheStrategy::Striped)
+                             CacheStrategy strategy = CacheStrategy::Striped,
+                             int64_t pipelineDepth = 2,
+                             int64_t prefetchDistance = 0,
+                             bool prefetchL2Only = false,
+                             bool nontemporalWriteback = false,
+                             bool quantizeCache = false)
         {
             return { _scheduleOp,
                      target,
@@ -162,17 +177,22 @@ namespace value
                      allocation,
                      memorySpace,
                      doubleBufferMemorySpace,
-                     _execTarget };
+                     _execTarget,
+                     pipelineDepth,
+                     prefetchDistance,
+                     prefetchL2Only,
+                     nontemporalWriteback,
+                     quantizeCache };
         }
 
-        Cache AddRuntimeInitCache(ViewAdapter target, const std::string& packingFnName, const std::string& packedBufferSizeFnName, CacheIndexing indexing)
+        Cache AddRuntimeInitCache(ViewAdapter target, const std::string& packingFnName, const std::string& packedBufferSizeFnName, CacheIndexing indexing, int64_t numThreads, const std::optional<VectorizationInformation>& vectorizationInfo)
         {
-            return { _scheduleOp, target, packingFnName, packedBufferSizeFnName, indexing };
+            return { _scheduleOp, target, packingFnName, packedBufferSizeFnName, indexing, numThreads, vectorizationInfo };
         }
 
-        Cache PackAndEmbedBuffer(ViewAdapter target, ViewAdapter constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing indexing)
+        Cache PackAndEmbedBuffer(ViewAdapter target, ViewAdapter constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing indexing, bool compress)
         {
-            return { _scheduleOp, target, constantData, wrapperFnName, packedBufferName, indexing };
+            return { _scheduleOp, target, constantData, wrapperFnName, packedBufferName, indexing, compress };
         }
 
         void Vectorize(ScalarIndex i, const VectorizationInformation& dslVectorizationInfo)
@@ -191,11 +211,13 @@ namespace value
             _execPlanOp->setAttr(vectorizationInfoIdentifier, vectorizationInfoAttr);
         }
 
-        void Parallelize(std::vector<ScalarIndex> indices, int64_t numThreads, ParallelizationPolicy policy)
+        void Parallelize(std::vector<ScalarIndex> indices, int64_t numThreads, ParallelizationPolicy policy, ParallelAffinity affinity, int64_t chunkSize)
         {
             auto& builder = GetBuilder();
 
-            ParallelizationInfo parallelizationInfo{ numThreads, policy == ParallelizationPolicy::Dynamic };
+            // Each Parallelize call on a plan gets its own nesting level, so successive calls compose
+            // into nested parallel regions (e.g. sockets x cores) instead of being collapsed together
+            ParallelizationInfo parallelizationInfo{ numThreads, static_cast<int64_t>(policy), _nextParallelNestingLevel++, ParallelizationInfo::NoReduction, static_cast<int64_t>(affinity), chunkSize };
             auto parallelizationInfoIdentifier = builder.getStringAttr(ParallelizationInfoAttr::getKeyName());
             auto parallelizationInfoAttr = ParallelizationInfoAttr::get(parallelizationInfo, builder.getContext());
 
@@ -209,11 +231,41 @@ namespace value
             }
         }
 
-        void Tensorize(std::vector<ScalarIndex> indices, MMAShape dims, int numTotalPasses, bool useStaticOffsets, int numFusedPasses, MMASchedulingPolicy schedulingPolicy, bool _useRocWMMA)
+        void Parallelize(ScalarIndex index, int64_t numThreads, ParallelizationPolicy policy, ParallelReduction reduction, ParallelAffinity affinity, int64_t chunkSize)
         {
             auto& builder = GetBuilder();
 
-            TensorizationInfo tensorizationInfo{ static_cast<accera::ir::value::MMAShape>(dims), numTotalPasses, useStaticOffsets, numFusedPasses, static_cast<accera::ir::value::MMASchedulingPolicy>(schedulingPolicy), _useRocWMMA };
+            ParallelizationInfo parallelizationInfo{ numThreads, static_cast<int64_t>(policy), _nextParallelNestingLevel++, static_cast<int64_t>(reduction), static_cast<int64_t>(affinity), chunkSize };
+            auto parallelizationInfoIdentifier = builder.getStringAttr(ParallelizationInfoAttr::getKeyName());
+            auto parallelizationInfoAttr = ParallelizationInfoAttr::get(parallelizationInfo, builder.getContext());
+
+            // Reductions are marked on a single index; lowering privatizes the accumulators
+            // per-thread and combines them after the parallel region, so collapsing additional
+            // indices into the same region doesn't apply here
+            auto symbolicIndexOp = GetIndexOp(index);
+            auto loopnestIndex = symbolicIndexOp.getValue();
+            _scheduleOp.addLoopAttribute(loopnestIndex, parallelizationInfoIdentifier, parallelizationInfoAttr);
+        }
+
+        void SetFastMathPolicy(const FastMathPolicy& policy)
+        {
+            auto& builder = GetBuilder();
+
+            int64_t flags = (policy.contract ? FastMathContractFlag : 0) |
+                            (policy.reassoc ? FastMathReassocFlag : 0) |
+                            (policy.noNaNs ? FastMathNoNaNsFlag : 0);
+
+            // Each schedule lives in its own nest function, so tagging the enclosing function
+            // scopes the relaxation to this kernel without touching the rest of the package
+            auto funcOp = accera::ir::util::CastOrGetParentOfType<ValueFuncOp>(_scheduleOp.getOperation());
+            funcOp->setAttr(FastMathFlagsAttrName, builder.getI64IntegerAttr(flags));
+        }
+
+        void Tensorize(std::vector<ScalarIndex> indices, MMAShape dims, int numTotalPasses, bool useStaticOffsets, int numFusedPasses, MMASchedulingPolicy schedulingPolicy, bool _useRocWMMA, bool pipelinePasses, MMAFragmentOpType epilogueOp)
+        {
+            auto& builder = GetBuilder();
+
+            TensorizationInfo tensorizationInfo{ static_cast<accera::ir::value::MMAShape>(dims), numTotalPasses, useStaticOffsets, numFusedPasses, static_cast<accera::ir::value::MMASchedulingPolicy>(schedulingPolicy), _useRocWMMA, pipelinePasses, static_cast<accera::ir::value::MMAFragmentOpType>(epilogueOp) };
             auto tensorizationInfoIdentifier = builder.getStringAttr(TensorizationInfoAttr::getKeyName());
             auto tensorizationInfoAttr = TensorizationInfoAttr::get(tensorizationInfo, builder.getContext());
 
@@ -298,6 +350,7 @@ namespace value
         value::ExecutionTarget _execTarget;
         ScheduleOp _scheduleOp;
         ExecPlanOp _execPlanOp;
+        int64_t _nextParallelNestingLevel = 0;
     };
 
     //
@@ -329,14 +382,14 @@ namespace value
 
     Plan::~Plan() = default;
 
-    Cache Plan::AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const MemoryAffineCoefficients& memoryMap, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace)
+    Cache Plan::AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const MemoryAffineCoefficients& memoryMap, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace, int64_t pipelineDepth, int64_t prefetchDistance, bool prefetchL2Only, bool nontemporalWriteback, bool quantizeCache)
     {
-        return _impl->AddManualCache(target, outermostIncludedSplitIndex, triggerIndex, std::nullopt, elementType, thrifty, doubleBuffer, vectorizationInfo, mapping, allocation, memorySpace, doubleBufferMemorySpace, memoryMap);
+        return _impl->AddManualCache(target, outermostIncludedSplitIndex, triggerIndex, std::nullopt, elementType, thrifty, doubleBuffer, vectorizationInfo, mapping, allocation, memorySpace, doubleBufferMemorySpace, memoryMap, CacheStrategy::Striped, pipelineDepth, prefetchDistance, prefetchL2Only, nontemporalWriteback, quantizeCache);
     }
 
-    Cache Plan::AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace)
+    Cache Plan::AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace, int64_t pipelineDepth, int64_t prefetchDistance, bool prefetchL2Only, bool nontemporalWriteback, bool quantizeCache)
     {
-        return _impl->AddManualCache(target, outermostIncludedSplitIndex, triggerIndex, std::nullopt, elementType, thrifty, doubleBuffer, vectorizationInfo, mapping, allocation, memorySpace, doubleBufferMemorySpace, dimOrder);
+        return _impl->AddManualCache(target, outermostIncludedSplitIndex, triggerIndex, std::nullopt, elementType, thrifty, doubleBuffer, vectorizationInfo, mapping, allocation, memorySpace, doubleBufferMemorySpace, dimOrder, CacheStrategy::Striped, pipelineDepth, prefetchDistance, prefetchL2Only, nontemporalWriteback, quantizeCache);
     }
 
     Cache Plan::AddCache(std::variant<ViewAdapter, Cache*> target, int64_t maxElements, const MemoryAffineCoefficients& memoryMap, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace)
@@ -386,14 +439,14 @@ namespace value
         return _impl->AddManualCache(target, std::nullopt, std::nullopt, maxElements, elementType, thrifty, doubleBuffer, vectorizationInfo, mapping, allocation, memorySpace, doubleBufferMemorySpace, dimOrder);
     }
 
-    Cache Plan::EmitRuntimeInitPacking(ViewAdapter target, const std::string& packingFnName, const std::string& packedBufferSizeFnName, CacheIndexing indexing)
+    Cache Plan::EmitRuntimeInitPacking(ViewAdapter target, const std::string& packingFnName, const std::string& packedBufferSizeFnName, CacheIndexing indexing, int64_t numThreads, const std::optional<VectorizationInformation>& vectorizationInfo)
     {
-        return _impl->AddRuntimeInitCache(target, packingFnName, packedBufferSizeFnName, indexing);
+        return _impl->AddRuntimeInitCache(target, packingFnName, packedBufferSizeFnName, indexing, numThreads, vectorizationInfo);
     }
 
-    Cache Plan::PackAndEmbedBuffer(ViewAdapter target, ViewAdapter constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing indexing)
+    Cache Plan::PackAndEmbedBuffer(ViewAdapter target, ViewAdapter constantData, const std::string& wrapperFnName, const std::string& packedBufferName, CacheIndexing indexing, bool compress)
     {
-        return _impl->PackAndEmbedBuffer(target, constantData, wrapperFnName, packedBufferName, indexing);
+        return _impl->PackAndEmbedBuffer(target, constantData, wrapperFnName, packedBufferName, indexing, compress);
     }
 
     void Plan::Vectorize(ScalarIndex i, const VectorizationInformation& vectorizationInfo)
@@ -401,9 +454,27 @@ namespace value
         _impl->Vectorize(i, vectorizationInfo);
     }
 
-    void Plan::Parallelize(std::vector<ScalarIndex> indices, int64_t numThreads, ParallelizationPolicy policy)
+    void Plan::Parallelize(std::vector<ScalarIndex> indices, int64_t numThreads, ParallelizationPolicy policy, ParallelAffinity affinity, int64_t chunkSize)
+    {
+        _impl->Parallelize(indices, numThreads, policy, affinity, chunkSize);
+    }
+
+    void Plan::Parallelize(ScalarIndex index, int64_t numThreads, ParallelizationPolicy policy, ParallelReduction reduction, ParallelAffinity affinity, int64_t chunkSize)
+    {
+        _impl->Parallelize(index, numThreads, policy, reduction, affinity, chunkSize);
+    }
+
+    void Plan::SetFastMathPolicy(const FastMathPolicy& policy)
+    {
+        _impl->SetFastMathPolicy(policy);
+    }
+
+    void Plan::Tensorize(std::vector<ScalarIndex> indices, std::optional<MMAShape> dims)
     {
-        _impl->Parallelize(indices, numThreads, policy);
+        // Without an explicit shape the CPU lowering takes the micro-tile shape from the ranges
+        // of the tensorized indices, so the recorded shape only marks the loops for tensorization.
+        // An explicit shape requests a fixed-shape matrix unit (AMX tiles) instead
+        _impl->Tensorize(indices, dims.value_or(MMAShape::M16xN16xK4_B1), 1, false, -1, MMASchedulingPolicy::PassOrder, false, false, MMAFragmentOpType::None);
     }
 
     //
@@ -430,9 +501,9 @@ namespace value
     {
     }
 
-    Cache GPUPlan::AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const value::ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, CacheStrategy strategy, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace)
+    Cache GPUPlan::AddCache(std::variant<ViewAdapter, Cache*> target, const ScalarIndex& outermostIncludedSplitIndex, const value::ScalarIndex& triggerIndex, const DimensionOrder& dimOrder, const std::optional<value::ValueType>& elementType, bool thrifty, bool doubleBuffer, CacheStrategy strategy, const std::optional<VectorizationInformation>& vectorizationInfo, CacheIndexing mapping, CacheAllocation allocation, MemorySpace memorySpace, MemorySpace doubleBufferMemorySpace, int64_t pipelineDepth)
     {
-        return _impl->AddManualCache(target, outermostIncludedSplitIndex, triggerIndex, std::nullopt, elementType, thrifty, doubleBuffer, vectorizationInfo, mapping, allocation, memorySpace, doubleBufferMemorySpace, dimOrder, strategy);
+        return _impl->AddManualCache(target, outermostIncludedSplitIndex, triggerIndex, std::nullopt, elementType, thrifty, doubleBuffer, vectorizationInfo, mapping, allocation, memorySpace, doubleBufferMemorySpace, dimOrder, strategy, pipelineDepth);
     }
 
     Cache GPUPlan::AddCache(ViewAdapter target, int64_t maxElements, CacheStrategy strategy, MemorySpace memorySpace)
@@ -440,9 +511,9 @@ namespace value
         return _impl->AddAutomaticCache(target, std::nullopt, maxElements, CacheIndexing::GlobalToPhysical, CacheAllocation::Automatic, memorySpace, strategy);
     }
 
-    void GPUPlan::Tensorize(std::vector<ScalarIndex> indices, MMAShape dims, int numTotalPasses, bool useStaticOffsets, int numFusedPasses, MMASchedulingPolicy schedulingPolicy, bool _useRocWMMA)
+    void GPUPlan::Tensorize(std::vector<ScalarIndex> indices, MMAShape dims, int numTotalPasses, bool useStaticOffsets, int numFusedPasses, MMASchedulingPolicy schedulingPolicy, bool _useRocWMMA, bool pipelinePasses, MMAFragmentOpType epilogueOp)
     {
-        _impl->Tensorize(indices, dims, numTotalPasses, useStaticOffsets, numFusedPasses, schedulingPolicy, _useRocWMMA);
+        _impl->Tensorize(indices, dims, numTotalPasses, useStaticOffsets, numFusedPasses, schedulingPolicy, _useRocWMMA, pipelinePasses, epilogueOp);
     }
 
     void GPUPlan::MapIndicesToProcessor(std::vector<ScalarIndex> indices, Processor proc)
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ProfileGuidedSelection.h"
+
+#include <utilities/include/Files.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace accera
+{
+namespace value
+{
+    namespace
+    {
+        constexpr uint32_t profileDataMagic = 0x41434350; // "ACCP"
+        constexpr uint32_t profileDataVersion = 1;
+
+        template <typename T>
+        void WriteScalar(std::ostream& stream, const T& value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool ReadScalar(std::istream& stream, T& value)
+        {
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+    } // namespace
+
+    ProfileDataFile::ProfileDataFile(const std::string& filePath)
+    {
+        if (!utilities::FileExists(filePath))
+        {
+            return;
+        }
+
+        auto stream = utilities::OpenBinaryIfstream(filePath);
+        uint32_t magic = 0, version = 0;
+        uint64_t numEntries = 0;
+        if (!ReadScalar(stream, magic) || magic != profileDataMagic ||
+            !ReadScalar(stream, version) || version != profileDataVersion ||
+            !ReadScalar(stream, numEntries))
+        {
+            return; // not a profile data file (or a future version); treat as empty
+        }
+
+        for (uint64_t i = 0; i < numEntries; ++i)
+        {
+            uint64_t nameLength = 0;
+            if (!ReadScalar(stream, nameLength))
+            {
+                return;
+            }
+            std::string name(nameLength, '\0');
+            if (!stream.read(name.data(), static_cast<std::streamsize>(nameLength)))
+            {
+                return;
+            }
+            FunctionProfile profile;
+            if (!ReadScalar(stream, profile.invocationCount) ||
+                !ReadScalar(stream, profile.totalSeconds) ||
+                !ReadScalar(stream, profile.minSeconds) ||
+                !ReadScalar(stream, profile.maxSeconds))
+            {
+                return;
+            }
+            Accumulate(name, profile);
+        }
+    }
+
+    std::optional<FunctionProfile> ProfileDataFile::GetProfile(const std::string& regionName) const
+    {
+        if (auto it = _profiles.find(regionName); it != _profiles.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    void ProfileDataFile::Accumulate(const std::string& regionName, const FunctionProfile& profile)
+    {
+        auto& existing = _profiles[regionName];
+        if (existing.invocationCount == 0)
+        {
+            existing = profile;
+            return;
+        }
+        existing.invocationCount += profile.invocationCount;
+        existing.totalSeconds += profile.totalSeconds;
+        existing.minSeconds = std::min(existing.minSeconds, profile.minSeconds);
+        existing.maxSeconds = std::max(existing.maxSeconds, profile.maxSeconds);
+    }
+
+    void ProfileDataFile::Write(const std::string& filePath) const
+    {
+        auto stream = utilities::OpenBinaryOfstream(filePath);
+        WriteScalar(stream, profileDataMagic);
+        WriteScalar(stream, profileDataVersion);
+        WriteScalar(stream, static_cast<uint64_t>(_profiles.size()));
+        for (const auto& [name, profile] : _profiles)
+        {
+            WriteScalar(stream, static_cast<uint64_t>(name.size()));
+            stream.write(name.data(), static_cast<std::streamsize>(name.size()));
+            WriteScalar(stream, profile.invocationCount);
+            WriteScalar(stream, profile.totalSeconds);
+            WriteScalar(stream, profile.minSeconds);
+            WriteScalar(stream, profile.maxSeconds);
+        }
+    }
+
+    std::optional<std::string> SelectBestVariant(const ProfileDataFile& profileData, const std::vector<std::string>& variantNames)
+    {
+        std::optional<std::string> best;
+        double bestMean = std::numeric_limits<double>::max();
+        for (const auto& name : variantNames)
+        {
+            auto profile = profileData.GetProfile(name);
+            if (!profile || profile->invocationCount == 0)
+            {
+                continue;
+            }
+            if (profile->MeanSeconds() < bestMean)
+            {
+                bestMean = profile->MeanSeconds();
+                best = name;
+            }
+        }
+        return best;
+    }
+
+} // namespace value
+} // namespace accera
@@ -145,6 +145,8 @@ namespace value
         {
         case ValueType::Float16:
             [[fallthrough]];
+        case ValueType::BFloat16:
+            [[fallthrough]];
         case ValueType::Float:
             [[fallthrough]];
         case ValueType::Double:
@@ -168,6 +170,14 @@ namespace value
         return ScalarOpBuilder<mlir::math::FloorOp>(s);
     }
 
+    Scalar Round(Scalar s)
+    {
+        // Round to nearest, halves away from zero (math dialect has no round op in this
+        // LLVM version, so compose it from floor/ceil)
+        auto half = Cast(0.5, s.GetType());
+        return Select(s < Cast(0, s.GetType()), Ceil(s - half), Floor(s + half));
+    }
+
     Scalar CopySign(Scalar s1, Scalar s2)
     {
         return ScalarOpBuilder<mlir::math::CopySignOp>(s1, s2);
@@ -284,6 +294,44 @@ namespace value
         return x * y;
     }
 
+    Scalar QuantizeSaturate(Scalar s, Scalar scale, ValueType destType)
+    {
+        int64_t minVal = 0;
+        int64_t maxVal = 0;
+        switch (destType)
+        {
+        case ValueType::Int8:
+            minVal = -128;
+            maxVal = 127;
+            break;
+        case ValueType::Byte:
+            minVal = 0;
+            maxVal = 255;
+            break;
+        case ValueType::Int16:
+            minVal = -32768;
+            maxVal = 32767;
+            break;
+        case ValueType::Uint16:
+            minVal = 0;
+            maxVal = 65535;
+            break;
+        default:
+            throw InputException(InputExceptionErrors::invalidArgument, "QuantizeSaturate requires a narrow integer destination type");
+        }
+
+        // Scale, round, and saturate in the floating point domain so the final cast is always
+        // in range; the clamp + cast pair is what the vectorizer turns into a saturating pack
+        auto scaled = Round(Multiply(s, scale));
+        auto clamped = Clamp(scaled, Cast(minVal, scaled.GetType()), Cast(maxVal, scaled.GetType()));
+        return Cast(clamped, destType);
+    }
+
+    Scalar Dequantize(Scalar s, Scalar scale)
+    {
+        return Multiply(Cast(s, scale.GetType()), scale);
+    }
+
     // TODO: should this live in Scalar.cpp?
     Scalar LogicalNot(const Scalar v)
     {
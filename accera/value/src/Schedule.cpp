@@ -17,6 +17,7 @@
 
 #include <mlir/IR/BlockAndValueMapping.h>
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <ir/include/IRUtil.h>
@@ -85,12 +86,37 @@ namespace value
             return _op.skew(i, reference);
         }
 
+        Index Flatten(Index outer, Index inner)
+        {
+            return _op.flatten(outer, inner);
+        }
+
+        ScalarIndex Flatten(ScalarIndex outer, ScalarIndex inner)
+        {
+            auto flattenedIndex = _op.flatten(GetIndexOp(outer), GetIndexOp(inner));
+            return MakeScalarIndex(flattenedIndex);
+        }
+
         ScalarIndex Skew(ScalarIndex i, ScalarIndex reference)
         {
             auto skewedIndex = _op.skew(GetIndexOp(i), GetIndexOp(reference));
             return MakeScalarIndex(skewedIndex);
         }
 
+        Index Wavefront(Index i, Index reference)
+        {
+            auto wavefrontIndex = _op.skew(i, reference);
+            MoveOutermost(wavefrontIndex);
+            return wavefrontIndex;
+        }
+
+        ScalarIndex Wavefront(ScalarIndex i, ScalarIndex reference)
+        {
+            auto wavefrontIndexOp = _op.skew(GetIndexOp(i), GetIndexOp(reference));
+            MoveOutermost(wavefrontIndexOp.getValue());
+            return MakeScalarIndex(wavefrontIndexOp);
+        }
+
         void Unroll(Index i, std::optional<uint64_t> size)
         {
             _op.unroll(i, /*unroll=*/true, size);
@@ -116,6 +142,24 @@ namespace value
             _op.setOrder(order);
         }
 
+        std::vector<Index> GetOrder()
+        {
+            return _op.getOrder();
+        }
+
+        ir::loopnest::Range GetIndexRange(const Index& index)
+        {
+            return _op.getDomain().getValue().GetIndexRange(index);
+        }
+
+        void MoveOutermost(Index index)
+        {
+            auto order = _op.getOrder();
+            order.erase(std::remove(order.begin(), order.end(), index), order.end());
+            order.insert(order.begin(), index);
+            _op.setOrder(order);
+        }
+
         void SetOrder(std::vector<ScalarIndex> order)
         {
             std::vector<Index> indexOrder;
@@ -172,9 +216,6 @@ namespace value
 
         ScalarIndex Fuse(std::vector<ScheduleImpl>& others, std::vector<std::vector<ScalarIndex>> correspondences)
         {
-            auto nest = GetOp()->getParentOfType<NestOp>();
-            mlir::OpBuilder builder(nest);
-
             std::vector<std::vector<Index>> indexCorrespondences;
             indexCorrespondences.reserve(correspondences.size());
 
@@ -198,23 +239,12 @@ namespace value
                     return valueIndices;
                 });
 
-            std::vector<ScheduleOp> schedules{ GetOp() };
-            schedules.reserve(others.size() + 1);
-            std::transform(
-                others.begin(),
-                others.end(),
-                std::back_inserter(schedules),
-                [](ScheduleImpl& other) { return other.GetOp(); });
-
-            auto [newOp, fusingIndex] = ir::loopnest::Fuse(builder, schedules, indexCorrespondences);
+            return FuseSchedules(others, indexCorrespondences);
+        }
 
-            for (auto& other : others)
-            {
-                other._op = {};
-            }
-            _op = newOp;
-            auto indexOp = _op.getOrCreateSymbolicIndex(builder, fusingIndex);
-            return MakeScalarIndex(indexOp);
+        ScalarIndex Fuse(std::vector<ScheduleImpl>& others)
+        {
+            return FuseSchedules(others, ir::loopnest::InferIndexCorrespondences(GatherScheduleOps(others)));
         }
 
         ScheduleOp GetOp() const
@@ -261,6 +291,35 @@ namespace value
             return mlir::OpBuilder(_op);
         }
 
+        std::vector<ScheduleOp> GatherScheduleOps(std::vector<ScheduleImpl>& others)
+        {
+            std::vector<ScheduleOp> schedules{ GetOp() };
+            schedules.reserve(others.size() + 1);
+            std::transform(
+                others.begin(),
+                others.end(),
+                std::back_inserter(schedules),
+                [](ScheduleImpl& other) { return other.GetOp(); });
+            return schedules;
+        }
+
+        ScalarIndex FuseSchedules(std::vector<ScheduleImpl>& others, const std::vector<std::vector<Index>>& indexCorrespondences)
+        {
+            auto nest = GetOp()->getParentOfType<NestOp>();
+            mlir::OpBuilder builder(nest);
+
+            auto schedules = GatherScheduleOps(others);
+            auto [newOp, fusingIndex] = ir::loopnest::Fuse(builder, schedules, indexCorrespondences);
+
+            for (auto& other : others)
+            {
+                other._op = {};
+            }
+            _op = newOp;
+            auto indexOp = _op.getOrCreateSymbolicIndex(builder, fusingIndex);
+            return MakeScalarIndex(indexOp);
+        }
+
         SymbolicIndexOp GetIndexOp(ScalarIndex val)
         {
             if (val.GetValue().IsUndefined())
@@ -345,6 +404,200 @@ namespace value
         return _impl->Split(i, factor);
     }
 
+    namespace
+    {
+        // The largest power-of-two tile size whose square active block occupies about half the
+        // targeted cache level, leaving the other half for the streamed operand and other traffic
+        int DeriveCacheSplitFactor(CacheLevel cacheLevel, const TargetDevice& targetDevice, int bytesPerElement)
+        {
+            auto cacheBytes = targetDevice.GetCacheSize(cacheLevel);
+            if (cacheBytes == 0 || bytesPerElement <= 0)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Target device has no cache geometry for the requested cache level");
+            }
+            auto budgetElements = static_cast<int64_t>(cacheBytes / 2) / bytesPerElement;
+            int64_t factor = 1;
+            while ((factor * 2) * (factor * 2) <= budgetElements)
+            {
+                factor *= 2;
+            }
+            return static_cast<int>(factor);
+        }
+    } // namespace
+
+    SplitIndex Schedule::Split(Index i, CacheLevel cacheLevel, const TargetDevice& targetDevice, int bytesPerElement)
+    {
+        return Split(i, DeriveCacheSplitFactor(cacheLevel, targetDevice, bytesPerElement));
+    }
+
+    ScalarIndexPair Schedule::Split(ScalarIndex i, CacheLevel cacheLevel, const TargetDevice& targetDevice, int bytesPerElement)
+    {
+        return Split(i, DeriveCacheSplitFactor(cacheLevel, targetDevice, bytesPerElement));
+    }
+
+    std::vector<std::vector<ScalarIndex>> Schedule::TileHierarchy(std::vector<ScalarIndex> indices, const std::vector<std::vector<int>>& levelFootprints)
+    {
+        if (indices.empty() || levelFootprints.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "TileHierarchy requires at least one index and one level");
+        }
+        for (const auto& footprints : levelFootprints)
+        {
+            if (footprints.size() != indices.size())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Each TileHierarchy level must supply one footprint per tiled dimension");
+            }
+        }
+        for (size_t dimension = 0; dimension < indices.size(); ++dimension)
+        {
+            for (size_t level = 0; level < levelFootprints.size(); ++level)
+            {
+                if (levelFootprints[level][dimension] <= 1)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "TileHierarchy footprints must be greater than 1");
+                }
+                if (level > 0 && levelFootprints[level][dimension] >= levelFootprints[level - 1][dimension])
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "TileHierarchy footprints must be strictly decreasing from level to level");
+                }
+            }
+        }
+
+        // Split each dimension through the levels, outermost (largest footprint) first
+        std::vector<std::vector<ScalarIndex>> indexTree(indices.size());
+        for (size_t dimension = 0; dimension < indices.size(); ++dimension)
+        {
+            auto current = indices[dimension];
+            for (const auto& footprints : levelFootprints)
+            {
+                auto [outer, inner] = Split(current, footprints[dimension]);
+                indexTree[dimension].push_back(outer);
+                current = inner;
+            }
+            indexTree[dimension].push_back(current);
+        }
+
+        // Canonical hierarchical order: each level's indices, in the dimensions' given order,
+        // before the next (smaller) level's
+        std::vector<ScalarIndex> order;
+        order.reserve(indices.size() * (levelFootprints.size() + 1));
+        for (size_t level = 0; level <= levelFootprints.size(); ++level)
+        {
+            for (size_t dimension = 0; dimension < indices.size(); ++dimension)
+            {
+                order.push_back(indexTree[dimension][level]);
+            }
+        }
+        SetOrder(order);
+
+        return indexTree;
+    }
+
+    std::vector<std::vector<ScalarIndex>> Schedule::TileHierarchy(std::vector<ScalarIndex> indices, const std::vector<CacheLevel>& cacheLevels, const TargetDevice& targetDevice, int bytesPerElement)
+    {
+        std::vector<std::vector<int>> levelFootprints;
+        levelFootprints.reserve(cacheLevels.size());
+        for (auto cacheLevel : cacheLevels)
+        {
+            levelFootprints.emplace_back(indices.size(), DeriveCacheSplitFactor(cacheLevel, targetDevice, bytesPerElement));
+        }
+        return TileHierarchy(std::move(indices), levelFootprints);
+    }
+
+    std::vector<ScalarIndex> Schedule::SetTileTraversal(TileTraversal traversal, std::vector<ScalarIndex> tileIndices)
+    {
+        if (tileIndices.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "SetTileTraversal requires at least one tile index");
+        }
+
+        std::vector<ScalarIndex> traversalIndices;
+        std::vector<Index> replacedIndices;
+        for (auto& tileIndex : tileIndices)
+        {
+            replacedIndices.push_back(ResolveIndex(tileIndex));
+        }
+
+        switch (traversal)
+        {
+        case TileTraversal::RowMajor:
+            // Lexicographic visit order: the given tile loops, outermost first, as-is
+            traversalIndices = tileIndices;
+            break;
+
+        case TileTraversal::ZOrder:
+        {
+            // Decompose each tile loop into a chain of 2-iteration loops (one per bit of the
+            // tile coordinate, most significant outermost), then interleave the chains across
+            // the dimensions. Running the interleaved bit loops lexicographically visits the
+            // tiles along a Morton curve: each quadrant of the tile grid is finished before the
+            // next is started, recursively, so consecutive tiles stay close in every dimension.
+            // Grids whose tile counts aren't powers of two fall out of the ordinary boundary
+            // partitioning of the uneven splits.
+            std::vector<std::vector<ScalarIndex>> bitChains(tileIndices.size());
+            size_t maxLevels = 0;
+            for (size_t dimension = 0; dimension < tileIndices.size(); ++dimension)
+            {
+                auto range = _impl->GetIndexRange(replacedIndices[dimension]);
+                if (!range.HasConstantEnd())
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Z-order tile traversal requires tile loops with constant ranges");
+                }
+                auto numTiles = range.NumIterations();
+                auto tileStep = range.Increment();
+
+                size_t levels = 1;
+                while ((int64_t(1) << levels) < numTiles)
+                {
+                    ++levels;
+                }
+                maxLevels = std::max(maxLevels, levels);
+
+                auto current = tileIndices[dimension];
+                auto& chain = bitChains[dimension];
+                for (size_t level = levels - 1; level > 0; --level)
+                {
+                    auto [outer, inner] = Split(current, static_cast<int>(tileStep << level));
+                    chain.push_back(outer);
+                    current = inner;
+                }
+                chain.push_back(current);
+            }
+
+            // Interleave bit loops by significance, dimensions in their given order within each
+            // level; dimensions with fewer bits only participate in the lower levels
+            for (size_t bit = maxLevels; bit-- > 0;)
+            {
+                for (auto& chain : bitChains)
+                {
+                    if (bit < chain.size())
+                    {
+                        traversalIndices.push_back(chain[chain.size() - 1 - bit]);
+                    }
+                }
+            }
+            break;
+        }
+        }
+
+        // Place the traversal loops outermost, preserving the relative order of all other loops
+        std::vector<Index> newOrder;
+        for (auto& traversalIndex : traversalIndices)
+        {
+            newOrder.push_back(ResolveIndex(traversalIndex));
+        }
+        for (auto& index : _impl->GetOrder())
+        {
+            if (std::find(newOrder.begin(), newOrder.end(), index) == newOrder.end())
+            {
+                newOrder.push_back(index);
+            }
+        }
+        _impl->SetOrder(newOrder);
+
+        return traversalIndices;
+    }
+
     Index Schedule::Pad(Index i, int size, bool padFront)
     {
         return _impl->Pad(i, size, padFront);
@@ -363,6 +616,25 @@ namespace value
         return _impl->Skew(i, reference);
     }
 
+    Index Schedule::Flatten(Index outer, Index inner)
+    {
+        return _impl->Flatten(outer, inner);
+    }
+    ScalarIndex Schedule::Flatten(ScalarIndex outer, ScalarIndex inner)
+    {
+        return _impl->Flatten(outer, inner);
+    }
+
+    Index Schedule::Wavefront(Index i, Index reference)
+    {
+        return _impl->Wavefront(i, reference);
+    }
+
+    ScalarIndex Schedule::Wavefront(ScalarIndex i, ScalarIndex reference)
+    {
+        return _impl->Wavefront(i, reference);
+    }
+
     void Schedule::Unroll(Index i, std::optional<uint64_t> size)
     {
         return _impl->Unroll(i, size);
@@ -427,6 +699,16 @@ namespace value
         return _impl->Fuse(impls, correspondences);
     }
 
+    ScalarIndex Schedule::Fuse(std::vector<Schedule>& others)
+    {
+        std::vector<ScheduleImpl> impls;
+        impls.reserve(others.size());
+
+        std::transform(others.begin(), others.end(), std::back_inserter(impls),[](Schedule& other){return other.GetImpl();});
+
+        return _impl->Fuse(impls);
+    }
+
     Plan Schedule::CreatePlan()
     {
         return { *this };
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Chuck Jacobs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SparseOperations.h"
+#include "ArrayOperations.h"
+#include "Nest.h"
+#include "Plan.h"
+#include "Schedule.h"
+#include "ValueOperations.h"
+
+#include <utilities/include/Exception.h>
+
+#include <algorithm>
+
+namespace accera
+{
+using namespace utilities;
+
+namespace value
+{
+    namespace
+    {
+        Scalar UnitStep(Scalar rangeBound)
+        {
+            // A loop step of 1 in the same type as the offset buffer's entries
+            return Cast(Scalar(1), rangeBound.GetType());
+        }
+    } // namespace
+
+    void ForEachNonzero(CSRMatrix A, std::function<void(Scalar, Scalar, Scalar)> fn)
+    {
+        Nest nest(MemoryShape{ A.rows });
+        auto i = nest.GetIndices()[0];
+
+        nest.Set([&]() {
+            auto rowStart = A.rowOffsets(i);
+            auto rowEnd = A.rowOffsets(i + 1);
+            For(rowStart, rowEnd, UnitStep(rowStart), [&](Scalar nz) {
+                fn(i, A.columnIndices(nz), A.values(nz));
+            });
+        });
+
+        nest.CreateSchedule();
+    }
+
+    void SpMM(CSRMatrix A, Array B, Array C, bool clearC)
+    {
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int N = (int)B.Shape()[1];
+        ThrowIfNot(A.columns == (int)B.Shape()[0]);
+        ThrowIfNot(A.rows == (int)C.Shape()[0]);
+        ThrowIfNot(N == (int)C.Shape()[1]);
+
+        if (clearC)
+        {
+            ClearMatrix(C);
+        }
+
+        Nest nest(MemoryShape{ A.rows });
+        auto i = nest.GetIndices()[0];
+
+        nest.Set([&]() {
+            auto rowStart = A.rowOffsets(i);
+            auto rowEnd = A.rowOffsets(i + 1);
+            For(rowStart, rowEnd, UnitStep(rowStart), [&](Scalar nz) {
+                auto a = A.values(nz);
+                auto column = A.columnIndices(nz);
+
+                // Each nonzero scales a contiguous row of B into a contiguous row of C, so the
+                // only gathered access is the row base offset
+                Nest innerNest(MemoryShape{ N });
+                auto j = innerNest.GetIndices()[0];
+                innerNest.Set([&]() {
+                    C(i, j) += a * B(column, j);
+                });
+                auto innerSchedule = innerNest.CreateSchedule();
+                auto innerPlan = innerSchedule.CreatePlan();
+                if (N >= vectorSize)
+                {
+                    innerPlan.Vectorize(j, { vectorSize, vectorUnits, true });
+                }
+            });
+        });
+
+        nest.CreateSchedule();
+    }
+
+    void SpMM(BSRMatrix A, Array B, Array C, bool clearC)
+    {
+        const int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        const int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        const int N = (int)B.Shape()[1];
+        ThrowIfNot(A.columns == (int)B.Shape()[0]);
+        ThrowIfNot(A.rows == (int)C.Shape()[0]);
+        ThrowIfNot(N == (int)C.Shape()[1]);
+        ThrowIfNot(A.rows % A.blockRows == 0);
+        ThrowIfNot(A.columns % A.blockColumns == 0);
+        ThrowIfNot(A.blockRows == (int)A.blockValues.Shape()[1]);
+        ThrowIfNot(A.blockColumns == (int)A.blockValues.Shape()[2]);
+
+        if (clearC)
+        {
+            ClearMatrix(C);
+        }
+
+        const int numBlockRows = A.rows / A.blockRows;
+
+        Nest nest(MemoryShape{ numBlockRows });
+        auto ib = nest.GetIndices()[0];
+
+        nest.Set([&]() {
+            auto blockRowStart = A.blockRowOffsets(ib);
+            auto blockRowEnd = A.blockRowOffsets(ib + 1);
+            For(blockRowStart, blockRowEnd, UnitStep(blockRowStart), [&](Scalar nz) {
+                auto jb = A.blockColumnIndices(nz);
+
+                // One stored block contributes a small dense matmul: a blockRows x blockColumns
+                // block of A against a blockColumns x N slab of B
+                Nest innerNest(MemoryShape{ A.blockRows, A.blockColumns, N });
+                ScalarIndex bi, bj, j;
+                std::tie(bi, bj, j) = innerNest.GetIndices<3>();
+                innerNest.Set([&]() {
+                    C(ib * A.blockRows + bi, j) += A.blockValues(nz, bi, bj) * B(jb * A.blockColumns + bj, j);
+                });
+                auto innerSchedule = innerNest.CreateSchedule();
+                innerSchedule.Unroll(bi);
+                innerSchedule.Unroll(bj);
+                auto innerPlan = innerSchedule.CreatePlan();
+                if (N >= vectorSize)
+                {
+                    innerPlan.Vectorize(j, { vectorSize, vectorUnits, true });
+                }
+            });
+        });
+
+        nest.CreateSchedule();
+    }
+
+} // namespace value
+} // namespace accera
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) Microsoft Corporation. All rights reserved.
+//  Licensed under the MIT License. See LICENSE in the project root for license information.
+//  Authors: Mason Remy
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Specialization.h"
+#include "EmitterContext.h"
+#include "Scalar.h"
+#include "ScalarOperations.h"
+
+#include <utilities/include/Exception.h>
+
+#include <string>
+
+namespace accera
+{
+namespace value
+{
+    namespace
+    {
+        std::string VariantSuffix(const SizeClass& sizeClass)
+        {
+            std::string suffix;
+            for (auto size : sizeClass.dimensionSizes)
+            {
+                suffix += (suffix.empty() ? "_" : "x") + std::to_string(size);
+            }
+            return suffix;
+        }
+    } // namespace
+
+    void DefineSizeClassSpecializedFunction(FunctionDeclaration fnDecl,
+                                            std::vector<size_t> dimensionArgIndices,
+                                            std::vector<SizeClass> sizeClasses,
+                                            std::function<void(std::vector<Value> args, const std::vector<int64_t>& sizes)> body)
+    {
+        if (fnDecl.GetReturnType().has_value())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Size-specialized functions must be void-returning; use an output parameter instead");
+        }
+        if (dimensionArgIndices.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Size-specialized functions require at least one runtime dimension argument");
+        }
+        for (const auto& sizeClass : sizeClasses)
+        {
+            if (sizeClass.dimensionSizes.size() != dimensionArgIndices.size())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidSize, "Each size class must provide one size per runtime dimension argument");
+            }
+        }
+        for (auto argIndex : dimensionArgIndices)
+        {
+            if (argIndex >= fnDecl.GetParameterTypes().size())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Runtime dimension argument index is out of range");
+            }
+        }
+
+        std::vector<ViewAdapter> params(fnDecl.GetParameterTypes().begin(), fnDecl.GetParameterTypes().end());
+
+        std::vector<FunctionDeclaration> variants;
+        variants.reserve(sizeClasses.size());
+        for (const auto& sizeClass : sizeClasses)
+        {
+            auto variantDecl = DeclareFunction(fnDecl.GetFunctionName() + VariantSuffix(sizeClass))
+                                   .Parameters(params, fnDecl.GetParameterUsages());
+            variantDecl.Define([&body, sizes = sizeClass.dimensionSizes](std::vector<Value> args) {
+                body(args, sizes);
+            });
+            variants.push_back(std::move(variantDecl));
+        }
+
+        auto fallbackDecl = DeclareFunction(fnDecl.GetFunctionName() + "_generic")
+                                .Parameters(params, fnDecl.GetParameterUsages());
+        fallbackDecl.Define([&body](std::vector<Value> args) {
+            body(args, {});
+        });
+
+        fnDecl.Define([variants = std::move(variants),
+                       fallbackDecl = std::move(fallbackDecl),
+                       dimensionArgIndices = std::move(dimensionArgIndices),
+                       sizeClasses = std::move(sizeClasses)](std::vector<Value> args) {
+            std::vector<ViewAdapter> callArgs(args.begin(), args.end());
+            if (variants.empty())
+            {
+                (void)fallbackDecl.Call(callArgs);
+                return;
+            }
+
+            auto dimensionMatches = [&](size_t dim, const SizeClass& sizeClass) {
+                Scalar dimensionArg = args[dimensionArgIndices[dim]];
+                return dimensionArg == Cast(Scalar(sizeClass.dimensionSizes[dim]), dimensionArg.GetType());
+            };
+            auto matchesSizeClass = [&](const SizeClass& sizeClass) {
+                Scalar matches = dimensionMatches(0, sizeClass);
+                for (size_t dim = 1; dim < dimensionArgIndices.size(); ++dim)
+                {
+                    matches = matches && dimensionMatches(dim, sizeClass);
+                }
+                return matches;
+            };
+
+            auto ifContext = If(matchesSizeClass(sizeClasses[0]), [&] {
+                (void)variants[0].Call(callArgs);
+            });
+            for (size_t i = 1; i < variants.size(); ++i)
+            {
+                ifContext.ElseIf(matchesSizeClass(sizeClasses[i]), [&] {
+                    (void)variants[i].Call(callArgs);
+                });
+            }
+            ifContext.Else([&] {
+                (void)fallbackDecl.Call(callArgs);
+            });
+        });
+    }
+
+} // namespace value
+} // namespace accera
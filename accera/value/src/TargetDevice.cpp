@@ -22,6 +22,8 @@
 #pragma warning(enable : 4146)
 #endif
 
+#include <algorithm>
+#include <cassert>
 #include <map>
 
 namespace accera
@@ -97,6 +99,9 @@ namespace value
                  targetDevice.cpu = "skylake-avx512";
                  targetDevice.numBits = 64;
                  targetDevice.features = "+avx512f";
+                 targetDevice.l1CacheSize = 32 * 1024;
+                 targetDevice.l2CacheSize = 1024 * 1024;
+                 targetDevice.l3CacheSize = 32 * 1024 * 1024;
              } },
             { "pi0", [](TargetDevice& targetDevice) {
                  targetDevice.triple = c_armv6Triple;
@@ -143,6 +148,38 @@ namespace value
                  targetDevice.architecture = "thumb";
                  targetDevice.cpu = c_armCortexM4;
                  targetDevice.dataLayout = "e-m:e-p:32:32-i64:64-v128:64:128-a:0:32-n32-S64";
+             } },
+            // GPU targets carry per-multiprocessor occupancy limits used by the
+            // gpu-occupancy-check pass
+            { "mi100" /* AMD CDNA1, gfx908 */, [](TargetDevice& targetDevice) {
+                 targetDevice.architecture = "amdgcn";
+                 targetDevice.cpu = "gfx908";
+                 targetDevice.maxThreadsPerBlock = 1024;
+                 targetDevice.maxThreadsPerMultiprocessor = 2560;
+                 targetDevice.maxSharedMemoryPerBlock = 64 * 1024;
+                 targetDevice.sharedMemoryPerMultiprocessor = 64 * 1024;
+                 targetDevice.registersPerMultiprocessor = 65536;
+                 targetDevice.numMultiprocessors = 120;
+             } },
+            { "v100" /* NVIDIA Volta, sm_70 */, [](TargetDevice& targetDevice) {
+                 targetDevice.architecture = "nvptx64";
+                 targetDevice.cpu = "sm_70";
+                 targetDevice.maxThreadsPerBlock = 1024;
+                 targetDevice.maxThreadsPerMultiprocessor = 2048;
+                 targetDevice.maxSharedMemoryPerBlock = 96 * 1024;
+                 targetDevice.sharedMemoryPerMultiprocessor = 96 * 1024;
+                 targetDevice.registersPerMultiprocessor = 65536;
+                 targetDevice.numMultiprocessors = 80;
+             } },
+            { "a100" /* NVIDIA Ampere, sm_80 */, [](TargetDevice& targetDevice) {
+                 targetDevice.architecture = "nvptx64";
+                 targetDevice.cpu = "sm_80";
+                 targetDevice.maxThreadsPerBlock = 1024;
+                 targetDevice.maxThreadsPerMultiprocessor = 2048;
+                 targetDevice.maxSharedMemoryPerBlock = 164 * 1024;
+                 targetDevice.sharedMemoryPerMultiprocessor = 164 * 1024;
+                 targetDevice.registersPerMultiprocessor = 65536;
+                 targetDevice.numMultiprocessors = 108;
              } }
         };
 
@@ -205,6 +242,22 @@ namespace value
             targetDevice.numBits = c_defaultNumBits;
         }
 
+        // Fill in generic cache geometry for targets that don't specify their own. These are
+        // conservative per-core figures for the architecture family; specific SKU entries in the
+        // device map can override them.
+        if (targetDevice.l1CacheSize == 0)
+        {
+            targetDevice.l1CacheSize = 32 * 1024;
+        }
+        if (targetDevice.l2CacheSize == 0)
+        {
+            targetDevice.l2CacheSize = (targetDevice.architecture == "x86_64") ? 256 * 1024 : 512 * 1024;
+        }
+        if (targetDevice.l3CacheSize == 0 && targetDevice.architecture == "x86_64")
+        {
+            targetDevice.l3CacheSize = 8 * 1024 * 1024;
+        }
+
         // Set low-level args based on target name (if present)
         if (deviceName == "host")
         {
@@ -223,6 +276,66 @@ namespace value
         {
             throw EmitterException(EmitterError::targetNotSupported, "Unknown target device name: " + deviceName);
         }
+
+        // The vector register file is a property of the ISA rather than the SKU, so derive it from
+        // the completed features and architecture instead of storing it per device
+        if (targetDevice.numVectorRegisters == 0)
+        {
+            if (targetDevice.HasFeature("+avx512f") || targetDevice.architecture == "aarch64")
+            {
+                targetDevice.numVectorRegisters = 32; // zmm0-31 on AVX-512, v0-v31 on AArch64
+            }
+            else
+            {
+                // 16 xmm/ymm registers on x86-64 and 16 q registers on 32-bit NEON; 8 on 32-bit x86
+                targetDevice.numVectorRegisters = (targetDevice.architecture == "x86") ? 8 : 16;
+            }
+        }
+    }
+
+    RegisterTileShape DeriveRegisterTileShape(const TargetDevice& targetDevice, int bytesPerElement)
+    {
+        assert(bytesPerElement > 0);
+
+        if (targetDevice.registersPerMultiprocessor != 0 && targetDevice.maxThreadsPerMultiprocessor != 0)
+        {
+            // GPU: size a square per-thread accumulator block from the per-thread register budget,
+            // keeping it within about 2/3 of the budget so operand fragments and addressing still fit
+            auto perThreadRegisterBytes = static_cast<int64_t>(targetDevice.registersPerMultiprocessor / targetDevice.maxThreadsPerMultiprocessor) * 4; // 32-bit registers
+            auto accumulatorBudget = (perThreadRegisterBytes * 2) / 3;
+            int64_t side = 1;
+            while ((2 * side) * (2 * side) * bytesPerElement <= accumulatorBudget)
+            {
+                side *= 2;
+            }
+            return { side, side };
+        }
+
+        // CPU: outer-product micro-kernel. The accumulator block is `rows` broadcast rows by
+        // `colVectors` vector-register columns; besides the rows * colVectors accumulators we
+        // reserve colVectors registers for the column loads and one for the row broadcast.
+        // Larger register files support a wider block (3 column vectors instead of 2).
+        int64_t vectorBytes = 16; // SSE2 / NEON baseline
+        if (targetDevice.HasFeature("+avx512f"))
+        {
+            vectorBytes = 64;
+        }
+        else if (targetDevice.HasFeature("+avx2") || targetDevice.HasFeature("+avx"))
+        {
+            vectorBytes = 32;
+        }
+        auto vectorElements = std::max<int64_t>(1, vectorBytes / bytesPerElement);
+
+        auto numRegisters = static_cast<int64_t>(targetDevice.numVectorRegisters != 0 ? targetDevice.numVectorRegisters : 16);
+        auto colVectors = numRegisters >= 32 ? int64_t{ 3 } : int64_t{ 2 };
+        auto rows = (numRegisters - colVectors - 1) / colVectors;
+        if (rows > 2 && rows % 2 != 0)
+        {
+            rows -= 1; // keep the row count even so row-pair unrolling stays balanced
+        }
+
+        // 6x16 fp32 on AVX2 (16 ymm registers), 8x48 fp32 on AVX-512 (32 zmm registers)
+        return { rows, colVectors * vectorElements };
     }
 
     namespace
@@ -5,10 +5,19 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "TensorOperations.h"
+#include "ArrayOperations.h"
+#include "Cache.h"
 #include "EmitterContext.h"
+#include "Nest.h"
+#include "Plan.h"
 #include "Scalar.h"
+#include "Schedule.h"
 #include "Tensor.h"
 
+#include <utilities/include/Exception.h>
+
+#include <algorithm>
+
 namespace accera
 {
 using namespace utilities;
@@ -48,5 +57,231 @@ namespace value
             name);
     }
 
+    void Convolve2DNCHWc(Array input, Array weights, Array output, int rowStride, int columnStride, bool clearOutput)
+    {
+        const int inputChannelBlocks = (int)input.Shape()[0];
+        const int inputRows = (int)input.Shape()[1];
+        const int inputColumns = (int)input.Shape()[2];
+        const int inputBlockSize = (int)input.Shape()[3];
+
+        const int outputChannelBlocks = (int)weights.Shape()[0];
+        const int kernelRows = (int)weights.Shape()[2];
+        const int kernelColumns = (int)weights.Shape()[3];
+        const int outputBlockSize = (int)weights.Shape()[5];
+        ThrowIfNot(inputChannelBlocks == (int)weights.Shape()[1]);
+        ThrowIfNot(inputBlockSize == (int)weights.Shape()[4]);
+
+        const int outputRows = (inputRows - kernelRows) / rowStride + 1;
+        const int outputColumns = (inputColumns - kernelColumns) / columnStride + 1;
+        ThrowIfNot(outputChannelBlocks == (int)output.Shape()[0]);
+        ThrowIfNot(outputRows == (int)output.Shape()[1]);
+        ThrowIfNot(outputColumns == (int)output.Shape()[2]);
+        ThrowIfNot(outputBlockSize == (int)output.Shape()[3]);
+
+        if (clearOutput)
+        {
+            ClearArray(output);
+        }
+
+        Nest nest(MemoryShape{ outputChannelBlocks, inputChannelBlocks, outputRows, outputColumns, kernelRows, kernelColumns, inputBlockSize, outputBlockSize });
+
+        ScalarIndex ocBlock, icBlock, r, c, kr, kc, ic, oc;
+        std::tie(ocBlock, icBlock, r, c, kr, kc, ic, oc) = nest.GetIndices<8>();
+
+        nest.Set([&]() {
+            output(ocBlock, r, c, oc) += input(icBlock, r * rowStride + kr, c * columnStride + kc, ic) * weights(ocBlock, icBlock, kr, kc, ic, oc);
+        });
+
+        auto schedule = nest.CreateSchedule();
+
+        // Schedule constants
+        // TODO : read these values from the target system
+        int vectorSize = 8; // AVX-2 gives 256-bit registers, which can hold 8 floats
+        int vectorUnits = 16; // AVX-2 has 16 256-bit registers
+
+        // Register tile: a strip of output columns by one output-channel block
+        int columnsInKernel = std::min(outputColumns, 4);
+        int channelUnroll = std::min(inputBlockSize, 4);
+
+        // Declare splits
+        auto [cOuter, cInner] = schedule.Split(c, columnsInKernel);
+        auto [icOuter, icInner] = schedule.Split(ic, channelUnroll);
+
+        // Set the order: the reduction loops (kernel window and input channels) surround the
+        // register tile so the output accumulators stay live across the whole reduction
+        schedule.SetOrder({ ocBlock, icBlock, r, cOuter, kr, kc, icOuter, icInner, cInner, oc });
+
+        auto plan = schedule.CreatePlan();
+
+        if ((kernelRows * kernelColumns * inputBlockSize * outputBlockSize) > (128 * 128))
+        {
+            plan.AddCache(weights, kr, std::nullopt /* elementType */, false /* thrifty */, false /* doubleBuffer */, std::nullopt /* vectorizationInfo */, CacheIndexing::GlobalToPhysical, CacheAllocation::Automatic, MemorySpace::Shared);
+        }
+        plan.AddCache(output, cInner, std::nullopt /* elementType */, false /* thrifty */, false /* doubleBuffer */, std::nullopt /* vectorizationInfo */, CacheIndexing::GlobalToPhysical, CacheAllocation::Automatic, MemorySpace::Shared);
+
+        // Set unrolling
+        schedule.Unroll(cInner);
+        schedule.Unroll(icInner);
+        if (outputBlockSize >= vectorSize)
+        {
+            plan.Vectorize(oc, { vectorSize, vectorUnits });
+        }
+    }
+
+    void ConvolveWinograd2D(Array input, Array weights, Array output)
+    {
+        const int inputChannels = (int)input.Shape()[0];
+        const int inputRows = (int)input.Shape()[1];
+        const int inputColumns = (int)input.Shape()[2];
+
+        const int outputChannels = (int)weights.Shape()[0];
+        ThrowIfNot(inputChannels == (int)weights.Shape()[1]);
+        ThrowIfNot(3 == (int)weights.Shape()[2] && 3 == (int)weights.Shape()[3], InputExceptionErrors::invalidArgument, "Winograd F(2x2,3x3) requires a 3x3 kernel");
+
+        const int outputRows = inputRows - 2;
+        const int outputColumns = inputColumns - 2;
+        ThrowIfNot(outputChannels == (int)output.Shape()[0]);
+        ThrowIfNot(outputRows == (int)output.Shape()[1]);
+        ThrowIfNot(outputColumns == (int)output.Shape()[2]);
+        ThrowIfNot(outputRows % 2 == 0 && outputColumns % 2 == 0, InputExceptionErrors::invalidArgument, "Winograd F(2x2,3x3) requires even output dimensions");
+
+        const int tileRows = outputRows / 2;
+        const int tileColumns = outputColumns / 2;
+        const int numTiles = tileRows * tileColumns;
+
+        auto elementType = input.GetType();
+        auto half = Cast(Scalar(0.5f), elementType);
+
+        // Transform-domain buffers, indexed by the 4x4 frequency position first so each
+        // frequency's slice is a dense channels-by-(channels or tiles) matrix for the GEMM core
+        auto U = MakeArray({ 4, 4, outputChannels, inputChannels }, elementType, "winogradFilter");
+        auto V = MakeArray({ 4, 4, inputChannels, numTiles }, elementType, "winogradInput");
+        auto M = MakeArray({ 4, 4, outputChannels, numTiles }, elementType, "winogradProduct");
+
+        // Filter transform: U(.,.,k,c) = G g G^T for each filter g
+        {
+            Nest nest(MemoryShape{ outputChannels, inputChannels });
+            auto k = nest.GetIndices()[0];
+            auto c = nest.GetIndices()[1];
+            nest.Set([&]() {
+                Scalar g[3][3];
+                for (int r = 0; r < 3; ++r)
+                {
+                    for (int s = 0; s < 3; ++s)
+                    {
+                        g[r][s] = weights(k, c, Scalar(r), Scalar(s));
+                    }
+                }
+
+                // t = G g, with G = [[1,0,0],[.5,.5,.5],[.5,-.5,.5],[0,0,1]]
+                Scalar t[4][3];
+                for (int s = 0; s < 3; ++s)
+                {
+                    t[0][s] = g[0][s];
+                    t[1][s] = half * (g[0][s] + g[1][s] + g[2][s]);
+                    t[2][s] = half * (g[0][s] - g[1][s] + g[2][s]);
+                    t[3][s] = g[2][s];
+                }
+                // u = t G^T: the same combination applied along rows
+                for (int r = 0; r < 4; ++r)
+                {
+                    U(Scalar(r), Scalar(0), k, c) = t[r][0];
+                    U(Scalar(r), Scalar(1), k, c) = half * (t[r][0] + t[r][1] + t[r][2]);
+                    U(Scalar(r), Scalar(2), k, c) = half * (t[r][0] - t[r][1] + t[r][2]);
+                    U(Scalar(r), Scalar(3), k, c) = t[r][2];
+                }
+            });
+            nest.CreateSchedule();
+        }
+
+        // Input transform: V(.,.,c,t) = B^T d B for each 4x4 input tile d
+        {
+            Nest nest(MemoryShape{ inputChannels, tileRows, tileColumns });
+            auto c = nest.GetIndices()[0];
+            auto tr = nest.GetIndices()[1];
+            auto tc = nest.GetIndices()[2];
+            nest.Set([&]() {
+                auto tileIndex = tr * tileColumns + tc;
+                auto rowBase = tr * 2;
+                auto columnBase = tc * 2;
+
+                Scalar d[4][4];
+                for (int r = 0; r < 4; ++r)
+                {
+                    for (int s = 0; s < 4; ++s)
+                    {
+                        d[r][s] = input(c, rowBase + r, columnBase + s);
+                    }
+                }
+
+                // t = B^T d, with B^T = [[1,0,-1,0],[0,1,1,0],[0,-1,1,0],[0,1,0,-1]]
+                Scalar t[4][4];
+                for (int s = 0; s < 4; ++s)
+                {
+                    t[0][s] = d[0][s] - d[2][s];
+                    t[1][s] = d[1][s] + d[2][s];
+                    t[2][s] = d[2][s] - d[1][s];
+                    t[3][s] = d[1][s] - d[3][s];
+                }
+                // v = t B: the same combination applied along rows
+                for (int r = 0; r < 4; ++r)
+                {
+                    V(Scalar(r), Scalar(0), c, tileIndex) = t[r][0] - t[r][2];
+                    V(Scalar(r), Scalar(1), c, tileIndex) = t[r][1] + t[r][2];
+                    V(Scalar(r), Scalar(2), c, tileIndex) = t[r][2] - t[r][1];
+                    V(Scalar(r), Scalar(3), c, tileIndex) = t[r][1] - t[r][3];
+                }
+            });
+            nest.CreateSchedule();
+        }
+
+        // Batched small-GEMM core: one channels-by-tiles matmul per frequency position
+        for (int xi = 0; xi < 4; ++xi)
+        {
+            for (int nu = 0; nu < 4; ++nu)
+            {
+                auto uSlice = U.Slice({ 0, 1 }, { Scalar(xi), Scalar(nu) });
+                auto vSlice = V.Slice({ 0, 1 }, { Scalar(xi), Scalar(nu) });
+                auto mSlice = M.Slice({ 0, 1 }, { Scalar(xi), Scalar(nu) });
+                MatMulMlas(uSlice, vSlice, mSlice);
+            }
+        }
+
+        // Output transform: Y = A^T m A for each tile, with A^T = [[1,1,1,0],[0,1,-1,-1]]
+        {
+            Nest nest(MemoryShape{ outputChannels, tileRows, tileColumns });
+            auto k = nest.GetIndices()[0];
+            auto tr = nest.GetIndices()[1];
+            auto tc = nest.GetIndices()[2];
+            nest.Set([&]() {
+                auto tileIndex = tr * tileColumns + tc;
+                auto rowBase = tr * 2;
+                auto columnBase = tc * 2;
+
+                Scalar m[4][4];
+                for (int r = 0; r < 4; ++r)
+                {
+                    for (int s = 0; s < 4; ++s)
+                    {
+                        m[r][s] = M(Scalar(r), Scalar(s), k, tileIndex);
+                    }
+                }
+
+                Scalar t[2][4];
+                for (int s = 0; s < 4; ++s)
+                {
+                    t[0][s] = m[0][s] + m[1][s] + m[2][s];
+                    t[1][s] = m[1][s] - m[2][s] - m[3][s];
+                }
+                for (int r = 0; r < 2; ++r)
+                {
+                    output(k, rowBase + r, columnBase) = t[r][0] + t[r][1] + t[r][2];
+                    output(k, rowBase + r, columnBase + 1) = t[r][1] - t[r][2] - t[r][3];
+                }
+            });
+            nest.CreateSchedule();
+        }
+    }
+
 } // namespace value
 } // namespace accera
@@ -190,17 +190,17 @@ namespace value
     Value::Value(Emittable data, std::optional<MemoryLayout> layout) :
         _data(data),
         _type(GetContext().GetType(data)),
-        _layout(layout)
+        _layout(std::move(layout))
     {}
 
     Value::Value(ValueType type, std::optional<MemoryLayout> layout, int pointerLevel) :
         _type({ type, pointerLevel }),
-        _layout(layout)
+        _layout(std::move(layout))
     {}
 
     Value::Value(detail::ValueTypeDescription typeDescription, std::optional<MemoryLayout> layout) noexcept :
         _type(typeDescription),
-        _layout(layout)
+        _layout(std::move(layout))
     {}
 
     void Value::Reset()
@@ -377,7 +377,7 @@ namespace value
         return _type.first;
     }
 
-    void Value::SetLayout(MemoryLayout layout)
+    void Value::SetLayout(const MemoryLayout& layout)
     {
         GetContext().SetLayout(*this, layout);
     }
@@ -8,6 +8,7 @@
 #include "EmitterContext.h"
 #include "FunctionDeclaration.h"
 #include "Scalar.h"
+#include "ValueOperations.h"
 #include "Vector.h"
 
 namespace accera
@@ -56,6 +57,41 @@ namespace value
         return GetContext().Max(input);
     }
 
+    void Int8DotProductAccumulate(Vector a, Vector b, Vector accumulate)
+    {
+        constexpr int groupSize = 4;
+        if (a.Size() != b.Size() || a.Size() != groupSize * accumulate.Size())
+        {
+            throw InputException(InputExceptionErrors::sizeMismatch);
+        }
+        if ((a.GetType() != ValueType::Int8 && a.GetType() != ValueType::Byte) ||
+            (b.GetType() != ValueType::Int8 && b.GetType() != ValueType::Byte))
+        {
+            throw InputException(InputExceptionErrors::typeMismatch);
+        }
+        if (accumulate.GetType() != ValueType::Int32)
+        {
+            throw InputException(InputExceptionErrors::typeMismatch);
+        }
+
+        For(accumulate, [&](Scalar group) {
+            auto base = group * groupSize;
+
+            // Widen each operand before multiplying, then sum the group as (p0 + p1) + (p2 + p3).
+            // The pairwise tree matters: it is what the backend pattern-matches into the
+            // two-instruction multiply-add sequences, while a linear accumulation chain
+            // defeats the match
+            std::vector<Scalar> products;
+            products.reserve(groupSize);
+            for (int j = 0; j < groupSize; ++j)
+            {
+                auto element = base + j;
+                products.push_back(Cast(a[element], ValueType::Int32) * Cast(b[element], ValueType::Int32));
+            }
+            accumulate[group] += (products[0] + products[1]) + (products[2] + products[3]);
+        });
+    }
+
     void For(Vector v, std::function<void(Scalar)> fn)
     {
         For(std::string{}, v, fn);
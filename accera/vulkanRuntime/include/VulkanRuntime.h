@@ -42,6 +42,10 @@ struct VulkanDeviceMemoryBuffer
     VkDeviceMemory hostMemory{ VK_NULL_HANDLE };
     VkBuffer deviceBuffer{ VK_NULL_HANDLE };
     VkDeviceMemory deviceMemory{ VK_NULL_HANDLE };
+    /// Byte offsets of this buffer within the pooled host-visible and
+    /// device-local allocations; hostMemory/deviceMemory alias the pools.
+    VkDeviceSize hostMemoryOffset{ 0 };
+    VkDeviceSize deviceMemoryOffset{ 0 };
     uint32_t bufferSize{ 0 };
 };
 
@@ -63,6 +67,15 @@ struct NumWorkGroups
     uint32_t z{ 1 };
 };
 
+/// A SPIR-V specialization constant value, identified by its SpecId decoration.
+/// Tile/block dimensions emitted as specialization constants can be retuned by
+/// respecializing the pipeline instead of rebuilding the shader module.
+struct SpecializationConstant
+{
+    uint32_t id{ 0 };
+    uint32_t value{ 0 };
+};
+
 /// Struct containing information regarding a descriptor set.
 struct DescriptorSetInfo
 {
@@ -124,6 +137,26 @@ public:
     /// Sets timing utility data
     void setRepeatedRunCharacteristics(bool printTimings, uint32_t warmupCount, uint32_t runCount);
 
+    /// Sets the number of copies of the dispatch submitted concurrently to
+    /// distinct compute queues each run; clamped to the number of queues the
+    /// compute queue family provides.
+    void setConcurrentDispatchCount(uint32_t count);
+
+    /// Sets the number of back-to-back dispatches recorded into each command
+    /// buffer so a single queue submission serves that many logical launches.
+    void setLaunchBatchSize(uint32_t size);
+
+    /// Sets the specialization constant values applied when the compute
+    /// pipeline is (re)created. Changing only these values between runs reuses
+    /// the shader module, descriptor sets and memory buffers and rebuilds just
+    /// the pipeline and command buffers.
+    void setSpecializationConstants(const std::vector<SpecializationConstant>& constants);
+
+    /// Sets the path of a JSON file that run() fills with the per-iteration
+    /// timing samples and summary statistics. An empty path (the default)
+    /// disables the report.
+    void setTimingOutputFile(const char* path);
+
     /// Runtime initialization.
     LogicalResult initRuntime();
 
@@ -155,12 +188,34 @@ private:
     LogicalResult setWriteDescriptors();
     LogicalResult createCommandPool();
     LogicalResult createQueryPool();
-    LogicalResult createComputeCommandBuffer();
-    LogicalResult submitCommandBuffersToQueue();
+    LogicalResult createComputeCommandBuffer(bool writeTimestamps);
+    // Submit one command buffer per active queue / wait for them all to drain.
+    LogicalResult submitCommandBuffersToQueues();
+    LogicalResult waitForQueues();
     // Copy resources from host (staging buffer) to device buffer or from device
     // buffer to host buffer.
     LogicalResult copyResource(bool deviceToHost);
 
+    //===--------------------------------------------------------------------===//
+    // Dispatch-state caching across run() invocations.
+    //===--------------------------------------------------------------------===//
+
+    /// Computes a key covering everything the cached dispatch state depends on:
+    /// the shader module, entry point, workgroup counts and resource shapes.
+    size_t computeDispatchKey() const;
+    /// Computes a key over just the specialization constant values, which only
+    /// the pipeline and command buffers depend on.
+    size_t computeSpecializationKey() const;
+    /// Rebuilds the pipeline and command buffers against the existing shader
+    /// module, descriptor sets and memory buffers after the specialization
+    /// constants changed.
+    LogicalResult respecializePipeline();
+    /// Refreshes the existing staging buffers with the current host data.
+    LogicalResult updateDeviceMemoryBuffers();
+    /// Destroys the cached pipeline, descriptor sets, command buffers and
+    /// memory buffers.
+    LogicalResult releaseDispatchResources();
+
     //===--------------------------------------------------------------------===//
     // Helper methods.
     //===--------------------------------------------------------------------===//
@@ -186,6 +241,11 @@ private:
     VkDevice device{ VK_NULL_HANDLE };
     VkQueue queue{ VK_NULL_HANDLE };
 
+    /// All compute queues created from the selected queue family; queues[0] is
+    /// the primary queue used for resource copies and single-queue dispatch.
+    std::vector<VkQueue> queues;
+    uint32_t availableQueueCount{ 1 };
+
     /// Specifies VulkanDeviceMemoryBuffers divided into sets.
     std::unordered_map<DescriptorSetIndex, std::vector<VulkanDeviceMemoryBuffer>>
         deviceMemoryBufferMap;
@@ -193,6 +253,10 @@ private:
     /// Specifies shader module.
     VkShaderModule shaderModule{ VK_NULL_HANDLE };
 
+    /// Bumped whenever a new shader module is created, so cached pipelines
+    /// built against the previous module are rebuilt.
+    uint64_t shaderModuleGeneration{ 0 };
+
     /// Specifies layout bindings.
     std::unordered_map<DescriptorSetIndex,
                        std::vector<VkDescriptorSetLayoutBinding>>
@@ -220,6 +284,11 @@ private:
     VkCommandPool commandPool{ VK_NULL_HANDLE };
     std::vector<VkCommandBuffer> commandBuffers;
 
+    /// Resource-copy command buffers, recorded once per cached dispatch state
+    /// and resubmitted on subsequent launches.
+    VkCommandBuffer hostToDeviceCopyCommandBuffer{ VK_NULL_HANDLE };
+    VkCommandBuffer deviceToHostCopyCommandBuffer{ VK_NULL_HANDLE };
+
     //===--------------------------------------------------------------------===//
     // Vulkan memory context.
     //===--------------------------------------------------------------------===//
@@ -230,6 +299,12 @@ private:
     uint32_t deviceMemoryTypeIndex{ VK_MAX_MEMORY_TYPES };
     VkDeviceSize memorySize{ 0 };
 
+    /// Single host-visible and device-local allocations backing every buffer
+    /// of the current dispatch; individual buffers are sub-allocated at
+    /// aligned offsets instead of getting a vkAllocateMemory each.
+    VkDeviceMemory hostMemoryPool{ VK_NULL_HANDLE };
+    VkDeviceMemory deviceMemoryPool{ VK_NULL_HANDLE };
+
     //===--------------------------------------------------------------------===//
     // Vulkan execution context.
     //===--------------------------------------------------------------------===//
@@ -253,5 +328,34 @@ private:
     bool shouldPrintTimings{ false };
     uint32_t timingWarmupCount{ 0 };
     uint32_t timingRunCount{ 1 };
+
+    /// When non-empty, run() writes a JSON timing report to this path.
+    std::string timingOutputPath;
+
+    /// Requested and effective (clamped to availableQueueCount) number of
+    /// concurrent dispatches per run.
+    uint32_t concurrentDispatchCount{ 1 };
+    uint32_t activeDispatchCount{ 1 };
+
+    /// Number of dispatches recorded per command buffer; timing results are
+    /// normalized by this to report per-launch figures.
+    uint32_t launchBatchSize{ 1 };
+
+    //===--------------------------------------------------------------------===//
+    // Dispatch-state cache.
+    //===--------------------------------------------------------------------===//
+
+    /// The pipeline, descriptor sets and compute command buffers only depend on
+    /// the shader module, entry point, workgroup counts and resource shapes, so
+    /// repeated launches with an unchanged signature reuse them and only pay
+    /// for buffer upload and queue submission.
+    bool hasCachedDispatch{ false };
+    size_t cachedDispatchKey{ 0 };
+
+    /// Specialization constant values baked into the current pipeline; tracked
+    /// separately from the dispatch key so a value change respecializes the
+    /// pipeline without tearing down the rest of the dispatch state.
+    std::vector<SpecializationConstant> specializationConstants;
+    size_t cachedSpecializationKey{ 0 };
 };
 #endif
@@ -62,6 +62,30 @@ public:
         vulkanRuntime.setRepeatedRunCharacteristics(printTimings == 1, warmupCount, runCount);
     }
 
+    void setConcurrentDispatchCount(uint32_t count)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        vulkanRuntime.setConcurrentDispatchCount(count);
+    }
+
+    void setLaunchBatchSize(uint32_t size)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        vulkanRuntime.setLaunchBatchSize(size);
+    }
+
+    void setSpecializationConstants(const std::vector<SpecializationConstant>& constants)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        vulkanRuntime.setSpecializationConstants(constants);
+    }
+
+    void setTimingOutputFile(const char* path)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        vulkanRuntime.setTimingOutputFile(path);
+    }
+
     void setResourceData(DescriptorSetIndex setIndex, BindingIndex bindIndex, const VulkanHostMemoryBuffer& memBuffer)
     {
         std::lock_guard<std::mutex> lock(mutex);
@@ -168,6 +192,44 @@ void setRepeatedRunCharacteristics(void* vkRuntimeManager, uint32_t printTimings
     reinterpret_cast<VulkanRuntimeManager*>(vkRuntimeManager)
         ->setRepeatedRunCharacteristics(printTimings, warmupCount, runCount);
 }
+
+VULKAN_WRAPPER_SYMBOL_EXPORT
+void setConcurrentDispatchCount(void* vkRuntimeManager, uint32_t count)
+{
+    reinterpret_cast<VulkanRuntimeManager*>(vkRuntimeManager)
+        ->setConcurrentDispatchCount(count);
+}
+
+VULKAN_WRAPPER_SYMBOL_EXPORT
+void setLaunchBatchSize(void* vkRuntimeManager, uint32_t size)
+{
+    reinterpret_cast<VulkanRuntimeManager*>(vkRuntimeManager)
+        ->setLaunchBatchSize(size);
+}
+
+/// Sets the specialization constant values (as parallel id/value arrays) baked
+/// into the compute pipeline; changing only these between runs respecializes
+/// the cached pipeline instead of rebuilding the dispatch state.
+VULKAN_WRAPPER_SYMBOL_EXPORT
+void setSpecializationConstants(void* vkRuntimeManager, uint32_t* ids, uint32_t* values, uint32_t count)
+{
+    std::vector<SpecializationConstant> constants(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        constants[i] = { ids[i], values[i] };
+    }
+    reinterpret_cast<VulkanRuntimeManager*>(vkRuntimeManager)
+        ->setSpecializationConstants(constants);
+}
+
+/// Sets the path of the JSON timing report written after the timed runs; an
+/// empty path disables it.
+VULKAN_WRAPPER_SYMBOL_EXPORT
+void setTimingOutputFile(void* vkRuntimeManager, const char* path)
+{
+    reinterpret_cast<VulkanRuntimeManager*>(vkRuntimeManager)
+        ->setTimingOutputFile(path);
+}
 /// Binds the given memref to the given descriptor set and descriptor
 /// index.
 #define DECLARE_BIND_MEMREF(size, type, typeName)                                                                       \
@@ -0,0 +1,373 @@
+#!/usr/bin/env python3
+####################################################################################################
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License. See LICENSE in the project root for license information.
+####################################################################################################
+#
+# Compile-throughput benchmark for the Accera toolchain itself.
+#
+# Builds a representative corpus of packages -- GEMMs at several sizes, a direct convolution, a
+# fused-schedule stressor, a wide variant family, and the prototype kernels under kernels/ when
+# they can be built -- through the full pipeline, and reports wall-clock time per phase:
+#
+#   emit       DSL -> MLIR (python layer, module construction, MLIR serialization)
+#   lower      acc-opt (nest lowering, exec-plan lowering and value-to-LLVM-dialect in one run)
+#   translate  mlir-translate (LLVM dialect -> LLVM IR)
+#   llvm_opt   opt
+#   object     llc and archiving
+#
+# Like regression_gate.py, baselines are absolute times and therefore per machine: record one on
+# the mainline build of the CI runner with --save-baseline, check the gate in, and compare
+# candidate builds against it with --baseline. A `compile-benchmarks` build target runs this
+# script against the baseline checked in next to it when one exists.
+#
+# Examples:
+#   compile_benchmark.py --output-dir /tmp/cb --save-baseline compile_benchmark_baseline.json
+#   compile_benchmark.py --output-dir /tmp/cb --baseline compile_benchmark_baseline.json --threshold 20
+#   compile_benchmark.py --output-dir /tmp/cb --cases gemm_256 conv_resnet   # quick local run
+
+import argparse
+import functools
+import importlib.util
+import json
+import os
+import platform
+import sys
+import time
+
+from accera import Array, Nest, Package, ScalarType, Target, fuse
+from accera import accc
+
+PIPELINE_PHASES = ['lower', 'translate', 'llvm_opt', 'object']
+ALL_PHASES = ['emit'] + PIPELINE_PHASES + ['other', 'total']
+
+# Phases below this many seconds are compared only in the total: their relative
+# variance is dominated by process startup noise
+MIN_GATED_PHASE_SECONDS = 0.05
+
+
+class PhaseTimer:
+    """Times the stages of one Package.build call.
+
+    Package.build drives the pipeline through accc.AcceraProject, whose stage methods are the
+    natural phase boundaries. While installed, this wraps those methods with timers; everything
+    between the start of build() and the first pipeline stage is the emission phase (module
+    construction and MLIR serialization), and whatever build() does after the last stage
+    (HAT packaging, linking) is reported as 'other'.
+    """
+    def __init__(self):
+        self.phases = {}
+        self._build_start = None
+        self._pipeline_start = None
+        self._originals = {}
+
+    def _wrap(self, phase, original):
+        @functools.wraps(original)
+        def timed(*args, **kwargs):
+            if self._pipeline_start is None:
+                self._pipeline_start = time.perf_counter()
+                self.phases['emit'] = self._pipeline_start - self._build_start
+            start = time.perf_counter()
+            result = original(*args, **kwargs)
+            self.phases[phase] = self.phases.get(phase, 0.0) + (time.perf_counter() - start)
+            return result
+
+        return timed
+
+    def __enter__(self):
+        stage_methods = {
+            'lower': 'lower_mlir',
+            'translate': 'translate_mlir_with_mlir_translate',
+            'llvm_opt': 'optimize_llvm',
+            'object': 'generate_object',
+        }
+        for phase, method_name in stage_methods.items():
+            self._originals[method_name] = getattr(accc.AcceraProject, method_name)
+            setattr(accc.AcceraProject, method_name, self._wrap(phase, self._originals[method_name]))
+        self._build_start = time.perf_counter()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        total = time.perf_counter() - self._build_start
+        for method_name, original in self._originals.items():
+            setattr(accc.AcceraProject, method_name, original)
+        if exc_type is None:
+            self.phases['total'] = total
+            accounted = sum(self.phases.get(phase, 0.0) for phase in ['emit'] + PIPELINE_PHASES)
+            self.phases['other'] = max(total - accounted, 0.0)
+        return False
+
+
+def make_gemm_package(M, N, K):
+    """One tiled, unrolled and vectorized GEMM: the bread-and-butter lowering workload."""
+    A = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(M, K))
+    B = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(K, N))
+    C = Array(role=Array.Role.INPUT_OUTPUT, element_type=ScalarType.float32, shape=(M, N))
+
+    nest = Nest(shape=(M, N, K))
+    i, j, k = nest.get_indices()
+
+    @nest.iteration_logic
+    def _():
+        C[i, j] += A[i, k] * B[k, j]
+
+    schedule = nest.create_schedule()
+    ii, jj, kk = schedule.tile({
+        i: min(6, M),
+        j: min(16, N),
+        k: min(128, K)
+    })
+    schedule.reorder(i, j, k, kk, ii, jj)
+
+    plan = schedule.create_plan()
+    plan.unroll(ii)
+    plan.vectorize(jj)
+
+    package = Package()
+    package.add(plan, args=(A, B, C), base_name=f"gemm_{M}_{N}_{K}")
+    return package
+
+
+def make_conv_package(batch, in_channels, out_channels, rows, cols, kernel_size):
+    """Direct NCHW convolution: a deeper nest than GEMM, stressing nest lowering."""
+    Input = Array(
+        role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(batch, in_channels, rows, cols)
+    )
+    Kernel = Array(
+        role=Array.Role.INPUT,
+        element_type=ScalarType.float32,
+        shape=(out_channels, in_channels, kernel_size, kernel_size)
+    )
+    out_rows = rows - kernel_size + 1
+    out_cols = cols - kernel_size + 1
+    Output = Array(
+        role=Array.Role.INPUT_OUTPUT, element_type=ScalarType.float32, shape=(batch, out_channels, out_rows, out_cols)
+    )
+
+    nest = Nest(shape=(batch, out_channels, in_channels, out_rows, out_cols, kernel_size, kernel_size))
+    n, co, ci, r, c, kr, kc = nest.get_indices()
+
+    @nest.iteration_logic
+    def _():
+        Output[n, co, r, c] += Input[n, ci, r + kr, c + kc] * Kernel[co, ci, kr, kc]
+
+    schedule = nest.create_schedule()
+    cc = schedule.split(c, min(8, out_cols))
+
+    plan = schedule.create_plan()
+    plan.vectorize(cc)
+
+    package = Package()
+    package.add(plan, args=(Input, Kernel, Output), base_name=f"conv_{out_channels}_{in_channels}_{kernel_size}")
+    return package
+
+
+def make_fused_package(M, N):
+    """Partially fused elementwise chain: exercises the fusion lowering paths."""
+    A = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(M, N))
+    B = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(M, N))
+    C = Array(role=Array.Role.INPUT_OUTPUT, element_type=ScalarType.float32, shape=(M, N))
+
+    add_nest = Nest(shape=(M, N))
+    ai, aj = add_nest.get_indices()
+
+    @add_nest.iteration_logic
+    def _():
+        C[ai, aj] = A[ai, aj] + B[ai, aj]
+
+    scale_nest = Nest(shape=(M, N))
+    si, sj = scale_nest.get_indices()
+
+    @scale_nest.iteration_logic
+    def _():
+        C[si, sj] *= 0.2
+
+    fused = fuse(add_nest.create_schedule(), scale_nest.create_schedule())
+    f, i, j = fused.get_indices()
+    jj = fused.split(j, min(16, N))
+    fused.reorder(i, j, f, jj)
+
+    package = Package()
+    package.add(fused.create_plan(), args=(A, B, C), base_name=f"fused_add_scale_{M}_{N}")
+    return package
+
+
+def make_variant_family_package(count):
+    """Many small GEMM variants in one package: stresses per-function emission and module size."""
+    package = Package()
+    for variant in range(count):
+        size = 32 + 16 * variant
+        A = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(size, size))
+        B = Array(role=Array.Role.INPUT, element_type=ScalarType.float32, shape=(size, size))
+        C = Array(role=Array.Role.INPUT_OUTPUT, element_type=ScalarType.float32, shape=(size, size))
+
+        nest = Nest(shape=(size, size, size))
+        i, j, k = nest.get_indices()
+
+        @nest.iteration_logic
+        def _():
+            C[i, j] += A[i, k] * B[k, j]
+
+        schedule = nest.create_schedule()
+        jj = schedule.split(j, 16)
+        plan = schedule.create_plan()
+        plan.vectorize(jj)
+        package.add(plan, args=(A, B, C), base_name=f"gemm_variant_{size}")
+    return package
+
+
+def load_kernel_packages(kernels_dir):
+    """Imports the prototype kernels under kernels/ and collects the packages their generate()
+    entry points return. The prototypes target future runtime-sized features, so any that fail to
+    import or generate are reported and skipped rather than failing the benchmark."""
+    cases = {}
+    if not os.path.isdir(kernels_dir):
+        return cases
+    for dirpath, _, filenames in os.walk(kernels_dir):
+        for filename in sorted(filenames):
+            if not filename.endswith('.py'):
+                continue
+            module_path = os.path.join(dirpath, filename)
+            module_name = f"kernels_{os.path.basename(dirpath)}_{filename[:-3]}"
+            try:
+                spec = importlib.util.spec_from_file_location(module_name, module_path)
+                module = importlib.util.module_from_spec(spec)
+                spec.loader.exec_module(module)
+                generate = getattr(module, 'generate', None)
+                if generate is None:
+                    continue
+                package = generate()
+                if isinstance(package, Package):
+                    cases[f"kernel_{os.path.basename(dirpath)}"] = package
+            except Exception as e:    # prototype kernels are allowed to be ahead of the compiler
+                print(f"skipping {os.path.relpath(module_path, kernels_dir)}: {e}")
+    return cases
+
+
+def build_corpus(kernels_dir):
+    """The corpus, ordered small to large so a broken toolchain fails fast."""
+    cases = {
+        'gemm_64': lambda: make_gemm_package(64, 64, 64),
+        'gemm_256': lambda: make_gemm_package(256, 256, 256),
+        'gemm_1024': lambda: make_gemm_package(1024, 1024, 1024),
+        'conv_resnet': lambda: make_conv_package(1, 64, 64, 56, 56, 3),
+        'fused_add_scale': lambda: make_fused_package(256, 256),
+        'variant_family_16': lambda: make_variant_family_package(16),
+    }
+    corpus = {name: make() for name, make in cases.items()}
+    corpus.update(load_kernel_packages(kernels_dir))
+    return corpus
+
+
+def run_case(name, package, output_dir, repeats):
+    """Builds one package `repeats` times and keeps the fastest time per phase."""
+    best = None
+    for repeat in range(repeats):
+        case_dir = os.path.join(output_dir, name if repeats == 1 else f"{name}_{repeat}")
+        os.makedirs(case_dir, exist_ok=True)
+        with PhaseTimer() as timer:
+            package.build(name, format=Package.Format.HAT_STATIC, output_dir=case_dir)
+        if best is None:
+            best = dict(timer.phases)
+        else:
+            for phase, seconds in timer.phases.items():
+                best[phase] = min(best.get(phase, seconds), seconds)
+    return best
+
+
+def compare(candidate, baseline, threshold):
+    """Compares per-case phase times against the baseline, returning (rows, any_regression).
+
+    A case regresses when its total build time exceeds the baseline by more than the threshold,
+    or when any individual phase above the gating floor does; the phase breakdown is what turns
+    "compilation got slower" into "the opt phase got slower".
+    """
+    rows = []
+    failed = False
+    for case, phases in sorted(candidate.items()):
+        baseline_phases = baseline.get(case)
+        if baseline_phases is None:
+            rows.append((case, '(no baseline)', None, None, 'new'))
+            continue
+        for phase in ALL_PHASES:
+            if phase not in phases or phase not in baseline_phases:
+                continue
+            before = baseline_phases[phase]
+            after = phases[phase]
+            gated = phase == 'total' or max(before, after) >= MIN_GATED_PHASE_SECONDS
+            delta = (after - before) / before * 100 if before > 0 else 0.0
+            regressed = gated and delta > threshold
+            failed = failed or regressed
+            rows.append((f"{case}.{phase}", before, after, delta, 'REGRESSED' if regressed else ('ok' if gated else 'noise')))
+    return rows, failed
+
+
+def machine_description():
+    return {
+        'node': platform.node(),
+        'platform': platform.platform(),
+        'processor': platform.processor(),
+        'recorded': time.strftime('%Y-%m-%d %H:%M:%S'),
+    }
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Benchmarks Accera's own compile throughput over a fixed corpus")
+    parser.add_argument('--output-dir', required=True, help='scratch directory for the built packages')
+    parser.add_argument('--kernels-dir', default=os.path.join(os.path.dirname(__file__), '..', '..', 'kernels'),
+                        help='directory of prototype kernels to include in the corpus')
+    parser.add_argument('--cases', nargs='*', help='run only these corpus cases')
+    parser.add_argument('--repeats', type=int, default=1, help='builds per case; the fastest is kept')
+    parser.add_argument('--baseline', help='baseline JSON to gate against')
+    parser.add_argument('--save-baseline', help='write the measured times as a new baseline JSON')
+    parser.add_argument('--save-results', help='write the measured times as JSON without making them a baseline')
+    parser.add_argument('--threshold', type=float, default=20.0, help='regression threshold in percent (default 20)')
+    args = parser.parse_args(argv)
+
+    corpus = build_corpus(os.path.abspath(args.kernels_dir))
+    if args.cases:
+        missing = set(args.cases) - set(corpus)
+        if missing:
+            parser.error(f"unknown cases: {sorted(missing)} (corpus: {sorted(corpus)})")
+        corpus = {name: corpus[name] for name in args.cases}
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    results = {}
+    for name, package in corpus.items():
+        print(f"building {name} ...")
+        results[name] = run_case(name, package, args.output_dir, args.repeats)
+
+    phase_columns = ' '.join(f"{phase:>10}" for phase in ALL_PHASES)
+    print(f"\n{'case':<24} {phase_columns}   (seconds)")
+    for name, phases in sorted(results.items()):
+        row = ' '.join(f"{phases.get(phase, 0.0):>10.3f}" for phase in ALL_PHASES)
+        print(f"{name:<24} {row}")
+
+    for save_path in filter(None, [args.save_baseline, args.save_results]):
+        with open(save_path, 'w') as f:
+            json.dump({'machine': machine_description(), 'cases': results}, f, indent=2)
+        print(f"\nWrote results to {save_path}")
+
+    if args.baseline:
+        if not os.path.exists(args.baseline):
+            print(f"\nNo baseline at {args.baseline}: record one on this machine with --save-baseline")
+            return 0
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        print(f"\nComparing against baseline recorded on {baseline.get('machine', {}).get('node', '(unknown)')}")
+        rows, failed = compare(results, baseline['cases'], args.threshold)
+        print(f"{'case.phase':<36} {'baseline_s':>11} {'candidate_s':>12} {'delta_%':>8} status")
+        for label, before, after, delta, status in rows:
+            if delta is None:
+                print(f"{label:<36} {before:>11} {'':>12} {'':>8} {status}")
+            else:
+                print(f"{label:<36} {before:>11.3f} {after:>12.3f} {delta:>8.2f} {status}")
+        if failed:
+            print(f"FAIL: compile-time regression above {args.threshold}%")
+            return 1
+        print('pass')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,296 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <HATLoader.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#define ASSERT_NON_ZERO(X)                             \
+    do                                                 \
+    {                                                  \
+        if ((X) <= 0)                                  \
+        {                                              \
+            printf("error: " #X " = %d <= 0!\n", (X)); \
+            exit(-1);                                  \
+        }                                              \
+    } while (false)
+
+using accera::runtime::HATElementType;
+using accera::runtime::HATFunctionInfo;
+using accera::runtime::HATPackage;
+
+size_t element_size(HATElementType type)
+{
+    switch (type)
+    {
+    case HATElementType::i1:
+    case HATElementType::i8:
+        return 1;
+    case HATElementType::f16:
+    case HATElementType::bf16:
+    case HATElementType::i16:
+        return 2;
+    case HATElementType::f32:
+    case HATElementType::i32:
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+void* aligned_alloc_64(size_t bytes)
+{
+    // The emitted kernels assume vector-width alignment; 64 covers every target up to avx512
+    void* p = nullptr;
+    if (posix_memalign(&p, 64, (bytes + 63) & ~size_t(63)) != 0)
+    {
+        printf("error: allocation of %zu bytes failed\n", bytes);
+        exit(-1);
+    }
+    return p;
+}
+
+void fill_random(void* buffer, size_t elements, HATElementType type, std::mt19937& gen)
+{
+    // Small values in a fixed-seed distribution: deterministic across runs, and no
+    // denormals/overflow distorting the timing
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    switch (type)
+    {
+    case HATElementType::f32:
+        for (size_t i = 0; i < elements; ++i)
+            static_cast<float*>(buffer)[i] = dist(gen);
+        break;
+    case HATElementType::f64:
+        for (size_t i = 0; i < elements; ++i)
+            static_cast<double*>(buffer)[i] = dist(gen);
+        break;
+    default:
+        for (size_t i = 0; i < elements * element_size(type); ++i)
+            static_cast<uint8_t*>(buffer)[i] = static_cast<uint8_t>(gen() & 0x7);
+        break;
+    }
+}
+
+// The raw-pointer API takes exactly one pointer per shaped argument, so a generic call only
+// needs dispatch on arity
+bool call_raw(void* address, const std::vector<void*>& args)
+{
+    auto a = [&](size_t i) { return args[i]; };
+    switch (args.size())
+    {
+    case 1:
+        reinterpret_cast<void (*)(void*)>(address)(a(0));
+        return true;
+    case 2:
+        reinterpret_cast<void (*)(void*, void*)>(address)(a(0), a(1));
+        return true;
+    case 3:
+        reinterpret_cast<void (*)(void*, void*, void*)>(address)(a(0), a(1), a(2));
+        return true;
+    case 4:
+        reinterpret_cast<void (*)(void*, void*, void*, void*)>(address)(a(0), a(1), a(2), a(3));
+        return true;
+    case 5:
+        reinterpret_cast<void (*)(void*, void*, void*, void*, void*)>(address)(a(0), a(1), a(2), a(3), a(4));
+        return true;
+    case 6:
+        reinterpret_cast<void (*)(void*, void*, void*, void*, void*, void*)>(address)(a(0), a(1), a(2), a(3), a(4), a(5));
+        return true;
+    case 7:
+        reinterpret_cast<void (*)(void*, void*, void*, void*, void*, void*, void*)>(address)(a(0), a(1), a(2), a(3), a(4), a(5), a(6));
+        return true;
+    case 8:
+        reinterpret_cast<void (*)(void*, void*, void*, void*, void*, void*, void*, void*)>(address)(a(0), a(1), a(2), a(3), a(4), a(5), a(6), a(7));
+        return true;
+    default:
+        return false;
+    }
+}
+
+void pin_thread(int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+    {
+        printf("warning: failed to pin to cpu %d; timings will be noisier\n", cpu);
+    }
+#else
+    (void)cpu;
+    printf("warning: thread pinning not supported on this platform\n");
+#endif
+}
+
+double now_ms()
+{
+    auto t = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double, std::milli>(t).count();
+}
+
+void flush_caches(std::vector<uint8_t>& flushBuffer)
+{
+    // A strided write walk over a buffer much larger than LLC evicts the working set, so each
+    // measured iteration starts cold
+    for (size_t i = 0; i < flushBuffer.size(); i += 64)
+    {
+        flushBuffer[i] += 1;
+    }
+}
+
+void print_help(const char* progName)
+{
+    printf("usage: %s <metadata.hat.bin> <library> <function> [options]\n", progName);
+    printf("options:\n");
+    printf("  --m/--n/--k N   GEMM shape, for the GFLOPs column (2*m*n*k flops per call)\n");
+    printf("  --warmup N      warmup iterations (default 10)\n");
+    printf("  --iters N       measured iterations (default 100)\n");
+    printf("  --flush         flush caches between measured iterations (cold-cache numbers)\n");
+    printf("  --cpu N         pin the calling thread to this cpu (default 0, -1 to disable)\n");
+    printf("output: function,m,n,k,iters,min_ms,median_ms,p99_ms,gflops\n");
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        print_help(argv[0]);
+        return 0;
+    }
+
+    std::string metadataPath = argv[1];
+    std::string libraryPath = argv[2];
+    std::string functionName = argv[3];
+
+    int m = 0, n = 0, k = 0;
+    int warmup = 10;
+    int iters = 100;
+    bool flush = false;
+    int cpu = 0;
+    for (int i = 4; i < argc; ++i)
+    {
+        auto next = [&]() { return (i + 1 < argc) ? atoi(argv[++i]) : 0; };
+        if (!strcmp(argv[i], "--m"))
+            m = next();
+        else if (!strcmp(argv[i], "--n"))
+            n = next();
+        else if (!strcmp(argv[i], "--k"))
+            k = next();
+        else if (!strcmp(argv[i], "--warmup"))
+            warmup = next();
+        else if (!strcmp(argv[i], "--iters"))
+            iters = next();
+        else if (!strcmp(argv[i], "--flush"))
+            flush = true;
+        else if (!strcmp(argv[i], "--cpu"))
+            cpu = next();
+        else
+        {
+            printf("unknown option: %s\n", argv[i]);
+            print_help(argv[0]);
+            return -1;
+        }
+    }
+    ASSERT_NON_ZERO(iters);
+
+    if (cpu >= 0)
+    {
+        pin_thread(cpu);
+    }
+
+    HATPackage package;
+    try
+    {
+        package = HATPackage::Open(metadataPath, libraryPath);
+    }
+    catch (const std::exception& e)
+    {
+        printf("error: %s\n", e.what());
+        return -1;
+    }
+
+    const HATFunctionInfo* info = package.FindFunction(functionName);
+    if (!info)
+    {
+        printf("error: function '%s' not found; package contains:\n", functionName.c_str());
+        for (const auto& fn : package.Functions())
+        {
+            printf("  %s\n", fn.name.c_str());
+        }
+        return -1;
+    }
+    if (!info->isRawPointerAPI)
+    {
+        // The expanded memref calling convention has per-argument arity; point the user at the
+        // alias the package emits for exactly this purpose
+        printf("error: '%s' does not use the raw pointer API; benchmark its _raw alias instead\n", functionName.c_str());
+        return -1;
+    }
+
+    std::mt19937 gen(12345);
+    std::vector<void*> args;
+    for (const auto& arg : info->arguments)
+    {
+        size_t elements = 1;
+        for (uint32_t d = 0; d < arg.rank; ++d)
+        {
+            elements *= static_cast<size_t>(arg.shape[d]);
+        }
+        auto bytes = elements * element_size(arg.elementType);
+        void* buffer = aligned_alloc_64(bytes);
+        fill_random(buffer, elements, arg.elementType, gen);
+        args.push_back(buffer);
+    }
+
+    std::vector<uint8_t> flushBuffer;
+    if (flush)
+    {
+        flushBuffer.resize(256 * 1024 * 1024 / sizeof(uint8_t));
+    }
+
+    for (int i = 0; i < warmup; ++i)
+    {
+        if (!call_raw(info->address, args))
+        {
+            printf("error: '%s' takes %zu arguments; only up to 8 are supported\n", functionName.c_str(), args.size());
+            return -1;
+        }
+    }
+
+    std::vector<double> times(iters);
+    for (int i = 0; i < iters; ++i)
+    {
+        if (flush)
+        {
+            flush_caches(flushBuffer);
+        }
+        auto start = now_ms();
+        call_raw(info->address, args);
+        times[i] = now_ms() - start;
+    }
+
+    std::sort(times.begin(), times.end());
+    double min_ms = times.front();
+    double median_ms = times[iters / 2];
+    double p99_ms = times[std::min<size_t>(iters - 1, (iters * 99) / 100)];
+    double gflops = (m > 0 && n > 0 && k > 0) ? 1.0e-6 * 2.0 * m * n * k / median_ms : 0.0;
+
+    printf("%s,%d,%d,%d,%d,%f,%f,%f,%f\n", functionName.c_str(), m, n, k, iters, min_ms, median_ms, p99_ms, gflops);
+
+    for (auto* buffer : args)
+    {
+        free(buffer);
+    }
+    return 0;
+}
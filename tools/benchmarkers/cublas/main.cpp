@@ -8,6 +8,7 @@
 #include <cuda_runtime_api.h>
 #include <cuda.h>
 #include <cublas_v2.h>
+#include <cublasLt.h>
 
 #define CUDA_CALL(E)                                                              \
     do                                                                            \
@@ -79,9 +80,118 @@ void gemm<__half>(cublasHandle_t handle, int m, int n, int k, int transA, int tr
     CUBLAS_CALL(cublasHgemm(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc));
 }
 
-double calc_tflops(int m, int n, int k, float ms)
+template <typename T>
+void gemm_strided_batched(cublasHandle_t handle, int m, int n, int k, int transA, int transB, T alpha, T beta, const T* a, int lda, long long strideA, const T* b, int ldb, long long strideB, T* c, int ldc, long long strideC, int batch);
+
+template <>
+void gemm_strided_batched<float>(cublasHandle_t handle, int m, int n, int k, int transA, int transB, float alpha, float beta, const float* a, int lda, long long strideA, const float* b, int ldb, long long strideB, float* c, int ldc, long long strideC, int batch)
+{
+    CUBLAS_CALL(cublasSgemmStridedBatched(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, strideA, b, ldb, strideB, &beta, c, ldc, strideC, batch));
+}
+
+template <>
+void gemm_strided_batched<double>(cublasHandle_t handle, int m, int n, int k, int transA, int transB, double alpha, double beta, const double* a, int lda, long long strideA, const double* b, int ldb, long long strideB, double* c, int ldc, long long strideC, int batch)
+{
+    CUBLAS_CALL(cublasDgemmStridedBatched(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, strideA, b, ldb, strideB, &beta, c, ldc, strideC, batch));
+}
+
+template <>
+void gemm_strided_batched<__half>(cublasHandle_t handle, int m, int n, int k, int transA, int transB, __half alpha, __half beta, const __half* a, int lda, long long strideA, const __half* b, int ldb, long long strideB, __half* c, int ldc, long long strideC, int batch)
 {
-    return 1.0e-9 * 2.0 * k * m * n / ms;
+    CUBLAS_CALL(cublasHgemmStridedBatched(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, strideA, b, ldb, strideB, &beta, c, ldc, strideC, batch));
+}
+
+template <typename T>
+cudaDataType cuda_type()
+{
+    if constexpr (std::is_same<T, float>())
+    {
+        return CUDA_R_32F;
+    }
+    if constexpr (std::is_same<T, double>())
+    {
+        return CUDA_R_64F;
+    }
+    if constexpr (std::is_same<T, __half>())
+    {
+        return CUDA_R_16F;
+    }
+    if constexpr (std::is_same<T, int8_t>())
+    {
+        return CUDA_R_8I;
+    }
+    if constexpr (std::is_same<T, int32_t>())
+    {
+        return CUDA_R_32I;
+    }
+}
+
+cublasLtEpilogue_t epilogue_from_str(const char* epilogue)
+{
+    if (!strcmp(epilogue, "none"))
+    {
+        return CUBLASLT_EPILOGUE_DEFAULT;
+    }
+    if (!strcmp(epilogue, "relu"))
+    {
+        return CUBLASLT_EPILOGUE_RELU;
+    }
+    if (!strcmp(epilogue, "gelu"))
+    {
+        return CUBLASLT_EPILOGUE_GELU;
+    }
+    if (!strcmp(epilogue, "bias"))
+    {
+        return CUBLASLT_EPILOGUE_BIAS;
+    }
+    if (!strcmp(epilogue, "relu_bias"))
+    {
+        return CUBLASLT_EPILOGUE_RELU_BIAS;
+    }
+    printf("invalid epilogue: %s\n", epilogue);
+    exit(-1);
+}
+
+// Lt path: same math as the plain gemm but through cublasLtMatmul, which is where the fused
+// epilogues and the int8 kernels live. TIn/TOut differ only for int8 (int8 in, int32 out).
+template <typename TIn, typename TOut, typename TScale>
+void lt_gemm(cublasLtHandle_t handle, int m, int n, int k, int transA, int transB, TScale alpha, TScale beta, const TIn* a, int lda, const TIn* b, int ldb, TOut* c, int ldc, const TOut* bias, const char* epilogue, void* workspace, size_t workspaceSize)
+{
+    cublasComputeType_t computeType = std::is_same<TIn, int8_t>() ? CUBLAS_COMPUTE_32I : (std::is_same<TIn, double>() ? CUBLAS_COMPUTE_64F : CUBLAS_COMPUTE_32F);
+    cudaDataType scaleType = cuda_type<TScale>();
+
+    cublasLtMatmulDesc_t matmulDesc;
+    CUBLAS_CALL(cublasLtMatmulDescCreate(&matmulDesc, computeType, scaleType));
+
+    cublasOperation_t opA = trans(transA);
+    cublasOperation_t opB = trans(transB);
+    CUBLAS_CALL(cublasLtMatmulDescSetAttribute(matmulDesc, CUBLASLT_MATMUL_DESC_TRANSA, &opA, sizeof(opA)));
+    CUBLAS_CALL(cublasLtMatmulDescSetAttribute(matmulDesc, CUBLASLT_MATMUL_DESC_TRANSB, &opB, sizeof(opB)));
+
+    cublasLtEpilogue_t ep = epilogue_from_str(epilogue);
+    CUBLAS_CALL(cublasLtMatmulDescSetAttribute(matmulDesc, CUBLASLT_MATMUL_DESC_EPILOGUE, &ep, sizeof(ep)));
+    if (ep == CUBLASLT_EPILOGUE_BIAS || ep == CUBLASLT_EPILOGUE_RELU_BIAS)
+    {
+        CUBLAS_CALL(cublasLtMatmulDescSetAttribute(matmulDesc, CUBLASLT_MATMUL_DESC_BIAS_POINTER, &bias, sizeof(bias)));
+    }
+
+    cublasLtMatrixLayout_t layoutA, layoutB, layoutC;
+    CUBLAS_CALL(cublasLtMatrixLayoutCreate(&layoutA, cuda_type<TIn>(), transA ? k : m, transA ? m : k, lda));
+    CUBLAS_CALL(cublasLtMatrixLayoutCreate(&layoutB, cuda_type<TIn>(), transB ? n : k, transB ? k : n, ldb));
+    CUBLAS_CALL(cublasLtMatrixLayoutCreate(&layoutC, cuda_type<TOut>(), m, n, ldc));
+
+    // null algo lets the library pick from its heuristics, which is what a fair baseline means
+    CUBLAS_CALL(cublasLtMatmul(handle, matmulDesc, &alpha, a, layoutA, b, layoutB, &beta, c, layoutC, c, layoutC, nullptr, workspace, workspaceSize, nullptr));
+
+    CUBLAS_CALL(cublasLtMatrixLayoutDestroy(layoutC));
+    CUBLAS_CALL(cublasLtMatrixLayoutDestroy(layoutB));
+    CUBLAS_CALL(cublasLtMatrixLayoutDestroy(layoutA));
+    CUBLAS_CALL(cublasLtMatmulDescDestroy(matmulDesc));
+}
+
+double calc_tflops(int m, int n, int k, int batch, float ms)
+{
+    return 1.0e-9 * 2.0 * k * m * n * batch / ms;
 }
 
 template <typename T>
@@ -101,20 +211,46 @@ const char* type_to_str()
     {
         return "h";
     }
+
+    if constexpr (std::is_same<T, int8_t>())
+    {
+        return "i";
+    }
+}
+
+// One result schema across the cublas and rocblas runners so gpu_benchmark_tool.py can diff
+// vendor numbers against Accera per shape without per-runner parsers
+void print_result(const char* lib, const char* mode, const char* type, int m, int n, int k, int transA, int transB, float alpha, float beta, int lda, int ldb, int ldc, int batch, const char* epilogue, float ms, double tflops, int json)
+{
+    if (json)
+    {
+        printf("{\"lib\":\"%s\",\"mode\":\"%s\",\"type\":\"%s\",\"m\":%d,\"n\":%d,\"k\":%d,\"transA\":%d,\"transB\":%d,\"alpha\":%f,\"beta\":%f,\"lda\":%d,\"ldb\":%d,\"ldc\":%d,\"batch\":%d,\"epilogue\":\"%s\",\"ms\":%f,\"tflops\":%f}\n",
+               lib, mode, type, m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, batch, epilogue, ms, tflops);
+    }
+    else
+    {
+        printf("%s,%s,%s,%d,%d,%d,%d,%d,%f,%f,%d,%d,%d,%d,%s,%f,%f\n",
+               lib, mode, type, m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, batch, epilogue, ms, tflops);
+    }
 }
 
 template <typename T>
-void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int lda, int ldb, int ldc, int gpu_id)
+void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int lda, int ldb, int ldc, int gpu_id, int batch, const char* mode, const char* epilogue, int json)
 {
     CUDA_CALL(cudaSetDevice(gpu_id));
 
     cublasHandle_t handle;
     CUBLAS_CALL(cublasCreate(&handle));
-
-    T *a, *b, *c;
-    auto Asize = (transA ? m : k) * lda * sizeof(T);
-    auto Bsize = (transB ? k : n) * ldb * sizeof(T);
-    auto Csize = n * ldc * sizeof(T);
+    cublasLtHandle_t ltHandle;
+    CUBLAS_CALL(cublasLtCreate(&ltHandle));
+
+    T *a, *b, *c, *bias;
+    auto Astride = (long long)(transA ? m : k) * lda;
+    auto Bstride = (long long)(transB ? k : n) * ldb;
+    auto Cstride = (long long)n * ldc;
+    auto Asize = Astride * batch * sizeof(T);
+    auto Bsize = Bstride * batch * sizeof(T);
+    auto Csize = Cstride * batch * sizeof(T);
     CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&a),
                        Asize));
     CUDA_CALL(cudaMemset(a, 0xAB, Asize));
@@ -124,29 +260,122 @@ void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int
     CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&c),
                        Csize));
     CUDA_CALL(cudaMemset(c, 0xCD, Csize));
+    CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&bias), m * sizeof(T)));
+    CUDA_CALL(cudaMemset(bias, 0x11, m * sizeof(T)));
+
+    void* workspace;
+    const size_t workspaceSize = 4 * 1024 * 1024;
+    CUDA_CALL(cudaMalloc(&workspace, workspaceSize));
+
+    auto run = [&]() {
+        if (!strcmp(mode, "gemm"))
+        {
+            gemm(handle, m, n, k, transA, transB, alpha, beta, a, lda, b, ldb, c, ldc);
+        }
+        else if (!strcmp(mode, "batched"))
+        {
+            gemm_strided_batched(handle, m, n, k, transA, transB, alpha, beta, a, lda, Astride, b, ldb, Bstride, c, ldc, Cstride, batch);
+        }
+        else if (!strcmp(mode, "lt"))
+        {
+            lt_gemm<T, T, T>(ltHandle, m, n, k, transA, transB, alpha, beta, a, lda, b, ldb, c, ldc, bias, epilogue, workspace, workspaceSize);
+        }
+        else
+        {
+            printf("invalid mode: %s\n", mode);
+            exit(-1);
+        }
+    };
+
+    // warmup the library
+    run();
 
     cudaEvent_t start, end;
     CUDA_CALL(cudaEventCreate(&start));
     CUDA_CALL(cudaEventCreate(&end));
 
     CUDA_CALL(cudaEventRecord(start, nullptr));
-    gemm(handle, m, n, k, transA, transB, alpha, beta, a, lda, b, ldb, c, ldc);
+    run();
     CUDA_CALL(cudaEventRecord(end, nullptr));
     CUDA_CALL(cudaEventSynchronize(end));
     float ms;
     CUDA_CALL(cudaEventElapsedTime(&ms, start, end));
-    double tflops = calc_tflops(m, n, k, ms);
+    double tflops = calc_tflops(m, n, k, !strcmp(mode, "batched") ? batch : 1, ms);
 
     CUDA_CALL(cudaEventDestroy(end));
     CUDA_CALL(cudaEventDestroy(start));
+    CUDA_CALL(cudaFree(workspace));
+    CUDA_CALL(cudaFree(bias));
+    CUDA_CALL(cudaFree(c));
+    CUDA_CALL(cudaFree(b));
+    CUDA_CALL(cudaFree(a));
+    CUBLAS_CALL(cublasLtDestroy(ltHandle));
     CUBLAS_CALL(cublasDestroy(handle));
 
-    printf("%s,%d,%d,%d,%d,%d,%f,%f,%d,%d,%d,%f,%f\n", type_to_str<T>(), m, n, k, transA, transB, float(alpha), float(beta), lda, ldb, ldc, ms, tflops);
+    print_result("cublas", mode, type_to_str<T>(), m, n, k, transA, transB, float(alpha), float(beta), lda, ldb, ldc, batch, epilogue, ms, tflops, json);
+}
+
+// int8 runs through cublasLt only: int8 A/B, int32 accumulate and output
+void benchmark_int8(int m, int n, int k, int transA, int transB, int lda, int ldb, int ldc, int gpu_id, const char* epilogue, int json)
+{
+    CUDA_CALL(cudaSetDevice(gpu_id));
+
+    cublasLtHandle_t ltHandle;
+    CUBLAS_CALL(cublasLtCreate(&ltHandle));
+
+    int8_t *a, *b;
+    int32_t *c, *bias;
+    auto Asize = (size_t)(transA ? m : k) * lda * sizeof(int8_t);
+    auto Bsize = (size_t)(transB ? k : n) * ldb * sizeof(int8_t);
+    auto Csize = (size_t)n * ldc * sizeof(int32_t);
+    CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&a), Asize));
+    CUDA_CALL(cudaMemset(a, 0x01, Asize));
+    CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&b), Bsize));
+    CUDA_CALL(cudaMemset(b, 0x02, Bsize));
+    CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&c), Csize));
+    CUDA_CALL(cudaMemset(c, 0x00, Csize));
+    CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&bias), m * sizeof(int32_t)));
+    CUDA_CALL(cudaMemset(bias, 0x00, m * sizeof(int32_t)));
+
+    void* workspace;
+    const size_t workspaceSize = 4 * 1024 * 1024;
+    CUDA_CALL(cudaMalloc(&workspace, workspaceSize));
+
+    auto run = [&]() {
+        lt_gemm<int8_t, int32_t, int32_t>(ltHandle, m, n, k, transA, transB, 1, 0, a, lda, b, ldb, c, ldc, bias, epilogue, workspace, workspaceSize);
+    };
+
+    // warmup the library
+    run();
+
+    cudaEvent_t start, end;
+    CUDA_CALL(cudaEventCreate(&start));
+    CUDA_CALL(cudaEventCreate(&end));
+
+    CUDA_CALL(cudaEventRecord(start, nullptr));
+    run();
+    CUDA_CALL(cudaEventRecord(end, nullptr));
+    CUDA_CALL(cudaEventSynchronize(end));
+    float ms;
+    CUDA_CALL(cudaEventElapsedTime(&ms, start, end));
+    double tflops = calc_tflops(m, n, k, 1, ms);
+
+    CUDA_CALL(cudaEventDestroy(end));
+    CUDA_CALL(cudaEventDestroy(start));
+    CUDA_CALL(cudaFree(workspace));
+    CUDA_CALL(cudaFree(bias));
+    CUDA_CALL(cudaFree(c));
+    CUDA_CALL(cudaFree(b));
+    CUDA_CALL(cudaFree(a));
+    CUBLAS_CALL(cublasLtDestroy(ltHandle));
+
+    print_result("cublas", "lt", "i", m, n, k, transA, transB, 1.0f, 0.0f, lda, ldb, ldc, 1, epilogue, ms, tflops, json);
 }
 
 void print_help(const char* progName)
 {
-    printf("usage: %s typename([hsd]) m n k transA transB alpha beta lda ldb ldc\n", progName);
+    printf("usage: %s typename([hsdi]) m n k transA transB alpha beta lda ldb ldc gpu_id [batch] [mode(gemm|batched|lt)] [epilogue(none|relu|gelu|bias|relu_bias)] [--json]\n", progName);
+    printf("output: lib,mode,type,m,n,k,transA,transB,alpha,beta,lda,ldb,ldc,batch,epilogue,ms,tflops\n");
 }
 
 int main(int argc, char** argv)
@@ -183,6 +412,28 @@ int main(int argc, char** argv)
 
     int gpu_id = atoi(argv[++iarg]);
 
+    int batch = 1;
+    const char* mode = "gemm";
+    const char* epilogue = "none";
+    int json = 0;
+    if (iarg + 1 < argc && strcmp(argv[iarg + 1], "--json"))
+    {
+        batch = atoi(argv[++iarg]);
+    }
+    if (iarg + 1 < argc && strcmp(argv[iarg + 1], "--json"))
+    {
+        mode = argv[++iarg];
+    }
+    if (iarg + 1 < argc && strcmp(argv[iarg + 1], "--json"))
+    {
+        epilogue = argv[++iarg];
+    }
+    if (iarg + 1 < argc && !strcmp(argv[iarg + 1], "--json"))
+    {
+        json = 1;
+        ++iarg;
+    }
+
     ASSERT_NON_ZERO(m);
     ASSERT_NON_ZERO(n);
     ASSERT_NON_ZERO(k);
@@ -191,19 +442,25 @@ int main(int argc, char** argv)
     ASSERT_NON_ZERO(ldb);
     ASSERT_NON_ZERO(ldc);
 
+    ASSERT_NON_ZERO(batch);
+
     switch (type[0])
     {
     case 'H':
     case 'h':
-        benchmark<__half>(m, n, k, transA, transB, __half(alpha), __half(beta), lda, ldb, ldc, gpu_id);
+        benchmark<__half>(m, n, k, transA, transB, __half(alpha), __half(beta), lda, ldb, ldc, gpu_id, batch, mode, epilogue, json);
         break;
     case 'S':
     case 's':
-        benchmark<float>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id);
+        benchmark<float>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id, batch, mode, epilogue, json);
         break;
     case 'D':
     case 'd':
-        benchmark<double>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id);
+        benchmark<double>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id, batch, mode, epilogue, json);
+        break;
+    case 'I':
+    case 'i':
+        benchmark_int8(m, n, k, transA, transB, lda, ldb, ldc, gpu_id, epilogue, json);
         break;
     default:
         printf("invaild typename: %s\n", type);
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+####################################################################################################
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License. See LICENSE in the project root for license information.
+####################################################################################################
+#
+# Performance regression gate for HAT packages.
+#
+# Compares a candidate package against a baseline package (or a stored baseline result file),
+# running matched benchmarks for every function the two have in common. Trials are interleaved
+# between candidate and baseline so that machine-level noise (thermal drift, a backup job kicking
+# in halfway through) hits both sides, and the per-function comparison is a Mann-Whitney rank-sum
+# test rather than a comparison of two single numbers. Exits non-zero when any shared function
+# regressed by more than the threshold with statistical significance, which is what CI hooks on.
+#
+# Examples:
+#   regression_gate.py candidate/pkg.hat --baseline main/pkg.hat --threshold 5
+#   regression_gate.py candidate/pkg.hat --baseline-file baseline.json --save-results results.json
+#   regression_gate.py main/pkg.hat --save-results baseline.json   # record a baseline
+
+import argparse
+import json
+import math
+import sys
+
+import hatlib
+
+
+def run_trial(hat_path, batch_size, min_time_in_sec, gpu_id):
+    """Runs one benchmark trial of every function in the package, returning {function: mean_ms}."""
+    results = hatlib.run_benchmark(hat_path, batch_size=batch_size, min_time_in_sec=min_time_in_sec, gpu_id=gpu_id)
+    trial = {}
+    for result in results:
+        time_s = result.get('min_of_means', '-')
+        if time_s != '-':
+            trial[result['function_name']] = float(time_s) * 1e3
+    return trial
+
+
+def collect_samples(candidate_path, baseline_path, trials, batch_size, min_time_in_sec, gpu_id, verbose):
+    """Interleaves candidate and baseline trials so noise is shared, returning per-function samples."""
+    candidate_samples = {}
+    baseline_samples = {}
+    for trial in range(trials):
+        if verbose:
+            print(f'Trial {trial + 1}/{trials}')
+        for path, samples in ((candidate_path, candidate_samples), (baseline_path, baseline_samples)):
+            if path is None:
+                continue
+            for name, time_ms in run_trial(path, batch_size, min_time_in_sec, gpu_id).items():
+                samples.setdefault(name, []).append(time_ms)
+    return candidate_samples, baseline_samples
+
+
+def mann_whitney_u(a, b):
+    """Two-sided Mann-Whitney rank-sum p-value via the normal approximation.
+
+    Implemented directly so the gate does not pull in scipy; with the trial counts used here
+    (single digits to tens) the approximation is adequate for a pass/fail decision.
+    """
+    combined = sorted((value, 0) for value in a) + sorted((value, 1) for value in b)
+    combined.sort(key=lambda pair: pair[0])
+
+    # midranks, averaging over ties
+    ranks = [0.0] * len(combined)
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        midrank = (i + j) / 2.0 + 1.0
+        for idx in range(i, j + 1):
+            ranks[idx] = midrank
+        i = j + 1
+
+    n_a = len(a)
+    n_b = len(b)
+    rank_sum_a = sum(rank for rank, (_, side) in zip(ranks, combined) if side == 0)
+    u_a = rank_sum_a - n_a * (n_a + 1) / 2.0
+
+    mean_u = n_a * n_b / 2.0
+    std_u = math.sqrt(n_a * n_b * (n_a + n_b + 1) / 12.0)
+    if std_u == 0.0:
+        return 1.0
+    z = (u_a - mean_u) / std_u
+    return math.erfc(abs(z) / math.sqrt(2.0))
+
+
+def median(samples):
+    ordered = sorted(samples)
+    mid = len(ordered) // 2
+    return ordered[mid] if len(ordered) % 2 else (ordered[mid - 1] + ordered[mid]) / 2.0
+
+
+def compare(candidate_samples, baseline_samples, threshold_percent, alpha):
+    """Returns (rows, failed) with one row per shared function."""
+    rows = []
+    failed = False
+    shared = sorted(set(candidate_samples) & set(baseline_samples))
+    for name in sorted(set(candidate_samples) ^ set(baseline_samples)):
+        side = 'baseline' if name in baseline_samples else 'candidate'
+        print(f'warning: {name} only exists in the {side} package, skipping')
+
+    for name in shared:
+        candidate_ms = median(candidate_samples[name])
+        baseline_ms = median(baseline_samples[name])
+        delta_percent = (candidate_ms - baseline_ms) / baseline_ms * 100.0
+        p_value = mann_whitney_u(candidate_samples[name], baseline_samples[name])
+        regressed = delta_percent > threshold_percent and p_value < alpha
+        failed = failed or regressed
+        rows.append({
+            'function': name,
+            'baseline_ms': baseline_ms,
+            'candidate_ms': candidate_ms,
+            'delta_percent': delta_percent,
+            'p_value': p_value,
+            'status': 'FAIL' if regressed else 'pass',
+        })
+    return rows, failed
+
+
+def main(args=[]):
+    parser = argparse.ArgumentParser(description='Performance regression gate comparing HAT packages across builds')
+    parser.add_argument('candidate', help='Path to the candidate .hat package')
+    parser.add_argument('--baseline', default=None, help='Path to the baseline .hat package')
+    parser.add_argument('--baseline_file', default=None, help='Path to a stored baseline result file (from --save_results)')
+    parser.add_argument('--trials', type=int, default=7, help='Number of interleaved trials per side')
+    parser.add_argument('--batch_size', type=int, default=10, help='Batch size passed to hatlib per trial')
+    parser.add_argument('--min_time', type=float, default=0.25, help='Minimum seconds per trial per function')
+    parser.add_argument('--gpu_id', type=int, default=0, help='GPU to benchmark on, for GPU packages')
+    parser.add_argument('--threshold', type=float, default=5.0, help='Regression threshold in percent')
+    parser.add_argument('--alpha', type=float, default=0.05, help='Significance level for the Mann-Whitney test')
+    parser.add_argument('--save_results', default=None, help='Write candidate samples to this file, usable later as --baseline_file')
+    parser.add_argument('--verbose', action='store_true', help='Enable verbose logging')
+    args = parser.parse_args(args)
+
+    if args.baseline and args.baseline_file:
+        parser.error('--baseline and --baseline_file are mutually exclusive')
+
+    candidate_samples, baseline_samples = collect_samples(
+        args.candidate, args.baseline, args.trials, args.batch_size, args.min_time, args.gpu_id, args.verbose)
+
+    if args.baseline_file:
+        with open(args.baseline_file, 'r') as baseline_file:
+            baseline_samples = json.load(baseline_file)['functions']
+
+    if args.save_results:
+        with open(args.save_results, 'w') as results_file:
+            json.dump({'functions': candidate_samples}, results_file, indent=2)
+        print(f'Wrote candidate samples to {args.save_results}')
+
+    if not baseline_samples:
+        if args.save_results:
+            return 0
+        parser.error('no baseline: pass --baseline or --baseline_file (or --save_results to record one)')
+
+    rows, failed = compare(candidate_samples, baseline_samples, args.threshold, args.alpha)
+    if not rows:
+        print('error: no shared functions between candidate and baseline')
+        return 1
+
+    print(f"{'function':<50} {'baseline_ms':>12} {'candidate_ms':>13} {'delta_%':>8} {'p_value':>8} status")
+    for row in rows:
+        print(f"{row['function']:<50} {row['baseline_ms']:>12.4f} {row['candidate_ms']:>13.4f} {row['delta_percent']:>8.2f} {row['p_value']:>8.4f} {row['status']}")
+
+    if failed:
+        print(f"FAIL: regression above {args.threshold}% (p < {args.alpha})")
+        return 1
+    print('pass')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
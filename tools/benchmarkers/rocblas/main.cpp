@@ -82,9 +82,30 @@ void gemm<rocblas_half>(rocblas_handle handle, int m, int n, int k, int transA,
     ROCBLAS_CALL(rocblas_hgemm(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc));
 }
 
-double calc_tflops(int m, int n, int k, float ms)
+template <typename T>
+void gemm_strided_batched(rocblas_handle handle, int m, int n, int k, int transA, int transB, T alpha, T beta, const T* a, int lda, rocblas_stride strideA, const T* b, int ldb, rocblas_stride strideB, T* c, int ldc, rocblas_stride strideC, int batch);
+
+template <>
+void gemm_strided_batched<float>(rocblas_handle handle, int m, int n, int k, int transA, int transB, float alpha, float beta, const float* a, int lda, rocblas_stride strideA, const float* b, int ldb, rocblas_stride strideB, float* c, int ldc, rocblas_stride strideC, int batch)
+{
+    ROCBLAS_CALL(rocblas_sgemm_strided_batched(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, strideA, b, ldb, strideB, &beta, c, ldc, strideC, batch));
+}
+
+template <>
+void gemm_strided_batched<double>(rocblas_handle handle, int m, int n, int k, int transA, int transB, double alpha, double beta, const double* a, int lda, rocblas_stride strideA, const double* b, int ldb, rocblas_stride strideB, double* c, int ldc, rocblas_stride strideC, int batch)
 {
-    return 1.0e-9 * 2.0 * k * m * n / ms;
+    ROCBLAS_CALL(rocblas_dgemm_strided_batched(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, strideA, b, ldb, strideB, &beta, c, ldc, strideC, batch));
+}
+
+template <>
+void gemm_strided_batched<rocblas_half>(rocblas_handle handle, int m, int n, int k, int transA, int transB, rocblas_half alpha, rocblas_half beta, const rocblas_half* a, int lda, rocblas_stride strideA, const rocblas_half* b, int ldb, rocblas_stride strideB, rocblas_half* c, int ldc, rocblas_stride strideC, int batch)
+{
+    ROCBLAS_CALL(rocblas_hgemm_strided_batched(handle, trans(transA), trans(transB), m, n, k, &alpha, a, lda, strideA, b, ldb, strideB, &beta, c, ldc, strideC, batch));
+}
+
+double calc_tflops(int m, int n, int k, int batch, float ms)
+{
+    return 1.0e-9 * 2.0 * k * m * n * batch / ms;
 }
 
 template <typename T>
@@ -103,8 +124,24 @@ const char* type_to_str() {
 }
 
 
+// One result schema across the cublas and rocblas runners so gpu_benchmark_tool.py can diff
+// vendor numbers against Accera per shape without per-runner parsers
+void print_result(const char* lib, const char* mode, const char* type, int m, int n, int k, int transA, int transB, float alpha, float beta, int lda, int ldb, int ldc, int batch, const char* epilogue, float ms, double tflops, int json)
+{
+    if (json)
+    {
+        printf("{\"lib\":\"%s\",\"mode\":\"%s\",\"type\":\"%s\",\"m\":%d,\"n\":%d,\"k\":%d,\"transA\":%d,\"transB\":%d,\"alpha\":%f,\"beta\":%f,\"lda\":%d,\"ldb\":%d,\"ldc\":%d,\"batch\":%d,\"epilogue\":\"%s\",\"ms\":%f,\"tflops\":%f}\n",
+               lib, mode, type, m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, batch, epilogue, ms, tflops);
+    }
+    else
+    {
+        printf("%s,%s,%s,%d,%d,%d,%d,%d,%f,%f,%d,%d,%d,%d,%s,%f,%f\n",
+               lib, mode, type, m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, batch, epilogue, ms, tflops);
+    }
+}
+
 template <typename T>
-void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int lda, int ldb, int ldc, int gpu_id)
+void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int lda, int ldb, int ldc, int gpu_id, int batch, const char* mode, int json)
 {
     HIP_CALL(hipSetDevice(gpu_id));
 
@@ -112,9 +149,12 @@ void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int
     ROCBLAS_CALL(rocblas_create_handle(&handle));
 
     T *a, *b, *c;
-    auto Asize = m * k * sizeof(T);
-    auto Bsize = k * n * sizeof(T);
-    auto Csize = n * m * sizeof(T);
+    auto Astride = (rocblas_stride)(transA ? m : k) * lda;
+    auto Bstride = (rocblas_stride)(transB ? k : n) * ldb;
+    auto Cstride = (rocblas_stride)n * ldc;
+    auto Asize = Astride * batch * sizeof(T);
+    auto Bsize = Bstride * batch * sizeof(T);
+    auto Csize = Cstride * batch * sizeof(T);
     HIP_CALL(hipMalloc(reinterpret_cast<void**>(&a),
                        Asize));
     HIP_CALL(hipMalloc(reinterpret_cast<void**>(&b),
@@ -125,8 +165,25 @@ void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int
     HIP_CALL(hipMemset(b, 0xBC, Bsize));
     HIP_CALL(hipMemset(c, 0xCD, Csize));
 
+    auto run = [&]() {
+        if (!strcmp(mode, "gemm"))
+        {
+            gemm(handle, m, n, k, transA, transB, alpha, beta, a, lda, b, ldb, c, ldc);
+        }
+        else if (!strcmp(mode, "batched"))
+        {
+            gemm_strided_batched(handle, m, n, k, transA, transB, alpha, beta, a, lda, Astride, b, ldb, Bstride, c, ldc, Cstride, batch);
+        }
+        else
+        {
+            // rocblas has no cublasLt counterpart; hipblasLt is a separate library
+            printf("invalid mode: %s\n", mode);
+            exit(-1);
+        }
+    };
+
     // warmup the library
-    gemm(handle, m, n, k, transA, transB, alpha, beta, a, lda, b, ldb, c, ldc);
+    run();
 
     HIP_CALL(hipMemset(a, 0xBC, Asize));
     HIP_CALL(hipMemset(b, 0xAB, Bsize));
@@ -140,22 +197,23 @@ void benchmark(int m, int n, int k, int transA, int transB, T alpha, T beta, int
 
     HIP_CALL(hipEventSynchronize(start));
     HIP_CALL(hipEventRecord(start, nullptr));
-    gemm(handle, m, n, k, transA, transB, alpha, beta, a, lda, b, ldb, c, ldc);
+    run();
     HIP_CALL(hipEventRecord(end, nullptr));
     HIP_CALL(hipEventSynchronize(end));
     HIP_CALL(hipEventElapsedTime(&ms, start, end));
-    double tflops = calc_tflops(m, n, k, ms);
+    double tflops = calc_tflops(m, n, k, !strcmp(mode, "batched") ? batch : 1, ms);
 
     HIP_CALL(hipEventDestroy(end));
     HIP_CALL(hipEventDestroy(start));
     ROCBLAS_CALL(rocblas_destroy_handle(handle));
 
-    printf("%s,%d,%d,%d,%d,%d,%f,%f,%d,%d,%d,%f,%f\n", type_to_str<T>(), m, n, k, transA, transB, 1.0, 1.0, lda, ldb, ldc, ms, tflops);
+    print_result("rocblas", mode, type_to_str<T>(), m, n, k, transA, transB, 1.0f, 1.0f, lda, ldb, ldc, batch, "none", ms, tflops, json);
 }
 
 void print_help(const char* progName)
 {
-    printf("usage: %s typename([hsd]) m n k transA transB alpha beta lda ldb ldc\n", progName);
+    printf("usage: %s typename([hsd]) m n k transA transB alpha beta lda ldb ldc gpu_id [batch] [mode(gemm|batched)] [--json]\n", progName);
+    printf("output: lib,mode,type,m,n,k,transA,transB,alpha,beta,lda,ldb,ldc,batch,epilogue,ms,tflops\n");
 }
 
 int main(int argc, char** argv)
@@ -192,6 +250,23 @@ int main(int argc, char** argv)
 
     int gpu_id = atoi(argv[++iarg]);
 
+    int batch = 1;
+    const char* mode = "gemm";
+    int json = 0;
+    if (iarg + 1 < argc && strcmp(argv[iarg + 1], "--json"))
+    {
+        batch = atoi(argv[++iarg]);
+    }
+    if (iarg + 1 < argc && strcmp(argv[iarg + 1], "--json"))
+    {
+        mode = argv[++iarg];
+    }
+    if (iarg + 1 < argc && !strcmp(argv[iarg + 1], "--json"))
+    {
+        json = 1;
+        ++iarg;
+    }
+
     ASSERT_NON_ZERO(m);
     ASSERT_NON_ZERO(n);
     ASSERT_NON_ZERO(k);
@@ -200,21 +275,23 @@ int main(int argc, char** argv)
     ASSERT_NON_ZERO(ldb);
     ASSERT_NON_ZERO(ldc);
 
+    ASSERT_NON_ZERO(batch);
+
     // rocblas_initialize();
 
     switch (type[0])
     {
     case 'H':
     case 'h':
-        benchmark<rocblas_half>(m, n, k, transA, transB, fp32_to_fp16(alpha), fp32_to_fp16(beta), lda, ldb, ldc, gpu_id);
+        benchmark<rocblas_half>(m, n, k, transA, transB, fp32_to_fp16(alpha), fp32_to_fp16(beta), lda, ldb, ldc, gpu_id, batch, mode, json);
         break;
     case 'S':
     case 's':
-        benchmark<float>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id);
+        benchmark<float>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id, batch, mode, json);
         break;
     case 'D':
     case 'd':
-        benchmark<double>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id);
+        benchmark<double>(m, n, k, transA, transB, alpha, beta, lda, ldb, ldc, gpu_id, batch, mode, json);
         break;
     default:
         printf("invaild typename: %s\n", type);